@@ -18,6 +18,8 @@
 #include <QElapsedTimer>
 #include <QVector4D>
 
+#include <algorithm>
+
 #include "qgs3dutils.h"
 #include "qgschunkboundsentity_p.h"
 #include "qgschunklist_p.h"
@@ -79,7 +81,7 @@ QgsChunkedEntity::~QgsChunkedEntity()
   // derived classes have to make sure that any pending active job has finished / been canceled
   // before getting to this destructor - here it would be too late to cancel them
   // (e.g. objects required for loading/updating have been deleted already)
-  Q_ASSERT( !mActiveJob );
+  Q_ASSERT( mActiveJobs.isEmpty() );
 
   // clean up any pending load requests
   while ( !mChunkLoaderQueue->isEmpty() )
@@ -127,6 +129,9 @@ void QgsChunkedEntity::update( const SceneState &state )
 
   update( mRootNode, state );
 
+  // drop stale load requests and re-prioritize the rest for the new camera
+  pruneLoaderQueue( state );
+
   int enabled = 0, disabled = 0, unloaded = 0;
 
   Q_FOREACH ( QgsChunkNode *node, mActiveNodes )
@@ -147,13 +152,18 @@ void QgsChunkedEntity::update( const SceneState &state )
     ++disabled;
   }
 
-  // unload those that are over the limit for replacement
-  // TODO: what to do when our cache is too small and nodes are being constantly evicted + loaded again
-  while ( mReplacementQueue->count() > mMaxLoadedChunks )
+  // unload chunks when we are over the limit for replacement. Eviction only
+  // kicks in when the limit is exceeded and then frees a bigger batch: without
+  // this hysteresis a full cache would evict and reload the same chunks on
+  // every frame
+  if ( mReplacementQueue->count() > mMaxLoadedChunks )
   {
-    QgsChunkListEntry *entry = mReplacementQueue->takeLast();
-    entry->chunk->unloadChunk();  // also deletes the entry
-    ++unloaded;
+    while ( mReplacementQueue->count() > mMaxLoadedChunks * 3 / 4 )
+    {
+      QgsChunkListEntry *entry = mReplacementQueue->takeLast();
+      entry->chunk->unloadChunk();  // also deletes the entry
+      ++unloaded;
+    }
   }
 
   if ( mBboxesEntity )
@@ -164,9 +174,8 @@ void QgsChunkedEntity::update( const SceneState &state )
     mBboxesEntity->setBoxes( bboxes );
   }
 
-  // start a job from queue if there is anything waiting
-  if ( !mActiveJob )
-    startJob();
+  // start jobs from queue if there is anything waiting
+  startJobs();
 
   mNeedsUpdate = false;  // just updated
 
@@ -203,7 +212,7 @@ void QgsChunkedEntity::updateNodes( const QList<QgsChunkNode *> &nodes, QgsChunk
     }
     else if ( node->state() == QgsChunkNode::Updating )
     {
-      cancelActiveJob();  // we have currently just one active job so that must be it
+      cancelActiveJob( node->updater() );
     }
 
     Q_ASSERT( node->state() == QgsChunkNode::Loaded );
@@ -214,13 +223,12 @@ void QgsChunkedEntity::updateNodes( const QList<QgsChunkNode *> &nodes, QgsChunk
   }
 
   // trigger update
-  if ( !mActiveJob )
-    startJob();
+  startJobs();
 }
 
 int QgsChunkedEntity::pendingJobsCount() const
 {
-  return mChunkLoaderQueue->count() + ( mActiveJob ? 1 : 0 );
+  return mChunkLoaderQueue->count() + mActiveJobs.count();
 }
 
 
@@ -276,6 +284,39 @@ void QgsChunkedEntity::update( QgsChunkNode *node, const SceneState &state )
 }
 
 
+void QgsChunkedEntity::pruneLoaderQueue( const SceneState &state )
+{
+  QVector<QgsChunkListEntry *> keptEntries;
+
+  // when the camera moves fast, the loader queue fills up with chunks that
+  // the view has already left - cancel those requests instead of loading
+  // data that would be thrown away immediately
+  while ( !mChunkLoaderQueue->isEmpty() )
+  {
+    QgsChunkListEntry *entry = mChunkLoaderQueue->takeFirst();
+    if ( entry->chunk->state() == QgsChunkNode::QueuedForLoad && Qgs3DUtils::isCullable( entry->chunk->bbox(), state.viewProjectionMatrix ) )
+    {
+      entry->chunk->cancelQueuedForLoad();  // also deletes the entry
+      continue;
+    }
+
+    // queued updates are kept even when culled - the node stays loaded and
+    // its data would be out of date when it comes back into view
+    keptEntries << entry;
+  }
+
+  // order the queue by screen space error so that the chunks with the biggest
+  // impact on the rendered image are loaded first
+  std::sort( keptEntries.begin(), keptEntries.end(), [&state]( QgsChunkListEntry * i1, QgsChunkListEntry * i2 )
+  {
+    return screenSpaceError( i1->chunk, state ) > screenSpaceError( i2->chunk, state );
+  } );
+
+  Q_FOREACH ( QgsChunkListEntry *entry, keptEntries )
+    mChunkLoaderQueue->insertLast( entry );
+}
+
+
 void QgsChunkedEntity::requestResidency( QgsChunkNode *node )
 {
   if ( node->state() == QgsChunkNode::Loaded || node->state() == QgsChunkNode::QueuedForUpdate || node->state() == QgsChunkNode::Updating )
@@ -321,7 +362,7 @@ void QgsChunkedEntity::onActiveJobFinished()
 
   QgsChunkQueueJob *job = qobject_cast<QgsChunkQueueJob *>( sender() );
   Q_ASSERT( job );
-  Q_ASSERT( job == mActiveJob );
+  Q_ASSERT( mActiveJobs.contains( job ) );
 
   QgsChunkNode *node = job->chunk();
 
@@ -356,51 +397,54 @@ void QgsChunkedEntity::onActiveJobFinished()
   }
 
   // cleanup the job that has just finished
-  mActiveJob->deleteLater();
-  mActiveJob = nullptr;
+  mActiveJobs.removeOne( job );
+  job->deleteLater();
 
   // start another job - if any
-  startJob();
+  startJobs();
 
   if ( pendingJobsCount() != oldJobsCount )
     emit pendingJobsCountChanged();
 }
 
-void QgsChunkedEntity::startJob()
+void QgsChunkedEntity::startJobs()
 {
-  Q_ASSERT( !mActiveJob );
-  if ( mChunkLoaderQueue->isEmpty() )
-    return;
-
-  QgsChunkListEntry *entry = mChunkLoaderQueue->takeFirst();
-  Q_ASSERT( entry );
-  QgsChunkNode *node = entry->chunk;
-  delete entry;
-
-  if ( node->state() == QgsChunkNode::QueuedForLoad )
-  {
-    QgsChunkLoader *loader = mChunkLoaderFactory->createChunkLoader( node );
-    connect( loader, &QgsChunkQueueJob::finished, this, &QgsChunkedEntity::onActiveJobFinished );
-    node->setLoading( loader );
-    mActiveJob = loader;
-  }
-  else if ( node->state() == QgsChunkNode::QueuedForUpdate )
+  // the chunk loader queue is kept sorted by how recently the chunks were
+  // requested for the current view, so taking entries from the front gives
+  // priority to the chunks with the biggest impact on screen-space error
+  while ( mActiveJobs.count() < mMaxActiveJobs && !mChunkLoaderQueue->isEmpty() )
   {
-    node->setUpdating();
-    connect( node->updater(), &QgsChunkQueueJob::finished, this, &QgsChunkedEntity::onActiveJobFinished );
-    mActiveJob = node->updater();
+    QgsChunkListEntry *entry = mChunkLoaderQueue->takeFirst();
+    Q_ASSERT( entry );
+    QgsChunkNode *node = entry->chunk;
+    delete entry;
+
+    if ( node->state() == QgsChunkNode::QueuedForLoad )
+    {
+      QgsChunkLoader *loader = mChunkLoaderFactory->createChunkLoader( node );
+      connect( loader, &QgsChunkQueueJob::finished, this, &QgsChunkedEntity::onActiveJobFinished );
+      node->setLoading( loader );
+      mActiveJobs.append( loader );
+    }
+    else if ( node->state() == QgsChunkNode::QueuedForUpdate )
+    {
+      node->setUpdating();
+      connect( node->updater(), &QgsChunkQueueJob::finished, this, &QgsChunkedEntity::onActiveJobFinished );
+      mActiveJobs.append( node->updater() );
+    }
+    else
+      Q_ASSERT( false );  // not possible
   }
-  else
-    Q_ASSERT( false );  // not possible
 }
 
-void QgsChunkedEntity::cancelActiveJob()
+void QgsChunkedEntity::cancelActiveJob( QgsChunkQueueJob *job )
 {
-  Q_ASSERT( mActiveJob );
+  Q_ASSERT( job );
+  Q_ASSERT( mActiveJobs.contains( job ) );
 
-  QgsChunkNode *node = mActiveJob->chunk();
+  QgsChunkNode *node = job->chunk();
 
-  if ( qobject_cast<QgsChunkLoader *>( mActiveJob ) )
+  if ( qobject_cast<QgsChunkLoader *>( job ) )
   {
     // return node back to skeleton
     node->cancelLoading();
@@ -411,9 +455,17 @@ void QgsChunkedEntity::cancelActiveJob()
     node->cancelUpdating();
   }
 
-  mActiveJob->cancel();
-  mActiveJob->deleteLater();
-  mActiveJob = nullptr;
+  job->cancel();
+  mActiveJobs.removeOne( job );
+  job->deleteLater();
+}
+
+void QgsChunkedEntity::cancelActiveJobs()
+{
+  while ( !mActiveJobs.isEmpty() )
+  {
+    cancelActiveJob( mActiveJobs.first() );
+  }
 }
 
 /// @endcond
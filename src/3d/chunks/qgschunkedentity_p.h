@@ -86,8 +86,10 @@ class QgsChunkedEntity : public Qt3DCore::QEntity
     int pendingJobsCount() const;
 
   protected:
-    //! Cancels the background job that is currently in progress
-    void cancelActiveJob();
+    //! Cancels one particular background job that is currently in progress
+    void cancelActiveJob( QgsChunkQueueJob *job );
+    //! Cancels all background jobs that are currently in progress
+    void cancelActiveJobs();
     //! Sets whether the entity needs to get active nodes updated
     void setNeedsUpdate( bool needsUpdate ) { mNeedsUpdate = needsUpdate; }
 
@@ -97,7 +99,10 @@ class QgsChunkedEntity : public Qt3DCore::QEntity
     //! make sure that the chunk will be loaded soon (if not loaded yet) and not unloaded anytime soon (if loaded already)
     void requestResidency( QgsChunkNode *node );
 
-    void startJob();
+    //! cancels pending load requests of chunks outside of the view frustum and sorts the rest by screen space error
+    void pruneLoaderQueue( const SceneState &state );
+
+    void startJobs();
 
   private slots:
     void onActiveJobFinished();
@@ -136,8 +141,11 @@ class QgsChunkedEntity : public Qt3DCore::QEntity
     //! Entity that shows bounding boxes of active chunks (null if not enabled)
     QgsChunkBoundsEntity *mBboxesEntity = nullptr;
 
-    //! job that is currently being processed (asynchronously in a worker thread)
-    QgsChunkQueueJob *mActiveJob = nullptr;
+    //! jobs that are currently being processed (asynchronously in worker threads)
+    QList<QgsChunkQueueJob *> mActiveJobs;
+
+    //! max. number of jobs being processed at the same time
+    int mMaxActiveJobs = 4;
 };
 
 /// @endcond
@@ -131,6 +131,12 @@ bool Qgs3DUtils::exportAnimation( const Qgs3DAnimationSettings &animationSetting
     return false;
   }
 
+  // The very first capture of a freshly created engine returns an empty image.
+  // Capturing an initial image and throwing it away fixes that. The scene stays
+  // warm afterwards, so this only needs to be done once per export rather than
+  // once per frame. Hopefully we will find a better fix in the future.
+  Qgs3DUtils::captureSceneImage( engine, scene );
+
   while ( time <= duration )
   {
 
@@ -153,10 +159,6 @@ bool Qgs3DUtils::exportAnimation( const Qgs3DAnimationSettings &animationSetting
     fileName.replace( token, frameNoPaddedLeft );
     const QString path = QDir( outputDirectory ).filePath( fileName );
 
-    // It would initially return empty rendered image.
-    // Capturing the initial image and throwing it away fixes that.
-    // Hopefully we will find a better fix in the future.
-    Qgs3DUtils::captureSceneImage( engine, scene );
     QImage img = Qgs3DUtils::captureSceneImage( engine, scene );
 
     img.save( path );
@@ -164,7 +164,16 @@ void QgsLayoutItem3DMap::draw( QgsLayoutItemRenderContext &context )
     if ( mDrawing )
       return;
     mDrawing = true;
-    Qgs3DUtils::captureSceneImage( *mEngine.get(), mScene );
+    if ( !mEngineWarmedUp )
+    {
+      // the very first capture of a freshly created engine returns an empty
+      // image - capture one image and throw it away to get the engine into a
+      // usable state. the engine and scene (with all its loaded chunks and
+      // textures) are kept alive between draws, so subsequent refreshes such
+      // as further atlas pages skip this extra full render
+      Qgs3DUtils::captureSceneImage( *mEngine.get(), mScene );
+      mEngineWarmedUp = true;
+    }
     QImage img = Qgs3DUtils::captureSceneImage( *mEngine.get(), mScene );
     painter->drawImage( r, img );
     painter->restore();
@@ -243,6 +252,7 @@ void QgsLayoutItem3DMap::setMapSettings( Qgs3DMapSettings *settings )
 
   mEngine.reset();
   mScene = nullptr;
+  mEngineWarmedUp = false;
 
   mCapturedImage = QImage();
   update();
@@ -124,6 +124,8 @@ class _3D_EXPORT QgsLayoutItem3DMap : public QgsLayoutItem
     QImage mCapturedImage;
     QgsCameraPose mCameraPose;
     bool mDrawing = false;
+    //! Whether the initial throwaway capture has been done for the current engine
+    bool mEngineWarmedUp = false;
 
     //! Unique identifier
     int mMapId = 1;
@@ -407,12 +407,14 @@ void QgsModelPoint3DSymbolHandler::makeEntity( Qt3DCore::QEntity *parent, const
 void QgsModelPoint3DSymbolHandler::addSceneEntities( const Qgs3DMapSettings &map, const QVector<QVector3D> &positions, const QgsPoint3DSymbol &symbol, Qt3DCore::QEntity *parent )
 {
   Q_UNUSED( map );
+  const QUrl url = QUrl::fromLocalFile( symbol.shapeProperties()[QStringLiteral( "model" )].toString() );
   for ( const QVector3D &position : positions )
   {
     // build the entity
     Qt3DCore::QEntity *entity = new Qt3DCore::QEntity;
 
-    QUrl url = QUrl::fromLocalFile( symbol.shapeProperties()[QStringLiteral( "model" )].toString() );
+    // scene loaders cannot be shared - the loaded sub-tree is parented to the
+    // loader's entity - so each feature needs its own loader instance
     Qt3DRender::QSceneLoader *modelLoader = new Qt3DRender::QSceneLoader;
     modelLoader->setSource( url );
 
@@ -433,16 +435,18 @@ void QgsModelPoint3DSymbolHandler::addMeshEntities( const Qgs3DMapSettings &map,
     mat->setAmbient( map.selectionColor().darker() );
   }
 
+  // load the model only once - components are shareable, so all entities
+  // reference the same mesh data on the GPU and only differ by their transform
+  QUrl url = QUrl::fromLocalFile( symbol.shapeProperties()[QStringLiteral( "model" )].toString() );
+  Qt3DRender::QMesh *mesh = new Qt3DRender::QMesh;
+  mesh->setSource( url );
+
   // get nodes
   for ( const QVector3D &position : positions )
   {
     // build the entity
     Qt3DCore::QEntity *entity = new Qt3DCore::QEntity;
 
-    QUrl url = QUrl::fromLocalFile( symbol.shapeProperties()[QStringLiteral( "model" )].toString() );
-    Qt3DRender::QMesh *mesh = new Qt3DRender::QMesh;
-    mesh->setSource( url );
-
     entity->addComponent( mesh );
     entity->addComponent( mat );
     entity->addComponent( transform( position, symbol ) );
@@ -129,8 +129,10 @@ void QgsDemTerrainTileLoader::onHeightMapReady( int jobId, const QByteArray &hei
 
 #include <qgsrasterlayer.h>
 #include <qgsrasterprojector.h>
+#include <qgssettings.h>
 #include <QtConcurrent/QtConcurrentRun>
 #include <QFutureWatcher>
+#include <QTimer>
 
 QgsDemHeightMapGenerator::QgsDemHeightMapGenerator( QgsRasterLayer *dtm, const QgsTilingScheme &tilingScheme, int resolution )
   : mDtm( dtm )
@@ -139,6 +141,11 @@ QgsDemHeightMapGenerator::QgsDemHeightMapGenerator( QgsRasterLayer *dtm, const Q
   , mResolution( resolution )
   , mLastJobId( 0 )
 {
+  // keep sampled heightmaps around so that chunks are not re-sampled from the DEM
+  // every time the camera comes back to an area
+  QgsSettings settings;
+  const int cacheSizeMB = settings.value( QStringLiteral( "qgis/demTerrainTileCacheSizeMB" ), 64 ).toInt();
+  mHeightMapCache.setMaxCost( cacheSizeMB * 1024 * 1024 );
 }
 
 QgsDemHeightMapGenerator::~QgsDemHeightMapGenerator()
@@ -148,11 +155,14 @@ QgsDemHeightMapGenerator::~QgsDemHeightMapGenerator()
 
 #include <QElapsedTimer>
 
-static QByteArray _readDtmData( QgsRasterDataProvider *provider, const QgsRectangle &extent, int res, const QgsCoordinateReferenceSystem &destCrs )
+static QByteArray _readDtmData( QgsRasterDataProvider *provider, QMutex *providerMutex, const QgsRectangle &extent, int res, const QgsCoordinateReferenceSystem &destCrs )
 {
   QElapsedTimer t;
   t.start();
 
+  // the provider is shared by all read jobs and is not thread safe
+  QMutexLocker locker( providerMutex );
+
   // TODO: use feedback object? (but GDAL currently does not support cancellation anyway)
   QgsRasterInterface *input = provider;
   std::unique_ptr<QgsRasterProjector> projector;
@@ -190,7 +200,20 @@ static QByteArray _readDtmData( QgsRasterDataProvider *provider, const QgsRectan
 
 int QgsDemHeightMapGenerator::render( int x, int y, int z )
 {
-  Q_ASSERT( mJobs.isEmpty() );  // should be always just one active job...
+  const int jobId = ++mLastJobId;
+
+  // if this tile was sampled before, emit the cached heightmap without touching the DEM
+  const QString cacheKey = QStringLiteral( "%1/%2/%3" ).arg( x ).arg( y ).arg( z );
+  if ( QByteArray *cachedHeightMap = mHeightMapCache.object( cacheKey ) )
+  {
+    // deferred so that the caller gets the job id before the signal arrives
+    const QByteArray heightMap = *cachedHeightMap;
+    QTimer::singleShot( 0, this, [this, jobId, heightMap]
+    {
+      emit heightMapReady( jobId, heightMap );
+    } );
+    return jobId;
+  }
 
   // extend the rect by half-pixel on each side? to get the values in "corners"
   QgsRectangle extent = mTilingScheme.tileToExtent( x, y, z );
@@ -201,11 +224,12 @@ int QgsDemHeightMapGenerator::render( int x, int y, int z )
   extent = extent.intersect( fullExtent );
 
   JobData jd;
-  jd.jobId = ++mLastJobId;
+  jd.jobId = jobId;
+  jd.cacheKey = cacheKey;
   jd.extent = extent;
   jd.timer.start();
   // make a clone of the data provider so it is safe to use in worker thread
-  jd.future = QtConcurrent::run( _readDtmData, mClonedProvider, extent, mResolution, mTilingScheme.crs() );
+  jd.future = QtConcurrent::run( _readDtmData, mClonedProvider, &mProviderMutex, extent, mResolution, mTilingScheme.crs() );
 
   QFutureWatcher<QByteArray> *fw = new QFutureWatcher<QByteArray>( nullptr );
   fw->setFuture( jd.future );
@@ -272,6 +296,10 @@ void QgsDemHeightMapGenerator::onFutureFinished()
   fw->deleteLater();
 
   QByteArray data = jobData.future.result();
+
+  if ( !data.isEmpty() )
+    mHeightMapCache.insert( jobData.cacheKey, new QByteArray( data ), data.size() );
+
   emit heightMapReady( jobData.jobId, data );
 }
 
@@ -28,8 +28,10 @@
 //
 
 #include <QtConcurrent/QtConcurrentRun>
+#include <QCache>
 #include <QFutureWatcher>
 #include <QElapsedTimer>
+#include <QMutex>
 
 #include "qgsrectangle.h"
 #include "qgsterraintileloader_p.h"
@@ -108,6 +110,9 @@ class QgsDemHeightMapGenerator : public QObject
     //! cloned provider to be used in worker thread
     QgsRasterDataProvider *mClonedProvider = nullptr;
 
+    //! guards access to the cloned provider - multiple read jobs may be in flight
+    QMutex mProviderMutex;
+
     QgsTilingScheme mTilingScheme;
 
     int mResolution;
@@ -117,6 +122,7 @@ class QgsDemHeightMapGenerator : public QObject
     struct JobData
     {
       int jobId;
+      QString cacheKey;
       QgsRectangle extent;
       QFuture<QByteArray> future;
       QFutureWatcher<QByteArray> *fw;
@@ -125,6 +131,9 @@ class QgsDemHeightMapGenerator : public QObject
 
     QHash<QFutureWatcher<QByteArray>*, JobData> mJobs;
 
+    //! cache of already sampled heightmaps keyed by "x/y/z" tile coordinates
+    QCache<QString, QByteArray> mHeightMapCache;
+
     //! used for height queries
     QByteArray mDtmCoarseData;
 };
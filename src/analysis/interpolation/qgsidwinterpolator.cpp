@@ -17,6 +17,7 @@
 
 #include "qgsidwinterpolator.h"
 #include "qgis.h"
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -24,11 +25,28 @@ QgsIDWInterpolator::QgsIDWInterpolator( const QList<LayerData> &layerData )
   : QgsInterpolator( layerData )
 {}
 
+void QgsIDWInterpolator::setMaxNeighbourCount( int count )
+{
+  mMaxNeighbourCount = count;
+  mNeighbourIndex.clear();
+  mNeighbourIndexIsBuilt = false;
+}
+
 int QgsIDWInterpolator::interpolatePoint( double x, double y, double &result, QgsFeedback *feedback )
 {
   if ( !mDataIsCached )
   {
     cacheBaseData( feedback );
+    mNeighbourIndexIsBuilt = false;
+  }
+
+  if ( mMaxNeighbourCount > 0 && mCachedBaseData.size() > mMaxNeighbourCount )
+  {
+    if ( !mNeighbourIndexIsBuilt )
+    {
+      buildNeighbourIndex();
+    }
+    return interpolateFromNeighbours( x, y, result );
   }
 
   double sumCounter = 0;
@@ -55,3 +73,129 @@ int QgsIDWInterpolator::interpolatePoint( double x, double y, double &result, Qg
   result = sumCounter / sumDenominator;
   return 0;
 }
+
+void QgsIDWInterpolator::buildNeighbourIndex()
+{
+  mNeighbourIndex.clear();
+  mNeighbourIndexIsBuilt = true;
+  if ( mCachedBaseData.isEmpty() )
+  {
+    return;
+  }
+
+  //bounding box of the data points
+  mNeighbourIndexXMin = std::numeric_limits<double>::max();
+  mNeighbourIndexYMin = std::numeric_limits<double>::max();
+  double xMax = -std::numeric_limits<double>::max();
+  double yMax = -std::numeric_limits<double>::max();
+  for ( const QgsInterpolatorVertexData &vertex : qgis::as_const( mCachedBaseData ) )
+  {
+    mNeighbourIndexXMin = std::min( mNeighbourIndexXMin, vertex.x );
+    mNeighbourIndexYMin = std::min( mNeighbourIndexYMin, vertex.y );
+    xMax = std::max( xMax, vertex.x );
+    yMax = std::max( yMax, vertex.y );
+  }
+
+  //choose the cell size so that cells hold one point each on average
+  mNeighbourIndexDimension = std::max( 1, static_cast< int >( std::ceil( std::sqrt( static_cast< double >( mCachedBaseData.size() ) ) ) ) );
+  mNeighbourIndexCellSize = std::max( xMax - mNeighbourIndexXMin, yMax - mNeighbourIndexYMin ) / mNeighbourIndexDimension;
+  if ( mNeighbourIndexCellSize <= 0 )
+  {
+    //all points coincide
+    mNeighbourIndexCellSize = 1.0;
+  }
+
+  for ( int i = 0; i < mCachedBaseData.size(); ++i )
+  {
+    const QgsInterpolatorVertexData &vertex = mCachedBaseData.at( i );
+    const int col = std::min( mNeighbourIndexDimension - 1, static_cast< int >( ( vertex.x - mNeighbourIndexXMin ) / mNeighbourIndexCellSize ) );
+    const int row = std::min( mNeighbourIndexDimension - 1, static_cast< int >( ( vertex.y - mNeighbourIndexYMin ) / mNeighbourIndexCellSize ) );
+    mNeighbourIndex[ static_cast< qint64 >( row ) * mNeighbourIndexDimension + col ].append( i );
+  }
+}
+
+int QgsIDWInterpolator::interpolateFromNeighbours( double x, double y, double &result ) const
+{
+  if ( mNeighbourIndex.isEmpty() )
+  {
+    return 1;
+  }
+
+  const int centerCol = std::max( 0, std::min( mNeighbourIndexDimension - 1, static_cast< int >( ( x - mNeighbourIndexXMin ) / mNeighbourIndexCellSize ) ) );
+  const int centerRow = std::max( 0, std::min( mNeighbourIndexDimension - 1, static_cast< int >( ( y - mNeighbourIndexYMin ) / mNeighbourIndexCellSize ) ) );
+
+  // search the grid in expanding rings of cells around the query point. Once enough
+  // candidates have been collected, the search only stops when the furthest of the
+  // nearest candidates is closer than any point in an unsearched cell can be, so the
+  // result is the exact nearest neighbour set
+  QVector< QPair< double, int > > candidates; //squared distance/point index pairs
+  for ( int ring = 0; ring <= mNeighbourIndexDimension; ++ring )
+  {
+    for ( int row = centerRow - ring; row <= centerRow + ring; ++row )
+    {
+      if ( row < 0 || row >= mNeighbourIndexDimension )
+        continue;
+      for ( int col = centerCol - ring; col <= centerCol + ring; ++col )
+      {
+        if ( col < 0 || col >= mNeighbourIndexDimension )
+          continue;
+        if ( std::max( std::abs( row - centerRow ), std::abs( col - centerCol ) ) != ring )
+          continue; //interior cell, already searched in a previous ring
+
+        const auto cellIt = mNeighbourIndex.constFind( static_cast< qint64 >( row ) * mNeighbourIndexDimension + col );
+        if ( cellIt == mNeighbourIndex.constEnd() )
+          continue;
+
+        for ( const int pointIdx : cellIt.value() )
+        {
+          const QgsInterpolatorVertexData &vertex = mCachedBaseData.at( pointIdx );
+          const double dist2 = ( vertex.x - x ) * ( vertex.x - x ) + ( vertex.y - y ) * ( vertex.y - y );
+          candidates.append( qMakePair( dist2, pointIdx ) );
+        }
+      }
+    }
+
+    if ( candidates.size() >= mMaxNeighbourCount )
+    {
+      std::nth_element( candidates.begin(), candidates.begin() + mMaxNeighbourCount - 1, candidates.end() );
+      //any point in an unsearched cell is at least ring * cellSize away from the query point
+      const double unsearchedDist = ring * mNeighbourIndexCellSize;
+      if ( candidates.at( mMaxNeighbourCount - 1 ).first <= unsearchedDist * unsearchedDist )
+      {
+        break;
+      }
+    }
+  }
+
+  if ( candidates.isEmpty() )
+  {
+    return 1;
+  }
+
+  const int neighbourCount = std::min( mMaxNeighbourCount, candidates.size() );
+  std::nth_element( candidates.begin(), candidates.begin() + neighbourCount - 1, candidates.end() );
+
+  double sumCounter = 0;
+  double sumDenominator = 0;
+  for ( int i = 0; i < neighbourCount; ++i )
+  {
+    const double distance = std::sqrt( candidates.at( i ).first );
+    const double z = mCachedBaseData.at( candidates.at( i ).second ).z;
+    if ( qgsDoubleNear( distance, 0.0 ) )
+    {
+      result = z;
+      return 0;
+    }
+    double currentWeight = 1 / ( std::pow( distance, mDistanceCoefficient ) );
+    sumCounter += ( currentWeight * z );
+    sumDenominator += currentWeight;
+  }
+
+  if ( sumDenominator == 0.0 )
+  {
+    return 1;
+  }
+
+  result = sumCounter / sumDenominator;
+  return 0;
+}
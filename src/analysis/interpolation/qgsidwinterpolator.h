@@ -21,6 +21,9 @@
 #include "qgsinterpolator.h"
 #include "qgis_analysis.h"
 
+#include <QHash>
+#include <QVector>
+
 /**
  * \ingroup analysis
  * \class QgsIDWInterpolator
@@ -60,11 +63,54 @@ class ANALYSIS_EXPORT QgsIDWInterpolator: public QgsInterpolator
     */
     double distanceCoefficient() const { return mDistanceCoefficient; }
 
+    /**
+     * Sets the maximum number of nearest data points considered when interpolating
+     * a value. A \a count of 0 or less (the default) means that all data points
+     * contribute to every interpolated value.
+     *
+     * Limiting the neighbour count makes interpolation of dense datasets orders of
+     * magnitude faster, as a spatial index is used to fetch only the nearest points
+     * instead of scanning the whole dataset for every output cell. Note that the
+     * interpolated values will differ slightly from the unlimited case, as distant
+     * points no longer contribute their (tiny) weights.
+     *
+     * \see maxNeighbourCount()
+     * \since QGIS 3.8
+    */
+    void setMaxNeighbourCount( int count );
+
+    /**
+     * Returns the maximum number of nearest data points considered when interpolating
+     * a value, or 0 or less if all data points are considered.
+     *
+     * \see setMaxNeighbourCount()
+     * \since QGIS 3.8
+    */
+    int maxNeighbourCount() const { return mMaxNeighbourCount; }
+
   private:
 
     QgsIDWInterpolator() = delete;
 
+    /**
+     * Builds the uniform grid index over the cached data points which is used to
+     * answer nearest neighbour queries when a maximum neighbour count is set.
+     */
+    void buildNeighbourIndex();
+
+    //! Interpolates a value from the nearest maxNeighbourCount() points only, using the grid index
+    int interpolateFromNeighbours( double x, double y, double &result ) const;
+
     double mDistanceCoefficient = 2.0;
+
+    int mMaxNeighbourCount = 0;
+    bool mNeighbourIndexIsBuilt = false;
+    double mNeighbourIndexXMin = 0;
+    double mNeighbourIndexYMin = 0;
+    double mNeighbourIndexCellSize = 0;
+    int mNeighbourIndexDimension = 0;
+    //! Maps a grid cell key (row * dimension + column) to the indices of the cached points falling inside the cell
+    QHash< qint64, QVector< int > > mNeighbourIndex;
 };
 
 #endif
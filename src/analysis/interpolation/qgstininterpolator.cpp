@@ -32,6 +32,38 @@
 #include "qgscurvepolygon.h"
 #include "qgsmultisurface.h"
 
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+///@cond PRIVATE
+
+//! Maps discrete coordinates to their distance along a Hilbert curve of the given order
+static quint64 hilbertIndex( quint32 x, quint32 y, int order )
+{
+  quint64 d = 0;
+  for ( quint32 s = 1u << ( order - 1 ); s > 0; s >>= 1 )
+  {
+    const quint32 rx = ( x & s ) > 0 ? 1 : 0;
+    const quint32 ry = ( y & s ) > 0 ? 1 : 0;
+    d += static_cast< quint64 >( s ) * s * ( ( 3 * rx ) ^ ry );
+
+    //rotate the quadrant
+    if ( ry == 0 )
+    {
+      if ( rx == 1 )
+      {
+        x = s - 1 - x;
+        y = s - 1 - y;
+      }
+      std::swap( x, y );
+    }
+  }
+  return d;
+}
+
+///@endcond
+
 QgsTinInterpolator::QgsTinInterpolator( const QList<LayerData> &inputData, TinInterpolation interpolation, QgsFeedback *feedback )
   : QgsInterpolator( inputData )
   , mIsInitialized( false )
@@ -141,6 +173,8 @@ void QgsTinInterpolator::initialize()
     }
   }
 
+  insertBufferedPoints();
+
   if ( mInterpolation == CloughTocher )
   {
     CloughTocherInterpolator *ctInterpolator = new CloughTocherInterpolator();
@@ -325,7 +359,9 @@ int QgsTinInterpolator::insertData( const QgsFeature &f, QgsInterpolator::ValueS
 
 int QgsTinInterpolator::addPointsFromGeometry( const QgsGeometry &g, ValueSource source, double attributeValue )
 {
-  // loop through all vertices and add to triangulation
+  // loop through all vertices and buffer them for insertion. Points are not inserted
+  // directly here -- inserting them in spatially sorted order later (see
+  // insertBufferedPoints()) keeps the point location walks in the triangulation short
   for ( auto point = g.vertices_begin(); point != g.vertices_end(); ++point )
   {
     QgsPoint p = *point;
@@ -344,10 +380,54 @@ int QgsTinInterpolator::addPointsFromGeometry( const QgsGeometry &g, ValueSource
         z = p.m();
         break;
     }
-    if ( mTriangulation->addPoint( QgsPoint( p.x(), p.y(), z ) ) == -100 )
-    {
-      return -1;
-    }
+    mPointBuffer.append( QgsPoint( p.x(), p.y(), z ) );
   }
   return 0;
 }
+
+void QgsTinInterpolator::insertBufferedPoints()
+{
+  if ( mPointBuffer.isEmpty() )
+    return;
+
+  //bounding box of the buffered points, needed to normalize coordinates for the curve
+  double xMin = std::numeric_limits<double>::max();
+  double yMin = std::numeric_limits<double>::max();
+  double xMax = -std::numeric_limits<double>::max();
+  double yMax = -std::numeric_limits<double>::max();
+  for ( const QgsPoint &p : qgis::as_const( mPointBuffer ) )
+  {
+    xMin = std::min( xMin, p.x() );
+    yMin = std::min( yMin, p.y() );
+    xMax = std::max( xMax, p.x() );
+    yMax = std::max( yMax, p.y() );
+  }
+
+  constexpr int order = 16; //2^16 curve cells per axis, fine enough for any realistic point count
+  const double xScale = xMax > xMin ? ( ( 1 << order ) - 1 ) / ( xMax - xMin ) : 0;
+  const double yScale = yMax > yMin ? ( ( 1 << order ) - 1 ) / ( yMax - yMin ) : 0;
+
+  QVector< QPair< quint64, int > > sortKeys;
+  sortKeys.reserve( mPointBuffer.size() );
+  for ( int i = 0; i < mPointBuffer.size(); ++i )
+  {
+    const quint32 x = static_cast< quint32 >( ( mPointBuffer.at( i ).x() - xMin ) * xScale );
+    const quint32 y = static_cast< quint32 >( ( mPointBuffer.at( i ).y() - yMin ) * yScale );
+    sortKeys.append( qMakePair( hilbertIndex( x, y, order ), i ) );
+  }
+  std::sort( sortKeys.begin(), sortKeys.end() );
+
+  int nInsertedPoints = 0;
+  for ( const QPair< quint64, int > &key : qgis::as_const( sortKeys ) )
+  {
+    if ( mFeedback && mFeedback->isCanceled() )
+      break;
+
+    mTriangulation->addPoint( mPointBuffer.at( key.second ) );
+    ++nInsertedPoints;
+    if ( mFeedback && nInsertedPoints % 1000 == 0 )
+      mFeedback->setProgress( 100.0 * static_cast< double >( nInsertedPoints ) / sortKeys.size() );
+  }
+
+  mPointBuffer.clear();
+}
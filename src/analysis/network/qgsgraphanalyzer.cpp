@@ -14,6 +14,8 @@
 ***************************************************************************/
 
 #include <limits>
+#include <queue>
+#include <utility>
 
 #include <QMap>
 #include <QVector>
@@ -50,26 +52,39 @@ void QgsGraphAnalyzer::dijkstra( const QgsGraph *source, int startPointIdx, int
     resultTree->insert( resultTree->begin(), source->vertexCount(), -1 );
   }
 
-  // QMultiMap< cost, vertexIdx > not_begin
-  // I use it and don't create any struct or class
-  QMultiMap< double, int > not_begin;
-  QMultiMap< double, int >::iterator it;
+  // edge costs are stored as QVariants inside the graph -- convert them to doubles
+  // once upfront, instead of repeating the conversion on every relaxation
+  QVector< double > edgeCost( source->edgeCount() );
+  for ( int i = 0; i < source->edgeCount(); ++i )
+  {
+    edgeCost[ i ] = source->edge( i ).cost( criterionNum ).toDouble();
+  }
+
+  // binary heap of < cost, vertexIdx > pairs. An outdated entry is left in the
+  // heap whenever a vertex cost is improved, and skipped when popped.
+  typedef std::pair< double, int > CostedVertex;
+  std::priority_queue< CostedVertex, std::vector< CostedVertex >, std::greater< CostedVertex > > notBegin;
 
-  not_begin.insert( 0.0, startPointIdx );
+  notBegin.push( CostedVertex( 0.0, startPointIdx ) );
 
-  while ( !not_begin.empty() )
+  while ( !notBegin.empty() )
   {
-    it = not_begin.begin();
-    double curCost = it.key();
-    int curVertex = it.value();
-    not_begin.erase( it );
+    const double curCost = notBegin.top().first;
+    const int curVertex = notBegin.top().second;
+    notBegin.pop();
+
+    if ( curCost > ( *result )[ curVertex ] )
+    {
+      // a cheaper path to this vertex was already settled -- stale heap entry
+      continue;
+    }
 
     // edge index list
     const QgsGraphEdgeIds &outgoingEdges = source->vertex( curVertex ).outgoingEdges();
     for ( int edgeId : outgoingEdges )
     {
       const QgsGraphEdge &arc = source->edge( edgeId );
-      double cost = arc.cost( criterionNum ).toDouble() + curCost;
+      double cost = edgeCost[ edgeId ] + curCost;
 
       if ( cost < ( *result )[ arc.toVertex()] )
       {
@@ -78,7 +93,7 @@ void QgsGraphAnalyzer::dijkstra( const QgsGraph *source, int startPointIdx, int
         {
           ( *resultTree )[ arc.toVertex()] = edgeId;
         }
-        not_begin.insert( cost, arc.toVertex() );
+        notBegin.push( CostedVertex( cost, arc.toVertex() ) );
       }
     }
   }
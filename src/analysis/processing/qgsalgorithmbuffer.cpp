@@ -159,7 +159,7 @@ QVariantMap QgsBufferAlgorithm::processAlgorithm( const QVariantMap &parameters,
 
   if ( dissolve )
   {
-    QgsGeometry finalGeometry = QgsGeometry::unaryUnion( bufferedGeometriesForDissolve );
+    QgsGeometry finalGeometry = QgsGeometry::unaryUnion( bufferedGeometriesForDissolve, feedback );
     finalGeometry.convertToMultiType();
     QgsFeature f;
     f.setGeometry( finalGeometry );
@@ -214,7 +214,7 @@ QVariantMap QgsDissolveAlgorithm::processAlgorithm( const QVariantMap &parameter
 {
   return processCollection( parameters, context, feedback, [ & ]( const QVector< QgsGeometry > &parts )->QgsGeometry
   {
-    QgsGeometry result( QgsGeometry::unaryUnion( parts ) );
+    QgsGeometry result( QgsGeometry::unaryUnion( parts, feedback ) );
     if ( QgsWkbTypes::geometryType( result.wkbType() ) == QgsWkbTypes::LineGeometry )
       result = result.mergeLines();
     // Geos may fail in some cases, let's try a slower but safer approach
@@ -228,7 +228,7 @@ QVariantMap QgsDissolveAlgorithm::processAlgorithm( const QVariantMap &parameter
       result = QgsGeometry();
       for ( const auto &p : parts )
       {
-        result = QgsGeometry::unaryUnion( QVector< QgsGeometry >() << result << p );
+        result = QgsGeometry::unaryUnion( QVector< QgsGeometry >() << result << p, feedback );
         if ( QgsWkbTypes::geometryType( result.wkbType() ) == QgsWkbTypes::LineGeometry )
           result = result.mergeLines();
         if ( feedback->isCanceled() )
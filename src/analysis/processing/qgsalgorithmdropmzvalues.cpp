@@ -65,6 +65,12 @@ bool QgsDropMZValuesAlgorithm::supportInPlaceEdit( const QgsMapLayer *layer ) co
   return false;
 }
 
+QgsProcessingAlgorithm::Flags QgsDropMZValuesAlgorithm::flags() const
+{
+  // processFeature() only touches the passed feature and members set in prepareAlgorithm()
+  return QgsProcessingFeatureBasedAlgorithm::flags() | FlagThreadSafeFeatureProcessing;
+}
+
 void QgsDropMZValuesAlgorithm::initParameters( const QVariantMap & )
 {
   addParameter( new QgsProcessingParameterBoolean( QStringLiteral( "DROP_M_VALUES" ), QObject::tr( "Drop M Values" ), false ) );
@@ -17,6 +17,7 @@
 
 #include "qgsalgorithmextractbylocation.h"
 #include "qgsgeometryengine.h"
+#include "qgsspatialindex.h"
 #include "qgsvectorlayer.h"
 
 ///@cond PRIVATE
@@ -80,6 +81,140 @@ void QgsLocationBasedAlgorithm::process( const QgsProcessingContext &context, Qg
     const std::function < void( const QgsFeature & ) > &handleFeatureFunction,
     bool onlyRequireTargetIds,
     QgsFeedback *feedback )
+{
+  // when the intersect side is the (known) smaller one, it is cheaper to index it once
+  // and stream the target side in a single pass, reusing the prepared geometry engines
+  // for every target feature. The indexed side is held completely in memory, so only
+  // take this path while it stays reasonably sized.
+  const long targetCount = targetSource->featureCount();
+  const long intersectCount = intersectSource->featureCount();
+  const long maxCachedIntersectFeatures = 100000;
+  if ( targetCount >= 0 && intersectCount >= 0 && intersectCount < targetCount && intersectCount <= maxCachedIntersectFeatures )
+  {
+    processByIteratingOverTargetSource( context, targetSource, intersectSource, selectedPredicates, handleFeatureFunction, onlyRequireTargetIds, feedback );
+  }
+  else
+  {
+    processByIteratingOverIntersectSource( context, targetSource, intersectSource, selectedPredicates, handleFeatureFunction, onlyRequireTargetIds, feedback );
+  }
+}
+
+void QgsLocationBasedAlgorithm::processByIteratingOverTargetSource( const QgsProcessingContext &context, QgsFeatureSource *targetSource,
+    QgsFeatureSource *intersectSource,
+    const QList< int > &selectedPredicates,
+    const std::function < void( const QgsFeature & ) > &handleFeatureFunction,
+    bool onlyRequireTargetIds,
+    QgsFeedback *feedback )
+{
+  // the predicates are still reversed, as the prepared engines sit on the intersect side
+  QList< Predicate > predicates;
+  predicates.reserve( selectedPredicates.count() );
+  for ( int i : selectedPredicates )
+  {
+    predicates << reversePredicate( static_cast< Predicate >( i ) );
+  }
+  const bool testDisjoint = predicates.contains( Disjoint );
+
+  // index the whole intersect side once, storing the geometries so no further provider
+  // requests are needed while streaming the target side
+  QgsSpatialIndex index( intersectSource->getFeatures( QgsFeatureRequest().setNoAttributes().setDestinationCrs( targetSource->sourceCrs(), context.transformContext() ) ), feedback, QgsSpatialIndex::FlagStoreFeatureGeometries );
+
+  // geometries must outlive their prepared engines
+  QHash< QgsFeatureId, QgsGeometry > intersectGeometries;
+  QHash< QgsFeatureId, QgsGeometryEngine * > engines;
+
+  QgsFeatureRequest request;
+  if ( onlyRequireTargetIds )
+    request.setNoAttributes();
+
+  double step = targetSource->featureCount() > 0 ? 100.0 / targetSource->featureCount() : 1;
+  int current = 0;
+  QgsFeature f;
+  QgsFeatureIterator fIt = targetSource->getFeatures( request );
+  while ( fIt.nextFeature( f ) )
+  {
+    if ( feedback->isCanceled() )
+      break;
+
+    if ( !f.hasGeometry() )
+    {
+      // a target feature without geometry intersects nothing
+      if ( testDisjoint )
+        handleFeatureFunction( f );
+      current += 1;
+      feedback->setProgress( current * step );
+      continue;
+    }
+
+    const QList< QgsFeatureId > candidates = index.intersects( f.geometry().boundingBox() );
+    bool isMatch = false;
+    bool isDisjoint = true;
+    for ( QgsFeatureId candidateId : candidates )
+    {
+      QgsGeometryEngine *engine = engines.value( candidateId );
+      if ( !engine )
+      {
+        const auto geomIt = intersectGeometries.insert( candidateId, index.geometry( candidateId ) );
+        engine = QgsGeometry::createGeometryEngine( geomIt.value().constGet() );
+        engine->prepareGeometry();
+        engines.insert( candidateId, engine );
+      }
+
+      for ( Predicate predicate : qgis::as_const( predicates ) )
+      {
+        switch ( predicate )
+        {
+          case Intersects:
+            isMatch = engine->intersects( f.geometry().constGet() );
+            break;
+          case Contains:
+            isMatch = engine->contains( f.geometry().constGet() );
+            break;
+          case Disjoint:
+            if ( engine->intersects( f.geometry().constGet() ) )
+              isDisjoint = false;
+            break;
+          case IsEqual:
+            isMatch = engine->isEqual( f.geometry().constGet() );
+            break;
+          case Touches:
+            isMatch = engine->touches( f.geometry().constGet() );
+            break;
+          case Overlaps:
+            isMatch = engine->overlaps( f.geometry().constGet() );
+            break;
+          case Within:
+            isMatch = engine->within( f.geometry().constGet() );
+            break;
+          case Crosses:
+            isMatch = engine->crosses( f.geometry().constGet() );
+            break;
+        }
+        if ( isMatch )
+          break;
+      }
+      if ( isMatch )
+        break;
+    }
+
+    if ( isMatch )
+      handleFeatureFunction( f );
+    else if ( testDisjoint && isDisjoint )
+      handleFeatureFunction( f );
+
+    current += 1;
+    feedback->setProgress( current * step );
+  }
+
+  qDeleteAll( engines );
+}
+
+void QgsLocationBasedAlgorithm::processByIteratingOverIntersectSource( const QgsProcessingContext &context, QgsFeatureSource *targetSource,
+    QgsFeatureSource *intersectSource,
+    const QList< int > &selectedPredicates,
+    const std::function < void( const QgsFeature & ) > &handleFeatureFunction,
+    bool onlyRequireTargetIds,
+    QgsFeedback *feedback )
 {
   // build a list of 'reversed' predicates, because in this function
   // we actually test the reverse of what the user wants (allowing us
@@ -27,6 +27,9 @@
 #include "qgsproject.h"
 
 #include <QFile>
+#include <QtConcurrentMap>
+
+#include <algorithm>
 
 #include <cpl_string.h>
 #include <gdalwarper.h>
@@ -146,17 +149,20 @@ QgsRasterCalculator::Result QgsRasterCalculator::processCalculation( QgsFeedback
       }
     }
 
-    //read / write line by line
-    QMap<QString, QgsRasterBlock * > _rasterData;
+    //read / write a chunk of rows at a time: the input is read and the result
+    //written chunk by chunk, while the per-row evaluation of the calc node
+    //tree runs in parallel on the rows of the chunk
+    const int chunkRows = qBound( 1, 250000 / std::max( 1, mNumOutputColumns ), mNumOutputRows );
     // Cast to float
-    std::vector<float> castedResult;
-    castedResult.reserve( static_cast<size_t>( mNumOutputColumns ) );
+    std::vector<float> castedResult( static_cast<size_t>( chunkRows ) * mNumOutputColumns );
     auto rowHeight = mOutputRectangle.height() / mNumOutputRows;
-    for ( size_t row = 0; row < static_cast<size_t>( mNumOutputRows ); ++row )
+    for ( int chunkStart = 0; chunkStart < mNumOutputRows; chunkStart += chunkRows )
     {
+      const int rowsInChunk = std::min( chunkRows, mNumOutputRows - chunkStart );
+
       if ( feedback )
       {
-        feedback->setProgress( 100.0 * static_cast< double >( row ) / mNumOutputRows );
+        feedback->setProgress( 100.0 * static_cast< double >( chunkStart ) / mNumOutputRows );
       }
 
       if ( feedback && feedback->isCanceled() )
@@ -164,12 +170,12 @@ QgsRasterCalculator::Result QgsRasterCalculator::processCalculation( QgsFeedback
         break;
       }
 
-      // Calculates the rect for a single row read
+      // Calculates the rect for a chunk of rows read
       QgsRectangle rect( mOutputRectangle );
-      rect.setYMaximum( rect.yMaximum() - rowHeight * row );
-      rect.setYMinimum( rect.yMaximum() - rowHeight );
+      rect.setYMaximum( rect.yMaximum() - rowHeight * chunkStart );
+      rect.setYMinimum( rect.yMaximum() - rowHeight * rowsInChunk );
 
-      // Read rows into input blocks
+      // Read chunk rows into input blocks
       for ( auto &layerRef : inputBlocks )
       {
         QgsRasterCalculatorEntry ref = uniqueRasterEntries[layerRef.first];
@@ -179,34 +185,61 @@ QgsRasterCalculator::Result QgsRasterCalculator::processCalculation( QgsFeedback
           proj.setCrs( ref.raster->crs(), mOutputCrs );
           proj.setInput( ref.raster->dataProvider() );
           proj.setPrecision( QgsRasterProjector::Exact );
-          layerRef.second.reset( proj.block( ref.bandNumber, rect, mNumOutputColumns, 1 ) );
+          layerRef.second.reset( proj.block( ref.bandNumber, rect, mNumOutputColumns, rowsInChunk ) );
         }
         else
         {
-          inputBlocks[layerRef.first].reset( ref.raster->dataProvider()->block( ref.bandNumber, rect, mNumOutputColumns, 1 ) );
+          inputBlocks[layerRef.first].reset( ref.raster->dataProvider()->block( ref.bandNumber, rect, mNumOutputColumns, rowsInChunk ) );
         }
       }
 
-      QgsRasterMatrix resultMatrix;
-      resultMatrix.setNodataValue( outputNodataValue );
-
-      _rasterData.clear();
-      for ( const auto &layerRef : inputBlocks )
+      QVector<int> chunkRowIndices;
+      chunkRowIndices.reserve( rowsInChunk );
+      for ( int i = 0; i < rowsInChunk; ++i )
       {
-        _rasterData.insert( layerRef.first, inputBlocks[layerRef.first].get() );
+        chunkRowIndices.append( i );
       }
 
-      if ( calcNode->calculate( _rasterData, resultMatrix, 0 ) )
+      auto calculateRow = [&]( int rowInChunk )
       {
-        // write scanline to the dataset
-        for ( size_t i = 0; i < static_cast<size_t>( mNumOutputColumns ); i++ )
+        // each row evaluates on its own map, as calculate() takes a non
+        // const reference
+        QMap<QString, QgsRasterBlock * > rasterData;
+        for ( const auto &layerRef : inputBlocks )
         {
-          castedResult[i] = static_cast<float>( resultMatrix.data()[i] );
+          rasterData.insert( layerRef.first, layerRef.second.get() );
         }
-        if ( GDALRasterIO( outputRasterBand, GF_Write, 0, row, mNumOutputColumns, 1, castedResult.data(), mNumOutputColumns, 1, GDT_Float32, 0, 0 ) != CE_None )
+
+        QgsRasterMatrix resultMatrix;
+        resultMatrix.setNodataValue( outputNodataValue );
+
+        float *outRow = castedResult.data() + static_cast<size_t>( rowInChunk ) * mNumOutputColumns;
+        if ( calcNode->calculate( rasterData, resultMatrix, rowInChunk ) )
         {
-          QgsDebugMsg( QStringLiteral( "RasterIO error!" ) );
+          for ( int i = 0; i < mNumOutputColumns; i++ )
+          {
+            outRow[i] = static_cast<float>( resultMatrix.data()[i] );
+          }
         }
+        else
+        {
+          std::fill( outRow, outRow + mNumOutputColumns, outputNodataValue );
+        }
+      };
+
+      if ( rowsInChunk == 1 )
+      {
+        calculateRow( 0 );
+      }
+      else
+      {
+        QtConcurrent::blockingMap( chunkRowIndices, calculateRow );
+      }
+
+      // write the chunk to the dataset
+      if ( GDALRasterIO( outputRasterBand, GF_Write, 0, chunkStart, mNumOutputColumns, rowsInChunk, castedResult.data(), mNumOutputColumns, rowsInChunk, GDT_Float32, 0, 0 ) != CE_None )
+      {
+        QgsDebugMsg( QStringLiteral( "RasterIO error!" ) );
       }
     }
 
@@ -82,7 +82,53 @@ QFuture<void> QgsGeometryChecker::execute( int *totalSteps )
     }
   }
 
-  QFuture<void> future = QtConcurrent::map( mChecks, RunCheckWrapper( this ) );
+  // build the work units: feature based checks are split into feature id partitions per
+  // compatible layer, so that a run dominated by one expensive check (or one huge layer)
+  // still spreads over all worker threads instead of being serialized per check. Layer
+  // wide checks (e.g. gaps) are not partitionable and stay one unit each. All units share
+  // the same feature pools, which cache fetched features behind their own lock.
+  mWorkUnits.clear();
+  const int maxPartitions = std::max( 1, QThread::idealThreadCount() );
+  const int minPartitionSize = 1000;
+  for ( QgsGeometryCheck *check : qgis::as_const( mChecks ) )
+  {
+    if ( check->checkType() > QgsGeometryCheck::FeatureCheck )
+    {
+      mWorkUnits.append( CheckWorkUnit{ check, QMap<QString, QgsFeatureIds>() } );
+      continue;
+    }
+
+    for ( auto it = mFeaturePools.constBegin(); it != mFeaturePools.constEnd(); ++it )
+    {
+      // mirror the geometry type filter the check iteration itself applies
+      if ( !check->compatibleGeometryTypes().contains( it.value()->geometryType() ) )
+        continue;
+
+      const QgsFeatureIds allIds = it.value()->allFeatureIds();
+      const int partitionCount = std::min( maxPartitions, std::max( 1, allIds.size() / minPartitionSize ) );
+      if ( partitionCount <= 1 )
+      {
+        QMap<QString, QgsFeatureIds> ids;
+        ids.insert( it.key(), allIds );
+        mWorkUnits.append( CheckWorkUnit{ check, ids } );
+        continue;
+      }
+
+      QVector<QgsFeatureIds> partitions( partitionCount );
+      int part = 0;
+      for ( const QgsFeatureId fid : allIds )
+        partitions[ part++ % partitionCount ].insert( fid );
+
+      for ( const QgsFeatureIds &partition : qgis::as_const( partitions ) )
+      {
+        QMap<QString, QgsFeatureIds> ids;
+        ids.insert( it.key(), partition );
+        mWorkUnits.append( CheckWorkUnit{ check, ids } );
+      }
+    }
+  }
+
+  QFuture<void> future = QtConcurrent::map( mWorkUnits, RunCheckWrapper( this ) );
 
   QFutureWatcher<void> *watcher = new QFutureWatcher<void>();
   watcher->setFuture( future );
@@ -280,12 +326,12 @@ bool QgsGeometryChecker::fixError( QgsGeometryCheckError *error, int method, boo
   return true;
 }
 
-void QgsGeometryChecker::runCheck( const QMap<QString, QgsFeaturePool *> &featurePools, const QgsGeometryCheck *check )
+void QgsGeometryChecker::runCheck( const QMap<QString, QgsFeaturePool *> &featurePools, const CheckWorkUnit &unit )
 {
   // Run checks
   QList<QgsGeometryCheckError *> errors;
   QStringList messages;
-  check->collectErrors( featurePools, errors, messages, &mFeedback );
+  unit.check->collectErrors( featurePools, errors, messages, &mFeedback, QgsGeometryCheck::LayerFeatureIds( unit.ids ) );
   mErrorListMutex.lock();
   mCheckErrors.append( errors );
   mMessages.append( messages );
@@ -301,7 +347,7 @@ QgsGeometryChecker::RunCheckWrapper::RunCheckWrapper( QgsGeometryChecker *instan
 {
 }
 
-void QgsGeometryChecker::RunCheckWrapper::operator()( const QgsGeometryCheck *check )
+void QgsGeometryChecker::RunCheckWrapper::operator()( const CheckWorkUnit &unit )
 {
-  mInstance->runCheck( mInstance->mFeaturePools, check );
+  mInstance->runCheck( mInstance->mFeaturePools, unit );
 }
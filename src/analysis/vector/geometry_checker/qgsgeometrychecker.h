@@ -21,8 +21,10 @@
 
 #include <QFuture>
 #include <QList>
+#include <QMap>
 #include <QMutex>
 #include <QStringList>
+#include <QVector>
 
 #include "qgis_analysis.h"
 #include "qgsfeedback.h"
@@ -64,16 +66,29 @@ class ANALYSIS_EXPORT QgsGeometryChecker : public QObject
     void progressValue( int value );
 
   private:
+
+    /**
+     * A unit of work for the parallel check run: one check, restricted to a subset of
+     * feature ids. An empty id map means the check runs over all features.
+     */
+    struct CheckWorkUnit
+    {
+      const QgsGeometryCheck *check = nullptr;
+      QMap<QString, QgsFeatureIds> ids;
+    };
+
     class RunCheckWrapper
     {
       public:
         explicit RunCheckWrapper( QgsGeometryChecker *instance );
-        void operator()( const QgsGeometryCheck *check );
+        void operator()( const CheckWorkUnit &unit );
       private:
         QgsGeometryChecker *mInstance = nullptr;
     };
 
     QList<QgsGeometryCheck *> mChecks;
+    //! Work units of the currently executing run, must outlive the returned future
+    QVector<CheckWorkUnit> mWorkUnits;
     QgsGeometryCheckContext *mContext = nullptr;
     QList<QgsGeometryCheckError *> mCheckErrors;
     QStringList mMessages;
@@ -82,7 +97,7 @@ class ANALYSIS_EXPORT QgsGeometryChecker : public QObject
     QgsFeedback mFeedback;
     QMap<QString, QgsFeaturePool *> mFeaturePools;
 
-    void runCheck( const QMap<QString, QgsFeaturePool *> &featurePools, const QgsGeometryCheck *check );
+    void runCheck( const QMap<QString, QgsFeaturePool *> &featurePools, const CheckWorkUnit &unit );
 
   private slots:
     void emitProgressValue();
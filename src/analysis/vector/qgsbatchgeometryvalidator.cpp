@@ -0,0 +1,139 @@
+/***************************************************************************
+    qgsbatchgeometryvalidator.cpp
+    -----------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgsbatchgeometryvalidator.h"
+
+#include "qgsfeedback.h"
+#include "qgsgeometryvalidator.h"
+#include "qgsvectorlayer.h"
+
+#include <QtConcurrentMap>
+
+QgsBatchGeometryValidator::QgsBatchGeometryValidator( QgsVectorLayer *layer, QgsGeometry::ValidationMethod method, QObject *parent )
+  : QObject( parent )
+  , mLayer( layer )
+  , mMethod( method )
+{
+  connect( mLayer, &QgsVectorLayer::geometryChanged, this, &QgsBatchGeometryValidator::onGeometryChanged );
+  connect( mLayer, &QgsVectorLayer::featureDeleted, this, &QgsBatchGeometryValidator::onFeatureDeleted );
+  connect( mLayer, &QgsVectorLayer::dataChanged, this, &QgsBatchGeometryValidator::invalidateAll );
+}
+
+QgsFeatureIds QgsBatchGeometryValidator::validate( QgsFeedback *feedback )
+{
+  // gather the features whose validity is not already cached -- attributes
+  // are not needed for geometry checks
+  QList<QgsFeature> toValidate;
+  QgsFeatureIterator it = mLayer->getFeatures( QgsFeatureRequest().setSubsetOfAttributes( QgsAttributeList() ) );
+  QgsFeature f;
+  while ( it.nextFeature( f ) )
+  {
+    if ( feedback && feedback->isCanceled() )
+      return invalidFeatures();
+
+    QMutexLocker locker( &mResultMutex );
+    if ( !mValidity.contains( f.id() ) )
+      toValidate << f;
+  }
+
+  QtConcurrent::blockingMap( toValidate, ProcessFeatureWrapper( this, feedback ) );
+
+  return invalidFeatures();
+}
+
+bool QgsBatchGeometryValidator::isValidityKnown( QgsFeatureId fid ) const
+{
+  QMutexLocker locker( &mResultMutex );
+  return mValidity.contains( fid );
+}
+
+bool QgsBatchGeometryValidator::isValid( QgsFeatureId fid ) const
+{
+  QMutexLocker locker( &mResultMutex );
+  return mValidity.value( fid, true );
+}
+
+QgsFeatureIds QgsBatchGeometryValidator::invalidFeatures() const
+{
+  QMutexLocker locker( &mResultMutex );
+  QgsFeatureIds ids;
+  for ( QHash<QgsFeatureId, bool>::const_iterator it = mValidity.constBegin(); it != mValidity.constEnd(); ++it )
+  {
+    if ( !it.value() )
+      ids.insert( it.key() );
+  }
+  return ids;
+}
+
+QVector<QgsGeometry::Error> QgsBatchGeometryValidator::featureErrors( QgsFeatureId fid ) const
+{
+  QMutexLocker locker( &mResultMutex );
+  return mErrors.value( fid );
+}
+
+void QgsBatchGeometryValidator::invalidateAll()
+{
+  QMutexLocker locker( &mResultMutex );
+  mValidity.clear();
+  mErrors.clear();
+}
+
+void QgsBatchGeometryValidator::onGeometryChanged( QgsFeatureId fid, const QgsGeometry &geometry )
+{
+  Q_UNUSED( geometry );
+  QMutexLocker locker( &mResultMutex );
+  mValidity.remove( fid );
+  mErrors.remove( fid );
+}
+
+void QgsBatchGeometryValidator::onFeatureDeleted( QgsFeatureId fid )
+{
+  QMutexLocker locker( &mResultMutex );
+  mValidity.remove( fid );
+  mErrors.remove( fid );
+}
+
+void QgsBatchGeometryValidator::recordResult( QgsFeatureId fid, const QVector<QgsGeometry::Error> &errors )
+{
+  {
+    QMutexLocker locker( &mResultMutex );
+    mValidity.insert( fid, errors.isEmpty() );
+    if ( !errors.isEmpty() )
+      mErrors.insert( fid, errors );
+    else
+      mErrors.remove( fid );
+  }
+  // emitted from the worker thread, receivers in other threads get it queued
+  emit featureValidated( fid, errors );
+}
+
+void QgsBatchGeometryValidator::ProcessFeatureWrapper::operator()( const QgsFeature &feature )
+{
+  if ( feedback && feedback->isCanceled() )
+    return;
+
+  QVector<QgsGeometry::Error> errors;
+  if ( feature.hasGeometry() )
+  {
+    // run the validator synchronously on this worker thread
+    QVector<QgsGeometry::Error> featureErrors;
+    QgsGeometryValidator validator( feature.geometry(), &featureErrors, instance->mMethod );
+    QObject::connect( &validator, &QgsGeometryValidator::errorFound, &validator, &QgsGeometryValidator::addError );
+    validator.run();
+    errors = featureErrors;
+  }
+
+  instance->recordResult( feature.id(), errors );
+}
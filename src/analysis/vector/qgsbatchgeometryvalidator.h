@@ -0,0 +1,135 @@
+/***************************************************************************
+    qgsbatchgeometryvalidator.h
+    ---------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef QGSBATCHGEOMETRYVALIDATOR_H
+#define QGSBATCHGEOMETRYVALIDATOR_H
+
+#define SIP_NO_FILE
+
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+
+#include "qgis_analysis.h"
+#include "qgsfeature.h"
+#include "qgsfeatureid.h"
+#include "qgsgeometry.h"
+
+class QgsFeedback;
+class QgsVectorLayer;
+
+/**
+ * \class QgsBatchGeometryValidator
+ * \ingroup analysis
+ * Validates all geometries of a vector layer concurrently and caches the
+ * per-feature validity between runs.
+ *
+ * Features are distributed over the global thread pool and validated in
+ * parallel -- geometry validity checks (self intersections, ring checks,
+ * duplicate nodes) are independent per feature, so no coordination between
+ * the workers is needed. Results are streamed incrementally through
+ * featureValidated() while the batch is still running, so the first errors
+ * can be shown immediately.
+ *
+ * The validity of each checked feature is kept in a per-layer cache which is
+ * invalidated selectively when the layer is edited, so a re-run after fixing
+ * a handful of features only validates those again.
+ *
+ * \note not available in Python bindings
+ * \since QGIS 3.8
+ */
+class ANALYSIS_EXPORT QgsBatchGeometryValidator : public QObject
+{
+    Q_OBJECT
+
+  public:
+
+    /**
+     * Constructor for QgsBatchGeometryValidator. The validator keeps a
+     * reference to \a layer (which must outlive it) to invalidate cached
+     * results when the layer is edited, and validates using \a method.
+     */
+    explicit QgsBatchGeometryValidator( QgsVectorLayer *layer, QgsGeometry::ValidationMethod method = QgsGeometry::ValidatorQgisInternal, QObject *parent = nullptr );
+
+    /**
+     * Validates all features of the layer whose validity is not already
+     * cached, running the checks concurrently on the global thread pool.
+     * This method blocks until the batch is finished or \a feedback is
+     * canceled, but featureValidated() is emitted while it runs.
+     *
+     * Returns the ids of all features currently known to be invalid.
+     */
+    QgsFeatureIds validate( QgsFeedback *feedback = nullptr );
+
+    //! Returns TRUE if the validity of the feature \a fid has been determined and is still current
+    bool isValidityKnown( QgsFeatureId fid ) const;
+
+    /**
+     * Returns TRUE if the feature \a fid was found valid. Only meaningful
+     * when isValidityKnown() returns TRUE for the feature.
+     */
+    bool isValid( QgsFeatureId fid ) const;
+
+    //! Returns the ids of all features currently known to be invalid
+    QgsFeatureIds invalidFeatures() const;
+
+    //! Returns the validation errors found for the feature \a fid, if any
+    QVector<QgsGeometry::Error> featureErrors( QgsFeatureId fid ) const;
+
+    //! Drops all cached results, so that the next validate() run checks every feature again
+    void invalidateAll();
+
+  signals:
+
+    /**
+     * Emitted as soon as a feature has been validated, while the batch is
+     * still running. \a errors is empty if the geometry is valid.
+     */
+    void featureValidated( QgsFeatureId fid, const QVector<QgsGeometry::Error> &errors );
+
+  private slots:
+
+    void onGeometryChanged( QgsFeatureId fid, const QgsGeometry &geometry );
+    void onFeatureDeleted( QgsFeatureId fid );
+
+  private:
+
+    //! \note used by the concurrent workers in validate()
+    void recordResult( QgsFeatureId fid, const QVector<QgsGeometry::Error> &errors );
+
+    struct ProcessFeatureWrapper
+    {
+      QgsBatchGeometryValidator *instance = nullptr;
+      QgsFeedback *feedback = nullptr;
+      explicit ProcessFeatureWrapper( QgsBatchGeometryValidator *_instance, QgsFeedback *_feedback )
+        : instance( _instance )
+        , feedback( _feedback )
+      {}
+      void operator()( const QgsFeature &feature );
+    };
+
+    QgsVectorLayer *mLayer = nullptr;
+    QgsGeometry::ValidationMethod mMethod = QgsGeometry::ValidatorQgisInternal;
+
+    mutable QMutex mResultMutex;
+    //! Validity of each checked feature, entries are removed when the feature is edited
+    QHash<QgsFeatureId, bool> mValidity;
+    //! Errors of the features found invalid
+    QHash<QgsFeatureId, QVector<QgsGeometry::Error> > mErrors;
+
+    friend struct ProcessFeatureWrapper;
+};
+
+#endif // QGSBATCHGEOMETRYVALIDATOR_H
@@ -20,10 +20,15 @@
 #include "qgsfeatureiterator.h"
 #include "qgsfeedback.h"
 #include "qgsgeometry.h"
+#include "qgsgeometryengine.h"
+#include "qgspoint.h"
+#include "qgsspatialindex.h"
 #include "qgsvectordataprovider.h"
 #include "qgsvectorlayer.h"
 #include "processing/qgsrasteranalysisutils.h"
+#include "qgsrasterblock.h"
 #include "qgsrasterdataprovider.h"
+#include "qgsrasteriterator.h"
 #include "qgsrasterlayer.h"
 #include "qgslogger.h"
 #include "qgsproject.h"
@@ -207,12 +212,9 @@ int QgsZonalStatistics::calculateStatistics( QgsFeedback *feedback )
   //progress dialog
   long featureCount = vectorProvider->featureCount();
 
-  //iterate over each polygon
   QgsFeatureRequest request;
   request.setNoAttributes();
   request.setDestinationCrs( mRasterCrs, QgsProject::instance()->transformContext() );
-  QgsFeatureIterator fi = vectorProvider->getFeatures( request );
-  QgsFeature f;
 
   bool statsStoreValues = ( mStatistics & QgsZonalStatistics::Median ) ||
                           ( mStatistics & QgsZonalStatistics::StDev ) ||
@@ -220,53 +222,49 @@ int QgsZonalStatistics::calculateStatistics( QgsFeedback *feedback )
   bool statsStoreValueCount = ( mStatistics & QgsZonalStatistics::Minority ) ||
                               ( mStatistics & QgsZonalStatistics::Majority );
 
-  FeatureStats featureStats( statsStoreValues, statsStoreValueCount );
-  int featureCounter = 0;
-
-  QgsChangedAttributesMap changeMap;
-  while ( fi.nextFeature( f ) )
+  // estimate the raster access cost of both engines: the polygon-driven engine
+  // reads one raster window per feature, so the windows of nearby zones are read
+  // repeatedly, while the block-driven engine streams the combined bounds of all
+  // zones exactly once. This pass only looks at bounding boxes and is cheap
+  // compared to the raster reads it decides about.
+  double polygonDrivenCells = 0;
+  QgsRectangle zonesBBox;
+  zonesBBox.setMinimal();
   {
-    if ( feedback && feedback->isCanceled() )
+    QgsFeature f;
+    QgsFeatureIterator fi = vectorProvider->getFeatures( request );
+    while ( fi.nextFeature( f ) )
     {
-      break;
-    }
+      if ( feedback && feedback->isCanceled() )
+        break;
 
-    if ( feedback )
-    {
-      feedback->setProgress( 100.0 * static_cast< double >( featureCounter ) / featureCount );
-    }
+      if ( !f.hasGeometry() )
+        continue;
 
-    if ( !f.hasGeometry() )
-    {
-      ++featureCounter;
-      continue;
-    }
-    QgsGeometry featureGeometry = f.geometry();
+      QgsRectangle featureRect = f.geometry().boundingBox().intersect( rasterBBox );
+      if ( featureRect.isEmpty() )
+        continue;
 
-    QgsRectangle featureRect = featureGeometry.boundingBox().intersect( rasterBBox );
-    if ( featureRect.isEmpty() )
-    {
-      ++featureCounter;
-      continue;
+      int nCellsX, nCellsY;
+      QgsRectangle rasterBlockExtent;
+      QgsRasterAnalysisUtils::cellInfoForBBox( rasterBBox, featureRect, mCellSizeX, mCellSizeY, nCellsX, nCellsY, nCellsXProvider, nCellsYProvider, rasterBlockExtent );
+      polygonDrivenCells += static_cast< double >( nCellsX ) * nCellsY;
+      zonesBBox.combineExtentWith( featureRect );
     }
+  }
 
-    int nCellsX, nCellsY;
-    QgsRectangle rasterBlockExtent;
-    QgsRasterAnalysisUtils::cellInfoForBBox( rasterBBox, featureRect, mCellSizeX, mCellSizeY, nCellsX, nCellsY, nCellsXProvider, nCellsYProvider, rasterBlockExtent );
-
-    featureStats.reset();
-    QgsRasterAnalysisUtils::statisticsFromMiddlePointTest( mRasterInterface, mRasterBand, featureGeometry, nCellsX, nCellsY, mCellSizeX, mCellSizeY,
-    rasterBlockExtent, [ &featureStats ]( double value ) { featureStats.addValue( value ); } );
-
-    if ( featureStats.count <= 1 )
-    {
-      //the cell resolution is probably larger than the polygon area. We switch to precise pixel - polygon intersection in this case
-      featureStats.reset();
-      QgsRasterAnalysisUtils::statisticsFromPreciseIntersection( mRasterInterface, mRasterBand, featureGeometry, nCellsX, nCellsY, mCellSizeX, mCellSizeY,
-      rasterBlockExtent, [ &featureStats ]( double value, double weight ) { featureStats.addValue( value, weight ); } );
-    }
+  int nZoneCellsX = 0, nZoneCellsY = 0;
+  QgsRectangle zonesBlockExtent;
+  if ( !zonesBBox.isEmpty() )
+  {
+    QgsRasterAnalysisUtils::cellInfoForBBox( rasterBBox, zonesBBox, mCellSizeX, mCellSizeY, nZoneCellsX, nZoneCellsY, nCellsXProvider, nCellsYProvider, zonesBlockExtent );
+  }
+  const double blockDrivenCells = static_cast< double >( nZoneCellsX ) * nZoneCellsY;
+  const bool blockDriven = blockDrivenCells > 0 && polygonDrivenCells > blockDrivenCells;
 
-    //write the statistics value to the vector data provider
+  //builds the attribute map for a zone from its accumulated statistics
+  const auto statsToAttributeMap = [ & ]( FeatureStats & featureStats ) -> QgsAttributeMap
+  {
     QgsAttributeMap changeAttributeMap;
     if ( mStatistics & QgsZonalStatistics::Count )
       changeAttributeMap.insert( countIndex, QVariant( featureStats.count ) );
@@ -334,9 +332,181 @@ int QgsZonalStatistics::calculateStatistics( QgsFeedback *feedback )
       if ( mStatistics & QgsZonalStatistics::Variety )
         changeAttributeMap.insert( varietyIndex, QVariant( featureStats.valueCount.count() ) );
     }
+    return changeAttributeMap;
+  };
+
+  QgsChangedAttributesMap changeMap;
+  if ( blockDriven )
+  {
+    //zone windows overlap enough that streaming the raster once is cheaper than
+    //reading a window per polygon, so iterate blocks and test each pixel against
+    //the zones intersecting the block
+    struct ZoneInfo
+    {
+      QgsFeatureId fid = FID_NULL;
+      QgsGeometry geometry;
+      QgsRectangle bounds;
+      std::unique_ptr< QgsGeometryEngine > engine;
+      FeatureStats stats;
+    };
+
+    std::vector< ZoneInfo > zones;
+    QgsSpatialIndex zoneIndex;
+
+    QgsFeature f;
+    QgsFeatureIterator fi = vectorProvider->getFeatures( request );
+    while ( fi.nextFeature( f ) )
+    {
+      if ( feedback && feedback->isCanceled() )
+        break;
+
+      if ( !f.hasGeometry() )
+        continue;
+
+      QgsRectangle featureRect = f.geometry().boundingBox().intersect( rasterBBox );
+      if ( featureRect.isEmpty() )
+        continue;
+
+      ZoneInfo zone;
+      zone.fid = f.id();
+      zone.geometry = f.geometry();
+      zone.bounds = featureRect;
+      zone.engine.reset( QgsGeometry::createGeometryEngine( zone.geometry.constGet() ) );
+      if ( !zone.engine )
+        continue;
+
+      zone.engine->prepareGeometry();
+      zone.stats = FeatureStats( statsStoreValues, statsStoreValueCount );
+      zoneIndex.addFeature( static_cast< QgsFeatureId >( zones.size() ), featureRect );
+      zones.push_back( std::move( zone ) );
+    }
+
+    QgsRasterIterator iter( mRasterInterface );
+    iter.startRasterRead( mRasterBand, nZoneCellsX, nZoneCellsY, zonesBlockExtent );
+
+    std::unique_ptr< QgsRasterBlock > block;
+    int iterLeft = 0;
+    int iterTop = 0;
+    int iterCols = 0;
+    int iterRows = 0;
+    QgsRectangle blockExtent;
+    bool isNoData = false;
+    double processedCells = 0;
+    while ( !( feedback && feedback->isCanceled() ) &&
+            iter.readNextRasterPart( mRasterBand, iterCols, iterRows, block, iterLeft, iterTop, &blockExtent ) )
+    {
+      if ( feedback )
+      {
+        feedback->setProgress( 100.0 * processedCells / blockDrivenCells );
+      }
+      processedCells += static_cast< double >( iterCols ) * iterRows;
+
+      const QList< QgsFeatureId > candidates = zoneIndex.intersects( blockExtent );
+      if ( candidates.isEmpty() )
+        continue;
+
+      double cellCenterY = blockExtent.yMaximum() - 0.5 * mCellSizeY;
+      for ( int row = 0; row < iterRows; ++row )
+      {
+        double cellCenterX = blockExtent.xMinimum() + 0.5 * mCellSizeX;
+        for ( int col = 0; col < iterCols; ++col )
+        {
+          const double pixelValue = block->valueAndNoData( row, col, isNoData );
+          if ( QgsRasterAnalysisUtils::validPixel( pixelValue ) && !isNoData )
+          {
+            QgsPoint cellCenter( cellCenterX, cellCenterY );
+            for ( QgsFeatureId candidate : candidates )
+            {
+              ZoneInfo &zone = zones[ static_cast< size_t >( candidate ) ];
+              if ( cellCenterX < zone.bounds.xMinimum() || cellCenterX > zone.bounds.xMaximum()
+                   || cellCenterY < zone.bounds.yMinimum() || cellCenterY > zone.bounds.yMaximum() )
+                continue;
+
+              if ( zone.engine->contains( &cellCenter ) )
+                zone.stats.addValue( pixelValue );
+            }
+          }
+          cellCenterX += mCellSizeX;
+        }
+        cellCenterY -= mCellSizeY;
+      }
+    }
+
+    for ( ZoneInfo &zone : zones )
+    {
+      if ( feedback && feedback->isCanceled() )
+        break;
+
+      if ( zone.stats.count <= 1 )
+      {
+        //the cell resolution is probably larger than the polygon area. We switch to precise pixel - polygon intersection in this case
+        int nCellsX, nCellsY;
+        QgsRectangle rasterBlockExtent;
+        QgsRasterAnalysisUtils::cellInfoForBBox( rasterBBox, zone.bounds, mCellSizeX, mCellSizeY, nCellsX, nCellsY, nCellsXProvider, nCellsYProvider, rasterBlockExtent );
+
+        zone.stats.reset();
+        QgsRasterAnalysisUtils::statisticsFromPreciseIntersection( mRasterInterface, mRasterBand, zone.geometry, nCellsX, nCellsY, mCellSizeX, mCellSizeY,
+        rasterBlockExtent, [ &zone ]( double value, double weight ) { zone.stats.addValue( value, weight ); } );
+      }
+
+      changeMap.insert( zone.fid, statsToAttributeMap( zone.stats ) );
+    }
+  }
+  else
+  {
+    //iterate over each polygon
+    QgsFeatureIterator fi = vectorProvider->getFeatures( request );
+    QgsFeature f;
+
+    FeatureStats featureStats( statsStoreValues, statsStoreValueCount );
+    int featureCounter = 0;
+
+    while ( fi.nextFeature( f ) )
+    {
+      if ( feedback && feedback->isCanceled() )
+      {
+        break;
+      }
 
-    changeMap.insert( f.id(), changeAttributeMap );
-    ++featureCounter;
+      if ( feedback )
+      {
+        feedback->setProgress( 100.0 * static_cast< double >( featureCounter ) / featureCount );
+      }
+
+      if ( !f.hasGeometry() )
+      {
+        ++featureCounter;
+        continue;
+      }
+      QgsGeometry featureGeometry = f.geometry();
+
+      QgsRectangle featureRect = featureGeometry.boundingBox().intersect( rasterBBox );
+      if ( featureRect.isEmpty() )
+      {
+        ++featureCounter;
+        continue;
+      }
+
+      int nCellsX, nCellsY;
+      QgsRectangle rasterBlockExtent;
+      QgsRasterAnalysisUtils::cellInfoForBBox( rasterBBox, featureRect, mCellSizeX, mCellSizeY, nCellsX, nCellsY, nCellsXProvider, nCellsYProvider, rasterBlockExtent );
+
+      featureStats.reset();
+      QgsRasterAnalysisUtils::statisticsFromMiddlePointTest( mRasterInterface, mRasterBand, featureGeometry, nCellsX, nCellsY, mCellSizeX, mCellSizeY,
+      rasterBlockExtent, [ &featureStats ]( double value ) { featureStats.addValue( value ); } );
+
+      if ( featureStats.count <= 1 )
+      {
+        //the cell resolution is probably larger than the polygon area. We switch to precise pixel - polygon intersection in this case
+        featureStats.reset();
+        QgsRasterAnalysisUtils::statisticsFromPreciseIntersection( mRasterInterface, mRasterBand, featureGeometry, nCellsX, nCellsY, mCellSizeX, mCellSizeY,
+        rasterBlockExtent, [ &featureStats ]( double value, double weight ) { featureStats.addValue( value, weight ); } );
+      }
+
+      //write the statistics value to the vector data provider
+      changeMap.insert( f.id(), statsToAttributeMap( featureStats ) );
+      ++featureCounter;
+    }
   }
 
   vectorProvider->changeAttributeValues( changeMap );
@@ -276,6 +276,12 @@ void QgsFieldCalculator::accept()
     if ( newField )
       emptyAttribute = QVariant( field.type() );
 
+    // accumulate calculated values and apply them in one bulk update with a
+    // single undo entry -- joined fields must go through the per-feature path
+    bool useBulkUpdate = !updatingGeom && mVectorLayer->fields().fieldOrigin( mAttributeId ) != QgsFields::OriginJoin;
+    QgsChangedAttributesMap newAttributeValues;
+    QgsChangedAttributesMap oldAttributeValues;
+
     QgsFeatureRequest req = QgsFeatureRequest().setFlags( useGeometry ? QgsFeatureRequest::NoFlags : QgsFeatureRequest::NoGeometry );
     QSet< QString > referencedColumns = exp.referencedColumns();
     referencedColumns.insert( field.name() ); // need existing column value to store old attribute when changing field values
@@ -315,7 +321,15 @@ void QgsFieldCalculator::accept()
       else
       {
         ( void )field.convertCompatible( value );
-        mVectorLayer->changeAttributeValue( feature.id(), mAttributeId, value, newField ? emptyAttribute : feature.attributes().value( mAttributeId ) );
+        if ( useBulkUpdate )
+        {
+          newAttributeValues[feature.id()].insert( mAttributeId, value );
+          oldAttributeValues[feature.id()].insert( mAttributeId, newField ? emptyAttribute : feature.attributes().value( mAttributeId ) );
+        }
+        else
+        {
+          mVectorLayer->changeAttributeValue( feature.id(), mAttributeId, value, newField ? emptyAttribute : feature.attributes().value( mAttributeId ) );
+        }
       }
 
       rownum++;
@@ -330,6 +344,9 @@ void QgsFieldCalculator::accept()
       return;
     }
 
+    if ( !newAttributeValues.isEmpty() )
+      mVectorLayer->changeAttributeValues( newAttributeValues, oldAttributeValues );
+
     mVectorLayer->endEditCommand();
   }
   QDialog::accept();
@@ -136,8 +136,8 @@ void QgsLabelingWidget::apply()
 {
   writeSettingsToLayer();
   QgisApp::instance()->markDirty();
-  // trigger refresh
-  mLayer->triggerRepaint();
+  // trigger a refresh of the labeling stage only -- the rendered layer images are unaffected
+  mLayer->triggerLabelsRepaint();
 }
 
 void QgsLabelingWidget::labelModeChanged( int index )
@@ -23,6 +23,7 @@ email                : jpalmer at linz dot govt dot nz
 #include "qgsvectorlayer.h"
 #include "qgsfeature.h"
 #include "qgsgeometry.h"
+#include "qgsgeometryengine.h"
 #include "qgsrenderer.h"
 #include "qgsrubberband.h"
 #include "qgsexception.h"
@@ -248,6 +249,11 @@ QgsFeatureIds QgsMapToolSelectUtils::getMatchingFeatures( QgsMapCanvas *canvas,
 
   QgsFeatureIterator fit = vlayer->getFeatures( request );
 
+  // prepare the selection geometry once -- testing candidate features against
+  // a prepared geometry is dramatically faster than re-preparing it per feature
+  std::unique_ptr< QgsGeometryEngine > selectGeomEngine( QgsGeometry::createGeometryEngine( selectGeomTrans.constGet() ) );
+  selectGeomEngine->prepareGeometry();
+
   QgsFeature f;
   QgsFeatureId closestFeatureId = 0;
   bool foundSingleFeature = false;
@@ -262,12 +268,12 @@ QgsFeatureIds QgsMapToolSelectUtils::getMatchingFeatures( QgsMapCanvas *canvas,
     QgsGeometry g = f.geometry();
     if ( doContains )
     {
-      if ( !selectGeomTrans.contains( g ) )
+      if ( !selectGeomEngine->contains( g.constGet() ) )
         continue;
     }
     else
     {
-      if ( !selectGeomTrans.intersects( g ) )
+      if ( !selectGeomEngine->intersects( g.constGet() ) )
         continue;
     }
     if ( singleSelect )
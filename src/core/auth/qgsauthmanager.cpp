@@ -489,6 +489,16 @@ const QString QgsAuthManager::disabledMessage() const
   return tr( "Authentication system is DISABLED:\n%1" ).arg( mAuthDisabledMessage );
 }
 
+void QgsAuthManager::clearMasterPassword()
+{
+  mMasterPass = QString();
+
+  // the expanded config cache holds credentials decrypted with the master
+  // password, so it must not outlive the password session
+  QWriteLocker cacheLocker( &mLoadedConfigCacheLock );
+  mLoadedConfigCache.clear();
+}
+
 bool QgsAuthManager::setMasterPassword( bool verify )
 {
   QMutexLocker locker( mMutex );
@@ -1204,6 +1214,20 @@ bool QgsAuthManager::updateAuthenticationConfig( const QgsAuthMethodConfig &conf
 
 bool QgsAuthManager::loadAuthenticationConfig( const QString &authcfg, QgsAuthMethodConfig &mconfig, bool full )
 {
+  if ( full )
+  {
+    // serve repeated full loads from the expanded config cache, so concurrent
+    // provider connections only take a shared lock instead of serializing on
+    // mMutex for an SQLite read and decryption
+    QReadLocker cacheLocker( &mLoadedConfigCacheLock );
+    const auto cacheIt = mLoadedConfigCache.constFind( authcfg );
+    if ( cacheIt != mLoadedConfigCache.constEnd() )
+    {
+      mconfig = cacheIt.value();
+      return true;
+    }
+  }
+
   QMutexLocker locker( mMutex );
   if ( isDisabled() )
     return false;
@@ -1256,6 +1280,12 @@ bool QgsAuthManager::loadAuthenticationConfig( const QString &authcfg, QgsAuthMe
         QgsDebugMsg( QStringLiteral( "Update of authcfg %1 FAILED for auth method %2" ).arg( authcfg, authMethodKey ) );
       }
 
+      if ( full )
+      {
+        QWriteLocker cacheLocker( &mLoadedConfigCacheLock );
+        mLoadedConfigCache.insert( authcfg, mconfig );
+      }
+
       QgsDebugMsg( QStringLiteral( "Load %1 config SUCCESS for authcfg: %2" ).arg( full ? "full" : "base", authcfg ) );
       return true;
     }
@@ -2882,6 +2912,11 @@ void QgsAuthManager::clearAllCachedConfigs()
   if ( isDisabled() )
     return;
 
+  {
+    QWriteLocker cacheLocker( &mLoadedConfigCacheLock );
+    mLoadedConfigCache.clear();
+  }
+
   const QStringList ids = configIds();
   for ( const auto &authcfg : ids )
   {
@@ -2894,6 +2929,11 @@ void QgsAuthManager::clearCachedConfig( const QString &authcfg )
   if ( isDisabled() )
     return;
 
+  {
+    QWriteLocker cacheLocker( &mLoadedConfigCacheLock );
+    mLoadedConfigCache.remove( authcfg );
+  }
+
   QgsAuthMethod *authmethod = configAuthMethod( authcfg );
   if ( authmethod )
   {
@@ -22,6 +22,7 @@
 #include <QObject>
 #include <QMutex>
 #include <QNetworkReply>
+#include <QReadWriteLock>
 #include <QNetworkRequest>
 #include <QSqlDatabase>
 #include <QSqlError>
@@ -142,7 +143,7 @@ class CORE_EXPORT QgsAuthManager : public QObject
      * Clear supplied master password
      * \note This will not necessarily clear authenticated connections cached in network connection managers
      */
-    void clearMasterPassword() { mMasterPass = QString(); }
+    void clearMasterPassword();
 
     /**
      * Check whether supplied password is the same as the one already set
@@ -864,6 +865,15 @@ class CORE_EXPORT QgsAuthManager : public QObject
     int mScheduledDbEraseRequestCount = 0;
     QMutex *mMutex = nullptr;
 
+    /**
+     * Cache of fully expanded (decrypted) configs keyed by authcfg id, so that
+     * repeated connections do not pay an SQLite read and decryption each. Reads
+     * take a shared lock only, allowing concurrent provider connections to
+     * resolve their credentials without serializing on mMutex.
+     */
+    QHash<QString, QgsAuthMethodConfig> mLoadedConfigCache;
+    QReadWriteLock mLoadedConfigCacheLock;
+
 #ifndef QT_NO_SSL
     // mapping of sha1 digest and cert source and cert
     // appending removes duplicates
@@ -1163,7 +1163,7 @@ void QgsDxfExport::writeEntitiesSymbolLevels( QgsVectorLayer *layer )
     return;
   }
   std::unique_ptr< QgsFeatureRenderer > renderer( layer->renderer()->clone() );
-  QHash< QgsSymbol *, QList<QgsFeature> > features;
+  QHash< QgsSymbol *, QgsFeatureIds > features;
 
   QgsRenderContext ctx = renderContext();
   ctx.expressionContext().appendScopes( QgsExpressionContextUtils::globalProjectLayerScopes( layer ) );
@@ -1193,12 +1193,14 @@ void QgsDxfExport::writeEntitiesSymbolLevels( QgsVectorLayer *layer )
       continue;
     }
 
-    QHash< QgsSymbol *, QList<QgsFeature> >::iterator it = features.find( featureSymbol );
+    QHash< QgsSymbol *, QgsFeatureIds >::iterator it = features.find( featureSymbol );
     if ( it == features.end() )
     {
-      it = features.insert( featureSymbol, QList<QgsFeature>() );
+      it = features.insert( featureSymbol, QgsFeatureIds() );
     }
-    it.value().append( fet );
+    // only the id is kept - features are fetched again level by level below,
+    // so that the whole layer is never buffered in memory
+    it.value().insert( fet.id() );
   }
 
   // find out order
@@ -1228,7 +1230,7 @@ void QgsDxfExport::writeEntitiesSymbolLevels( QgsVectorLayer *layer )
     for ( int i = 0; i < level.count(); i++ )
     {
       QgsSymbolLevelItem &item = level[i];
-      QHash< QgsSymbol *, QList<QgsFeature> >::iterator levelIt = features.find( item.symbol() );
+      QHash< QgsSymbol *, QgsFeatureIds >::iterator levelIt = features.find( item.symbol() );
       if ( levelIt == features.end() )
       {
         QgsDebugMsg( QStringLiteral( "No feature found for symbol on %1 %2.%3" ).arg( layer->id() ).arg( l ).arg( i ) );
@@ -1236,11 +1238,12 @@ void QgsDxfExport::writeEntitiesSymbolLevels( QgsVectorLayer *layer )
       }
 
       int llayer = item.layer();
-      QList<QgsFeature> &featureList = levelIt.value();
-      QList<QgsFeature>::iterator featureIt = featureList.begin();
-      for ( ; featureIt != featureList.end(); ++featureIt )
+      QgsFeatureRequest levelRequest( req );
+      levelRequest.setFilterFids( levelIt.value() );
+      QgsFeatureIterator levelFit = layer->getFeatures( levelRequest );
+      while ( levelFit.nextFeature( fet ) )
       {
-        sctx.setFeature( &*featureIt );
+        sctx.setFeature( &fet );
         addFeature( sctx, ct, layer->name(), levelIt.key()->symbolLayer( llayer ), levelIt.key() );
       }
     }
@@ -55,6 +55,9 @@
 #include "qgis.h"
 #include "qgsexpressioncontextutils.h"
 
+#include <QMutex>
+#include <QMutexLocker>
+
 
 const QString QgsExpressionFunction::helpText() const
 {
@@ -91,7 +94,23 @@ QVariant QgsExpressionFunction::run( QgsExpressionNode::NodeList *args, const Qg
     }
   }
 
-  return func( argValues, context, parent, node );
+  // functions whose result depends only on the argument values can have their results
+  // memoized on the node, so that repeated argument tuples across features skip the call
+  const bool memoize = node && !lazyEval() && isMemoizable( node );
+  if ( memoize )
+  {
+    bool found = false;
+    const QVariant cached = node->memoizedResult( argValues, found );
+    if ( found )
+      return cached;
+  }
+
+  const QVariant res = func( argValues, context, parent, node );
+
+  if ( memoize && ( !parent || !parent->hasEvalError() ) )
+    node->setMemoizedResult( argValues, res );
+
+  return res;
 }
 
 bool QgsExpressionFunction::usesGeometry( const QgsExpressionNodeFunction *node ) const
@@ -113,6 +132,12 @@ bool QgsExpressionFunction::isStatic( const QgsExpressionNodeFunction *node, Qgs
   return false;
 }
 
+bool QgsExpressionFunction::isMemoizable( const QgsExpressionNodeFunction *node ) const
+{
+  Q_UNUSED( node )
+  return false;
+}
+
 bool QgsExpressionFunction::prepare( const QgsExpressionNodeFunction *node, QgsExpression *parent, const QgsExpressionContext *context ) const
 {
   Q_UNUSED( parent )
@@ -192,6 +217,12 @@ bool QgsStaticExpressionFunction::isStatic( const QgsExpressionNodeFunction *nod
     return mIsStatic;
 }
 
+bool QgsStaticExpressionFunction::isMemoizable( const QgsExpressionNodeFunction *node ) const
+{
+  Q_UNUSED( node )
+  return mIsMemoizable;
+}
+
 bool QgsStaticExpressionFunction::prepare( const QgsExpressionNodeFunction *node, QgsExpression *parent, const QgsExpressionContext *context ) const
 {
   if ( mPrepareFunc )
@@ -211,6 +242,11 @@ void QgsStaticExpressionFunction::setIsStatic( bool isStatic )
   mIsStatic = isStatic;
 }
 
+void QgsStaticExpressionFunction::setIsMemoizable( bool memoizable )
+{
+  mIsMemoizable = memoizable;
+}
+
 void QgsStaticExpressionFunction::setPrepareFunction( const std::function<bool ( const QgsExpressionNodeFunction *, QgsExpression *, const QgsExpressionContext * )> &prepareFunc )
 {
   mPrepareFunc = prepareFunc;
@@ -495,6 +531,57 @@ static QVariant fcnMin( const QVariantList &values, const QgsExpressionContext *
   return result;
 }
 
+//
+// Process wide cache of aggregate results. The per-context cache used by the aggregate
+// functions only lives as long as the expression context, which is typically recreated
+// for every evaluation (e.g. once per feature form) -- so on its own it cannot avoid
+// rescanning the aggregated layer over and over. Aggregate results which do not depend
+// on the outer context in any way are additionally stored here, and the stored results
+// are discarded as soon as the source layer's data changes.
+//
+
+static QMutex sAggregateCacheMutex;
+static QHash< const QgsVectorLayer *, QHash< QString, QVariant > > sAggregateCache;
+static QSet< const QgsVectorLayer * > sAggregateCacheWatchedLayers;
+
+static bool getCachedAggregate( const QgsVectorLayer *layer, const QString &cacheKey, QVariant &result )
+{
+  QMutexLocker locker( &sAggregateCacheMutex );
+  const auto layerIt = sAggregateCache.constFind( layer );
+  if ( layerIt == sAggregateCache.constEnd() )
+    return false;
+  const auto it = layerIt->constFind( cacheKey );
+  if ( it == layerIt->constEnd() )
+    return false;
+  result = it.value();
+  return true;
+}
+
+static void setCachedAggregate( QgsVectorLayer *layer, const QString &cacheKey, const QVariant &result )
+{
+  QMutexLocker locker( &sAggregateCacheMutex );
+  if ( !sAggregateCacheWatchedLayers.contains( layer ) )
+  {
+    sAggregateCacheWatchedLayers.insert( layer );
+    // cached results are only valid until the layer's data changes. Using the layer
+    // as receiver ensures the connections are automatically broken when it goes away.
+    auto invalidate = [layer]
+    {
+      QMutexLocker locker( &sAggregateCacheMutex );
+      sAggregateCache.remove( layer );
+    };
+    QObject::connect( layer, &QgsVectorLayer::layerModified, layer, invalidate );
+    QObject::connect( layer, &QgsVectorLayer::dataChanged, layer, invalidate );
+    QObject::connect( layer, &QObject::destroyed, [layer]
+    {
+      QMutexLocker locker( &sAggregateCacheMutex );
+      sAggregateCache.remove( layer );
+      sAggregateCacheWatchedLayers.remove( layer );
+    } );
+  }
+  sAggregateCache[ layer ].insert( cacheKey, result );
+}
+
 static QVariant fcnAggregate( const QVariantList &values, const QgsExpressionContext *context, QgsExpression *parent, const QgsExpressionNodeFunction * )
 {
   //lazy eval, so we need to evaluate nodes now
@@ -554,6 +641,7 @@ static QVariant fcnAggregate( const QVariantList &values, const QgsExpressionCon
   if ( context )
   {
     QString cacheKey;
+    bool layerCachable = false;
     QgsExpression subExp( subExpression );
     QgsExpression filterExp( parameters.filter );
     if ( filterExp.referencedVariables().contains( QStringLiteral( "parent" ) )
@@ -567,11 +655,20 @@ static QVariant fcnAggregate( const QVariantList &values, const QgsExpressionCon
     else
     {
       cacheKey = QStringLiteral( "aggfcn:%1:%2:%3:%4" ).arg( vl->id(), QString::number( aggregate ), subExpression, parameters.filter );
+      // if neither the subexpression nor the filter reference any variables at all, the
+      // result does not depend on this particular context and can be shared process wide
+      layerCachable = subExp.referencedVariables().isEmpty() && filterExp.referencedVariables().isEmpty();
     }
 
     if ( context && context->hasCachedValue( cacheKey ) )
       return context->cachedValue( cacheKey );
 
+    if ( layerCachable && getCachedAggregate( vl, cacheKey, result ) )
+    {
+      context->setCachedValue( cacheKey, result );
+      return result;
+    }
+
     QgsExpressionContext subContext( *context );
     QgsExpressionContextScope *subScope = new QgsExpressionContextScope();
     subScope->setVariable( QStringLiteral( "parent" ), context->feature() );
@@ -579,6 +676,8 @@ static QVariant fcnAggregate( const QVariantList &values, const QgsExpressionCon
     result = vl->aggregate( aggregate, subExpression, parameters, &subContext, &ok );
 
     context->setCachedValue( cacheKey, result );
+    if ( layerCachable && ok )
+      setCachedAggregate( vl, cacheKey, result );
   }
   else
   {
@@ -678,6 +777,14 @@ static QVariant fcnAggregateRelation( const QVariantList &values, const QgsExpre
   QVariant result;
   ok = false;
 
+  // the filter is generated from the parent feature's key values, so the cache key fully
+  // captures the context as long as the subexpression itself is variable free
+  const bool layerCachable = QgsExpression( subExpression ).referencedVariables().isEmpty();
+  if ( layerCachable && getCachedAggregate( childLayer, cacheKey, result ) )
+  {
+    context->setCachedValue( cacheKey, result );
+    return result;
+  }
 
   QgsExpressionContext subContext( *context );
   result = childLayer->aggregate( aggregate, subExpression, parameters, &subContext, &ok );
@@ -691,6 +798,8 @@ static QVariant fcnAggregateRelation( const QVariantList &values, const QgsExpre
   // cache value
   if ( context )
     context->setCachedValue( cacheKey, result );
+  if ( layerCachable )
+    setCachedAggregate( childLayer, cacheKey, result );
   return result;
 }
 
@@ -765,6 +874,16 @@ static QVariant fcnAggregateGeneric( QgsAggregateCalculator::Aggregate aggregate
   QVariant result;
   bool ok = false;
 
+  // any group by value is already baked into the filter, so results with variable free
+  // expressions can be shared process wide
+  const bool layerCachable = QgsExpression( subExpression ).referencedVariables().isEmpty()
+                             && QgsExpression( parameters.filter ).referencedVariables().isEmpty();
+  if ( layerCachable && getCachedAggregate( vl, cacheKey, result ) )
+  {
+    context->setCachedValue( cacheKey, result );
+    return result;
+  }
+
   QgsExpressionContext subContext( *context );
   result = vl->aggregate( aggregate, subExpression, parameters, &subContext, &ok );
 
@@ -777,6 +896,8 @@ static QVariant fcnAggregateGeneric( QgsAggregateCalculator::Aggregate aggregate
   // cache value
   if ( context )
     context->setCachedValue( cacheKey, result );
+  if ( layerCachable )
+    setCachedAggregate( vl, cacheKey, result );
   return result;
 }
 
@@ -5530,6 +5651,25 @@ const QList<QgsExpressionFunction *> &QgsExpression::Functions()
 
     QgsExpressionContextUtils::registerContextFunctions();
 
+    // functions whose results depend only on their argument values can have repeated
+    // argument tuples served from a per-node memo instead of re-running the function
+    // for every feature -- mark the expensive ones
+    const QStringList memoizableBuiltins
+    {
+      QStringLiteral( "geom_from_wkt" ),
+      QStringLiteral( "geom_from_gml" ),
+      QStringLiteral( "get_feature" ),
+      QStringLiteral( "get_feature_by_id" ),
+    };
+    for ( QgsExpressionFunction *func : qgis::as_const( sFunctions ) )
+    {
+      if ( memoizableBuiltins.contains( func->name() ) )
+      {
+        if ( QgsStaticExpressionFunction *staticFunc = dynamic_cast< QgsStaticExpressionFunction * >( func ) )
+          staticFunc->setIsMemoizable( true );
+      }
+    }
+
     //QgsExpression has ownership of all built-in functions
     for ( QgsExpressionFunction *func : qgis::as_const( sFunctions ) )
     {
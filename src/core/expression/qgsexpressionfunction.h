@@ -243,6 +243,19 @@ class CORE_EXPORT QgsExpressionFunction
      */
     virtual bool isStatic( const QgsExpressionNodeFunction *node, QgsExpression *parent, const QgsExpressionContext *context ) const;
 
+    /**
+     * Returns TRUE if the function's result depends only on the values of its arguments,
+     * so that results for identical argument tuples can be memoized by the owning
+     * expression node across features.
+     *
+     * This must only be TRUE for functions which do not read the feature, its geometry,
+     * or any other state from the evaluation context, and which have no side effects.
+     * Returns FALSE by default.
+     *
+     * \since QGIS 3.8
+     */
+    virtual bool isMemoizable( const QgsExpressionNodeFunction *node ) const;
+
     /**
      * This will be called during the prepare step() of an expression if it is not static.
      *
@@ -475,6 +488,17 @@ class QgsStaticExpressionFunction : public QgsExpressionFunction
      */
     void setIsStatic( bool isStatic );
 
+    bool isMemoizable( const QgsExpressionNodeFunction *node ) const override;
+
+    /**
+     * Sets whether the function's results for identical argument tuples can be memoized
+     * by the owning expression node.
+     *
+     * \see QgsExpressionFunction::isMemoizable()
+     * \since QGIS 3.8
+     */
+    void setIsMemoizable( bool memoizable );
+
     /**
      * Set a function that will be called in the prepare step to determine if the function is
      * static or not.
@@ -498,6 +522,7 @@ class QgsStaticExpressionFunction : public QgsExpressionFunction
     std::function < bool( const QgsExpressionNodeFunction *node,  QgsExpression *parent, const QgsExpressionContext *context ) > mPrepareFunc;
     QSet<QString> mReferencedColumns;
     bool mIsStatic = false;
+    bool mIsMemoizable = false;
 };
 
 /**
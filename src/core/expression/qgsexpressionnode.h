@@ -198,6 +198,24 @@ class CORE_EXPORT QgsExpressionNode SIP_ABSTRACT
      */
     QVariant eval( QgsExpression *parent, const QgsExpressionContext *context );
 
+    /**
+     * Returns TRUE if the node was determined to be static during prepare(), i.e.
+     * it will always evaluate to the same precalculated value.
+     *
+     * \see cachedStaticValue()
+     * \since QGIS 3.8
+     */
+    bool hasCachedStaticValue() const { return mHasCachedValue; }
+
+    /**
+     * Returns the node's static, precalculated value. Only valid if
+     * hasCachedStaticValue() returns TRUE.
+     *
+     * \see hasCachedStaticValue()
+     * \since QGIS 3.8
+     */
+    QVariant cachedStaticValue() const { return mCachedStaticValue; }
+
     /**
      * Generate a clone of this node.
      * Ownership is transferred to the caller.
@@ -774,6 +774,18 @@ QVariant QgsExpressionNodeInOperator::evalNode( QgsExpression *parent, const Qgs
   if ( QgsExpressionUtils::isNull( v1 ) )
     return TVL_Unknown;
 
+  if ( mCachedStaticSetValid )
+  {
+    // the list consists solely of static, non-null, non-numeric values, so every
+    // comparison degenerates to a plain string comparison - replace the linear scan
+    // with a single hash lookup
+    const QString s1 = QgsExpressionUtils::getStringValue( v1, parent );
+    ENSURE_NO_EVAL_ERROR;
+    if ( mCachedStaticSet.contains( s1 ) )
+      return mNotIn ? TVL_False : TVL_True;
+    return mNotIn ? TVL_True : TVL_False;
+  }
+
   bool listHasNull = false;
 
   const QList< QgsExpressionNode * > nodeList = mList->list();
@@ -835,6 +847,35 @@ bool QgsExpressionNodeInOperator::prepareNode( QgsExpression *parent, const QgsE
   {
     res = res && n->prepare( parent, context );
   }
+
+  // when every list member is a static, non-null, non-numeric value the per-feature
+  // scan always falls back to string comparisons, which we can replace with a
+  // prepared hash set lookup. Numeric values must keep the scan, as they compare
+  // with qgsDoubleNear semantics.
+  mCachedStaticSetValid = false;
+  mCachedStaticSet.clear();
+  bool canCache = !nodeList.isEmpty();
+  for ( QgsExpressionNode *n : nodeList )
+  {
+    if ( !n->hasCachedStaticValue() )
+    {
+      canCache = false;
+      break;
+    }
+    const QVariant v = n->cachedStaticValue();
+    if ( QgsExpressionUtils::isNull( v ) || QgsExpressionUtils::isDoubleSafe( v ) )
+    {
+      canCache = false;
+      break;
+    }
+    mCachedStaticSet.insert( QgsExpressionUtils::getStringValue( v, parent ) );
+  }
+  if ( parent->hasEvalError() )
+    canCache = false;
+  mCachedStaticSetValid = canCache;
+  if ( !canCache )
+    mCachedStaticSet.clear();
+
   return res;
 }
 
@@ -929,10 +970,58 @@ QgsExpressionNode::NodeType QgsExpressionNodeFunction::nodeType() const
   return ntFunction;
 }
 
+//! Type strict comparison of memo keys - QVariant::operator== equates across types
+//! (0 == "0" == 0.0), which would let a result cached for a differently typed
+//! argument leak through, so the types must match before values are compared
+static bool _memoKeysMatch( const QVariantList &a, const QVariantList &b )
+{
+  if ( a.size() != b.size() )
+    return false;
+
+  for ( int i = 0; i < a.size(); ++i )
+  {
+    if ( a.at( i ).userType() != b.at( i ).userType() || a.at( i ) != b.at( i ) )
+      return false;
+  }
+  return true;
+}
+
+QVariant QgsExpressionNodeFunction::memoizedResult( const QVariantList &values, bool &found ) const
+{
+  found = false;
+  for ( int i = 0; i < mMemoizedResults.size(); ++i )
+  {
+    if ( _memoKeysMatch( mMemoizedResults.at( i ).first, values ) )
+    {
+      found = true;
+      // move the tuple to the front so that eviction drops the least recently used one
+      if ( i > 0 )
+        mMemoizedResults.move( i, 0 );
+      return mMemoizedResults.at( 0 ).second;
+    }
+  }
+  return QVariant();
+}
+
+void QgsExpressionNodeFunction::setMemoizedResult( const QVariantList &values, const QVariant &result ) const
+{
+  // maximum number of memoized result tuples to retain per function node
+  static const int MAX_MEMOIZED_RESULTS = 100;
+
+  if ( mMemoizedResults.size() >= MAX_MEMOIZED_RESULTS )
+    mMemoizedResults.removeLast();
+
+  mMemoizedResults.prepend( qMakePair( values, result ) );
+}
+
 bool QgsExpressionNodeFunction::prepareNode( QgsExpression *parent, const QgsExpressionContext *context )
 {
   QgsExpressionFunction *fd = QgsExpression::QgsExpression::Functions()[mFnIndex];
 
+  // memoized results must not outlive a prepared state -- layer edits or context
+  // changes between preparations may change the results of layer reading functions
+  mMemoizedResults.clear();
+
   bool res = fd->prepare( this, parent, context );
   if ( mArgs && !fd->lazyEval() )
   {
@@ -307,6 +307,10 @@ class CORE_EXPORT QgsExpressionNodeInOperator : public QgsExpressionNode
     QgsExpressionNode *mNode = nullptr;
     QgsExpressionNodeInOperator::NodeList *mList = nullptr;
     bool mNotIn;
+
+    //! TRUE when mCachedStaticSet holds all list values, allowing a hash lookup instead of a per-feature scan
+    bool mCachedStaticSetValid = false;
+    QSet<QString> mCachedStaticSet;
 };
 
 /**
@@ -352,9 +356,32 @@ class CORE_EXPORT QgsExpressionNodeFunction : public QgsExpressionNode
     //! Tests whether the provided argument list is valid for the matching function
     static bool validateParams( int fnIndex, QgsExpressionNode::NodeList *args, QString &error );
 
+    /**
+     * Returns the memoized function result for the given argument \a values, setting
+     * \a found to TRUE if a result was memoized for the tuple. Only used for functions
+     * for which QgsExpressionFunction::isMemoizable() returns TRUE.
+     *
+     * \note Not available in Python bindings.
+     * \since QGIS 3.8
+     */
+    QVariant memoizedResult( const QVariantList &values, bool &found ) const SIP_SKIP;
+
+    /**
+     * Memoizes the \a result of evaluating the function for the given argument
+     * \a values. The number of retained results is bounded, with the least recently
+     * used tuples evicted first, and the cache is discarded when the node is prepared.
+     *
+     * \note Not available in Python bindings.
+     * \since QGIS 3.8
+     */
+    void setMemoizedResult( const QVariantList &values, const QVariant &result ) const SIP_SKIP;
+
   private:
     int mFnIndex;
     NodeList *mArgs = nullptr;
+
+    //! Memoized results for functions whose value depends only on their arguments
+    mutable QList< QPair< QVariantList, QVariant > > mMemoizedResults;
 };
 
 /**
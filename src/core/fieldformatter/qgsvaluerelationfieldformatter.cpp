@@ -23,6 +23,46 @@
 #include "qgsexpressioncontextutils.h"
 
 #include <QSettings>
+#include <QMutex>
+#include <QMutexLocker>
+
+///@cond PRIVATE
+
+// Value relation lists whose filter does not depend on the currently edited
+// feature are shared here between all formatters and widget wrappers which
+// reference the same configuration, so that reopening a feature form does not
+// re-scan the source layer. Entries are dropped as soon as the source layer
+// reports any change. Guarded by a mutex since field formatters may also be
+// invoked from expression evaluation on non-GUI threads.
+static QMutex sCacheMutex;
+static QMap<QString, QgsValueRelationFieldFormatter::ValueRelationCache> sCachedLists;
+static QSet<QString> sMonitoredLayerIds;
+
+static QString valueRelationCacheKey( const QString &layerId, const QVariantMap &config )
+{
+  return QStringLiteral( "%1|%2|%3|%4|%5" ).arg(
+           layerId,
+           config.value( QStringLiteral( "Key" ) ).toString(),
+           config.value( QStringLiteral( "Value" ) ).toString(),
+           config.value( QStringLiteral( "FilterExpression" ) ).toString(),
+           config.value( QStringLiteral( "OrderByValue" ) ).toString() );
+}
+
+static void dropCachedListsForLayer( const QString &layerId )
+{
+  QMutexLocker locker( &sCacheMutex );
+  const QString keyPrefix = layerId + '|';
+  QMap<QString, QgsValueRelationFieldFormatter::ValueRelationCache>::iterator it = sCachedLists.begin();
+  while ( it != sCachedLists.end() )
+  {
+    if ( it.key().startsWith( keyPrefix ) )
+      it = sCachedLists.erase( it );
+    else
+      ++it;
+  }
+}
+
+///@endcond
 
 bool orderByKeyLessThan( const QgsValueRelationFieldFormatter::ValueRelationItem &p1, const QgsValueRelationFieldFormatter::ValueRelationItem &p2 )
 {
@@ -119,6 +159,19 @@ QgsValueRelationFieldFormatter::ValueRelationCache QgsValueRelationFieldFormatte
   if ( !layer )
     return cache;
 
+  const QString expression = config.value( QStringLiteral( "FilterExpression" ) ).toString();
+  const bool requiresFormScope = ! expression.isEmpty() && expressionRequiresFormScope( expression );
+
+  // Lists which do not depend on the currently edited feature can be shared
+  const QString cacheKey = valueRelationCacheKey( layer->id(), config );
+  if ( ! requiresFormScope )
+  {
+    QMutexLocker locker( &sCacheMutex );
+    const auto cachedIt = sCachedLists.constFind( cacheKey );
+    if ( cachedIt != sCachedLists.constEnd() )
+      return cachedIt.value();
+  }
+
   QgsFields fields = layer->fields();
   int ki = fields.indexOf( config.value( QStringLiteral( "Key" ) ).toString() );
   int vi = fields.indexOf( config.value( QStringLiteral( "Value" ) ).toString() );
@@ -128,11 +181,9 @@ QgsValueRelationFieldFormatter::ValueRelationCache QgsValueRelationFieldFormatte
   request.setFlags( QgsFeatureRequest::NoGeometry );
   request.setSubsetOfAttributes( QgsAttributeList() << ki << vi );
 
-  const QString expression = config.value( QStringLiteral( "FilterExpression" ) ).toString();
-
   // Skip the filter and build a full cache if the form scope is required and the feature
   // is not valid or the attributes required for the filter have no valid value
-  if ( ! expression.isEmpty() && ( ! expressionRequiresFormScope( expression )
+  if ( ! expression.isEmpty() && ( ! requiresFormScope
                                    || expressionIsUsable( expression, formFeature ) ) )
   {
     QgsExpressionContext context( QgsExpressionContextUtils::globalProjectLayerScopes( layer ) );
@@ -159,6 +210,27 @@ QgsValueRelationFieldFormatter::ValueRelationCache QgsValueRelationFieldFormatte
     std::sort( cache.begin(), cache.end(), orderByKeyLessThan );
   }
 
+  if ( ! requiresFormScope )
+  {
+    QMutexLocker locker( &sCacheMutex );
+    if ( ! sMonitoredLayerIds.contains( layer->id() ) )
+    {
+      sMonitoredLayerIds.insert( layer->id() );
+      const QString layerId = layer->id();
+      auto invalidate = [layerId] { dropCachedListsForLayer( layerId ); };
+      QObject::connect( layer, &QgsVectorLayer::layerModified, layer, invalidate );
+      QObject::connect( layer, &QgsVectorLayer::editingStopped, layer, invalidate );
+      QObject::connect( layer, &QgsMapLayer::dataChanged, layer, invalidate );
+      QObject::connect( layer, &QObject::destroyed, [layerId]
+      {
+        dropCachedListsForLayer( layerId );
+        QMutexLocker locker( &sCacheMutex );
+        sMonitoredLayerIds.remove( layerId );
+      } );
+    }
+    sCachedLists.insert( cacheKey, cache );
+  }
+
   return cache;
 }
 
@@ -698,24 +698,13 @@ void QgsCircularString::transform( const QgsCoordinateTransform &ct, QgsCoordina
 {
   clearCache();
 
-  double *zArray = mZ.data();
-
   bool hasZ = is3D();
   int nPoints = numPoints();
-  bool useDummyZ = !hasZ || !transformZ;
-  if ( useDummyZ )
-  {
-    zArray = new double[nPoints];
-    for ( int i = 0; i < nPoints; ++i )
-    {
-      zArray[i] = 0;
-    }
-  }
+
+  // skip z handling entirely when z values aren't present or shouldn't be transformed -
+  // this avoids allocating a dummy array of zeros for every transformed curve
+  double *zArray = ( hasZ && transformZ ) ? mZ.data() : nullptr;
   ct.transformCoords( nPoints, mX.data(), mY.data(), zArray, d );
-  if ( useDummyZ )
-  {
-    delete[] zArray;
-  }
 }
 
 void QgsCircularString::transform( const QTransform &t, double zTranslate, double zScale, double mTranslate, double mScale )
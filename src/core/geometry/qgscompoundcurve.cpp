@@ -143,6 +143,7 @@ bool QgsCompoundCurve::fromWkb( QgsConstWkbPtr &wkbPtr )
 
   int nCurves;
   wkbPtr >> nCurves;
+  mCurves.reserve( std::min( nCurves, static_cast< int >( wkbPtr.remaining() / static_cast< int >( 1 + 2 * sizeof( int ) ) ) ) );
   QgsCurve *currentCurve = nullptr;
   for ( int i = 0; i < nCurves; ++i )
   {
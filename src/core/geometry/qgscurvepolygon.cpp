@@ -164,6 +164,8 @@ bool QgsCurvePolygon::fromWkb( QgsConstWkbPtr &wkbPtr )
 
   int nRings;
   wkbPtr >> nRings;
+  if ( nRings > 1 )
+    mInteriorRings.reserve( std::min( nRings - 1, static_cast< int >( wkbPtr.remaining() / static_cast< int >( 1 + 2 * sizeof( int ) ) ) ) );
   std::unique_ptr< QgsCurve > currentCurve;
   for ( int i = 0; i < nRings; ++i )
   {
@@ -18,6 +18,8 @@ email                : morb at ozemail dot com dot au
 #include <cstdio>
 #include <cmath>
 
+#include <QtConcurrentMap>
+
 #include "qgis.h"
 #include "qgsgeometry.h"
 #include "qgsgeometryeditutils.h"
@@ -52,6 +54,14 @@ struct QgsGeometryPrivate
   QgsGeometryPrivate(): ref( 1 ) {}
   QAtomicInt ref;
   std::unique_ptr< QgsAbstractGeometry > geometry;
+
+  //! Cached bounding box of the geometry, valid only when boundingBoxValid is TRUE
+  mutable QgsRectangle boundingBox;
+  mutable bool boundingBoxValid = false;
+
+  //! Cached content hash of the geometry, valid only when contentHashValid is TRUE
+  mutable uint contentHash = 0;
+  mutable bool contentHashValid = false;
 };
 
 QgsGeometry::QgsGeometry()
@@ -101,6 +111,11 @@ QgsGeometry &QgsGeometry::operator=( QgsGeometry const &other )
 
 void QgsGeometry::detach()
 {
+  // callers detach in order to mutate the geometry, so any cached derived
+  // values are about to become stale
+  d->boundingBoxValid = false;
+  d->contentHashValid = false;
+
   if ( d->ref <= 1 )
     return;
 
@@ -119,6 +134,8 @@ void QgsGeometry::reset( std::unique_ptr<QgsAbstractGeometry> newGeometry )
     d = new QgsGeometryPrivate();
   }
   d->geometry = std::move( newGeometry );
+  d->boundingBoxValid = false;
+  d->contentHashValid = false;
 }
 
 const QgsAbstractGeometry *QgsGeometry::constGet() const
@@ -934,7 +951,12 @@ QgsRectangle QgsGeometry::boundingBox() const
 {
   if ( d->geometry )
   {
-    return d->geometry->boundingBox();
+    if ( !d->boundingBoxValid )
+    {
+      d->boundingBox = d->geometry->boundingBox();
+      d->boundingBoxValid = true;
+    }
+    return d->boundingBox;
   }
   return QgsRectangle();
 }
@@ -1094,6 +1116,16 @@ QgsGeometry QgsGeometry::orthogonalize( double tolerance, int maxIterations, dou
   return engine.orthogonalize( tolerance, maxIterations, angleThreshold );
 }
 
+QVector<QgsGeometry> QgsGeometry::orthogonalizeBatch( const QVector<QgsGeometry> &geometries, double tolerance, int maxIterations, double angleThreshold )
+{
+  QVector< QgsGeometry > result = geometries;
+  QtConcurrent::blockingMap( result, [tolerance, maxIterations, angleThreshold]( QgsGeometry & geometry )
+  {
+    geometry = geometry.orthogonalize( tolerance, maxIterations, angleThreshold );
+  } );
+  return result;
+}
+
 QgsGeometry QgsGeometry::snappedToGrid( double hSpacing, double vSpacing, double dSpacing, double mSpacing ) const
 {
   if ( !d->geometry )
@@ -1114,6 +1146,10 @@ bool QgsGeometry::removeDuplicateNodes( double epsilon, bool useZValues )
 
 bool QgsGeometry::intersects( const QgsRectangle &r ) const
 {
+  // fast case, check bounding boxes
+  if ( !boundingBoxIntersects( r ) )
+    return false;
+
   QgsGeometry g = fromRect( r );
   return intersects( g );
 }
@@ -1198,10 +1234,29 @@ bool QgsGeometry::equals( const QgsGeometry &geometry ) const
   if ( d == geometry.d )
     return true;
 
+  // fast check - differing cached content hashes prove inequality without
+  // comparing coordinates. Don't force a hash calculation here though, that
+  // would penalize one-shot comparisons.
+  if ( d->contentHashValid && geometry.d->contentHashValid && d->contentHash != geometry.d->contentHash )
+    return false;
+
   // slower check - actually test the geometries
   return *d->geometry == *geometry.d->geometry;
 }
 
+uint QgsGeometry::contentHash() const
+{
+  if ( !d->geometry )
+    return 0;
+
+  if ( !d->contentHashValid )
+  {
+    d->contentHash = qHash( d->geometry->asWkb() );
+    d->contentHashValid = true;
+  }
+  return d->contentHash;
+}
+
 bool QgsGeometry::touches( const QgsGeometry &geometry ) const
 {
   if ( !d->geometry || geometry.isNull() )
@@ -1943,6 +1998,16 @@ QgsGeometry QgsGeometry::densifyByCount( int extraNodesPerSegment ) const
   return engine.densifyByCount( extraNodesPerSegment );
 }
 
+QVector<QgsGeometry> QgsGeometry::densifyByCountBatch( const QVector<QgsGeometry> &geometries, int extraNodesPerSegment )
+{
+  QVector< QgsGeometry > result = geometries;
+  QtConcurrent::blockingMap( result, [extraNodesPerSegment]( QgsGeometry & geometry )
+  {
+    geometry = geometry.densifyByCount( extraNodesPerSegment );
+  } );
+  return result;
+}
+
 QgsGeometry QgsGeometry::densifyByDistance( double distance ) const
 {
   QgsInternalGeometryEngine engine( *this );
@@ -2529,12 +2594,12 @@ bool QgsGeometry::isGeosEqual( const QgsGeometry &g ) const
   return geos.isEqual( g.d->geometry.get(), &mLastError );
 }
 
-QgsGeometry QgsGeometry::unaryUnion( const QVector<QgsGeometry> &geometries )
+QgsGeometry QgsGeometry::unaryUnion( const QVector<QgsGeometry> &geometries, QgsFeedback *feedback )
 {
   QgsGeos geos( nullptr );
 
   QString error;
-  std::unique_ptr< QgsAbstractGeometry > geom( geos.combine( geometries, &error ) );
+  std::unique_ptr< QgsAbstractGeometry > geom( geos.combine( geometries, &error, feedback ) );
   QgsGeometry result( std::move( geom ) );
   result.mLastError = error;
   return result;
@@ -3420,6 +3485,11 @@ QDataStream &operator>>( QDataStream &in, QgsGeometry &geometry )
   return in;
 }
 
+uint qHash( const QgsGeometry &geometry, uint seed )
+{
+  return qHash( geometry.contentHash(), seed );
+}
+
 
 QString QgsGeometry::Error::what() const
 {
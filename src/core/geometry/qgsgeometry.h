@@ -37,6 +37,7 @@ email                : morb at ozemail dot com dot au
 
 
 class QgsGeometryEngine;
+class QgsFeedback;
 class QgsVectorLayer;
 class QgsMapToPixel;
 class QPainter;
@@ -184,6 +185,9 @@ class CORE_EXPORT QgsGeometry
      * This method can be slow to call, as it may trigger a detachment of the geometry
      * and a deep copy. Where possible, use constGet() instead.
      *
+     * Calling this method also invalidates any cached derived values (such as the
+     * cached boundingBox()), since the returned primitive may be freely mutated.
+     *
      * \note In QGIS 2.x this method was named geometry().
      *
      * \see constGet()
@@ -327,6 +331,23 @@ class CORE_EXPORT QgsGeometry
      */
     bool equals( const QgsGeometry &geometry ) const;
 
+    /**
+     * Returns a hash of the geometry's content, suitable for use as a cache key.
+     *
+     * The hash is computed lazily from the geometry's WKB representation and cached
+     * with the shared geometry data, so repeated calls (and calls on shared copies)
+     * are cheap. Mutating the geometry invalidates the cached value. Returns 0 for
+     * a null geometry.
+     *
+     * Together with the qHash() overload this allows QgsGeometry to be used directly
+     * as a key in hash based caches without serializing to WKB at every lookup, and
+     * lets equals() reject differing geometries without comparing coordinates when
+     * both sides already carry a hash.
+     *
+     * \since QGIS 3.8
+     */
+    uint contentHash() const;
+
     /**
      * Compares the geometry with another geometry using GEOS.
      *
@@ -868,6 +889,10 @@ class CORE_EXPORT QgsGeometry
 
     /**
      * Returns the bounding box of the geometry.
+     *
+     * The result is cached within the geometry, so repeated calls are cheap until
+     * the geometry is next modified.
+     *
      * \see orientedMinimumBoundingBox()
      */
     QgsRectangle boundingBox() const;
@@ -915,6 +940,16 @@ class CORE_EXPORT QgsGeometry
      */
     QgsGeometry orthogonalize( double tolerance = 1.0E-8, int maxIterations = 1000, double angleThreshold = 15.0 ) const;
 
+    /**
+     * Returns orthogonalized versions of all \a geometries, with the same parameters as
+     * orthogonalize(). The geometries are processed in parallel across the available
+     * cores, so this is considerably faster than calling orthogonalize() in a loop when
+     * many geometries are involved.
+     * \see orthogonalize()
+     * \since QGIS 3.8
+     */
+    static QVector< QgsGeometry > orthogonalizeBatch( const QVector< QgsGeometry > &geometries, double tolerance = 1.0E-8, int maxIterations = 1000, double angleThreshold = 15.0 );
+
     /**
      * Returns a new geometry with all points or vertices snapped to the closest point of the grid.
      *
@@ -1169,6 +1204,15 @@ class CORE_EXPORT QgsGeometry
      */
     QgsGeometry densifyByCount( int extraNodesPerSegment ) const;
 
+    /**
+     * Returns densified versions of all \a geometries, with the same parameters as
+     * densifyByCount(). The geometries are processed in parallel across the available
+     * cores.
+     * \see densifyByCount()
+     * \since QGIS 3.8
+     */
+    static QVector< QgsGeometry > densifyByCountBatch( const QVector< QgsGeometry > &geometries, int extraNodesPerSegment );
+
     /**
      * Densifies the geometry by adding regularly placed extra nodes inside each segment
      * so that the maximum distance between any two nodes does not exceed the
@@ -1886,8 +1930,12 @@ class CORE_EXPORT QgsGeometry
      * Compute the unary union on a list of \a geometries. May be faster than an iterative union on a set of geometries.
      * The returned geometry will be fully noded, i.e. a node will be created at every common intersection of the
      * input geometries. An empty geometry will be returned in the case of errors.
+     *
+     * Since QGIS 3.8 the optional \a feedback argument can be used to cancel the operation:
+     * the union is then performed in smaller cancelable chunks, and an empty geometry is
+     * returned promptly when \a feedback is canceled.
      */
-    static QgsGeometry unaryUnion( const QVector<QgsGeometry> &geometries );
+    static QgsGeometry unaryUnion( const QVector<QgsGeometry> &geometries, QgsFeedback *feedback = nullptr );
 
     /**
      * Creates a GeometryCollection geometry containing possible polygons formed from the constituent
@@ -2294,4 +2342,12 @@ CORE_EXPORT QDataStream &operator<<( QDataStream &out, const QgsGeometry &geomet
 //! Reads a geometry from stream in into geometry. QGIS version compatibility is not guaranteed.
 CORE_EXPORT QDataStream &operator>>( QDataStream &in, QgsGeometry &geometry );
 
+/**
+ * Returns a hash for a \a geometry, so that geometries can be used directly as keys
+ * in hash based containers. Based on QgsGeometry::contentHash().
+ * \note not available in Python bindings
+ * \since QGIS 3.8
+ */
+CORE_EXPORT uint qHash( const QgsGeometry &geometry, uint seed = 0 ) SIP_SKIP;
+
 #endif
@@ -315,6 +315,10 @@ bool QgsGeometryCollection::fromWkb( QgsConstWkbPtr &wkbPtr )
 
   QVector<QgsAbstractGeometry *> geometryListBackup = mGeometries;
   mGeometries.clear();
+  // each child geometry occupies at least an endian byte, a type and some payload, so
+  // clamping the declared count against the remaining buffer protects the reserve()
+  // from corrupt WKB -- the parse loop below still fails on the truncated data itself
+  mGeometries.reserve( std::min( nGeometries, static_cast< int >( wkbPtr.remaining() / static_cast< int >( 1 + 2 * sizeof( int ) ) ) ) );
   for ( int i = 0; i < nGeometries; ++i )
   {
     std::unique_ptr< QgsAbstractGeometry > geom( QgsGeometryFactory::geomFromWkb( wkbPtr ) );  // also updates wkbPtr
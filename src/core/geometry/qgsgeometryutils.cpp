@@ -25,7 +25,6 @@ email                : marco.hugentobler at sourcepole dot com
 #include <memory>
 #include <QStringList>
 #include <QVector>
-#include <QRegularExpression>
 
 QVector<QgsLineString *> QgsGeometryUtils::extractLineStrings( const QgsAbstractGeometry *geom )
 {
@@ -1030,15 +1029,43 @@ QgsPointSequence QgsGeometryUtils::pointsFromWKT( const QString &wktCoordinateLi
 {
   int dim = 2 + is3D + isMeasure;
   QgsPointSequence points;
-  const QStringList coordList = wktCoordinateList.split( ',', QString::SkipEmptyParts );
+
+  // tokenize on string references - this avoids allocating a substring per coordinate
+  // token, which dominates the cost of parsing large WKT coordinate lists
+  const QVector<QStringRef> coordList = wktCoordinateList.splitRef( ',', QString::SkipEmptyParts );
+  points.reserve( coordList.size() );
+
+  // splits a point's coordinates on (any) whitespace. QStringRef has no
+  // regexp-based split, so scan the characters directly.
+  auto splitCoordinates = []( const QStringRef & pointCoordinates ) -> QVector<QStringRef>
+  {
+    QVector<QStringRef> coordinates;
+    int start = -1;
+    const int n = pointCoordinates.size();
+    for ( int i = 0; i <= n; ++i )
+    {
+      if ( i == n || pointCoordinates.at( i ).isSpace() )
+      {
+        if ( start >= 0 )
+          coordinates.append( pointCoordinates.mid( start, i - start ) );
+        start = -1;
+      }
+      else if ( start < 0 )
+      {
+        start = i;
+      }
+    }
+    return coordinates;
+  };
 
   //first scan through for extra unexpected dimensions
   bool foundZ = false;
   bool foundM = false;
-  QRegularExpression rx( QStringLiteral( "\\s" ) );
-  for ( const QString &pointCoordinates : coordList )
+  QVector< QVector<QStringRef> > tokenizedCoordList;
+  tokenizedCoordList.reserve( coordList.size() );
+  for ( const QStringRef &pointCoordinates : coordList )
   {
-    QStringList coordinates = pointCoordinates.split( rx, QString::SkipEmptyParts );
+    const QVector<QStringRef> coordinates = splitCoordinates( pointCoordinates );
     if ( coordinates.size() == 3 && !foundZ && !foundM && !is3D && !isMeasure )
     {
       // 3 dimensional coordinates, but not specifically marked as such. We allow this
@@ -1052,11 +1079,11 @@ QgsPointSequence QgsGeometryUtils::pointsFromWKT( const QString &wktCoordinateLi
       foundZ = true;
       foundM = true;
     }
+    tokenizedCoordList.append( coordinates );
   }
 
-  for ( const QString &pointCoordinates : coordList )
+  for ( const QVector<QStringRef> &coordinates : qgis::as_const( tokenizedCoordList ) )
   {
-    QStringList coordinates = pointCoordinates.split( rx, QString::SkipEmptyParts );
     if ( coordinates.size() < dim )
       continue;
 
@@ -1113,7 +1140,11 @@ void QgsGeometryUtils::pointsToWKB( QgsWkbPtr &wkb, const QgsPointSequence &poin
 
 QString QgsGeometryUtils::pointsToWKT( const QgsPointSequence &points, int precision, bool is3D, bool isMeasure )
 {
-  QString wkt = QStringLiteral( "(" );
+  QString wkt;
+  // preallocate the result - an educated guess of the size avoids repeated
+  // reallocations while appending millions of coordinates
+  wkt.reserve( points.size() * ( 2 + is3D + isMeasure ) * ( precision + 8 ) + 2 );
+  wkt += '(';
   for ( const QgsPoint &p : points )
   {
     wkt += qgsDoubleToString( p.x(), precision );
@@ -1212,10 +1243,14 @@ QPair<QgsWkbTypes::Type, QString> QgsGeometryUtils::wktReadBlock( const QString
 {
   QgsWkbTypes::Type wkbType = QgsWkbTypes::parseType( wkt );
 
-  QRegularExpression cooRegEx( QStringLiteral( "^[^\\(]*\\((.*)\\)[^\\)]*$" ) );
-  cooRegEx.setPatternOptions( QRegularExpression::DotMatchesEverythingOption );
-  QRegularExpressionMatch match = cooRegEx.match( wkt );
-  QString contents = match.hasMatch() ? match.captured( 1 ) : QString();
+  // grab the contents enclosed by the first opening and last closing parenthesis.
+  // This is much cheaper than the regular expression previously used here, and
+  // this method is called recursively for every child block of collection types.
+  const int firstOpenParenthesis = wkt.indexOf( '(' );
+  const int lastCloseParenthesis = wkt.lastIndexOf( ')' );
+  QString contents;
+  if ( firstOpenParenthesis >= 0 && lastCloseParenthesis > firstOpenParenthesis )
+    contents = wkt.mid( firstOpenParenthesis + 1, lastCloseParenthesis - firstOpenParenthesis - 1 );
   return qMakePair( wkbType, contents );
 }
 
@@ -1237,7 +1272,7 @@ QStringList QgsGeometryUtils::wktGetChildBlocks( const QString &wkt, const QStri
           block.prepend( defaultType + ' ' );
         blocks.append( block );
       }
-      block.clear();
+      block.resize( 0 ); // unlike clear(), this keeps the allocated capacity for the next block
       continue;
     }
     if ( wkt[i] == '(' )
@@ -25,6 +25,7 @@ email                : marco.hugentobler at sourcepole dot com
 #include "qgslogger.h"
 #include "qgspolygon.h"
 #include "qgsgeometryeditutils.h"
+#include "qgsfeedback.h"
 #include <limits>
 #include <cstdio>
 
@@ -388,6 +389,11 @@ QgsAbstractGeometry *QgsGeos::combine( const QVector<QgsAbstractGeometry *> &geo
 }
 
 QgsAbstractGeometry *QgsGeos::combine( const QVector<QgsGeometry> &geomList, QString *errorMsg ) const
+{
+  return combine( geomList, errorMsg, nullptr );
+}
+
+QgsAbstractGeometry *QgsGeos::combine( const QVector<QgsGeometry> &geomList, QString *errorMsg, QgsFeedback *feedback ) const
 {
   QVector< GEOSGeometry * > geosGeometries;
   geosGeometries.reserve( geomList.size() );
@@ -396,14 +402,28 @@ QgsAbstractGeometry *QgsGeos::combine( const QVector<QgsGeometry> &geomList, QSt
     if ( g.isNull() )
       continue;
 
+    if ( feedback && feedback->isCanceled() )
+    {
+      for ( GEOSGeometry *geom : qgis::as_const( geosGeometries ) )
+        GEOSGeom_destroy_r( geosinit.ctxt, geom );
+      return nullptr;
+    }
+
     geosGeometries << asGeos( g.constGet(), mPrecision ).release();
   }
 
   geos::unique_ptr geomUnion;
   try
   {
-    geos::unique_ptr geomCollection = createGeosCollection( GEOS_GEOMETRYCOLLECTION, geosGeometries );
-    geomUnion.reset( GEOSUnaryUnion_r( geosinit.ctxt, geomCollection.get() ) );
+    if ( feedback )
+    {
+      geomUnion = unionCascadedCancelable( geosGeometries, feedback );
+    }
+    else
+    {
+      geos::unique_ptr geomCollection = createGeosCollection( GEOS_GEOMETRYCOLLECTION, geosGeometries );
+      geomUnion.reset( GEOSUnaryUnion_r( geosinit.ctxt, geomCollection.get() ) );
+    }
   }
   CATCH_GEOS_WITH_ERRMSG( nullptr )
 
@@ -411,6 +431,65 @@ QgsAbstractGeometry *QgsGeos::combine( const QVector<QgsGeometry> &geomList, QSt
   return result.release();
 }
 
+geos::unique_ptr QgsGeos::unionCascadedCancelable( QVector<GEOSGeometry *> &geomList, QgsFeedback *feedback )
+{
+  // small enough that a single chunk finishes quickly, large enough that GEOS'
+  // internal cascaded union still works efficiently within a chunk
+  const int chunkSize = 64;
+
+  QVector< GEOSGeometry * > inputs;
+  inputs.swap( geomList );
+
+  while ( inputs.size() > chunkSize )
+  {
+    QVector< GEOSGeometry * > partials;
+    partials.reserve( ( inputs.size() + chunkSize - 1 ) / chunkSize );
+    bool canceled = false;
+    for ( int i = 0; i < inputs.size(); i += chunkSize )
+    {
+      if ( feedback && feedback->isCanceled() )
+      {
+        // remaining inputs are still owned here
+        for ( int j = i; j < inputs.size(); ++j )
+          GEOSGeom_destroy_r( geosinit.ctxt, inputs.at( j ) );
+        canceled = true;
+        break;
+      }
+
+      // createGeosCollection takes ownership of the chunk members
+      geos::unique_ptr chunkCollection = createGeosCollection( GEOS_GEOMETRYCOLLECTION, inputs.mid( i, chunkSize ) );
+      geos::unique_ptr partial( GEOSUnaryUnion_r( geosinit.ctxt, chunkCollection.get() ) );
+      if ( !partial )
+      {
+        for ( int j = i + chunkSize; j < inputs.size(); ++j )
+          GEOSGeom_destroy_r( geosinit.ctxt, inputs.at( j ) );
+        canceled = true;
+        break;
+      }
+      partials << partial.release();
+    }
+
+    if ( canceled )
+    {
+      for ( GEOSGeometry *partial : qgis::as_const( partials ) )
+        GEOSGeom_destroy_r( geosinit.ctxt, partial );
+      return nullptr;
+    }
+
+    inputs = partials;
+  }
+
+  if ( feedback && feedback->isCanceled() )
+  {
+    for ( GEOSGeometry *geom : qgis::as_const( inputs ) )
+      GEOSGeom_destroy_r( geosinit.ctxt, geom );
+    return nullptr;
+  }
+
+  geos::unique_ptr collection = createGeosCollection( GEOS_GEOMETRYCOLLECTION, inputs );
+  return geos::unique_ptr( GEOSUnaryUnion_r( geosinit.ctxt, collection.get() ) );
+}
+
 QgsAbstractGeometry *QgsGeos::symDifference( const QgsAbstractGeometry *geom, QString *errorMsg ) const
 {
   return overlay( geom, OverlaySymDifference, errorMsg ).release();
@@ -32,6 +32,7 @@ class QgsLineString;
 class QgsPolygon;
 class QgsGeometry;
 class QgsGeometryCollection;
+class QgsFeedback;
 
 /**
  * Contains geos related utilities and functions.
@@ -161,6 +162,20 @@ class CORE_EXPORT QgsGeos: public QgsGeometryEngine
     QgsAbstractGeometry *combine( const QgsAbstractGeometry *geom, QString *errorMsg = nullptr ) const override;
     QgsAbstractGeometry *combine( const QVector<QgsAbstractGeometry *> &geomList, QString *errorMsg ) const override;
     QgsAbstractGeometry *combine( const QVector< QgsGeometry > &, QString *errorMsg = nullptr ) const override;
+
+    /**
+     * Calculates the combination of a list of \a geometries, testing \a feedback for
+     * cancelation between smaller cancelable work units.
+     *
+     * When \a feedback is given the union is performed as a cascaded tree of chunked
+     * unary unions, so canceling returns NULLPTR promptly instead of blocking until
+     * GEOS has finished the whole operation. A NULLPTR \a feedback behaves exactly
+     * like the two argument overload.
+     *
+     * \since QGIS 3.8
+     */
+    QgsAbstractGeometry *combine( const QVector< QgsGeometry > &geomList, QString *errorMsg, QgsFeedback *feedback ) const;
+
     QgsAbstractGeometry *symDifference( const QgsAbstractGeometry *geom, QString *errorMsg = nullptr ) const override;
     QgsAbstractGeometry *buffer( double distance, int segments, QString *errorMsg = nullptr ) const override;
     QgsAbstractGeometry *buffer( double distance, int segments, int endCapStyle, int joinStyle, double miterLimit, QString *errorMsg = nullptr ) const override;
@@ -398,6 +413,13 @@ class CORE_EXPORT QgsGeos: public QgsGeometryEngine
      */
     static geos::unique_ptr createGeosCollection( int typeId, const QVector<GEOSGeometry *> &geoms );
 
+    /**
+     * Unions \a geomList (ownership of the contained geometries is transferred) as a
+     * cascaded tree of chunked unary unions, testing \a feedback for cancelation between
+     * the chunks. Returns NULLPTR if canceled or on error.
+     */
+    static geos::unique_ptr unionCascadedCancelable( QVector<GEOSGeometry *> &geomList, QgsFeedback *feedback );
+
     static geos::unique_ptr createGeosPointXY( double x, double y, bool hasZ, double z, bool hasM, double m, int coordDims, double precision );
     static geos::unique_ptr createGeosPoint( const QgsAbstractGeometry *point, int coordDims, double precision );
     static geos::unique_ptr createGeosLinestring( const QgsAbstractGeometry *curve, double precision );
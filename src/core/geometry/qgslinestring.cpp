@@ -360,9 +360,13 @@ QByteArray QgsLineString::asWkb() const
   QgsWkbPtr wkb( wkbArray );
   wkb << static_cast<char>( QgsApplication::endian() );
   wkb << static_cast<quint32>( wkbType() );
-  QgsPointSequence pts;
-  points( pts );
-  QgsGeometryUtils::pointsToWKB( wkb, pts, is3D(), isMeasure() );
+
+  // write vertices directly from the coordinate vectors -- materialising a
+  // QgsPointSequence here shows up as a major allocation site when large
+  // layers are exported or passed to geometry engines
+  const int nPoints = numPoints();
+  wkb << static_cast<quint32>( nPoints );
+  wkb.writeVertexArray( nPoints, mX.constData(), mY.constData(), is3D() ? mZ.constData() : nullptr, isMeasure() ? mM.constData() : nullptr );
   return wkbArray;
 }
 
@@ -568,6 +572,7 @@ void QgsLineString::points( QgsPointSequence &pts ) const
 {
   pts.clear();
   int nPoints = numPoints();
+  pts.reserve( nPoints );
   for ( int i = 0; i < nPoints; ++i )
   {
     pts.push_back( pointN( i ) );
@@ -956,22 +961,12 @@ int QgsLineString::dimension() const
 
 void QgsLineString::transform( const QgsCoordinateTransform &ct, QgsCoordinateTransform::TransformDirection d, bool transformZ )
 {
-  double *zArray = nullptr;
   bool hasZ = is3D();
   int nPoints = numPoints();
 
-  // it's possible that transformCoords will throw an exception - so we need to use
-  // a smart pointer for the dummy z values in order to ensure that they always get cleaned up
-  std::unique_ptr< double[] > dummyZ;
-  if ( !hasZ || !transformZ )
-  {
-    dummyZ.reset( new double[nPoints]() );
-    zArray = dummyZ.get();
-  }
-  else
-  {
-    zArray = mZ.data();
-  }
+  // skip z handling entirely when z values aren't present or shouldn't be transformed -
+  // this avoids allocating a dummy array of zeros for every transformed line
+  double *zArray = ( hasZ && transformZ ) ? mZ.data() : nullptr;
   ct.transformCoords( nPoints, mX.data(), mY.data(), zArray, d );
   clearCache();
 }
@@ -1256,23 +1251,7 @@ void QgsLineString::importVerticesFromWkb( const QgsConstWkbPtr &wkb )
   mY.resize( nVertices );
   hasZ ? mZ.resize( nVertices ) : mZ.clear();
   hasM ? mM.resize( nVertices ) : mM.clear();
-  double *x = mX.data();
-  double *y = mY.data();
-  double *m = hasM ? mM.data() : nullptr;
-  double *z = hasZ ? mZ.data() : nullptr;
-  for ( int i = 0; i < nVertices; ++i )
-  {
-    wkb >> *x++;
-    wkb >> *y++;
-    if ( hasZ )
-    {
-      wkb >> *z++;
-    }
-    if ( hasM )
-    {
-      wkb >> *m++;
-    }
-  }
+  wkb.readVertexArray( nVertices, mX.data(), mY.data(), hasZ ? mZ.data() : nullptr, hasM ? mM.data() : nullptr );
   clearCache(); //set bounding box invalid
 }
 
@@ -87,6 +87,8 @@ bool QgsPolygon::fromWkb( QgsConstWkbPtr &wkbPtr )
 
   int nRings;
   wkbPtr >> nRings;
+  if ( nRings > 1 )
+    mInteriorRings.reserve( std::min( nRings - 1, static_cast< int >( wkbPtr.remaining() / static_cast< int >( sizeof( int ) ) ) ) );
   for ( int i = 0; i < nRings; ++i )
   {
     std::unique_ptr< QgsLineString > line( new QgsLineString() );
@@ -129,17 +131,31 @@ QByteArray QgsPolygon::asWkb() const
   wkb << static_cast<char>( QgsApplication::endian() );
   wkb << static_cast<quint32>( wkbType() );
   wkb << static_cast<quint32>( ( nullptr != mExteriorRing ) + mInteriorRings.size() );
+  auto writeRing = [&wkb]( const QgsCurve * curve )
+  {
+    // rings of a QgsPolygon are straight line strings, so their coordinate
+    // vectors can be written out directly without materialising a point sequence
+    if ( const QgsLineString *ring = qgsgeometry_cast< const QgsLineString * >( curve ) )
+    {
+      const int nPoints = ring->numPoints();
+      wkb << static_cast<quint32>( nPoints );
+      wkb.writeVertexArray( nPoints, ring->xData(), ring->yData(), ring->is3D() ? ring->zData() : nullptr, ring->isMeasure() ? ring->mData() : nullptr );
+    }
+    else
+    {
+      QgsPointSequence pts;
+      curve->points( pts );
+      QgsGeometryUtils::pointsToWKB( wkb, pts, curve->is3D(), curve->isMeasure() );
+    }
+  };
+
   if ( mExteriorRing )
   {
-    QgsPointSequence pts;
-    mExteriorRing->points( pts );
-    QgsGeometryUtils::pointsToWKB( wkb, pts, mExteriorRing->is3D(), mExteriorRing->isMeasure() );
+    writeRing( mExteriorRing.get() );
   }
   for ( const QgsCurve *curve : mInteriorRings )
   {
-    QgsPointSequence pts;
-    curve->points( pts );
-    QgsGeometryUtils::pointsToWKB( wkb, pts, curve->is3D(), curve->isMeasure() );
+    writeRing( curve );
   }
 
   return wkbArray;
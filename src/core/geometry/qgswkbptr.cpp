@@ -35,6 +35,33 @@ void QgsWkbPtr::verifyBound( int size ) const
     throw QgsWkbException( QStringLiteral( "wkb access out of bounds" ) );
 }
 
+void QgsWkbPtr::writeVertexArray( int nVertices, const double *x, const double *y, const double *z, const double *m )
+{
+  const int tupleSize = ( 2 + ( z ? 1 : 0 ) + ( m ? 1 : 0 ) ) * static_cast< int >( sizeof( double ) );
+  if ( nVertices < 0 || !mP || ( mEnd - mP ) / tupleSize < nVertices )
+    throw QgsWkbException( QStringLiteral( "wkb access out of bounds" ) );
+
+  unsigned char *dest = mP;
+  for ( int i = 0; i < nVertices; ++i )
+  {
+    memcpy( dest, x++, sizeof( double ) );
+    dest += sizeof( double );
+    memcpy( dest, y++, sizeof( double ) );
+    dest += sizeof( double );
+    if ( z )
+    {
+      memcpy( dest, z++, sizeof( double ) );
+      dest += sizeof( double );
+    }
+    if ( m )
+    {
+      memcpy( dest, m++, sizeof( double ) );
+      dest += sizeof( double );
+    }
+  }
+  mP = dest;
+}
+
 QgsConstWkbPtr::QgsConstWkbPtr( const QByteArray &wkb )
 {
   mP = reinterpret_cast< unsigned char * >( const_cast<char *>( wkb.constData() ) );
@@ -73,6 +100,60 @@ void QgsConstWkbPtr::verifyBound( int size ) const
     throw QgsWkbException( QStringLiteral( "wkb access out of bounds" ) );
 }
 
+void QgsConstWkbPtr::readVertexArray( int nVertices, double *x, double *y, double *z, double *m ) const
+{
+  const int tupleSize = ( 2 + ( z ? 1 : 0 ) + ( m ? 1 : 0 ) ) * static_cast< int >( sizeof( double ) );
+  if ( nVertices < 0 || !mP || ( mEnd - mP ) / tupleSize < nVertices )
+    throw QgsWkbException( QStringLiteral( "wkb access out of bounds" ) );
+
+  const unsigned char *src = mP;
+  if ( !mEndianSwap )
+  {
+    for ( int i = 0; i < nVertices; ++i )
+    {
+      memcpy( x++, src, sizeof( double ) );
+      src += sizeof( double );
+      memcpy( y++, src, sizeof( double ) );
+      src += sizeof( double );
+      if ( z )
+      {
+        memcpy( z++, src, sizeof( double ) );
+        src += sizeof( double );
+      }
+      if ( m )
+      {
+        memcpy( m++, src, sizeof( double ) );
+        src += sizeof( double );
+      }
+    }
+  }
+  else
+  {
+    for ( int i = 0; i < nVertices; ++i )
+    {
+      memcpy( x, src, sizeof( double ) );
+      endian_swap( *x++ );
+      src += sizeof( double );
+      memcpy( y, src, sizeof( double ) );
+      endian_swap( *y++ );
+      src += sizeof( double );
+      if ( z )
+      {
+        memcpy( z, src, sizeof( double ) );
+        endian_swap( *z++ );
+        src += sizeof( double );
+      }
+      if ( m )
+      {
+        memcpy( m, src, sizeof( double ) );
+        endian_swap( *m++ );
+        src += sizeof( double );
+      }
+    }
+  }
+  mP = const_cast< unsigned char * >( src );
+}
+
 const QgsConstWkbPtr &QgsConstWkbPtr::operator>>( QPointF &point ) const
 {
   read( point.rx() );
@@ -98,6 +98,15 @@ class CORE_EXPORT QgsWkbPtr
 
     inline void operator+=( int n ) { verifyBound( n ); mP += n; } SIP_SKIP
 
+    /**
+     * Writes \a nVertices coordinate tuples to the pointer, interleaving the component
+     * arrays in WKB order. \a z and \a m may be NULLPTR for 2D data. Performs a single
+     * bounds check for the whole array instead of one per primitive.
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    void writeVertexArray( int nVertices, const double *x, const double *y, const double *z, const double *m ) SIP_SKIP;
+
     inline operator unsigned char *() const { return mP; } SIP_SKIP
 
     /**
@@ -176,6 +185,16 @@ class CORE_EXPORT QgsConstWkbPtr
     inline void operator+=( int n ) { verifyBound( n ); mP += n; } SIP_SKIP
     inline void operator-=( int n ) { mP -= n; } SIP_SKIP
 
+    /**
+     * Reads \a nVertices interleaved coordinate tuples from the pointer into the given
+     * component arrays. \a z and \a m may be NULLPTR for 2D data. Performs a single bounds
+     * check for the whole array, and skips the per-value endianness branch when no byte
+     * swapping is needed.
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    void readVertexArray( int nVertices, double *x, double *y, double *z, double *m ) const SIP_SKIP;
+
     inline operator const unsigned char *() const { return mP; } SIP_SKIP
 
     /**
@@ -89,6 +89,33 @@ int QgsLayerTreeModel::rowCount( const QModelIndex &parent ) const
   return n->children().count();
 }
 
+bool QgsLayerTreeModel::hasChildren( const QModelIndex &parent ) const
+{
+  // show the expand indicator for layers whose legend has not been built yet
+  // without having to create the legend nodes
+  QgsLayerTreeNode *n = index2node( parent );
+  if ( n && QgsLayerTree::isLayer( n ) && mPendingLegendLayers.contains( QgsLayerTree::toLayer( n ) ) )
+    return true;
+
+  return QAbstractItemModel::hasChildren( parent );
+}
+
+bool QgsLayerTreeModel::canFetchMore( const QModelIndex &parent ) const
+{
+  QgsLayerTreeNode *n = index2node( parent );
+  if ( n && QgsLayerTree::isLayer( n ) )
+    return mPendingLegendLayers.contains( QgsLayerTree::toLayer( n ) );
+
+  return false;
+}
+
+void QgsLayerTreeModel::fetchMore( const QModelIndex &parent )
+{
+  QgsLayerTreeNode *n = index2node( parent );
+  if ( n && QgsLayerTree::isLayer( n ) )
+    ensureLegendNodesCreated( QgsLayerTree::toLayer( n ) );
+}
+
 int QgsLayerTreeModel::columnCount( const QModelIndex &parent ) const
 {
   Q_UNUSED( parent );
@@ -212,7 +239,9 @@ QVariant QgsLayerTreeModel::data( const QModelIndex &index, int role ) const
       QIcon icon;
 
       // if there's just on legend entry that should be embedded in layer - do that!
-      if ( testFlag( ShowLegend ) && legendEmbeddedInParent( nodeLayer ) )
+      // (do not materialize a lazily created legend from here - this is called while
+      // the view paints itself, where inserting rows is not safe)
+      if ( testFlag( ShowLegend ) && !mPendingLegendLayers.contains( nodeLayer ) && legendEmbeddedInParent( nodeLayer ) )
       {
         icon = legendIconEmbeddedInParent( nodeLayer );
       }
@@ -530,6 +559,11 @@ void QgsLayerTreeModel::refreshLayerLegend( QgsLayerTreeLayer *nodeLayer )
   QModelIndex idx = node2index( nodeLayer );
   emit dataChanged( idx, idx );
 
+  // if the legend was never built there is nothing to refresh - it will be
+  // created from the new state of the layer when first needed
+  if ( mPendingLegendLayers.contains( nodeLayer ) )
+    return;
+
   // update children
   int oldNodeCount = rowCount( idx );
   beginRemoveRows( idx, 0, std::max( oldNodeCount - 1, 0 ) );
@@ -864,14 +898,11 @@ void QgsLayerTreeModel::connectToLayer( QgsLayerTreeLayer *nodeLayer )
 
   if ( testFlag( ShowLegend ) )
   {
-    addLegendToLayer( nodeLayer );
-
-    // automatic collapse of legend nodes - useful if a layer has many legend nodes
-    if ( !mRootNode->customProperty( QStringLiteral( "loading" ) ).toBool() )
-    {
-      if ( mAutoCollapseLegendNodesCount != -1 && rowCount( node2index( nodeLayer ) )  >= mAutoCollapseLegendNodesCount )
-        nodeLayer->setExpanded( false );
-    }
+    // defer creation of the legend nodes until they are actually needed -
+    // i.e. until the layer node gets expanded in a view or its legend nodes
+    // are requested explicitly. With many (collapsed) layers, building all
+    // legends up front dominates the time to load a project.
+    mPendingLegendLayers.insert( nodeLayer );
   }
 
   QgsMapLayer *layer = nodeLayer->layer();
@@ -917,6 +948,7 @@ void QgsLayerTreeModel::disconnectFromLayer( QgsLayerTreeLayer *nodeLayer )
 
   if ( testFlag( ShowLegend ) )
   {
+    mPendingLegendLayers.remove( nodeLayer );
     removeLegendFromLayer( nodeLayer );
   }
 
@@ -1204,6 +1236,21 @@ void QgsLayerTreeModel::removeLegendFromLayer( QgsLayerTreeLayer *nodeLayer )
 }
 
 
+void QgsLayerTreeModel::ensureLegendNodesCreated( QgsLayerTreeLayer *nodeLayer )
+{
+  if ( !mPendingLegendLayers.remove( nodeLayer ) )
+    return;
+
+  addLegendToLayer( nodeLayer );
+
+  // automatic collapse of legend nodes - useful if a layer has many legend nodes
+  if ( !mRootNode->customProperty( QStringLiteral( "loading" ) ).toBool() )
+  {
+    if ( mAutoCollapseLegendNodesCount != -1 && rowCount( node2index( nodeLayer ) ) >= mAutoCollapseLegendNodesCount )
+      nodeLayer->setExpanded( false );
+  }
+}
+
 void QgsLayerTreeModel::addLegendToLayer( QgsLayerTreeLayer *nodeL )
 {
   if ( !nodeL || !nodeL->layer() )
@@ -1458,18 +1505,22 @@ Qt::ItemFlags QgsLayerTreeModel::legendNodeFlags( QgsLayerTreeModelLegendNode *n
 
 bool QgsLayerTreeModel::legendEmbeddedInParent( QgsLayerTreeLayer *nodeLayer ) const
 {
-  return static_cast< bool >( mLegend[nodeLayer].embeddedNodeInParent );
+  return static_cast< bool >( legendNodeEmbeddedInParent( nodeLayer ) );
 }
 
 QgsLayerTreeModelLegendNode *QgsLayerTreeModel::legendNodeEmbeddedInParent( QgsLayerTreeLayer *nodeLayer ) const
 {
+  // only ever requested for rows which are actually shown (or rendered in a
+  // layout legend), so it is fine to build a lazily created legend here
+  const_cast<QgsLayerTreeModel *>( this )->ensureLegendNodesCreated( nodeLayer );
+
   return mLegend[nodeLayer].embeddedNodeInParent;
 }
 
 
 QIcon QgsLayerTreeModel::legendIconEmbeddedInParent( QgsLayerTreeLayer *nodeLayer ) const
 {
-  QgsLayerTreeModelLegendNode *legendNode = mLegend[nodeLayer].embeddedNodeInParent;
+  QgsLayerTreeModelLegendNode *legendNode = legendNodeEmbeddedInParent( nodeLayer );
   if ( !legendNode )
     return QIcon();
   return QIcon( qvariant_cast<QPixmap>( legendNode->data( Qt::DecorationRole ) ) );
@@ -1478,6 +1529,8 @@ QIcon QgsLayerTreeModel::legendIconEmbeddedInParent( QgsLayerTreeLayer *nodeLaye
 
 QList<QgsLayerTreeModelLegendNode *> QgsLayerTreeModel::layerLegendNodes( QgsLayerTreeLayer *nodeLayer, bool skipNodeEmbeddedInParent )
 {
+  ensureLegendNodesCreated( nodeLayer );
+
   if ( !mLegend.contains( nodeLayer ) )
     return QList<QgsLayerTreeModelLegendNode *>();
 
@@ -1490,11 +1543,21 @@ QList<QgsLayerTreeModelLegendNode *> QgsLayerTreeModel::layerLegendNodes( QgsLay
 
 QList<QgsLayerTreeModelLegendNode *> QgsLayerTreeModel::layerOriginalLegendNodes( QgsLayerTreeLayer *nodeLayer )
 {
+  ensureLegendNodesCreated( nodeLayer );
+
   return mLegend.value( nodeLayer ).originalNodes;
 }
 
 QgsLayerTreeModelLegendNode *QgsLayerTreeModel::findLegendNode( const QString &layerId, const QString &ruleKey ) const
 {
+  // legend nodes are created lazily - make sure the legends of matching layers exist
+  const QList<QgsLayerTreeLayer *> pendingLayers = mPendingLegendLayers.toList();
+  for ( QgsLayerTreeLayer *nodeLayer : pendingLayers )
+  {
+    if ( nodeLayer->layerId() == layerId )
+      const_cast<QgsLayerTreeModel *>( this )->ensureLegendNodesCreated( nodeLayer );
+  }
+
   QMap<QgsLayerTreeLayer *, LayerLegendData>::const_iterator it = mLegend.constBegin();
   for ( ; it != mLegend.constEnd(); ++it )
   {
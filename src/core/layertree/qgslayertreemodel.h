@@ -20,6 +20,7 @@
 #include <QAbstractItemModel>
 #include <QFont>
 #include <QIcon>
+#include <QSet>
 #include <QTimer>
 #include <memory>
 
@@ -77,6 +78,9 @@ class CORE_EXPORT QgsLayerTreeModel : public QAbstractItemModel
 
     int rowCount( const QModelIndex &parent = QModelIndex() ) const override;
     int columnCount( const QModelIndex &parent = QModelIndex() ) const override;
+    bool hasChildren( const QModelIndex &parent = QModelIndex() ) const override;
+    bool canFetchMore( const QModelIndex &parent ) const override;
+    void fetchMore( const QModelIndex &parent ) override;
     QModelIndex index( int row, int column, const QModelIndex &parent = QModelIndex() ) const override;
     QModelIndex parent( const QModelIndex &child ) const override;
     QVariant data( const QModelIndex &index, int role = Qt::DisplayRole ) const override;
@@ -315,6 +319,13 @@ class CORE_EXPORT QgsLayerTreeModel : public QAbstractItemModel
     void removeLegendFromLayer( QgsLayerTreeLayer *nodeLayer );
     void addLegendToLayer( QgsLayerTreeLayer *nodeL );
 
+    /**
+     * Creates the legend nodes for a layer whose legend creation was deferred.
+     * Does nothing if the legend has been built already.
+     * \since QGIS 3.8
+     */
+    void ensureLegendNodesCreated( QgsLayerTreeLayer *nodeLayer );
+
     void connectToLayer( QgsLayerTreeLayer *nodeLayer );
     void disconnectFromLayer( QgsLayerTreeLayer *nodeLayer );
 
@@ -424,6 +435,14 @@ class CORE_EXPORT QgsLayerTreeModel : public QAbstractItemModel
     //! Per layer data about layer's legend nodes
     QMap<QgsLayerTreeLayer *, LayerLegendData> mLegend;
 
+    /**
+     * Layers whose legend nodes have not been created yet. Legends are built
+     * lazily when a layer node gets expanded in a view or when legend nodes
+     * are requested explicitly, so that projects with many (collapsed) layers
+     * do not pay for legends that are never shown.
+     */
+    QSet<QgsLayerTreeLayer *> mPendingLegendLayers;
+
     QFont mFontLayer;
     QFont mFontGroup;
 
@@ -25,9 +25,12 @@
 #include "qgslayoutguidecollection.h"
 #include "qgsabstractlayoutiterator.h"
 #include "qgsfeedback.h"
+#include "qgsprojectmetadata.h"
 #include <QImageWriter>
 #include <QSize>
 #include <QSvgGenerator>
+#include <QThread>
+#include <QtConcurrentRun>
 
 #include "gdal.h"
 #include "cpl_conv.h"
@@ -281,10 +284,54 @@ QImage QgsLayoutExporter::renderRegionToImage( const QRectF &region, QSize image
     image.setDotsPerMeterX( static_cast< int >( std::round( resolution / 25.4 * 1000 ) ) );
     image.setDotsPerMeterY( static_cast< int>( std::round( resolution / 25.4 * 1000 ) ) );
     image.fill( Qt::transparent );
-    QPainter imagePainter( &image );
-    renderRegion( &imagePainter, region );
-    if ( !imagePainter.isActive() )
-      return QImage();
+
+    // very large pages are rasterized band-parallel: the image is split into
+    // horizontal strips which are rendered concurrently on cloned layouts. every
+    // strip writes disjoint rows of the final image, so no compositing pass is needed
+    const int idealThreads = QThread::idealThreadCount();
+    const int stripCount = std::min( idealThreads, height / 1024 );
+    if ( static_cast< qint64 >( width ) * height >= 64000000 && stripCount > 1 )
+    {
+      // clones are created (and later deleted) on this thread -- each worker uses
+      // exactly one of them
+      std::vector< std::unique_ptr< QgsLayout > > clones;
+      QVector< QFuture< void > > futures;
+      uchar *bits = image.bits();
+      const int bytesPerLine = image.bytesPerLine();
+      for ( int stripIndex = 0; stripIndex < stripCount; ++stripIndex )
+      {
+        const int y0 = height * stripIndex / stripCount;
+        const int y1 = height * ( stripIndex + 1 ) / stripCount;
+
+        std::unique_ptr< QgsLayout > clone( mLayout->clone() );
+        clone->renderContext().setDpi( resolution );
+        clone->renderContext().setFlags( mLayout->renderContext().flags() );
+        QgsLayout *cloneLayout = clone.get();
+        clones.emplace_back( std::move( clone ) );
+
+        const QRectF stripRegion( region.x(), region.y() + y0 * region.height() / height,
+                                  region.width(), ( y1 - y0 ) * region.height() / height );
+        futures << QtConcurrent::run( [cloneLayout, bits, bytesPerLine, width, y0, y1, stripRegion]()
+        {
+          // zero-copy view over the strip's rows of the final image. the view is
+          // created inside the worker so that it holds the only reference to the
+          // external buffer and painting never detaches from it
+          QImage stripImage( bits + static_cast< qint64 >( y0 ) * bytesPerLine, width, y1 - y0, bytesPerLine, QImage::Format_ARGB32 );
+          QPainter stripPainter( &stripImage );
+          QgsLayoutExporter stripExporter( cloneLayout );
+          stripExporter.renderRegion( &stripPainter, stripRegion );
+        } );
+      }
+      for ( QFuture< void > &future : futures )
+        future.waitForFinished();
+    }
+    else
+    {
+      QPainter imagePainter( &image );
+      renderRegion( &imagePainter, region );
+      if ( !imagePainter.isActive() )
+        return QImage();
+    }
   }
 
   return image;
@@ -325,6 +372,22 @@ class LayoutContextSettingsRestorer
 ///@endcond PRIVATE
 
 QgsLayoutExporter::ExportResult QgsLayoutExporter::exportToImage( const QString &filePath, const QgsLayoutExporter::ImageExportSettings &s )
+{
+  QFuture<bool> pendingSave;
+  QString pendingSavePath;
+  ExportResult result = exportToImage( filePath, s, pendingSave, pendingSavePath );
+  if ( result != Success )
+    return result;
+
+  if ( !pendingSavePath.isEmpty() && !pendingSave.result() )
+  {
+    mErrorFileName = pendingSavePath;
+    return FileError;
+  }
+  return Success;
+}
+
+QgsLayoutExporter::ExportResult QgsLayoutExporter::exportToImage( const QString &filePath, const QgsLayoutExporter::ImageExportSettings &s, QFuture<bool> &pendingSave, QString &pendingSavePath )
 {
   if ( !mLayout )
     return PrintError;
@@ -370,6 +433,26 @@ QgsLayoutExporter::ExportResult QgsLayoutExporter::exportToImage( const QString
     }
   }
 
+  // take a copy of the project metadata on this thread - pages are written from a worker thread
+  const bool exportMetadata = settings.exportMetadata && mLayout->project();
+  QgsProjectMetadata metadata;
+  if ( exportMetadata )
+    metadata = mLayout->project()->metadata();
+
+  // while a page renders, the previous page's image is encoded and written in the background
+  auto waitForPendingSave = [&pendingSave, &pendingSavePath, this]() -> bool
+  {
+    if ( pendingSavePath.isEmpty() )
+      return true;
+    if ( !pendingSave.result() )
+    {
+      mErrorFileName = pendingSavePath;
+      return false;
+    }
+    pendingSavePath.clear();
+    return true;
+  };
+
   for ( int page : qgis::as_const( pages ) )
   {
     if ( !mLayout->pageCollection()->shouldExportPage( page ) )
@@ -387,20 +470,35 @@ QgsLayoutExporter::ExportResult QgsLayoutExporter::exportToImage( const QString
     pageDetails.page = page;
     QString outputFilePath = generateFileName( pageDetails );
 
+    if ( !waitForPendingSave() )
+      return FileError;
+
     if ( image.isNull() )
     {
       mErrorFileName = outputFilePath;
       return MemoryError;
     }
 
-    if ( !saveImage( image, outputFilePath, pageDetails.extension, settings.exportMetadata ? mLayout->project() : nullptr ) )
+    const bool shouldGeoreference = ( page == worldFilePageNo );
+    if ( !shouldGeoreference )
+    {
+      // encode and write this page in the background while the next page renders
+      const QString extension = pageDetails.extension;
+      pendingSavePath = outputFilePath;
+      pendingSave = QtConcurrent::run( [image, outputFilePath, extension, exportMetadata, metadata]() -> bool
+      {
+        return saveImage( image, outputFilePath, extension, exportMetadata ? &metadata : nullptr );
+      } );
+      continue;
+    }
+
+    // georeferencing reworks the file after saving, so this page is written synchronously
+    if ( !saveImage( image, outputFilePath, pageDetails.extension, exportMetadata ? &metadata : nullptr ) )
     {
       mErrorFileName = outputFilePath;
       return FileError;
     }
 
-    const bool shouldGeoreference = ( page == worldFilePageNo );
-    if ( shouldGeoreference )
     {
       georeferenceOutputPrivate( outputFilePath, nullptr, bounds, settings.dpi, shouldGeoreference );
 
@@ -437,6 +535,12 @@ QgsLayoutExporter::ExportResult QgsLayoutExporter::exportToImage( QgsAbstractLay
   int total = iterator->count();
   double step = total > 0 ? 100.0 / total : 100.0;
   int i = 0;
+
+  // pages are written in the background while the next section renders - the pending
+  // save is carried across iterations so that single page sections also overlap
+  QFuture<bool> pendingSave;
+  QString pendingSavePath;
+
   while ( iterator->next() )
   {
     if ( feedback )
@@ -455,17 +559,25 @@ QgsLayoutExporter::ExportResult QgsLayoutExporter::exportToImage( QgsAbstractLay
 
     QgsLayoutExporter exporter( iterator->layout() );
     QString filePath = iterator->filePath( baseFilePath, extension );
-    ExportResult result = exporter.exportToImage( filePath, settings );
+    ExportResult result = exporter.exportToImage( filePath, settings, pendingSave, pendingSavePath );
     if ( result != Success )
     {
       if ( result == FileError )
-        error = QObject::tr( "Cannot write to %1. This file may be open in another application or may be an invalid path." ).arg( QDir::toNativeSeparators( filePath ) );
+        error = QObject::tr( "Cannot write to %1. This file may be open in another application or may be an invalid path." ).arg( QDir::toNativeSeparators( exporter.errorFile().isEmpty() ? filePath : exporter.errorFile() ) );
       iterator->endRender();
       return result;
     }
     i++;
   }
 
+  // wait for the last page still being written in the background
+  if ( !pendingSavePath.isEmpty() && !pendingSave.result() )
+  {
+    error = QObject::tr( "Cannot write to %1. This file may be open in another application or may be an invalid path." ).arg( QDir::toNativeSeparators( pendingSavePath ) );
+    iterator->endRender();
+    return FileError;
+  }
+
   if ( feedback )
   {
     feedback->setProgress( 100 );
@@ -1083,30 +1195,60 @@ QgsLayoutExporter::ExportResult QgsLayoutExporter::printPrivate( QPrinter &print
   bool pageExported = false;
   if ( rasterize )
   {
+    QList< int > pagesToExport;
     for ( int i = fromPage; i <= toPage; ++i )
     {
-      if ( !mLayout->pageCollection()->shouldExportPage( i ) )
-      {
-        continue;
-      }
+      if ( mLayout->pageCollection()->shouldExportPage( i ) )
+        pagesToExport << i;
+    }
 
-      updatePrinterPageSize( mLayout, printer, i );
-      if ( ( pageExported && i > fromPage ) || startNewPage )
-      {
-        printer.newPage();
-      }
+    // independent pages are rasterized in parallel on cloned layouts, but written
+    // to the printer strictly in page order. pages are processed in small groups
+    // to bound the number of full-resolution page images held in memory at once.
+    const int groupSize = pagesToExport.count() > 1 ? std::max( 1, std::min( QThread::idealThreadCount(), 4 ) ) : 1;
+    for ( int groupStart = 0; groupStart < pagesToExport.count(); groupStart += groupSize )
+    {
+      const int groupCount = std::min( groupSize, pagesToExport.count() - groupStart );
 
-      QImage image = renderPageToImage( i, QSize(), dpi );
-      if ( !image.isNull() )
+      // clones are created and deleted on this thread -- each worker uses exactly one
+      std::vector< std::unique_ptr< QgsLayout > > clones;
+      QVector< QFuture< QImage > > futures;
+      for ( int j = 0; j < groupCount && groupSize > 1; ++j )
       {
-        QRectF targetArea( 0, 0, image.width(), image.height() );
-        painter.drawImage( targetArea, image, targetArea );
+        const int page = pagesToExport.at( groupStart + j );
+        std::unique_ptr< QgsLayout > clone( mLayout->clone() );
+        clone->renderContext().setDpi( mLayout->renderContext().dpi() );
+        clone->renderContext().setFlags( mLayout->renderContext().flags() );
+        QgsLayout *cloneLayout = clone.get();
+        clones.emplace_back( std::move( clone ) );
+        futures << QtConcurrent::run( [cloneLayout, page, dpi]() -> QImage
+        {
+          QgsLayoutExporter pageExporter( cloneLayout );
+          return pageExporter.renderPageToImage( page, QSize(), dpi );
+        } );
       }
-      else
+
+      for ( int j = 0; j < groupCount; ++j )
       {
-        return MemoryError;
+        const int i = pagesToExport.at( groupStart + j );
+        updatePrinterPageSize( mLayout, printer, i );
+        if ( ( pageExported && i > fromPage ) || startNewPage )
+        {
+          printer.newPage();
+        }
+
+        QImage image = groupSize > 1 ? futures[j].result() : renderPageToImage( i, QSize(), dpi );
+        if ( !image.isNull() )
+        {
+          QRectF targetArea( 0, 0, image.width(), image.height() );
+          painter.drawImage( targetArea, image, targetArea );
+        }
+        else
+        {
+          return MemoryError;
+        }
+        pageExported = true;
       }
-      pageExported = true;
     }
   }
   else
@@ -1605,24 +1747,24 @@ QString QgsLayoutExporter::generateFileName( const PageExportDetails &details )
   }
 }
 
-bool QgsLayoutExporter::saveImage( const QImage &image, const QString &imageFilename, const QString &imageFormat, QgsProject *projectForMetadata )
+bool QgsLayoutExporter::saveImage( const QImage &image, const QString &imageFilename, const QString &imageFormat, const QgsProjectMetadata *metadata )
 {
   QImageWriter w( imageFilename, imageFormat.toLocal8Bit().constData() );
   if ( imageFormat.compare( QLatin1String( "tiff" ), Qt::CaseInsensitive ) == 0 || imageFormat.compare( QLatin1String( "tif" ), Qt::CaseInsensitive ) == 0 )
   {
     w.setCompression( 1 ); //use LZW compression
   }
-  if ( projectForMetadata )
+  if ( metadata )
   {
-    w.setText( QStringLiteral( "Author" ), projectForMetadata->metadata().author() );
+    w.setText( QStringLiteral( "Author" ), metadata->author() );
     const QString creator = QStringLiteral( "QGIS %1" ).arg( Qgis::QGIS_VERSION );
     w.setText( QStringLiteral( "Creator" ), creator );
     w.setText( QStringLiteral( "Producer" ), creator );
-    w.setText( QStringLiteral( "Subject" ), projectForMetadata->metadata().abstract() );
-    w.setText( QStringLiteral( "Created" ), projectForMetadata->metadata().creationDateTime().toString( Qt::ISODate ) );
-    w.setText( QStringLiteral( "Title" ), projectForMetadata->metadata().title() );
+    w.setText( QStringLiteral( "Subject" ), metadata->abstract() );
+    w.setText( QStringLiteral( "Created" ), metadata->creationDateTime().toString( Qt::ISODate ) );
+    w.setText( QStringLiteral( "Title" ), metadata->title() );
 
-    const QgsAbstractMetadataBase::KeywordMap keywords = projectForMetadata->metadata().keywords();
+    const QgsAbstractMetadataBase::KeywordMap keywords = metadata->keywords();
     QStringList allKeywords;
     for ( auto it = keywords.constBegin(); it != keywords.constEnd(); ++it )
     {
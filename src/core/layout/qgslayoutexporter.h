@@ -24,6 +24,7 @@
 #include <QPointer>
 #include <QSize>
 #include <QRectF>
+#include <QFuture>
 
 #ifndef QT_NO_PRINTER
 
@@ -32,6 +33,7 @@ class QPainter;
 class QgsLayoutItemMap;
 class QgsAbstractLayoutIterator;
 class QgsFeedback;
+class QgsProjectMetadata;
 
 /**
  * \ingroup core
@@ -514,6 +516,15 @@ class CORE_EXPORT QgsLayoutExporter
 
     QImage createImage( const ImageExportSettings &settings, int page, QRectF &bounds, bool &skipPage ) const;
 
+    /**
+     * Image export which writes pages in a background thread while the next page renders.
+     *
+     * The pending save state is passed in by the caller, so that iterator based exports can keep
+     * the pipeline running across consecutive sections. The caller is responsible for waiting on
+     * \a pendingSave once done and reporting a failure for \a pendingSavePath.
+     */
+    ExportResult exportToImage( const QString &filePath, const ImageExportSettings &settings, QFuture<bool> &pendingSave, QString &pendingSavePath );
+
     /**
      * Returns the page number of the first page to be exported from the layout, skipping any pages
      * which have been excluded from export.
@@ -521,9 +532,12 @@ class CORE_EXPORT QgsLayoutExporter
     static int firstPageToBeExported( QgsLayout *layout );
 
     /**
-     * Saves an image to a file, possibly using format specific options (e.g. LZW compression for tiff)
+     * Saves an image to a file, possibly using format specific options (e.g. LZW compression for tiff).
+     *
+     * Takes a copy of the project metadata (instead of the project itself) so that it is safe
+     * to call from a worker thread while the next page is being rendered.
     */
-    static bool saveImage( const QImage &image, const QString &imageFilename, const QString &imageFormat, QgsProject *projectForMetadata );
+    static bool saveImage( const QImage &image, const QString &imageFilename, const QString &imageFormat, const QgsProjectMetadata *metadata );
 
     /**
      * Computes a GDAL style geotransform for georeferencing a layout.
@@ -833,21 +833,30 @@ void QgsLayoutItemMap::paint( QPainter *painter, const QStyleOptionGraphicsItem
     }
     else
     {
-      if ( mCacheInvalidated && !mDrawingPreview )
+      if ( mCacheInvalidated && !mDrawingPreview && !mBackgroundUpdateTimer->isActive() )
       {
-        // cache was invalidated - trigger a background update
+        // cache was invalidated - trigger a background update, unless a deferred
+        // update is already pending (e.g. while the item is being dragged)
         mPreviewScaleFactor = QgsLayoutUtils::scaleFactorFromItemStyle( style );
         mBackgroundUpdateTimer->start( 1 );
       }
 
       //Background color is already included in cached image, so no need to draw
 
-      double imagePixelWidth = mCacheFinalImage->width(); //how many pixels of the image are for the map extent?
-      double scale = rect().width() / imagePixelWidth;
+      // the cached image may cover a larger extent than the item (preview margin),
+      // and may have been rendered for a different extent than the current one --
+      // place it according to the extent it was rendered for
+      const QgsRectangle cacheExtent = !mCacheFinalExtent.isNull() ? mCacheFinalExtent : extent();
+      const QgsRectangle itemExtent = extent();
+      double layoutUnitsPerMapUnitX = rect().width() / itemExtent.width();
+      double layoutUnitsPerMapUnitY = rect().height() / itemExtent.height();
+      double scale = layoutUnitsPerMapUnitX * cacheExtent.width() / mCacheFinalImage->width();
+      double dx = ( cacheExtent.xMinimum() - itemExtent.xMinimum() ) * layoutUnitsPerMapUnitX;
+      double dy = ( itemExtent.yMaximum() - cacheExtent.yMaximum() ) * layoutUnitsPerMapUnitY;
 
       painter->save();
 
-      painter->translate( mLastRenderedImageOffsetX + mXOffset, mLastRenderedImageOffsetY + mYOffset );
+      painter->translate( mLastRenderedImageOffsetX + mXOffset + dx, mLastRenderedImageOffsetY + mYOffset + dy );
       painter->scale( scale, scale );
       painter->drawImage( 0, 0, *mCacheFinalImage );
 
@@ -1052,6 +1061,13 @@ void QgsLayoutItemMap::recreateCachedImageInBackground()
   Q_ASSERT( !mCacheRenderingImage );
 
   QgsRectangle ext = extent();
+  if ( qgsDoubleNear( mEvaluatedMapRotation, 0.0 ) )
+  {
+    // render a generous margin around the item extent, so that small interactive
+    // moves and resizes can reuse the cached image (same trick as canvas panning)
+    ext.scale( 1.5 );
+  }
+  mCacheRenderingExtent = ext;
   double widthLayoutUnits = ext.width() * mapUnitsToLayoutUnits();
   double heightLayoutUnits = ext.height() * mapUnitsToLayoutUnits();
 
@@ -1470,6 +1486,7 @@ void QgsLayoutItemMap::painterJobFinished()
   mPainterJob.reset( nullptr );
   mPainter.reset( nullptr );
   mCacheFinalImage = std::move( mCacheRenderingImage );
+  mCacheFinalExtent = mCacheRenderingExtent;
   mLastRenderedImageOffsetX = 0;
   mLastRenderedImageOffsetY = 0;
   update();
@@ -1488,12 +1505,33 @@ void QgsLayoutItemMap::shapeChanged()
   // but scale height to match item's aspect ratio
   double newHeight = newWidth * h / w;
 
+  const QgsRectangle oldExtent = mExtent;
   mExtent = QgsRectangle::fromCenterAndSize( oldCenter, newWidth, newHeight );
 
   //recalculate data defined scale and extents
   refreshMapExtents();
   updateBoundingRect();
-  invalidateCache();
+
+  if ( mExtent == oldExtent )
+  {
+    // pure move -- the cached image stays valid, it just gets painted elsewhere
+    update();
+  }
+  else if ( mCacheFinalImage && !mCacheFinalExtent.isNull()
+            && mCacheFinalExtent.contains( mExtent )
+            && mCacheFinalImage->width() >= mCacheFinalExtent.width() * mapUnitsToLayoutUnits() * mPreviewScaleFactor * 0.8 )
+  {
+    // the new extent is still covered by the cached image's margin at adequate
+    // resolution -- reuse it, but schedule a deferred re-render so that the
+    // preview sharpens up once the adjustment stops
+    mCacheInvalidated = true;
+    update();
+    mBackgroundUpdateTimer->start( 500 );
+  }
+  else
+  {
+    invalidateCache();
+  }
   emit changed();
   emit extentChanged();
 }
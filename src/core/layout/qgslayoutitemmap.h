@@ -620,6 +620,13 @@ class CORE_EXPORT QgsLayoutItemMap : public QgsLayoutItem
     // background
     std::unique_ptr< QImage > mCacheFinalImage;
     std::unique_ptr< QImage > mCacheRenderingImage;
+
+    // Extents covered by the two cached images, in map units. Preview renders cover
+    // a generous margin around the item extent so that small interactive moves and
+    // resizes can reuse the cached imagery instead of triggering a re-render.
+    QgsRectangle mCacheFinalExtent;
+    QgsRectangle mCacheRenderingExtent;
+
     bool mUpdatesEnabled = true;
 
     //! True if cached map image must be recreated
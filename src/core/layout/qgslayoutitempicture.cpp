@@ -44,6 +44,8 @@
 #include <QSvgRenderer>
 #include <QNetworkRequest>
 #include <QNetworkReply>
+
+#include <cmath>
 #include <QEventLoop>
 #include <QCoreApplication>
 
@@ -192,7 +194,35 @@ void QgsLayoutItemPicture::draw( QgsLayoutItemRenderContext &context )
 
     if ( mMode == FormatSVG )
     {
-      mSVG.render( painter, QRectF( 0, 0, boundRectWidthMM, boundRectHeightMM ) );
+      if ( mLayout && mLayout->renderContext().isPreviewRender() )
+      {
+        // for interactive preview renders, rasterize the SVG once and reuse the
+        // raster while the target pixel size is unchanged -- re-rendering complex
+        // SVGs on every paint makes layout editing sluggish
+        const double pixelsPerMM = context.renderContext().scaleFactor() * context.viewScaleFactor();
+        QSize targetSize( std::max( 1, static_cast< int >( std::round( boundRectWidthMM * pixelsPerMM ) ) ),
+                          std::max( 1, static_cast< int >( std::round( boundRectHeightMM * pixelsPerMM ) ) ) );
+        // limit size of raster for better performance
+        if ( targetSize.width() > 5000 || targetSize.height() > 5000 )
+          targetSize.scale( 5000, 5000, Qt::KeepAspectRatio );
+
+        if ( mCachedSvgRaster.isNull() || mCachedSvgRaster.size() != targetSize )
+        {
+          QImage raster( targetSize, QImage::Format_ARGB32_Premultiplied );
+          raster.fill( Qt::transparent );
+          QPainter rasterPainter( &raster );
+          rasterPainter.setRenderHint( QPainter::Antialiasing, true );
+          mSVG.render( &rasterPainter, QRectF( 0, 0, targetSize.width(), targetSize.height() ) );
+          rasterPainter.end();
+          mCachedSvgRaster = raster;
+        }
+        painter->drawImage( QRectF( 0, 0, boundRectWidthMM, boundRectHeightMM ), mCachedSvgRaster,
+                            QRectF( 0, 0, mCachedSvgRaster.width(), mCachedSvgRaster.height() ) );
+      }
+      else
+      {
+        mSVG.render( painter, QRectF( 0, 0, boundRectWidthMM, boundRectHeightMM ) );
+      }
     }
     else if ( mMode == FormatRaster )
     {
@@ -487,6 +517,7 @@ void QgsLayoutItemPicture::loadPicture( const QString &path )
 {
   mIsMissingImage = false;
   mEvaluatedPath = path;
+  mCachedSvgRaster = QImage();
   if ( path.startsWith( QLatin1String( "http" ) ) )
   {
     //remote location
@@ -303,6 +303,8 @@ class CORE_EXPORT QgsLayoutItemPicture: public QgsLayoutItem
 
     QImage mImage;
     QSvgRenderer mSVG;
+    //! Cached rasterization of mSVG, reused by preview renders while the target pixel size is unchanged
+    QImage mCachedSvgRaster;
     //! Absolute path to the image (may be also HTTP URL)
     QString mSourcePath;
     Format mMode = FormatUnknown;
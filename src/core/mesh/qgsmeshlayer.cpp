@@ -70,6 +70,10 @@ void QgsMeshLayer::setDefaultRendererSettings()
 
 QgsMeshLayer::~QgsMeshLayer()
 {
+  // a background dataset prefetch may still be using the provider
+  if ( mRendererCache )
+    mRendererCache->mPrefetchFuture.waitForFinished();
+
   delete mDataProvider;
 }
 
@@ -202,6 +206,86 @@ QgsMeshDatasetValue QgsMeshLayer::datasetValue( const QgsMeshDatasetIndex &index
   return value;
 }
 
+QVector<QgsMeshDatasetValue> QgsMeshLayer::datasetValues( const QgsMeshDatasetIndex &index, const QVector<QgsPointXY> &points ) const
+{
+  QVector<QgsMeshDatasetValue> values( points.size() );
+
+  if ( !mTriangularMesh || !dataProvider() || !dataProvider()->isValid() || !index.isValid() )
+    return values;
+
+  // resolve the group metadata and fetch the dataset values and face activity flags in
+  // single blocks upfront - issuing a provider call per sampled point (or per triangle
+  // vertex) dominates the cost of dense sampling
+  const QgsMeshDatasetGroupMetadata metadata = dataProvider()->datasetGroupMetadata( index );
+  const bool dataOnFaces = metadata.dataType() == QgsMeshDatasetGroupMetadata::DataOnFaces;
+  const bool isVector = metadata.isVector();
+
+  const int valueCount = dataOnFaces ? dataProvider()->faceCount() : dataProvider()->vertexCount();
+  const QgsMeshDataBlock datasetValues = dataProvider()->datasetValues( index, 0, valueCount );
+  const QgsMeshDataBlock activeFaceFlagValues = dataProvider()->areFacesActive( index, 0, dataProvider()->faceCount() );
+  if ( !datasetValues.isValid() )
+    return values;
+
+  const QVector<QgsMeshFace> &triangles = mTriangularMesh->triangles();
+  const QVector<QgsMeshVertex> &vertices = mTriangularMesh->vertices();
+  const QVector<int> &trianglesToNativeFaces = mTriangularMesh->trianglesToNativeFaces();
+
+  // consecutive samples along a profile line or a point matrix usually fall into the same
+  // triangle, so remember the last containing triangle and test it before going back to
+  // the spatial index
+  int lastFaceIndex = -1;
+  QgsGeometry lastFaceGeometry;
+
+  for ( int i = 0; i < points.size(); ++i )
+  {
+    const QgsPointXY point = points.at( i );
+
+    int faceIndex = -1;
+    if ( lastFaceIndex >= 0 && lastFaceGeometry.contains( &point ) )
+    {
+      faceIndex = lastFaceIndex;
+    }
+    else
+    {
+      faceIndex = mTriangularMesh->faceIndexForPoint( point );
+      if ( faceIndex >= 0 )
+      {
+        lastFaceIndex = faceIndex;
+        lastFaceGeometry = QgsMeshUtils::toGeometry( triangles.at( faceIndex ), vertices );
+      }
+    }
+
+    if ( faceIndex < 0 )
+      continue; // outside the mesh - leave the NaN value
+
+    const int nativeFaceIndex = trianglesToNativeFaces.at( faceIndex );
+    if ( !activeFaceFlagValues.active( nativeFaceIndex ) )
+      continue;
+
+    if ( dataOnFaces )
+    {
+      values[i] = datasetValues.value( nativeFaceIndex );
+    }
+    else
+    {
+      const QgsMeshFace &face = triangles[faceIndex];
+      const int v1 = face[0], v2 = face[1], v3 = face[2];
+      const QgsPoint p1 = vertices[v1], p2 = vertices[v2], p3 = vertices[v3];
+      const QgsMeshDatasetValue val1 = datasetValues.value( v1 );
+      const QgsMeshDatasetValue val2 = datasetValues.value( v2 );
+      const QgsMeshDatasetValue val3 = datasetValues.value( v3 );
+      const double x = QgsMeshLayerUtils::interpolateFromVerticesData( p1, p2, p3, val1.x(), val2.x(), val3.x(), point );
+      double y = std::numeric_limits<double>::quiet_NaN();
+      if ( isVector )
+        y = QgsMeshLayerUtils::interpolateFromVerticesData( p1, p2, p3, val1.y(), val2.y(), val3.y(), point );
+
+      values[i] = QgsMeshDatasetValue( x, y );
+    }
+  }
+
+  return values;
+}
+
 void QgsMeshLayer::fillNativeMesh()
 {
   Q_ASSERT( !mNativeMesh );
@@ -374,6 +458,13 @@ bool QgsMeshLayer::readXml( const QDomNode &layer_node, QgsReadWriteContext &con
     mProviderKey = pkeyElt.text();
   }
 
+  if ( mReadFlags & QgsMapLayer::FlagDontResolveLayers )
+  {
+    // provider resolution was deferred -- extra datasets and symbology are
+    // restored from originalXmlProperties() once the data source is set
+    return true;
+  }
+
   QgsDataProvider::ProviderOptions providerOptions;
   if ( !setDataProvider( mProviderKey, providerOptions ) )
   {
@@ -218,6 +218,24 @@ class CORE_EXPORT QgsMeshLayer : public QgsMapLayer
       */
     QgsMeshDatasetValue datasetValue( const QgsMeshDatasetIndex &index, const QgsPointXY &point ) const;
 
+    /**
+      * Interpolates the values on many points from the given dataset, in one call.
+      *
+      * This is an optimized equivalent of calling datasetValue() for every point, intended
+      * for sampling profile lines or point matrices: the dataset values and face activity
+      * flags are fetched from the provider in single blocks, and consecutive points falling
+      * into the same triangle reuse the containing-triangle lookup instead of querying the
+      * spatial index again.
+      *
+      * The returned vector has one entry per input point, in the same order. Points outside
+      * the mesh, on inactive faces, or queried before the triangular mesh was indexed by a
+      * previous rendering yield NaN values.
+      *
+      * \note Not available in Python bindings
+      * \since QGIS 3.8
+      */
+    QVector<QgsMeshDatasetValue> datasetValues( const QgsMeshDatasetIndex &index, const QVector<QgsPointXY> &points ) const SIP_SKIP;
+
   signals:
 
     /**
@@ -17,9 +17,13 @@
 
 ///@cond PRIVATE
 
+#include <algorithm>
 #include <memory>
 #include <limits>
 
+#include <QThread>
+#include <QtConcurrentMap>
+
 #include "qgsmeshlayerinterpolator.h"
 
 #include "qgis.h"
@@ -81,7 +85,18 @@ QgsRasterBlock *QgsMeshLayerInterpolator::block( int, const QgsRectangle &extent
   if ( mDataOnVertices )
     Q_ASSERT( mDatasetValues.count() == mTriangularMesh.vertices().count() );
 
-  for ( int i = 0; i < triangles.size(); ++i )
+  // bin the visible triangles into horizontal bands of the output, so that
+  // the bands can be rasterized in parallel: each band only ever writes to
+  // its own rows of the block
+  const int bandCount = std::max( 1, std::min( QThread::idealThreadCount(), height ) );
+  const int rowsPerBand = ( height + bandCount - 1 ) / bandCount;
+
+  // ask the mesh's spatial index for the triangles intersecting the requested extent
+  // first - when zoomed in on a large mesh this avoids walking every face per block
+  const QList<int> candidateTriangles = mTriangularMesh.faceIndexesForRectangle( extent );
+
+  QVector< QVector<int> > bandTriangles( bandCount );
+  for ( const int i : candidateTriangles )
   {
     if ( feedback && feedback->isCanceled() )
       break;
@@ -90,9 +105,7 @@ QgsRasterBlock *QgsMeshLayerInterpolator::block( int, const QgsRectangle &extent
       break;
 
     const QgsMeshFace &face = triangles[i];
-
-    const int v1 = face[0], v2 = face[1], v3 = face[2];
-    const QgsPoint p1 = vertices[v1], p2 = vertices[v2], p3 = vertices[v3];
+    const QgsPoint p1 = vertices[face[0]], p2 = vertices[face[1]], p3 = vertices[face[2]];
 
     const int nativeFaceIndex = mTriangularMesh.trianglesToNativeFaces()[i];
     const bool isActive = mActiveFaceFlagValues.active( nativeFaceIndex );
@@ -103,50 +116,90 @@ QgsRasterBlock *QgsMeshLayerInterpolator::block( int, const QgsRectangle &extent
     if ( !extent.intersects( bbox ) )
       continue;
 
-    // Get the BBox of the element in pixels
     int topLim, bottomLim, leftLim, rightLim;
     QgsMeshLayerUtils::boundingBoxToScreenRectangle( mContext.mapToPixel(), mOutputSize, bbox, leftLim, rightLim, topLim, bottomLim );
 
-    // interpolate in the bounding box of the face
-    for ( int j = topLim; j <= bottomLim; j++ )
+    for ( int band = topLim / rowsPerBand; band <= bottomLim / rowsPerBand; ++band )
+      bandTriangles[band].append( i );
+  }
+
+  auto rasterizeBand = [&]( int bandIndex )
+  {
+    const int rowStart = bandIndex * rowsPerBand;
+    const int rowEnd = std::min( height - 1, rowStart + rowsPerBand - 1 );
+
+    for ( const int i : qgis::as_const( bandTriangles.at( bandIndex ) ) )
     {
-      double *line = data + ( j * width );
-      for ( int k = leftLim; k <= rightLim; k++ )
-      {
-        double val;
-        const QgsPointXY p = mContext.mapToPixel().toMapCoordinates( k, j );
-        if ( mDataOnVertices )
-          val = QgsMeshLayerUtils::interpolateFromVerticesData(
-                  p1,
-                  p2,
-                  p3,
-                  mDatasetValues[v1],
-                  mDatasetValues[v2],
-                  mDatasetValues[v3],
-                  p );
-        else
-        {
-          int face = mTriangularMesh.trianglesToNativeFaces()[i];
-          val = QgsMeshLayerUtils::interpolateFromFacesData(
-                  p1,
-                  p2,
-                  p3,
-                  mDatasetValues[face],
-                  p
-                );
-        }
+      if ( feedback && feedback->isCanceled() )
+        break;
+
+      if ( mContext.renderingStopped() )
+        break;
+
+      const QgsMeshFace &face = triangles[i];
+
+      const int v1 = face[0], v2 = face[1], v3 = face[2];
+      const QgsPoint p1 = vertices[v1], p2 = vertices[v2], p3 = vertices[v3];
+
+      const QgsRectangle bbox = QgsMeshLayerUtils::triangleBoundingBox( p1, p2, p3 );
 
-        if ( !std::isnan( val ) )
+      // Get the BBox of the element in pixels
+      int topLim, bottomLim, leftLim, rightLim;
+      QgsMeshLayerUtils::boundingBoxToScreenRectangle( mContext.mapToPixel(), mOutputSize, bbox, leftLim, rightLim, topLim, bottomLim );
+
+      // interpolate in the bounding box of the face, clamped to this band
+      for ( int j = std::max( topLim, rowStart ); j <= std::min( bottomLim, rowEnd ); j++ )
+      {
+        double *line = data + ( j * width );
+        for ( int k = leftLim; k <= rightLim; k++ )
         {
-          line[k] = val;
-          outputBlock->setIsData( j, k );
+          double val;
+          const QgsPointXY p = mContext.mapToPixel().toMapCoordinates( k, j );
+          if ( mDataOnVertices )
+            val = QgsMeshLayerUtils::interpolateFromVerticesData(
+                    p1,
+                    p2,
+                    p3,
+                    mDatasetValues[v1],
+                    mDatasetValues[v2],
+                    mDatasetValues[v3],
+                    p );
+          else
+          {
+            int face = mTriangularMesh.trianglesToNativeFaces()[i];
+            val = QgsMeshLayerUtils::interpolateFromFacesData(
+                    p1,
+                    p2,
+                    p3,
+                    mDatasetValues[face],
+                    p
+                  );
+          }
+
+          if ( !std::isnan( val ) )
+          {
+            line[k] = val;
+            outputBlock->setIsData( j, k );
+          }
         }
       }
     }
+  };
 
+  if ( bandCount == 1 )
+  {
+    rasterizeBand( 0 );
+  }
+  else
+  {
+    QVector<int> bandIndices;
+    bandIndices.reserve( bandCount );
+    for ( int band = 0; band < bandCount; ++band )
+      bandIndices.append( band );
+    QtConcurrent::blockingMap( bandIndices, rasterizeBand );
   }
 
-  return outputBlock.release();;
+  return outputBlock.release();
 }
 
 ///@endcond
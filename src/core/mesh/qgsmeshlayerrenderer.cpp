@@ -18,6 +18,7 @@
 #include <memory>
 #include <QSet>
 #include <QPair>
+#include <QtConcurrentRun>
 
 #include "qgsmeshlayerrenderer.h"
 
@@ -39,6 +40,7 @@
 QgsMeshLayerRenderer::QgsMeshLayerRenderer( QgsMeshLayer *layer, QgsRenderContext &context )
   : QgsMapLayerRenderer( layer->id() )
   , mFeedback( new QgsMeshLayerRendererFeedback )
+  , mRendererCache( layer->rendererCache() )
   , mContext( context )
   , mRendererSettings( layer->rendererSettings() )
 {
@@ -54,6 +56,10 @@ QgsMeshLayerRenderer::QgsMeshLayerRenderer( QgsMeshLayer *layer, QgsRenderContex
   copyScalarDatasetValues( layer );
   copyVectorDatasetValues( layer );
 
+  // only once both copies are done - the worker accesses the data provider,
+  // which is not thread safe
+  prefetchNextScalarDataset( layer );
+
   calculateOutputSize();
 }
 
@@ -78,9 +84,13 @@ void QgsMeshLayerRenderer::copyScalarDatasetValues( QgsMeshLayer *layer )
 {
   const QgsMeshDatasetIndex datasetIndex = mRendererSettings.activeScalarDataset();
 
+  // wait for any pending background prefetch - the worker uses the data
+  // provider, which is not thread safe
+  QgsMeshLayerRendererCache *cache = layer->rendererCache();
+  cache->mPrefetchFuture.waitForFinished();
+
   // Find out if we can use cache up to date. If yes, use it and return
   const int datasetGroupCount = layer->dataProvider()->datasetGroupCount();
-  QgsMeshLayerRendererCache *cache = layer->rendererCache();
   if ( ( cache->mDatasetGroupsCount == datasetGroupCount ) &&
        ( cache->mActiveScalarDatasetIndex == datasetIndex ) )
   {
@@ -92,6 +102,30 @@ void QgsMeshLayerRenderer::copyScalarDatasetValues( QgsMeshLayer *layer )
     return;
   }
 
+  {
+    QMutexLocker locker( &cache->mPrefetchMutex );
+    if ( ( cache->mDatasetGroupsCount == datasetGroupCount ) &&
+         ( cache->mPrefetchedScalarDatasetIndex == datasetIndex ) )
+    {
+      // this dataset was prefetched in the background while the previous
+      // timestep was being rendered
+      mScalarDatasetValues = cache->mPrefetchedScalarDatasetValues;
+      mScalarActiveFaceFlagValues = cache->mPrefetchedScalarActiveFaceFlagValues;
+      mScalarDataOnVertices = cache->mPrefetchedScalarDataOnVertices;
+      mScalarDatasetMinimum = cache->mPrefetchedScalarDatasetMinimum;
+      mScalarDatasetMaximum = cache->mPrefetchedScalarDatasetMaximum;
+
+      // update cache
+      cache->mActiveScalarDatasetIndex = datasetIndex;
+      cache->mScalarDatasetValues = mScalarDatasetValues;
+      cache->mScalarActiveFaceFlagValues = mScalarActiveFaceFlagValues;
+      cache->mScalarDataOnVertices = mScalarDataOnVertices;
+      cache->mScalarDatasetMinimum = mScalarDatasetMinimum;
+      cache->mScalarDatasetMaximum = mScalarDatasetMaximum;
+      return;
+    }
+  }
+
   // Cache is not up-to-date, gather data
   if ( datasetIndex.isValid() )
   {
@@ -132,9 +166,13 @@ void QgsMeshLayerRenderer::copyVectorDatasetValues( QgsMeshLayer *layer )
 {
   const QgsMeshDatasetIndex datasetIndex = mRendererSettings.activeVectorDataset();
 
+  // wait for any pending background prefetch - the worker uses the data
+  // provider, which is not thread safe
+  QgsMeshLayerRendererCache *cache = layer->rendererCache();
+  cache->mPrefetchFuture.waitForFinished();
+
   // Find out if we can use cache up to date. If yes, use it and return
   const int datasetGroupCount = layer->dataProvider()->datasetGroupCount();
-  QgsMeshLayerRendererCache *cache = layer->rendererCache();
   if ( ( cache->mDatasetGroupsCount == datasetGroupCount ) &&
        ( cache->mActiveVectorDatasetIndex == datasetIndex ) )
   {
@@ -148,7 +186,6 @@ void QgsMeshLayerRenderer::copyVectorDatasetValues( QgsMeshLayer *layer )
     return;
   }
 
-
   // Cache is not up-to-date, gather data
   if ( datasetIndex.isValid() )
   {
@@ -197,6 +234,62 @@ void QgsMeshLayerRenderer::copyVectorDatasetValues( QgsMeshLayer *layer )
   cache->mVectorDataOnVertices = mVectorDataOnVertices;
 }
 
+void QgsMeshLayerRenderer::prefetchNextScalarDataset( QgsMeshLayer *layer )
+{
+  QgsSettings settings;
+  if ( !settings.value( QStringLiteral( "qgis/meshDatasetPrefetch" ), false ).toBool() )
+    return;
+
+  const QgsMeshDatasetIndex datasetIndex = mRendererSettings.activeScalarDataset();
+  if ( !datasetIndex.isValid() )
+    return;
+
+  // during time animation the next dataset of the same group is the one most
+  // likely to be requested next - fetch it in the background while the
+  // current timestep is being rendered
+  QgsMeshDataProvider *provider = layer->dataProvider();
+  const QgsMeshDatasetIndex nextIndex( datasetIndex.group(), datasetIndex.dataset() + 1 );
+  if ( nextIndex.dataset() >= provider->datasetCount( datasetIndex.group() ) )
+    return;
+
+  QgsMeshLayerRendererCache *cache = layer->rendererCache();
+  {
+    QMutexLocker locker( &cache->mPrefetchMutex );
+    if ( cache->mPrefetchedScalarDatasetIndex == nextIndex )
+      return; // already prefetched
+  }
+
+  const int vertexCount = mNativeMesh.vertices.count();
+  const int faceCount = mNativeMesh.faces.count();
+  cache->mPrefetchFuture = QtConcurrent::run( [cache, provider, nextIndex, vertexCount, faceCount]
+  {
+    const QgsMeshDatasetGroupMetadata metadata = provider->datasetGroupMetadata( nextIndex );
+    const bool dataOnVertices = metadata.dataType() == QgsMeshDatasetGroupMetadata::DataOnVertices;
+
+    QgsMeshDataBlock vals = provider->datasetValues(
+                              nextIndex,
+                              0,
+                              dataOnVertices ? vertexCount : faceCount );
+
+    const QVector<double> datasetValues = QgsMeshLayerUtils::calculateMagnitudes( vals );
+
+    const QgsMeshDataBlock activeFaceFlagValues = provider->areFacesActive(
+          nextIndex,
+          0,
+          faceCount );
+
+    const QgsMeshDatasetMetadata datasetMetadata = provider->datasetMetadata( nextIndex );
+
+    QMutexLocker locker( &cache->mPrefetchMutex );
+    cache->mPrefetchedScalarDatasetIndex = nextIndex;
+    cache->mPrefetchedScalarDatasetValues = datasetValues;
+    cache->mPrefetchedScalarActiveFaceFlagValues = activeFaceFlagValues;
+    cache->mPrefetchedScalarDataOnVertices = dataOnVertices;
+    cache->mPrefetchedScalarDatasetMinimum = datasetMetadata.minimum();
+    cache->mPrefetchedScalarDatasetMaximum = datasetMetadata.maximum();
+  } );
+}
+
 bool QgsMeshLayerRenderer::render()
 {
   renderScalarDataset();
@@ -338,7 +431,8 @@ void QgsMeshLayerRenderer::renderVectorDataset()
                                   mVectorDataOnVertices,
                                   mRendererSettings.vectorSettings( index.group() ),
                                   mContext,
-                                  mOutputSize );
+                                  mOutputSize,
+                                  mRendererCache );
 
   renderer.draw();
 }
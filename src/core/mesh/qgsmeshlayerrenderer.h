@@ -25,6 +25,9 @@ class QgsMeshLayer;
 #include <memory>
 #include <limits>
 
+#include <QFuture>
+#include <QMutex>
+
 #include "qgis.h"
 
 #include "qgsmaplayerrenderer.h"
@@ -33,6 +36,7 @@ class QgsMeshLayer;
 #include "qgsmeshlayer.h"
 #include "qgssymbol.h"
 #include "qgsmeshdataprovider.h"
+#include "qgsmeshvectorrenderer.h"
 
 class QgsRenderContext;
 
@@ -71,6 +75,33 @@ struct CORE_NO_EXPORT QgsMeshLayerRendererCache
   double mVectorDatasetGroupMagMinimum = std::numeric_limits<double>::quiet_NaN();
   double mVectorDatasetGroupMagMaximum = std::numeric_limits<double>::quiet_NaN();
   bool mVectorDataOnVertices = true;
+
+  // background prefetch of the scalar dataset expected to be activated next
+  // during time playback. The prefetched fields are guarded by mPrefetchMutex,
+  // and mPrefetchFuture must be waited on before any provider access, as the
+  // worker reads from the provider.
+  QMutex mPrefetchMutex;
+  QFuture<void> mPrefetchFuture;
+  QgsMeshDatasetIndex mPrefetchedScalarDatasetIndex;
+  QVector<double> mPrefetchedScalarDatasetValues;
+  QgsMeshDataBlock mPrefetchedScalarActiveFaceFlagValues;
+  bool mPrefetchedScalarDataOnVertices = true;
+  double mPrefetchedScalarDatasetMinimum = std::numeric_limits<double>::quiet_NaN();
+  double mPrefetchedScalarDatasetMaximum = std::numeric_limits<double>::quiet_NaN();
+
+  // cached seed points for vector arrows. The seeds depend only on the extent,
+  // transform and vector settings, so during timestep playback on a static mesh
+  // they are re-used and just the vector values are re-evaluated per frame.
+  // Guarded by mVectorSeedMutex.
+  QMutex mVectorSeedMutex;
+  QgsRectangle mVectorSeedExtent;
+  QSize mVectorSeedOutputSize;
+  double mVectorSeedRotation = 0;
+  bool mVectorSeedsOnVertices = true;
+  bool mVectorSeedsOnGrid = false;
+  QSize mVectorSeedGridCellSize;
+  int mVectorSeedMeshVertexCount = -1;
+  QVector<QgsMeshVectorSeedPoint> mVectorSeedPoints;
 };
 
 ///@endcond
@@ -98,6 +129,7 @@ class QgsMeshLayerRenderer : public QgsMapLayerRenderer
     void renderVectorDataset();
     void copyScalarDatasetValues( QgsMeshLayer *layer );
     void copyVectorDatasetValues( QgsMeshLayer *layer );
+    void prefetchNextScalarDataset( QgsMeshLayer *layer );
     void calculateOutputSize();
 
   protected:
@@ -126,6 +158,9 @@ class QgsMeshLayerRenderer : public QgsMapLayerRenderer
     double mVectorDatasetGroupMagMaximum = std::numeric_limits<double>::quiet_NaN();
     bool mVectorDataOnVertices = true;
 
+    // cache owned by the layer, outlives the renderer for the duration of the job
+    QgsMeshLayerRendererCache *mRendererCache = nullptr;
+
     // rendering context
     QgsRenderContext &mContext;
 
@@ -16,6 +16,7 @@
  ***************************************************************************/
 
 #include "qgsmeshvectorrenderer.h"
+#include "qgsmeshlayerrenderer.h"
 #include "qgsrendercontext.h"
 #include "qgscoordinatetransform.h"
 #include "qgsmaptopixel.h"
@@ -27,6 +28,7 @@
 #include <algorithm>
 #include <QPen>
 #include <QPainter>
+#include <QtConcurrentMap>
 #include <cmath>
 
 ///@cond PRIVATE
@@ -52,7 +54,8 @@ QgsMeshVectorRenderer::QgsMeshVectorRenderer( const QgsTriangularMesh &m,
     double datasetMagMaximumValue,
     bool dataIsOnVertices,
     const QgsMeshRendererVectorSettings &settings,
-    QgsRenderContext &context, QSize size )
+    QgsRenderContext &context, QSize size,
+    QgsMeshLayerRendererCache *cache )
   : mTriangularMesh( m )
   , mDatasetValues( datasetValues )
   , mDatasetValuesMag( datasetValuesMag )
@@ -63,6 +66,7 @@ QgsMeshVectorRenderer::QgsMeshVectorRenderer( const QgsTriangularMesh &m,
   , mDataOnVertices( dataIsOnVertices )
   , mOutputSize( size )
   , mBufferedExtent( context.extent() )
+  , mCache( cache )
 {
   // should be checked in caller
   Q_ASSERT( !mDatasetValuesMag.empty() );
@@ -101,18 +105,68 @@ void QgsMeshVectorRenderer::draw()
   pen.setColor( mCfg.color() );
   painter->setPen( pen );
 
-  const QList<int> trianglesInExtent = mTriangularMesh.faceIndexesForRectangle( mBufferedExtent );
+  // seed points depend only on the extent, transform and settings -- when just
+  // the timestep changed they are re-used from the cache and only the vector
+  // values need re-evaluation
+  QVector<QgsMeshVectorSeedPoint> seedPoints;
+  if ( !lookupSeedPoints( seedPoints ) )
+  {
+    const QList<int> trianglesInExtent = mTriangularMesh.faceIndexesForRectangle( mBufferedExtent );
 
-  if ( mCfg.isOnUserDefinedGrid() )
-    drawVectorDataOnGrid( trianglesInExtent );
-  else if ( mDataOnVertices )
-    drawVectorDataOnVertices( trianglesInExtent );
-  else
-    drawVectorDataOnFaces( trianglesInExtent );
+    if ( mCfg.isOnUserDefinedGrid() )
+      seedPoints = seedPointsOnGrid( trianglesInExtent );
+    else if ( mDataOnVertices )
+      seedPoints = seedPointsOnVertices( trianglesInExtent );
+    else
+      seedPoints = seedPointsOnFaces( trianglesInExtent );
+
+    if ( !mContext.renderingStopped() )
+      storeSeedPoints( seedPoints );
+  }
+
+  drawSeedPoints( seedPoints );
 
   painter->restore();
 }
 
+bool QgsMeshVectorRenderer::lookupSeedPoints( QVector<QgsMeshVectorSeedPoint> &seedPoints ) const
+{
+  if ( !mCache )
+    return false;
+
+  QMutexLocker locker( &mCache->mVectorSeedMutex );
+  if ( mCache->mVectorSeedExtent != mBufferedExtent ||
+       mCache->mVectorSeedOutputSize != mOutputSize ||
+       !qgsDoubleNear( mCache->mVectorSeedRotation, mContext.mapToPixel().mapRotation() ) ||
+       mCache->mVectorSeedsOnVertices != mDataOnVertices ||
+       mCache->mVectorSeedsOnGrid != mCfg.isOnUserDefinedGrid() ||
+       mCache->mVectorSeedMeshVertexCount != mTriangularMesh.vertices().count() )
+    return false;
+
+  if ( mCfg.isOnUserDefinedGrid() &&
+       mCache->mVectorSeedGridCellSize != QSize( mCfg.userGridCellWidth(), mCfg.userGridCellHeight() ) )
+    return false;
+
+  seedPoints = mCache->mVectorSeedPoints;
+  return true;
+}
+
+void QgsMeshVectorRenderer::storeSeedPoints( const QVector<QgsMeshVectorSeedPoint> &seedPoints )
+{
+  if ( !mCache )
+    return;
+
+  QMutexLocker locker( &mCache->mVectorSeedMutex );
+  mCache->mVectorSeedExtent = mBufferedExtent;
+  mCache->mVectorSeedOutputSize = mOutputSize;
+  mCache->mVectorSeedRotation = mContext.mapToPixel().mapRotation();
+  mCache->mVectorSeedsOnVertices = mDataOnVertices;
+  mCache->mVectorSeedsOnGrid = mCfg.isOnUserDefinedGrid();
+  mCache->mVectorSeedGridCellSize = QSize( mCfg.userGridCellWidth(), mCfg.userGridCellHeight() );
+  mCache->mVectorSeedMeshVertexCount = mTriangularMesh.vertices().count();
+  mCache->mVectorSeedPoints = seedPoints;
+}
+
 bool QgsMeshVectorRenderer::calcVectorLineEnd(
   QgsPointXY &lineEnd,
   double &vectorLength,
@@ -234,11 +288,12 @@ double QgsMeshVectorRenderer::calcExtentBufferSize() const
 }
 
 
-void QgsMeshVectorRenderer::drawVectorDataOnVertices( const QList<int> &trianglesInExtent )
+QVector<QgsMeshVectorSeedPoint> QgsMeshVectorRenderer::seedPointsOnVertices( const QList<int> &trianglesInExtent ) const
 {
   const QVector<QgsMeshVertex> &vertices = mTriangularMesh.vertices();
   const QVector<QgsMeshFace> &triangles = mTriangularMesh.triangles();
-  QSet<int> drawnVertices;
+  QSet<int> addedVertices;
+  QVector<QgsMeshVectorSeedPoint> seedPoints;
 
   // currently expecting that triangulation does not add any new extra vertices on the way
   Q_ASSERT( mDatasetValuesMag.count() == vertices.count() );
@@ -251,33 +306,29 @@ void QgsMeshVectorRenderer::drawVectorDataOnVertices( const QList<int> &triangle
     const QgsMeshFace triangle = triangles[triangleIndex];
     for ( int i : triangle )
     {
-      if ( drawnVertices.contains( i ) )
+      if ( addedVertices.contains( i ) )
         continue;
-      drawnVertices.insert( i );
+      addedVertices.insert( i );
 
       const QgsMeshVertex &vertex = vertices.at( i );
       if ( !mBufferedExtent.contains( vertex ) )
         continue;
 
-      const QgsMeshDatasetValue val = mDatasetValues.value( i );
-      double xVal = val.x();
-      double yVal = val.y();
-      if ( nodataValue( xVal, yVal ) )
-        continue;
-
-      double V = mDatasetValuesMag[i];  // pre-calculated magnitude
-      QgsPointXY lineStart = mContext.mapToPixel().transform( vertex.x(), vertex.y() );
-
-      drawVectorArrow( lineStart, xVal, yVal, V );
+      QgsMeshVectorSeedPoint seedPoint;
+      seedPoint.pixelPoint = mContext.mapToPixel().transform( vertex.x(), vertex.y() );
+      seedPoint.valueIndex = i;
+      seedPoints.append( seedPoint );
     }
   }
+  return seedPoints;
 }
 
-void QgsMeshVectorRenderer::drawVectorDataOnFaces( const QList<int> &trianglesInExtent )
+QVector<QgsMeshVectorSeedPoint> QgsMeshVectorRenderer::seedPointsOnFaces( const QList<int> &trianglesInExtent ) const
 {
   const QVector<QgsMeshVertex> &centroids = mTriangularMesh.centroids();
   const QList<int> nativeFacesInExtent = QgsMeshUtils::nativeFacesFromTriangles( trianglesInExtent,
                                          mTriangularMesh.trianglesToNativeFaces() );
+  QVector<QgsMeshVectorSeedPoint> seedPoints;
   for ( int i : nativeFacesInExtent )
   {
     if ( mContext.renderingStopped() )
@@ -287,32 +338,27 @@ void QgsMeshVectorRenderer::drawVectorDataOnFaces( const QList<int> &trianglesIn
     if ( !mBufferedExtent.contains( center ) )
       continue;
 
-    const QgsMeshDatasetValue val = mDatasetValues.value( i );
-    double xVal = val.x();
-    double yVal = val.y();
-    if ( nodataValue( xVal, yVal ) )
-      continue;
-
-    double V = mDatasetValuesMag[i];  // pre-calculated magnitude
-    QgsPointXY lineStart = mContext.mapToPixel().transform( center.x(), center.y() );
-
-    drawVectorArrow( lineStart, xVal, yVal, V );
+    QgsMeshVectorSeedPoint seedPoint;
+    seedPoint.pixelPoint = mContext.mapToPixel().transform( center.x(), center.y() );
+    seedPoint.valueIndex = i;
+    seedPoints.append( seedPoint );
   }
+  return seedPoints;
 }
 
-void QgsMeshVectorRenderer::drawVectorDataOnGrid( const QList<int> &trianglesInExtent )
+QVector<QgsMeshVectorSeedPoint> QgsMeshVectorRenderer::seedPointsOnGrid( const QList<int> &trianglesInExtent ) const
 {
-  int cellx = mCfg.userGridCellWidth();
-  int celly = mCfg.userGridCellHeight();
+  const int cellx = mCfg.userGridCellWidth();
+  const int celly = mCfg.userGridCellHeight();
 
   const QVector<QgsMeshFace> &triangles = mTriangularMesh.triangles();
   const QVector<QgsMeshVertex> &vertices = mTriangularMesh.vertices();
 
-  for ( const int i : trianglesInExtent )
+  // sampling the grid involves one bounding box + grid alignment calculation per
+  // triangle, independent of all other triangles, so fan the work out over the pool
+  auto seedPointsForTriangle = [&]( const int i ) -> QVector<QgsMeshVectorSeedPoint>
   {
-    if ( mContext.renderingStopped() )
-      break;
-
+    QVector<QgsMeshVectorSeedPoint> seedPoints;
     const QgsMeshFace &face = triangles[i];
 
     const int v1 = face[0], v2 = face[1], v3 = face[2];
@@ -339,57 +385,101 @@ void QgsMeshVectorRenderer::drawVectorDataOnGrid( const QList<int> &trianglesInE
     {
       for ( int x = left; x <= right; x += cellx )
       {
-        QgsMeshDatasetValue val;
-        const QgsPointXY p = mContext.mapToPixel().toMapCoordinates( x, y );
-
-        if ( mDataOnVertices )
-        {
-          const auto val1 = mDatasetValues.value( v1 );
-          const auto val2 = mDatasetValues.value( v2 );
-          const auto val3 = mDatasetValues.value( v3 );
-          val.setX(
-            QgsMeshLayerUtils::interpolateFromVerticesData(
-              p1, p2, p3,
-              val1.x(),
-              val2.x(),
-              val3.x(),
-              p )
-          );
-          val.setY(
-            QgsMeshLayerUtils::interpolateFromVerticesData(
-              p1, p2, p3,
-              val1.y(),
-              val2.y(),
-              val3.y(),
-              p )
-          );
-        }
-        else
-        {
-          const auto val1 = mDatasetValues.value( nativeFaceIndex );
-          val.setX(
-            QgsMeshLayerUtils::interpolateFromFacesData(
-              p1, p2, p3,
-              val1.x(),
-              p
-            )
-          );
-          val.setY(
-            QgsMeshLayerUtils::interpolateFromFacesData(
-              p1, p2, p3,
-              val1.y(),
-              p
-            )
-          );
-        }
-
-        if ( nodataValue( val.x(), val.y() ) )
-          continue;
-
-        QgsPointXY lineStart( x, y );
-        drawVectorArrow( lineStart, val.x(), val.y(), val.scalar() );
+        QgsMeshVectorSeedPoint seedPoint;
+        seedPoint.pixelPoint = QgsPointXY( x, y );
+        seedPoint.mapPoint = mContext.mapToPixel().toMapCoordinates( x, y );
+        seedPoint.valueIndex = nativeFaceIndex;
+        seedPoint.triangleIndex = i;
+        seedPoints.append( seedPoint );
       }
     }
+    return seedPoints;
+  };
+
+  const QList< QVector<QgsMeshVectorSeedPoint> > seedPointsPerTriangle =
+    QtConcurrent::blockingMapped( trianglesInExtent, seedPointsForTriangle );
+
+  QVector<QgsMeshVectorSeedPoint> seedPoints;
+  for ( const QVector<QgsMeshVectorSeedPoint> &triangleSeedPoints : seedPointsPerTriangle )
+    seedPoints += triangleSeedPoints;
+  return seedPoints;
+}
+
+QgsMeshDatasetValue QgsMeshVectorRenderer::seedPointValue( const QgsMeshVectorSeedPoint &seedPoint ) const
+{
+  if ( seedPoint.triangleIndex < 0 )
+    return mDatasetValues.value( seedPoint.valueIndex );
+
+  const QgsMeshFace &face = mTriangularMesh.triangles()[seedPoint.triangleIndex];
+  const QVector<QgsMeshVertex> &vertices = mTriangularMesh.vertices();
+  const int v1 = face[0], v2 = face[1], v3 = face[2];
+  const QgsPoint p1 = vertices[v1], p2 = vertices[v2], p3 = vertices[v3];
+
+  QgsMeshDatasetValue val;
+  if ( mDataOnVertices )
+  {
+    const auto val1 = mDatasetValues.value( v1 );
+    const auto val2 = mDatasetValues.value( v2 );
+    const auto val3 = mDatasetValues.value( v3 );
+    val.setX(
+      QgsMeshLayerUtils::interpolateFromVerticesData(
+        p1, p2, p3,
+        val1.x(),
+        val2.x(),
+        val3.x(),
+        seedPoint.mapPoint )
+    );
+    val.setY(
+      QgsMeshLayerUtils::interpolateFromVerticesData(
+        p1, p2, p3,
+        val1.y(),
+        val2.y(),
+        val3.y(),
+        seedPoint.mapPoint )
+    );
+  }
+  else
+  {
+    const auto val1 = mDatasetValues.value( seedPoint.valueIndex );
+    val.setX(
+      QgsMeshLayerUtils::interpolateFromFacesData(
+        p1, p2, p3,
+        val1.x(),
+        seedPoint.mapPoint
+      )
+    );
+    val.setY(
+      QgsMeshLayerUtils::interpolateFromFacesData(
+        p1, p2, p3,
+        val1.y(),
+        seedPoint.mapPoint
+      )
+    );
+  }
+  return val;
+}
+
+void QgsMeshVectorRenderer::drawSeedPoints( const QVector<QgsMeshVectorSeedPoint> &seedPoints )
+{
+  // only the vector values change between timesteps, so they are re-evaluated
+  // along the seed points in parallel before the serial painting pass
+  const QVector<QgsMeshDatasetValue> values =
+    QtConcurrent::blockingMapped( seedPoints, [this]( const QgsMeshVectorSeedPoint & seedPoint ) { return seedPointValue( seedPoint ); } );
+
+  for ( int i = 0; i < seedPoints.count(); ++i )
+  {
+    if ( mContext.renderingStopped() )
+      break;
+
+    const QgsMeshDatasetValue &val = values.at( i );
+    if ( nodataValue( val.x(), val.y() ) )
+      continue;
+
+    const QgsMeshVectorSeedPoint &seedPoint = seedPoints.at( i );
+    // for direct lookups re-use the pre-calculated magnitude
+    const double magnitude = seedPoint.triangleIndex < 0 ? mDatasetValuesMag[seedPoint.valueIndex] : val.scalar();
+
+    drawVectorArrow( seedPoint.pixelPoint, val.x(), val.y(), magnitude );
   }
 }
 
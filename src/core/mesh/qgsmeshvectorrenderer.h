@@ -31,9 +31,32 @@
 #include "qgspointxy.h"
 
 class QgsRenderContext;
+struct QgsMeshLayerRendererCache;
 
 ///@cond PRIVATE
 
+/**
+ * \ingroup core
+ *
+ * Seed point for a single vector arrow. The position and interpolation setup
+ * only depend on the extent, transform and grid settings, so seed points can be
+ * cached across frames and just the vector values re-evaluated per timestep.
+ *
+ * \note not available in Python bindings
+ * \since QGIS 3.8
+ */
+struct QgsMeshVectorSeedPoint
+{
+  //! Screen space start of the arrow
+  QgsPointXY pixelPoint;
+  //! Map space location, used to interpolate values on the user defined grid
+  QgsPointXY mapPoint;
+  //! Vertex or native face index for direct value lookup
+  int valueIndex = -1;
+  //! Triangle used to interpolate values on the user defined grid, -1 for direct lookup
+  int triangleIndex = -1;
+};
+
 /**
  * \ingroup core
  *
@@ -54,7 +77,8 @@ class QgsMeshVectorRenderer
                            bool dataIsOnVertices,
                            const QgsMeshRendererVectorSettings &settings,
                            QgsRenderContext &context,
-                           QSize size );
+                           QSize size,
+                           QgsMeshLayerRendererCache *cache = nullptr );
     //! Dtor
     ~QgsMeshVectorRenderer();
 
@@ -64,12 +88,20 @@ class QgsMeshVectorRenderer
     void draw();
 
   private:
-    //! Draws for data defined on vertices
-    void drawVectorDataOnVertices( const QList<int> &trianglesInExtent );
-    //! Draws for data defined on face centers
-    void drawVectorDataOnFaces( const QList<int> &trianglesInExtent );
-    //! Draws data on user-defined grid
-    void drawVectorDataOnGrid( const QList<int> &trianglesInExtent );
+    //! Calculates seed points for data defined on vertices
+    QVector<QgsMeshVectorSeedPoint> seedPointsOnVertices( const QList<int> &trianglesInExtent ) const;
+    //! Calculates seed points for data defined on face centers
+    QVector<QgsMeshVectorSeedPoint> seedPointsOnFaces( const QList<int> &trianglesInExtent ) const;
+    //! Calculates seed points on the user-defined grid, threaded over triangles
+    QVector<QgsMeshVectorSeedPoint> seedPointsOnGrid( const QList<int> &trianglesInExtent ) const;
+    //! Returns the cached seed points if they are still valid for this frame
+    bool lookupSeedPoints( QVector<QgsMeshVectorSeedPoint> &seedPoints ) const;
+    //! Stores freshly calculated seed points for re-use by following frames
+    void storeSeedPoints( const QVector<QgsMeshVectorSeedPoint> &seedPoints );
+    //! Evaluates the current vector value at a seed point
+    QgsMeshDatasetValue seedPointValue( const QgsMeshVectorSeedPoint &seedPoint ) const;
+    //! Re-evaluates vector values along the seed points in parallel and draws the arrows
+    void drawSeedPoints( const QVector<QgsMeshVectorSeedPoint> &seedPoints );
     //! Draws arrow from start point and vector data
     void drawVectorArrow( const QgsPointXY &lineStart, double xVal, double yVal, double magnitude );
     //! Calculates the end point of the arrow based on start point and vector data
@@ -101,6 +133,8 @@ class QgsMeshVectorRenderer
     bool mDataOnVertices = true;
     QSize mOutputSize;
     QgsRectangle mBufferedExtent;
+    //! Optional cross-frame cache owned by the layer, may be nullptr
+    QgsMeshLayerRendererCache *mCache = nullptr;
 };
 
 ///@endcond
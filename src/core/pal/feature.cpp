@@ -40,7 +40,9 @@
 #include "qgsmessagelog.h"
 #include "costcalculator.h"
 #include "qgsgeometryutils.h"
+#include <QCache>
 #include <QLinkedList>
+#include <QMutex>
 #include <cmath>
 #include <cfloat>
 
@@ -1142,6 +1144,41 @@ static LabelPosition *_createCurvedCandidate( LabelPosition *lp, double angle, d
   return newLp;
 }
 
+///@cond PRIVATE
+//! The placement of a single character of a curved label candidate
+struct CurvedCharacterPlacement
+{
+  double x = 0;
+  double y = 0;
+  double width = 0;
+  double height = 0;
+  double alpha = 0;
+  int partId = -1;
+};
+
+//! An undisplaced curved label candidate, independent of the FeaturePart which computed it
+struct CurvedCandidateChain
+{
+  QVector< CurvedCharacterPlacement > characters;
+  double cost = 0;
+  double angleAverage = 0;
+  bool reversed = false;
+};
+
+//! All curved candidates computed for one combination of path geometry and character metrics
+struct CurvedPlacementEntry
+{
+  QList< CurvedCandidateChain > chains;
+};
+///@endcond
+
+// Cache of computed curved label placements, shared by the labeling runs of
+// all render jobs. The key covers the path coordinates (in map units, so any
+// extent or scale change produces a different key) and the per character
+// metrics of the label text. The cost is measured in character placements.
+static QCache< QString, CurvedPlacementEntry > sCurvedPlacementCache( 100000 );
+static QMutex sCurvedPlacementCacheMutex;
+
 int FeaturePart::createCurvedCandidatesAlongLine( QList< LabelPosition * > &lPos, PointSet *mapShape )
 {
   LabelInfo *li = mLF->curvedLabelInfo();
@@ -1172,15 +1209,43 @@ int FeaturePart::createCurvedCandidatesAlongLine( QList< LabelPosition * > &lPos
     return 0;
   }
 
-  QLinkedList<LabelPosition *> positions;
   double delta = std::max( li->label_height, total_distance / mLF->layer()->pal->line_p );
 
   unsigned long flags = mLF->layer()->arrangementFlags();
   if ( flags == 0 )
     flags = FLAG_ON_LINE; // default flag
 
+  // the undisplaced candidate chains depend only on the path geometry, the
+  // character metrics and the arrangement settings, all of which the cache
+  // key covers -- label distance, cost additions and permissible zone tests
+  // are applied per feature afterwards
+  const int coordBytes = mapShape->nbPoints * static_cast< int >( sizeof( double ) );
+  const uint pathHash = qHash( QByteArray::fromRawData( reinterpret_cast< const char * >( mapShape->x ), coordBytes ) )
+                        ^ ( qHash( QByteArray::fromRawData( reinterpret_cast< const char * >( mapShape->y ), coordBytes ) ) << 1 );
+  const uint charHash = qHash( QByteArray::fromRawData( reinterpret_cast< const char * >( li->char_info ), li->char_num * static_cast< int >( sizeof( LabelInfo::CharacterInfo ) ) ) );
+  const QString cacheKey = QStringLiteral( "%1:%2:%3:%4:%5:%6:%7:%8" )
+                           .arg( pathHash )
+                           .arg( charHash )
+                           .arg( li->label_height )
+                           .arg( li->max_char_angle_inside )
+                           .arg( li->max_char_angle_outside )
+                           .arg( delta )
+                           .arg( flags )
+                           .arg( showUprightLabels() ? 1 : 0 );
+
+  CurvedPlacementEntry entry;
+  bool fromCache = false;
+  sCurvedPlacementCacheMutex.lock();
+  if ( const CurvedPlacementEntry *cached = sCurvedPlacementCache.object( cacheKey ) )
+  {
+    // copied out under the mutex, as the cache may evict concurrently
+    entry = *cached;
+    fromCache = true;
+  }
+  sCurvedPlacementCacheMutex.unlock();
+
   // generate curved labels
-  for ( double i = 0; i < total_distance; i += delta )
+  for ( double i = 0; !fromCache && i < total_distance; i += delta )
   {
     bool flip = false;
     // placements may need to be reversed if using map orientation and the line has right-to-left direction
@@ -1241,11 +1306,64 @@ int FeaturePart::createCurvedCandidatesAlongLine( QList< LabelPosition * > &lPos
     double labelCenter = i + getLabelWidth() / 2;
     double costCenter = std::fabs( total_distance / 2 - labelCenter ) / total_distance; // <0, 0.5>
     cost += costCenter / 1000;  // < 0, 0.0005 >
-    slp->setCost( cost );
 
     // average angle is calculated with respect to periodicity of angles
     double angle_avg = std::atan2( sin_avg / li->char_num, cos_avg / li->char_num );
-    bool localreversed = flip ? !reversed : reversed;
+
+    CurvedCandidateChain chain;
+    chain.cost = cost;
+    chain.angleAverage = angle_avg;
+    chain.reversed = flip ? !reversed : reversed;
+    chain.characters.reserve( li->char_num );
+    for ( LabelPosition *part = slp; part; part = part->getNextPart() )
+    {
+      CurvedCharacterPlacement character;
+      character.x = part->getX();
+      character.y = part->getY();
+      character.width = part->getWidth();
+      character.height = part->getHeight();
+      character.alpha = part->getAlpha();
+      character.partId = part->getPartId();
+      chain.characters << character;
+    }
+    entry.chains << chain;
+
+    // delete original candidate
+    delete slp;
+  }
+
+  if ( !fromCache )
+  {
+    int placements = 0;
+    for ( const CurvedCandidateChain &chain : qgis::as_const( entry.chains ) )
+      placements += chain.characters.size();
+    sCurvedPlacementCacheMutex.lock();
+    sCurvedPlacementCache.insert( cacheKey, new CurvedPlacementEntry( entry ), placements + 1 );
+    sCurvedPlacementCacheMutex.unlock();
+  }
+
+  QLinkedList<LabelPosition *> positions;
+  for ( const CurvedCandidateChain &chain : qgis::as_const( entry.chains ) )
+  {
+    // rebuild the undisplaced candidate chain
+    LabelPosition *slp = nullptr;
+    LabelPosition *slpTmp = nullptr;
+    for ( const CurvedCharacterPlacement &character : chain.characters )
+    {
+      LabelPosition *tmp = new LabelPosition( 0, character.x, character.y, character.width, character.height, character.alpha, 0.0001, this );
+      tmp->setPartId( character.partId );
+      if ( !slp )
+        slp = tmp;
+      else
+        slpTmp->setNextPart( tmp );
+      slpTmp = tmp;
+    }
+    if ( !slp )
+      continue;
+
+    slp->setCost( chain.cost );
+    double angle_avg = chain.angleAverage;
+    bool localreversed = chain.reversed;
     // displacement - we loop through 3 times, generating above, online then below line placements successively
     for ( int i = 0; i <= 2; ++i )
     {
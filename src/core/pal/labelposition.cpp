@@ -274,6 +274,16 @@ bool LabelPosition::isInConflict( LabelPosition *lp )
 
 bool LabelPosition::isInConflictSinglePart( LabelPosition *lp )
 {
+  // cheap path for the common case of two axis-aligned rectangular candidates -
+  // the exact GEOS test below degenerates to a bounding box overlap test anyway,
+  // and skipping the GEOS call (and lazy geometry creation) dominates dense point
+  // labeling runs
+  if ( qgsDoubleNear( alpha, 0 ) && qgsDoubleNear( lp->alpha, 0 )
+       && nbPoints == 4 && lp->nbPoints == 4 )
+  {
+    return !( xmax < lp->xmin || xmin > lp->xmax || ymax < lp->ymin || ymin > lp->ymax );
+  }
+
   if ( !mGeos )
     createGeosGeom();
 
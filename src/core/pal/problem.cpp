@@ -42,6 +42,7 @@
 #include <limits> //for std::numeric_limits<int>::max()
 
 #include "qgslabelingengine.h"
+#include "qgstraceprofiler.h"
 
 using namespace pal;
 
@@ -2117,6 +2118,7 @@ bool nokCallback( LabelPosition *lp, void *context )
 
 void Problem::chain_search()
 {
+  QGS_TRACE_ZONE( "pal chain search" );
 
   if ( nbft == 0 )
     return;
@@ -2146,6 +2148,14 @@ void Problem::chain_search()
   //check_solution();
   solution_cost();
 
+  // if no conflicts between candidates remain after reduction, the greedy
+  // initial solution is already optimal and the chain moves cannot improve it
+  if ( nbOverlap == 0 )
+  {
+    delete[] ok;
+    return;
+  }
+
   int iter = 0;
 
   while ( true )
@@ -26,9 +26,12 @@
 #include "qgsapplication.h"
 #include "qgsprocessingparametertype.h"
 #include "qgsexpressioncontextutils.h"
+#include "qgssettings.h"
 
 #include <QFile>
 #include <QTextStream>
+#include <QThread>
+#include <QtConcurrentMap>
 
 ///@cond NOT_STABLE
 
@@ -252,9 +255,155 @@ QVariantMap QgsProcessingModelAlgorithm::processAlgorithm( const QVariantMap &pa
   QVariantMap finalResults;
   QSet< QString > executed;
   bool executedAlg = true;
+  // opt-in: run independent branches of the dependency graph concurrently. Each child
+  // gets a private thread safe context, and the results are merged back into the model
+  // context once a wave of children has completed.
+  const bool parallelExecutionEnabled = QgsSettings().value( QStringLiteral( "qgis/parallelModelExecution" ), false ).toBool();
   while ( executedAlg && executed.count() < toExecute.count() )
   {
     executedAlg = false;
+
+    if ( parallelExecutionEnabled )
+    {
+      // collect all children whose dependencies have been satisfied and which are safe
+      // to run away from the model's thread
+      QStringList readyChildren;
+      Q_FOREACH ( const QString &childId, toExecute )
+      {
+        if ( executed.contains( childId ) )
+          continue;
+
+        bool canExecute = true;
+        Q_FOREACH ( const QString &dependency, dependsOnChildAlgorithms( childId ) )
+        {
+          if ( !executed.contains( dependency ) )
+          {
+            canExecute = false;
+            break;
+          }
+        }
+        if ( !canExecute )
+          continue;
+
+        if ( mChildAlgorithms[ childId ].algorithm()->flags() & QgsProcessingAlgorithm::FlagNoThreading )
+          continue; // leave for the serial path below
+
+        readyChildren << childId;
+      }
+
+      if ( readyChildren.count() > 1 && !( feedback && feedback->isCanceled() ) )
+      {
+        executedAlg = true;
+
+        struct ChildRun
+        {
+          QString childId;
+          const QgsProcessingModelChildAlgorithm *child = nullptr;
+          QgsExpressionContext expContext;
+          QVariantMap childParams;
+          QVariantMap results;
+          std::unique_ptr< QgsProcessingContext > childContext;
+          double seconds = 0;
+          bool ok = false;
+        };
+
+        if ( feedback )
+          feedback->pushDebugInfo( QObject::tr( "Running %1 independent algorithms in parallel" ).arg( readyChildren.count() ) );
+
+        // all parameter evaluation happens here on the model's thread, so the workers
+        // only ever touch their private contexts
+        std::vector< std::unique_ptr< ChildRun > > runs;
+        Q_FOREACH ( const QString &childId, readyChildren )
+        {
+          if ( feedback )
+            feedback->pushDebugInfo( QObject::tr( "Prepare algorithm: %1" ).arg( childId ) );
+
+          const QgsProcessingModelChildAlgorithm &child = mChildAlgorithms[ childId ];
+
+          std::unique_ptr< ChildRun > run = qgis::make_unique< ChildRun >();
+          run->childId = childId;
+          run->child = &child;
+          run->expContext = baseContext;
+          run->expContext << QgsExpressionContextUtils::processingAlgorithmScope( child.algorithm(), parameters, context )
+                          << createExpressionContextScopeForChildAlgorithm( childId, context, parameters, childResults );
+          run->childParams = parametersForChildAlgorithm( child, parameters, childResults, run->expContext );
+
+          if ( feedback )
+          {
+            QStringList params;
+            for ( auto childParamIt = run->childParams.constBegin(); childParamIt != run->childParams.constEnd(); ++childParamIt )
+            {
+              params << QStringLiteral( "%1: %2" ).arg( childParamIt.key(),
+                     child.algorithm()->parameterDefinition( childParamIt.key() )->valueAsPythonString( childParamIt.value(), context ) );
+            }
+            feedback->pushInfo( QObject::tr( "Input Parameters (%1):" ).arg( child.description() ) );
+            feedback->pushCommandInfo( QStringLiteral( "{ %1 }" ).arg( params.join( QStringLiteral( ", " ) ) ) );
+          }
+
+          runs.push_back( std::move( run ) );
+        }
+
+        if ( feedback )
+          feedback->setProgressText( QObject::tr( "Running %1 algorithms in parallel [%2/%3]" ).arg( runs.size() ).arg( executed.count() + 1 ).arg( toExecute.count() ) );
+
+        QThread *modelThread = QThread::currentThread();
+        QtConcurrent::blockingMap( runs.begin(), runs.end(), [&context, &modelFeedback, modelThread]( std::unique_ptr< ChildRun > &run )
+        {
+          if ( modelFeedback.isCanceled() )
+            return;
+
+          QTime childTime;
+          childTime.start();
+
+          run->childContext.reset( new QgsProcessingContext() );
+          run->childContext->copyThreadSafeSettings( context );
+          run->childContext->setExpressionContext( run->expContext );
+
+          run->results = run->child->algorithm()->run( run->childParams, *run->childContext, &modelFeedback, &run->ok, run->child->configuration() );
+          run->seconds = childTime.elapsed() / 1000.0;
+
+          // results are collected by the model's thread below
+          run->childContext->pushToThread( modelThread );
+        } );
+
+        // merge the temporary layers of every child back into the model context, even
+        // for failed children, so nothing is leaked when we throw below
+        for ( std::unique_ptr< ChildRun > &run : runs )
+        {
+          if ( run->childContext )
+            context.takeResultsFrom( *run->childContext );
+        }
+
+        if ( feedback && feedback->isCanceled() )
+          break;
+
+        for ( std::unique_ptr< ChildRun > &run : runs )
+        {
+          if ( !run->ok )
+          {
+            QString error = QObject::tr( "Error encountered while running %1" ).arg( run->child->description() );
+            if ( feedback )
+              feedback->reportError( error );
+            throw QgsProcessingException( error );
+          }
+          childResults.insert( run->childId, run->results );
+
+          QMap<QString, QgsProcessingModelOutput> outputs = run->child->modelOutputs();
+          QMap<QString, QgsProcessingModelOutput>::const_iterator outputIt = outputs.constBegin();
+          for ( ; outputIt != outputs.constEnd(); ++outputIt )
+          {
+            finalResults.insert( run->childId + ':' + outputIt->name(), run->results.value( outputIt->childOutputName() ) );
+          }
+
+          executed.insert( run->childId );
+          if ( feedback )
+            feedback->pushInfo( QObject::tr( "OK. %1 took %2 s (%3 outputs)." ).arg( run->child->description() ).arg( run->seconds ).arg( run->results.count() ) );
+        }
+        modelFeedback.setCurrentStep( executed.count() );
+        continue;
+      }
+    }
+
     Q_FOREACH ( const QString &childId, toExecute )
     {
       if ( feedback && feedback->isCanceled() )
@@ -29,6 +29,10 @@
 #include "qgsprocessingfeedback.h"
 #include "qgsmeshlayer.h"
 #include "qgsexpressioncontextutils.h"
+#include "qgssettings.h"
+
+#include <QMutex>
+#include <QtConcurrentMap>
 
 
 QgsProcessingAlgorithm::~QgsProcessingAlgorithm()
@@ -888,6 +892,16 @@ QVariantMap QgsProcessingFeatureBasedAlgorithm::processAlgorithm( const QVariant
   if ( !sink )
     throw QgsProcessingException( invalidSinkError( parameters, QStringLiteral( "OUTPUT" ) ) );
 
+  // optionally queue writes through a background thread, so sink I/O overlaps with
+  // per-feature processing instead of serializing with it
+  std::unique_ptr< QgsQueuedFeatureSink > queuedSink;
+  QgsFeatureSink *outputSink = sink.get();
+  if ( QgsSettings().value( QStringLiteral( "qgis/processingBackgroundSinkWrites" ), false ).toBool() )
+  {
+    queuedSink.reset( new QgsQueuedFeatureSink( sink.get() ) );
+    outputSink = queuedSink.get();
+  }
+
   // prepare expression context for feature iteration
   QgsExpressionContext prevContext = context.expressionContext();
   QgsExpressionContext algContext = prevContext;
@@ -902,22 +916,92 @@ QVariantMap QgsProcessingFeatureBasedAlgorithm::processAlgorithm( const QVariant
 
   double step = count > 0 ? 100.0 / count : 1;
   int current = 0;
-  while ( it.nextFeature( f ) )
+
+  const bool parallel = ( flags() & FlagThreadSafeFeatureProcessing )
+                        && QgsSettings().value( QStringLiteral( "qgis/parallelFeatureProcessing" ), false ).toBool();
+  if ( parallel )
   {
-    if ( feedback->isCanceled() )
+    // provider iteration stays serial - only the processFeature() calls are fanned out
+    // across the thread pool. Batches are merged back in source order, so the output
+    // order matches the serial path.
+    const int batchSize = 1000;
+    QMutex errorMutex;
+    QString processError;
+
+    QVector< QgsFeature > batch;
+    batch.reserve( batchSize );
+    bool sourceExhausted = false;
+    while ( !sourceExhausted && !feedback->isCanceled() )
     {
-      break;
+      batch.clear();
+      QgsFeature inFeature;
+      while ( batch.count() < batchSize )
+      {
+        if ( !it.nextFeature( inFeature ) )
+        {
+          sourceExhausted = true;
+          break;
+        }
+        batch.append( inFeature );
+      }
+      if ( batch.empty() )
+        break;
+
+      // QgsProcessingException is not a QException, so it cannot cross the
+      // QtConcurrent boundary - catch it in the worker and rethrow below
+      const QVector< QgsFeatureList > results = QtConcurrent::blockingMapped( batch, [this, &context, feedback, &errorMutex, &processError]( const QgsFeature & feature ) -> QgsFeatureList
+      {
+        if ( feedback->isCanceled() )
+          return QgsFeatureList();
+
+        try
+        {
+          return processFeature( feature, context, feedback );
+        }
+        catch ( QgsProcessingException &e )
+        {
+          QMutexLocker locker( &errorMutex );
+          if ( processError.isEmpty() )
+            processError = e.what();
+          return QgsFeatureList();
+        }
+      } );
+
+      if ( !processError.isEmpty() )
+        throw QgsProcessingException( processError );
+
+      for ( const QgsFeatureList &transformed : results )
+      {
+        for ( QgsFeature transformedFeature : transformed )
+          outputSink->addFeature( transformedFeature, QgsFeatureSink::FastInsert );
+      }
+
+      current += batch.count();
+      feedback->setProgress( current * step );
     }
+  }
+  else
+  {
+    while ( it.nextFeature( f ) )
+    {
+      if ( feedback->isCanceled() )
+      {
+        break;
+      }
 
-    context.expressionContext().setFeature( f );
-    const QgsFeatureList transformed = processFeature( f, context, feedback );
-    for ( QgsFeature transformedFeature : transformed )
-      sink->addFeature( transformedFeature, QgsFeatureSink::FastInsert );
+      context.expressionContext().setFeature( f );
+      const QgsFeatureList transformed = processFeature( f, context, feedback );
+      for ( QgsFeature transformedFeature : transformed )
+        outputSink->addFeature( transformedFeature, QgsFeatureSink::FastInsert );
 
-    feedback->setProgress( current * step );
-    current++;
+      feedback->setProgress( current * step );
+      current++;
+    }
   }
 
+  if ( queuedSink && !queuedSink->flushBuffer() )
+    throw QgsProcessingException( QObject::tr( "Error writing features to %1" ).arg( dest ) );
+
   mSource.reset();
 
   // probably not necessary - context's aren't usually recycled, but can't hurt
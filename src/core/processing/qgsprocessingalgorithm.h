@@ -76,6 +76,7 @@ class CORE_EXPORT QgsProcessingAlgorithm
       FlagDisplayNameIsLiteral = 1 << 7, //!< Algorithm's display name is a static literal string, and should not be translated or automatically formatted. For use with algorithms named after commands, e.g. GRASS 'v.in.ogr'.
       FlagSupportsInPlaceEdits = 1 << 8, //!< Algorithm supports in-place editing
       FlagKnownIssues = 1 << 9, //!< Algorithm has known issues
+      FlagThreadSafeFeatureProcessing = 1 << 10, //!< A feature based algorithm's processFeature() implementation is thread safe and may be invoked concurrently for different features. Implementations must not rely on the feature set in the context's expression context, which is not updated per feature when processing in parallel. \since QGIS 3.8
       FlagDeprecated = FlagHideFromToolbox | FlagHideFromModeler, //!< Algorithm is deprecated
     };
     Q_DECLARE_FLAGS( Flags, Flag )
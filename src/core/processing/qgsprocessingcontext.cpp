@@ -78,7 +78,11 @@ void QgsProcessingContext::setInvalidGeometryCheck( QgsFeatureRequest::InvalidGe
 
 void QgsProcessingContext::takeResultsFrom( QgsProcessingContext &context )
 {
-  setLayersToLoadOnCompletion( context.mLayersToLoadOnCompletion );
+  // merge, don't replace -- this context may already hold results taken from other contexts
+  for ( auto it = context.mLayersToLoadOnCompletion.constBegin(); it != context.mLayersToLoadOnCompletion.constEnd(); ++it )
+  {
+    addLayerToLoadOnCompletion( it.key(), it.value() );
+  }
   context.mLayersToLoadOnCompletion.clear();
   tempLayerStore.transferLayersFromStore( context.temporaryLayerStore() );
 }
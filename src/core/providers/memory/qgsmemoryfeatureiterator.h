@@ -31,6 +31,13 @@ typedef QMap<QgsFeatureId, QgsFeature> QgsFeatureMap;
 class QgsSpatialIndex;
 
 
+/**
+ * Feature source for the memory provider.
+ *
+ * Construction takes an O(1) snapshot of the provider's feature map and spatial
+ * index through Qt's implicit sharing, so iterators stay stable (and are cheap
+ * to create) while the provider continues to be edited.
+ */
 class QgsMemoryFeatureSource : public QgsAbstractFeatureSource
 {
   public:
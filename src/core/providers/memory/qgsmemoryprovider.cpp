@@ -197,7 +197,11 @@ QgsMemoryProvider::QgsMemoryProvider( const QString &uri, const ProviderOptions
     addAttributes( attributes );
   }
 
-  if ( url.hasQueryItem( QStringLiteral( "index" ) ) && url.queryItemValue( QStringLiteral( "index" ) ) == QLatin1String( "yes" ) )
+  // a spatial index is always maintained for layers with geometry: it is kept up to
+  // date incrementally by the editing methods, so there is never a blocking index
+  // build against a populated layer, and every rectangle request benefits from it.
+  // The "index" uri option is still accepted for compatibility with older uris.
+  if ( mWkbType != QgsWkbTypes::NoGeometry )
   {
     createSpatialIndex();
   }
@@ -381,7 +385,7 @@ bool QgsMemoryProvider::addFeatures( QgsFeatureList &flist, Flags )
       {
         attributes.append( QVariant( mFields.at( i ).type() ) );
       }
-      it->setAttributes( attributes );
+      it->setAttributes( std::move( attributes ) );
     }
     else if ( it->attributes().count() > fieldCount )
     {
@@ -389,7 +393,7 @@ bool QgsMemoryProvider::addFeatures( QgsFeatureList &flist, Flags )
       pushError( tr( "Feature has too many attributes (expecting %1, received %2)" ).arg( fieldCount ).arg( it->attributes().count() ) );
       QgsAttributes attributes = it->attributes();
       attributes.resize( mFields.count() );
-      it->setAttributes( attributes );
+      it->setAttributes( std::move( attributes ) );
     }
 
     if ( it->hasGeometry() && mWkbType == QgsWkbTypes::NoGeometry )
@@ -441,7 +445,8 @@ bool QgsMemoryProvider::deleteFeatures( const QgsFeatureIds &id )
     mFeatures.erase( fit );
   }
 
-  updateExtents();
+  // deleting features may shrink the extent, so force a recalculation
+  mExtent.setMinimal();
   clearMinMaxCache();
 
   return true;
@@ -565,7 +570,8 @@ bool QgsMemoryProvider::changeGeometryValues( const QgsGeometryMap &geometry_map
       mSpatialIndex->addFeature( *fit );
   }
 
-  updateExtents();
+  // a moved geometry may shrink the extent, so force a recalculation
+  mExtent.setMinimal();
 
   return true;
 }
@@ -622,6 +628,16 @@ QgsVectorDataProvider::Capabilities QgsMemoryProvider::capabilities() const
 bool QgsMemoryProvider::truncate()
 {
   mFeatures.clear();
+
+  // start over with an empty index rather than deleting the features from the
+  // existing one -- feature sources snapshot the index by copy, so the old index
+  // may still be in use by iterators
+  if ( mSpatialIndex )
+  {
+    delete mSpatialIndex;
+    mSpatialIndex = new QgsSpatialIndex();
+  }
+
   clearMinMaxCache();
   mExtent.setMinimal();
   return true;
@@ -629,7 +645,12 @@ bool QgsMemoryProvider::truncate()
 
 void QgsMemoryProvider::updateExtents()
 {
-  mExtent.setMinimal();
+  // the extent is maintained incrementally as features are added, and is
+  // invalidated internally by the operations which may shrink it (deleting
+  // features, changing geometries, subset changes). Resetting it here would
+  // force a scan over all features on every call -- for layers receiving a
+  // steady stream of appended features (live GPS tracks) that scan used to
+  // run on each repaint, making appends quadratic over the layer lifetime.
 }
 
 QString QgsMemoryProvider::name() const
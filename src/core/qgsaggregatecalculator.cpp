@@ -20,6 +20,7 @@
 #include "qgsfeaturerequest.h"
 #include "qgsfeatureiterator.h"
 #include "qgsgeometry.h"
+#include "qgsvectordataprovider.h"
 #include "qgsvectorlayer.h"
 
 
@@ -114,6 +115,51 @@ QVariant QgsAggregateCalculator::calculate( QgsAggregateCalculator::Aggregate ag
     resultType = mLayer->fields().at( attrNum ).type();
   }
 
+  // If a plain provider field of a non-edited layer is aggregated with a numeric statistic
+  // and no filter is set, fetch the attribute as a contiguous column of doubles instead of
+  // iterating features -- this skips the QgsFeature/QVariant construction per feature.
+  if ( !expression && mFilterExpression.isEmpty()
+       && mLayer->fields().fieldOrigin( attrNum ) == QgsFields::OriginProvider
+       && !mLayer->editBuffer() && mLayer->dataProvider() )
+  {
+    switch ( resultType )
+    {
+      case QVariant::Int:
+      case QVariant::UInt:
+      case QVariant::LongLong:
+      case QVariant::ULongLong:
+      case QVariant::Double:
+      {
+        bool statOk = false;
+        QgsStatisticalSummary::Statistic stat = numericStatFromAggregate( aggregate, &statOk );
+        if ( !statOk )
+          break; // e.g. array_agg -- let the iterator based path handle it
+
+        QVector<double> values;
+        long long nullCount = 0;
+        if ( mLayer->dataProvider()->fetchNumericColumn( mLayer->fields().fieldOriginIndex( attrNum ), values, nullCount ) )
+        {
+          if ( ok )
+            *ok = true;
+
+          if ( stat == QgsStatisticalSummary::CountMissing )
+            return static_cast< qlonglong >( nullCount );
+
+          QgsStatisticalSummary s( stat );
+          for ( double value : qgis::as_const( values ) )
+            s.addValue( value );
+          s.finalize();
+          double val = s.statistic( stat );
+          return std::isnan( val ) ? QVariant() : val;
+        }
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
+
   QgsFeatureIterator fit = mLayer->getFeatures( request );
   return calculate( aggregate, fit, resultType, attrNum, expression.get(), mDelimiter, context, ok );
 }
@@ -1191,6 +1191,9 @@ void QgsApplication::exitQgis()
 
   delete QgsProviderRegistry::instance();
 
+  // persist the resolved CRS definitions for the next run
+  QgsCoordinateReferenceSystem::saveDefinitionCache();
+
   // invalidate coordinate cache while the PROJ context held by the thread-locale
   // QgsProjContextStore object is still alive. Otherwise if this later object
   // is destroyed before the static variables of the cache, we might use freed memory.
@@ -575,6 +575,11 @@ QgsAuxiliaryLayer *QgsAuxiliaryStorage::createAuxiliaryLayer( const QgsField &fi
         return alayer;
       }
     }
+    else
+    {
+      // tables from older databases may predate the index on the join key
+      createIndex( table, database.get() );
+    }
 
     alayer = new QgsAuxiliaryLayer( field.name(), currentFileName(), table, layer );
     alayer->startEditing();
@@ -705,9 +710,21 @@ bool QgsAuxiliaryStorage::createTable( const QString &type, const QString &table
   if ( !exec( sql, handler ) )
     return false;
 
+  if ( !createIndex( table, handler ) )
+    return false;
+
   return true;
 }
 
+bool QgsAuxiliaryStorage::createIndex( const QString &table, sqlite3 *handler )
+{
+  // joined rendering and upserts look features up by the join key, so they must
+  // not fall back to full table scans
+  const QString sql = QStringLiteral( "CREATE INDEX IF NOT EXISTS 'idx_%1_%2' ON '%1' ( '%2' )" ).arg( table, AS_JOINFIELD );
+
+  return exec( sql, handler );
+}
+
 spatialite_database_unique_ptr QgsAuxiliaryStorage::createDB( const QString &filename )
 {
   spatialite_database_unique_ptr database;
@@ -0,0 +1,154 @@
+/***************************************************************************
+    qgscachebudgetmanager.cpp
+    -------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgscachebudgetmanager.h"
+
+#include "qgslogger.h"
+#include "qgssettings.h"
+
+// how often the budget is redistributed between the registered caches
+const int REDISTRIBUTE_INTERVAL_MS = 60000;
+
+QgsCacheBudgetManager *QgsCacheBudgetManager::instance()
+{
+  // deliberately leaked, so that caches unregistering from static destructors
+  // never race against the manager's own destruction
+  static QgsCacheBudgetManager *sInstance = new QgsCacheBudgetManager();
+  return sInstance;
+}
+
+QgsCacheBudgetManager::QgsCacheBudgetManager( QObject *parent )
+  : QObject( parent )
+{
+  connect( &mRedistributeTimer, &QTimer::timeout, this, &QgsCacheBudgetManager::redistribute );
+  mRedistributeTimer.start( REDISTRIBUTE_INTERVAL_MS );
+}
+
+int QgsCacheBudgetManager::registerCache( const QString &name,
+    const std::function< qint64() > &currentCost,
+    const std::function< void ( qint64 maximumCost ) > &setMaximumCost )
+{
+  QMutexLocker locker( &mMutex );
+  const int handle = mNextHandle++;
+  RegisteredCache cache;
+  cache.name = name;
+  cache.currentCost = currentCost;
+  cache.setMaximumCost = setMaximumCost;
+  mCaches.insert( handle, cache );
+  return handle;
+}
+
+void QgsCacheBudgetManager::unregisterCache( int handle )
+{
+  QMutexLocker locker( &mMutex );
+  mCaches.remove( handle );
+}
+
+void QgsCacheBudgetManager::recordHit( int handle )
+{
+  QMutexLocker locker( &mMutex );
+  auto it = mCaches.find( handle );
+  if ( it != mCaches.end() )
+    it->hits++;
+}
+
+void QgsCacheBudgetManager::recordMiss( int handle )
+{
+  QMutexLocker locker( &mMutex );
+  auto it = mCaches.find( handle );
+  if ( it != mCaches.end() )
+    it->misses++;
+}
+
+qint64 QgsCacheBudgetManager::budget() const
+{
+  return QgsSettings().value( QStringLiteral( "cache/globalCacheBudgetMB" ), 0 ).toLongLong() * 1024 * 1024;
+}
+
+void QgsCacheBudgetManager::redistribute()
+{
+  const qint64 totalBudget = budget();
+
+  // take a snapshot of the callbacks, so that the (potentially slow) eviction
+  // work runs without holding the manager's mutex
+  QList< int > handles;
+  QList< RegisteredCache > caches;
+  qint64 totalWeight = 0;
+  {
+    QMutexLocker locker( &mMutex );
+    if ( totalBudget <= 0 || mCaches.isEmpty() )
+      return;
+
+    for ( auto it = mCaches.begin(); it != mCaches.end(); ++it )
+    {
+      handles << it.key();
+      caches << it.value();
+      // the +1 guarantees every cache a nonzero share even before its first hit
+      totalWeight += it->hits + 1;
+      // age the counters so the weights track recent usage, not all-time usage
+      it->hits /= 2;
+      it->misses /= 2;
+    }
+  }
+
+  for ( int i = 0; i < caches.count(); i++ )
+  {
+    const qint64 allocated = totalBudget * ( caches.at( i ).hits + 1 ) / totalWeight;
+    caches.at( i ).setMaximumCost( allocated );
+
+    QMutexLocker locker( &mMutex );
+    auto it = mCaches.find( handles.at( i ) );
+    if ( it != mCaches.end() )
+      it->allocatedCost = allocated;
+  }
+
+  QgsDebugMsgLevel( QStringLiteral( "Redistributed cache budget of %1 bytes between %2 caches" ).arg( totalBudget ).arg( caches.count() ), 3 );
+}
+
+QList< QgsCacheBudgetManager::CacheStatistics > QgsCacheBudgetManager::statistics() const
+{
+  // snapshot the cost callbacks first -- invoking them takes the caches' own
+  // locks, which must not nest inside the manager's mutex
+  QList< int > handles;
+  QList< std::function< qint64() > > costCallbacks;
+  {
+    QMutexLocker locker( &mMutex );
+    for ( auto it = mCaches.constBegin(); it != mCaches.constEnd(); ++it )
+    {
+      handles << it.key();
+      costCallbacks << it->currentCost;
+    }
+  }
+
+  QList< CacheStatistics > result;
+  for ( int i = 0; i < handles.count(); i++ )
+  {
+    const qint64 cost = costCallbacks.at( i )();
+
+    QMutexLocker locker( &mMutex );
+    const auto it = mCaches.constFind( handles.at( i ) );
+    if ( it == mCaches.constEnd() )
+      continue;
+
+    CacheStatistics stats;
+    stats.name = it->name;
+    stats.currentCost = cost;
+    stats.allocatedCost = it->allocatedCost;
+    stats.hits = it->hits;
+    stats.misses = it->misses;
+    result << stats;
+  }
+  return result;
+}
@@ -0,0 +1,146 @@
+/***************************************************************************
+    qgscachebudgetmanager.h
+    -----------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef QGSCACHEBUDGETMANAGER_H
+#define QGSCACHEBUDGETMANAGER_H
+
+#define SIP_NO_FILE
+
+#include "qgis_core.h"
+
+#include <QList>
+#include <QMap>
+#include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+#include <functional>
+
+/**
+ * \class QgsCacheBudgetManager
+ * \ingroup core
+ * Coordinates the memory consumption of the application's caches against a
+ * single global budget.
+ *
+ * The in-memory caches (render results, images, SVGs, ...) each enforce an
+ * independent size limit, so under memory pressure every cache evicts in
+ * isolation while under light load all of them stay at their conservative
+ * defaults regardless of how much memory is actually available. Caches can
+ * instead register here with a pair of callbacks -- one reporting their
+ * current cost in bytes and one applying a new maximum cost -- and the
+ * manager periodically redistributes the configured budget between them,
+ * weighting each cache by how frequently it has been hit since the last
+ * redistribution.
+ *
+ * The budget is controlled by the \c cache/globalCacheBudgetMB setting. When
+ * it is zero (the default) the manager is inactive and every cache keeps its
+ * own limit.
+ *
+ * All methods are thread safe.
+ *
+ * \note not available in Python bindings
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsCacheBudgetManager : public QObject
+{
+    Q_OBJECT
+
+  public:
+
+    //! Hit/miss and cost statistics for one registered cache, see statistics()
+    struct CacheStatistics
+    {
+      //! Name the cache was registered under
+      QString name;
+      //! Current cost reported by the cache, in bytes
+      qint64 currentCost = 0;
+      //! Budget share allocated at the last redistribution, in bytes (0 while the budget is disabled)
+      qint64 allocatedCost = 0;
+      //! Hits recorded since the last redistribution
+      qint64 hits = 0;
+      //! Misses recorded since the last redistribution
+      qint64 misses = 0;
+    };
+
+    //! Returns the global cache budget manager.
+    static QgsCacheBudgetManager *instance();
+
+    /**
+     * Registers a cache with the manager and returns a handle identifying it.
+     *
+     * The \a currentCost callback must return the cache's current memory
+     * consumption in bytes. The \a setMaximumCost callback receives the
+     * cache's share of the global budget in bytes and must evict entries
+     * until the cache fits within it. Both callbacks may be invoked from any
+     * thread and must perform their own locking.
+     *
+     * The cache must call unregisterCache() before the callbacks become
+     * dangling, i.e. in its destructor.
+     */
+    int registerCache( const QString &name,
+                       const std::function< qint64() > &currentCost,
+                       const std::function< void ( qint64 maximumCost ) > &setMaximumCost );
+
+    //! Removes the cache identified by \a handle from the manager.
+    void unregisterCache( int handle );
+
+    /**
+     * Records a cache hit for the cache identified by \a handle. Hit counts
+     * bias the next redistribution towards frequently used caches.
+     * \see recordMiss()
+     */
+    void recordHit( int handle );
+
+    //! Records a cache miss for the cache identified by \a handle, see recordHit()
+    void recordMiss( int handle );
+
+    /**
+     * Returns the global cache budget in bytes, or 0 if no budget is
+     * configured and the registered caches keep their individual limits.
+     */
+    qint64 budget() const;
+
+    /**
+     * Redistributes the global budget between the registered caches
+     * immediately, instead of waiting for the next periodic redistribution.
+     */
+    void redistribute();
+
+    //! Returns the current statistics of every registered cache.
+    QList< QgsCacheBudgetManager::CacheStatistics > statistics() const;
+
+  private:
+
+    explicit QgsCacheBudgetManager( QObject *parent = nullptr );
+
+    struct RegisteredCache
+    {
+      QString name;
+      std::function< qint64() > currentCost;
+      std::function< void ( qint64 maximumCost ) > setMaximumCost;
+      qint64 allocatedCost = 0;
+      qint64 hits = 0;
+      qint64 misses = 0;
+    };
+
+    mutable QMutex mMutex;
+    QMap< int, RegisteredCache > mCaches;
+    int mNextHandle = 1;
+    QTimer mRedistributeTimer;
+
+};
+
+#endif // QGSCACHEBUDGETMANAGER_H
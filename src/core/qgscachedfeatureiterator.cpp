@@ -14,6 +14,7 @@
  ***************************************************************************/
 
 #include "qgscachedfeatureiterator.h"
+#include "qgsspatialindex.h"
 #include "qgsvectorlayercache.h"
 #include "qgsexception.h"
 #include "qgsvectorlayer.h"
@@ -53,7 +54,16 @@ QgsCachedFeatureIterator::QgsCachedFeatureIterator( QgsVectorLayerCache *vlCache
       break;
 
     default:
-      mFeatureIds = mVectorLayerCache->mCache.keys().toSet();
+      if ( !mFilterRect.isNull() && mVectorLayerCache->mSpatialIndex )
+      {
+        // only visit features which may intersect the filter rect - the exact test
+        // is still performed by acceptFeature() below
+        mFeatureIds = mVectorLayerCache->mSpatialIndex->intersects( mFilterRect ).toSet();
+      }
+      else
+      {
+        mFeatureIds = mVectorLayerCache->mCache.keys().toSet();
+      }
       break;
   }
 
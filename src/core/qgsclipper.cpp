@@ -19,6 +19,7 @@
 #include "qgsclipper.h"
 #include "qgsgeometry.h"
 #include "qgscurve.h"
+#include "qgslinestring.h"
 #include "qgslogger.h"
 
 // Where has all the code gone?
@@ -39,6 +40,13 @@ const double QgsClipper::MIN_Y = -16000;
 const double QgsClipper::SMALL_NUM = 1e-12;
 
 QPolygonF QgsClipper::clippedLine( const QgsCurve &curve, const QgsRectangle &clipExtent )
+{
+  QPolygonF line;
+  clippedLine( curve, clipExtent, line );
+  return line;
+}
+
+void QgsClipper::clippedLine( const QgsCurve &curve, const QgsRectangle &clipExtent, QPolygonF &line )
 {
   const int nPoints = curve.numPoints();
 
@@ -46,15 +54,21 @@ QPolygonF QgsClipper::clippedLine( const QgsCurve &curve, const QgsRectangle &cl
   double p1x_c, p1y_c; //clipped end coordinates
   double lastClipX = 0.0, lastClipY = 0.0; //last successfully clipped coords
 
-  QPolygonF line;
+  // direct pointers to the coordinate vectors avoid a virtual xAt()/yAt() call
+  // per vertex for the common straight line string case
+  const QgsLineString *lineString = qgsgeometry_cast< const QgsLineString * >( &curve );
+  const double *srcX = lineString ? lineString->xData() : nullptr;
+  const double *srcY = lineString ? lineString->yData() : nullptr;
+
+  line.resize( 0 );
   line.reserve( nPoints + 1 );
 
   for ( int i = 0; i < nPoints; ++i )
   {
     if ( i == 0 )
     {
-      p1x = curve.xAt( i );
-      p1y = curve.yAt( i );
+      p1x = srcX ? srcX[i] : curve.xAt( i );
+      p1y = srcY ? srcY[i] : curve.yAt( i );
       continue;
     }
     else
@@ -62,8 +76,8 @@ QPolygonF QgsClipper::clippedLine( const QgsCurve &curve, const QgsRectangle &cl
       p0x = p1x;
       p0y = p1y;
 
-      p1x = curve.xAt( i );
-      p1y = curve.yAt( i );
+      p1x = srcX ? srcX[i] : curve.xAt( i );
+      p1y = srcY ? srcY[i] : curve.yAt( i );
 
       p1x_c = p1x;
       p1y_c = p1y;
@@ -89,7 +103,6 @@ QPolygonF QgsClipper::clippedLine( const QgsCurve &curve, const QgsRectangle &cl
       }
     }
   }
-  return line;
 }
 
 void QgsClipper::connectSeparatedLines( double x0, double y0, double x1, double y1,
@@ -100,6 +100,17 @@ class CORE_EXPORT QgsClipper
 
     static void trimPolygon( QPolygonF &pts, const QgsRectangle &clipRect );
 
+    /**
+     * Takes a polygon and clips it to clipRect, using the externally supplied
+     * \a tmpPts as scratch space for the intermediate clipping passes. Passing
+     * a buffer which is retained between calls (e.g. QgsRenderContext::clippingScratchBuffer())
+     * avoids a temporary point vector allocation for every clipped polygon.
+     *
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    static void trimPolygon( QPolygonF &pts, const QgsRectangle &clipRect, QPolygonF &tmpPts ) SIP_SKIP;
+
     /**
      * Takes a linestring and clips it to clipExtent
      * \param curve the linestring
@@ -108,6 +119,16 @@ class CORE_EXPORT QgsClipper
      */
     static QPolygonF clippedLine( const QgsCurve &curve, const QgsRectangle &clipExtent );
 
+    /**
+     * Takes a linestring and clips it to \a clipExtent, replacing the contents
+     * of \a pts with the clipped line. The capacity of \a pts is retained, so
+     * reusing the same polygon across calls avoids an allocation per feature.
+     *
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    static void clippedLine( const QgsCurve &curve, const QgsRectangle &clipExtent, QPolygonF &pts ) SIP_SKIP;
+
   private:
 
     // Used when testing for equivalance to 0.0
@@ -202,6 +223,12 @@ inline void QgsClipper::trimFeature( QVector<double> &x,
 inline void QgsClipper::trimPolygon( QPolygonF &pts, const QgsRectangle &clipRect )
 {
   QPolygonF tmpPts;
+  trimPolygon( pts, clipRect, tmpPts );
+}
+
+inline void QgsClipper::trimPolygon( QPolygonF &pts, const QgsRectangle &clipRect, QPolygonF &tmpPts )
+{
+  tmpPts.resize( 0 );
   tmpPts.reserve( pts.size() );
 
   trimPolygonToBoundary( pts, tmpPts, clipRect, XMax, clipRect.xMaximum() );
@@ -20,7 +20,9 @@
 
 #include "qgis.h"
 #include "qgsapplication.h"
+#include "qgslogger.h"
 #include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QMap>
 #include <QMutex>
 #include <QSemaphore>
@@ -32,6 +34,7 @@
 
 #define CONN_POOL_EXPIRATION_TIME           60    // in seconds
 #define CONN_POOL_SPARE_CONNECTIONS          2    // number of spare connections in case all the base connections are used but we have a nested request with the risk of a deadlock
+#define CONN_POOL_PRIORITY_HEADROOM          2    // number of connections kept free for interactive requests while background (batch) requests contend for the pool
 
 
 /**
@@ -92,9 +95,17 @@ class QgsConnectionPoolGroup
      *
      * \returns initialized connection or NULLPTR if unsuccessful
      */
-    T acquire( int timeout, bool requestMayBeNested )
+    T acquire( int timeout, bool requestMayBeNested, bool lowPriority = false )
     {
-      const int requiredFreeConnectionCount = requestMayBeNested ? 1 : 3;
+      // background requests additionally leave headroom free, so that interactive
+      // requests (which require fewer free connections) always win when the pool
+      // is contended and cannot be starved by long-running batch work
+      const int requiredFreeConnectionCount = ( requestMayBeNested ? 1 : 3 )
+                                              + ( lowPriority ? CONN_POOL_PRIORITY_HEADROOM : 0 );
+
+      QElapsedTimer waitTimer;
+      waitTimer.start();
+
       // we are going to acquire a resource - if no resource is available, we will block here
       if ( timeout >= 0 )
       {
@@ -111,6 +122,12 @@ class QgsConnectionPoolGroup
       }
       sem.release( requiredFreeConnectionCount - 1 );
 
+      const qint64 waitedMs = waitTimer.elapsed();
+      if ( waitedMs > 500 )
+      {
+        QgsDebugMsgLevel( QStringLiteral( "waited %1 ms for a connection to %2" ).arg( waitedMs ).arg( connInfo ), 2 );
+      }
+
       // quick (preferred) way - use cached connection
       {
         QMutexLocker locker( &connMutex );
@@ -285,11 +302,13 @@ class QgsConnectionPool
      * If \a timeout is a negative value the calling thread will be blocked
      * until a connection becomes available. This is the default behavior.
      *
-     *
+     * Since QGIS 3.8, requests issued from background (batch) work can set
+     * \a lowPriority to TRUE -- such requests leave headroom in the pool
+     * free for interactive requests when the pool is contended.
      *
      * \returns initialized connection or NULLPTR if unsuccessful
      */
-    T acquireConnection( const QString &connInfo, int timeout = -1, bool requestMayBeNested = false )
+    T acquireConnection( const QString &connInfo, int timeout = -1, bool requestMayBeNested = false, bool lowPriority = false )
     {
       mMutex.lock();
       typename T_Groups::iterator it = mGroups.find( connInfo );
@@ -300,7 +319,7 @@ class QgsConnectionPool
       T_Group *group = *it;
       mMutex.unlock();
 
-      return group->acquire( timeout, requestMayBeNested );
+      return group->acquire( timeout, requestMayBeNested, lowPriority );
     }
 
     //! Release an existing connection so it will get back into the pool and can be reused
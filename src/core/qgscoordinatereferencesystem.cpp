@@ -27,6 +27,7 @@
 #include <QFileInfo>
 #include <QRegExp>
 #include <QTextStream>
+#include <QDataStream>
 #include <QFile>
 #include <QRegularExpression>
 
@@ -67,6 +68,15 @@ QReadWriteLock QgsCoordinateReferenceSystem::sCRSSrsIdLock;
 QHash< long, QgsCoordinateReferenceSystem > QgsCoordinateReferenceSystem::sSrsIdCache;
 QReadWriteLock QgsCoordinateReferenceSystem::sCrsStringLock;
 QHash< QString, QgsCoordinateReferenceSystem > QgsCoordinateReferenceSystem::sStringCache;
+bool QgsCoordinateReferenceSystem::sDefinitionCacheLoaded = false;
+
+//! Bump whenever the serialized format of the persistent definition cache changes
+static const quint32 CRS_DEFINITION_CACHE_VERSION = 1;
+
+static QString crsDefinitionCachePath()
+{
+  return QgsApplication::qgisSettingsDirPath() + QStringLiteral( "crs_definitions.cache" );
+}
 
 //--------------------------
 
@@ -213,6 +223,9 @@ bool QgsCoordinateReferenceSystem::createFromId( const long id, CrsType type )
 
 bool QgsCoordinateReferenceSystem::createFromString( const QString &definition )
 {
+  if ( !sDefinitionCacheLoaded )
+    loadDefinitionCache();
+
   sCrsStringLock.lockForRead();
   QHash< QString, QgsCoordinateReferenceSystem >::const_iterator crsIt = sStringCache.constFind( definition );
   if ( crsIt != sStringCache.constEnd() )
@@ -2433,4 +2446,127 @@ void QgsCoordinateReferenceSystem::invalidateCache()
   sCrsStringLock.lockForWrite();
   sStringCache.clear();
   sCrsStringLock.unlock();
+  // the persistent cache is derived from the srs databases too, so it must go
+  // as well. It will be rewritten from scratch by saveDefinitionCache().
+  QFile::remove( crsDefinitionCachePath() );
+}
+
+void QgsCoordinateReferenceSystem::loadDefinitionCache()
+{
+  sCrsStringLock.lockForWrite();
+  if ( sDefinitionCacheLoaded )
+  {
+    sCrsStringLock.unlock();
+    return;
+  }
+  sDefinitionCacheLoaded = true;
+
+  QFile file( crsDefinitionCachePath() );
+  if ( !file.open( QIODevice::ReadOnly ) )
+  {
+    sCrsStringLock.unlock();
+    return;
+  }
+
+  QDataStream stream( &file );
+  quint32 formatVersion = 0;
+  QString qgisVersion;
+  qint64 srsDbTime = 0;
+  qint64 userDbTime = 0;
+  stream >> formatVersion >> qgisVersion >> srsDbTime >> userDbTime;
+  if ( stream.status() != QDataStream::Ok ||
+       formatVersion != CRS_DEFINITION_CACHE_VERSION ||
+       qgisVersion != Qgis::QGIS_VERSION ||
+       srsDbTime != QFileInfo( QgsApplication::srsDatabaseFilePath() ).lastModified().toMSecsSinceEpoch() ||
+       userDbTime != QFileInfo( QgsApplication::qgisUserDatabaseFilePath() ).lastModified().toMSecsSinceEpoch() )
+  {
+    // cache was written by another version or the srs databases have changed
+    // since - ignore it, it is rewritten from scratch on exit
+    sCrsStringLock.unlock();
+    return;
+  }
+
+  quint32 count = 0;
+  stream >> count;
+  for ( quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i )
+  {
+    QString definition;
+    QString description;
+    QString projectionAcronym;
+    QString ellipsoidAcronym;
+    QString authId;
+    QString proj4;
+    QString wkt;
+    qint64 srsId = 0;
+    qint64 srid = 0;
+    bool isGeographic = false;
+    bool axisInverted = false;
+    qint32 mapUnits = 0;
+    stream >> definition >> srsId >> description >> projectionAcronym >> ellipsoidAcronym
+           >> isGeographic >> mapUnits >> srid >> authId >> proj4 >> wkt >> axisInverted;
+    if ( stream.status() != QDataStream::Ok )
+      break;
+    if ( wkt.isEmpty() || sStringCache.contains( definition ) )
+      continue;
+
+    QgsCoordinateReferenceSystem crs;
+    crs.d->mSrsId = srsId;
+    crs.d->mDescription = description;
+    crs.d->mProjectionAcronym = projectionAcronym;
+    crs.d->mEllipsoidAcronym = ellipsoidAcronym;
+    crs.d->mIsGeographic = isGeographic;
+    crs.d->mMapUnits = static_cast< QgsUnitTypes::DistanceUnit >( mapUnits );
+    crs.d->mSRID = srid;
+    crs.d->mAuthId = authId;
+    crs.d->mProj4 = proj4;
+    crs.d->mWkt = wkt;
+    crs.d->mAxisInverted = axisInverted;
+    crs.d->mAxisInvertedDirty = false;
+
+    // rebuild the OGR handle from the stored wkt - this skips all srs
+    // database lookups
+    QByteArray wktData = wkt.toLatin1();
+    char *wktPtr = wktData.data();
+    if ( OSRImportFromWkt( crs.d->mCRS, &wktPtr ) != OGRERR_NONE )
+      continue;
+    crs.d->mIsValid = true;
+
+    sStringCache.insert( definition, crs );
+  }
+  sCrsStringLock.unlock();
+}
+
+void QgsCoordinateReferenceSystem::saveDefinitionCache()
+{
+  QFile file( crsDefinitionCachePath() );
+  if ( !file.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+    return;
+
+  quint32 count = 0;
+  QByteArray records;
+  {
+    QDataStream recordStream( &records, QIODevice::WriteOnly );
+    sCrsStringLock.lockForRead();
+    QHash< QString, QgsCoordinateReferenceSystem >::const_iterator it = sStringCache.constBegin();
+    for ( ; it != sStringCache.constEnd(); ++it )
+    {
+      const QgsCoordinateReferenceSystem &crs = it.value();
+      if ( !crs.isValid() || crs.toWkt().isEmpty() )
+        continue;
+
+      recordStream << it.key() << static_cast< qint64 >( crs.d->mSrsId ) << crs.d->mDescription
+                   << crs.d->mProjectionAcronym << crs.d->mEllipsoidAcronym << crs.d->mIsGeographic
+                   << static_cast< qint32 >( crs.d->mMapUnits ) << static_cast< qint64 >( crs.d->mSRID )
+                   << crs.d->mAuthId << crs.toProj4() << crs.toWkt() << crs.hasAxisInverted();
+      count++;
+    }
+    sCrsStringLock.unlock();
+  }
+
+  QDataStream stream( &file );
+  stream << CRS_DEFINITION_CACHE_VERSION << Qgis::QGIS_VERSION
+         << static_cast< qint64 >( QFileInfo( QgsApplication::srsDatabaseFilePath() ).lastModified().toMSecsSinceEpoch() )
+         << static_cast< qint64 >( QFileInfo( QgsApplication::qgisUserDatabaseFilePath() ).lastModified().toMSecsSinceEpoch() )
+         << count;
+  stream.writeRawData( records.constData(), records.size() );
 }
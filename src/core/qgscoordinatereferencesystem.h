@@ -656,6 +656,17 @@ class CORE_EXPORT QgsCoordinateReferenceSystem
      */
     static void invalidateCache();
 
+    /**
+     * Writes the internal cache of CRS objects resolved from definition strings
+     * to a file in the user profile, so that subsequent runs can restore them
+     * without querying the srs database or proj. The persisted cache is
+     * dropped whenever the QGIS version or the srs databases change, and by
+     * invalidateCache().
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    static void saveDefinitionCache() SIP_SKIP;
+
     // Mutators -----------------------------------
     // We don't want to expose these to the public api since they won't create
     // a fully valid crs. Programmers should use the createFrom* methods rather
@@ -787,6 +798,15 @@ class CORE_EXPORT QgsCoordinateReferenceSystem
     static QHash< QString, QgsCoordinateReferenceSystem > sWktCache;
     static QReadWriteLock sCRSSrsIdLock;
     static QHash< long, QgsCoordinateReferenceSystem > sSrsIdCache;
+
+    /**
+     * Populates the string cache from the persistent definition cache written
+     * by saveDefinitionCache(), if one exists and is still valid.
+     */
+    static void loadDefinitionCache();
+
+    //! TRUE once the persistent definition cache has been (attempted to be) loaded
+    static bool sDefinitionCacheLoaded;
     static QReadWriteLock sCrsStringLock;
     static QHash< QString, QgsCoordinateReferenceSystem > sStringCache;
 
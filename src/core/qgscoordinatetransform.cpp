@@ -23,6 +23,7 @@
 #include "qgsrectangle.h"
 #include "qgsexception.h"
 #include "qgsproject.h"
+#include "qgstraceprofiler.h"
 
 //qt includes
 #include <QDomNode>
@@ -346,23 +347,20 @@ void QgsCoordinateTransform::transformPolygon( QPolygonF &poly, TransformDirecti
 
   QVector<double> x( nVertices );
   QVector<double> y( nVertices );
-  QVector<double> z( nVertices );
   double *destX = x.data();
   double *destY = y.data();
-  double *destZ = z.data();
 
   const QPointF *polyData = poly.constData();
   for ( int i = 0; i < nVertices; ++i )
   {
     *destX++ = polyData->x();
     *destY++ = polyData->y();
-    *destZ++ = 0;
     polyData++;
   }
 
   try
   {
-    transformCoords( nVertices, x.data(), y.data(), z.data(), direction );
+    transformCoords( nVertices, x.data(), y.data(), nullptr, direction );
   }
   catch ( const QgsCsException & )
   {
@@ -593,6 +591,8 @@ QgsRectangle QgsCoordinateTransform::transformBoundingBox( const QgsRectangle &r
 
 void QgsCoordinateTransform::transformCoords( int numPoints, double *x, double *y, double *z, TransformDirection direction ) const
 {
+  QGS_TRACE_ZONE( "transform coords" );
+
   if ( !d->mIsValid || d->mShortCircuit )
     return;
   // Refuse to transform the points if the srs's are invalid
@@ -332,10 +332,13 @@ class CORE_EXPORT QgsCoordinateTransform
      * Transform an array of coordinates to the destination CRS.
      * If the direction is ForwardTransform then coordinates are transformed from source to destination,
      * otherwise points are transformed from destination to source CRS.
+     * The whole batch is handed to proj in a single call, so this is considerably
+     * faster than transforming coordinates one at a time.
      * \param numPoint number of coordinates in arrays
      * \param x array of x coordinates to transform
      * \param y array of y coordinates to transform
-     * \param z array of z coordinates to transform
+     * \param z array of z coordinates to transform. Since QGIS 3.8 this may be NULLPTR,
+     * in which case z coordinates are treated as 0 and callers avoid allocating a dummy array.
      * \param direction transform direction (defaults to ForwardTransform)
      */
     void transformCoords( int numPoint, double *x, double *y, double *z, TransformDirection direction = ForwardTransform ) const SIP_THROW( QgsCsException );
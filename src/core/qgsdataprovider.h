@@ -555,6 +555,20 @@ class CORE_EXPORT QgsDataProvider : public QObject
      */
     void notify( const QString &msg );
 
+    /**
+     * Emitted when the provider has determined that data changed OUTSIDE of QGIS
+     * within a known bounding rectangle only, e.g. from a differential change
+     * notification issued by the datasource. The \a changedExtent is expressed in
+     * the provider's CRS.
+     *
+     * Unlike dataChanged(), listeners holding cached renderings only need to
+     * refresh the affected region instead of discarding the whole render.
+     *
+     * \see notify()
+     * \since QGIS 3.8
+     */
+    void dataRegionChanged( const QgsRectangle &changedExtent );
+
 
   protected:
 
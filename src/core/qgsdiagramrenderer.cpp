@@ -22,11 +22,15 @@
 #include "qgsrendercontext.h"
 #include "qgslayertreemodellegendnode.h"
 #include "qgsfontutils.h"
+#include "qgssettings.h"
 #include "qgssymbollayerutils.h"
 
 #include <QDomElement>
 #include <QPainter>
 
+//! Upper bound for the number of cached diagram pictures per renderer
+const int MAX_CACHED_DIAGRAM_PICTURES = 500;
+
 QgsPropertiesDefinition QgsDiagramLayerSettings::sPropertyDefinitions;
 
 void QgsDiagramLayerSettings::initPropertyDefinitions()
@@ -443,7 +447,45 @@ void QgsDiagramRenderer::renderDiagram( const QgsFeature &feature, QgsRenderCont
     s.rotationOffset = properties.valueAsDouble( QgsDiagramLayerSettings::StartAngle, c.expressionContext(), s.rotationOffset );
   }
 
-  mDiagram->renderDiagram( feature, c, s, pos );
+  // features with identical attribute values produce identical diagrams, so the
+  // drawing commands can be recorded once and replayed for all of them instead of
+  // laying out the diagram from scratch per feature. Opt-in, since diagrams whose
+  // category expressions use more than the plain attribute values (e.g. feature
+  // variables) must not share pictures between features.
+  static bool sUseCache = QgsSettings().value( QStringLiteral( "qgis/diagramRenderCache" ), false ).toBool();
+  if ( !sUseCache || !c.painter() )
+  {
+    mDiagram->renderDiagram( feature, c, s, pos );
+    return;
+  }
+
+  QString cacheKey;
+  const QgsAttributes attributes = feature.attributes();
+  for ( const QVariant &value : attributes )
+  {
+    cacheKey += value.toString();
+    cacheKey += '|';
+  }
+  cacheKey += QStringLiteral( "%1|%2|%3|%4|%5|%6" ).arg( s.size.width() ).arg( s.size.height() )
+              .arg( s.backgroundColor.rgba() ).arg( s.penColor.rgba() ).arg( s.penWidth ).arg( s.rotationOffset );
+
+  QHash< QString, QPicture >::const_iterator pictureIt = mDiagramPictureCache.constFind( cacheKey );
+  if ( pictureIt == mDiagramPictureCache.constEnd() )
+  {
+    QPicture picture;
+    QPainter picturePainter( &picture );
+    QPainter *previousPainter = c.painter();
+    c.setPainter( &picturePainter );
+    mDiagram->renderDiagram( feature, c, s, QPointF( 0, 0 ) );
+    c.setPainter( previousPainter );
+    picturePainter.end();
+
+    if ( mDiagramPictureCache.size() >= MAX_CACHED_DIAGRAM_PICTURES )
+      mDiagramPictureCache.clear();
+    pictureIt = mDiagramPictureCache.insert( cacheKey, picture );
+  }
+
+  c.painter()->drawPicture( pos, pictureIt.value() );
 }
 
 QSizeF QgsDiagramRenderer::sizeMapUnits( const QgsFeature &feature, const QgsRenderContext &c ) const
@@ -19,7 +19,9 @@
 #include "qgis_sip.h"
 #include <QColor>
 #include <QFont>
+#include <QHash>
 #include <QList>
+#include <QPicture>
 #include <QPointF>
 #include <QSizeF>
 #include <QDomDocument>
@@ -637,6 +639,16 @@ class CORE_EXPORT QgsDiagramRenderer
 
     //! Whether to show an attribute legend for the diagrams
     bool mShowAttributeLegend = true;
+
+  private:
+
+    /**
+     * Cache of diagram drawing commands, keyed by the feature attribute values and the
+     * per-feature diagram settings. Features sharing the same attribute values replay
+     * the recorded picture instead of laying the diagram out again. Not copied by
+     * clone() and never shared between threads.
+     */
+    mutable QHash< QString, QPicture > mDiagramPictureCache;
 };
 
 /**
@@ -18,6 +18,8 @@
 #include "qgsxmlutils.h"
 #include "qgsexpression.h"
 
+#include <QAtomicInt>
+
 const QString QgsExpressionContext::EXPR_FIELDS( QStringLiteral( "_fields_" ) );
 const QString QgsExpressionContext::EXPR_ORIGINAL_VALUE( QStringLiteral( "value" ) );
 const QString QgsExpressionContext::EXPR_SYMBOL_COLOR( QStringLiteral( "symbol_color" ) );
@@ -33,6 +35,14 @@ const QString QgsExpressionContext::EXPR_CLUSTER_COLOR( QStringLiteral( "cluster
 // QgsExpressionContextScope
 //
 
+/**
+ * Source of variable name set versions. A global counter (rather than a per scope
+ * one) guarantees that a scope never reuses the stamp of a deleted scope which
+ * happened to live at the same address, so cached name resolutions can trust a
+ * matching (pointer, version) pair.
+ */
+static QAtomicInt sNextVariableNamesVersion( 1 );
+
 QgsExpressionContextScope::QgsExpressionContextScope( const QString &name )
   : mName( name )
 {
@@ -44,6 +54,7 @@ QgsExpressionContextScope::QgsExpressionContextScope( const QgsExpressionContext
   , mVariables( other.mVariables )
   , mHasFeature( other.mHasFeature )
   , mFeature( other.mFeature )
+  , mVariableNamesVersion( sNextVariableNamesVersion.fetchAndAddRelaxed( 1 ) )
 {
   QHash<QString, QgsScopedExpressionFunction * >::const_iterator it = other.mFunctions.constBegin();
   for ( ; it != other.mFunctions.constEnd(); ++it )
@@ -58,6 +69,7 @@ QgsExpressionContextScope &QgsExpressionContextScope::operator=( const QgsExpres
   mVariables = other.mVariables;
   mHasFeature = other.mHasFeature;
   mFeature = other.mFeature;
+  mVariableNamesVersion = sNextVariableNamesVersion.fetchAndAddRelaxed( 1 );
 
   qDeleteAll( mFunctions );
   mFunctions.clear();
@@ -92,12 +104,19 @@ void QgsExpressionContextScope::setVariable( const QString &name, const QVariant
 
 void QgsExpressionContextScope::addVariable( const QgsExpressionContextScope::StaticVariable &variable )
 {
+  if ( !mVariables.contains( variable.name ) )
+    mVariableNamesVersion = sNextVariableNamesVersion.fetchAndAddRelaxed( 1 );
   mVariables.insert( variable.name, variable );
 }
 
 bool QgsExpressionContextScope::removeVariable( const QString &name )
 {
-  return mVariables.remove( name ) > 0;
+  if ( mVariables.remove( name ) > 0 )
+  {
+    mVariableNamesVersion = sNextVariableNamesVersion.fetchAndAddRelaxed( 1 );
+    return true;
+  }
+  return false;
 }
 
 bool QgsExpressionContextScope::hasVariable( const QString &name ) const
@@ -107,7 +126,8 @@ bool QgsExpressionContextScope::hasVariable( const QString &name ) const
 
 QVariant QgsExpressionContextScope::variable( const QString &name ) const
 {
-  return hasVariable( name ) ? mVariables.value( name ).value : QVariant();
+  const QHash<QString, StaticVariable>::const_iterator it = mVariables.constFind( name );
+  return it != mVariables.constEnd() ? it.value().value : QVariant();
 }
 
 QStringList QgsExpressionContextScope::variableNames() const
@@ -162,17 +182,20 @@ QStringList QgsExpressionContextScope::filteredVariableNames() const
 
 bool QgsExpressionContextScope::isReadOnly( const QString &name ) const
 {
-  return hasVariable( name ) ? mVariables.value( name ).readOnly : false;
+  const QHash<QString, StaticVariable>::const_iterator it = mVariables.constFind( name );
+  return it != mVariables.constEnd() ? it.value().readOnly : false;
 }
 
 bool QgsExpressionContextScope::isStatic( const QString &name ) const
 {
-  return hasVariable( name ) ? mVariables.value( name ).isStatic : false;
+  const QHash<QString, StaticVariable>::const_iterator it = mVariables.constFind( name );
+  return it != mVariables.constEnd() ? it.value().isStatic : false;
 }
 
 QString QgsExpressionContextScope::description( const QString &name ) const
 {
-  return hasVariable( name ) ? mVariables.value( name ).description : QString();
+  const QHash<QString, StaticVariable>::const_iterator it = mVariables.constFind( name );
+  return it != mVariables.constEnd() ? it.value().description : QString();
 }
 
 bool QgsExpressionContextScope::hasFunction( const QString &name ) const
@@ -285,12 +308,7 @@ QgsExpressionContext::~QgsExpressionContext()
 
 bool QgsExpressionContext::hasVariable( const QString &name ) const
 {
-  Q_FOREACH ( const QgsExpressionContextScope *scope, mStack )
-  {
-    if ( scope->hasVariable( name ) )
-      return true;
-  }
-  return false;
+  return activeScopeForVariable( name ) != nullptr;
 }
 
 QVariant QgsExpressionContext::variable( const QString &name ) const
@@ -330,30 +348,63 @@ void QgsExpressionContext::setHighlightedFunctions( const QStringList &names )
   mHighlightedFunctions = names;
 }
 
-const QgsExpressionContextScope *QgsExpressionContext::activeScopeForVariable( const QString &name ) const
+void QgsExpressionContext::validateActiveScopeCache() const
 {
-  //iterate through stack backwards, so that higher priority variables take precedence
-  QList< QgsExpressionContextScope * >::const_iterator it = mStack.constEnd();
-  while ( it != mStack.constBegin() )
+  // comparing (pointer, name set version) pairs is much cheaper than the hash
+  // lookups the cache saves -- value only changes to variables don't bump the
+  // version, so per feature updates of existing variables keep the cache warm
+  bool valid = mActiveScopeCacheStamp.size() == mStack.size();
+  if ( valid )
   {
-    --it;
-    if ( ( *it )->hasVariable( name ) )
-      return ( *it );
+    for ( int i = 0; i < mStack.size(); ++i )
+    {
+      if ( mActiveScopeCacheStamp.at( i ).first != mStack.at( i )
+           || mActiveScopeCacheStamp.at( i ).second != mStack.at( i )->variableNamesVersion() )
+      {
+        valid = false;
+        break;
+      }
+    }
+  }
+  if ( valid )
+    return;
+
+  mActiveScopeCache.clear();
+  mActiveScopeCacheStamp.resize( mStack.size() );
+  for ( int i = 0; i < mStack.size(); ++i )
+  {
+    mActiveScopeCacheStamp[i] = qMakePair( mStack.at( i ), mStack.at( i )->variableNamesVersion() );
   }
-  return nullptr;
 }
 
-QgsExpressionContextScope *QgsExpressionContext::activeScopeForVariable( const QString &name )
+const QgsExpressionContextScope *QgsExpressionContext::activeScopeForVariable( const QString &name ) const
 {
+  validateActiveScopeCache();
+  const QHash< QString, QgsExpressionContextScope * >::const_iterator cacheIt = mActiveScopeCache.constFind( name );
+  if ( cacheIt != mActiveScopeCache.constEnd() )
+    return cacheIt.value();
+
   //iterate through stack backwards, so that higher priority variables take precedence
+  QgsExpressionContextScope *scope = nullptr;
   QList< QgsExpressionContextScope * >::const_iterator it = mStack.constEnd();
   while ( it != mStack.constBegin() )
   {
     --it;
     if ( ( *it )->hasVariable( name ) )
-      return ( *it );
+    {
+      scope = *it;
+      break;
+    }
   }
-  return nullptr;
+
+  // misses are cached too -- repeatedly resolving an unset variable is just as hot
+  mActiveScopeCache.insert( name, scope );
+  return scope;
+}
+
+QgsExpressionContextScope *QgsExpressionContext::activeScopeForVariable( const QString &name )
+{
+  return const_cast< QgsExpressionContextScope * >( static_cast< const QgsExpressionContext * >( this )->activeScopeForVariable( name ) );
 }
 
 QgsExpressionContextScope *QgsExpressionContext::scope( int index )
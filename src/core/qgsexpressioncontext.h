@@ -258,6 +258,17 @@ class CORE_EXPORT QgsExpressionContextScope
      */
     int variableCount() const { return mVariables.count(); }
 
+    /**
+     * Returns the version of the scope's variable name set. The version changes
+     * whenever a variable is added to or removed from the scope, but not when an
+     * existing variable merely changes value, so callers can cheaply detect whether
+     * a cached resolution of names against the scope is still valid. Versions are
+     * unique across all scope instances.
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    int variableNamesVersion() const SIP_SKIP { return mVariableNamesVersion; }
+
     /**
      * Tests whether a function with the specified name exists in the scope.
      * \param name function name
@@ -351,6 +362,7 @@ class CORE_EXPORT QgsExpressionContextScope
     QHash<QString, QgsScopedExpressionFunction * > mFunctions;
     bool mHasFeature = false;
     QgsFeature mFeature;
+    int mVariableNamesVersion = 0;
 
     bool variableNameSort( const QString &a, const QString &b );
 };
@@ -739,6 +751,17 @@ class CORE_EXPORT QgsExpressionContext
     // Cache is mutable because we want to be able to add cached values to const contexts
     mutable QMap< QString, QVariant > mCachedValues;
 
+    /**
+     * Ensures the cached variable name resolutions still match the current scope
+     * stack, and clears them when they don't.
+     */
+    void validateActiveScopeCache() const;
+
+    //! Cached resolution of variable names to the scope containing them (NULLPTR for known misses)
+    mutable QHash< QString, QgsExpressionContextScope * > mActiveScopeCache;
+    //! Fingerprint of the scope stack which mActiveScopeCache was built against
+    mutable QVector< QPair< QgsExpressionContextScope *, int > > mActiveScopeCacheStamp;
+
 };
 
 #endif // QGSEXPRESSIONCONTEXT_H
@@ -23,6 +23,8 @@ email                : sherman at mrcc.com
 
 #include <QDataStream>
 
+#include <utility>
+
 /***************************************************************************
  * This class is considered CRITICAL and any change MUST be accompanied with
  * full unit tests in testqgsfeature.cpp.
@@ -134,6 +136,16 @@ void QgsFeature::setAttributes( const QgsAttributes &attrs )
   d->valid = true;
 }
 
+void QgsFeature::setAttributes( QgsAttributes &&attrs )
+{
+  if ( attrs == d->attributes )
+    return;
+
+  d.detach();
+  d->attributes = std::move( attrs );
+  d->valid = true;
+}
+
 void QgsFeature::setGeometry( const QgsGeometry &geometry )
 {
   d.detach();
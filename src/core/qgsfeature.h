@@ -246,6 +246,16 @@ class CORE_EXPORT QgsFeature
      */
     void setAttributes( const QgsAttributes &attrs );
 
+    /**
+     * Sets the feature's attributes by moving \a attrs into the feature,
+     * avoiding a copy of the attribute vector. The feature will be valid after.
+     * \see setAttribute
+     * \see attributes
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    void setAttributes( QgsAttributes &&attrs ) SIP_SKIP;
+
     /**
      * Set an attribute's value by field index.
      * The feature will be valid if it was successful.
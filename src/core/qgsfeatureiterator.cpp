@@ -84,9 +84,17 @@ bool QgsAbstractFeatureIterator::nextFeatureFilterExpression( QgsFeature &f )
 
 bool QgsAbstractFeatureIterator::nextFeatureFilterFids( QgsFeature &f )
 {
+  // a large fid set is checked once per candidate feature -- pack it into a
+  // sorted vector so the membership tests stay cache friendly
+  if ( !mPackedFilterFidsBuilt )
+  {
+    mPackedFilterFids = QgsPackedFeatureIds( mRequest.filterFids() );
+    mPackedFilterFidsBuilt = true;
+  }
+
   while ( fetchFeature( f ) )
   {
-    if ( mRequest.filterFids().contains( f.id() ) )
+    if ( mPackedFilterFids.contains( f.id() ) )
       return true;
   }
   return false;
@@ -18,6 +18,7 @@
 #include "qgis_core.h"
 #include "qgsfeaturerequest.h"
 #include "qgsindexedfeature.h"
+#include "qgspackedfeatureids.h"
 
 class QgsFeedback;
 
@@ -201,6 +202,10 @@ class CORE_EXPORT QgsAbstractFeatureIterator
     QList<QgsIndexedFeature> mCachedFeatures;
     QList<QgsIndexedFeature>::ConstIterator mFeatureIterator;
 
+    //! Packed copy of the request's fid filter, built on the first membership check
+    QgsPackedFeatureIds mPackedFilterFids;
+    bool mPackedFilterFidsBuilt = false;
+
     //! returns whether the iterator supports simplify geometries on provider side
     virtual bool providerCanSimplify( QgsSimplifyMethod::MethodType methodType ) const;
 
@@ -87,6 +87,7 @@ QgsFeatureRequest &QgsFeatureRequest::operator=( const QgsFeatureRequest &rh )
   mTransformErrorCallback = rh.mTransformErrorCallback;
   mTimeout = rh.mTimeout;
   mRequestMayBeNested = rh.mRequestMayBeNested;
+  mBackgroundPriority = rh.mBackgroundPriority;
   return *this;
 }
 
@@ -327,6 +328,17 @@ QgsFeatureRequest &QgsFeatureRequest::setRequestMayBeNested( bool requestMayBeNe
   return *this;
 }
 
+bool QgsFeatureRequest::backgroundPriority() const
+{
+  return mBackgroundPriority;
+}
+
+QgsFeatureRequest &QgsFeatureRequest::setBackgroundPriority( bool backgroundPriority )
+{
+  mBackgroundPriority = backgroundPriority;
+  return *this;
+}
+
 
 #include "qgsfeatureiterator.h"
 #include "qgslogger.h"
@@ -697,6 +697,29 @@ class CORE_EXPORT QgsFeatureRequest
      */
     QgsFeatureRequest &setRequestMayBeNested( bool requestMayBeNested );
 
+    /**
+     * Returns TRUE if the request originates from a background (batch) job,
+     * such as an export, rather than from an interactive context.
+     *
+     * \see setBackgroundPriority()
+     * \since QGIS 3.8
+     */
+    bool backgroundPriority() const;
+
+    /**
+     * Set this to TRUE for requests issued from background (batch) jobs, such
+     * as exports.
+     *
+     * Shared, limited resources -- for instance provider connection pools --
+     * will then favor interactive requests when the resource is contended,
+     * so that long-running batch work cannot starve canvas renders or
+     * identify operations.
+     *
+     * \see backgroundPriority()
+     * \since QGIS 3.8
+     */
+    QgsFeatureRequest &setBackgroundPriority( bool backgroundPriority );
+
   protected:
     FilterType mFilter = FilterNone;
     QgsRectangle mFilterRect;
@@ -716,6 +739,7 @@ class CORE_EXPORT QgsFeatureRequest
     QgsCoordinateTransformContext mTransformContext;
     int mTimeout = -1;
     int mRequestMayBeNested = false;
+    bool mBackgroundPriority = false;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS( QgsFeatureRequest::Flags )
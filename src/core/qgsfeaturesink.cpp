@@ -17,6 +17,8 @@
 
 #include "qgsfeaturestore.h"
 
+#include <QtConcurrentRun>
+
 bool QgsFeatureSink::addFeature( QgsFeature &feature, QgsFeatureSink::Flags flags )
 {
   QgsFeatureList features;
@@ -46,3 +48,107 @@ bool QgsFeatureSink::addFeatures( QgsFeatureIterator &iterator, QgsFeatureSink::
 QgsProxyFeatureSink::QgsProxyFeatureSink( QgsFeatureSink *sink )
   : mSink( sink )
 {}
+
+
+//
+// QgsQueuedFeatureSink
+//
+
+QgsQueuedFeatureSink::QgsQueuedFeatureSink( QgsFeatureSink *sink, int batchSize, int maxQueuedBatches )
+  : mSink( sink )
+  , mBatchSize( batchSize )
+  , mMaxQueuedBatches( maxQueuedBatches )
+{
+  mWriterFuture = QtConcurrent::run( this, &QgsQueuedFeatureSink::writerRun );
+}
+
+QgsQueuedFeatureSink::~QgsQueuedFeatureSink()
+{
+  if ( !mFinished )
+    flushBuffer();
+}
+
+bool QgsQueuedFeatureSink::addFeature( QgsFeature &feature, QgsFeatureSink::Flags flags )
+{
+  QMutexLocker locker( &mMutex );
+  if ( mWriteErrorOccurred )
+    return false;
+
+  // a batch carries a single set of flags - start a new one if they change
+  if ( !mCurrentBatch.features.isEmpty() && flags != mCurrentBatch.flags )
+    enqueueCurrentBatch();
+
+  mCurrentBatch.flags = flags;
+  mCurrentBatch.features.append( feature );
+  if ( mCurrentBatch.features.count() >= mBatchSize )
+    enqueueCurrentBatch();
+
+  return !mWriteErrorOccurred;
+}
+
+bool QgsQueuedFeatureSink::addFeatures( QgsFeatureList &features, QgsFeatureSink::Flags flags )
+{
+  bool result = true;
+  for ( QgsFeature &feature : features )
+    result = addFeature( feature, flags ) && result;
+  return result;
+}
+
+bool QgsQueuedFeatureSink::addFeatures( QgsFeatureIterator &iterator, QgsFeatureSink::Flags flags )
+{
+  QgsFeature f;
+  bool result = true;
+  while ( iterator.nextFeature( f ) )
+    result = addFeature( f, flags ) && result;
+  return result;
+}
+
+bool QgsQueuedFeatureSink::flushBuffer()
+{
+  {
+    QMutexLocker locker( &mMutex );
+    if ( !mCurrentBatch.features.isEmpty() )
+      enqueueCurrentBatch();
+    mFinished = true;
+    mNotEmpty.wakeAll();
+  }
+  mWriterFuture.waitForFinished();
+  return !mWriteErrorOccurred && mSink->flushBuffer();
+}
+
+void QgsQueuedFeatureSink::enqueueCurrentBatch()
+{
+  while ( mQueue.count() >= mMaxQueuedBatches && !mWriteErrorOccurred )
+    mNotFull.wait( &mMutex );
+
+  mQueue.append( mCurrentBatch );
+  mCurrentBatch = Batch();
+  mNotEmpty.wakeAll();
+}
+
+void QgsQueuedFeatureSink::writerRun()
+{
+  for ( ;; )
+  {
+    Batch batch;
+    {
+      QMutexLocker locker( &mMutex );
+      while ( mQueue.isEmpty() && !mFinished )
+        mNotEmpty.wait( &mMutex );
+
+      if ( mQueue.isEmpty() )
+        return;
+
+      batch = mQueue.takeFirst();
+      mNotFull.wakeAll();
+    }
+
+    if ( !mSink->addFeatures( batch.features, batch.flags ) )
+    {
+      QMutexLocker locker( &mMutex );
+      mWriteErrorOccurred = true;
+      // unblock a producer potentially waiting for queue space
+      mNotFull.wakeAll();
+    }
+  }
+}
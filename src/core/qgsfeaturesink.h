@@ -23,6 +23,10 @@
 #include "qgsfeature.h"
 #include "qgsfeatureiterator.h"
 
+#include <QFuture>
+#include <QMutex>
+#include <QWaitCondition>
+
 /**
  * \class QgsFeatureSink
  * \ingroup core
@@ -138,6 +142,96 @@ class CORE_EXPORT QgsProxyFeatureSink : public QgsFeatureSink
     QgsFeatureSink *mSink = nullptr;
 };
 
+/**
+ * \class QgsQueuedFeatureSink
+ * \ingroup core
+ * A feature sink which queues added features in a bounded channel and writes them
+ * to a destination sink from a background thread.
+ *
+ * This decouples per-feature computation from sink I/O: while the caller is busy
+ * producing the next features, already queued features are written out concurrently.
+ * The channel is bounded, so a slow destination sink applies backpressure to the
+ * producer instead of buffering unlimited features in memory.
+ *
+ * Since writes happen asynchronously, the ids of added features are NOT updated to
+ * reflect the ids assigned by the destination sink, and write errors are only
+ * reported by the final flushBuffer() call. Callers must call flushBuffer() (or
+ * destroy the sink) before reading from the destination.
+ *
+ * The destination sink must not be accessed by any other thread until flushBuffer()
+ * has returned.
+ *
+ * \note not available in Python bindings
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsQueuedFeatureSink : public QgsFeatureSink SIP_SKIP
+{
+  public:
+
+    /**
+     * Constructs a new QgsQueuedFeatureSink writing to a destination \a sink.
+     *
+     * Features are handed to the background writer in batches of \a batchSize features,
+     * and at most \a maxQueuedBatches batches are queued before addFeature() blocks.
+     *
+     * Ownership of \a sink is not transferred.
+     */
+    QgsQueuedFeatureSink( QgsFeatureSink *sink, int batchSize = 1000, int maxQueuedBatches = 4 );
+
+    ~QgsQueuedFeatureSink() override;
+
+    //! QgsQueuedFeatureSink cannot be copied
+    QgsQueuedFeatureSink( const QgsQueuedFeatureSink &other ) = delete;
+    //! QgsQueuedFeatureSink cannot be copied
+    QgsQueuedFeatureSink &operator=( const QgsQueuedFeatureSink &other ) = delete;
+
+    bool addFeature( QgsFeature &feature, QgsFeatureSink::Flags flags = nullptr ) override;
+    bool addFeatures( QgsFeatureList &features, QgsFeatureSink::Flags flags = nullptr ) override;
+    bool addFeatures( QgsFeatureIterator &iterator, QgsFeatureSink::Flags flags = nullptr ) override;
+
+    /**
+     * Drains the queue, waits for the background writer to finish and flushes the
+     * destination sink.
+     *
+     * Returns TRUE if all queued features were successfully written. No further
+     * features may be added after calling this method.
+     */
+    bool flushBuffer() override;
+
+    /**
+     * Returns the destination QgsFeatureSink which the queued features are written to.
+     */
+    QgsFeatureSink *destinationSink() { return mSink; }
+
+  private:
+
+    //! A batch of features to write, together with the flags they were added with
+    struct Batch
+    {
+      QgsFeatureList features;
+      QgsFeatureSink::Flags flags = nullptr;
+    };
+
+    //! Pushes the current batch into the queue, blocking while the queue is full. Mutex must be locked.
+    void enqueueCurrentBatch();
+    //! Writer loop run in the background thread
+    void writerRun();
+
+    QgsFeatureSink *mSink = nullptr;
+    int mBatchSize = 1000;
+    int mMaxQueuedBatches = 4;
+
+    QMutex mMutex;
+    QWaitCondition mNotFull;
+    QWaitCondition mNotEmpty;
+    Batch mCurrentBatch;
+    QList< Batch > mQueue;
+    bool mFinished = false;
+    bool mWriteErrorOccurred = false;
+
+    QFuture< void > mWriterFuture;
+};
+
 Q_DECLARE_METATYPE( QgsFeatureSink * )
 
 #endif // QGSFEATURESINK_H
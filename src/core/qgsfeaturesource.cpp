@@ -178,7 +178,7 @@ QgsVectorLayer *QgsFeatureSource::materialize( const QgsFeatureRequest &request,
         }
       }
 
-      f.setAttributes( attrs );
+      f.setAttributes( std::move( attrs ) );
     }
 
     layer->dataProvider()->addFeature( f, QgsFeatureSink::FastInsert );
@@ -27,6 +27,7 @@
 #include <QFontInfo>
 #include <QStringList>
 #include <QMimeData>
+#include <QThreadStorage>
 #include <memory>
 
 bool QgsFontUtils::fontMatchOnSystem( const QFont &f )
@@ -542,3 +543,29 @@ QStringList QgsFontUtils::recentFontFamilies()
   QgsSettings settings;
   return settings.value( QStringLiteral( "fonts/recent" ) ).toStringList();
 }
+
+QFontMetricsF QgsFontUtils::cachedMetrics( const QFont &font )
+{
+  // the cache is kept per thread, so lookups never need a lock and the underlying font
+  // engine is not shared between render threads
+  static QThreadStorage< QHash< QString, QFontMetricsF > > sCaches;
+  QHash< QString, QFontMetricsF > &cache = sCaches.localData();
+
+  // QFont::key() does not cover the spacing and capitalization attributes, but these
+  // affect the metrics
+  const QString key = QStringLiteral( "%1|%2|%3|%4" ).arg( font.key() )
+                      .arg( font.letterSpacing() )
+                      .arg( font.wordSpacing() )
+                      .arg( static_cast< int >( font.capitalization() ) );
+
+  const QHash< QString, QFontMetricsF >::const_iterator it = cache.constFind( key );
+  if ( it != cache.constEnd() )
+    return it.value();
+
+  // keep the cache bounded - e.g. a data defined font size can otherwise yield a new
+  // entry per feature
+  if ( cache.size() >= 100 )
+    cache.clear();
+
+  return *cache.insert( key, QFontMetricsF( font ) );
+}
@@ -17,6 +17,7 @@
 #define QGSFONTUTILS_H
 
 #include <QFont>
+#include <QFontMetricsF>
 #include <QString>
 #include <QDomElement>
 
@@ -194,6 +195,19 @@ class CORE_EXPORT QgsFontUtils
      * \since QGIS 3.0
      */
     static QStringList recentFontFamilies();
+
+    /**
+     * Returns cached font metrics for \a font.
+     *
+     * Constructing a QFontMetricsF resolves the underlying font engine, which is measurably
+     * expensive when repeated per feature during label registration or rendering. This method
+     * returns a cheap copy of a cached metrics object instead. The cache is maintained per
+     * thread, so it is safe to call from any thread without locking.
+     *
+     * \note Not available in Python bindings
+     * \since QGIS 3.8
+     */
+    static QFontMetricsF cachedMetrics( const QFont &font ) SIP_SKIP;
 };
 
 // clazy:excludeall=qstring-allocations
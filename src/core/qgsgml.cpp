@@ -517,7 +517,7 @@ void QgsGmlStreamingParser::startElement( const XML_Char *el, const XML_Char **a
   {
     mParseModeStack.push( Coordinate );
     mCoorMode = QgsGmlStreamingParser::Coordinate;
-    mStringCash.clear();
+    mStringCash.resize( 0 );
     mCoordinateSeparator = readAttribute( QStringLiteral( "cs" ), attr );
     if ( mCoordinateSeparator.isEmpty() )
     {
@@ -534,7 +534,7 @@ void QgsGmlStreamingParser::startElement( const XML_Char *el, const XML_Char **a
   {
     mParseModeStack.push( QgsGmlStreamingParser::PosList );
     mCoorMode = QgsGmlStreamingParser::PosList;
-    mStringCash.clear();
+    mStringCash.resize( 0 );
     if ( elDimension == 0 )
     {
       QString srsDimension = readAttribute( QStringLiteral( "srsDimension" ), attr );
@@ -578,13 +578,13 @@ void QgsGmlStreamingParser::startElement( const XML_Char *el, const XML_Char **a
             isGMLNS && LOCALNAME_EQUALS( "lowerCorner" ) )
   {
     mParseModeStack.push( QgsGmlStreamingParser::LowerCorner );
-    mStringCash.clear();
+    mStringCash.resize( 0 );
   }
   else if ( parseMode == Envelope &&
             isGMLNS && LOCALNAME_EQUALS( "upperCorner" ) )
   {
     mParseModeStack.push( QgsGmlStreamingParser::UpperCorner );
-    mStringCash.clear();
+    mStringCash.resize( 0 );
   }
   else if ( parseMode == None && !mTypeNamePtr &&
             LOCALNAME_EQUALS( "Tuple" ) )
@@ -593,7 +593,7 @@ void QgsGmlStreamingParser::startElement( const XML_Char *el, const XML_Char **a
     mCurrentFeature = new QgsFeature( mFeatureCount );
     mCurrentFeature->setFields( mFields ); // allow name-based attribute lookups
     QgsAttributes attributes( mThematicAttributes.size() ); //add empty attributes
-    mCurrentFeature->setAttributes( attributes );
+    mCurrentFeature->setAttributes( std::move( attributes ) );
     mParseModeStack.push( QgsGmlStreamingParser::Tuple );
     mCurrentFeatureId.clear();
   }
@@ -648,7 +648,7 @@ void QgsGmlStreamingParser::startElement( const XML_Char *el, const XML_Char **a
     mCurrentFeature = new QgsFeature( mFeatureCount );
     mCurrentFeature->setFields( mFields ); // allow name-based attribute lookups
     QgsAttributes attributes( mThematicAttributes.size() ); //add empty attributes
-    mCurrentFeature->setAttributes( attributes );
+    mCurrentFeature->setAttributes( std::move( attributes ) );
     mParseModeStack.push( QgsGmlStreamingParser::Feature );
     mCurrentFeatureId = readAttribute( QStringLiteral( "fid" ), attr );
     if ( mCurrentFeatureId.isEmpty() )
@@ -723,7 +723,7 @@ void QgsGmlStreamingParser::startElement( const XML_Char *el, const XML_Char **a
     {
       mParseModeStack.push( QgsGmlStreamingParser::AttributeTuple );
       mAttributeName = mCurrentTypename + '|' + localName;
-      mStringCash.clear();
+      mStringCash.resize( 0 );
     }
   }
   else if ( parseMode == Feature )
@@ -733,7 +733,7 @@ void QgsGmlStreamingParser::startElement( const XML_Char *el, const XML_Char **a
     {
       mParseModeStack.push( QgsGmlStreamingParser::Attribute );
       mAttributeName = localName;
-      mStringCash.clear();
+      mStringCash.resize( 0 );
     }
     else
     {
@@ -772,7 +772,7 @@ void QgsGmlStreamingParser::startElement( const XML_Char *el, const XML_Char **a
   }
   else if ( mIsException &&  LOCALNAME_EQUALS( "ExceptionText" ) )
   {
-    mStringCash.clear();
+    mStringCash.resize( 0 );
     mParseModeStack.push( QgsGmlStreamingParser::ExceptionText );
   }
   else if ( mParseDepth == 1 && LOCALNAME_EQUALS( "truncatedResponse" ) )
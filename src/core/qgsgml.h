@@ -286,7 +286,11 @@ class CORE_EXPORT QgsGmlStreamingParser
     QString mCurrentTypename; //!< Used to track the current (unprefixed) typename for wfs:Member in join layer
     //! Keep track about the most important nested elements
     QStack<ParseMode> mParseModeStack;
-    //! This contains the character data if an important element has been encountered
+    /**
+     * This contains the character data if an important element has been encountered.
+     * Reset with resize( 0 ) rather than clear(), so its allocation is recycled
+     * between the features of a response.
+     */
     QString mStringCash;
     QgsFeature *mCurrentFeature = nullptr;
     QVector<QVariant> mCurrentAttributes; //attributes of current feature
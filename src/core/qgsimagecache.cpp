@@ -18,6 +18,7 @@
 #include "qgsimagecache.h"
 
 #include "qgis.h"
+#include "qgscachebudgetmanager.h"
 #include "qgsimageoperation.h"
 #include "qgslogger.h"
 #include "qgsnetworkaccessmanager.h"
@@ -99,6 +100,24 @@ QgsImageCache::QgsImageCache( QObject *parent )
   }
 
   connect( this, &QgsAbstractContentCacheBase::remoteContentFetched, this, &QgsImageCache::remoteImageFetched );
+
+  mCacheBudgetHandle = QgsCacheBudgetManager::instance()->registerCache( QStringLiteral( "Images" ),
+                       [this]() -> qint64
+  {
+    QMutexLocker locker( &mMutex );
+    return mTotalSize;
+  },
+  [this]( qint64 maximumCost )
+  {
+    QMutexLocker locker( &mMutex );
+    mMaxCacheSize = static_cast< long >( maximumCost );
+    trimToMaximumSize();
+  } );
+}
+
+QgsImageCache::~QgsImageCache()
+{
+  QgsCacheBudgetManager::instance()->unregisterCache( mCacheBudgetHandle );
 }
 
 QImage QgsImageCache::pathAsImage( const QString &f, const QSize size, const bool keepAspectRatio, const double opacity, bool &fitsInCache )
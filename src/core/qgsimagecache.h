@@ -98,6 +98,8 @@ class CORE_EXPORT QgsImageCache : public QgsAbstractContentCache< QgsImageCacheE
      */
     QgsImageCache( QObject *parent SIP_TRANSFERTHIS = nullptr );
 
+    ~QgsImageCache() override;
+
     /**
      * Returns the specified \a path rendered as an image. If possible, a pre-existing cached
      * version of the image will be used. If not, the image is fetched and resampled to the desired
@@ -147,6 +149,9 @@ class CORE_EXPORT QgsImageCache : public QgsAbstractContentCache< QgsImageCacheE
 
     QByteArray mFetchingSvg;
 
+    //! Handle of this cache's registration with QgsCacheBudgetManager
+    int mCacheBudgetHandle = 0;
+
     friend class TestQgsImageCache;
 };
 
@@ -184,11 +184,14 @@ void QgsLabelingEngine::processProvider( QgsAbstractLabelProvider *provider, Qgs
 }
 
 
-void QgsLabelingEngine::run( QgsRenderContext &context )
+pal::Pal *QgsLabelingEngine::preparePal()
 {
+  if ( mPal )
+    return mPal.get();
+
   const QgsLabelingEngineSettings &settings = mMapSettings.labelingEngineSettings();
 
-  pal::Pal p;
+  mPal.reset( new pal::Pal() );
   pal::SearchMethod s;
   switch ( settings.searchMethod() )
   {
@@ -208,21 +211,57 @@ void QgsLabelingEngine::run( QgsRenderContext &context )
       s = pal::FALP;
       break;
   }
-  p.setSearch( s );
+  mPal->setSearch( s );
 
   // set number of candidates generated per feature
   int candPoint, candLine, candPolygon;
   settings.numCandidatePositions( candPoint, candLine, candPolygon );
-  p.setPointP( candPoint );
-  p.setLineP( candLine );
-  p.setPolyP( candPolygon );
+  mPal->setPointP( candPoint );
+  mPal->setLineP( candLine );
+  mPal->setPolyP( candPolygon );
 
-  p.setShowPartial( settings.testFlag( QgsLabelingEngineSettings::UsePartialCandidates ) );
+  mPal->setShowPartial( settings.testFlag( QgsLabelingEngineSettings::UsePartialCandidates ) );
 
+  return mPal.get();
+}
+
+void QgsLabelingEngine::registerLayerFeatures( const QString &layerId, QgsRenderContext &context )
+{
+  QMutexLocker locker( &mPalMutex );
+  pal::Pal *p = preparePal();
 
-  // for each provider: get labels and register them in PAL
   for ( QgsAbstractLabelProvider *provider : qgis::as_const( mProviders ) )
   {
+    if ( provider->layerId() != layerId || mProcessedProviders.contains( provider ) )
+      continue;
+
+    bool appendedLayerScope = false;
+    if ( QgsMapLayer *ml = provider->layer() )
+    {
+      appendedLayerScope = true;
+      context.expressionContext().appendScope( QgsExpressionContextUtils::layerScope( ml ) );
+    }
+    processProvider( provider, context, *p );
+    mProcessedProviders << provider;
+    if ( appendedLayerScope )
+      delete context.expressionContext().popScope();
+  }
+}
+
+void QgsLabelingEngine::run( QgsRenderContext &context )
+{
+  const QgsLabelingEngineSettings &settings = mMapSettings.labelingEngineSettings();
+
+  QMutexLocker locker( &mPalMutex );
+  pal::Pal &p = *preparePal();
+
+  // for each provider not already handled by registerLayerFeatures(): get labels
+  // and register them in PAL
+  for ( QgsAbstractLabelProvider *provider : qgis::as_const( mProviders ) )
+  {
+    if ( mProcessedProviders.contains( provider ) )
+      continue;
+
     bool appendedLayerScope = false;
     if ( QgsMapLayer *ml = provider->layer() )
     {
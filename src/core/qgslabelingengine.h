@@ -21,6 +21,8 @@
 #include "qgis_core.h"
 #include "qgsmapsettings.h"
 
+#include <QMutex>
+
 #include "qgspallabeling.h"
 #include "qgslabelingenginesettings.h"
 
@@ -200,6 +202,20 @@ class CORE_EXPORT QgsLabelingEngine
     //! Remove provider if the provider's initialization failed. Provider instance is deleted.
     void removeProvider( QgsAbstractLabelProvider *provider );
 
+    /**
+     * Registers the label features of all providers attached to the layer with matching
+     * \a layerId into the labeling problem, ahead of the final run().
+     *
+     * Render jobs call this from worker threads as soon as a layer has finished
+     * rendering, so that the label geometry preparation for that layer overlaps with
+     * the rendering of slower layers instead of being appended to it as a serial tail.
+     * Providers registered here are skipped by run(). Safe to call concurrently for
+     * different layers -- registrations are serialized internally.
+     *
+     * \since QGIS 3.8
+     */
+    void registerLayerFeatures( const QString &layerId, QgsRenderContext &context );
+
     //! compute the labeling with given map settings and providers
     void run( QgsRenderContext &context );
 
@@ -212,6 +228,11 @@ class CORE_EXPORT QgsLabelingEngine
   protected:
     void processProvider( QgsAbstractLabelProvider *provider, QgsRenderContext &context, pal::Pal &p );
 
+  private:
+
+    //! Returns the PAL instance configured from the engine settings, creating it on first use
+    pal::Pal *preparePal();
+
   protected:
     //! Associated map settings instance
     QgsMapSettings mMapSettings;
@@ -223,6 +244,17 @@ class CORE_EXPORT QgsLabelingEngine
     //! Resulting labeling layout
     std::unique_ptr< QgsLabelingResults > mResults;
 
+  private:
+
+    //! PAL instance holding the labeling problem, shared by pre-registration and run()
+    std::unique_ptr< pal::Pal > mPal;
+
+    //! Providers whose features were already registered via registerLayerFeatures()
+    QSet< QgsAbstractLabelProvider * > mProcessedProviders;
+
+    //! Serializes concurrent access to mPal and mProcessedProviders
+    QMutex mPalMutex;
+
 };
 
 
@@ -214,6 +214,7 @@ void QgsMapLayer::setBlendMode( const QPainter::CompositionMode blendMode )
   mBlendMode = blendMode;
   emit blendModeChanged( blendMode );
   emit styleChanged();
+  emit recompositionRequested();
 }
 
 QPainter::CompositionMode QgsMapLayer::blendMode() const
@@ -222,9 +223,10 @@ QPainter::CompositionMode QgsMapLayer::blendMode() const
 }
 
 
-bool QgsMapLayer::readLayerXml( const QDomElement &layerElement, QgsReadWriteContext &context )
+bool QgsMapLayer::readLayerXml( const QDomElement &layerElement, QgsReadWriteContext &context, QgsMapLayer::ReadFlags flags )
 {
   bool layerError;
+  mReadFlags = flags;
 
   QDomNode mnl;
   QDomElement mne;
@@ -1789,6 +1791,21 @@ void QgsMapLayer::triggerRepaint( bool deferredUpdate )
   emit repaintRequested( deferredUpdate );
 }
 
+void QgsMapLayer::triggerLabelsRepaint()
+{
+  emit labelsRepaintRequested();
+}
+
+void QgsMapLayer::triggerRegionRepaint( const QgsRectangle &extent )
+{
+  if ( extent.isNull() )
+  {
+    triggerRepaint();
+    return;
+  }
+  emit regionRepaintRequested( extent );
+}
+
 void QgsMapLayer::setMetadata( const QgsLayerMetadata &metadata )
 {
   mMetadata = metadata;
@@ -1911,11 +1928,13 @@ void QgsMapLayer::setRefreshOnNotifyEnabled( bool enabled )
   {
     dataProvider()->setListening( enabled );
     connect( dataProvider(), &QgsVectorDataProvider::notify, this, &QgsMapLayer::onNotifiedTriggerRepaint );
+    connect( dataProvider(), &QgsVectorDataProvider::dataRegionChanged, this, &QgsMapLayer::onNotifiedRegionChanged );
   }
   else if ( !enabled && isRefreshOnNotifyEnabled() )
   {
     // we don't want to disable provider listening because someone else could need it (e.g. actions)
     disconnect( dataProvider(), &QgsVectorDataProvider::notify, this, &QgsMapLayer::onNotifiedTriggerRepaint );
+    disconnect( dataProvider(), &QgsVectorDataProvider::dataRegionChanged, this, &QgsMapLayer::onNotifiedRegionChanged );
   }
   mIsRefreshOnNofifyEnabled = enabled;
 }
@@ -1926,3 +1945,10 @@ void QgsMapLayer::onNotifiedTriggerRepaint( const QString &message )
     triggerRepaint();
 }
 
+void QgsMapLayer::onNotifiedRegionChanged( const QgsRectangle &extent )
+{
+  // differential notifications bypass the message filter -- they already
+  // identify this layer's table precisely
+  triggerRegionRepaint( extent );
+}
+
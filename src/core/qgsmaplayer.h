@@ -162,6 +162,16 @@ class CORE_EXPORT QgsMapLayer : public QObject
     Q_DECLARE_FLAGS( StyleCategories, StyleCategory )
     Q_FLAG( StyleCategories )
 
+    /**
+     * Flags which control layer read behavior.
+     * \since QGIS 3.8
+     */
+    enum ReadFlag
+    {
+      FlagDontResolveLayers = 1 << 0, //!< Don't create the layer's data provider when reading. The layer is left invalid until its data source is set, which dramatically speeds up project read when the layer content is not immediately required.
+    };
+    Q_DECLARE_FLAGS( ReadFlags, ReadFlag )
+
     /**
      * Constructor for QgsMapLayer
      * \param type layer type
@@ -520,6 +530,7 @@ class CORE_EXPORT QgsMapLayer : public QObject
      * Sets state from DOM document
      * \param layerElement The DOM element corresponding to ``maplayer'' tag
      * \param context writing context (e.g. for conversion between relative and absolute paths)
+     * \param flags optional flags which control layer read behavior (since QGIS 3.8)
      * \note
      *
      * The DOM node corresponds to a DOM document project file XML element read
@@ -532,7 +543,7 @@ class CORE_EXPORT QgsMapLayer : public QObject
      *
      * \returns TRUE if successful
      */
-    bool readLayerXml( const QDomElement &layerElement, QgsReadWriteContext &context );
+    bool readLayerXml( const QDomElement &layerElement, QgsReadWriteContext &context, QgsMapLayer::ReadFlags flags = nullptr );
 
     /**
      * Stores state in DOM node
@@ -1163,6 +1174,31 @@ class CORE_EXPORT QgsMapLayer : public QObject
      */
     void triggerRepaint( bool deferredUpdate = false );
 
+    /**
+     * Will advise the map canvas (and any other interested party) that only the labeling
+     * of this layer has changed, and emit a labelsRepaintRequested() signal.
+     *
+     * Unlike triggerRepaint(), cached renderings of the layer stack remain valid, so
+     * views only need to re-run the labeling stage instead of re-rendering every layer.
+     *
+     * \see triggerRepaint()
+     * \since QGIS 3.8
+     */
+    void triggerLabelsRepaint();
+
+    /**
+     * Will advise the map canvas (and any other interested party) that only the
+     * given \a extent (in layer CRS) of this layer has changed, and emit a
+     * regionRepaintRequested() signal.
+     *
+     * Unlike triggerRepaint(), cached renderings of the layer remain valid outside
+     * the changed region, so views only need to re-render the dirty rectangle.
+     *
+     * \see triggerRepaint()
+     * \since QGIS 3.8
+     */
+    void triggerRegionRepaint( const QgsRectangle &extent );
+
     /**
      * Triggers an emission of the styleChanged() signal.
      * \since QGIS 2.16
@@ -1218,6 +1254,31 @@ class CORE_EXPORT QgsMapLayer : public QObject
      */
     void repaintRequested( bool deferredUpdate = false );
 
+    /**
+     * Emitted when a style change only affects how already rendered images of the layer
+     * are composited into the map, i.e. the layer opacity or blend mode changed.
+     * Unlike repaintRequested(), listeners holding cached renderings of the layer may
+     * keep them and only need to re-composite the final map image.
+     * \since QGIS 3.8
+     */
+    void recompositionRequested();
+
+    /**
+     * Emitted by triggerLabelsRepaint() when only the labeling of the layer has changed.
+     * \see triggerLabelsRepaint()
+     * \since QGIS 3.8
+     */
+    void labelsRepaintRequested();
+
+    /**
+     * Emitted by triggerRegionRepaint() when only the given \a extent (in layer CRS)
+     * of the layer has changed. Listeners holding cached renderings of the layer may
+     * keep them and only need to re-render the affected region.
+     * \see triggerRegionRepaint()
+     * \since QGIS 3.8
+     */
+    void regionRepaintRequested( const QgsRectangle &extent );
+
     //! This is used to send a request that any mapcanvas using this layer update its extents
     void recalculateExtents() const;
 
@@ -1309,6 +1370,8 @@ class CORE_EXPORT QgsMapLayer : public QObject
 
     void onNotifiedTriggerRepaint( const QString &message );
 
+    void onNotifiedRegionChanged( const QgsRectangle &extent );
+
   protected:
 
     /**
@@ -1458,6 +1521,8 @@ class CORE_EXPORT QgsMapLayer : public QObject
     //! Data provider key (name of the data provider)
     QString mProviderKey;
 
+    //! Read flags. It's up to the subclass to respect these when restoring state from XML
+    QgsMapLayer::ReadFlags mReadFlags = nullptr;
 
   private:
 
@@ -1536,6 +1601,7 @@ class CORE_EXPORT QgsMapLayer : public QObject
 Q_DECLARE_METATYPE( QgsMapLayer * )
 Q_DECLARE_OPERATORS_FOR_FLAGS( QgsMapLayer::LayerFlags )
 Q_DECLARE_OPERATORS_FOR_FLAGS( QgsMapLayer::StyleCategories )
+Q_DECLARE_OPERATORS_FOR_FLAGS( QgsMapLayer::ReadFlags )
 
 
 #ifndef SIP_RUN
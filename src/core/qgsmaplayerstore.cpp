@@ -22,6 +22,7 @@
 
 QgsMapLayerStore::QgsMapLayerStore( QObject *parent )
   : QObject( parent )
+  , mLayerSnapshot( std::make_shared< QMap< QString, QgsMapLayer * > >() )
 {}
 
 QgsMapLayerStore::~QgsMapLayerStore()
@@ -31,14 +32,14 @@ QgsMapLayerStore::~QgsMapLayerStore()
 
 int QgsMapLayerStore::count() const
 {
-  return mMapLayers.size();
+  return layerSnapshot()->size();
 }
 
 int QgsMapLayerStore::validCount() const
 {
   int i = 0;
-  const QList<QgsMapLayer *> cLayers = mMapLayers.values();
-  for ( const auto l : cLayers )
+  const std::shared_ptr< const QMap< QString, QgsMapLayer * > > snapshot = layerSnapshot();
+  for ( const auto l : *snapshot )
   {
     if ( l->isValid() )
       i++;
@@ -48,13 +49,14 @@ int QgsMapLayerStore::validCount() const
 
 QgsMapLayer *QgsMapLayerStore::mapLayer( const QString &layerId ) const
 {
-  return mMapLayers.value( layerId );
+  return layerSnapshot()->value( layerId );
 }
 
 QList<QgsMapLayer *> QgsMapLayerStore::mapLayersByName( const QString &layerName ) const
 {
   QList<QgsMapLayer *> myResultList;
-  Q_FOREACH ( QgsMapLayer *layer, mMapLayers )
+  const std::shared_ptr< const QMap< QString, QgsMapLayer * > > snapshot = layerSnapshot();
+  for ( QgsMapLayer *layer : *snapshot )
   {
     if ( layer->name() == layerName )
     {
@@ -64,6 +66,19 @@ QList<QgsMapLayer *> QgsMapLayerStore::mapLayersByName( const QString &layerName
   return myResultList;
 }
 
+std::shared_ptr< const QMap< QString, QgsMapLayer * > > QgsMapLayerStore::layerSnapshot() const
+{
+  return std::atomic_load( &mLayerSnapshot );
+}
+
+void QgsMapLayerStore::publishLayerSnapshot()
+{
+  // readers holding the previous snapshot keep it alive through their
+  // shared_ptr, so mutations never invalidate an iteration in progress
+  std::atomic_store( &mLayerSnapshot,
+                     std::shared_ptr< const QMap< QString, QgsMapLayer * > >( std::make_shared< QMap< QString, QgsMapLayer * > >( mMapLayers ) ) );
+}
+
 QList<QgsMapLayer *> QgsMapLayerStore::addMapLayers( const QList<QgsMapLayer *> &layers, bool takeOwnership )
 {
   QList<QgsMapLayer *> myResultList;
@@ -78,6 +93,7 @@ QList<QgsMapLayer *> QgsMapLayerStore::addMapLayers( const QList<QgsMapLayer *>
     if ( !mMapLayers.contains( myLayer->id() ) )
     {
       mMapLayers[myLayer->id()] = myLayer;
+      publishLayerSnapshot();
       myResultList << mMapLayers[myLayer->id()];
       if ( takeOwnership )
       {
@@ -143,6 +159,7 @@ void QgsMapLayerStore::removeMapLayers( const QList<QgsMapLayer *> &layers )
     emit layerWillBeRemoved( myId );
     emit layerWillBeRemoved( lyr );
     mMapLayers.remove( myId );
+    publishLayerSnapshot();
     if ( lyr->parent() == this )
     {
       delete lyr;
@@ -177,6 +194,7 @@ QgsMapLayer *QgsMapLayerStore::takeMapLayer( QgsMapLayer *layer )
     emit layerWillBeRemoved( layer );
 
     mMapLayers.remove( layer->id() );
+    publishLayerSnapshot();
     layer->setParent( nullptr );
     emit layerRemoved( layer->id() );
     emit layersRemoved( QStringList() << layer->id() );
@@ -192,6 +210,7 @@ void QgsMapLayerStore::removeAllMapLayers()
   // and then consequently any of their map legends
   removeMapLayers( mMapLayers.keys() );
   mMapLayers.clear();
+  publishLayerSnapshot();
 }
 
 void QgsMapLayerStore::transferLayersFromStore( QgsMapLayerStore *other )
@@ -219,21 +238,23 @@ void QgsMapLayerStore::onMapLayerDeleted( QObject *obj )
   {
     QgsDebugMsg( QStringLiteral( "Map layer deleted without unregistering! %1" ).arg( id ) );
     mMapLayers.remove( id );
+    publishLayerSnapshot();
   }
 }
 
 QMap<QString, QgsMapLayer *> QgsMapLayerStore::mapLayers() const
 {
-  return mMapLayers;
+  return *layerSnapshot();
 }
 
 QMap<QString, QgsMapLayer *> QgsMapLayerStore::validMapLayers() const
 {
   QMap<QString, QgsMapLayer *> validLayers;
-  for ( const auto &id : mMapLayers.keys() )
+  const std::shared_ptr< const QMap< QString, QgsMapLayer * > > snapshot = layerSnapshot();
+  for ( auto it = snapshot->constBegin(); it != snapshot->constEnd(); ++it )
   {
-    if ( mMapLayers[id]->isValid() )
-      validLayers[id] = mMapLayers[id];
+    if ( it.value()->isValid() )
+      validLayers[it.key()] = it.value();
   }
   return validLayers;
 }
@@ -23,6 +23,7 @@
 #include "qgis_sip.h"
 #include "qgsmaplayer.h"
 #include <QObject>
+#include <memory>
 
 /**
  * \class QgsMapLayerStore
@@ -124,8 +125,9 @@ class CORE_EXPORT QgsMapLayerStore : public QObject
     QVector<T> layers() const
     {
       QVector<T> layers;
-      QMap<QString, QgsMapLayer *>::const_iterator layerIt = mMapLayers.constBegin();
-      for ( ; layerIt != mMapLayers.constEnd(); ++layerIt )
+      const std::shared_ptr< const QMap< QString, QgsMapLayer * > > snapshot = layerSnapshot();
+      QMap<QString, QgsMapLayer *>::const_iterator layerIt = snapshot->constBegin();
+      for ( ; layerIt != snapshot->constEnd(); ++layerIt )
       {
         T tLayer = qobject_cast<T>( layerIt.value() );
         if ( tLayer )
@@ -135,6 +137,22 @@ class CORE_EXPORT QgsMapLayerStore : public QObject
       }
       return layers;
     }
+
+    /**
+     * Returns an immutable shared snapshot of the layer registry.
+     *
+     * The snapshot can be read from any thread without locking: every mutation
+     * of the store atomically publishes a new snapshot and never modifies
+     * previously returned ones, so readers (render threads, expression
+     * functions, server requests) iterate a stable registry even while layers
+     * are added or removed concurrently. The snapshot only keeps the registry
+     * structure alive -- the lifetime of the layers themselves remains bound to
+     * the store, exactly as with the other accessors.
+     *
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    std::shared_ptr< const QMap< QString, QgsMapLayer * > > layerSnapshot() const;
 #endif
 
     /**
@@ -357,8 +375,14 @@ class CORE_EXPORT QgsMapLayerStore : public QObject
 
   private:
 
+    //! Atomically replaces the published snapshot with a copy of mMapLayers
+    void publishLayerSnapshot();
+
     QMap<QString, QgsMapLayer *> mMapLayers;
 
+    //! Immutable copy of mMapLayers, published after every mutation and read without locking
+    std::shared_ptr< const QMap< QString, QgsMapLayer * > > mLayerSnapshot;
+
 };
 
 #endif //QGSMAPLAYERSTORE_H
@@ -15,12 +15,60 @@
 
 #include "qgsmaprenderercache.h"
 
+#include "qgscachebudgetmanager.h"
 #include "qgsmaplayer.h"
 #include "qgsmaplayerlistutils.h"
+#include "qgssettings.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <QtConcurrentRun>
 
 QgsMapRendererCache::QgsMapRendererCache()
 {
+  QgsSettings settings;
+  mPersistentCacheDir = settings.value( QStringLiteral( "cache/renderCacheDirectory" ) ).toString();
+  if ( mPersistentCacheDir.isEmpty() )
+    mPersistentCacheDir = QStandardPaths::writableLocation( QStandardPaths::CacheLocation ) + QStringLiteral( "/render-cache" );
+
+  if ( settings.value( QStringLiteral( "cache/persistentRenderCache" ), false ).toBool() )
+    setPersistentCacheEnabled( true );
+
   clear();
+
+  mCacheBudgetHandle = QgsCacheBudgetManager::instance()->registerCache( QStringLiteral( "Map render results" ),
+                       [this]() -> qint64
+  {
+    QMutexLocker lock( &mMutex );
+    qint64 cost = 0;
+    for ( auto it = mCachedImages.constBegin(); it != mCachedImages.constEnd(); ++it )
+      cost += it.value().cachedImage.byteCount() + it.value().cachedPreviewImage.byteCount();
+    return cost;
+  },
+  [this]( qint64 maximumCost )
+  {
+    // the cache keeps no access ordering, so evict arbitrary images until the
+    // remaining ones fit within the allocated share of the budget
+    QMutexLocker lock( &mMutex );
+    qint64 cost = 0;
+    for ( auto it = mCachedImages.constBegin(); it != mCachedImages.constEnd(); ++it )
+      cost += it.value().cachedImage.byteCount() + it.value().cachedPreviewImage.byteCount();
+    auto it = mCachedImages.begin();
+    while ( cost > maximumCost && it != mCachedImages.end() )
+    {
+      cost -= it.value().cachedImage.byteCount() + it.value().cachedPreviewImage.byteCount();
+      it = mCachedImages.erase( it );
+    }
+    if ( cost > maximumCost )
+      mCachedFeatures.clear();
+  } );
+}
+
+QgsMapRendererCache::~QgsMapRendererCache()
+{
+  QgsCacheBudgetManager::instance()->unregisterCache( mCacheBudgetHandle );
 }
 
 void QgsMapRendererCache::clear()
@@ -34,16 +82,19 @@ void QgsMapRendererCache::clearInternal()
   mExtent.setMinimal();
   mScale = 0;
 
+  mCachedImages.clear();
+  mCachedFeatures.clear();
+
   // make sure we are disconnected from all layers
   Q_FOREACH ( const QgsWeakMapLayerPointer &layer, mConnectedLayers )
   {
     if ( layer.data() )
     {
       disconnect( layer.data(), &QgsMapLayer::repaintRequested, this, &QgsMapRendererCache::layerRequestedRepaint );
+      disconnect( layer.data(), &QgsMapLayer::regionRepaintRequested, this, &QgsMapRendererCache::layerRequestedRegionRepaint );
       disconnect( layer.data(), &QgsMapLayer::willBeDeleted, this, &QgsMapRendererCache::layerRequestedRepaint );
     }
   }
-  mCachedImages.clear();
   mConnectedLayers.clear();
 }
 
@@ -56,6 +107,7 @@ void QgsMapRendererCache::dropUnusedConnections()
     if ( layer.data() )
     {
       disconnect( layer.data(), &QgsMapLayer::repaintRequested, this, &QgsMapRendererCache::layerRequestedRepaint );
+      disconnect( layer.data(), &QgsMapLayer::regionRepaintRequested, this, &QgsMapRendererCache::layerRequestedRegionRepaint );
       disconnect( layer.data(), &QgsMapLayer::willBeDeleted, this, &QgsMapRendererCache::layerRequestedRepaint );
     }
   }
@@ -75,6 +127,12 @@ QSet<QgsWeakMapLayerPointer > QgsMapRendererCache::dependentLayers() const
         result << l;
     }
   }
+  QMap<QString, CachedFeatures>::const_iterator fIt = mCachedFeatures.constBegin();
+  for ( ; fIt != mCachedFeatures.constEnd(); ++fIt )
+  {
+    if ( fIt.value().layer.data() )
+      result << fIt.value().layer;
+  }
   return result;
 }
 
@@ -87,7 +145,10 @@ bool QgsMapRendererCache::init( const QgsRectangle &extent, double scale )
        qgsDoubleNear( scale, mScale ) )
     return true;
 
-  clearInternal();
+  // cached images are only valid for the previous extent and scale, but keep
+  // the retained features -- reuse across panned extents is their whole purpose
+  mCachedImages.clear();
+  dropUnusedConnections();
 
   // set new params
   mExtent = extent;
@@ -96,6 +157,18 @@ bool QgsMapRendererCache::init( const QgsRectangle &extent, double scale )
   return false;
 }
 
+QgsRectangle QgsMapRendererCache::extent() const
+{
+  QMutexLocker lock( &mMutex );
+  return mExtent;
+}
+
+double QgsMapRendererCache::scale() const
+{
+  QMutexLocker lock( &mMutex );
+  return mScale;
+}
+
 void QgsMapRendererCache::setCacheImage( const QString &cacheKey, const QImage &image, const QList<QgsMapLayer *> &dependentLayers )
 {
   QMutexLocker lock( &mMutex );
@@ -109,21 +182,195 @@ void QgsMapRendererCache::setCacheImage( const QString &cacheKey, const QImage &
     if ( layer )
     {
       params.dependentLayers << layer;
-      if ( !mConnectedLayers.contains( QgsWeakMapLayerPointer( layer ) ) )
-      {
-        connect( layer, &QgsMapLayer::repaintRequested, this, &QgsMapRendererCache::layerRequestedRepaint );
-        connect( layer, &QgsMapLayer::willBeDeleted, this, &QgsMapRendererCache::layerRequestedRepaint );
-        mConnectedLayers << layer;
-      }
+      connectDependentLayer( layer );
     }
   }
 
   mCachedImages[cacheKey] = params;
+
+  // only per-layer images are persisted - composite images (e.g. the label cache)
+  // depend on multiple layers and cannot be reliably invalidated after a restart
+  if ( mPersistentCacheEnabled && dependentLayers.count() == 1 && dependentLayers.at( 0 )
+       && dependentLayers.at( 0 )->id() == cacheKey )
+  {
+    const QString path = persistentImagePath( cacheKey );
+    QDir().mkpath( QFileInfo( path ).absolutePath() );
+    // QImage is implicitly shared, so encoding can safely happen off-thread
+    QtConcurrent::run( [image, path]
+    {
+      image.save( path, "PNG" );
+    } );
+  }
+}
+
+void QgsMapRendererCache::connectDependentLayer( QgsMapLayer *layer )
+{
+  if ( !mConnectedLayers.contains( QgsWeakMapLayerPointer( layer ) ) )
+  {
+    connect( layer, &QgsMapLayer::repaintRequested, this, &QgsMapRendererCache::layerRequestedRepaint );
+    connect( layer, &QgsMapLayer::regionRepaintRequested, this, &QgsMapRendererCache::layerRequestedRegionRepaint );
+    connect( layer, &QgsMapLayer::willBeDeleted, this, &QgsMapRendererCache::layerRequestedRepaint );
+    mConnectedLayers << layer;
+  }
+}
+
+void QgsMapRendererCache::setCachedFeatures( QgsMapLayer *layer, const QgsRectangle &extent, double mapUnitsPerPixel, const QList<QgsFeature> &features )
+{
+  if ( !layer )
+    return;
+
+  QMutexLocker lock( &mMutex );
+
+  CachedFeatures entry;
+  entry.extent = extent;
+  entry.mapUnitsPerPixel = mapUnitsPerPixel;
+  entry.features = features;
+  entry.layer = layer;
+  mCachedFeatures[layer->id()] = entry;
+  connectDependentLayer( layer );
+}
+
+QList<QgsFeature> QgsMapRendererCache::cachedFeatures( const QString &layerId, double mapUnitsPerPixel, QgsRectangle &extent ) const
+{
+  QMutexLocker lock( &mMutex );
+
+  const QMap<QString, CachedFeatures>::const_iterator it = mCachedFeatures.constFind( layerId );
+  if ( it == mCachedFeatures.constEnd() || !qgsDoubleNear( it.value().mapUnitsPerPixel, mapUnitsPerPixel ) )
+    return QList<QgsFeature>();
+
+  extent = it.value().extent;
+  return it.value().features;
+}
+
+bool QgsMapRendererCache::restoreCacheImage( const QString &cacheKey, QgsMapLayer *layer )
+{
+  QMutexLocker lock( &mMutex );
+
+  if ( !mPersistentCacheEnabled || !layer || mCachedImages.contains( cacheKey ) )
+    return false;
+
+  QImage image;
+  if ( !image.load( persistentImagePath( cacheKey ), "PNG" ) || image.isNull() )
+    return false;
+
+  CacheParameters params;
+  params.cachedImage = image;
+  params.dependentLayers << layer;
+  connectDependentLayer( layer );
+  mCachedImages[cacheKey] = params;
+  return true;
+}
+
+void QgsMapRendererCache::setPersistentCacheEnabled( bool enabled )
+{
+  QMutexLocker lock( &mMutex );
+  if ( enabled == mPersistentCacheEnabled )
+    return;
+
+  mPersistentCacheEnabled = enabled;
+  if ( enabled )
+  {
+    QDir().mkpath( mPersistentCacheDir );
+    QgsSettings settings;
+    prunePersistentCache( settings.value( QStringLiteral( "cache/renderCacheSize" ), 256 * 1024 * 1024 ).toLongLong() );
+  }
+}
+
+void QgsMapRendererCache::clearPersistentCache()
+{
+  QMutexLocker lock( &mMutex );
+  QDir( mPersistentCacheDir ).removeRecursively();
+  if ( mPersistentCacheEnabled )
+    QDir().mkpath( mPersistentCacheDir );
+}
+
+QString QgsMapRendererCache::persistentKeyDirectory( const QString &cacheKey ) const
+{
+  const QByteArray keyHash = QCryptographicHash::hash( cacheKey.toUtf8(), QCryptographicHash::Sha1 ).toHex();
+  return mPersistentCacheDir + '/' + QString::fromLatin1( keyHash );
+}
+
+QString QgsMapRendererCache::persistentImagePath( const QString &cacheKey ) const
+{
+  const QString state = QStringLiteral( "%1|%2" ).arg( mExtent.toString( 17 ) ).arg( mScale, 0, 'g', 17 );
+  const QByteArray stateHash = QCryptographicHash::hash( state.toUtf8(), QCryptographicHash::Sha1 ).toHex();
+  return persistentKeyDirectory( cacheKey ) + '/' + QString::fromLatin1( stateHash ) + QStringLiteral( ".png" );
+}
+
+void QgsMapRendererCache::prunePersistentCache( qint64 maximumSize )
+{
+  QFileInfoList entries;
+  const QFileInfoList keyDirs = QDir( mPersistentCacheDir ).entryInfoList( QDir::Dirs | QDir::NoDotAndDotDot );
+  for ( const QFileInfo &keyDir : keyDirs )
+  {
+    entries << QDir( keyDir.absoluteFilePath() ).entryInfoList( QDir::Files );
+  }
+
+  qint64 totalSize = 0;
+  for ( const QFileInfo &entry : qgis::as_const( entries ) )
+    totalSize += entry.size();
+
+  if ( totalSize <= maximumSize )
+    return;
+
+  // drop oldest images first
+  std::sort( entries.begin(), entries.end(), []( const QFileInfo & a, const QFileInfo & b )
+  {
+    return a.lastModified() < b.lastModified();
+  } );
+
+  for ( const QFileInfo &entry : qgis::as_const( entries ) )
+  {
+    if ( totalSize <= maximumSize )
+      break;
+    totalSize -= entry.size();
+    QFile::remove( entry.absoluteFilePath() );
+  }
+}
+
+void QgsMapRendererCache::setPreviewCacheImage( const QString &cacheKey, const QImage &image, const QList<QgsMapLayer *> &dependentLayers )
+{
+  QMutexLocker lock( &mMutex );
+
+  // keep any full quality image already present -- it always wins over the preview
+  CacheParameters &params = mCachedImages[cacheKey];
+  params.cachedPreviewImage = image;
+
+  // connect to the layer to listen to layer's repaintRequested() signals
+  Q_FOREACH ( QgsMapLayer *layer, dependentLayers )
+  {
+    if ( layer )
+    {
+      params.dependentLayers << layer;
+      connectDependentLayer( layer );
+    }
+  }
+}
+
+bool QgsMapRendererCache::hasPreviewCacheImage( const QString &cacheKey ) const
+{
+  QMutexLocker lock( &mMutex );
+  const auto it = mCachedImages.constFind( cacheKey );
+  return it != mCachedImages.constEnd() && !it.value().cachedPreviewImage.isNull();
+}
+
+QImage QgsMapRendererCache::previewCacheImage( const QString &cacheKey ) const
+{
+  QMutexLocker lock( &mMutex );
+  return mCachedImages.value( cacheKey ).cachedPreviewImage;
 }
 
 bool QgsMapRendererCache::hasCacheImage( const QString &cacheKey ) const
 {
-  return mCachedImages.contains( cacheKey );
+  // an entry may hold only a preview quality image -- that does not count as a
+  // full quality cache hit
+  const auto it = mCachedImages.constFind( cacheKey );
+  const bool hit = it != mCachedImages.constEnd() && !it.value().cachedImage.isNull();
+  if ( hit )
+    QgsCacheBudgetManager::instance()->recordHit( mCacheBudgetHandle );
+  else
+    QgsCacheBudgetManager::instance()->recordMiss( mCacheBudgetHandle );
+  return hit;
 }
 
 QImage QgsMapRendererCache::cacheImage( const QString &cacheKey ) const
@@ -149,6 +396,9 @@ void QgsMapRendererCache::layerRequestedRepaint()
 
   QMutexLocker lock( &mMutex );
 
+  if ( mPersistentCacheEnabled )
+    QDir( persistentKeyDirectory( layer->id() ) ).removeRecursively();
+
   // check through all cached images to clear any which depend on this layer
   QMap<QString, CacheParameters>::iterator it = mCachedImages.begin();
   for ( ; it != mCachedImages.end(); )
@@ -161,13 +411,84 @@ void QgsMapRendererCache::layerRequestedRepaint()
 
     it = mCachedImages.erase( it );
   }
+  mCachedFeatures.remove( layer->id() );
   dropUnusedConnections();
 }
 
+void QgsMapRendererCache::layerRequestedRegionRepaint( const QgsRectangle &extent )
+{
+  QgsMapLayer *layer = qobject_cast<QgsMapLayer *>( sender() );
+  if ( !layer )
+    return;
+
+  QMutexLocker lock( &mMutex );
+
+  // the on-disk copy cannot be patched, so it is simply stale now
+  if ( mPersistentCacheEnabled )
+    QDir( persistentKeyDirectory( layer->id() ) ).removeRecursively();
+
+  QMap<QString, CacheParameters>::iterator it = mCachedImages.begin();
+  for ( ; it != mCachedImages.end(); )
+  {
+    if ( !it.value().dependentLayers.contains( layer ) )
+    {
+      ++it;
+      continue;
+    }
+
+    if ( it.key() == layer->id() )
+    {
+      // the layer's own image can be patched -- just accumulate the dirty region
+      if ( it.value().dirtyRegion.isNull() )
+        it.value().dirtyRegion = extent;
+      else
+        it.value().dirtyRegion.combineExtentWith( extent );
+      ++it;
+    }
+    else
+    {
+      // composite images (e.g. the label cache) depend on multiple layers and
+      // cannot be patched per layer
+      it = mCachedImages.erase( it );
+    }
+  }
+
+  // retained features may include stale geometries for the changed region
+  mCachedFeatures.remove( layer->id() );
+  dropUnusedConnections();
+}
+
+void QgsMapRendererCache::invalidateCacheImageRegion( const QString &cacheKey, const QgsRectangle &region )
+{
+  QMutexLocker lock( &mMutex );
+
+  const QMap<QString, CacheParameters>::iterator it = mCachedImages.find( cacheKey );
+  if ( it == mCachedImages.end() )
+    return;
+
+  if ( mPersistentCacheEnabled )
+    QDir( persistentKeyDirectory( cacheKey ) ).removeRecursively();
+
+  if ( it.value().dirtyRegion.isNull() )
+    it.value().dirtyRegion = region;
+  else
+    it.value().dirtyRegion.combineExtentWith( region );
+}
+
+QgsRectangle QgsMapRendererCache::cacheImageDirtyRegion( const QString &cacheKey ) const
+{
+  QMutexLocker lock( &mMutex );
+  return mCachedImages.value( cacheKey ).dirtyRegion;
+}
+
 void QgsMapRendererCache::clearCacheImage( const QString &cacheKey )
 {
   QMutexLocker lock( &mMutex );
 
+  if ( mPersistentCacheEnabled )
+    QDir( persistentKeyDirectory( cacheKey ) ).removeRecursively();
+
   mCachedImages.remove( cacheKey );
+  mCachedFeatures.remove( cacheKey );
   dropUnusedConnections();
 }
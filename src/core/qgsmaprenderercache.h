@@ -17,12 +17,14 @@
 #define QGSMAPRENDERERCACHE_H
 
 #include "qgis_core.h"
+#include "qgis_sip.h"
 #include <QMap>
 #include <QImage>
 #include <QMutex>
 
 #include "qgsrectangle.h"
 #include "qgsmaplayer.h"
+#include "qgsfeature.h"
 
 
 /**
@@ -46,6 +48,8 @@ class CORE_EXPORT QgsMapRendererCache : public QObject
 
     QgsMapRendererCache();
 
+    ~QgsMapRendererCache() override;
+
     /**
      * Invalidates the cache contents, clearing all cached images.
      * \see clearCacheImage()
@@ -59,6 +63,22 @@ class CORE_EXPORT QgsMapRendererCache : public QObject
      */
     bool init( const QgsRectangle &extent, double scale );
 
+    /**
+     * Returns the extent for which the cached images are valid, as set by the
+     * last init() call.
+     * \see scale()
+     * \since QGIS 3.8
+     */
+    QgsRectangle extent() const;
+
+    /**
+     * Returns the scale for which the cached images are valid, as set by the
+     * last init() call.
+     * \see extent()
+     * \since QGIS 3.8
+     */
+    double scale() const;
+
     /**
      * Set the cached \a image for a particular \a cacheKey. The \a cacheKey usually
      * matches the QgsMapLayer::id() which the image is a render of.
@@ -85,6 +105,106 @@ class CORE_EXPORT QgsMapRendererCache : public QObject
      */
     QImage cacheImage( const QString &cacheKey ) const;
 
+    /**
+     * Sets a preview-quality \a image for a particular \a cacheKey, as rendered by the
+     * cheap first pass of a progressive render job. Preview images are stored alongside
+     * the full quality image and invalidated with it, and are only ever substituted for
+     * renders which themselves carry the QgsMapSettings::RenderPreviewJob flag.
+     * \see previewCacheImage()
+     * \since QGIS 3.8
+     */
+    void setPreviewCacheImage( const QString &cacheKey, const QImage &image, const QList< QgsMapLayer * > &dependentLayers = QList< QgsMapLayer * >() );
+
+    /**
+     * Returns TRUE if the cache contains a preview-quality image with the specified \a cacheKey.
+     * \see setPreviewCacheImage()
+     * \since QGIS 3.8
+     */
+    bool hasPreviewCacheImage( const QString &cacheKey ) const;
+
+    /**
+     * Returns the preview-quality image for the specified \a cacheKey, or a null
+     * image if none is cached.
+     * \see setPreviewCacheImage()
+     * \since QGIS 3.8
+     */
+    QImage previewCacheImage( const QString &cacheKey ) const;
+
+    /**
+     * Attempts to restore a cached image for \a cacheKey from the persistent on-disk
+     * cache, for the current cache extent and scale.
+     *
+     * On success the image is inserted into the in-memory cache with \a layer registered
+     * as its dependent layer, so that subsequent repaintRequested() signals invalidate
+     * both the in-memory and the on-disk copy, and TRUE is returned.
+     *
+     * Returns FALSE if the persistent cache is disabled or contains no matching image.
+     *
+     * \note Images rendered while the persistent cache was disabled, or modified by
+     * another process while QGIS was not running, cannot be detected as stale.
+     *
+     * \see setPersistentCacheEnabled()
+     * \since QGIS 3.8
+     */
+    bool restoreCacheImage( const QString &cacheKey, QgsMapLayer *layer );
+
+    /**
+     * Sets whether rendered images are additionally stored in a persistent on-disk
+     * cache, keyed by extent and scale, so that revisiting an area (even after a
+     * restart) can reuse the previously rendered image instead of re-rendering.
+     *
+     * The on-disk cache is pruned to the size set by the cache/renderCacheSize
+     * setting when enabled.
+     *
+     * \see persistentCacheEnabled()
+     * \see restoreCacheImage()
+     * \since QGIS 3.8
+     */
+    void setPersistentCacheEnabled( bool enabled );
+
+    /**
+     * Returns TRUE if rendered images are additionally stored in a persistent
+     * on-disk cache.
+     * \see setPersistentCacheEnabled()
+     * \since QGIS 3.8
+     */
+    bool persistentCacheEnabled() const { return mPersistentCacheEnabled; }
+
+    /**
+     * Removes all images from the persistent on-disk cache.
+     * \since QGIS 3.8
+     */
+    void clearPersistentCache();
+
+    /**
+     * Stores the \a features fetched for \a layer while rendering \a extent at
+     * \a mapUnitsPerPixel, so that the next render job over an overlapping
+     * extent can reuse them and only fetch the newly exposed region from the
+     * provider. The features are invalidated whenever the layer requests a
+     * repaint, exactly like cached images.
+     *
+     * Unlike cached images, retained features survive extent changes -- reuse
+     * across panned extents is their whole purpose.
+     *
+     * \note not available in Python bindings
+     * \see cachedFeatures()
+     * \since QGIS 3.8
+     */
+    void setCachedFeatures( QgsMapLayer *layer, const QgsRectangle &extent, double mapUnitsPerPixel, const QList<QgsFeature> &features ) SIP_SKIP;
+
+    /**
+     * Returns the features retained from the previous render job of the layer
+     * with matching \a layerId, or an empty list if no features were retained
+     * or they were fetched at a different \a mapUnitsPerPixel (provider side
+     * geometry simplification makes them unusable at other resolutions).
+     * On success \a extent is set to the extent the features were fetched for.
+     *
+     * \note not available in Python bindings
+     * \see setCachedFeatures()
+     * \since QGIS 3.8
+     */
+    QList<QgsFeature> cachedFeatures( const QString &layerId, double mapUnitsPerPixel, QgsRectangle &extent ) const SIP_SKIP;
+
     /**
      * Returns a list of map layers on which an image in the cache depends.
      * \since QGIS 3.0
@@ -97,24 +217,70 @@ class CORE_EXPORT QgsMapRendererCache : public QObject
      */
     void clearCacheImage( const QString &cacheKey );
 
+    /**
+     * Marks the given \a region (in the CRS of the dependent layer) of the cached
+     * image with matching \a cacheKey as dirty, without discarding the image. The
+     * image remains available through cacheImage() so that a subsequent render job
+     * can reuse it and re-render the dirty region only.
+     * \see cacheImageDirtyRegion()
+     * \since QGIS 3.8
+     */
+    void invalidateCacheImageRegion( const QString &cacheKey, const QgsRectangle &region );
+
+    /**
+     * Returns the accumulated dirty region (in the CRS of the dependent layer) of the
+     * cached image with matching \a cacheKey, or a null rectangle if the image is
+     * fully valid. The dirty region is reset when a new image is stored for the key.
+     * \see invalidateCacheImageRegion()
+     * \since QGIS 3.8
+     */
+    QgsRectangle cacheImageDirtyRegion( const QString &cacheKey ) const;
+
   private slots:
     //! Remove layer (that emitted the signal) from the cache
     void layerRequestedRepaint();
 
+    //! Mark the changed region of the layer (that emitted the signal) dirty instead of dropping its image
+    void layerRequestedRegionRepaint( const QgsRectangle &extent );
+
   private:
 
     struct CacheParameters
     {
       QImage cachedImage;
+      //! Cheap first-pass render of the same content, for progressive refinement
+      QImage cachedPreviewImage;
+      //! Region of the image invalidated by differential change notifications, in the dependent layer's CRS
+      QgsRectangle dirtyRegion;
       QgsWeakMapLayerPointerList dependentLayers;
     };
 
+    struct CachedFeatures
+    {
+      QgsRectangle extent;
+      double mapUnitsPerPixel = 0;
+      QList<QgsFeature> features;
+      QgsWeakMapLayerPointer layer;
+    };
+
     //! Invalidate cache contents (without locking)
     void clearInternal();
 
     //! Disconnects from layers we no longer care about
     void dropUnusedConnections();
 
+    //! Connects to repaint/deletion signals of a dependent layer (without locking)
+    void connectDependentLayer( QgsMapLayer *layer );
+
+    //! Returns the on-disk path for a cached image (without locking)
+    QString persistentImagePath( const QString &cacheKey ) const;
+
+    //! Returns the on-disk directory holding all cached images for a cache key (without locking)
+    QString persistentKeyDirectory( const QString &cacheKey ) const;
+
+    //! Removes oldest images from the on-disk cache until it fits within \a maximumSize bytes
+    void prunePersistentCache( qint64 maximumSize );
+
     QSet< QgsWeakMapLayerPointer > dependentLayers() const;
 
     mutable QMutex mMutex;
@@ -123,8 +289,18 @@ class CORE_EXPORT QgsMapRendererCache : public QObject
 
     //! Map of cache key to cache parameters
     QMap<QString, CacheParameters> mCachedImages;
+    //! Map of layer id to the features retained from the previous render job
+    QMap<QString, CachedFeatures> mCachedFeatures;
     //! List of all layers on which this cache is currently connected
     QSet< QgsWeakMapLayerPointer > mConnectedLayers;
+
+    //! TRUE if cached images are also stored on disk
+    bool mPersistentCacheEnabled = false;
+    //! Directory holding the persistent on-disk cache
+    QString mPersistentCacheDir;
+
+    //! Handle of this cache's registration with QgsCacheBudgetManager
+    int mCacheBudgetHandle = 0;
 };
 
 
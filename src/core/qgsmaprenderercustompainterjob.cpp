@@ -23,7 +23,9 @@
 #include "qgsvectorlayer.h"
 #include "qgsrenderer.h"
 #include "qgsmaplayerlistutils.h"
+#include "qgssettings.h"
 
+#include <QtConcurrentMap>
 #include <QtConcurrentRun>
 
 QgsMapRendererCustomPainterJob::QgsMapRendererCustomPainterJob( const QgsMapSettings &settings, QPainter *painter )
@@ -82,7 +84,26 @@ void QgsMapRendererCustomPainterJob::start()
   }
 
   bool canUseLabelCache = prepareLabelCache();
-  mLayerJobs = prepareJobs( mPainter, mLabelingEngineV2.get() );
+
+  mParallelCompositing = mParallelRenderingEnabled;
+  if ( mParallelCompositing )
+  {
+    // every layer renders into its own full size image before being composited,
+    // so fall back to sequential rendering when the images would exhaust the
+    // memory budget (e.g. high DPI layout exports of projects with many layers)
+    const QSize outputSize = mSettings.deviceOutputSize();
+    const qint64 bytesPerLayer = static_cast< qint64 >( outputSize.width() ) * outputSize.height() * 4;
+    const qint64 budget = QgsSettings().value( QStringLiteral( "qgis/parallelCompositingMemoryBudgetMB" ), 1024 ).toLongLong() * 1024 * 1024;
+    if ( bytesPerLayer * mSettings.layers().count() > budget )
+    {
+      QgsDebugMsgLevel( QStringLiteral( "Layer images would exceed the parallel compositing memory budget, rendering sequentially" ), 2 );
+      mParallelCompositing = false;
+    }
+  }
+
+  // passing no painter to prepareJobs() gives every layer a temporary image,
+  // which is what allows the layers to render concurrently
+  mLayerJobs = prepareJobs( mParallelCompositing ? nullptr : mPainter, mLabelingEngineV2.get() );
   mLabelJob = prepareLabelingJob( mPainter, mLabelingEngineV2.get(), canUseLabelCache );
 
   QgsDebugMsgLevel( "Rendering prepared in (seconds): " + QString( "%1" ).arg( prepareTime.elapsed() / 1000.0 ), 4 );
@@ -234,12 +255,59 @@ void QgsMapRendererCustomPainterJob::staticRender( QgsMapRendererCustomPainterJo
   }
 }
 
+void QgsMapRendererCustomPainterJob::renderLayerStatic( LayerRenderJob &job )
+{
+  if ( job.context.renderingStopped() )
+    return;
+
+  if ( job.cached )
+    return;
+
+  QTime layerTime;
+  layerTime.start();
+
+  if ( job.img && !job.imageInitialized )
+  {
+    job.img->fill( 0 );
+    job.imageInitialized = true;
+  }
+
+  try
+  {
+    job.renderer->render();
+  }
+  catch ( QgsException &e )
+  {
+    Q_UNUSED( e );
+    QgsDebugMsg( "Caught unhandled QgsException: " + e.what() );
+  }
+  catch ( std::exception &e )
+  {
+    Q_UNUSED( e );
+    QgsDebugMsg( "Caught unhandled std::exception: " + QString::fromLatin1( e.what() ) );
+  }
+  catch ( ... )
+  {
+    QgsDebugMsg( QStringLiteral( "Caught unhandled unknown exception" ) );
+  }
+
+  job.errors = job.renderer->errors();
+  job.renderingTime += layerTime.elapsed();
+}
+
 void QgsMapRendererCustomPainterJob::doRender()
 {
   QgsDebugMsgLevel( QStringLiteral( "Starting to render layer stack." ), 5 );
   QTime renderTime;
   renderTime.start();
 
+  if ( mParallelCompositing )
+  {
+    // render all layer images concurrently -- they are composited in layer
+    // order below, so the result is identical to a sequential render
+    QtConcurrent::blockingMap( mLayerJobs, renderLayerStatic );
+  }
+
   for ( LayerRenderJobs::iterator it = mLayerJobs.begin(); it != mLayerJobs.end(); ++it )
   {
     LayerRenderJob &job = *it;
@@ -254,12 +322,12 @@ void QgsMapRendererCustomPainterJob::doRender()
       mPainter->setCompositionMode( job.blendMode );
     }
 
-    if ( !job.cached )
+    if ( !job.cached && !mParallelCompositing )
     {
       QTime layerTime;
       layerTime.start();
 
-      if ( job.img )
+      if ( job.img && !job.imageInitialized )
       {
         job.img->fill( 0 );
         job.imageInitialized = true;
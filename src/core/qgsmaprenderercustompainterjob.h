@@ -75,11 +75,36 @@ class CORE_EXPORT QgsMapRendererCustomPainterJob : public QgsMapRendererJob
      */
     void renderSynchronously();
 
+    /**
+     * Sets whether the job may render the individual layers concurrently into
+     * temporary images which are then composited into the painter in layer
+     * order, instead of rendering every layer sequentially through the
+     * painter.
+     *
+     * The composited result is identical to a sequential render, including
+     * layer blend modes and opacities. Since every layer requires its own
+     * full size image, the job automatically falls back to sequential
+     * rendering when the images would exceed the memory budget (the
+     * \c qgis/parallelCompositingMemoryBudgetMB setting, 1024 MB by default).
+     *
+     * \see parallelRenderingEnabled()
+     * \since QGIS 3.8
+     */
+    void setParallelRenderingEnabled( bool enabled ) { mParallelRenderingEnabled = enabled; }
+
+    /**
+     * Returns TRUE if the job may render the individual layers concurrently.
+     * \see setParallelRenderingEnabled()
+     * \since QGIS 3.8
+     */
+    bool parallelRenderingEnabled() const { return mParallelRenderingEnabled; }
+
   private slots:
     void futureFinished();
 
   private:
     static void staticRender( QgsMapRendererCustomPainterJob *self ); // function to be used within the thread
+    static void renderLayerStatic( LayerRenderJob &job ); // renders one layer image, used by the parallel compositing mode
 
     // these methods are called within worker thread
     void doRender();
@@ -93,6 +118,9 @@ class CORE_EXPORT QgsMapRendererCustomPainterJob : public QgsMapRendererJob
     LayerRenderJobs mLayerJobs;
     LabelRenderJob mLabelJob;
     bool mRenderSynchronously;
+    bool mParallelRenderingEnabled = false;
+    //! TRUE when this run renders the layers concurrently, see start()
+    bool mParallelCompositing = false;
 
 };
 
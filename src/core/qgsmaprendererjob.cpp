@@ -76,6 +76,21 @@ QHash<QgsMapLayer *, int> QgsMapRendererJob::perLayerRenderingTime() const
   return result;
 }
 
+QVariantMap QgsMapRendererJob::renderingStatistics() const
+{
+  QVariantMap report = mStageStatistics.report();
+  report.insert( QStringLiteral( "total_time_ms" ), mRenderingTime );
+
+  QVariantMap layerTimes;
+  for ( auto it = mPerLayerRenderingTime.constBegin(); it != mPerLayerRenderingTime.constEnd(); ++it )
+  {
+    if ( it.key() )
+      layerTimes.insert( it.key()->id(), it.value() );
+  }
+  report.insert( QStringLiteral( "layer_render_time_ms" ), layerTimes );
+  return report;
+}
+
 const QgsMapSettings &QgsMapRendererJob::mapSettings() const
 {
   return mSettings;
@@ -292,6 +307,7 @@ LayerRenderJobs QgsMapRendererJob::prepareJobs( QPainter *painter, QgsLabelingEn
     job.context.expressionContext().appendScope( QgsExpressionContextUtils::layerScope( ml ) );
     job.context.setPainter( painter );
     job.context.setLabelingEngine( labelingEngine2 );
+    job.context.setStageStatistics( &mStageStatistics );
     job.context.setCoordinateTransform( ct );
     job.context.setExtent( r1 );
 
@@ -309,12 +325,33 @@ LayerRenderJobs QgsMapRendererJob::prepareJobs( QPainter *painter, QgsLabelingEn
       job.opacity = vl->opacity();
     }
 
+    // a region-dirty cached image cannot be reused as-is, but can seed a patch
+    // render which only re-renders the dirty rectangle (see below)
+    QgsRectangle dirtyRegion;
+
     // if we can use the cache, let's do it and avoid rendering!
-    if ( mCache && mCache->hasCacheImage( ml->id() ) )
+    if ( mCache && ( mCache->hasCacheImage( ml->id() ) || mCache->restoreCacheImage( ml->id(), ml ) ) )
+    {
+      dirtyRegion = mCache->cacheImageDirtyRegion( ml->id() );
+      if ( dirtyRegion.isNull() )
+      {
+        job.cached = true;
+        job.imageInitialized = true;
+        job.img = new QImage( mCache->cacheImage( ml->id() ) );
+        job.img->setDevicePixelRatio( static_cast<qreal>( mSettings.devicePixelRatio() ) );
+        job.renderer = nullptr;
+        job.context.setPainter( nullptr );
+        continue;
+      }
+    }
+
+    // for preview renders a preview quality image from an earlier progressive
+    // pass is good enough
+    if ( mCache && mSettings.testFlag( QgsMapSettings::RenderPreviewJob ) && mCache->hasPreviewCacheImage( ml->id() ) )
     {
       job.cached = true;
       job.imageInitialized = true;
-      job.img = new QImage( mCache->cacheImage( ml->id() ) );
+      job.img = new QImage( mCache->previewCacheImage( ml->id() ) );
       job.img->setDevicePixelRatio( static_cast<qreal>( mSettings.devicePixelRatio() ) );
       job.renderer = nullptr;
       job.context.setPainter( nullptr );
@@ -342,12 +379,65 @@ LayerRenderJobs QgsMapRendererJob::prepareJobs( QPainter *painter, QgsLabelingEn
       QPainter *mypPainter = new QPainter( job.img );
       mypPainter->setRenderHint( QPainter::Antialiasing, mSettings.testFlag( QgsMapSettings::Antialiasing ) );
       job.context.setPainter( mypPainter );
+
+      if ( !dirtyRegion.isNull() )
+      {
+        // patch render: seed the image with the cached render, clear the dirty
+        // rectangle and restrict both painting and feature fetching to it
+        QgsRectangle dirtyMapRegion = dirtyRegion;
+        bool regionValid = true;
+        try
+        {
+          if ( ct.isValid() )
+            dirtyMapRegion = ct.transformBoundingBox( dirtyRegion );
+        }
+        catch ( QgsCsException & )
+        {
+          regionValid = false;
+        }
+
+        if ( regionValid )
+        {
+          // leave room for symbology bleeding out of the changed features
+          dirtyMapRegion.grow( mSettings.mapUnitsPerPixel() * 50 );
+
+          QImage cachedImage = mCache->cacheImage( ml->id() );
+          cachedImage.setDevicePixelRatio( static_cast<qreal>( mSettings.devicePixelRatio() ) );
+          mypPainter->setCompositionMode( QPainter::CompositionMode_Source );
+          mypPainter->drawImage( 0, 0, cachedImage );
+
+          const QgsPointXY topLeft = mSettings.mapToPixel().transform( dirtyMapRegion.xMinimum(), dirtyMapRegion.yMaximum() );
+          const QgsPointXY bottomRight = mSettings.mapToPixel().transform( dirtyMapRegion.xMaximum(), dirtyMapRegion.yMinimum() );
+          const QRectF deviceRect( QPointF( topLeft.x(), topLeft.y() ), QPointF( bottomRight.x(), bottomRight.y() ) );
+
+          mypPainter->setClipRect( deviceRect );
+          mypPainter->fillRect( deviceRect, Qt::transparent );
+          mypPainter->setCompositionMode( QPainter::CompositionMode_SourceOver );
+
+          QgsRectangle dirtyLayerRegion = dirtyRegion;
+          dirtyLayerRegion.grow( mSettings.mapUnitsPerPixel() * 50 );
+          dirtyLayerRegion = dirtyLayerRegion.intersect( r1 );
+          job.context.setExtent( dirtyLayerRegion );
+
+          // the image already holds the untouched parts of the previous render,
+          // so it must not be cleared before rendering
+          job.imageInitialized = true;
+        }
+      }
     }
 
     QTime layerTime;
     layerTime.start();
     job.renderer = ml->createMapRenderer( job.context );
     job.renderingTime = layerTime.elapsed(); // include job preparation time in layer rendering time
+
+    if ( mCache )
+    {
+      // give vector renderers access to the features retained by the previous
+      // job, so that panning only fetches the newly exposed region
+      if ( QgsVectorLayerRenderer *vectorRenderer = dynamic_cast< QgsVectorLayerRenderer * >( job.renderer ) )
+        vectorRenderer->setRendererCache( mCache );
+    }
   } // while (li.hasPrevious())
 
   return layerJobs;
@@ -410,7 +500,10 @@ void QgsMapRendererJob::cleanupJobs( LayerRenderJobs &jobs )
       if ( mCache && !job.cached && !job.context.renderingStopped() && job.layer )
       {
         QgsDebugMsgLevel( "caching image for " + ( job.layer ? job.layer->id() : QString() ), 2 );
-        mCache->setCacheImage( job.layer->id(), *job.img, QList< QgsMapLayer * >() << job.layer );
+        if ( job.context.testFlag( QgsRenderContext::RenderPreviewJob ) )
+          mCache->setPreviewCacheImage( job.layer->id(), *job.img, QList< QgsMapLayer * >() << job.layer );
+        else
+          mCache->setCacheImage( job.layer->id(), *job.img, QList< QgsMapLayer * >() << job.layer );
       }
 
       delete job.img;
@@ -437,7 +530,7 @@ void QgsMapRendererJob::cleanupLabelJob( LabelRenderJob &job )
 {
   if ( job.img )
   {
-    if ( mCache && !job.cached && !job.context.renderingStopped() )
+    if ( mCache && !job.cached && !job.context.renderingStopped() && !job.context.testFlag( QgsRenderContext::RenderPreviewJob ) )
     {
       QgsDebugMsg( QStringLiteral( "caching label result image" ) );
       mCache->setCacheImage( LABEL_CACHE_ID, *job.img, _qgis_listQPointerToRaw( job.participatingLayers ) );
@@ -527,6 +620,11 @@ void QgsMapRendererJob::logRenderingTime( const LayerRenderJobs &jobs, const Lab
   {
     QgsMessageLog::logMessage( tr( "%1 ms: %2" ).arg( t ).arg( QStringList( elapsed.values( t ) ).join( QStringLiteral( ", " ) ) ), tr( "Rendering" ) );
   }
+  QgsMessageLog::logMessage( tr( "Stages -- feature fetch: %1 ms, symbol draw: %2 ms, label registration: %3 ms, features: %4" )
+                             .arg( mStageStatistics.time( QgsRenderStageStatistics::FeatureFetch ) / 1000000 )
+                             .arg( mStageStatistics.time( QgsRenderStageStatistics::SymbolRender ) / 1000000 )
+                             .arg( mStageStatistics.time( QgsRenderStageStatistics::Labeling ) / 1000000 )
+                             .arg( mStageStatistics.featureCount() ), tr( "Rendering" ) );
   QgsMessageLog::logMessage( QStringLiteral( "---" ), tr( "Rendering" ) );
 }
 
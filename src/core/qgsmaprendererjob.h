@@ -25,6 +25,7 @@
 #include <QTime>
 
 #include "qgsrendercontext.h"
+#include "qgsrenderstagestatistics.h"
 
 #include "qgsmapsettings.h"
 
@@ -212,6 +213,24 @@ class CORE_EXPORT QgsMapRendererJob : public QObject
      */
     QHash< QgsMapLayer *, int > perLayerRenderingTime() const SIP_SKIP;
 
+    /**
+     * Returns the per-stage statistics collector shared by the layer renderers
+     * of this job. Instrumented renderers fill it while the job runs.
+     * \note not available in Python bindings
+     * \see renderingStatistics()
+     * \since QGIS 3.8
+     */
+    QgsRenderStageStatistics *stageStatistics() SIP_SKIP { return &mStageStatistics; }
+
+    /**
+     * Returns a machine readable report of where the render time of this job
+     * was spent, combining the per-stage counters collected by the layer
+     * renderers (in nanoseconds) with the per-layer rendering times (in
+     * milliseconds). Only meaningful once the job has finished.
+     * \since QGIS 3.8
+     */
+    QVariantMap renderingStatistics() const;
+
     /**
      * Returns map settings with which this job was started.
      * \returns A QgsMapSettings instance with render settings
@@ -252,6 +271,9 @@ class CORE_EXPORT QgsMapRendererJob : public QObject
     //! Render time (in ms) per layer, by layer ID
     QHash< QgsWeakMapLayerPointer, int > mPerLayerRenderingTime;
 
+    //! Per-stage counters filled by the layer renderers of this job
+    QgsRenderStageStatistics mStageStatistics;
+
     /**
      * Prepares the cache for storing the result of labeling. Returns FALSE if
      * the render cannot use cached labels and should not cache the result.
@@ -51,13 +51,20 @@ void QgsMapRendererParallelJob::start()
 
   mLabelingEngineV2.reset();
 
-  if ( mSettings.testFlag( QgsMapSettings::DrawLabeling ) )
+  // run a cheap preview quality pass first? labeling is deferred to the full
+  // quality pass
+  mPreviewPass = mProgressiveRenderingEnabled && !mSettings.testFlag( QgsMapSettings::RenderPreviewJob );
+  if ( mPreviewPass )
+  {
+    mSettings.setFlag( QgsMapSettings::RenderPreviewJob, true );
+  }
+  else if ( mSettings.testFlag( QgsMapSettings::DrawLabeling ) )
   {
     mLabelingEngineV2.reset( new QgsLabelingEngine() );
     mLabelingEngineV2->setMapSettings( mSettings );
   }
 
-  bool canUseLabelCache = prepareLabelCache();
+  bool canUseLabelCache = !mPreviewPass && prepareLabelCache();
   mLayerJobs = prepareJobs( nullptr, mLabelingEngineV2.get() );
   mLabelJob = prepareLabelingJob( nullptr, mLabelingEngineV2.get(), canUseLabelCache );
 
@@ -195,6 +202,41 @@ void QgsMapRendererParallelJob::renderLayersFinished()
 {
   Q_ASSERT( mStatus == RenderingLayers );
 
+  if ( mPreviewPass )
+  {
+    // commit the cheap pass to the final image so that it is visible immediately,
+    // and store the preview quality layer images in the cache
+    mFinalImage = composeImage( mSettings, mLayerJobs, mLabelJob );
+    cleanupJobs( mLayerJobs );
+
+    mSettings.setFlag( QgsMapSettings::RenderPreviewJob, false );
+    mPreviewPass = false;
+
+    QgsDebugMsg( QStringLiteral( "PARALLEL preview pass finished" ) );
+
+    if ( mLabelJob.context.renderingStopped() )
+    {
+      // canceled while the preview pass was running -- skip the full quality pass
+      renderingFinished();
+      return;
+    }
+
+    // and refine with the full quality pass
+    if ( mSettings.testFlag( QgsMapSettings::DrawLabeling ) )
+    {
+      mLabelingEngineV2.reset( new QgsLabelingEngine() );
+      mLabelingEngineV2->setMapSettings( mSettings );
+    }
+
+    bool canUseLabelCache = prepareLabelCache();
+    mLayerJobs = prepareJobs( nullptr, mLabelingEngineV2.get() );
+    mLabelJob = prepareLabelingJob( nullptr, mLabelingEngineV2.get(), canUseLabelCache );
+
+    mFuture = QtConcurrent::map( mLayerJobs, renderLayerStatic );
+    mFutureWatcher.setFuture( mFuture );
+    return;
+  }
+
   LayerRenderJobs::const_iterator it = mLayerJobs.constBegin();
   for ( ; it != mLayerJobs.constEnd(); ++it )
   {
@@ -230,6 +272,13 @@ void QgsMapRendererParallelJob::renderingFinished()
 {
   QgsDebugMsg( QStringLiteral( "PARALLEL finished" ) );
 
+  if ( mPreviewPass )
+  {
+    // canceled without blocking while the preview pass was still running
+    mSettings.setFlag( QgsMapSettings::RenderPreviewJob, false );
+    mPreviewPass = false;
+  }
+
   logRenderingTime( mLayerJobs, mLabelJob );
 
   cleanupJobs( mLayerJobs );
@@ -251,7 +300,7 @@ void QgsMapRendererParallelJob::renderLayerStatic( LayerRenderJob &job )
   if ( job.cached )
     return;
 
-  if ( job.img )
+  if ( job.img && !job.imageInitialized )
   {
     job.img->fill( 0 );
     job.imageInitialized = true;
@@ -282,6 +331,16 @@ void QgsMapRendererParallelJob::renderLayerStatic( LayerRenderJob &job )
   job.errors = job.renderer->errors();
   job.renderingTime += t.elapsed();
   QgsDebugMsgLevel( QStringLiteral( "job %1 end [%2 ms] (layer %3)" ).arg( reinterpret_cast< quint64 >( &job ), 0, 16 ).arg( job.renderingTime ).arg( job.layer ? job.layer->id() : QString() ), 2 );
+
+  // hand the freshly registered label features of this layer over to the labeling
+  // engine now, while other layers are still rendering -- this overlaps the label
+  // geometry preparation with the slowest layer's render instead of appending it
+  // to the labeling stage
+  if ( job.layer && !job.context.renderingStopped() )
+  {
+    if ( QgsLabelingEngine *labelingEngine = job.context.labelingEngine() )
+      labelingEngine->registerLayerFeatures( job.layer->id(), job.context );
+  }
 }
 
 
@@ -48,6 +48,31 @@ class CORE_EXPORT QgsMapRendererParallelJob : public QgsMapRendererQImageJob
     // from QgsMapRendererJobWithPreview
     QImage renderedImage() override;
 
+    /**
+     * Sets whether the job renders progressively. When enabled, layers are first
+     * drawn in a cheap preview quality pass (rendered with the
+     * QgsMapSettings::RenderPreviewJob shortcuts) which is committed to the
+     * rendered image as soon as it completes, and the full quality pass then
+     * refines the result. Preview quality images are stored in the cache alongside
+     * the full quality ones, so subsequent preview renders (e.g. while panning)
+     * can reuse them.
+     *
+     * Progressive rendering trades some total rendering time for a much shorter
+     * time to first meaningful content. It is disabled by default.
+     *
+     * \see progressiveRenderingEnabled()
+     * \since QGIS 3.8
+     */
+    void setProgressiveRenderingEnabled( bool enabled ) { mProgressiveRenderingEnabled = enabled; }
+
+    /**
+     * Returns TRUE if the job renders a cheap preview quality pass before the full
+     * quality pass.
+     * \see setProgressiveRenderingEnabled()
+     * \since QGIS 3.8
+     */
+    bool progressiveRenderingEnabled() const { return mProgressiveRenderingEnabled; }
+
   private slots:
     //! layers are rendered, labeling is still pending
     void renderLayersFinished();
@@ -63,6 +88,11 @@ class CORE_EXPORT QgsMapRendererParallelJob : public QgsMapRendererQImageJob
 
     QImage mFinalImage;
 
+    //! TRUE if a cheap preview quality pass runs before the full quality pass
+    bool mProgressiveRenderingEnabled = false;
+    //! TRUE while the preview quality pass of a progressive render is running
+    bool mPreviewPass = false;
+
     //! \note not available in Python bindings
     enum { Idle, RenderingLayers, RenderingLabels } mStatus SIP_SKIP;
 
@@ -21,8 +21,11 @@
 #include "qgsmapsettingsutils.h"
 
 #include <QFile>
+#include <QFileInfo>
+#include <QPicture>
 #include <QTextStream>
 #include <QPrinter>
+#include <QtConcurrentRun>
 
 QgsMapRendererTask::QgsMapRendererTask( const QgsMapSettings &ms, const QString &fileName, const QString &fileFormat, const bool forceRaster )
   : QgsTask( tr( "Saving as image" ) )
@@ -56,6 +59,11 @@ void QgsMapRendererTask::addDecorations( const QList< QgsMapDecoration * > &deco
   mDecorations = decorations;
 }
 
+void QgsMapRendererTask::addOutput( const QString &fileName, const QString &fileFormat )
+{
+  mAdditionalOutputs << qMakePair( fileName, fileFormat );
+}
+
 
 void QgsMapRendererTask::cancel()
 {
@@ -77,7 +85,17 @@ bool QgsMapRendererTask::run()
   std::unique_ptr< QPrinter > printer;
 #endif // ! QT_NO_PRINTER
 
-  if ( mFileFormat == QStringLiteral( "PDF" ) )
+  const bool multiOutput = !mAdditionalOutputs.isEmpty() && !mFileName.isEmpty();
+  QPicture picture;
+
+  if ( multiOutput )
+  {
+    // record the painted scene once, then replay it into every requested sink --
+    // the expensive map render only ever happens a single time
+    tempPainter.reset( new QPainter( &picture ) );
+    destPainter = tempPainter.get();
+  }
+  else if ( mFileFormat == QStringLiteral( "PDF" ) )
   {
 #ifndef QT_NO_PRINTER
     printer.reset( new QPrinter() );
@@ -179,7 +197,110 @@ bool QgsMapRendererTask::run()
   {
     destPainter->end();
 
-    if ( mForceRaster && mFileFormat == QStringLiteral( "PDF" ) )
+    if ( multiOutput )
+    {
+      QVector< QPair< QString, QString > > outputs;
+      outputs << qMakePair( mFileName, mFileFormat );
+      outputs << mAdditionalOutputs;
+
+      // the georeferencing content only depends on the map settings -- generate it
+      // once and share it between all raster outputs
+      const QString worldFileContent = QgsMapSettingsUtils::worldFileContent( mMapSettings );
+      auto writeWorldFile = [&worldFileContent]( const QString & imageFileName )
+      {
+        QFileInfo info = QFileInfo( imageFileName );
+        QString outputSuffix = info.suffix();
+        QString worldFileName = info.absolutePath() + '/' + info.baseName() + '.'
+                                + outputSuffix.at( 0 ) + outputSuffix.at( info.suffix().size() - 1 ) + 'w';
+        QFile worldFile( worldFileName );
+        if ( worldFile.open( QIODevice::WriteOnly | QIODevice::Truncate ) ) //don't use QIODevice::Text
+        {
+          QTextStream stream( &worldFile );
+          stream << worldFileContent;
+        }
+      };
+
+      QImage rasterized;
+      QList< QFuture< bool > > encodeFutures;
+
+      for ( const QPair< QString, QString > &output : qgis::as_const( outputs ) )
+      {
+        // raster outputs (and a rasterized PDF) replay the scene into a single shared image
+        if ( output.second != QStringLiteral( "PDF" ) || mForceRaster )
+        {
+          if ( rasterized.isNull() )
+          {
+            rasterized = QImage( mMapSettings.outputSize(), QImage::Format_ARGB32 );
+            if ( rasterized.isNull() )
+            {
+              mError = ImageAllocationFail;
+              return false;
+            }
+            rasterized.setDotsPerMeterX( 1000 * mMapSettings.outputDpi() / 25.4 );
+            rasterized.setDotsPerMeterY( 1000 * mMapSettings.outputDpi() / 25.4 );
+            QPainter imagePainter( &rasterized );
+            imagePainter.drawPicture( 0, 0, picture );
+            imagePainter.end();
+          }
+        }
+
+        if ( output.second == QStringLiteral( "PDF" ) )
+        {
+#ifndef QT_NO_PRINTER
+          QPrinter pdfPrinter;
+          pdfPrinter.setOutputFileName( output.first );
+          pdfPrinter.setOutputFormat( QPrinter::PdfFormat );
+          pdfPrinter.setOrientation( QPrinter::Portrait );
+          // paper size needs to be given in millimeters in order to be able to set a resolution to pass onto the map renderer
+          pdfPrinter.setPaperSize( mMapSettings.outputSize()  * 25.4 / mMapSettings.outputDpi(), QPrinter::Millimeter );
+          pdfPrinter.setPageMargins( 0, 0, 0, 0, QPrinter::Millimeter );
+          pdfPrinter.setResolution( mMapSettings.outputDpi() );
+
+          QPainter pp( &pdfPrinter );
+          if ( mForceRaster )
+          {
+            QRectF rect( 0, 0, rasterized.width(), rasterized.height() );
+            pp.drawImage( rect, rasterized, rect );
+          }
+          else
+          {
+            // replaying the recorded scene keeps the vector painting path for PDF
+            pp.drawPicture( 0, 0, picture );
+          }
+          pp.end();
+#else
+          mError = ImageUnsupportedFormat;
+          return false;
+#endif // !QT_NO_PRINTER
+        }
+        else
+        {
+          // QImage is implicitly shared, so the encoders can safely run on worker threads
+          const QString fileName = output.first;
+          const QString fileFormat = output.second;
+          encodeFutures << QtConcurrent::run( [rasterized, fileName, fileFormat]() -> bool
+          {
+            return rasterized.save( fileName, fileFormat.toLocal8Bit().data() );
+          } );
+
+          if ( mSaveWorldFile )
+            writeWorldFile( output.first );
+        }
+      }
+
+      bool success = true;
+      for ( QFuture< bool > &future : encodeFutures )
+      {
+        future.waitForFinished();
+        success &= future.result();
+      }
+      if ( !success )
+      {
+        mError = ImageSaveFail;
+        return false;
+      }
+    }
+    else if ( mForceRaster && mFileFormat == QStringLiteral( "PDF" ) )
     {
 #ifndef QT_NO_PRINTER
       QPainter pp;
@@ -65,6 +65,21 @@ class CORE_EXPORT QgsMapRendererTask : public QgsTask
     QgsMapRendererTask( const QgsMapSettings &ms,
                         QPainter *p );
 
+    /**
+     * Adds an additional export of the rendered map to \a fileName in \a fileFormat.
+     *
+     * The map is rendered only once for all outputs: additional raster outputs are
+     * encoded concurrently from the same rendered intermediate, while a "PDF" output
+     * keeps its vector painting path. When world file saving is enabled (see
+     * setSaveWorldFile()), a world file with the shared georeferencing content is
+     * written alongside every raster output.
+     *
+     * Only valid for tasks constructed with a destination file name.
+     *
+     * \since QGIS 3.8
+     */
+    void addOutput( const QString &fileName, const QString &fileFormat );
+
     /**
      * Adds \a annotations to be rendered on the map.
      */
@@ -110,6 +125,10 @@ class CORE_EXPORT QgsMapRendererTask : public QgsTask
 
     QString mFileName;
     QString mFileFormat;
+
+    //! Additional (file name, file format) outputs written from the same rendered map
+    QVector< QPair< QString, QString > > mAdditionalOutputs;
+
     bool mForceRaster = false;
     bool mSaveWorldFile = false;
 
@@ -0,0 +1,124 @@
+/***************************************************************************
+    qgsmapthemeprerendertask.cpp
+    ----------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgsmapthemeprerendertask.h"
+
+#include "qgsmaprenderercache.h"
+#include "qgsmaprenderercustompainterjob.h"
+#include "qgsmapthemecollection.h"
+
+#include <QImage>
+#include <QPainter>
+
+QgsMapThemePreRenderTask::QgsMapThemePreRenderTask( const QgsMapSettings &settings, QgsMapThemeCollection *collection, QgsMapRendererCache *cache, const QString &activeTheme )
+  : QgsTask( tr( "Pre-rendering map themes" ) )
+  , mMapSettings( settings )
+  , mCache( cache )
+{
+  const QStringList themes = collection->mapThemes();
+  for ( const QString &name : themes )
+  {
+    if ( name == activeTheme )
+      continue;
+
+    ThemeDetails details;
+    details.name = name;
+    const QList<QgsMapLayer *> layers = collection->mapThemeVisibleLayers( name );
+    for ( QgsMapLayer *layer : layers )
+      details.layers << layer;
+    details.styleOverrides = collection->mapThemeStyleOverrides( name );
+    mThemes << details;
+  }
+}
+
+void QgsMapThemePreRenderTask::cancel()
+{
+  mJobMutex.lock();
+  if ( mJob )
+    mJob->cancelWithoutBlocking();
+  mJobMutex.unlock();
+
+  QgsTask::cancel();
+}
+
+bool QgsMapThemePreRenderTask::run()
+{
+  int themesDone = 0;
+  for ( const ThemeDetails &details : qgis::as_const( mThemes ) )
+  {
+    if ( isCanceled() )
+      return false;
+
+    // resolve the layers which are still alive and have no cached image yet --
+    // the active theme's layers were cached by the canvas job which triggered
+    // this task and must not be rendered again with a different style
+    QList<QgsMapLayer *> layersToRender;
+    for ( const QgsWeakMapLayerPointer &layerPointer : details.layers )
+    {
+      if ( QgsMapLayer *layer = layerPointer.data() )
+      {
+        if ( !mCache->hasCacheImage( layer->id() ) )
+          layersToRender << layer;
+      }
+    }
+
+    if ( !layersToRender.isEmpty() )
+    {
+      QgsMapSettings themeSettings = mMapSettings;
+      themeSettings.setLayers( layersToRender );
+      themeSettings.setLayerStyleOverrides( details.styleOverrides );
+
+      // render into a private cache first, so that nothing is published if
+      // the task is canceled or the canvas moved on to another extent
+      QgsMapRendererCache themeCache;
+      QImage image( themeSettings.outputSize(), QImage::Format_ARGB32_Premultiplied );
+      image.fill( 0 );
+      QPainter painter( &image );
+
+      mJobMutex.lock();
+      mJob.reset( new QgsMapRendererCustomPainterJob( themeSettings, &painter ) );
+      mJobMutex.unlock();
+
+      mJob->setCache( &themeCache );
+      mJob->renderSynchronously();
+      painter.end();
+
+      mJobMutex.lock();
+      mJob.reset( nullptr );
+      mJobMutex.unlock();
+
+      if ( isCanceled() )
+        return false;
+
+      // publish the layer images, unless the target cache moved to a
+      // different extent or scale while this theme was rendering
+      for ( QgsMapLayer *layer : qgis::as_const( layersToRender ) )
+      {
+        if ( themeCache.hasCacheImage( layer->id() )
+             && mCache->extent() == themeSettings.visibleExtent()
+             && qgsDoubleNear( mCache->scale(), themeSettings.scale() )
+             && !mCache->hasCacheImage( layer->id() ) )
+        {
+          mCache->setCacheImage( layer->id(), themeCache.cacheImage( layer->id() ), QList<QgsMapLayer *>() << layer );
+        }
+      }
+    }
+
+    themesDone++;
+    setProgress( 100.0 * themesDone / mThemes.size() );
+  }
+
+  return true;
+}
@@ -0,0 +1,88 @@
+/***************************************************************************
+    qgsmapthemeprerendertask.h
+    --------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef QGSMAPTHEMEPRERENDERTASK_H
+#define QGSMAPTHEMEPRERENDERTASK_H
+
+#define SIP_NO_FILE
+
+#include "qgis_core.h"
+#include "qgsmaplayer.h"
+#include "qgsmapsettings.h"
+#include "qgstaskmanager.h"
+
+#include <QMutex>
+#include <memory>
+
+class QgsMapRendererCache;
+class QgsMapRendererCustomPainterJob;
+class QgsMapThemeCollection;
+
+/**
+ * \class QgsMapThemePreRenderTask
+ * \ingroup core
+ * Background task which renders the layers of the non-active map themes into
+ * a QgsMapRendererCache, so that switching between themes only composites
+ * already cached layer images instead of re-rendering from scratch.
+ *
+ * The themes' layers and style overrides are snapshotted on construction.
+ * Each theme's still uncached layers are rendered into a private cache on the
+ * task thread, and the resulting layer images are transferred into the target
+ * cache only while it still holds the extent and scale they were rendered
+ * for. Layers which already have a cached image -- typically those of the
+ * active theme -- are never re-rendered or overwritten, so a layer styled
+ * differently per theme cannot poison the active theme's cache entry.
+ *
+ * \note not available in Python bindings
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsMapThemePreRenderTask : public QgsTask
+{
+    Q_OBJECT
+
+  public:
+
+    /**
+     * Constructor. \a settings supplies the extent, scale and output
+     * parameters to render with. The layers of every theme in \a collection
+     * except \a activeTheme are pre-rendered into \a cache, which must
+     * outlive the task (or the task must be canceled first).
+     */
+    QgsMapThemePreRenderTask( const QgsMapSettings &settings, QgsMapThemeCollection *collection, QgsMapRendererCache *cache, const QString &activeTheme );
+
+    void cancel() override;
+
+  protected:
+    bool run() override;
+
+  private:
+
+    struct ThemeDetails
+    {
+      QString name;
+      QgsWeakMapLayerPointerList layers;
+      QMap<QString, QString> styleOverrides;
+    };
+
+    QgsMapSettings mMapSettings;
+    QgsMapRendererCache *mCache = nullptr;
+    QList< ThemeDetails > mThemes;
+
+    QMutex mJobMutex;
+    std::unique_ptr< QgsMapRendererCustomPainterJob > mJob;
+
+};
+
+#endif // QGSMAPTHEMEPRERENDERTASK_H
@@ -412,5 +412,26 @@ QgsGeometry QgsMapToPixelSimplifier::simplify( const QgsGeometry &geometry ) con
     return geometry;
   }
 
-  return QgsGeometry( simplifyGeometry( mSimplifyFlags, mSimplifyAlgorithm, *geometry.constGet(), mTolerance, false ) );
+  std::unique_ptr< QgsAbstractGeometry > result = simplifyGeometry( mSimplifyFlags, mSimplifyAlgorithm, *geometry.constGet(), mTolerance, false );
+
+  if ( mMaximumVertices > 0 && result && result->nCoordinates() > mMaximumVertices )
+  {
+    // Derive the per-feature budget from the feature's size on screen -- a shape spanning
+    // few tolerance units cannot usefully display many vertices, while large features are
+    // allowed up to the configured maximum
+    const double diagonal = std::sqrt( envelope.width() * envelope.width() + envelope.height() * envelope.height() );
+    const int budget = std::max( isaLinearRing ? 6 : 3,
+                                 static_cast< int >( std::min( static_cast< double >( mMaximumVertices ), 2.0 * diagonal / mTolerance ) ) );
+
+    // Escalate the tolerance until the result fits the budget. Doubling converges quickly,
+    // and the iteration cap keeps the cost bounded for degenerate inputs.
+    double tolerance = mTolerance;
+    for ( int iteration = 0; iteration < 4 && result->nCoordinates() > budget; ++iteration )
+    {
+      tolerance *= 2.0;
+      result = simplifyGeometry( mSimplifyFlags, mSimplifyAlgorithm, *geometry.constGet(), tolerance, false );
+    }
+  }
+
+  return QgsGeometry( std::move( result ) );
 }
@@ -71,6 +71,9 @@ class CORE_EXPORT QgsMapToPixelSimplifier : public QgsAbstractGeometrySimplifier
     //! Distance tolerance for the simplification
     double mTolerance;
 
+    //! Maximum number of vertices to retain per feature, -1 for no limit
+    int mMaximumVertices = -1;
+
     //! Returns the squared 2D-distance of the vector defined by the two points specified
     static float calculateLengthSquared2D( double x1, double y1, double x2, double y2 );
 
@@ -94,6 +97,29 @@ class CORE_EXPORT QgsMapToPixelSimplifier : public QgsAbstractGeometrySimplifier
     //! Sets the tolerance of the vector layer managed
     void setTolerance( double value ) { mTolerance = value; }
 
+    /**
+     * Sets the maximum number of vertices a simplified feature may retain, or -1 to not
+     * limit the vertex count (the default).
+     *
+     * When a maximum is set, simplify() derives a per-feature budget from the feature's
+     * size on screen -- small features are capped well below the maximum -- and escalates
+     * the tolerance until the result fits the budget. This bounds the vertex throughput of
+     * downstream rendering stages for pathological inputs (e.g. very dense coastlines),
+     * at the cost of coarser output for features which exceed the budget.
+     *
+     * \see maximumVertices()
+     * \since QGIS 3.8
+     */
+    void setMaximumVertices( int maximum ) { mMaximumVertices = maximum; }
+
+    /**
+     * Returns the maximum number of vertices a simplified feature may retain, or -1 if the
+     * vertex count is not limited.
+     * \see setMaximumVertices()
+     * \since QGIS 3.8
+     */
+    int maximumVertices() const { return mMaximumVertices; }
+
     // MapToPixel simplification helper methods
   public:
 
@@ -19,6 +19,32 @@
 #include "qgsnetworkcontentfetchertask.h"
 #include "qgsnetworkcontentfetcher.h"
 
+#include <QEventLoop>
+#include <QHash>
+#include <QMutex>
+
+#include <algorithm>
+
+///@cond PRIVATE
+
+//! Registry of in-flight requests, so identical concurrent fetches can be coalesced
+static QHash< QString, QgsNetworkContentFetcherTask * > sInFlightRequests;
+static QMutex sInFlightMutex;
+
+//! Builds a normalized registry key from the request url and (sorted) raw headers
+static QString requestKey( const QNetworkRequest &request )
+{
+  QStringList headers;
+  const QList<QByteArray> headerNames = request.rawHeaderList();
+  headers.reserve( headerNames.size() );
+  for ( const QByteArray &name : headerNames )
+    headers << QStringLiteral( "%1=%2" ).arg( QString::fromUtf8( name ), QString::fromUtf8( request.rawHeader( name ) ) );
+  std::sort( headers.begin(), headers.end() );
+  return request.url().toString( QUrl::FullyEncoded ) + QLatin1Char( '|' ) + headers.join( QLatin1Char( '|' ) );
+}
+
+///@endcond
+
 QgsNetworkContentFetcherTask::QgsNetworkContentFetcherTask( const QUrl &url )
   : QgsNetworkContentFetcherTask( QNetworkRequest( url ) )
 {
@@ -38,6 +64,39 @@ QgsNetworkContentFetcherTask::~QgsNetworkContentFetcherTask()
 
 bool QgsNetworkContentFetcherTask::run()
 {
+  const QString key = requestKey( mRequest );
+  while ( true )
+  {
+    sInFlightMutex.lock();
+    QgsNetworkContentFetcherTask *inFlight = sInFlightRequests.value( key );
+    if ( !inFlight )
+    {
+      sInFlightRequests.insert( key, this );
+      sInFlightMutex.unlock();
+      break;
+    }
+
+    // an identical request is already in flight -- instead of issuing a duplicate
+    // network request, wait for it to complete and then prefer the (now warm)
+    // network cache for our own fetch. The in-flight task cannot deregister (and
+    // hence emit fetched) before we release the mutex, so the connection is race free.
+    QEventLoop waitLoop;
+    connect( inFlight, &QgsNetworkContentFetcherTask::fetched, &waitLoop, &QEventLoop::quit, Qt::QueuedConnection );
+    mWaitLoop = &waitLoop;
+    sInFlightMutex.unlock();
+
+    waitLoop.exec();
+
+    sInFlightMutex.lock();
+    mWaitLoop = nullptr;
+    sInFlightMutex.unlock();
+
+    if ( isCanceled() )
+      break;
+
+    mRequest.setAttribute( QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::PreferCache );
+  }
+
   mFetcher = new QgsNetworkContentFetcher();
   QEventLoop loop;
   connect( mFetcher, &QgsNetworkContentFetcher::finished, &loop, &QEventLoop::quit );
@@ -56,6 +115,14 @@ bool QgsNetworkContentFetcherTask::run()
   loop.exec();
   if ( !isCanceled() )
     setProgress( 100 );
+
+  // deregister before emitting, so that waiters found in the registry are guaranteed
+  // to see the fetched signal
+  sInFlightMutex.lock();
+  if ( sInFlightRequests.value( key ) == this )
+    sInFlightRequests.remove( key );
+  sInFlightMutex.unlock();
+
   emit fetched();
   return true;
 }
@@ -65,6 +132,11 @@ void QgsNetworkContentFetcherTask::cancel()
   if ( mFetcher )
     mFetcher->cancel();
 
+  sInFlightMutex.lock();
+  if ( mWaitLoop )
+    QMetaObject::invokeMethod( mWaitLoop, "quit", Qt::QueuedConnection );
+  sInFlightMutex.unlock();
+
   QgsTask::cancel();
 }
 
@@ -26,6 +26,7 @@
 
 class QgsNetworkContentFetcher;
 class QNetworkReply;
+class QEventLoop;
 
 /**
  * \class QgsNetworkContentFetcherTask
@@ -40,6 +41,11 @@ class QNetworkReply;
  * then safely access the network reply() from the connected slot
  * without danger of the task being first removed by the QgsTaskManager.
  *
+ * Since QGIS 3.8 concurrent tasks fetching an identical request are coalesced:
+ * while a request is in flight, tasks for the same URL and headers wait for it
+ * to complete and then prefer the network cache instead of issuing a duplicate
+ * network request. Each task still receives its own reply.
+ *
  * \see QgsNetworkContentFetcher
  *
  * \since QGIS 3.2
@@ -90,6 +96,8 @@ class CORE_EXPORT QgsNetworkContentFetcherTask : public QgsTask
 
     QNetworkRequest mRequest;
     QgsNetworkContentFetcher *mFetcher = nullptr;
+    //! Event loop used while waiting for an identical in-flight request, protected by the registry mutex
+    QEventLoop *mWaitLoop = nullptr;
 
 };
 
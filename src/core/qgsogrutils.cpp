@@ -19,6 +19,10 @@
 #include "qgsgeometry.h"
 #include "qgsfields.h"
 #include "qgslinestring.h"
+#include "qgsmultilinestring.h"
+#include "qgsmultipoint.h"
+#include "qgsmultipolygon.h"
+#include "qgspolygon.h"
 #include <QTextCodec>
 #include <QUuid>
 #include <cpl_error.h>
@@ -340,6 +344,63 @@ std::unique_ptr< QgsLineString > ogrGeometryToQgsLineString( OGRGeometryH geom )
   return qgis::make_unique< QgsLineString>( x, y, z, m, wkbType == QgsWkbTypes::LineString25D );
 }
 
+std::unique_ptr< QgsPolygon > ogrGeometryToQgsPolygon( OGRGeometryH geom )
+{
+  std::unique_ptr< QgsPolygon > polygon = qgis::make_unique< QgsPolygon >();
+
+  const int count = OGR_G_GetGeometryCount( geom );
+  if ( count >= 1 )
+  {
+    polygon->setExteriorRing( ogrGeometryToQgsLineString( OGR_G_GetGeometryRef( geom, 0 ) ).release() );
+  }
+
+  for ( int i = 1; i < count; ++i )
+  {
+    polygon->addInteriorRing( ogrGeometryToQgsLineString( OGR_G_GetGeometryRef( geom, i ) ).release() );
+  }
+
+  return polygon;
+}
+
+std::unique_ptr< QgsMultiPoint > ogrGeometryToQgsMultiPoint( OGRGeometryH geom )
+{
+  std::unique_ptr< QgsMultiPoint > multiPoint = qgis::make_unique< QgsMultiPoint >();
+
+  const int count = OGR_G_GetGeometryCount( geom );
+  for ( int i = 0; i < count; ++i )
+  {
+    multiPoint->addGeometry( ogrGeometryToQgsPoint( OGR_G_GetGeometryRef( geom, i ) ).release() );
+  }
+
+  return multiPoint;
+}
+
+std::unique_ptr< QgsMultiLineString > ogrGeometryToQgsMultiLineString( OGRGeometryH geom )
+{
+  std::unique_ptr< QgsMultiLineString > multiLineString = qgis::make_unique< QgsMultiLineString >();
+
+  const int count = OGR_G_GetGeometryCount( geom );
+  for ( int i = 0; i < count; ++i )
+  {
+    multiLineString->addGeometry( ogrGeometryToQgsLineString( OGR_G_GetGeometryRef( geom, i ) ).release() );
+  }
+
+  return multiLineString;
+}
+
+std::unique_ptr< QgsMultiPolygon > ogrGeometryToQgsMultiPolygon( OGRGeometryH geom )
+{
+  std::unique_ptr< QgsMultiPolygon > multiPolygon = qgis::make_unique< QgsMultiPolygon >();
+
+  const int count = OGR_G_GetGeometryCount( geom );
+  for ( int i = 0; i < count; ++i )
+  {
+    multiPolygon->addGeometry( ogrGeometryToQgsPolygon( OGR_G_GetGeometryRef( geom, i ) ).release() );
+  }
+
+  return multiPolygon;
+}
+
 QgsGeometry QgsOgrUtils::ogrGeometryToQgsGeometry( OGRGeometryH geom )
 {
   if ( !geom )
@@ -361,6 +422,30 @@ QgsGeometry QgsOgrUtils::ogrGeometryToQgsGeometry( OGRGeometryH geom )
       return QgsGeometry( ogrGeometryToQgsLineString( geom ) );
     }
 
+    case QgsWkbTypes::Polygon:
+    {
+      // optimised case for polygon -- avoid wkb conversion
+      return QgsGeometry( ogrGeometryToQgsPolygon( geom ) );
+    }
+
+    case QgsWkbTypes::MultiPoint:
+    {
+      // optimised case for multipoint -- avoid wkb conversion
+      return QgsGeometry( ogrGeometryToQgsMultiPoint( geom ) );
+    }
+
+    case QgsWkbTypes::MultiLineString:
+    {
+      // optimised case for multiline -- avoid wkb conversion
+      return QgsGeometry( ogrGeometryToQgsMultiLineString( geom ) );
+    }
+
+    case QgsWkbTypes::MultiPolygon:
+    {
+      // optimised case for multipolygon -- avoid wkb conversion
+      return QgsGeometry( ogrGeometryToQgsMultiPolygon( geom ) );
+    }
+
     default:
       break;
   };
@@ -0,0 +1,71 @@
+/***************************************************************************
+    qgspackedfeatureids.cpp
+    -----------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgspackedfeatureids.h"
+
+#include <algorithm>
+#include <iterator>
+
+QgsPackedFeatureIds::QgsPackedFeatureIds( const QgsFeatureIds &ids )
+{
+  mIds.reserve( ids.size() );
+  for ( QgsFeatureId id : ids )
+    mIds.append( id );
+  std::sort( mIds.begin(), mIds.end() );
+}
+
+bool QgsPackedFeatureIds::contains( QgsFeatureId id ) const
+{
+  return std::binary_search( mIds.constBegin(), mIds.constEnd(), id );
+}
+
+QgsFeatureIds QgsPackedFeatureIds::toSet() const
+{
+  QgsFeatureIds result;
+  result.reserve( mIds.size() );
+  for ( QgsFeatureId id : mIds )
+    result.insert( id );
+  return result;
+}
+
+QgsPackedFeatureIds QgsPackedFeatureIds::intersected( const QgsPackedFeatureIds &other ) const
+{
+  QgsPackedFeatureIds result;
+  result.mIds.reserve( std::min( mIds.size(), other.mIds.size() ) );
+  std::set_intersection( mIds.constBegin(), mIds.constEnd(),
+                         other.mIds.constBegin(), other.mIds.constEnd(),
+                         std::back_inserter( result.mIds ) );
+  return result;
+}
+
+QgsPackedFeatureIds QgsPackedFeatureIds::united( const QgsPackedFeatureIds &other ) const
+{
+  QgsPackedFeatureIds result;
+  result.mIds.reserve( mIds.size() + other.mIds.size() );
+  std::set_union( mIds.constBegin(), mIds.constEnd(),
+                  other.mIds.constBegin(), other.mIds.constEnd(),
+                  std::back_inserter( result.mIds ) );
+  return result;
+}
+
+QgsPackedFeatureIds QgsPackedFeatureIds::subtracted( const QgsPackedFeatureIds &other ) const
+{
+  QgsPackedFeatureIds result;
+  result.mIds.reserve( mIds.size() );
+  std::set_difference( mIds.constBegin(), mIds.constEnd(),
+                       other.mIds.constBegin(), other.mIds.constEnd(),
+                       std::back_inserter( result.mIds ) );
+  return result;
+}
@@ -1554,7 +1554,7 @@ void QgsPalLayerSettings::registerFeature( const QgsFeature &f, QgsRenderContext
   }
 
   // NOTE: this should come AFTER any option that affects font metrics
-  std::unique_ptr<QFontMetricsF> labelFontMetrics( new QFontMetricsF( labelFont ) );
+  std::unique_ptr<QFontMetricsF> labelFontMetrics( new QFontMetricsF( QgsFontUtils::cachedMetrics( labelFont ) ) );
   double labelX, labelY; // will receive label size
   calculateLabelSize( labelFontMetrics.get(), labelText, labelX, labelY, mCurFeat, &context );
 
@@ -701,6 +701,13 @@ QgsCoordinateReferenceSystem QgsPointLocator::destinationCrs() const
 
 void QgsPointLocator::setExtent( const QgsRectangle *extent )
 {
+  if ( extent && mExtent && mRTree && mExtent->contains( *extent ) )
+  {
+    // the existing index already covers the requested extent -- keep it
+    // (and keep the larger indexed extent) instead of a full rebuild
+    return;
+  }
+
   mExtent.reset( extent ? new QgsRectangle( *extent ) : nullptr );
 
   destroyIndex();
@@ -92,7 +92,9 @@ class CORE_EXPORT QgsPointLocator : public QObject
     const QgsRectangle *extent() const { return mExtent.get(); }
 
     /**
-     * Configure extent - if not NULLPTR, it will index only that area
+     * Configure extent - if not NULLPTR, it will index only that area.
+     * If an index covering the requested extent has already been built,
+     * it is kept rather than rebuilt.
      * \since QGIS 2.14
      */
     void setExtent( const QgsRectangle *extent );
@@ -26,6 +26,7 @@
 #include "qgsmessagelog.h"
 #include "qgspluginlayer.h"
 #include "qgspluginlayerregistry.h"
+#include "qgsproviderregistry.h"
 #include "qgsprojectfiletransform.h"
 #include "qgssnappingconfig.h"
 #include "qgspathresolver.h"
@@ -875,7 +876,7 @@ void QgsProject::setSnappingConfig( const QgsSnappingConfig &snappingConfig )
   emit snappingConfigChanged( mSnappingConfig );
 }
 
-bool QgsProject::_getMapLayers( const QDomDocument &doc, QList<QDomNode> &brokenNodes )
+bool QgsProject::_getMapLayers( const QDomDocument &doc, QList<QDomNode> &brokenNodes, QgsProject::ReadFlags flags )
 {
   // Layer order is set by the restoring the legend settings from project file.
   // This is done on the 'readProject( ... )' signal
@@ -905,6 +906,23 @@ bool QgsProject::_getMapLayers( const QDomDocument &doc, QList<QDomNode> &broken
 
   const QVector<QDomNode> sortedLayerNodes = depSorter.sortedLayerNodes();
 
+  // warm up the provider libraries the project is about to need, in the background --
+  // lazily registered providers would otherwise be loaded one by one while the layers
+  // are read below
+  QStringList providerKeys;
+  for ( const QDomNode &node : sortedLayerNodes )
+  {
+    const QString providerKey = node.namedItem( QStringLiteral( "provider" ) ).toElement().text();
+    if ( !providerKey.isEmpty() && !providerKeys.contains( providerKey ) )
+      providerKeys << providerKey;
+  }
+  QgsProviderRegistry::instance()->preloadProviders( providerKeys );
+
+  // Layers are registered in batches -- every addMapLayers() call triggers
+  // snapping config and layer dependency updates over the whole project, so
+  // adding the layers of a large project one by one gets quadratic
+  QList<QgsMapLayer *> batchedLayers;
+
   int i = 0;
   for ( const QDomNode &node : sortedLayerNodes )
   {
@@ -916,6 +934,13 @@ bool QgsProject::_getMapLayers( const QDomDocument &doc, QList<QDomNode> &broken
 
     if ( element.attribute( QStringLiteral( "embedded" ) ) == QLatin1String( "1" ) )
     {
+      // flush pending layers first so that embedded layers which depend on
+      // them are resolved against a fully registered project
+      if ( !batchedLayers.isEmpty() )
+      {
+        addMapLayers( batchedLayers );
+        batchedLayers.clear();
+      }
       createEmbeddedLayer( element.attribute( QStringLiteral( "id" ) ), readPath( element.attribute( QStringLiteral( "project" ) ) ), brokenNodes );
     }
     else
@@ -923,7 +948,7 @@ bool QgsProject::_getMapLayers( const QDomDocument &doc, QList<QDomNode> &broken
       QgsReadWriteContext context;
       context.setPathResolver( pathResolver() );
       context.setProjectTranslator( this );
-      if ( !addLayer( element, brokenNodes, context ) )
+      if ( !addLayer( element, brokenNodes, context, &batchedLayers, flags ) )
       {
         returnStatus = false;
       }
@@ -937,10 +962,13 @@ bool QgsProject::_getMapLayers( const QDomDocument &doc, QList<QDomNode> &broken
     i++;
   }
 
+  if ( !batchedLayers.isEmpty() )
+    addMapLayers( batchedLayers );
+
   return returnStatus;
 }
 
-bool QgsProject::addLayer( const QDomElement &layerElem, QList<QDomNode> &brokenNodes, QgsReadWriteContext &context )
+bool QgsProject::addLayer( const QDomElement &layerElem, QList<QDomNode> &brokenNodes, QgsReadWriteContext &context, QList<QgsMapLayer *> *batchedLayers, QgsProject::ReadFlags flags )
 {
   QString type = layerElem.attribute( QStringLiteral( "type" ) );
   QgsDebugMsgLevel( "Layer type is " + type, 4 );
@@ -978,14 +1006,34 @@ bool QgsProject::addLayer( const QDomElement &layerElem, QList<QDomNode> &broken
 
   Q_CHECK_PTR( mapLayer ); // NOLINT
 
+  // It's up to the layer subclasses to handle the read flags
+  QgsMapLayer::ReadFlags layerFlags = nullptr;
+  if ( flags & QgsProject::FlagDontResolveLayers )
+    layerFlags |= QgsMapLayer::FlagDontResolveLayers;
+
   // have the layer restore state that is stored in Dom node
-  bool layerIsValid = mapLayer->readLayerXml( layerElem, context ) && mapLayer->isValid();
+  bool layerIsValid = mapLayer->readLayerXml( layerElem, context, layerFlags )
+                      && ( mapLayer->isValid() || layerFlags & QgsMapLayer::FlagDontResolveLayers );
+
+  // keep the layer element so that a deferred layer can be fully materialized
+  // later -- the provider dependent parts of its state live in there
+  if ( layerFlags & QgsMapLayer::FlagDontResolveLayers )
+  {
+    QString layerXml;
+    QTextStream stream( &layerXml );
+    layerElem.save( stream, 2 );
+    mapLayer->setOriginalXmlProperties( layerXml );
+  }
+
   QList<QgsMapLayer *> newLayers;
   newLayers << mapLayer;
   if ( layerIsValid )
   {
     emit readMapLayer( mapLayer, layerElem );
-    addMapLayers( newLayers );
+    if ( batchedLayers )
+      batchedLayers->append( mapLayer ); // registered in one addMapLayers() call by the caller
+    else
+      addMapLayers( newLayers );
   }
   else
   {
@@ -998,14 +1046,14 @@ bool QgsProject::addLayer( const QDomElement &layerElem, QList<QDomNode> &broken
   return layerIsValid;
 }
 
-bool QgsProject::read( const QString &filename )
+bool QgsProject::read( const QString &filename, QgsProject::ReadFlags flags )
 {
   mFile.setFileName( filename );
 
-  return read();
+  return read( flags );
 }
 
-bool QgsProject::read()
+bool QgsProject::read( QgsProject::ReadFlags flags )
 {
   QString filename = mFile.fileName();
   bool rc;
@@ -1031,17 +1079,17 @@ bool QgsProject::read()
       return false;
     }
 
-    return unzip( inDevice.fileName() );  // calls setError() if returning false
+    return unzip( inDevice.fileName(), flags );  // calls setError() if returning false
   }
 
   if ( QgsZipUtils::isZipFile( mFile.fileName() ) )
   {
-    rc = unzip( mFile.fileName() );
+    rc = unzip( mFile.fileName(), flags );
   }
   else
   {
     mAuxiliaryStorage.reset( new QgsAuxiliaryStorage( *this ) );
-    rc = readProjectFile( mFile.fileName() );
+    rc = readProjectFile( mFile.fileName(), flags );
   }
 
   //on translation we should not change the filename back
@@ -1058,7 +1106,7 @@ bool QgsProject::read()
   return rc;
 }
 
-bool QgsProject::readProjectFile( const QString &filename )
+bool QgsProject::readProjectFile( const QString &filename, QgsProject::ReadFlags flags )
 {
   QFile projectFile( filename );
   clearError();
@@ -1271,7 +1319,7 @@ bool QgsProject::readProjectFile( const QString &filename )
 
   // get the map layers
   QList<QDomNode> brokenNodes;
-  bool clean = _getMapLayers( *doc, brokenNodes );
+  bool clean = _getMapLayers( *doc, brokenNodes, flags );
 
   // review the integrity of the retrieved map layers
   if ( !clean )
@@ -1544,6 +1592,23 @@ void QgsProject::onMapLayersAdded( const QList<QgsMapLayer *> &layers )
 {
   QMap<QString, QgsMapLayer *> existingMaps = mapLayers();
 
+  // build the reverse dependency map (dependency layer id -> dependent layers)
+  // once, instead of rescanning the dependencies of every existing layer for
+  // every single added layer - with big projects that scan was quadratic in
+  // the layer count
+  QMultiHash<QString, QgsMapLayer *> dependentLayers;
+  for ( QMap<QString, QgsMapLayer *>::iterator it = existingMaps.begin(); it != existingMaps.end(); it++ )
+  {
+    const QSet<QgsMapLayerDependency> deps = it.value()->dependencies();
+    for ( const QgsMapLayerDependency &dep : deps )
+    {
+      // matching dependencies by default type and origin, as the previous
+      // QSet::contains( layer->id() ) lookup did
+      if ( dep == QgsMapLayerDependency( dep.layerId() ) )
+        dependentLayers.insert( dep.layerId(), it.value() );
+    }
+  }
+
   bool tgChanged = false;
 
   Q_FOREACH ( QgsMapLayer *layer, layers )
@@ -1580,14 +1645,11 @@ void QgsProject::onMapLayersAdded( const QList<QgsMapLayer *> &layers )
       connect( layer, &QgsMapLayer::configChanged, this, [ = ] { setDirty(); } );
 
       // check if we have to update connections for layers with dependencies
-      for ( QMap<QString, QgsMapLayer *>::iterator it = existingMaps.begin(); it != existingMaps.end(); it++ )
+      const QList<QgsMapLayer *> layersDependingOnThis = dependentLayers.values( layer->id() );
+      for ( QgsMapLayer *dependent : layersDependingOnThis )
       {
-        QSet<QgsMapLayerDependency> deps = it.value()->dependencies();
-        if ( deps.contains( layer->id() ) )
-        {
-          // reconnect to change signals
-          it.value()->setDependencies( deps );
-        }
+        // reconnect to change signals
+        dependent->setDependencies( dependent->dependencies() );
       }
     }
   }
@@ -2641,7 +2703,7 @@ QList<QgsMapLayer *> QgsProject::mapLayersByName( const QString &layerName ) con
   return mLayerStore->mapLayersByName( layerName );
 }
 
-bool QgsProject::unzip( const QString &filename )
+bool QgsProject::unzip( const QString &filename, QgsProject::ReadFlags flags )
 {
   clearError();
   std::unique_ptr<QgsProjectArchive> archive( new QgsProjectArchive() );
@@ -2673,7 +2735,7 @@ bool QgsProject::unzip( const QString &filename )
   }
 
   // read the project file
-  if ( ! readProjectFile( archive->projectFile() ) )
+  if ( ! readProjectFile( archive->projectFile(), flags ) )
   {
     setError( tr( "Cannot read unzipped qgs project file" ) );
     return false;
@@ -263,18 +263,33 @@ class CORE_EXPORT QgsProject : public QObject, public QgsExpressionContextGenera
      */
     void clear();
 
+    /**
+     * Flags which control project read behavior.
+     * \since QGIS 3.8
+     */
+    enum ReadFlag
+    {
+      FlagDontResolveLayers = 1 << 0, //!< Don't resolve layer paths or create layer data providers. Layers are registered invalid and can be materialized one by one through QgsMapLayer::setDataSource(), which makes the first layers of a big project available long before the last provider has been opened.
+    };
+    Q_DECLARE_FLAGS( ReadFlags, ReadFlag )
+
     /**
      * Reads given project file from the given file.
      * \param filename name of project file to read
+     * \param flags optional flags which control the read behavior of projects (since QGIS 3.8)
      * \returns TRUE if project file has been read successfully
      */
-    bool read( const QString &filename );
+    bool read( const QString &filename, QgsProject::ReadFlags flags = nullptr );
 
     /**
      * Reads the project from its currently associated file (see fileName() ).
+     *
+     * The \a flags argument can be used to specify optional flags which control
+     * the read behavior of projects (since QGIS 3.8).
+     *
      * \returns TRUE if project file has been read successfully
      */
-    bool read();
+    bool read( QgsProject::ReadFlags flags = nullptr );
 
     /**
      * Reads the layer described in the associated DOM node.
@@ -1404,7 +1419,7 @@ class CORE_EXPORT QgsProject : public QObject, public QgsExpressionContextGenera
      * because the layers were removed or re-located after the project was last saved
      * \returns TRUE if function worked; else is FALSE
     */
-    bool _getMapLayers( const QDomDocument &doc, QList<QDomNode> &brokenNodes );
+    bool _getMapLayers( const QDomDocument &doc, QList<QDomNode> &brokenNodes, QgsProject::ReadFlags flags = nullptr );
 
     /**
      * Set error message from read/write operation
@@ -1422,7 +1437,13 @@ class CORE_EXPORT QgsProject : public QObject, public QgsExpressionContextGenera
      * Creates layer and adds it to maplayer registry
      * \note not available in Python bindings
      */
-    bool addLayer( const QDomElement &layerElem, QList<QDomNode> &brokenNodes, QgsReadWriteContext &context ) SIP_SKIP;
+    /**
+     * Creates a layer from the given element and adds it to the project. If
+     * \a batchedLayers is specified, valid layers are appended to that list
+     * instead of being registered immediately, allowing the caller to add them
+     * with a single addMapLayers() call.
+     */
+    bool addLayer( const QDomElement &layerElem, QList<QDomNode> &brokenNodes, QgsReadWriteContext &context, QList<QgsMapLayer *> *batchedLayers = nullptr, QgsProject::ReadFlags flags = nullptr ) SIP_SKIP;
 
     //! \note not available in Python bindings
     void initializeEmbeddedSubtree( const QString &projectFilePath, QgsLayerTreeGroup *group ) SIP_SKIP;
@@ -1431,13 +1452,13 @@ class CORE_EXPORT QgsProject : public QObject, public QgsExpressionContextGenera
     void loadEmbeddedNodes( QgsLayerTreeGroup *group ) SIP_SKIP;
 
     //! Read .qgs file
-    bool readProjectFile( const QString &filename );
+    bool readProjectFile( const QString &filename, QgsProject::ReadFlags flags = nullptr );
 
     //! Write .qgs file
     bool writeProjectFile( const QString &filename );
 
     //! Unzip .qgz file then read embedded .qgs file
-    bool unzip( const QString &filename );
+    bool unzip( const QString &filename, QgsProject::ReadFlags flags = nullptr );
 
     //! Zip project
     bool zip( const QString &filename );
@@ -1566,6 +1587,8 @@ class CORE_EXPORT QgsProjectDirtyBlocker
 #endif
 };
 
+Q_DECLARE_OPERATORS_FOR_FLAGS( QgsProject::ReadFlags )
+
 /**
  * Returns the version string found in the given DOM document
    \returns the version string or an empty string if none found
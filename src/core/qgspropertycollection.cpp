@@ -205,11 +205,74 @@ QVariant QgsPropertyCollection::value( int key, const QgsExpressionContext &cont
   if ( mProperties.isEmpty() )
     return defaultValue;
 
-  QgsProperty prop = mProperties.value( key );
-  if ( !prop || !prop.isActive() )
+  // evaluate on a reference to the stored property - taking a copy would cause
+  // the shared property data to detach (and re-prepare) on every evaluation
+  auto it = mProperties.constFind( key );
+  if ( it == mProperties.constEnd() || !it.value() || !it.value().isActive() )
+    return defaultValue;
+
+  return it.value().value( context, defaultValue );
+}
+
+QString QgsPropertyCollection::valueAsString( int key, const QgsExpressionContext &context, const QString &defaultString, bool *ok ) const
+{
+  if ( ok )
+    *ok = false;
+
+  // see value() - evaluate on a reference to avoid detaching the property data
+  auto it = mProperties.constFind( key );
+  if ( it == mProperties.constEnd() || !it.value() || !it.value().isActive() )
+    return defaultString;
+
+  return it.value().valueAsString( context, defaultString, ok );
+}
+
+QColor QgsPropertyCollection::valueAsColor( int key, const QgsExpressionContext &context, const QColor &defaultColor, bool *ok ) const
+{
+  if ( ok )
+    *ok = false;
+
+  auto it = mProperties.constFind( key );
+  if ( it == mProperties.constEnd() || !it.value() || !it.value().isActive() )
+    return defaultColor;
+
+  return it.value().valueAsColor( context, defaultColor, ok );
+}
+
+double QgsPropertyCollection::valueAsDouble( int key, const QgsExpressionContext &context, double defaultValue, bool *ok ) const
+{
+  if ( ok )
+    *ok = false;
+
+  auto it = mProperties.constFind( key );
+  if ( it == mProperties.constEnd() || !it.value() || !it.value().isActive() )
+    return defaultValue;
+
+  return it.value().valueAsDouble( context, defaultValue, ok );
+}
+
+int QgsPropertyCollection::valueAsInt( int key, const QgsExpressionContext &context, int defaultValue, bool *ok ) const
+{
+  if ( ok )
+    *ok = false;
+
+  auto it = mProperties.constFind( key );
+  if ( it == mProperties.constEnd() || !it.value() || !it.value().isActive() )
+    return defaultValue;
+
+  return it.value().valueAsInt( context, defaultValue, ok );
+}
+
+bool QgsPropertyCollection::valueAsBool( int key, const QgsExpressionContext &context, bool defaultValue, bool *ok ) const
+{
+  if ( ok )
+    *ok = false;
+
+  auto it = mProperties.constFind( key );
+  if ( it == mProperties.constEnd() || !it.value() || !it.value().isActive() )
     return defaultValue;
 
-  return prop.value( context, defaultValue );
+  return it.value().valueAsBool( context, defaultValue, ok );
 }
 
 bool QgsPropertyCollection::prepare( const QgsExpressionContext &context ) const
@@ -245,7 +308,8 @@ bool QgsPropertyCollection::isActive( int key ) const
   if ( mProperties.isEmpty() )
     return false;
 
-  return mProperties.value( key ).isActive();
+  auto it = mProperties.constFind( key );
+  return it != mProperties.constEnd() && it.value().isActive();
 }
 
 void QgsPropertyCollection::rescan() const
@@ -129,7 +129,7 @@ class CORE_EXPORT QgsAbstractPropertyCollection
      * \see valueAsInt()
      * \see valueAsBool()
      */
-    QString valueAsString( int key, const QgsExpressionContext &context, const QString &defaultString = QString(), bool *ok SIP_OUT = nullptr ) const;
+    virtual QString valueAsString( int key, const QgsExpressionContext &context, const QString &defaultString = QString(), bool *ok SIP_OUT = nullptr ) const;
 
     /**
      * Calculates the current value of the property with the specified key and interprets it as a color.
@@ -145,7 +145,7 @@ class CORE_EXPORT QgsAbstractPropertyCollection
      * \see valueAsInt()
      * \see valueAsBool()
      */
-    QColor valueAsColor( int key, const QgsExpressionContext &context, const QColor &defaultColor = QColor(), bool *ok SIP_OUT = nullptr ) const;
+    virtual QColor valueAsColor( int key, const QgsExpressionContext &context, const QColor &defaultColor = QColor(), bool *ok SIP_OUT = nullptr ) const;
 
     /**
      * Calculates the current value of the property with the specified key and interprets it as a double.
@@ -161,7 +161,7 @@ class CORE_EXPORT QgsAbstractPropertyCollection
      * \see valueAsInt()
      * \see valueAsBool()
      */
-    double valueAsDouble( int key, const QgsExpressionContext &context, double defaultValue = 0.0, bool *ok SIP_OUT = nullptr ) const;
+    virtual double valueAsDouble( int key, const QgsExpressionContext &context, double defaultValue = 0.0, bool *ok SIP_OUT = nullptr ) const;
 
     /**
      * Calculates the current value of the property with the specified key and interprets it as an integer.
@@ -177,7 +177,7 @@ class CORE_EXPORT QgsAbstractPropertyCollection
      * \see valueAsDouble()
      * \see valueAsBool()
      */
-    int valueAsInt( int key, const QgsExpressionContext &context, int defaultValue = 0, bool *ok SIP_OUT = nullptr ) const;
+    virtual int valueAsInt( int key, const QgsExpressionContext &context, int defaultValue = 0, bool *ok SIP_OUT = nullptr ) const;
 
     /**
      * Calculates the current value of the property with the specified key and interprets it as an boolean.
@@ -193,7 +193,7 @@ class CORE_EXPORT QgsAbstractPropertyCollection
      * \see valueAsDouble()
      * \see valueAsInt()
      */
-    bool valueAsBool( int key, const QgsExpressionContext &context, bool defaultValue = false, bool *ok SIP_OUT = nullptr ) const;
+    virtual bool valueAsBool( int key, const QgsExpressionContext &context, bool defaultValue = false, bool *ok SIP_OUT = nullptr ) const;
 
     /**
      * Prepares the collection against a specified expression context. Calling prepare before evaluating the
@@ -322,6 +322,11 @@ class CORE_EXPORT QgsPropertyCollection : public QgsAbstractPropertyCollection
     virtual QgsProperty &property( int key );
 
     QVariant value( int key, const QgsExpressionContext &context, const QVariant &defaultValue = QVariant() ) const override;
+    QString valueAsString( int key, const QgsExpressionContext &context, const QString &defaultString = QString(), bool *ok SIP_OUT = nullptr ) const override;
+    QColor valueAsColor( int key, const QgsExpressionContext &context, const QColor &defaultColor = QColor(), bool *ok SIP_OUT = nullptr ) const override;
+    double valueAsDouble( int key, const QgsExpressionContext &context, double defaultValue = 0.0, bool *ok SIP_OUT = nullptr ) const override;
+    int valueAsInt( int key, const QgsExpressionContext &context, int defaultValue = 0, bool *ok SIP_OUT = nullptr ) const override;
+    bool valueAsBool( int key, const QgsExpressionContext &context, bool defaultValue = false, bool *ok SIP_OUT = nullptr ) const override;
     bool prepare( const QgsExpressionContext &context = QgsExpressionContext() ) const override;
     QSet< QString > referencedFields( const QgsExpressionContext &context = QgsExpressionContext() ) const override;
     bool isActive( int key ) const override;
@@ -21,6 +21,7 @@
 #include <QString>
 #include <QDir>
 #include <QLibrary>
+#include <QtConcurrentRun>
 
 #include "qgis.h"
 #include "qgsdataprovider.h"
@@ -28,6 +29,7 @@
 #include "qgsmessageoutput.h"
 #include "qgsmessagelog.h"
 #include "qgsprovidermetadata.h"
+#include "qgssettings.h"
 #include "qgsvectorlayer.h"
 #include "qgsproject.h"
 #include "providers/memory/qgsmemoryprovider.h"
@@ -51,6 +53,25 @@ typedef QVariantMap decodeUri_t( const QString &uri );
 
 static QgsProviderRegistry *sInstance = nullptr;
 
+//! Settings group under which probed provider libraries are cached between runs
+static const QString LIBRARY_CACHE_GROUP = QStringLiteral( "providerRegistry/libraryCache" );
+
+//! Stamp identifying a library file on disk - a changed stamp invalidates its cache entry
+static QString libraryCacheStamp_( const QFileInfo &fi )
+{
+  return QStringLiteral( "%1:%2" ).arg( fi.size() ).arg( fi.lastModified().toMSecsSinceEpoch() );
+}
+
+//! Records that a library was probed and turned out not to be a provider, so it can be skipped without loading next time
+static void writeNegativeLibraryCache_( const QFileInfo &fi )
+{
+  QgsSettings settings;
+  settings.beginGroup( QStringLiteral( "%1/%2" ).arg( LIBRARY_CACHE_GROUP, fi.fileName() ) );
+  settings.remove( QString() );
+  settings.setValue( QStringLiteral( "stamp" ), libraryCacheStamp_( fi ) );
+  settings.setValue( QStringLiteral( "isProvider" ), false );
+}
+
 QgsProviderRegistry *QgsProviderRegistry::instance( const QString &pluginPath )
 {
   if ( !sInstance )
@@ -136,6 +157,11 @@ void QgsProviderRegistry::init()
       }
     }
 
+    // registering from the cached manifest avoids loading the library at startup --
+    // it is only loaded on the first call which actually needs it
+    if ( restoreLibraryFromCache( fi ) )
+      continue;
+
     QLibrary myLib( fi.filePath() );
     if ( !myLib.load() )
     {
@@ -149,6 +175,7 @@ void QgsProviderRegistry::init()
     if ( hasType )
     {
       QgsDebugMsg( QStringLiteral( "Checking %1: ...invalid (has type method)" ).arg( myLib.fileName() ) );
+      writeNegativeLibraryCache_( fi );
       continue;
     }
 
@@ -157,6 +184,7 @@ void QgsProviderRegistry::init()
     if ( !isProvider )
     {
       QgsDebugMsg( QStringLiteral( "Checking %1: ...invalid (no isProvider method)" ).arg( myLib.fileName() ) );
+      writeNegativeLibraryCache_( fi );
       continue;
     }
 
@@ -164,6 +192,7 @@ void QgsProviderRegistry::init()
     if ( !isProvider() )
     {
       QgsDebugMsg( QStringLiteral( "Checking %1: ...invalid (not a provider)" ).arg( myLib.fileName() ) );
+      writeNegativeLibraryCache_( fi );
       continue;
     }
 
@@ -172,6 +201,7 @@ void QgsProviderRegistry::init()
     if ( !pDesc )
     {
       QgsDebugMsg( QStringLiteral( "Checking %1: ...invalid (no description method)" ).arg( myLib.fileName() ) );
+      writeNegativeLibraryCache_( fi );
       continue;
     }
 
@@ -179,6 +209,7 @@ void QgsProviderRegistry::init()
     if ( !pKey )
     {
       QgsDebugMsg( QStringLiteral( "Checking %1: ...invalid (no providerKey method)" ).arg( myLib.fileName() ) );
+      writeNegativeLibraryCache_( fi );
       continue;
     }
 
@@ -207,10 +238,11 @@ void QgsProviderRegistry::init()
     }
 
     // now get vector file filters, if any
+    QString fileVectorFilters;
     fileVectorFilters_t *pFileVectorFilters = reinterpret_cast< fileVectorFilters_t * >( cast_to_fptr( myLib.resolve( "fileVectorFilters" ) ) );
     if ( pFileVectorFilters )
     {
-      QString fileVectorFilters = pFileVectorFilters();
+      fileVectorFilters = pFileVectorFilters();
 
       if ( !fileVectorFilters.isEmpty() )
         mVectorFileFilters += fileVectorFilters;
@@ -220,11 +252,11 @@ void QgsProviderRegistry::init()
 
     // now get raster file filters, if any
     // this replaces deprecated QgsRasterLayer::buildSupportedRasterFileFilter
+    QString fileRasterFilters;
     buildsupportedrasterfilefilter_t *pBuild =
       reinterpret_cast< buildsupportedrasterfilefilter_t * >( cast_to_fptr( myLib.resolve( "buildSupportedRasterFileFilter" ) ) );
     if ( pBuild )
     {
-      QString fileRasterFilters;
       pBuild( fileRasterFilters );
 
       QgsDebugMsg( "raster filters: " + fileRasterFilters );
@@ -235,12 +267,11 @@ void QgsProviderRegistry::init()
     }
 
     // now get mesh file filters, if any
+    QString fileMeshFilters;
+    QString fileMeshDatasetFilters;
     fileMeshFilters_t *pFileMeshFilters = reinterpret_cast< fileMeshFilters_t * >( cast_to_fptr( myLib.resolve( "fileMeshFilters" ) ) );
     if ( pFileMeshFilters )
     {
-      QString fileMeshFilters;
-      QString fileMeshDatasetFilters;
-
       pFileMeshFilters( fileMeshFilters, fileMeshDatasetFilters );
 
       if ( !fileMeshFilters.isEmpty() )
@@ -255,10 +286,101 @@ void QgsProviderRegistry::init()
     initProviderFunction_t *initFunc = reinterpret_cast< initProviderFunction_t * >( cast_to_fptr( myLib.resolve( "initProvider" ) ) );
     if ( initFunc )
       initFunc();
+
+    // cache what we learned from the library, so the next startup can register the
+    // provider without loading it. Providers with an initProvider() entry point
+    // register services with the application while loading, so they cannot be
+    // described by the manifest alone and are always probed directly.
+    if ( !initFunc )
+    {
+      QgsSettings settings;
+      settings.beginGroup( QStringLiteral( "%1/%2" ).arg( LIBRARY_CACHE_GROUP, fi.fileName() ) );
+      settings.remove( QString() );
+      settings.setValue( QStringLiteral( "stamp" ), libraryCacheStamp_( fi ) );
+      settings.setValue( QStringLiteral( "isProvider" ), true );
+      settings.setValue( QStringLiteral( "key" ), pKey() );
+      settings.setValue( QStringLiteral( "description" ), pDesc() );
+      settings.setValue( QStringLiteral( "hasRegisterGui" ), myLib.resolve( "registerGui" ) != nullptr );
+      settings.setValue( QStringLiteral( "fileVectorFilters" ), fileVectorFilters );
+      settings.setValue( QStringLiteral( "fileRasterFilters" ), fileRasterFilters );
+      settings.setValue( QStringLiteral( "fileMeshFilters" ), fileMeshFilters );
+      settings.setValue( QStringLiteral( "fileMeshDatasetFilters" ), fileMeshDatasetFilters );
+      settings.setValue( QStringLiteral( "databaseDrivers" ), pDatabaseDrivers ? mDatabaseDrivers : QString() );
+      settings.setValue( QStringLiteral( "directoryDrivers" ), pDirectoryDrivers ? mDirectoryDrivers : QString() );
+      settings.setValue( QStringLiteral( "protocolDrivers" ), pProtocolDrivers ? mProtocolDrivers : QString() );
+    }
   }
 } // QgsProviderRegistry ctor
 
 
+bool QgsProviderRegistry::restoreLibraryFromCache( const QFileInfo &fi )
+{
+  QgsSettings settings;
+  settings.beginGroup( QStringLiteral( "%1/%2" ).arg( LIBRARY_CACHE_GROUP, fi.fileName() ) );
+
+  if ( settings.value( QStringLiteral( "stamp" ) ).toString() != libraryCacheStamp_( fi ) )
+    return false;
+
+  if ( !settings.value( QStringLiteral( "isProvider" ) ).toBool() )
+  {
+    // probed on an earlier startup and found not to be a provider -- nothing to register
+    QgsDebugMsg( QStringLiteral( "Checking %1: ...skipped (cached as not a provider)" ).arg( fi.fileName() ) );
+    return true;
+  }
+
+  const QString key = settings.value( QStringLiteral( "key" ) ).toString();
+  if ( key.isEmpty() || mProviders.find( key ) != mProviders.end() )
+    return false;
+
+  mProviders[key] = new QgsProviderMetadata( key, settings.value( QStringLiteral( "description" ) ).toString(), fi.filePath() );
+
+  if ( !settings.value( QStringLiteral( "hasRegisterGui" ) ).toBool() )
+    mProvidersWithoutGuiRegistration.insert( key );
+
+  mVectorFileFilters += settings.value( QStringLiteral( "fileVectorFilters" ) ).toString();
+  mRasterFileFilters += settings.value( QStringLiteral( "fileRasterFilters" ) ).toString();
+  mMeshFileFilters += settings.value( QStringLiteral( "fileMeshFilters" ) ).toString();
+  mMeshDatasetFileFilters += settings.value( QStringLiteral( "fileMeshDatasetFilters" ) ).toString();
+
+  const QString databaseDrivers = settings.value( QStringLiteral( "databaseDrivers" ) ).toString();
+  if ( !databaseDrivers.isEmpty() )
+    mDatabaseDrivers = databaseDrivers;
+  const QString directoryDrivers = settings.value( QStringLiteral( "directoryDrivers" ) ).toString();
+  if ( !directoryDrivers.isEmpty() )
+    mDirectoryDrivers = directoryDrivers;
+  const QString protocolDrivers = settings.value( QStringLiteral( "protocolDrivers" ) ).toString();
+  if ( !protocolDrivers.isEmpty() )
+    mProtocolDrivers = protocolDrivers;
+
+  QgsDebugMsg( QStringLiteral( "Checking %1: ...registered provider %2 from cache" ).arg( fi.fileName(), key ) );
+  return true;
+}
+
+void QgsProviderRegistry::preloadProviders( const QStringList &providerKeys )
+{
+  QStringList libraries;
+  Q_FOREACH ( const QString &providerKey, providerKeys )
+  {
+    const QString lib = library( providerKey );
+    if ( !lib.isEmpty() && !libraries.contains( lib ) )
+      libraries << lib;
+  }
+  if ( libraries.isEmpty() )
+    return;
+
+  // QLibrary reference counts loads process wide, so warming the libraries from a
+  // worker thread makes the later blocking load on the main thread effectively free
+  QtConcurrent::run( [libraries]()
+  {
+    Q_FOREACH ( const QString &lib, libraries )
+    {
+      QLibrary library( lib );
+      library.load();
+    }
+  } );
+}
+
+
 // typedef for the unload dataprovider function
 typedef void cleanupProviderFunction_t();
 
@@ -286,6 +408,7 @@ void QgsProviderRegistry::clean()
     ++it;
   }
   mProviders.clear();
+  mProvidersWithoutGuiRegistration.clear();
 }
 
 QgsProviderRegistry::~QgsProviderRegistry()
@@ -552,6 +675,10 @@ void QgsProviderRegistry::registerGuis( QWidget *parent )
 
   Q_FOREACH ( const QString &provider, providerList() )
   {
+    // don't load a lazily registered library just to learn (again) that it has no GUI to register
+    if ( mProvidersWithoutGuiRegistration.contains( provider ) )
+      continue;
+
     registerGui_function *registerGui = reinterpret_cast< registerGui_function * >( cast_to_fptr( function( provider, "registerGui" ) ) );
 
     if ( !registerGui )
@@ -23,6 +23,7 @@
 
 #include <QDir>
 #include <QLibrary>
+#include <QSet>
 #include <QString>
 
 #include "qgsdataprovider.h"
@@ -81,6 +82,23 @@ class CORE_EXPORT QgsProviderRegistry
     //! Returns list of provider plugins found
     QString pluginList( bool asHtml = false ) const;
 
+    /**
+     * Loads the libraries of the given \a providerKeys in a background thread.
+     *
+     * Providers registered from the cached library manifest are not loaded until
+     * the first call which actually needs their library (e.g. createProvider()).
+     * Callers which already know which providers will shortly be required -- such
+     * as a project about to be read -- can use this method to warm those libraries
+     * up front, so that the later blocking load on the main thread is effectively
+     * free.
+     *
+     * Keys which are unknown or which correspond to native (non-library) providers
+     * are ignored.
+     *
+     * \since QGIS 3.8
+     */
+    void preloadProviders( const QStringList &providerKeys );
+
     /**
      * Returns the library directory where plugins are found.
      */
@@ -241,9 +259,24 @@ class CORE_EXPORT QgsProviderRegistry
     void init();
     void clean();
 
+    /**
+     * Registers a provider library from the cached manifest entry matching \a fi,
+     * without loading the library itself. Returns FALSE if no cache entry exists for
+     * the file or the entry is stale, in which case the library must be probed
+     * directly (which refreshes the cache).
+     */
+    bool restoreLibraryFromCache( const QFileInfo &fi );
+
     //! Associative container of provider metadata handles
     Providers mProviders;
 
+    /**
+     * Providers registered from the cached library manifest whose library is known
+     * not to export a registerGui entry point, so registerGuis() can skip them
+     * without loading the library.
+     */
+    QSet< QString > mProvidersWithoutGuiRegistration;
+
     //! Directory in which provider plugins are installed
     QDir mLibraryDirectory;
 
@@ -0,0 +1,156 @@
+/***************************************************************************
+    qgsreadaheadfeatureiterator.cpp
+    -------------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgsreadaheadfeatureiterator.h"
+
+#include "qgsexception.h"
+#include "qgsgeometry.h"
+
+#include <QtConcurrentRun>
+
+#include <algorithm>
+
+QgsReadaheadFeatureIterator::QgsReadaheadFeatureIterator( const QgsFeatureIterator &source, int bufferSize )
+  : QgsAbstractFeatureIterator( QgsFeatureRequest() )
+  , mSource( source )
+  , mBufferSize( std::max( 1, bufferSize ) )
+{
+  mValid = mSource.isValid();
+}
+
+QgsReadaheadFeatureIterator::~QgsReadaheadFeatureIterator()
+{
+  stop();
+  if ( !mClosed )
+    mSource.close();
+}
+
+void QgsReadaheadFeatureIterator::ensureStarted()
+{
+  if ( mStarted )
+    return;
+
+  mStarted = true;
+  mFillFuture = QtConcurrent::run( [this]
+  {
+    QgsFeature f;
+    while ( true )
+    {
+      // the wrapped iterator is only touched from this thread while the fill is running
+      if ( !mSource.nextFeature( f ) )
+        break;
+
+      if ( mTransform.isValid() && f.hasGeometry() )
+      {
+        try
+        {
+          QgsGeometry g = f.geometry();
+          g.transform( mTransform );
+          f.setGeometry( g );
+        }
+        catch ( QgsCsException &e )
+        {
+          QMutexLocker locker( &mMutex );
+          mTransformError = e.what();
+          mSourceExhausted = true;
+          mBufferNotEmpty.wakeAll();
+          return;
+        }
+      }
+
+      QMutexLocker locker( &mMutex );
+      while ( mBuffer.size() >= mBufferSize && !mStopRequested )
+        mBufferNotFull.wait( &mMutex );
+
+      if ( mStopRequested )
+        return;
+
+      mBuffer.enqueue( f );
+      mBufferNotEmpty.wakeOne();
+    }
+
+    QMutexLocker locker( &mMutex );
+    mSourceExhausted = true;
+    mBufferNotEmpty.wakeAll();
+  } );
+}
+
+void QgsReadaheadFeatureIterator::setGeometryTransform( const QgsCoordinateTransform &transform )
+{
+  mTransform = transform;
+}
+
+QString QgsReadaheadFeatureIterator::transformError() const
+{
+  QMutexLocker locker( &mMutex );
+  return mTransformError;
+}
+
+bool QgsReadaheadFeatureIterator::fetchFeature( QgsFeature &f )
+{
+  if ( mClosed )
+    return false;
+
+  ensureStarted();
+
+  QMutexLocker locker( &mMutex );
+  while ( mBuffer.isEmpty() && !mSourceExhausted )
+    mBufferNotEmpty.wait( &mMutex );
+
+  if ( mBuffer.isEmpty() )
+    return false;
+
+  f = mBuffer.dequeue();
+  mBufferNotFull.wakeOne();
+  return true;
+}
+
+void QgsReadaheadFeatureIterator::stop()
+{
+  {
+    QMutexLocker locker( &mMutex );
+    mStopRequested = true;
+    mBufferNotFull.wakeAll();
+    mBufferNotEmpty.wakeAll();
+  }
+  mFillFuture.waitForFinished();
+
+  QMutexLocker locker( &mMutex );
+  mStopRequested = false;
+  mStarted = false;
+  mSourceExhausted = false;
+  mTransformError.clear();
+  mBuffer.clear();
+}
+
+bool QgsReadaheadFeatureIterator::rewind()
+{
+  if ( mClosed )
+    return false;
+
+  stop();
+  return mSource.rewind();
+}
+
+bool QgsReadaheadFeatureIterator::close()
+{
+  if ( mClosed )
+    return false;
+
+  stop();
+  mSource.close();
+  mClosed = true;
+  return true;
+}
@@ -0,0 +1,100 @@
+/***************************************************************************
+    qgsreadaheadfeatureiterator.h
+    -----------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+#ifndef QGSREADAHEADFEATUREITERATOR_H
+#define QGSREADAHEADFEATUREITERATOR_H
+
+#define SIP_NO_FILE
+
+#include "qgis_core.h"
+#include "qgsfeatureiterator.h"
+#include "qgscoordinatetransform.h"
+
+#include <QFuture>
+#include <QMutex>
+#include <QQueue>
+#include <QWaitCondition>
+
+/**
+ * \ingroup core
+ * A feature iterator which consumes another iterator on a background thread.
+ *
+ * The wrapped iterator is drained into a bounded buffer by a worker from the
+ * global thread pool, so nextFeature() returns already fetched features while
+ * the next provider batch is in flight. This hides provider I/O latency
+ * (network round trips, disk reads) behind the consumer's own per-feature
+ * work.
+ *
+ * The wrapped iterator is used exclusively from the worker thread once
+ * iteration has begun, so any interruption checker must be attached to it
+ * before the first call to nextFeature().
+ *
+ * \note not available in Python bindings
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsReadaheadFeatureIterator : public QgsAbstractFeatureIterator
+{
+  public:
+
+    /**
+     * Constructor, wrapping the given \a source iterator. At most \a bufferSize
+     * features are held ready for the consumer at any time.
+     */
+    explicit QgsReadaheadFeatureIterator( const QgsFeatureIterator &source, int bufferSize = 1000 );
+
+    ~QgsReadaheadFeatureIterator() override;
+
+    /**
+     * Sets a coordinate \a transform which the worker applies to fetched
+     * geometries before they are queued, overlapping reprojection with the
+     * consumer's work. Must be called before the first call to nextFeature().
+     *
+     * If a geometry cannot be transformed, iteration ends early and
+     * transformError() returns the failure message.
+     */
+    void setGeometryTransform( const QgsCoordinateTransform &transform );
+
+    //! Returns the message of a transform failure which ended iteration, or an empty string
+    QString transformError() const;
+
+    bool rewind() override;
+    bool close() override;
+
+  protected:
+    bool fetchFeature( QgsFeature &f ) override;
+
+  private:
+
+    //! Starts the background fill, if it is not already running
+    void ensureStarted();
+    //! Stops the background fill and waits for the worker to finish
+    void stop();
+
+    QgsFeatureIterator mSource;
+    int mBufferSize = 1000;
+    QgsCoordinateTransform mTransform;
+
+    mutable QMutex mMutex;
+    QString mTransformError;
+    QWaitCondition mBufferNotEmpty;
+    QWaitCondition mBufferNotFull;
+    QQueue< QgsFeature > mBuffer;
+    bool mSourceExhausted = false;
+    bool mStopRequested = false;
+    bool mStarted = false;
+    QFuture< void > mFillFuture;
+
+};
+
+#endif // QGSREADAHEADFEATUREITERATOR_H
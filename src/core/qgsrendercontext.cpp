@@ -48,6 +48,7 @@ QgsRenderContext::QgsRenderContext( const QgsRenderContext &rh )
   , mScaleFactor( rh.mScaleFactor )
   , mRendererScale( rh.mRendererScale )
   , mLabelingEngine( rh.mLabelingEngine )
+  , mStageStatistics( rh.mStageStatistics )
   , mSelectionColor( rh.mSelectionColor )
   , mVectorSimplifyMethod( rh.mVectorSimplifyMethod )
   , mExpressionContext( rh.mExpressionContext )
@@ -75,6 +76,7 @@ QgsRenderContext &QgsRenderContext::operator=( const QgsRenderContext &rh )
   mScaleFactor = rh.mScaleFactor;
   mRendererScale = rh.mRendererScale;
   mLabelingEngine = rh.mLabelingEngine;
+  mStageStatistics = rh.mStageStatistics;
   mSelectionColor = rh.mSelectionColor;
   mVectorSimplifyMethod = rh.mVectorSimplifyMethod;
   mExpressionContext = rh.mExpressionContext;
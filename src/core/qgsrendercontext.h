@@ -21,6 +21,7 @@
 #include "qgis_core.h"
 #include "qgis_sip.h"
 #include <QColor>
+#include <QPolygonF>
 #include <memory>
 
 #include "qgscoordinatetransform.h"
@@ -38,6 +39,7 @@ class QPainter;
 class QgsAbstractGeometry;
 class QgsLabelingEngine;
 class QgsMapSettings;
+class QgsRenderStageStatistics;
 
 
 /**
@@ -275,6 +277,14 @@ class CORE_EXPORT QgsRenderContext
      */
     QgsLabelingEngine *labelingEngine() const { return mLabelingEngine; } SIP_SKIP
 
+    /**
+     * Returns the attached render stage statistics collector (may be NULLPTR).
+     * \note not available in Python bindings
+     * \see setStageStatistics()
+     * \since QGIS 3.8
+     */
+    QgsRenderStageStatistics *stageStatistics() const { return mStageStatistics; } SIP_SKIP
+
     QColor selectionColor() const { return mSelectionColor; }
 
     /**
@@ -356,6 +366,17 @@ class CORE_EXPORT QgsRenderContext
      * \note not available in Python bindings
      */
     void setLabelingEngine( QgsLabelingEngine *engine2 ) { mLabelingEngine = engine2; } SIP_SKIP
+
+    /**
+     * Attaches a render stage statistics \a collector, or detaches it again when
+     * NULLPTR is passed. The collector must outlive all rendering performed with
+     * this context; ownership is not transferred.
+     * \note not available in Python bindings
+     * \see stageStatistics()
+     * \since QGIS 3.8
+     */
+    void setStageStatistics( QgsRenderStageStatistics *collector ) { mStageStatistics = collector; } SIP_SKIP
+
     void setSelectionColor( const QColor &color ) { mSelectionColor = color; }
 
     /**
@@ -493,6 +514,20 @@ class CORE_EXPORT QgsRenderContext
       mTextRenderFormat = format;
     }
 
+    /**
+     * Returns a reusable scratch buffer for geometry clipping operations.
+     *
+     * A render context is local to a single rendering thread, so routing the
+     * temporary buffers of QgsClipper through the context lets their storage
+     * be reused across the features of a layer instead of being reallocated
+     * for every clipped geometry. The buffer contents are undefined between
+     * calls -- any clipping operation on the same context may overwrite them.
+     *
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    QPolygonF &clippingScratchBuffer() { return mClippingScratchBuffer; } SIP_SKIP
+
   private:
 
     Flags mFlags;
@@ -526,6 +561,9 @@ class CORE_EXPORT QgsRenderContext
     //! Newer labeling engine implementation (can be NULLPTR)
     QgsLabelingEngine *mLabelingEngine = nullptr;
 
+    //! Optional per-stage statistics collector, owned by the render job (can be NULLPTR)
+    QgsRenderStageStatistics *mStageStatistics = nullptr;
+
     //! Color used for features that are marked as selected
     QColor mSelectionColor;
 
@@ -551,6 +589,9 @@ class CORE_EXPORT QgsRenderContext
 
     TextRenderFormat mTextRenderFormat = TextFormatAlwaysOutlines;
 
+    //! Reusable scratch space for clipping operations, see clippingScratchBuffer()
+    QPolygonF mClippingScratchBuffer;
+
 #ifdef QGISDEBUG
     bool mHasTransformContext = false;
 #endif
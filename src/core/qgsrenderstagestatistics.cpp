@@ -0,0 +1,74 @@
+/***************************************************************************
+    qgsrenderstagestatistics.cpp
+    ----------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgsrenderstagestatistics.h"
+
+void QgsRenderStageStatistics::addTime( Stage stage, qint64 nanoseconds )
+{
+  switch ( stage )
+  {
+    case FeatureFetch:
+      mFeatureFetchNs.fetchAndAddRelaxed( nanoseconds );
+      break;
+    case SymbolRender:
+      mSymbolRenderNs.fetchAndAddRelaxed( nanoseconds );
+      break;
+    case Labeling:
+      mLabelingNs.fetchAndAddRelaxed( nanoseconds );
+      break;
+  }
+}
+
+qint64 QgsRenderStageStatistics::time( Stage stage ) const
+{
+  switch ( stage )
+  {
+    case FeatureFetch:
+      return mFeatureFetchNs.loadAcquire();
+    case SymbolRender:
+      return mSymbolRenderNs.loadAcquire();
+    case Labeling:
+      return mLabelingNs.loadAcquire();
+  }
+  return 0;
+}
+
+void QgsRenderStageStatistics::addFeatureCount( qint64 count )
+{
+  mFeatureCount.fetchAndAddRelaxed( count );
+}
+
+qint64 QgsRenderStageStatistics::featureCount() const
+{
+  return mFeatureCount.loadAcquire();
+}
+
+QVariantMap QgsRenderStageStatistics::report() const
+{
+  QVariantMap map;
+  map.insert( QStringLiteral( "feature_fetch_ns" ), mFeatureFetchNs.loadAcquire() );
+  map.insert( QStringLiteral( "symbol_render_ns" ), mSymbolRenderNs.loadAcquire() );
+  map.insert( QStringLiteral( "labeling_ns" ), mLabelingNs.loadAcquire() );
+  map.insert( QStringLiteral( "feature_count" ), mFeatureCount.loadAcquire() );
+  return map;
+}
+
+void QgsRenderStageStatistics::reset()
+{
+  mFeatureFetchNs.storeRelease( 0 );
+  mSymbolRenderNs.storeRelease( 0 );
+  mLabelingNs.storeRelease( 0 );
+  mFeatureCount.storeRelease( 0 );
+}
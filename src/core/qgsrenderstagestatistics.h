@@ -0,0 +1,103 @@
+/***************************************************************************
+    qgsrenderstagestatistics.h
+    --------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+#ifndef QGSRENDERSTAGESTATISTICS_H
+#define QGSRENDERSTAGESTATISTICS_H
+
+#define SIP_NO_FILE
+
+#include "qgis_core.h"
+
+#include <QAtomicInteger>
+#include <QVariantMap>
+
+/**
+ * \ingroup core
+ * \class QgsRenderStageStatistics
+ * \brief Collects per-stage timings and counters for a single map render job.
+ *
+ * A statistics collector can be attached to a QgsRenderContext via
+ * QgsRenderContext::setStageStatistics(). Layer renderers which support
+ * instrumentation then accumulate the time spent in the individual render
+ * stages (feature fetching, symbol drawing, label registration) along with
+ * feature counts, and the owning QgsMapRendererJob exposes the totals as a
+ * machine readable report once the job has finished.
+ *
+ * All counters are atomic, so a single collector can safely be shared by the
+ * layer render threads of a parallel render job.
+ *
+ * \note Collection is entirely opt-in; when no collector is attached to the
+ * render context the instrumented code paths only pay for a null check.
+ *
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsRenderStageStatistics
+{
+  public:
+
+    //! Render stages for which time is accumulated
+    enum Stage
+    {
+      FeatureFetch, //!< Fetching (and transforming) features from the provider
+      SymbolRender, //!< Drawing features through the layer renderer
+      Labeling, //!< Registering features with the labeling engine
+    };
+
+    QgsRenderStageStatistics() = default;
+
+    //! QgsRenderStageStatistics cannot be copied, it is shared by reference
+    QgsRenderStageStatistics( const QgsRenderStageStatistics & ) = delete;
+    //! QgsRenderStageStatistics cannot be copied, it is shared by reference
+    QgsRenderStageStatistics &operator=( const QgsRenderStageStatistics & ) = delete;
+
+    /**
+     * Adds \a nanoseconds of elapsed time to the accumulated total for \a stage.
+     */
+    void addTime( Stage stage, qint64 nanoseconds );
+
+    /**
+     * Returns the total time accumulated for \a stage, in nanoseconds.
+     */
+    qint64 time( Stage stage ) const;
+
+    /**
+     * Adds \a count fetched features to the feature counter.
+     */
+    void addFeatureCount( qint64 count );
+
+    /**
+     * Returns the total number of features fetched by the instrumented renderers.
+     */
+    qint64 featureCount() const;
+
+    /**
+     * Returns the collected statistics as a map of counter name to value,
+     * suitable for serialization. Times are reported in nanoseconds.
+     */
+    QVariantMap report() const;
+
+    /**
+     * Resets all counters to zero.
+     */
+    void reset();
+
+  private:
+
+    QAtomicInteger< qint64 > mFeatureFetchNs = 0;
+    QAtomicInteger< qint64 > mSymbolRenderNs = 0;
+    QAtomicInteger< qint64 > mLabelingNs = 0;
+    QAtomicInteger< qint64 > mFeatureCount = 0;
+};
+
+#endif // QGSRENDERSTAGESTATISTICS_H
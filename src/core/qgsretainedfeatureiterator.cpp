@@ -0,0 +1,107 @@
+/***************************************************************************
+    qgsretainedfeatureiterator.cpp
+    ------------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgsretainedfeatureiterator.h"
+
+#include "qgsgeometry.h"
+#include "qgsvectorlayerfeatureiterator.h"
+
+QgsRetainedFeatureIterator::QgsRetainedFeatureIterator( QgsVectorLayerFeatureSource *source, const QgsFeatureRequest &request,
+    const QList<QgsFeature> &retainedFeatures, const QList<QgsRectangle> &fetchRects )
+  : QgsAbstractFeatureIterator( request )
+  , mSource( source )
+  , mRetainedFeatures( retainedFeatures )
+  , mFetchRects( fetchRects )
+{
+}
+
+QgsRetainedFeatureIterator::~QgsRetainedFeatureIterator()
+{
+  close();
+}
+
+bool QgsRetainedFeatureIterator::rewind()
+{
+  mRectIterator.close();
+  mRetainedIndex = 0;
+  mCurrentRect = -1;
+  mEmittedIds.clear();
+  mFetchedFeatures.clear();
+  mFetchComplete = false;
+  return true;
+}
+
+bool QgsRetainedFeatureIterator::close()
+{
+  mRectIterator.close();
+  mClosed = true;
+  return true;
+}
+
+void QgsRetainedFeatureIterator::setInterruptionChecker( QgsFeedback *interruptionChecker )
+{
+  mInterruptionChecker = interruptionChecker;
+  mRectIterator.setInterruptionChecker( interruptionChecker );
+}
+
+bool QgsRetainedFeatureIterator::fetchFeature( QgsFeature &f )
+{
+  // serve the retained features overlapping the requested extent first
+  const QgsRectangle filterRect = mRequest.filterRect();
+  while ( mRetainedIndex < mRetainedFeatures.count() )
+  {
+    const QgsFeature &candidate = mRetainedFeatures.at( mRetainedIndex );
+    mRetainedIndex++;
+    if ( !candidate.hasGeometry() || !candidate.geometry().boundingBox().intersects( filterRect ) )
+      continue;
+
+    f = candidate;
+    mEmittedIds.insert( f.id() );
+    mFetchedFeatures.append( f );
+    return true;
+  }
+
+  // then fetch the regions not covered by the previous job
+  while ( true )
+  {
+    if ( mCurrentRect >= 0 )
+    {
+      while ( mRectIterator.nextFeature( f ) )
+      {
+        // a feature may intersect several of the fetched rectangles as well
+        // as the retained extent
+        if ( mEmittedIds.contains( f.id() ) )
+          continue;
+
+        mEmittedIds.insert( f.id() );
+        mFetchedFeatures.append( f );
+        return true;
+      }
+    }
+
+    mCurrentRect++;
+    if ( mCurrentRect >= mFetchRects.count() )
+    {
+      mFetchComplete = true;
+      return false;
+    }
+
+    QgsFeatureRequest rectRequest( mRequest );
+    rectRequest.setFilterRect( mFetchRects.at( mCurrentRect ) );
+    mRectIterator = mSource->getFeatures( rectRequest );
+    if ( mInterruptionChecker )
+      mRectIterator.setInterruptionChecker( mInterruptionChecker );
+  }
+}
@@ -0,0 +1,90 @@
+/***************************************************************************
+    qgsretainedfeatureiterator.h
+    ----------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+#ifndef QGSRETAINEDFEATUREITERATOR_H
+#define QGSRETAINEDFEATUREITERATOR_H
+
+#define SIP_NO_FILE
+
+#include "qgis_core.h"
+#include "qgsfeatureiterator.h"
+#include "qgsfeatureid.h"
+
+class QgsVectorLayerFeatureSource;
+
+/**
+ * \ingroup core
+ * A feature iterator which serves features retained from a previous fetch
+ * before asking the source for more.
+ *
+ * The retained features are filtered against the request's filter rectangle
+ * and emitted first. The iterator then fetches each of the given rectangles
+ * (typically the parts of the current extent which the previous fetch did not
+ * cover) from the source, de-duplicating by feature id since a feature may
+ * intersect several rectangles as well as the retained extent.
+ *
+ * All emitted features are collected and can be stored for the next job via
+ * fetchedFeatures() once the iteration ran to completion.
+ *
+ * \note not available in Python bindings
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsRetainedFeatureIterator : public QgsAbstractFeatureIterator
+{
+  public:
+
+    /**
+     * Constructor. The \a request must carry the filter rectangle of the
+     * current job; \a retainedFeatures are served first, then each rectangle
+     * in \a fetchRects is fetched from \a source (which must outlive the
+     * iterator) with the remaining request parameters unchanged.
+     */
+    QgsRetainedFeatureIterator( QgsVectorLayerFeatureSource *source, const QgsFeatureRequest &request,
+                                const QList<QgsFeature> &retainedFeatures, const QList<QgsRectangle> &fetchRects );
+
+    ~QgsRetainedFeatureIterator() override;
+
+    bool rewind() override;
+    bool close() override;
+    void setInterruptionChecker( QgsFeedback *interruptionChecker ) override;
+
+    /**
+     * Returns all features emitted so far. Once fetchComplete() returns TRUE
+     * this is a complete cover of the request's filter rectangle.
+     */
+    QList<QgsFeature> fetchedFeatures() const { return mFetchedFeatures; }
+
+    //! Returns TRUE if the iteration ran to completion
+    bool fetchComplete() const { return mFetchComplete; }
+
+  protected:
+    bool fetchFeature( QgsFeature &f ) override;
+
+  private:
+
+    QgsVectorLayerFeatureSource *mSource = nullptr;
+    QList<QgsFeature> mRetainedFeatures;
+    QList<QgsRectangle> mFetchRects;
+    QgsFeedback *mInterruptionChecker = nullptr;
+
+    QgsFeatureIterator mRectIterator;
+    int mRetainedIndex = 0;
+    int mCurrentRect = -1;
+    QgsFeatureIds mEmittedIds;
+    QList<QgsFeature> mFetchedFeatures;
+    bool mFetchComplete = false;
+
+};
+
+#endif // QGSRETAINEDFEATUREITERATOR_H
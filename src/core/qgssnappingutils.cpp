@@ -373,7 +373,11 @@ void QgsSnappingUtils::prepareIndex( const QList<LayerAndAreaOfInterest> &layers
 
       if ( mStrategy == IndexExtent )
       {
+        // index an area somewhat larger than the canvas, so that panning and
+        // small zoom changes keep the existing index warm instead of forcing
+        // a rebuild on every extent change
         QgsRectangle rect( mMapSettings.visibleExtent() );
+        rect.scale( 2 );
         loc->setExtent( &rect );
         loc->init();
       }
@@ -24,6 +24,8 @@
 #include "qgsfeedback.h"
 
 #include <spatialindex/SpatialIndex.h>
+#include <QDataStream>
+#include <QFile>
 #include <QMutex>
 #include <QMutexLocker>
 
@@ -218,6 +220,104 @@ class QgsFeatureIteratorDataStream : public IDataStream
 };
 
 
+/**
+ * \ingroup core
+ * \class QgsSpatialIndexSerializeVisitor
+ * \brief Visitor streaming index entries to a QDataStream for writeToFile().
+ * \note not available in Python bindings
+ */
+class QgsSpatialIndexSerializeVisitor : public SpatialIndex::IVisitor
+{
+  public:
+    explicit QgsSpatialIndexSerializeVisitor( QDataStream &stream )
+      : mStream( stream ) {}
+
+    void visitNode( const INode &n ) override
+    { Q_UNUSED( n ); }
+
+    void visitData( const IData &d ) override
+    {
+      SpatialIndex::IShape *shape = nullptr;
+      d.getShape( &shape );
+      SpatialIndex::Region region;
+      shape->getMBR( region );
+      delete shape;
+
+      mStream << static_cast< qint64 >( d.getIdentifier() )
+              << region.m_pLow[0] << region.m_pLow[1]
+              << region.m_pHigh[0] << region.m_pHigh[1];
+      mCount++;
+    }
+
+    void visitData( std::vector<const IData *> &v ) override
+    { Q_UNUSED( v ); }
+
+    qint64 count() const { return mCount; }
+
+  private:
+    QDataStream &mStream;
+    qint64 mCount = 0;
+};
+
+/**
+ * \ingroup core
+ * \class QgsIndexFileDataStream
+ * \brief Data stream replaying entries serialized by writeToFile() for bulk loading.
+ * \note not available in Python bindings
+ */
+class QgsIndexFileDataStream : public IDataStream
+{
+  public:
+    QgsIndexFileDataStream( QDataStream &stream, qint64 count )
+      : mStream( stream )
+      , mRemaining( count )
+    {
+      readNextEntry();
+    }
+
+    ~QgsIndexFileDataStream() override
+    {
+      delete mNextData;
+    }
+
+    IData *getNext() override
+    {
+      RTree::Data *ret = mNextData;
+      mNextData = nullptr;
+      readNextEntry();
+      return ret;
+    }
+
+    bool hasNext() override { return nullptr != mNextData; }
+
+    uint32_t size() override { Q_ASSERT( false && "not available" ); return 0; }
+
+    void rewind() override { Q_ASSERT( false && "not available" ); }
+
+  protected:
+    void readNextEntry()
+    {
+      if ( mRemaining <= 0 || mStream.status() != QDataStream::Ok )
+        return;
+
+      qint64 id = 0;
+      double low[2];
+      double high[2];
+      mStream >> id >> low[0] >> low[1] >> high[0] >> high[1];
+      if ( mStream.status() != QDataStream::Ok )
+        return;
+
+      mRemaining--;
+      SpatialIndex::Region r( low, high, 2 );
+      mNextData = new RTree::Data( 0, nullptr, r, id );
+    }
+
+  private:
+    QDataStream &mStream;
+    qint64 mRemaining = 0;
+    RTree::Data *mNextData = nullptr;
+};
+
 /**
  * \ingroup core
  * \class QgsSpatialIndexData
@@ -254,6 +354,15 @@ class QgsSpatialIndexData : public QSharedData
         mGeometries = fids.geometries;
     }
 
+    /**
+     * Constructor for QgsSpatialIndexData which bulk loads entries from \a stream,
+     * e.g. when restoring a serialized index from disk.
+     */
+    explicit QgsSpatialIndexData( IDataStream &stream )
+    {
+      initTree( &stream );
+    }
+
     QgsSpatialIndexData( const QgsSpatialIndexData &other )
       : QSharedData( other )
       , mFlags( other.mFlags )
@@ -446,6 +555,61 @@ bool QgsSpatialIndex::addFeature( QgsFeatureId id, const QgsRectangle &bounds )
   return false;
 }
 
+// magic number and format version for serialized spatial index files
+static const quint32 SPATIAL_INDEX_MAGIC = 0x51475349; // 'QGSI'
+static const quint32 SPATIAL_INDEX_VERSION = 1;
+
+bool QgsSpatialIndex::writeToFile( const QString &fileName ) const
+{
+  QFile file( fileName );
+  if ( !file.open( QIODevice::WriteOnly ) )
+    return false;
+
+  QDataStream stream( &file );
+  stream.setVersion( QDataStream::Qt_5_9 );
+  stream << SPATIAL_INDEX_MAGIC << SPATIAL_INDEX_VERSION;
+
+  // entry count is not known up front - write a placeholder and patch it afterwards
+  const qint64 countPos = file.pos();
+  stream << static_cast< qint64 >( 0 );
+
+  QMutexLocker locker( &d->mMutex );
+
+  double low[] = { std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest() };
+  double high[] = { std::numeric_limits<double>::max(), std::numeric_limits<double>::max() };
+  SpatialIndex::Region query( low, high, 2 );
+  QgsSpatialIndexSerializeVisitor visitor( stream );
+  d->mRTree->intersectsWithQuery( query, visitor );
+
+  if ( stream.status() != QDataStream::Ok )
+    return false;
+
+  file.seek( countPos );
+  stream << visitor.count();
+  return stream.status() == QDataStream::Ok;
+}
+
+bool QgsSpatialIndex::readFromFile( const QString &fileName )
+{
+  QFile file( fileName );
+  if ( !file.open( QIODevice::ReadOnly ) )
+    return false;
+
+  QDataStream stream( &file );
+  stream.setVersion( QDataStream::Qt_5_9 );
+
+  quint32 magic = 0;
+  quint32 version = 0;
+  qint64 count = 0;
+  stream >> magic >> version >> count;
+  if ( stream.status() != QDataStream::Ok || magic != SPATIAL_INDEX_MAGIC || version != SPATIAL_INDEX_VERSION || count < 0 )
+    return false;
+
+  QgsIndexFileDataStream entries( stream, count );
+  d = new QgsSpatialIndexData( entries );
+  return stream.status() == QDataStream::Ok;
+}
+
 bool QgsSpatialIndex::deleteFeature( const QgsFeature &f )
 {
   SpatialIndex::Region r;
@@ -163,6 +163,34 @@ class CORE_EXPORT QgsSpatialIndex : public QgsFeatureSink
     bool deleteFeature( const QgsFeature &feature );
 
 
+    /**
+     * Serializes the index content (feature IDs and bounding boxes) to \a fileName,
+     * so that the index can later be restored via readFromFile() instead of being
+     * rebuilt from the data source.
+     *
+     * Stored feature geometries (see FlagStoreFeatureGeometries) are not serialized.
+     *
+     * \returns TRUE if the index was successfully written.
+     * \see readFromFile()
+     * \since QGIS 3.8
+     */
+    bool writeToFile( const QString &fileName ) const;
+
+    /**
+     * Restores an index previously serialized with writeToFile(), replacing any
+     * current index content. The stored entries are bulk loaded into a new packed
+     * R-tree, which is considerably faster than re-inserting features one by one.
+     *
+     * \warning Callers are responsible for ensuring that the serialized index is
+     * still in sync with the underlying data source, e.g. by comparing file
+     * modification times.
+     *
+     * \returns TRUE if the index was successfully restored.
+     * \see writeToFile()
+     * \since QGIS 3.8
+     */
+    bool readFromFile( const QString &fileName );
+
     /* queries */
 
     /**
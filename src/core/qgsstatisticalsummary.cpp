@@ -49,12 +49,32 @@ void QgsStatisticalSummary::reset()
   mThirdQuartile = 0;
   mValueCount.clear();
   mValues.clear();
+  mCentroids.clear();
+  mSketchBuffer.clear();
+  mStreamingMean = 0;
+  mStreamingM2 = 0;
 
   mRequiresHisto = mStatistics & QgsStatisticalSummary::Majority || mStatistics & QgsStatisticalSummary::Minority || mStatistics & QgsStatisticalSummary::Variety;
 
-  mRequiresAllValueStorage = mStatistics & QgsStatisticalSummary::StDev || mStatistics & QgsStatisticalSummary::StDevSample ||
-                             mStatistics & QgsStatisticalSummary::Median || mStatistics & QgsStatisticalSummary::FirstQuartile ||
-                             mStatistics & QgsStatisticalSummary::ThirdQuartile || mStatistics & QgsStatisticalSummary::InterQuartileRange;
+  mRequiresAllValueStorage = !mUseSketch &&
+                             ( mStatistics & QgsStatisticalSummary::StDev || mStatistics & QgsStatisticalSummary::StDevSample ||
+                               mStatistics & QgsStatisticalSummary::Median || mStatistics & QgsStatisticalSummary::FirstQuartile ||
+                               mStatistics & QgsStatisticalSummary::ThirdQuartile || mStatistics & QgsStatisticalSummary::InterQuartileRange );
+
+  mRequiresSketch = mUseSketch &&
+                    ( mStatistics & QgsStatisticalSummary::Median || mStatistics & QgsStatisticalSummary::FirstQuartile ||
+                      mStatistics & QgsStatisticalSummary::ThirdQuartile || mStatistics & QgsStatisticalSummary::InterQuartileRange );
+
+  // buffering incoming values before each compression pass keeps the amortized
+  // per-value cost of the sketch close to a plain append
+  mSketchBufferCapacity = std::max( 64, static_cast< int >( 4.0 / mSketchAccuracy ) );
+}
+
+void QgsStatisticalSummary::setSketchEnabled( bool enabled, double accuracy )
+{
+  mUseSketch = enabled;
+  mSketchAccuracy = qBound( 0.0001, accuracy, 0.5 );
+  reset();
 }
 
 /***************************************************************************
@@ -90,6 +110,21 @@ void QgsStatisticalSummary::addValue( double value )
 
   if ( mRequiresAllValueStorage )
     mValues << value;
+
+  if ( mUseSketch && ( mStatistics & QgsStatisticalSummary::StDev || mStatistics & QgsStatisticalSummary::StDevSample ) )
+  {
+    // Welford's streaming variance
+    double delta = value - mStreamingMean;
+    mStreamingMean += delta / mCount;
+    mStreamingM2 += delta * ( value - mStreamingMean );
+  }
+
+  if ( mRequiresSketch )
+  {
+    mSketchBuffer << value;
+    if ( mSketchBuffer.count() >= mSketchBufferCapacity )
+      compressSketch();
+  }
 }
 
 void QgsStatisticalSummary::addVariant( const QVariant &value )
@@ -130,20 +165,36 @@ void QgsStatisticalSummary::finalize()
 
   if ( mStatistics & QgsStatisticalSummary::StDev || mStatistics & QgsStatisticalSummary::StDevSample )
   {
-    double sumSquared = 0;
-    Q_FOREACH ( double value, mValues )
+    if ( mUseSketch )
+    {
+      mStdev = std::pow( mStreamingM2 / mCount, 0.5 );
+      mSampleStdev = std::pow( mStreamingM2 / ( mCount - 1 ), 0.5 );
+    }
+    else
     {
-      double diff = value - mMean;
-      sumSquared += diff * diff;
+      double sumSquared = 0;
+      Q_FOREACH ( double value, mValues )
+      {
+        double diff = value - mMean;
+        sumSquared += diff * diff;
+      }
+      mStdev = std::pow( sumSquared / mValues.count(), 0.5 );
+      mSampleStdev = std::pow( sumSquared / ( mValues.count() - 1 ), 0.5 );
     }
-    mStdev = std::pow( sumSquared / mValues.count(), 0.5 );
-    mSampleStdev = std::pow( sumSquared / ( mValues.count() - 1 ), 0.5 );
   }
 
-  if ( mStatistics & QgsStatisticalSummary::Median
-       || mStatistics & QgsStatisticalSummary::FirstQuartile
-       || mStatistics & QgsStatisticalSummary::ThirdQuartile
-       || mStatistics & QgsStatisticalSummary::InterQuartileRange )
+  if ( mRequiresSketch )
+  {
+    compressSketch();
+    mMedian = sketchQuantile( 0.5 );
+    mFirstQuartile = sketchQuantile( 0.25 );
+    mThirdQuartile = sketchQuantile( 0.75 );
+  }
+
+  if ( !mUseSketch && ( mStatistics & QgsStatisticalSummary::Median
+         || mStatistics & QgsStatisticalSummary::FirstQuartile
+         || mStatistics & QgsStatisticalSummary::ThirdQuartile
+         || mStatistics & QgsStatisticalSummary::InterQuartileRange ) )
   {
     std::sort( mValues.begin(), mValues.end() );
     bool even = ( mCount % 2 ) < 1;
@@ -157,8 +208,8 @@ void QgsStatisticalSummary::finalize()
     }
   }
 
-  if ( mStatistics & QgsStatisticalSummary::FirstQuartile
-       || mStatistics & QgsStatisticalSummary::InterQuartileRange )
+  if ( !mUseSketch && ( mStatistics & QgsStatisticalSummary::FirstQuartile
+                        || mStatistics & QgsStatisticalSummary::InterQuartileRange ) )
   {
     if ( ( mCount % 2 ) < 1 )
     {
@@ -188,8 +239,8 @@ void QgsStatisticalSummary::finalize()
     }
   }
 
-  if ( mStatistics & QgsStatisticalSummary::ThirdQuartile
-       || mStatistics & QgsStatisticalSummary::InterQuartileRange )
+  if ( !mUseSketch && ( mStatistics & QgsStatisticalSummary::ThirdQuartile
+                        || mStatistics & QgsStatisticalSummary::InterQuartileRange ) )
   {
     if ( ( mCount % 2 ) < 1 )
     {
@@ -235,6 +286,125 @@ void QgsStatisticalSummary::finalize()
 
 }
 
+void QgsStatisticalSummary::combine( const QgsStatisticalSummary &other )
+{
+  mMissing += other.mMissing;
+  if ( other.mCount == 0 )
+    return;
+
+  if ( mCount == 0 )
+    mFirst = other.mFirst;
+  mLast = other.mLast;
+
+  if ( mUseSketch && ( mStatistics & QgsStatisticalSummary::StDev || mStatistics & QgsStatisticalSummary::StDevSample ) )
+  {
+    // parallel variance merge (Chan et al.)
+    double delta = other.mStreamingMean - mStreamingMean;
+    double combinedCount = mCount + other.mCount;
+    mStreamingM2 += other.mStreamingM2 + delta * delta * mCount * other.mCount / combinedCount;
+    mStreamingMean += delta * other.mCount / combinedCount;
+  }
+
+  mCount += other.mCount;
+  mSum += other.mSum;
+  mMin = std::min( mMin, other.mMin );
+  mMax = std::max( mMax, other.mMax );
+
+  if ( mRequiresHisto )
+  {
+    for ( auto it = other.mValueCount.constBegin(); it != other.mValueCount.constEnd(); ++it )
+      mValueCount.insert( it.key(), mValueCount.value( it.key(), 0 ) + it.value() );
+  }
+
+  if ( mRequiresAllValueStorage )
+    mValues << other.mValues;
+
+  if ( mRequiresSketch )
+  {
+    mCentroids << other.mCentroids;
+    mSketchBuffer << other.mSketchBuffer;
+    compressSketch();
+  }
+}
+
+void QgsStatisticalSummary::compressSketch()
+{
+  for ( double value : mSketchBuffer )
+  {
+    Centroid c;
+    c.mean = value;
+    c.weight = 1;
+    mCentroids << c;
+  }
+  mSketchBuffer.clear();
+
+  if ( mCentroids.count() < 2 )
+    return;
+
+  std::sort( mCentroids.begin(), mCentroids.end(), []( const Centroid & a, const Centroid & b ) { return a.mean < b.mean; } );
+
+  double totalWeight = 0;
+  for ( const Centroid &c : mCentroids )
+    totalWeight += c.weight;
+
+  QVector< Centroid > compressed;
+  compressed.reserve( mCentroids.count() );
+  Centroid current = mCentroids.at( 0 );
+  double weightSoFar = 0;
+  for ( int i = 1; i < mCentroids.count(); i++ )
+  {
+    const Centroid &next = mCentroids.at( i );
+    double combinedWeight = current.weight + next.weight;
+    // centroids near the extreme quantiles are kept small so the tails stay accurate
+    double q = ( weightSoFar + combinedWeight / 2 ) / totalWeight;
+    double limit = std::max( 1.0, 4.0 * totalWeight * mSketchAccuracy * q * ( 1 - q ) );
+    if ( combinedWeight <= limit )
+    {
+      current.mean = ( current.mean * current.weight + next.mean * next.weight ) / combinedWeight;
+      current.weight = combinedWeight;
+    }
+    else
+    {
+      weightSoFar += current.weight;
+      compressed << current;
+      current = next;
+    }
+  }
+  compressed << current;
+  mCentroids = compressed;
+}
+
+double QgsStatisticalSummary::sketchQuantile( double quantile ) const
+{
+  if ( mCentroids.isEmpty() )
+    return std::numeric_limits<double>::quiet_NaN();
+  if ( mCentroids.count() == 1 )
+    return mCentroids.at( 0 ).mean;
+
+  double totalWeight = 0;
+  for ( const Centroid &c : mCentroids )
+    totalWeight += c.weight;
+
+  // interpolate linearly between centroid midpoint ranks
+  double target = quantile * totalWeight;
+  double cumulative = 0;
+  double previousMidpoint = 0;
+  double previousMean = mMin;
+  for ( const Centroid &c : mCentroids )
+  {
+    double midpoint = cumulative + c.weight / 2;
+    if ( target <= midpoint )
+    {
+      double t = midpoint > previousMidpoint ? ( target - previousMidpoint ) / ( midpoint - previousMidpoint ) : 1.0;
+      return previousMean + t * ( c.mean - previousMean );
+    }
+    cumulative += c.weight;
+    previousMidpoint = midpoint;
+    previousMean = c.mean;
+  }
+  return mMax;
+}
+
 /***************************************************************************
  * This class is considered CRITICAL and any change MUST be accompanied with
  * full unit tests in testqgsstatisticalsummary.cpp.
@@ -18,6 +18,7 @@
 
 #include <QMap>
 #include <QVariant>
+#include <QVector>
 #include <cmath>
 #include "qgis_core.h"
 
@@ -146,6 +147,55 @@ class CORE_EXPORT QgsStatisticalSummary
      */
     void finalize();
 
+    /**
+     * Sets whether quantile based statistics (median and quartiles) are estimated using
+     * a bounded-memory streaming sketch instead of storing every value.
+     *
+     * By default all values are stored whenever quantile statistics are requested, giving
+     * exact results at the cost of memory proportional to the number of values. With the
+     * sketch \a enabled memory use is bounded by the requested \a accuracy alone, at the
+     * cost of a small rank error in the estimated quantiles (e.g. the default \a accuracy
+     * of 0.01 keeps estimated quantiles within roughly one percentile of the exact result).
+     * Standard deviations are calculated using a streaming formulation in this mode, so no
+     * per-value storage remains apart from the histogram required by the minority, majority
+     * and variety statistics.
+     *
+     * Note that quantiles estimated from the sketch use linear interpolation rather than
+     * the "Tukey's hinges" method used for exact calculation.
+     *
+     * Calling this method resets any existing calculation.
+     *
+     * \see sketchEnabled()
+     * \since QGIS 3.8
+     */
+    void setSketchEnabled( bool enabled, double accuracy = 0.01 );
+
+    /**
+     * Returns TRUE if quantile based statistics are estimated using a bounded-memory
+     * streaming sketch instead of storing every value.
+     * \see setSketchEnabled()
+     * \since QGIS 3.8
+     */
+    bool sketchEnabled() const { return mUseSketch; }
+
+    /**
+     * Combines the partial results from \a other into this summary.
+     *
+     * This allows values to be accumulated in multiple summaries in parallel (e.g. one
+     * summary per thread, each fed a partition of the values) and merged into a single
+     * result. Both summaries must be configured with the same statistics and sketch
+     * settings, and combine() must be called before finalize(). The \a other summary is
+     * treated as covering values which follow those of this summary, so the Last statistic
+     * is taken from \a other while First is preserved.
+     *
+     * Quantile statistics combined without the sketch enabled remain exact; with the
+     * sketch enabled the merged estimate retains the configured accuracy.
+     *
+     * \see setSketchEnabled()
+     * \since QGIS 3.8
+     */
+    void combine( const QgsStatisticalSummary &other );
+
     /**
      * Returns the value of a specified statistic
      * \param stat statistic to return
@@ -321,6 +371,25 @@ class CORE_EXPORT QgsStatisticalSummary
     QList< double > mValues;
     bool mRequiresAllValueStorage = false;
     bool mRequiresHisto = false;
+
+    //! Weighted cluster of nearby values in the streaming quantile sketch
+    struct Centroid
+    {
+      double mean = 0;
+      double weight = 0;
+    };
+
+    bool mUseSketch = false;
+    double mSketchAccuracy = 0.01;
+    int mSketchBufferCapacity = 0;
+    bool mRequiresSketch = false;
+    QVector< Centroid > mCentroids;
+    QVector< double > mSketchBuffer;
+    double mStreamingMean = 0;
+    double mStreamingM2 = 0;
+
+    void compressSketch();
+    double sketchQuantile( double quantile ) const;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS( QgsStatisticalSummary::Statistics )
@@ -18,6 +18,8 @@
 #include "qgstaskmanager.h"
 #include "qgsproject.h"
 #include "qgsmaplayerlistutils.h"
+#include <QThread>
+#include <QThreadPool>
 #include <QtConcurrentRun>
 
 
@@ -362,7 +364,14 @@ class QgsTaskRunnableWrapper : public QRunnable
 QgsTaskManager::QgsTaskManager( QObject *parent )
   : QObject( parent )
   , mTaskMutex( new QMutex( QMutex::Recursive ) )
+  , mThreadPool( new QThreadPool( this ) )
 {
+  // tasks are run on a dedicated pool rather than the global instance, so that a
+  // flood of background tasks cannot starve canvas rendering (which runs via
+  // QtConcurrent on the global pool). Keeping the pool one thread smaller than
+  // the core count additionally reserves capacity for the main thread and GUI.
+  mThreadPool->setMaxThreadCount( std::max( 1, QThread::idealThreadCount() - 1 ) );
+
   connect( QgsProject::instance(), static_cast < void ( QgsProject::* )( const QList< QgsMapLayer * >& ) > ( &QgsProject::layersWillBeRemoved ),
            this, &QgsTaskManager::layersWillBeRemoved );
 }
@@ -625,6 +634,11 @@ int QgsTaskManager::countActiveTasks() const
   return tasks.intersect( mParentTasks ).count();
 }
 
+int QgsTaskManager::maxConcurrentTasks() const
+{
+  return mThreadPool->maxThreadCount();
+}
+
 void QgsTaskManager::triggerTask( QgsTask *task )
 {
   if ( task )
@@ -661,7 +675,7 @@ void QgsTaskManager::taskStatusChanged( int status )
   QgsTaskRunnableWrapper *runnable = mTasks.value( id ).runnable;
   mTaskMutex->unlock();
   if ( runnable )
-    QThreadPool::globalInstance()->cancel( runnable );
+    mThreadPool->cancel( runnable );
 
   if ( status == QgsTask::Terminated || status == QgsTask::Complete )
   {
@@ -764,7 +778,7 @@ bool QgsTaskManager::cleanupAndDeleteTask( QgsTask *task )
   else
   {
     if ( runnable )
-      QThreadPool::globalInstance()->cancel( runnable );
+      mThreadPool->cancel( runnable );
     if ( isParent )
     {
       //task already finished, kill it
@@ -796,7 +810,7 @@ void QgsTaskManager::processQueue()
     if ( task && task->mStatus == QgsTask::Queued && dependenciesSatisfied( it.key() ) && it.value().added.testAndSetRelaxed( 0, 1 ) )
     {
       it.value().createRunnable();
-      QThreadPool::globalInstance()->start( it.value().runnable, it.value().priority );
+      mThreadPool->start( it.value().runnable, it.value().priority );
     }
 
     if ( task && ( task->mStatus != QgsTask::Complete && task->mStatus != QgsTask::Terminated ) )
@@ -29,6 +29,7 @@
 
 class QgsTask;
 class QgsTaskRunnableWrapper;
+class QThreadPool;
 
 //! List of QgsTask objects
 typedef QList< QgsTask * > QgsTaskList;
@@ -493,6 +494,19 @@ class CORE_EXPORT QgsTaskManager : public QObject
      */
     int countActiveTasks() const;
 
+    /**
+     * Returns the maximum number of managed tasks which may run concurrently.
+     *
+     * Managed tasks run on a dedicated thread pool which is kept one thread
+     * smaller than the number of available cores, so that saturating the
+     * manager with background tasks (e.g. a batch export) always leaves
+     * headroom for interactive canvas rendering, which uses the global
+     * thread pool.
+     *
+     * \since QGIS 3.8
+     */
+    int maxConcurrentTasks() const;
+
   public slots:
 
     /**
@@ -576,6 +590,9 @@ class CORE_EXPORT QgsTaskManager : public QObject
 
     mutable QMutex *mTaskMutex;
 
+    //! Dedicated pool for managed tasks, so that they cannot starve the global thread pool
+    QThreadPool *mThreadPool = nullptr;
+
     QMap< long, TaskInfo > mTasks;
     QMap< long, QgsTaskList > mTaskDependencies;
     QMap< long, QgsWeakMapLayerPointerList > mLayerDependencies;
@@ -25,7 +25,9 @@
 #include "qgspainting.h"
 #include "qgsmarkersymbollayer.h"
 #include "qgspainteffectregistry.h"
+#include <QCache>
 #include <QFontDatabase>
+#include <QMutex>
 
 Q_GUI_EXPORT extern int qt_defaultDpiX();
 Q_GUI_EXPORT extern int qt_defaultDpiY();
@@ -54,6 +56,37 @@ static void _fixQPictureDPI( QPainter *p )
             static_cast< double >( qt_defaultDpiY() ) / p->device()->logicalDpiY() );
 }
 
+// Cache of recorded text/buffer pictures. Building the glyph outline path via
+// QPainterPath::addText() and stroking it for the buffer dominates label draw
+// time, and the result only depends on the text, the scaled font and the
+// format, so repeated draws of the same string (pan redraws, recurring label
+// text) can replay the recorded commands instead. Shared between render
+// threads, hence the mutex; hits are returned as deep copies since QPicture
+// replay is not safe on a shared instance.
+static QMutex sPictureCacheMutex;
+static QCache< QString, QPicture > sPictureCache( 500 );
+
+static bool _cachedPicture( const QString &key, QPicture &picture )
+{
+  QMutexLocker locker( &sPictureCacheMutex );
+  if ( QPicture *cached = sPictureCache.object( key ) )
+  {
+    picture.setData( cached->data(), cached->size() );
+    return true;
+  }
+  return false;
+}
+
+static void _storeCachedPicture( const QString &key, const QPicture &picture )
+{
+  // deep copy, so the cached instance never shares state with the picture the
+  // caller is about to replay
+  std::unique_ptr< QPicture > copy( new QPicture() );
+  copy->setData( picture.data(), picture.size() );
+  QMutexLocker locker( &sPictureCacheMutex );
+  sPictureCache.insert( key, copy.release() );
+}
+
 static QColor _readColor( QgsVectorLayer *layer, const QString &property, const QColor &defaultColor = Qt::black, bool withAlpha = true )
 {
   int r = layer->customProperty( property + 'R', QVariant( defaultColor.red() ) ).toInt();
@@ -1817,7 +1850,7 @@ void QgsTextRenderer::drawPart( const QRectF &rect, double rotation, HAlignment
     case Text:
     case Shadow:
     {
-      QFontMetricsF fm( format.scaledFont( context ) );
+      QFontMetricsF fm( QgsFontUtils::cachedMetrics( format.scaledFont( context ) ) );
       drawTextInternal( part, context, format, component,
                         textLines,
                         &fm,
@@ -1860,7 +1893,7 @@ void QgsTextRenderer::drawPart( QPointF origin, double rotation, QgsTextRenderer
     case Text:
     case Shadow:
     {
-      QFontMetricsF fm( format.scaledFont( context ) );
+      QFontMetricsF fm( QgsFontUtils::cachedMetrics( format.scaledFont( context ) ) );
       drawTextInternal( part, context, format, component,
                         textLines,
                         &fm,
@@ -1884,45 +1917,61 @@ void QgsTextRenderer::drawBuffer( QgsRenderContext &context, const QgsTextRender
 
   double penSize = context.convertToPainterUnits( buffer.size(), buffer.sizeUnit(), buffer.sizeMapUnitScale() );
 
-  QPainterPath path;
-  path.setFillRule( Qt::WindingFill );
-  path.addText( 0, 0, format.scaledFont( context ), component.text );
+  const bool hasEffect = buffer.paintEffect() && buffer.paintEffect()->enabled();
   QColor bufferColor = buffer.color();
   bufferColor.setAlphaF( buffer.opacity() );
-  QPen pen( bufferColor );
-  pen.setWidthF( penSize );
-  pen.setJoinStyle( buffer.joinStyle() );
-  QColor tmpColor( bufferColor );
-  // honor pref for whether to fill buffer interior
-  if ( !buffer.fillBufferInterior() )
+
+  // effects may draw differently between applications, so only plain buffers are cached
+  QString cacheKey;
+  if ( !hasEffect )
   {
-    tmpColor.setAlpha( 0 );
+    cacheKey = QStringLiteral( "B|%1|%2|%3|%4|%5|%6" ).arg( component.text, format.scaledFont( context ).key() )
+               .arg( bufferColor.rgba() ).arg( penSize ).arg( buffer.joinStyle() ).arg( buffer.fillBufferInterior() );
   }
 
-  // store buffer's drawing in QPicture for drop shadow call
   QPicture buffPict;
-  QPainter buffp;
-  buffp.begin( &buffPict );
+  if ( cacheKey.isEmpty() || !_cachedPicture( cacheKey, buffPict ) )
+  {
+    QPainterPath path;
+    path.setFillRule( Qt::WindingFill );
+    path.addText( 0, 0, format.scaledFont( context ), component.text );
+    QPen pen( bufferColor );
+    pen.setWidthF( penSize );
+    pen.setJoinStyle( buffer.joinStyle() );
+    QColor tmpColor( bufferColor );
+    // honor pref for whether to fill buffer interior
+    if ( !buffer.fillBufferInterior() )
+    {
+      tmpColor.setAlpha( 0 );
+    }
 
-  if ( buffer.paintEffect() && buffer.paintEffect()->enabled() )
-  {
-    context.setPainter( &buffp );
+    // store buffer's drawing in QPicture for drop shadow call
+    QPainter buffp;
+    buffp.begin( &buffPict );
+
+    if ( hasEffect )
+    {
+      context.setPainter( &buffp );
 
-    buffer.paintEffect()->begin( context );
-    context.painter()->setPen( pen );
-    context.painter()->setBrush( tmpColor );
-    context.painter()->drawPath( path );
-    buffer.paintEffect()->end( context );
+      buffer.paintEffect()->begin( context );
+      context.painter()->setPen( pen );
+      context.painter()->setBrush( tmpColor );
+      context.painter()->drawPath( path );
+      buffer.paintEffect()->end( context );
 
-    context.setPainter( p );
-  }
-  else
-  {
-    buffp.setPen( pen );
-    buffp.setBrush( tmpColor );
-    buffp.drawPath( path );
+      context.setPainter( p );
+    }
+    else
+    {
+      buffp.setPen( pen );
+      buffp.setBrush( tmpColor );
+      buffp.drawPath( path );
+    }
+    buffp.end();
+
+    if ( !cacheKey.isEmpty() )
+      _storeCachedPicture( cacheKey, buffPict );
   }
-  buffp.end();
 
   if ( format.shadow().enabled() && format.shadow().shadowPlacement() == QgsTextShadowSettings::ShadowBuffer )
   {
@@ -1955,7 +2004,7 @@ double QgsTextRenderer::textWidth( const QgsRenderContext &context, const QgsTex
   std::unique_ptr< QFontMetricsF > newFm;
   if ( !fontMetrics )
   {
-    newFm.reset( new QFontMetricsF( format.scaledFont( context ) ) );
+    newFm.reset( new QFontMetricsF( QgsFontUtils::cachedMetrics( format.scaledFont( context ) ) ) );
     fontMetrics = newFm.get();
   }
 
@@ -1973,7 +2022,7 @@ double QgsTextRenderer::textHeight( const QgsRenderContext &context, const QgsTe
   std::unique_ptr< QFontMetricsF > newFm;
   if ( !fontMetrics )
   {
-    newFm.reset( new QFontMetricsF( format.scaledFont( context ) ) );
+    newFm.reset( new QFontMetricsF( QgsFontUtils::cachedMetrics( format.scaledFont( context ) ) ) );
     fontMetrics = newFm.get();
   }
 
@@ -2029,7 +2078,7 @@ void QgsTextRenderer::drawBackground( QgsRenderContext &context, QgsTextRenderer
   if ( mode != Label )
   {
     // need to calculate size of text
-    QFontMetricsF fm( format.scaledFont( context ) );
+    QFontMetricsF fm( QgsFontUtils::cachedMetrics( format.scaledFont( context ) ) );
     double width = textWidth( context, format, textLines, &fm );
     double height = textHeight( context, format, textLines, mode, &fm );
 
@@ -2622,26 +2671,35 @@ void QgsTextRenderer::drawTextInternal( TextPart drawType,
     }
     else
     {
-      // draw text, QPainterPath method
-      QPainterPath path;
-      path.setFillRule( Qt::WindingFill );
-      path.addText( 0, 0, format.scaledFont( context ), subComponent.text );
-
-      // store text's drawing in QPicture for drop shadow call
-      QPicture textPict;
-      QPainter textp;
-      textp.begin( &textPict );
-      textp.setPen( Qt::NoPen );
       QColor textColor = format.color();
       textColor.setAlphaF( format.opacity() );
-      textp.setBrush( textColor );
-      textp.drawPath( path );
-      // TODO: why are some font settings lost on drawPicture() when using drawText() inside QPicture?
-      //       e.g. some capitalization options, but not others
-      //textp.setFont( tmpLyr.textFont );
-      //textp.setPen( tmpLyr.textColor );
-      //textp.drawText( 0, 0, component.text() );
-      textp.end();
+
+      const QString cacheKey = QStringLiteral( "T|%1|%2|%3" ).arg( subComponent.text,
+                               format.scaledFont( context ).key() ).arg( textColor.rgba() );
+
+      QPicture textPict;
+      if ( !_cachedPicture( cacheKey, textPict ) )
+      {
+        // draw text, QPainterPath method
+        QPainterPath path;
+        path.setFillRule( Qt::WindingFill );
+        path.addText( 0, 0, format.scaledFont( context ), subComponent.text );
+
+        // store text's drawing in QPicture for drop shadow call
+        QPainter textp;
+        textp.begin( &textPict );
+        textp.setPen( Qt::NoPen );
+        textp.setBrush( textColor );
+        textp.drawPath( path );
+        // TODO: why are some font settings lost on drawPicture() when using drawText() inside QPicture?
+        //       e.g. some capitalization options, but not others
+        //textp.setFont( tmpLyr.textFont );
+        //textp.setPen( tmpLyr.textColor );
+        //textp.drawText( 0, 0, component.text() );
+        textp.end();
+
+        _storeCachedPicture( cacheKey, textPict );
+      }
 
       if ( format.shadow().enabled() && format.shadow().shadowPlacement() == QgsTextShadowSettings::ShadowText )
       {
@@ -2674,8 +2732,6 @@ void QgsTextRenderer::drawTextInternal( TextPart drawType,
         case QgsRenderContext::TextFormatAlwaysText:
         {
           context.painter()->setFont( format.scaledFont( context ) );
-          QColor textColor = format.color();
-          textColor.setAlphaF( format.opacity() );
           context.painter()->setPen( textColor );
           context.painter()->setRenderHint( QPainter::TextAntialiasing );
           context.painter()->drawText( 0, 0, subComponent.text );
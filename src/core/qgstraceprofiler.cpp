@@ -0,0 +1,182 @@
+/***************************************************************************
+    qgstraceprofiler.cpp
+    --------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgstraceprofiler.h"
+
+#include <QMap>
+#include <QThread>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+std::atomic< bool > QgsTraceProfiler::sEnabled { false };
+
+namespace
+{
+  //! Ring buffer capacity. Must be a power of two.
+  constexpr quint64 RING_SIZE = 1 << 16;
+
+  std::vector< QgsTraceProfiler::TraceEvent > sRing( RING_SIZE );
+  //! Total number of events recorded since the last clear, monotonically increasing
+  std::atomic< quint64 > sEventCount { 0 };
+  //! Trace clock epoch, set when tracing is enabled
+  std::chrono::steady_clock::time_point sEpoch;
+
+  //! Per-thread nesting depth of currently open zones
+  thread_local int sZoneDepth = 0;
+}
+
+qint64 QgsTraceProfiler::now()
+{
+  return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - sEpoch ).count();
+}
+
+void QgsTraceProfiler::Zone::enter( const char *name )
+{
+  mName = name;
+  mDepth = sZoneDepth++;
+  mStart = QgsTraceProfiler::now();
+}
+
+void QgsTraceProfiler::Zone::leave()
+{
+  sZoneDepth--;
+  if ( QgsTraceProfiler::isEnabled() )
+    QgsTraceProfiler::record( mName, mStart, QgsTraceProfiler::now() - mStart, mDepth );
+}
+
+void QgsTraceProfiler::setEnabled( bool enabled )
+{
+  if ( enabled == sEnabled.load() )
+    return;
+
+  if ( enabled )
+  {
+    clear();
+    sEpoch = std::chrono::steady_clock::now();
+  }
+  sEnabled.store( enabled );
+}
+
+void QgsTraceProfiler::clear()
+{
+  sEventCount.store( 0 );
+}
+
+void QgsTraceProfiler::record( const char *zone, qint64 start, qint64 duration, int depth )
+{
+  const quint64 slot = sEventCount.fetch_add( 1, std::memory_order_relaxed ) & ( RING_SIZE - 1 );
+  TraceEvent &event = sRing[ slot ];
+  event.zone = zone;
+  event.threadId = reinterpret_cast< quintptr >( QThread::currentThreadId() );
+  event.start = start;
+  event.duration = duration;
+  event.depth = depth;
+}
+
+QVector<QgsTraceProfiler::TraceEvent> QgsTraceProfiler::events()
+{
+  const quint64 count = sEventCount.load();
+  const quint64 available = std::min( count, RING_SIZE );
+
+  QVector<TraceEvent> result;
+  result.reserve( static_cast< int >( available ) );
+  // when the buffer has wrapped the oldest surviving event sits just past the
+  // most recently written slot
+  const quint64 first = count > RING_SIZE ? count & ( RING_SIZE - 1 ) : 0;
+  for ( quint64 i = 0; i < available; ++i )
+    result.append( sRing[( first + i ) & ( RING_SIZE - 1 )] );
+
+  std::sort( result.begin(), result.end(), []( const TraceEvent & a, const TraceEvent & b )
+  {
+    return a.start < b.start;
+  } );
+  return result;
+}
+
+QString QgsTraceProfiler::asJson()
+{
+  const QVector<TraceEvent> traceEvents = events();
+
+  QString json = QStringLiteral( "{\"traceEvents\":[" );
+  bool firstEvent = true;
+  for ( const TraceEvent &event : traceEvents )
+  {
+    if ( !firstEvent )
+      json += QLatin1Char( ',' );
+    firstEvent = false;
+    json += QStringLiteral( "\n{\"name\":\"%1\",\"ph\":\"X\",\"pid\":1,\"tid\":%2,\"ts\":%3,\"dur\":%4}" )
+            .arg( QString( event.zone ) )
+            .arg( event.threadId )
+            .arg( event.start / 1000.0, 0, 'f', 3 )
+            .arg( event.duration / 1000.0, 0, 'f', 3 );
+  }
+  json += QLatin1String( "\n]}" );
+  return json;
+}
+
+QString QgsTraceProfiler::asFlameGraph()
+{
+  const QVector<TraceEvent> traceEvents = events();
+
+  // reconstruct the zone stack of each thread from the (start sorted) event
+  // intervals and accumulate per-stack self times
+  struct Frame
+  {
+    QString path;
+    qint64 end = 0;
+    qint64 childNs = 0;
+    qint64 duration = 0;
+  };
+
+  QMap< QString, qint64 > selfTimes;
+  QMap< quint64, QVector< Frame > > stacks;
+
+  const auto popFrame = [&selfTimes]( QVector< Frame > &stack )
+  {
+    const Frame frame = stack.takeLast();
+    selfTimes[ frame.path ] += frame.duration - frame.childNs;
+  };
+
+  for ( const TraceEvent &event : traceEvents )
+  {
+    QVector< Frame > &stack = stacks[ event.threadId ];
+    while ( !stack.isEmpty() && stack.last().end <= event.start )
+      popFrame( stack );
+
+    if ( !stack.isEmpty() )
+      stack.last().childNs += event.duration;
+
+    Frame frame;
+    frame.path = stack.isEmpty() ? QString( event.zone )
+                 : stack.last().path + QLatin1Char( ';' ) + QString( event.zone );
+    frame.end = event.start + event.duration;
+    frame.duration = event.duration;
+    stack.append( frame );
+  }
+  for ( auto it = stacks.begin(); it != stacks.end(); ++it )
+  {
+    while ( !it.value().isEmpty() )
+      popFrame( it.value() );
+  }
+
+  QString result;
+  for ( auto it = selfTimes.constBegin(); it != selfTimes.constEnd(); ++it )
+  {
+    result += QStringLiteral( "%1 %2\n" ).arg( it.key() ).arg( it.value() / 1000 );
+  }
+  return result;
+}
@@ -0,0 +1,158 @@
+/***************************************************************************
+    qgstraceprofiler.h
+    ------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+#ifndef QGSTRACEPROFILER_H
+#define QGSTRACEPROFILER_H
+
+#define SIP_NO_FILE
+
+#include "qgis_core.h"
+
+#include <QString>
+#include <QVector>
+#include <atomic>
+
+/**
+ * \ingroup core
+ * \class QgsTraceProfiler
+ * \brief Always-available scoped profiler for instrumenting hot code paths.
+ *
+ * Unlike QgsRuntimeProfiler (which times coarse, named startup phases) or
+ * QgsRenderStageStatistics (which aggregates totals for a single render job),
+ * this profiler records individual zone enter/leave events into a fixed size
+ * lock free ring buffer, preserving nesting and thread information. The
+ * collected trace can be exported as a Chrome trace event JSON document
+ * (loadable in chrome://tracing or speedscope) or as collapsed stacks in the
+ * format consumed by flamegraph.pl.
+ *
+ * Zones are declared with the QGS_TRACE_ZONE macro, which expands to a scoped
+ * RAII object. When tracing is disabled -- the default -- entering a zone
+ * costs a single relaxed atomic load, so the instrumentation can be left
+ * compiled into release builds and switched on at runtime on a user's machine
+ * when a project misbehaves.
+ *
+ * All methods are thread safe. The ring buffer keeps the most recent events
+ * only; long captures overwrite the oldest entries.
+ *
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsTraceProfiler
+{
+  public:
+
+    //! A single recorded zone occurrence
+    struct TraceEvent
+    {
+      //! Zone name. Always points to a string literal, never freed.
+      const char *zone = nullptr;
+      //! Identifier of the thread the zone ran on
+      quint64 threadId = 0;
+      //! Start time in nanoseconds, relative to the moment tracing was enabled
+      qint64 start = 0;
+      //! Elapsed time in nanoseconds
+      qint64 duration = 0;
+      //! Nesting depth of the zone within its thread at the time it was entered
+      int depth = 0;
+    };
+
+    /**
+     * \brief Scoped RAII timer for a named zone.
+     *
+     * The zone \a name MUST be a string literal (or otherwise outlive the
+     * profiler) -- only the pointer is stored. Use the QGS_TRACE_ZONE macro
+     * rather than instantiating this class directly.
+     */
+    class CORE_EXPORT Zone
+    {
+      public:
+
+        //! Enters the zone \a name if tracing is currently enabled
+        explicit Zone( const char *name )
+        {
+          if ( QgsTraceProfiler::isEnabled() )
+            enter( name );
+        }
+
+        ~Zone()
+        {
+          if ( mName )
+            leave();
+        }
+
+        Zone( const Zone & ) = delete;
+        Zone &operator=( const Zone & ) = delete;
+
+      private:
+
+        void enter( const char *name );
+        void leave();
+
+        const char *mName = nullptr;
+        qint64 mStart = 0;
+        int mDepth = 0;
+    };
+
+    //! Returns TRUE if trace collection is currently enabled
+    static bool isEnabled() { return sEnabled.load( std::memory_order_relaxed ); }
+
+    /**
+     * Enables or disables trace collection. Enabling resets the trace clock;
+     * previously recorded events are cleared.
+     */
+    static void setEnabled( bool enabled );
+
+    //! Discards all recorded events
+    static void clear();
+
+    /**
+     * Returns the recorded events, oldest first. If more events were recorded
+     * than the ring buffer holds only the most recent ones are returned.
+     *
+     * Should be called while tracing is disabled -- events recorded during
+     * the copy may be returned partially initialized.
+     */
+    static QVector<QgsTraceProfiler::TraceEvent> events();
+
+    /**
+     * Returns the recorded trace as a JSON document in the Chrome trace event
+     * format, suitable for chrome://tracing or speedscope.
+     */
+    static QString asJson();
+
+    /**
+     * Returns the recorded trace as collapsed stacks ("zoneA;zoneB <µs>"
+     * lines, one per unique stack and thread), the input format of
+     * flamegraph.pl. Values are self times in microseconds.
+     */
+    static QString asFlameGraph();
+
+  private:
+
+    static void record( const char *zone, qint64 start, qint64 duration, int depth );
+    static qint64 now();
+
+    static std::atomic< bool > sEnabled;
+
+    friend class TestQgsTraceProfiler;
+};
+
+/**
+ * Declares a scoped profiling zone covering the rest of the enclosing block.
+ * The \a name must be a string literal.
+ *
+ * \since QGIS 3.8
+ */
+#define QGS_TRACE_ZONE( name ) QgsTraceProfiler::Zone _qgsTraceZone_( name )
+
+#endif // QGSTRACEPROFILER_H
@@ -16,6 +16,7 @@
 #include "qgstracer.h"
 
 
+#include "qgscoordinatetransform.h"
 #include "qgsfeatureiterator.h"
 #include "qgsgeometry.h"
 #include "qgsgeometryutils.h"
@@ -477,8 +478,23 @@ bool QgsTracer::initGraph()
   t1.start();
   int featuresCounted = 0;
   bool enableInvisibleFeature = QgsSettings().value( QStringLiteral( "/qgis/digitizing/snap_invisible_feature" ), false ).toBool();
-  for ( const QgsVectorLayer *vl : qgis::as_const( mLayers ) )
+  for ( QgsVectorLayer *vl : qgis::as_const( mLayers ) )
   {
+    // reuse linework extracted by a previous build, patched by the edit signal
+    // handlers below -- only layers without a cache entry are read again
+    const auto cacheIt = mLayerLinework.constFind( vl );
+    if ( cacheIt != mLayerLinework.constEnd() )
+    {
+      for ( auto it = cacheIt->constBegin(); it != cacheIt->constEnd(); ++it )
+        mpl += it.value();
+
+      featuresCounted += cacheIt->size();
+      if ( mMaxFeatureCount != 0 && featuresCounted >= mMaxFeatureCount )
+        return false;
+
+      continue;
+    }
+
     QgsFeatureRequest request;
     bool filter = false;
     std::unique_ptr< QgsFeatureRenderer > renderer;
@@ -504,6 +520,8 @@ bool QgsTracer::initGraph()
     if ( !mExtent.isEmpty() )
       request.setFilterRect( mExtent );
 
+    QHash< QgsFeatureId, QgsMultiPolylineXY > linework;
+
     QgsFeatureIterator fi = vl->getFeatures( request );
     while ( fi.nextFeature( f ) )
     {
@@ -519,13 +537,20 @@ bool QgsTracer::initGraph()
         }
       }
 
-      extractLinework( f.geometry(), mpl );
+      QgsMultiPolylineXY featureMpl;
+      extractLinework( f.geometry(), featureMpl );
+      linework.insert( f.id(), featureMpl );
+      mpl += featureMpl;
 
       ++featuresCounted;
       if ( mMaxFeatureCount != 0 && featuresCounted >= mMaxFeatureCount )
         return false;
     }
 
+    mLayerLinework.insert( vl, linework );
+    if ( filter )
+      mFilteredLayers.insert( vl );
+
     if ( renderer )
     {
       renderer->stopRender( *ctx.get() );
@@ -677,26 +702,84 @@ bool QgsTracer::init()
 
 void QgsTracer::invalidateGraph()
 {
+  // full invalidation -- also used externally for "anything may have changed"
+  // signals (canvas extent, CRS, snapping config), so the linework cache must
+  // not survive it
+  mGraph.reset( nullptr );
+  mLayerLinework.clear();
+  mFilteredLayers.clear();
+}
+
+void QgsTracer::invalidateLayerLinework( QgsVectorLayer *layer )
+{
+  mLayerLinework.remove( layer );
+  mFilteredLayers.remove( layer );
+  mGraph.reset( nullptr );
+}
+
+void QgsTracer::updateFeatureLinework( QgsVectorLayer *layer, QgsFeatureId fid, const QgsGeometry &geom )
+{
+  auto layerIt = mLayerLinework.find( layer );
+  if ( layerIt == mLayerLinework.end() || mFilteredLayers.contains( layer ) )
+  {
+    // no cached linework to patch, or feature visibility may depend on the
+    // renderer -- re-extract the whole layer on the next build
+    invalidateLayerLinework( layer );
+    return;
+  }
+
+  QgsGeometry g = geom;
+  if ( mCRS.isValid() && layer->crs() != mCRS )
+  {
+    try
+    {
+      g.transform( QgsCoordinateTransform( layer->crs(), mCRS, mTransformContext ) );
+    }
+    catch ( QgsCsException & )
+    {
+      invalidateLayerLinework( layer );
+      return;
+    }
+  }
+
+  QgsMultiPolylineXY featureMpl;
+  if ( !g.isNull() && ( mExtent.isEmpty() || g.boundingBox().intersects( mExtent ) ) )
+    extractLinework( g, featureMpl );
+
+  layerIt->insert( fid, featureMpl );
   mGraph.reset( nullptr );
 }
 
 void QgsTracer::onFeatureAdded( QgsFeatureId fid )
 {
-  Q_UNUSED( fid );
-  invalidateGraph();
+  QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( sender() );
+  if ( !layer || !mLayerLinework.contains( layer ) || mFilteredLayers.contains( layer ) )
+  {
+    invalidateLayerLinework( layer );
+    return;
+  }
+
+  QgsFeature f;
+  if ( layer->getFeatures( QgsFeatureRequest( fid ).setNoAttributes() ).nextFeature( f ) )
+    updateFeatureLinework( layer, fid, f.geometry() );
+  else
+    invalidateLayerLinework( layer );
 }
 
 void QgsTracer::onFeatureDeleted( QgsFeatureId fid )
 {
-  Q_UNUSED( fid );
-  invalidateGraph();
+  QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( sender() );
+  auto layerIt = layer ? mLayerLinework.find( layer ) : mLayerLinework.end();
+  if ( layerIt != mLayerLinework.end() )
+    layerIt->remove( fid );
+
+  mGraph.reset( nullptr );
 }
 
 void QgsTracer::onGeometryChanged( QgsFeatureId fid, const QgsGeometry &geom )
 {
-  Q_UNUSED( fid );
-  Q_UNUSED( geom );
-  invalidateGraph();
+  QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( sender() );
+  updateFeatureLinework( layer, fid, geom );
 }
 
 void QgsTracer::onAttributeValueChanged( QgsFeatureId fid, int idx, const QVariant &value )
@@ -704,24 +787,32 @@ void QgsTracer::onAttributeValueChanged( QgsFeatureId fid, int idx, const QVaria
   Q_UNUSED( fid );
   Q_UNUSED( idx );
   Q_UNUSED( value );
-  invalidateGraph();
+
+  QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( sender() );
+  if ( layer && mLayerLinework.contains( layer ) && !mFilteredLayers.contains( layer ) )
+    return; // attribute values cannot influence unfiltered linework
+
+  invalidateLayerLinework( layer );
 }
 
 void QgsTracer::onDataChanged( )
 {
-  invalidateGraph();
+  invalidateLayerLinework( qobject_cast<QgsVectorLayer *>( sender() ) );
 }
 
 void QgsTracer::onStyleChanged( )
 {
-  invalidateGraph();
+  invalidateLayerLinework( qobject_cast<QgsVectorLayer *>( sender() ) );
 }
 
 void QgsTracer::onLayerDestroyed( QObject *obj )
 {
   // remove the layer before it is completely invalid (static_cast should be the safest cast)
-  mLayers.removeAll( static_cast<QgsVectorLayer *>( obj ) );
-  invalidateGraph();
+  QgsVectorLayer *layer = static_cast<QgsVectorLayer *>( obj );
+  mLayers.removeAll( layer );
+  mLayerLinework.remove( layer );
+  mFilteredLayers.remove( layer );
+  mGraph.reset( nullptr );
 }
 
 QVector<QgsPointXY> QgsTracer::findShortestPath( const QgsPointXY &p1, const QgsPointXY &p2, PathError *error )
@@ -19,6 +19,7 @@
 class QgsVectorLayer;
 
 #include "qgis_core.h"
+#include <QHash>
 #include <QSet>
 #include <QVector>
 #include <memory>
@@ -164,6 +165,17 @@ class CORE_EXPORT QgsTracer : public QObject
   private:
     bool initGraph();
 
+    //! Drops any cached linework for \a layer and marks the graph for a rebuild
+    void invalidateLayerLinework( QgsVectorLayer *layer );
+
+    /**
+     * Replaces the cached linework of a single feature from its new \a geom
+     * (in layer CRS). Falls back to invalidating the layer's whole cache when
+     * per-feature updates are not safe (no cache yet, or renderer filtering
+     * in use).
+     */
+    void updateFeatureLinework( QgsVectorLayer *layer, QgsFeatureId fid, const QgsGeometry &geom );
+
   private slots:
     void onFeatureAdded( QgsFeatureId fid );
     void onFeatureDeleted( QgsFeatureId fid );
@@ -207,6 +219,16 @@ class CORE_EXPORT QgsTracer : public QObject
      * due to noding exception, indicating some input data topology problems
      */
     bool mHasTopologyProblem = false;
+
+    /**
+     * Linework extracted per layer and feature, already transformed to the
+     * destination CRS. Edits during a digitizing session patch only the
+     * features they touch, so the next graph build skips re-reading and
+     * re-projecting every layer and goes straight to noding.
+     */
+    QHash< QgsVectorLayer *, QHash< QgsFeatureId, QgsMultiPolylineXY > > mLayerLinework;
+    //! Layers whose cached linework depends on renderer filtering, where per-feature updates are unsafe
+    QSet< QgsVectorLayer * > mFilteredLayers;
 };
 
 
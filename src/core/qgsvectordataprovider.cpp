@@ -464,6 +464,37 @@ QStringList QgsVectorDataProvider::uniqueStringsMatching( int index, const QStri
   return results;
 }
 
+bool QgsVectorDataProvider::fetchNumericColumn( int index, QVector<double> &values, long long &nullCount, QgsFeedback *feedback ) const
+{
+  values.clear();
+  nullCount = 0;
+
+  // Safety belt
+  if ( index < 0 || index >= fields().count() )
+    return false;
+
+  QgsFeatureRequest request;
+  request.setSubsetOfAttributes( QgsAttributeList() << index );
+  request.setFlags( QgsFeatureRequest::NoGeometry );
+  QgsFeatureIterator fi = getFeatures( request );
+
+  QgsFeature f;
+  while ( fi.nextFeature( f ) )
+  {
+    if ( feedback && feedback->isCanceled() )
+      return false;
+
+    const QVariant value = f.attribute( index );
+    bool convertOk = false;
+    const double doubleValue = value.toDouble( &convertOk );
+    if ( value.isNull() || !convertOk )
+      nullCount++;
+    else
+      values.append( doubleValue );
+  }
+  return true;
+}
+
 QVariant QgsVectorDataProvider::aggregate( QgsAggregateCalculator::Aggregate aggregate, int index,
     const QgsAggregateCalculator::AggregateParameters &parameters, QgsExpressionContext *context, bool &ok ) const
 {
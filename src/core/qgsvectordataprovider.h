@@ -231,6 +231,28 @@ class CORE_EXPORT QgsVectorDataProvider : public QgsDataProvider, public QgsFeat
     virtual QStringList uniqueStringsMatching( int index, const QString &substring, int limit = -1,
         QgsFeedback *feedback = nullptr ) const;
 
+    /**
+     * Fetches all values of a numeric attribute into a contiguous column of doubles,
+     * avoiding the per-feature QgsFeature and QVariant overhead of an iterator based
+     * scan. Any subset string set on the provider is respected.
+     *
+     * NULL values (and values which cannot be converted to a numeric value) are not
+     * appended to \a values but are instead counted in \a nullCount.
+     *
+     * The default implementation iterates over the provider's features requesting only
+     * the target attribute. Providers with a cheaper native path (e.g. SQL based
+     * providers) should override this method to fill the column directly.
+     *
+     * \param index the index of the attribute
+     * \param values vector to fill with the attribute values. Any existing content is cleared.
+     * \param nullCount will be set to the number of NULL (or non-numeric) values encountered
+     * \param feedback optional feedback object for canceling request
+     * \returns TRUE if the column was successfully fetched, FALSE if the fetch failed or was canceled
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    virtual bool fetchNumericColumn( int index, QVector<double> &values, long long &nullCount, QgsFeedback *feedback = nullptr ) const SIP_SKIP;
+
     /**
      * Calculates an aggregated value from the layer's features. The base implementation does nothing,
      * but subclasses can override this method to handoff calculation of aggregates to the provider.
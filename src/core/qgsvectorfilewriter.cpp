@@ -33,7 +33,9 @@
 #include "qgsexception.h"
 #include "qgssettings.h"
 #include "qgsgeometryengine.h"
+#include "qgsmaptopixelgeometrysimplifier.h"
 #include "qgsproviderregistry.h"
+#include "qgsreadaheadfeatureiterator.h"
 #include "qgsexpressioncontextutils.h"
 
 #include <QFile>
@@ -2529,6 +2531,7 @@ QgsVectorFileWriter::WriterError QgsVectorFileWriter::prepareWriteAsVectorFormat
       req.setFilterFids( details.selectedFeatureIds );
     }
     req.setNoAttributes();
+    req.setBackgroundPriority( true );
     details.geometryTypeScanIterator = layer->getFeatures( req );
   }
 
@@ -2608,6 +2611,9 @@ QgsVectorFileWriter::WriterError QgsVectorFileWriter::prepareWriteAsVectorFormat
 
   QgsFeatureRequest req;
   req.setSubsetOfAttributes( details.attributes );
+  // exports are batch work -- don't let them starve interactive requests of
+  // pooled provider connections
+  req.setBackgroundPriority( true );
   if ( options.onlySelectedFeatures )
     req.setFilterFids( details.selectedFeatureIds );
 
@@ -2767,6 +2773,26 @@ QgsVectorFileWriter::WriterError QgsVectorFileWriter::writeAsVectorFormat( Prepa
   // Reset mFields to layer fields, and not just exported fields
   writer->mFields = details.sourceFields;
 
+  std::unique_ptr< QgsMapToPixelSimplifier > simplifier;
+  if ( options.simplificationTolerance > 0 )
+  {
+    simplifier = qgis::make_unique< QgsMapToPixelSimplifier >( QgsMapToPixelSimplifier::SimplifyGeometry,
+                 options.simplificationTolerance,
+                 QgsMapToPixelSimplifier::Distance );
+  }
+
+  // fetch (and reproject) on a background worker, so that source I/O and CRS
+  // transformation overlap with the OGR write calls below. The iterator is
+  // handed to the readahead worker exclusively from here on.
+  QgsReadaheadFeatureIterator *readahead = nullptr;
+  if ( QgsSettings().value( QStringLiteral( "qgis/featureReadahead" ), false ).toBool() )
+  {
+    readahead = new QgsReadaheadFeatureIterator( details.sourceFeatureIterator );
+    if ( details.shallTransform )
+      readahead->setGeometryTransform( options.ct );
+    details.sourceFeatureIterator = QgsFeatureIterator( readahead );
+  }
+
   // write all features
   long saved = 0;
   int initialProgress = lastProgressReport;
@@ -2789,7 +2815,7 @@ QgsVectorFileWriter::WriterError QgsVectorFileWriter::writeAsVectorFormat( Prepa
       }
     }
 
-    if ( details.shallTransform )
+    if ( details.shallTransform && !readahead )
     {
       try
       {
@@ -2815,6 +2841,12 @@ QgsVectorFileWriter::WriterError QgsVectorFileWriter::writeAsVectorFormat( Prepa
     if ( fet.hasGeometry() && details.filterRectEngine && !details.filterRectEngine->intersects( fet.geometry().constGet() ) )
       continue;
 
+    // generalize after the transform, so the tolerance applies in destination CRS units
+    if ( simplifier && fet.hasGeometry() )
+    {
+      fet.setGeometry( simplifier->simplify( fet.geometry() ) );
+    }
+
     if ( details.attributes.empty() && options.skipAttributeCreation )
     {
       fet.initAttributes( 0 );
@@ -2847,6 +2879,17 @@ QgsVectorFileWriter::WriterError QgsVectorFileWriter::writeAsVectorFormat( Prepa
     n++;
   }
 
+  if ( readahead && !readahead->transformError().isEmpty() )
+  {
+    QString msg = QObject::tr( "Failed to transform a point while drawing a feature. Writing stopped. (Exception: %1)" )
+                  .arg( readahead->transformError() );
+    QgsLogger::warning( msg );
+    if ( errorMessage )
+      *errorMessage = msg;
+
+    return ErrProjection;
+  }
+
   writer->stopRender();
 
   if ( errors > 0 && errorMessage && n > 0 )
@@ -504,6 +504,20 @@ class CORE_EXPORT QgsVectorFileWriter : public QgsFeatureSink
          */
         QgsVectorFileWriter::FieldValueConverter *fieldValueConverter = nullptr;
 
+        /**
+         * Simplification tolerance for the geometries to export, in units of the
+         * destination coordinate reference system. A tolerance of 0 (the default)
+         * disables simplification.
+         *
+         * Geometries are generalized with QgsMapToPixelSimplifier before being
+         * written, so pre-generalized copies of a layer targeting specific map
+         * scales can be materialized (e.g. via QgsVectorFileWriterTask in the
+         * background) and browsed in place of the raw data.
+         *
+         * \since QGIS 3.8
+         */
+        double simplificationTolerance = 0.0;
+
         //! Optional feedback object allowing cancellation of layer save
         QgsFeedback *feedback = nullptr;
     };
@@ -77,6 +77,7 @@
 #include "qgsvectorlayerlabeling.h"
 #include "qgsvectorlayerrenderer.h"
 #include "qgsvectorlayerundocommand.h"
+#include "qgsvectorlayerextentcalculator.h"
 #include "qgsvectorlayerfeaturecounter.h"
 #include "qgspoint.h"
 #include "qgsrenderer.h"
@@ -204,6 +205,9 @@ QgsVectorLayer::~QgsVectorLayer()
 
   if ( mFeatureCounter )
     mFeatureCounter->cancel();
+
+  if ( mExtentCalculator )
+    mExtentCalculator->cancel();
 }
 
 QgsVectorLayer *QgsVectorLayer::clone() const
@@ -578,8 +582,31 @@ void QgsVectorLayer::setProviderEncoding( const QString &encoding )
   }
 }
 
+//! Serialized form of a diagram renderer, used to detect writes which do not change the definition
+static QString _diagramRendererDefinition( const QgsDiagramRenderer *renderer )
+{
+  QDomDocument doc;
+  QDomElement elem = doc.createElement( QStringLiteral( "diagram" ) );
+  renderer->writeXml( elem, doc, QgsReadWriteContext() );
+  doc.appendChild( elem );
+  return doc.toString( 0 );
+}
+
 void QgsVectorLayer::setDiagramRenderer( QgsDiagramRenderer *r )
 {
+  if ( r == mDiagramRenderer )
+    return;
+
+  // suppress the change cascade when the new definition equals the old one -
+  // the passed renderer is still installed so callers keeping the raw pointer
+  // remain valid, only the signals are skipped
+  if ( r && mDiagramRenderer && _diagramRendererDefinition( r ) == _diagramRendererDefinition( mDiagramRenderer ) )
+  {
+    delete mDiagramRenderer;
+    mDiagramRenderer = r;
+    return;
+  }
+
   delete mDiagramRenderer;
   mDiagramRenderer = r;
   emit rendererChanged();
@@ -730,6 +757,41 @@ void QgsVectorLayer::updateExtents( bool force )
     mValidExtent = false;
 }
 
+bool QgsVectorLayer::canGrowCachedExtent() const
+{
+  // do not touch the extent when the trust project option is activated
+  return mValidExtent && ( !mReadExtentFromXml || mXmlExtent.isNull() );
+}
+
+void QgsVectorLayer::growCachedExtent( const QgsRectangle &bbox )
+{
+  mExtent.combineExtentWith( bbox );
+
+  // an extent computed from a snapshot taken before this edit must not overwrite
+  // the grown value
+  if ( mExtentCalculator )
+    mExtentRecalculationPending = true;
+}
+
+void QgsVectorLayer::scheduleExtentRecalculation()
+{
+  // nothing cached to refresh -- the next extent() call recomputes from scratch
+  if ( !canGrowCachedExtent() )
+    return;
+
+  if ( mExtentCalculator )
+  {
+    mExtentRecalculationPending = true;
+    return;
+  }
+
+  mExtentCalculator = new QgsVectorLayerExtentCalculator( this );
+  connect( mExtentCalculator, &QgsTask::taskCompleted, this, &QgsVectorLayer::onExtentCalculatorCompleted );
+  connect( mExtentCalculator, &QgsTask::taskTerminated, this, &QgsVectorLayer::onExtentCalculatorTerminated );
+
+  QgsApplication::taskManager()->addTask( mExtentCalculator );
+}
+
 void QgsVectorLayer::setExtent( const QgsRectangle &r )
 {
   QgsMapLayer::setExtent( r );
@@ -945,7 +1007,18 @@ bool QgsVectorLayer::addFeature( QgsFeature &feature, Flags )
 
   if ( success )
   {
-    updateExtents();
+    if ( canGrowCachedExtent() && feature.hasGeometry() )
+    {
+      // an appended feature can only ever grow the layer's extent, so expand the
+      // cached extent in place instead of invalidating it. Recalculating it lazily
+      // would cost a scan over all features added in this edit session, which hurts
+      // high-frequency appends (e.g. live GPS track layers redrawn on every fix).
+      growCachedExtent( feature.geometry().boundingBox() );
+    }
+    else
+    {
+      updateExtents();
+    }
 
     if ( mJoinBuffer->containsJoins() )
       success = mJoinBuffer->addFeature( feature );
@@ -1018,10 +1091,7 @@ bool QgsVectorLayer::insertVertex( double x, double y, QgsFeatureId atFeatureId,
     return false;
 
   QgsVectorLayerEditUtils utils( this );
-  bool result = utils.insertVertex( x, y, atFeatureId, beforeVertex );
-  if ( result )
-    updateExtents();
-  return result;
+  return utils.insertVertex( x, y, atFeatureId, beforeVertex );
 }
 
 
@@ -1031,10 +1101,7 @@ bool QgsVectorLayer::insertVertex( const QgsPoint &point, QgsFeatureId atFeature
     return false;
 
   QgsVectorLayerEditUtils utils( this );
-  bool result = utils.insertVertex( point, atFeatureId, beforeVertex );
-  if ( result )
-    updateExtents();
-  return result;
+  return utils.insertVertex( point, atFeatureId, beforeVertex );
 }
 
 
@@ -1044,11 +1111,9 @@ bool QgsVectorLayer::moveVertex( double x, double y, QgsFeatureId atFeatureId, i
     return false;
 
   QgsVectorLayerEditUtils utils( this );
-  bool result = utils.moveVertex( x, y, atFeatureId, atVertex );
 
-  if ( result )
-    updateExtents();
-  return result;
+  // extent maintenance is handled by changeGeometry()
+  return utils.moveVertex( x, y, atFeatureId, atVertex );
 }
 
 bool QgsVectorLayer::moveVertex( const QgsPoint &p, QgsFeatureId atFeatureId, int atVertex )
@@ -1057,11 +1122,7 @@ bool QgsVectorLayer::moveVertex( const QgsPoint &p, QgsFeatureId atFeatureId, in
     return false;
 
   QgsVectorLayerEditUtils utils( this );
-  bool result = utils.moveVertex( p, atFeatureId, atVertex );
-
-  if ( result )
-    updateExtents();
-  return result;
+  return utils.moveVertex( p, atFeatureId, atVertex );
 }
 
 QgsVectorLayer::EditResult QgsVectorLayer::deleteVertex( QgsFeatureId featureId, int vertex )
@@ -1070,11 +1131,7 @@ QgsVectorLayer::EditResult QgsVectorLayer::deleteVertex( QgsFeatureId featureId,
     return QgsVectorLayer::InvalidLayer;
 
   QgsVectorLayerEditUtils utils( this );
-  EditResult result = utils.deleteVertex( featureId, vertex );
-
-  if ( result == Success )
-    updateExtents();
-  return result;
+  return utils.deleteVertex( featureId, vertex );
 }
 
 
@@ -1100,7 +1157,6 @@ bool QgsVectorLayer::deleteSelectedFeatures( int *deletedCount )
   }
 
   triggerRepaint();
-  updateExtents();
 
   if ( deletedCount )
   {
@@ -1350,9 +1406,12 @@ bool QgsVectorLayer::startEditing()
   connect( mEditBuffer, &QgsVectorLayerEditBuffer::layerModified, this, &QgsVectorLayer::layerModified ); // TODO[MD]: necessary?
   //connect( mEditBuffer, SIGNAL( layerModified() ), this, SLOT( triggerRepaint() ) ); // TODO[MD]: works well?
   connect( mEditBuffer, &QgsVectorLayerEditBuffer::featureAdded, this, &QgsVectorLayer::featureAdded );
+  connect( mEditBuffer, &QgsVectorLayerEditBuffer::featureAdded, this, &QgsVectorLayer::onFeatureAddedForSymbolCounts );
   connect( mEditBuffer, &QgsVectorLayerEditBuffer::featureDeleted, this, &QgsVectorLayer::onFeatureDeleted );
   connect( mEditBuffer, &QgsVectorLayerEditBuffer::geometryChanged, this, &QgsVectorLayer::geometryChanged );
+  connect( mEditBuffer, &QgsVectorLayerEditBuffer::geometryChanged, this, &QgsVectorLayer::markSymbolFeatureCountsStale );
   connect( mEditBuffer, &QgsVectorLayerEditBuffer::attributeValueChanged, this, &QgsVectorLayer::attributeValueChanged );
+  connect( mEditBuffer, &QgsVectorLayerEditBuffer::attributeValueChanged, this, &QgsVectorLayer::markSymbolFeatureCountsStale );
   connect( mEditBuffer, &QgsVectorLayerEditBuffer::attributeAdded, this, &QgsVectorLayer::attributeAdded );
   connect( mEditBuffer, &QgsVectorLayerEditBuffer::attributeDeleted, this, &QgsVectorLayer::attributeDeleted );
   connect( mEditBuffer, &QgsVectorLayerEditBuffer::committedAttributesDeleted, this, &QgsVectorLayer::committedAttributesDeleted );
@@ -1401,10 +1460,13 @@ bool QgsVectorLayer::readXml( const QDomNode &layer_node, QgsReadWriteContext &c
     mProviderKey = QStringLiteral( "ogr" );
   }
 
-  QgsDataProvider::ProviderOptions options;
-  if ( !setDataProvider( mProviderKey, options ) )
+  if ( !( mReadFlags & QgsMapLayer::FlagDontResolveLayers ) )
   {
-    QgsDebugMsg( QStringLiteral( "Could not set data provider for layer %1" ).arg( publicSource() ) );
+    QgsDataProvider::ProviderOptions options;
+    if ( !setDataProvider( mProviderKey, options ) )
+    {
+      QgsDebugMsg( QStringLiteral( "Could not set data provider for layer %1" ).arg( publicSource() ) );
+    }
   }
 
   QDomElement pkeyElem = pkeyNode.toElement();
@@ -1464,7 +1526,9 @@ bool QgsVectorLayer::readXml( const QDomNode &layer_node, QgsReadWriteContext &c
     mAuxiliaryLayerKey = asElem.attribute( QStringLiteral( "key" ) );
   }
 
-  return mValid;               // should be true if read successfully
+  // a layer whose provider resolution was deferred is not valid yet, but it
+  // was still read successfully
+  return mValid || mReadFlags & QgsMapLayer::FlagDontResolveLayers;
 
 } // void QgsVectorLayer::readXml
 
@@ -2585,13 +2649,24 @@ bool QgsVectorLayer::changeGeometry( QgsFeatureId fid, QgsGeometry &geom, bool s
   if ( mGeometryOptions->isActive() )
     mGeometryOptions->apply( geom );
 
-  updateExtents();
-
   bool result = mEditBuffer->changeGeometry( fid, geom );
 
   if ( result )
   {
-    updateExtents();
+    if ( canGrowCachedExtent() )
+    {
+      // only the previous geometry can define a boundary of the cached extent, so
+      // growing it by the new bounding box keeps it a valid superset. Refresh the
+      // exact value in the background instead of forcing a full feature scan on
+      // the next extent() call -- vertex edits call this for every node dragged.
+      if ( !geom.isNull() )
+        growCachedExtent( geom.boundingBox() );
+      scheduleExtentRecalculation();
+    }
+    else
+    {
+      updateExtents();
+    }
     if ( !skipDefaultValue && !mDefaultValueOnUpdateFields.isEmpty() )
       updateDefaultValues( fid );
   }
@@ -2686,6 +2761,14 @@ bool QgsVectorLayer::changeAttributeValues( QgsFeatureId fid, const QgsAttribute
   return result;
 }
 
+bool QgsVectorLayer::changeAttributeValues( const QgsChangedAttributesMap &newValues, const QgsChangedAttributesMap &oldValues )
+{
+  if ( !mEditBuffer || !mDataProvider )
+    return false;
+
+  return mEditBuffer->changeAttributeValues( newValues, oldValues );
+}
+
 bool QgsVectorLayer::addAttribute( const QgsField &field )
 {
   if ( !mEditBuffer || !mDataProvider )
@@ -2832,7 +2915,13 @@ bool QgsVectorLayer::deleteFeature( QgsFeatureId fid )
   if ( res )
   {
     mSelectedFeatureIds.remove( fid ); // remove it from selection
-    updateExtents();
+
+    // a deletion can only shrink the extent -- keep the cached superset and
+    // recompute the exact value in the background
+    if ( canGrowCachedExtent() )
+      scheduleExtentRecalculation();
+    else
+      updateExtents();
   }
 
   return res;
@@ -2854,7 +2943,11 @@ bool QgsVectorLayer::deleteFeatures( const QgsFeatureIds &fids )
   if ( res )
   {
     mSelectedFeatureIds.subtract( fids ); // remove it from selection
-    updateExtents();
+
+    if ( canGrowCachedExtent() )
+      scheduleExtentRecalculation();
+    else
+      updateExtents();
   }
 
   return res;
@@ -3071,7 +3164,21 @@ bool QgsVectorLayer::addFeatures( QgsFeatureList &features, Flags )
   }
 
   bool res = mEditBuffer->addFeatures( features );
-  updateExtents();
+
+  if ( canGrowCachedExtent() )
+  {
+    // added features cannot shrink the extent -- grow the cached extent
+    // directly rather than forcing a full recalculation on the next extent() call
+    for ( const QgsFeature &f : qgis::as_const( features ) )
+    {
+      if ( f.hasGeometry() )
+        growCachedExtent( f.geometry().boundingBox() );
+    }
+  }
+  else
+  {
+    updateExtents();
+  }
 
   if ( res && mJoinBuffer->containsJoins() )
     res = mJoinBuffer->addFeatures( features );
@@ -3203,6 +3310,14 @@ bool QgsVectorLayer::isAuxiliaryField( int index, int &srcIndex ) const
   return auxiliaryField;
 }
 
+//! Serialized form of a renderer, used to detect writes which do not change the definition
+static QString _rendererDefinition( QgsFeatureRenderer *renderer )
+{
+  QDomDocument doc;
+  doc.appendChild( renderer->save( doc, QgsReadWriteContext() ) );
+  return doc.toString( 0 );
+}
+
 void QgsVectorLayer::setRenderer( QgsFeatureRenderer *r )
 {
   if ( !isSpatial() )
@@ -3210,10 +3325,27 @@ void QgsVectorLayer::setRenderer( QgsFeatureRenderer *r )
 
   if ( r != mRenderer )
   {
+    // plugins habitually re-apply an identical renderer "to be safe". comparing
+    // the serialized definitions lets those writes through without cascading
+    // cache invalidation and a full redraw on every connected canvas. Ownership
+    // semantics stay unchanged: the passed renderer is still installed, so
+    // callers holding the raw pointer remain valid - only the signals are skipped
+    if ( r && mRenderer && _rendererDefinition( r ) == _rendererDefinition( mRenderer ) )
+    {
+      delete mRenderer;
+      mRenderer = r;
+      // legend keys are part of the definition, so the symbol feature counts
+      // remain valid for the equal replacement
+      return;
+    }
+
     delete mRenderer;
     mRenderer = r;
     mSymbolFeatureCounted = false;
     mSymbolFeatureCountMap.clear();
+    mDeltaCountedFeatureKeys.clear();
+    mSymbolFeatureCountDeltaApplied = false;
+    mSymbolFeatureCountInvalidationPending = false;
 
     emit rendererChanged();
     emit styleChanged();
@@ -3950,6 +4082,9 @@ void QgsVectorLayer::setOpacity( double opacity )
   mLayerOpacity = opacity;
   emit opacityChanged( opacity );
   emit styleChanged();
+  // opacity is applied when compositing the rendered layer image into the map,
+  // so cached renderings of the layer stay valid
+  emit recompositionRequested();
 }
 
 double QgsVectorLayer::opacity() const
@@ -4409,9 +4544,76 @@ QString QgsVectorLayer::htmlMetadata() const
 
 void QgsVectorLayer::invalidateSymbolCountedFlag()
 {
+  // if the modification was an interactive add or delete, it was already folded into the
+  // counts as a delta - as long as no change which may reclassify features (attribute or
+  // geometry change) is pending, the counts are still valid and no background recount is
+  // required
+  if ( mSymbolFeatureCounted && mSymbolFeatureCountDeltaApplied && !mSymbolFeatureCountInvalidationPending )
+  {
+    mSymbolFeatureCountDeltaApplied = false;
+    return;
+  }
+
+  mSymbolFeatureCountDeltaApplied = false;
+  mSymbolFeatureCountInvalidationPending = false;
+  mDeltaCountedFeatureKeys.clear();
   mSymbolFeatureCounted = false;
 }
 
+QSet<QString> QgsVectorLayer::symbolKeysForFeature( const QgsFeature &feature )
+{
+  // mirrors the render set up of QgsVectorLayerFeatureCounter
+  std::unique_ptr< QgsFeatureRenderer > renderer( mRenderer->clone() );
+  QgsRenderContext renderContext;
+  renderContext.setRendererScale( 0 );
+  renderContext.setExpressionContext( createExpressionContext() );
+
+  renderer->startRender( renderContext, fields() );
+  renderContext.expressionContext().setFeature( feature );
+  const QSet<QString> keys = renderer->legendKeysForFeature( feature, renderContext );
+  renderer->stopRender( renderContext );
+  return keys;
+}
+
+void QgsVectorLayer::adjustSymbolFeatureCounts( const QSet<QString> &legendKeys, long delta )
+{
+  for ( const QString &key : legendKeys )
+    mSymbolFeatureCountMap[key] += delta;
+
+  // the modification has been folded into the existing counts
+  mSymbolFeatureCountDeltaApplied = true;
+
+  if ( !legendKeys.isEmpty() )
+    emit symbolFeatureCountMapChanged();
+}
+
+void QgsVectorLayer::onFeatureAddedForSymbolCounts( QgsFeatureId fid )
+{
+  if ( !mSymbolFeatureCounted || !mRenderer )
+    return;
+
+  QgsFeature f;
+  if ( !getFeatures( QgsFeatureRequest( fid ) ).nextFeature( f ) )
+  {
+    mSymbolFeatureCountInvalidationPending = true;
+    return;
+  }
+
+  const QSet<QString> keys = symbolKeysForFeature( f );
+  mDeltaCountedFeatureKeys.insert( fid, keys );
+  adjustSymbolFeatureCounts( keys, 1 );
+}
+
+void QgsVectorLayer::markSymbolFeatureCountsStale()
+{
+  if ( !mSymbolFeatureCounted )
+    return;
+
+  // the change may have moved features between renderer classes, so the counts have to be
+  // rebuilt by the next full count
+  mSymbolFeatureCountInvalidationPending = true;
+}
+
 void QgsVectorLayer::onFeatureCounterCompleted()
 {
   onSymbolsCounted();
@@ -4423,6 +4625,34 @@ void QgsVectorLayer::onFeatureCounterTerminated()
   mFeatureCounter = nullptr;
 }
 
+void QgsVectorLayer::onExtentCalculatorCompleted()
+{
+  QgsVectorLayerExtentCalculator *calculator = mExtentCalculator;
+  mExtentCalculator = nullptr;
+
+  if ( mExtentRecalculationPending )
+  {
+    // the layer was edited while the task ran, so its result is already outdated
+    mExtentRecalculationPending = false;
+    scheduleExtentRecalculation();
+    return;
+  }
+
+  // the cached extent may have been invalidated in the meantime, e.g. by a commit
+  // or rollback -- in that case the next extent() call recomputes it anyway
+  if ( !mValidExtent )
+    return;
+
+  mExtent = calculator->extent();
+  emit recalculateExtents();
+}
+
+void QgsVectorLayer::onExtentCalculatorTerminated()
+{
+  mExtentCalculator = nullptr;
+  mExtentRecalculationPending = false;
+}
+
 void QgsVectorLayer::onJoinedFieldsChanged()
 {
   // some of the fields of joined layers have changed -> we need to update this layer's fields too
@@ -4431,6 +4661,27 @@ void QgsVectorLayer::onJoinedFieldsChanged()
 
 void QgsVectorLayer::onFeatureDeleted( QgsFeatureId fid )
 {
+  if ( mSymbolFeatureCounted && mRenderer )
+  {
+    const auto deltaIt = mDeltaCountedFeatureKeys.constFind( fid );
+    if ( deltaIt != mDeltaCountedFeatureKeys.constEnd() )
+    {
+      // uncommitted added feature - undo the delta applied when it was added
+      adjustSymbolFeatureCounts( deltaIt.value(), -1 );
+      mDeltaCountedFeatureKeys.remove( fid );
+    }
+    else if ( mDataProvider )
+    {
+      // committed feature - still present on the provider until the deletion is committed,
+      // so it can be classified for the count delta
+      QgsFeature f;
+      if ( mDataProvider->getFeatures( QgsFeatureRequest( fid ) ).nextFeature( f ) )
+        adjustSymbolFeatureCounts( symbolKeysForFeature( f ), -1 );
+      else
+        mSymbolFeatureCountInvalidationPending = true;
+    }
+  }
+
   if ( mEditCommandActive )
     mDeletedFids << fid;
   else
@@ -4450,6 +4701,9 @@ void QgsVectorLayer::onSymbolsCounted()
   {
     mSymbolFeatureCountMap = mFeatureCounter->symbolFeatureCountMap();
     mSymbolFeatureCounted = true;
+    mDeltaCountedFeatureKeys.clear();
+    mSymbolFeatureCountDeltaApplied = false;
+    mSymbolFeatureCountInvalidationPending = false;
     emit symbolFeatureCountMapChanged();
   }
 }
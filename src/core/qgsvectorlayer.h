@@ -66,6 +66,7 @@ class QgsSymbol;
 class QgsVectorLayerJoinInfo;
 class QgsVectorLayerEditBuffer;
 class QgsVectorLayerJoinBuffer;
+class QgsVectorLayerExtentCalculator;
 class QgsVectorLayerFeatureCounter;
 class QgsAbstractVectorLayerLabeling;
 class QgsPoint;
@@ -1502,6 +1503,39 @@ class CORE_EXPORT QgsVectorLayer : public QgsMapLayer, public QgsExpressionConte
      */
     bool changeAttributeValues( QgsFeatureId fid, const QgsAttributeMap &newValues, const QgsAttributeMap &oldValues = QgsAttributeMap(), bool skipDefaultValues = false );
 
+    /**
+     * Changes attributes' values for multiple features at once (but does not
+     * immediately commit the changes).
+     *
+     * The new values to be assigned are given by \a newValues, mapping feature
+     * IDs to the attribute changes to apply. Previous values may be passed in
+     * \a oldValues following the same layout; fields without a valid previous
+     * value will have their current value retrieved from the provider during an
+     * undo operation.
+     *
+     * Unlike the per-feature methods, all changes are recorded as a single
+     * entry on the undo stack, so this method should be preferred for bulk
+     * updates such as field calculations over many features.
+     *
+     * Joined fields cannot be changed through this method, and unlike the
+     * per-feature methods no default field values are applied.
+     *
+     * \returns TRUE if the features' attributes were successfully changed.
+     *
+     * \note Calls to changeAttributeValues() are only valid for layers in
+     * which edits have been enabled by a call to startEditing(). Changes made
+     * to features using this method are not committed to the underlying data
+     * provider until a commitChanges() call is made. Any uncommitted changes
+     * can be discarded by calling rollBack().
+     *
+     * \see startEditing()
+     * \see commitChanges()
+     * \see changeAttributeValue()
+     *
+     * \since QGIS 3.8
+     */
+    bool changeAttributeValues( const QgsChangedAttributesMap &newValues, const QgsChangedAttributesMap &oldValues = QgsChangedAttributesMap() );
+
     /**
      * Add an attribute field (but does not commit it)
      * returns TRUE if the field was added
@@ -2397,8 +2431,12 @@ class CORE_EXPORT QgsVectorLayer : public QgsMapLayer, public QgsExpressionConte
 
   private slots:
     void invalidateSymbolCountedFlag();
+    void onFeatureAddedForSymbolCounts( QgsFeatureId fid );
+    void markSymbolFeatureCountsStale();
     void onFeatureCounterCompleted();
     void onFeatureCounterTerminated();
+    void onExtentCalculatorCompleted();
+    void onExtentCalculatorTerminated();
     void onJoinedFieldsChanged();
     void onFeatureDeleted( QgsFeatureId fid );
     void onRelationsLoaded();
@@ -2408,6 +2446,25 @@ class CORE_EXPORT QgsVectorLayer : public QgsMapLayer, public QgsExpressionConte
   private:
     void updateDefaultValues( QgsFeatureId fid, QgsFeature feature = QgsFeature() );
 
+    /**
+     * Returns TRUE if the cached extent can be maintained incrementally, i.e. grown
+     * in place by edits instead of being invalidated and recomputed by a scan.
+     */
+    bool canGrowCachedExtent() const;
+
+    /**
+     * Grows the cached extent in place to cover \a bbox. Must only be called when
+     * canGrowCachedExtent() returns TRUE.
+     */
+    void growCachedExtent( const QgsRectangle &bbox );
+
+    /**
+     * Schedules a background recomputation of the exact layer extent. Used after
+     * edits which may shrink the extent (deletions, geometry changes), where the
+     * cached extent is kept as a valid superset until the exact result is ready.
+     */
+    void scheduleExtentRecalculation();
+
     /**
      * Returns TRUE if the provider is in read-only mode
      */
@@ -2426,6 +2483,15 @@ class CORE_EXPORT QgsVectorLayer : public QgsMapLayer, public QgsExpressionConte
     //! Read simple labeling from layer's custom properties (QGIS 2.x projects)
     QgsAbstractVectorLayerLabeling *readLabelingFromCustomProperties();
 
+    //! Returns the renderer legend keys matching \a feature, using a short lived renderer clone
+    QSet<QString> symbolKeysForFeature( const QgsFeature &feature );
+
+    /**
+     * Folds an interactive add or delete into the existing symbol feature counts, so that
+     * edits keep the counts valid without retriggering a full background recount.
+     */
+    void adjustSymbolFeatureCounts( const QSet<QString> &legendKeys, long delta );
+
 #ifdef SIP_RUN
     QgsVectorLayer( const QgsVectorLayer &rhs );
 #endif
@@ -2547,6 +2613,15 @@ class CORE_EXPORT QgsVectorLayer : public QgsMapLayer, public QgsExpressionConte
     // Feature counts for each renderer legend key
     QHash<QString, long> mSymbolFeatureCountMap;
 
+    //! Legend keys of uncommitted added features counted as deltas, so undoing the add can be folded back into the counts
+    QHash< QgsFeatureId, QSet<QString> > mDeltaCountedFeatureKeys;
+
+    //! True if the last edit buffer modification was already folded into the symbol feature counts
+    bool mSymbolFeatureCountDeltaApplied = false;
+
+    //! True if a modification which may reclassify features (attribute/geometry change) requires a full recount
+    bool mSymbolFeatureCountInvalidationPending = false;
+
     //! True while an undo command is active
     bool mEditCommandActive = false;
 
@@ -2561,6 +2636,11 @@ class CORE_EXPORT QgsVectorLayer : public QgsMapLayer, public QgsExpressionConte
 
     QgsVectorLayerFeatureCounter *mFeatureCounter = nullptr;
 
+    QgsVectorLayerExtentCalculator *mExtentCalculator = nullptr;
+
+    //! True if the layer was edited while the extent calculator task was running
+    bool mExtentRecalculationPending = false;
+
     std::unique_ptr<QgsGeometryOptions> mGeometryOptions;
 
     bool mAllowCommit = true;
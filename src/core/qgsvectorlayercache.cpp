@@ -16,11 +16,53 @@
  ***************************************************************************/
 
 #include "qgsvectorlayercache.h"
+#include "qgsapplication.h"
 #include "qgscacheindex.h"
 #include "qgscachedfeatureiterator.h"
+#include "qgsspatialindex.h"
+#include "qgstaskmanager.h"
 #include "qgsvectorlayerjoininfo.h"
 #include "qgsvectorlayerjoinbuffer.h"
 #include "qgsvectorlayer.h"
+#include "qgsvectorlayerfeatureiterator.h"
+
+///@cond PRIVATE
+
+//! Fetches a set of features from a layer snapshot in the background
+class QgsVectorLayerCachePrefetchTask : public QgsTask
+{
+  public:
+
+    QgsVectorLayerCachePrefetchTask( QgsVectorLayer *layer, const QgsFeatureRequest &request )
+      : QgsTask( tr( "Prefetching features" ), QgsTask::CanCancel )
+      , mSource( new QgsVectorLayerFeatureSource( layer ) )
+      , mRequest( request )
+    {
+    }
+
+    QgsFeatureList features() const { return mFeatures; }
+
+    bool run() override
+    {
+      QgsFeatureIterator it = mSource->getFeatures( mRequest );
+      QgsFeature f;
+      while ( it.nextFeature( f ) )
+      {
+        if ( isCanceled() )
+          return false;
+
+        mFeatures.append( f );
+      }
+      return true;
+    }
+
+  private:
+    std::unique_ptr< QgsVectorLayerFeatureSource > mSource;
+    QgsFeatureRequest mRequest;
+    QgsFeatureList mFeatures;
+};
+
+///@endcond
 
 QgsVectorLayerCache::QgsVectorLayerCache( QgsVectorLayer *layer, int cacheSize, QObject *parent )
   : QObject( parent )
@@ -121,10 +163,42 @@ void QgsVectorLayerCache::setFullCache( bool fullCache )
 
     it.close();
 
+    if ( mCacheSpatialIndex )
+      rebuildSpatialIndex();
+
     emit finished();
   }
 }
 
+void QgsVectorLayerCache::setCacheSpatialIndex( bool cacheSpatialIndex )
+{
+  if ( cacheSpatialIndex == mCacheSpatialIndex )
+    return;
+
+  mCacheSpatialIndex = cacheSpatialIndex;
+  if ( mCacheSpatialIndex && mFullCache && mCacheGeometry )
+    rebuildSpatialIndex();
+  else if ( !mCacheSpatialIndex )
+    mSpatialIndex.reset();
+}
+
+void QgsVectorLayerCache::rebuildSpatialIndex()
+{
+  if ( !mCacheGeometry )
+  {
+    mSpatialIndex.reset();
+    return;
+  }
+
+  mSpatialIndex.reset( new QgsSpatialIndex() );
+  const QList< QgsFeatureId > ids = mCache.keys();
+  for ( QgsFeatureId id : ids )
+  {
+    QgsFeature f( *mCache[ id ]->feature() );
+    mSpatialIndex->addFeature( f );
+  }
+}
+
 void QgsVectorLayerCache::addCacheIndex( QgsAbstractCacheIndex *cacheIndex )
 {
   mCacheIndices.append( cacheIndex );
@@ -171,6 +245,96 @@ bool QgsVectorLayerCache::featureAtId( QgsFeatureId featureId, QgsFeature &featu
   return featureFound;
 }
 
+void QgsVectorLayerCache::prefetchFeatures( const QgsFeatureIds &featureIds )
+{
+  if ( !mLayer || mFullCache )
+    return;
+
+  QgsFeatureIds fidsToFetch;
+  for ( QgsFeatureId id : featureIds )
+  {
+    if ( !mCache.contains( id ) && !mPrefetchingFids.contains( id ) )
+      fidsToFetch.insert( id );
+  }
+
+  if ( fidsToFetch.isEmpty() )
+    return;
+
+  mPrefetchingFids.unite( fidsToFetch );
+
+  QgsFeatureRequest request = QgsFeatureRequest()
+                              .setFilterFids( fidsToFetch )
+                              .setSubsetOfAttributes( mCachedAttributes )
+                              .setFlags( !mCacheGeometry ? QgsFeatureRequest::NoGeometry : QgsFeatureRequest::Flags( nullptr ) );
+
+  const int generation = mPrefetchGeneration;
+  QgsVectorLayerCachePrefetchTask *task = new QgsVectorLayerCachePrefetchTask( mLayer, request );
+  connect( task, &QgsTask::taskCompleted, this, [this, task, fidsToFetch, generation]
+  {
+    mPrefetchingFids.subtract( fidsToFetch );
+
+    // results are stale if the cache was invalidated or features were edited meanwhile
+    if ( generation != mPrefetchGeneration )
+      return;
+
+    const QgsFeatureList features = task->features();
+    for ( QgsFeature f : features )
+    {
+      if ( !mCache.contains( f.id() ) )
+        cacheFeature( f );
+    }
+  } );
+  connect( task, &QgsTask::taskTerminated, this, [this, fidsToFetch]
+  {
+    mPrefetchingFids.subtract( fidsToFetch );
+  } );
+  QgsApplication::taskManager()->addTask( task );
+}
+
+void QgsVectorLayerCache::prefetchArea( const QgsRectangle &extent )
+{
+  if ( !mLayer || mFullCache || !mCacheGeometry || extent.isEmpty() )
+    return;
+
+  // an area recently fetched (or currently being fetched) which covers the
+  // requested extent makes this prefetch redundant
+  for ( const QgsRectangle &area : qgis::as_const( mPrefetchedAreas ) )
+  {
+    if ( area.contains( extent ) )
+      return;
+  }
+
+  mPrefetchedAreas.append( extent );
+  while ( mPrefetchedAreas.size() > 20 )
+    mPrefetchedAreas.removeFirst();
+
+  QgsFeatureRequest request = QgsFeatureRequest()
+                              .setFilterRect( extent )
+                              .setSubsetOfAttributes( mCachedAttributes );
+
+  const int generation = mPrefetchGeneration;
+  QgsVectorLayerCachePrefetchTask *task = new QgsVectorLayerCachePrefetchTask( mLayer, request );
+  connect( task, &QgsTask::taskCompleted, this, [this, task, request, generation]
+  {
+    // results are stale if the cache was invalidated or features were edited meanwhile
+    if ( generation != mPrefetchGeneration )
+      return;
+
+    QgsFeatureIds fids;
+    const QgsFeatureList features = task->features();
+    for ( QgsFeature f : features )
+    {
+      fids.insert( f.id() );
+      if ( !mCache.contains( f.id() ) )
+        cacheFeature( f );
+    }
+    // let the cache indices know the area is fully covered, so later requests
+    // within it can be answered from the cache
+    requestCompleted( request, fids );
+  } );
+  QgsApplication::taskManager()->addTask( task );
+}
+
 bool QgsVectorLayerCache::removeCachedFeature( QgsFeatureId fid )
 {
   return mCache.remove( fid );
@@ -228,6 +392,8 @@ void QgsVectorLayerCache::featureRemoved( QgsFeatureId fid )
 
 void QgsVectorLayerCache::onAttributeValueChanged( QgsFeatureId fid, int field, const QVariant &value )
 {
+  mPrefetchGeneration++; // in-flight prefetch results may carry the old value
+
   QgsCachedFeature *cachedFeat = mCache[ fid ];
 
   if ( cachedFeat )
@@ -262,6 +428,9 @@ void QgsVectorLayerCache::onJoinAttributeValueChanged( QgsFeatureId fid, int fie
 
 void QgsVectorLayerCache::featureDeleted( QgsFeatureId fid )
 {
+  mPrefetchGeneration++; // in-flight prefetch results may still contain the feature
+  if ( mSpatialIndex && mCache.contains( fid ) )
+    mSpatialIndex->deleteFeature( *mCache[ fid ]->feature() );
   mCache.remove( fid );
 }
 
@@ -275,7 +444,8 @@ void QgsVectorLayerCache::onFeatureAdded( QgsFeatureId fid )
     }
 
     QgsFeature feat;
-    featureAtId( fid, feat );
+    if ( featureAtId( fid, feat ) && mSpatialIndex )
+      mSpatialIndex->addFeature( feat );
   }
   emit featureAdded( fid );
 }
@@ -307,7 +477,14 @@ void QgsVectorLayerCache::geometryChanged( QgsFeatureId fid, const QgsGeometry &
 
   if ( cachedFeat )
   {
+    if ( mSpatialIndex )
+      mSpatialIndex->deleteFeature( *cachedFeat->feature() );
     cachedFeat->mFeature->setGeometry( geom );
+    if ( mSpatialIndex )
+    {
+      QgsFeature f( *cachedFeat->feature() );
+      mSpatialIndex->addFeature( f );
+    }
   }
 }
 
@@ -319,8 +496,11 @@ void QgsVectorLayerCache::layerDeleted()
 
 void QgsVectorLayerCache::invalidate()
 {
+  mPrefetchGeneration++;
+  mPrefetchedAreas.clear();
   mCache.clear();
   mFullCache = false;
+  mSpatialIndex.reset();
   emit invalidated();
 }
 
@@ -411,6 +591,16 @@ QgsFeatureIterator QgsVectorLayerCache::getFeatures( const QgsFeatureRequest &fe
     QSet<int> attrs = featureRequest.subsetOfAttributes().toSet() + mCachedAttributes.toSet();
     myRequest.setSubsetOfAttributes( attrs.toList() );
 
+    // interactive tools cluster their spatial requests around the same region,
+    // so a missed rectangle request hints that nearby areas will be asked for
+    // soon - fetch a window around it in the background
+    if ( mAnticipateNearbyRequests && mCacheGeometry && !featureRequest.filterRect().isNull() )
+    {
+      QgsRectangle surroundingArea = featureRequest.filterRect();
+      surroundingArea.scale( 3 );
+      prefetchArea( surroundingArea );
+    }
+
     it = QgsFeatureIterator( new QgsCachedFeatureWriterIterator( this, myRequest ) );
   }
 
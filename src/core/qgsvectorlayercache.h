@@ -26,11 +26,13 @@
 #include "qgsfeatureiterator.h"
 
 #include <QCache>
+#include <memory>
 
 class QgsVectorLayer;
 class QgsFeature;
 class QgsCachedFeatureIterator;
 class QgsAbstractCacheIndex;
+class QgsSpatialIndex;
 
 /**
  * \ingroup core
@@ -162,6 +164,54 @@ class CORE_EXPORT QgsVectorLayerCache : public QObject
      */
     bool hasFullCache() const { return mFullCache; }
 
+    /**
+     * Enables or disables maintaining a spatial index over the cached geometries.
+     *
+     * The index is built once the full cache is populated and is kept up to date as
+     * features are added, deleted or their geometries changed. With the index in place,
+     * rectangle-filtered requests against a full cache only visit candidate features
+     * instead of testing every cached geometry, which matters when many analysis steps
+     * iterate over the same materialized layer.
+     *
+     * The index is only used in combination with setFullCache() and requires geometry
+     * caching to be enabled.
+     *
+     * \see hasCacheSpatialIndex()
+     * \since QGIS 3.8
+     */
+    void setCacheSpatialIndex( bool cacheSpatialIndex );
+
+    /**
+     * Returns TRUE if a spatial index is maintained over the cached geometries.
+     * \see setCacheSpatialIndex()
+     * \since QGIS 3.8
+     */
+    bool hasCacheSpatialIndex() const { return mCacheSpatialIndex; }
+
+    /**
+     * Sets whether rectangle-filtered requests which cannot be answered from the
+     * cache should additionally trigger a background prefetch of the features in
+     * the surrounding area.
+     *
+     * Interactive tools tend to issue clusters of spatial requests around the
+     * same region (repeated identify clicks, small pans), so fetching a window
+     * around each missed request ahead of time lets revisits of the area be
+     * served from the cache instead of a provider round trip. Requires geometry
+     * caching to be enabled.
+     *
+     * \see anticipateNearbyRequests()
+     * \since QGIS 3.8
+     */
+    void setAnticipateNearbyRequests( bool anticipate ) { mAnticipateNearbyRequests = anticipate; }
+
+    /**
+     * Returns TRUE if missed rectangle-filtered requests trigger a background
+     * prefetch of the surrounding area.
+     * \see setAnticipateNearbyRequests()
+     * \since QGIS 3.8
+     */
+    bool anticipateNearbyRequests() const { return mAnticipateNearbyRequests; }
+
     /**
      * \brief
      * Adds a QgsAbstractCacheIndex to this cache. Cache indices know about features present
@@ -242,6 +292,30 @@ class CORE_EXPORT QgsVectorLayerCache : public QObject
      */
     bool featureAtId( QgsFeatureId featureId, QgsFeature &feature, bool skipCache = false );
 
+    /**
+     * Asynchronously fetches the features with the given \a featureIds into the cache.
+     *
+     * The features are retrieved through a background task, so a view backed by this
+     * cache can request the rows it is about to display ahead of time instead of
+     * blocking on a provider round trip per row. Feature ids which are already cached
+     * or already being prefetched are skipped.
+     *
+     * \since QGIS 3.8
+     */
+    void prefetchFeatures( const QgsFeatureIds &featureIds );
+
+    /**
+     * Asynchronously fetches the features intersecting \a extent into the cache.
+     *
+     * The features are retrieved through a background task. Extents contained in
+     * a recently prefetched area are skipped. Does nothing unless geometry
+     * caching is enabled.
+     *
+     * \see prefetchFeatures()
+     * \since QGIS 3.8
+     */
+    void prefetchArea( const QgsRectangle &extent );
+
     /**
      * Removes the feature identified by fid from the cache if present.
      * \param fid The id of the feature to delete
@@ -389,6 +463,9 @@ class CORE_EXPORT QgsVectorLayerCache : public QObject
 
     void connectJoinedLayers() const;
 
+    //! (Re)builds the spatial index from the currently cached features
+    void rebuildSpatialIndex();
+
     inline void cacheFeature( QgsFeature &feat )
     {
       QgsCachedFeature *cachedFeature = new QgsCachedFeature( feat, this );
@@ -400,10 +477,22 @@ class CORE_EXPORT QgsVectorLayerCache : public QObject
 
     bool mCacheGeometry = true;
     bool mFullCache = false;
+    bool mCacheSpatialIndex = false;
+    //! Spatial index over the cached geometries, only present while the full cache is valid
+    std::unique_ptr< QgsSpatialIndex > mSpatialIndex;
     QList<QgsAbstractCacheIndex *> mCacheIndices;
 
     QgsAttributeList mCachedAttributes;
 
+    //! Feature ids currently being fetched by a background prefetch task
+    QgsFeatureIds mPrefetchingFids;
+    //! Incremented whenever cached content becomes stale, so pending prefetch results are discarded
+    int mPrefetchGeneration = 0;
+
+    bool mAnticipateNearbyRequests = false;
+    //! Recently prefetched areas, most recent last, so overlapping prefetches are suppressed
+    QList< QgsRectangle > mPrefetchedAreas;
+
     friend class QgsCachedFeatureIterator;
     friend class QgsCachedFeatureWriterIterator;
     friend class QgsCachedFeature;
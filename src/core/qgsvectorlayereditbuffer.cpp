@@ -139,7 +139,7 @@ bool QgsVectorLayerEditBuffer::addFeatures( QgsFeatureList &features )
     result = result && addFeature( *iter );
   }
 
-  L->updateExtents();
+  // the layer grows its cached extent by the added features itself
   return result;
 }
 
@@ -250,6 +250,54 @@ bool QgsVectorLayerEditBuffer::changeAttributeValue( QgsFeatureId fid, int field
   return true;
 }
 
+bool QgsVectorLayerEditBuffer::changeAttributeValues( const QgsChangedAttributesMap &newValues, const QgsChangedAttributesMap &oldValues )
+{
+  const bool providerSupportsChanges = L->dataProvider()->capabilities() & QgsVectorDataProvider::ChangeAttributeValues;
+
+  QgsChangedAttributesMap validNewValues;
+  QgsChangedAttributesMap validOldValues;
+
+  for ( auto fidIt = newValues.constBegin(); fidIt != newValues.constEnd(); ++fidIt )
+  {
+    const QgsFeatureId fid = fidIt.key();
+    if ( FID_IS_NEW( fid ) )
+    {
+      if ( !mAddedFeatures.contains( fid ) )
+        return false;
+    }
+    else if ( !providerSupportsChanges )
+    {
+      return false;
+    }
+
+    QgsAttributeMap validAttributes;
+    for ( auto fieldIt = fidIt.value().constBegin(); fieldIt != fidIt.value().constEnd(); ++fieldIt )
+    {
+      const int field = fieldIt.key();
+      if ( field < 0 || field >= L->fields().count() ||
+           L->fields().fieldOrigin( field ) == QgsFields::OriginJoin ||
+           L->fields().fieldOrigin( field ) == QgsFields::OriginExpression )
+        return false;
+
+      validAttributes.insert( field, fieldIt.value() );
+    }
+
+    if ( validAttributes.isEmpty() )
+      continue;
+
+    validNewValues.insert( fid, validAttributes );
+    if ( oldValues.contains( fid ) )
+      validOldValues.insert( fid, oldValues.value( fid ) );
+  }
+
+  if ( validNewValues.isEmpty() )
+    return false;
+
+  // all changes are applied and reverted together as a single undo stack entry
+  L->undoStack()->push( new QgsVectorLayerUndoCommandChangeAttributes( this, validNewValues, validOldValues ) );
+  return true;
+}
+
 
 bool QgsVectorLayerEditBuffer::addAttribute( const QgsField &field )
 {
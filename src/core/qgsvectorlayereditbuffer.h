@@ -72,6 +72,18 @@ class CORE_EXPORT QgsVectorLayerEditBuffer : public QObject
      */
     virtual bool changeAttributeValues( QgsFeatureId fid, const QgsAttributeMap &newValues, const QgsAttributeMap &oldValues );
 
+    /**
+     * Changes values of attributes for multiple features at once (but does not commit it).
+     *
+     * Unlike the per-feature overload, all changes are recorded as a single undo
+     * stack entry, which keeps bulk updates such as field calculations cheap to
+     * record and revert.
+     *
+     * \returns TRUE if attributes are well updated, FALSE otherwise
+     * \since QGIS 3.8
+     */
+    virtual bool changeAttributeValues( const QgsChangedAttributesMap &newValues, const QgsChangedAttributesMap &oldValues = QgsChangedAttributesMap() );
+
     /**
      * Add an attribute field (but does not commit it)
         returns true if the field was added
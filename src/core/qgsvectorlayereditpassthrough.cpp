@@ -91,6 +91,16 @@ bool QgsVectorLayerEditPassthrough::changeAttributeValues( QgsFeatureId fid, con
   return modify( new QgsVectorLayerUndoPassthroughCommandChangeAttributes( this, fid, newValues, oldValues ) );
 }
 
+bool QgsVectorLayerEditPassthrough::changeAttributeValues( const QgsChangedAttributesMap &newValues, const QgsChangedAttributesMap &oldValues )
+{
+  // the passthrough buffer already goes straight to the provider, so the bulk
+  // overload just forwards feature by feature
+  bool res = true;
+  for ( auto it = newValues.constBegin(); it != newValues.constEnd(); ++it )
+    res &= changeAttributeValues( it.key(), it.value(), oldValues.value( it.key() ) );
+  return res;
+}
+
 bool QgsVectorLayerEditPassthrough::addAttribute( const QgsField &field )
 {
   return modify( new QgsVectorLayerUndoPassthroughCommandAddAttribute( this, field ) );
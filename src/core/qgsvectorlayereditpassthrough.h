@@ -46,6 +46,13 @@ class CORE_EXPORT QgsVectorLayerEditPassthrough : public QgsVectorLayerEditBuffe
      */
     bool changeAttributeValues( QgsFeatureId fid, const QgsAttributeMap &newValues, const QgsAttributeMap &oldValues ) override;
 
+    /**
+     * Changes values of attributes for multiple features at once (but does not commit it).
+     * \returns TRUE if attributes are well updated, FALSE otherwise
+     * \since QGIS 3.8
+     */
+    bool changeAttributeValues( const QgsChangedAttributesMap &newValues, const QgsChangedAttributesMap &oldValues = QgsChangedAttributesMap() ) override;
+
     bool addAttribute( const QgsField &field ) override;
     bool deleteAttribute( int attr ) override;
     bool renameAttribute( int attr, const QString &newName ) override;
@@ -25,6 +25,7 @@
 #include "qgswkbtypes.h"
 #include "qgsvectorlayerutils.h"
 #include "qgsvectorlayer.h"
+#include "qgsvectorlayertopologyindex.h"
 #include "qgsgeometryoptions.h"
 
 #include <limits>
@@ -635,8 +636,15 @@ int QgsVectorLayerEditUtils::addTopologicalPoints( const QgsPointXY &p )
                            p.x() + threshold, p.y() + threshold );
   double sqrSnappingTolerance = threshold * threshold;
 
+  // resolve the affected features from the layer's persistent topology index
+  // instead of a provider rectangle scan per edit
+  const QgsFeatureIds candidates = QgsVectorLayerTopologyIndex::forLayer( mLayer )->intersects( searchRect );
+  if ( candidates.isEmpty() )
+    return 2;
+
   QgsFeature f;
   QgsFeatureIterator fit = mLayer->getFeatures( QgsFeatureRequest()
+                           .setFilterFids( candidates )
                            .setFilterRect( searchRect )
                            .setFlags( QgsFeatureRequest::ExactIntersect )
                            .setNoAttributes() );
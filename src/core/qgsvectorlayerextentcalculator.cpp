@@ -0,0 +1,48 @@
+/***************************************************************************
+    qgsvectorlayerextentcalculator.cpp
+    ---------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgsvectorlayerextentcalculator.h"
+#include "qgsvectorlayer.h"
+#include "qgsfeaturerequest.h"
+
+QgsVectorLayerExtentCalculator::QgsVectorLayerExtentCalculator( QgsVectorLayer *layer )
+  : QgsTask( tr( "Calculating extent of %1" ).arg( layer->name() ), QgsTask::CanCancel )
+  , mSource( new QgsVectorLayerFeatureSource( layer ) )
+{
+}
+
+bool QgsVectorLayerExtentCalculator::run()
+{
+  mExtent.setMinimal();
+
+  QgsFeatureIterator fit = mSource->getFeatures( QgsFeatureRequest().setNoAttributes() );
+
+  QgsFeature fet;
+  while ( fit.nextFeature( fet ) )
+  {
+    if ( isCanceled() )
+      return false;
+
+    if ( fet.hasGeometry() && fet.geometry().type() != QgsWkbTypes::UnknownGeometry )
+      mExtent.combineExtentWith( fet.geometry().boundingBox() );
+  }
+
+  return true;
+}
+
+QgsRectangle QgsVectorLayerExtentCalculator::extent() const
+{
+  return mExtent;
+}
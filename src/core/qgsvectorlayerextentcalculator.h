@@ -0,0 +1,59 @@
+/***************************************************************************
+    qgsvectorlayerextentcalculator.h
+    ---------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+#ifndef QGSVECTORLAYEREXTENTCALCULATOR_H
+#define QGSVECTORLAYEREXTENTCALCULATOR_H
+
+#include "qgsvectorlayerfeatureiterator.h"
+#include "qgstaskmanager.h"
+
+/**
+ * \ingroup core
+ *
+ * Calculates the exact extent of a QgsVectorLayer in a task.
+ *
+ * While a layer is being edited its cached extent is only ever grown, so
+ * that edits stay cheap on large layers. This task recomputes the exact
+ * extent from a snapshot of the layer (including its edit buffer) without
+ * blocking the main thread; QgsVectorLayer schedules it internally and
+ * applies the result when no further edits have happened in the meantime.
+ *
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsVectorLayerExtentCalculator : public QgsTask
+{
+    Q_OBJECT
+
+  public:
+
+    /**
+     * Create a new extent calculator for \a layer.
+     */
+    QgsVectorLayerExtentCalculator( QgsVectorLayer *layer );
+
+    bool run() override;
+
+    /**
+     * Gets the calculated extent. Only valid after the task has completed.
+     */
+    QgsRectangle extent() const;
+
+  private:
+
+    std::unique_ptr<QgsVectorLayerFeatureSource> mSource;
+    QgsRectangle mExtent;
+
+};
+
+#endif // QGSVECTORLAYEREXTENTCALCULATOR_H
@@ -16,6 +16,12 @@
 #include "qgsvectorlayerfeaturecounter.h"
 #include "qgsvectorlayer.h"
 
+#include <QThread>
+#include <QtConcurrentMap>
+
+//! Minimum number of features before the renderer evaluation is spread over worker threads
+static const int PARALLEL_COUNT_THRESHOLD = 10000;
+
 QgsVectorLayerFeatureCounter::QgsVectorLayerFeatureCounter( QgsVectorLayer *layer, const QgsExpressionContext &context )
   : QgsTask( tr( "Counting features in %1" ).arg( layer->name() ), QgsTask::CanCancel )
   , mSource( new QgsVectorLayerFeatureSource( layer ) )
@@ -53,6 +59,19 @@ bool QgsVectorLayerFeatureCounter::run()
     if ( !mRenderer->filterNeedsGeometry() )
       request.setFlags( QgsFeatureRequest::NoGeometry );
     request.setSubsetOfAttributes( mRenderer->usedAttributes( renderContext ), mSource->fields() );
+
+    const int threadCount = std::max( 1, QThread::idealThreadCount() - 1 );
+    if ( threadCount > 1 && mFeatureCount >= PARALLEL_COUNT_THRESHOLD )
+    {
+      bool res = runParallel( request, threadCount );
+      if ( !res )
+        return false;
+
+      setProgress( 100 );
+      emit symbolsCounted();
+      return true;
+    }
+
     QgsFeatureIterator fit = mSource->getFeatures( request );
 
     // TODO: replace QgsInterruptionChecker with QgsFeedback
@@ -94,6 +113,92 @@ bool QgsVectorLayerFeatureCounter::run()
   return true;
 }
 
+bool QgsVectorLayerFeatureCounter::runParallel( const QgsFeatureRequest &request, int threadCount )
+{
+  // one renderer clone and render context per worker thread -- renderers and
+  // their expressions are not safe to share between threads
+  struct CounterThread
+  {
+    std::unique_ptr< QgsFeatureRenderer > renderer;
+    QgsRenderContext context;
+    QVector< QgsFeature > features;
+    QHash< QString, long > counts;
+  };
+
+  std::vector< CounterThread > threads( threadCount );
+  for ( CounterThread &thread : threads )
+  {
+    thread.renderer.reset( mRenderer->clone() );
+    thread.context.setRendererScale( 0 );
+    thread.context.setExpressionContext( mExpressionContext );
+    thread.renderer->startRender( thread.context, mSource->fields() );
+  }
+
+  // features are fetched sequentially (iterators are not thread safe) and
+  // handed out round-robin; each parallel region evaluates one batch per worker
+  const int featuresPerThread = 1000;
+  QgsFeatureIterator fit = mSource->getFeatures( request );
+
+  bool canceled = false;
+  int featuresCounted = 0;
+  double progress = 0;
+  QgsFeature f;
+  bool hasMore = true;
+  while ( hasMore && !canceled )
+  {
+    for ( CounterThread &thread : threads )
+      thread.features.clear();
+
+    int filled = 0;
+    while ( filled < threadCount * featuresPerThread && ( hasMore = fit.nextFeature( f ) ) )
+    {
+      threads[ filled % threadCount ].features.append( f );
+      ++filled;
+      ++featuresCounted;
+
+      if ( isCanceled() )
+      {
+        canceled = true;
+        break;
+      }
+    }
+
+    if ( filled == 0 )
+      break;
+
+    QtConcurrent::blockingMap( threads, []( CounterThread & thread )
+    {
+      for ( const QgsFeature &feature : qgis::as_const( thread.features ) )
+      {
+        thread.context.expressionContext().setFeature( feature );
+        const QSet<QString> featureKeyList = thread.renderer->legendKeysForFeature( feature, thread.context );
+        for ( const QString &key : featureKeyList )
+        {
+          thread.counts[key] += 1;
+        }
+      }
+    } );
+
+    double p = ( static_cast< double >( featuresCounted ) / mFeatureCount ) * 100;
+    if ( p - progress > 1 )
+    {
+      progress = p;
+      setProgress( progress );
+    }
+  }
+
+  for ( CounterThread &thread : threads )
+  {
+    thread.renderer->stopRender( thread.context );
+    for ( auto countIt = thread.counts.constBegin(); countIt != thread.counts.constEnd(); ++countIt )
+    {
+      mSymbolFeatureCountMap[countIt.key()] += countIt.value();
+    }
+  }
+
+  return !canceled;
+}
+
 QHash<QString, long> QgsVectorLayerFeatureCounter::symbolFeatureCountMap() const
 {
   return mSymbolFeatureCountMap;
@@ -64,6 +64,14 @@ class CORE_EXPORT QgsVectorLayerFeatureCounter : public QgsTask
     void symbolsCounted();
 
   private:
+
+    /**
+     * Scans the features matching \a request with the renderer evaluation spread
+     * over \a threadCount worker threads, merging the per-thread count maps into
+     * mSymbolFeatureCountMap. Returns FALSE if the count was canceled.
+     */
+    bool runParallel( const QgsFeatureRequest &request, int threadCount );
+
     std::unique_ptr<QgsVectorLayerFeatureSource> mSource;
     std::unique_ptr<QgsFeatureRenderer> mRenderer;
     QgsExpressionContext mExpressionContext;
@@ -27,18 +27,22 @@
 #include "qgsmessagelog.h"
 #include "qgsexception.h"
 #include "qgsexpressioncontextutils.h"
+#include "qgstraceprofiler.h"
 
 QgsVectorLayerFeatureSource::QgsVectorLayerFeatureSource( const QgsVectorLayer *layer )
 {
+  // update layer's join caches if necessary. Done before taking the snapshot
+  // lock, as the join buffer serializes cache updates itself and this can be
+  // an expensive operation which would otherwise stall every other snapshot
+  // constructed while the cache fills.
+  if ( layer->mJoinBuffer->containsJoins() )
+    layer->mJoinBuffer->createJoinCaches();
+
   QMutexLocker locker( &layer->mFeatureSourceConstructorMutex );
   mProviderFeatureSource = layer->dataProvider()->featureSource();
   mFields = layer->fields();
   mId = layer->id();
 
-  // update layer's join caches if necessary
-  if ( layer->mJoinBuffer->containsJoins() )
-    layer->mJoinBuffer->createJoinCaches();
-
   mJoinBuffer = layer->mJoinBuffer->clone();
 
   mExpressionFieldBuffer = new QgsExpressionFieldBuffer( *layer->mExpressionFieldBuffer );
@@ -82,6 +86,11 @@ QgsVectorLayerFeatureSource::QgsVectorLayerFeatureSource( const QgsVectorLayer *
 #endif
   }
 
+  locker.unlock();
+
+  // building the layer scope only reads const layer state, and walking the
+  // layer and project variables is one of the slower parts of snapshot
+  // construction -- keep it outside the lock
   std::unique_ptr< QgsExpressionContextScope > layerScope( QgsExpressionContextUtils::layerScope( layer ) );
   mLayerScope = *layerScope;
 }
@@ -222,6 +231,43 @@ QgsVectorLayerFeatureIterator::QgsVectorLayerFeatureIterator( QgsVectorLayerFeat
     }
   }
 
+  if ( !mProviderRequest.orderBy().isEmpty() )
+  {
+    // check whether the requested order is fully determined by provider side values - only
+    // then can the clauses be handed to the provider, which may compile them (e.g. to a
+    // SQL ORDER BY) and stream the features pre-sorted instead of materializing the whole
+    // layer. As soon as uncommitted edits or non provider fields (joins, expression
+    // fields) are involved the provider's order would be incorrect or incomplete, and the
+    // local sort in setupOrderBy() has to run on top of this iterator instead, where edits
+    // and virtual fields are visible.
+    mDelegatedOrderByToProvider = !( mSource->mHasEditBuffer && ( !mSource->mAddedFeatures.isEmpty()
+                                     || !mSource->mChangedAttributeValues.isEmpty()
+                                     || !mSource->mChangedGeometries.isEmpty() ) );
+
+    if ( mDelegatedOrderByToProvider )
+    {
+      const QSet<QString> orderByAttributes = mProviderRequest.orderBy().usedAttributes();
+      for ( const QString &attribute : orderByAttributes )
+      {
+        const int attributeIndex = mSource->mFields.lookupField( attribute );
+        if ( attributeIndex < 0 || mSource->mFields.fieldOrigin( attributeIndex ) != QgsFields::OriginProvider )
+        {
+          mDelegatedOrderByToProvider = false;
+          break;
+        }
+      }
+    }
+
+    if ( !mDelegatedOrderByToProvider )
+    {
+      // the provider cannot produce the requested order - don't ask it to sort, otherwise
+      // a provider side fallback sort would needlessly materialize all features once more.
+      // Any limit must be applied after the local sort, not by the provider.
+      mProviderRequest.setOrderBy( QgsFeatureRequest::OrderBy() );
+      mProviderRequest.setLimit( -1 );
+    }
+  }
+
   if ( mSource->mHasEditBuffer )
   {
     mChangedFeaturesRequest = mProviderRequest;
@@ -288,6 +334,8 @@ QgsVectorLayerFeatureIterator::~QgsVectorLayerFeatureIterator()
 
 bool QgsVectorLayerFeatureIterator::fetchFeature( QgsFeature &f )
 {
+  QGS_TRACE_ZONE( "fetch feature" );
+
   f.setValid( false );
 
   if ( mClosed )
@@ -960,13 +1008,27 @@ void QgsVectorLayerFeatureIterator::FetchJoinInfo::addJoinedAttributesDirect( Qg
     subsetString += '=' + v;
   }
 
+  // the same join value is typically repeated over many target features (e.g. lookup table
+  // style joins), so remember the values fetched during this iteration and avoid issuing
+  // another provider request per feature. The filter expression uniquely encodes the join
+  // value (including its null-ness), so it doubles as the cache key.
+  const QHash<QString, QgsAttributes>::const_iterator cacheIt = mAttributeCache.constFind( subsetString );
+  if ( cacheIt != mAttributeCache.constEnd() )
+  {
+    int index = indexOffset;
+    const QgsAttributes &featureAttributes = cacheIt.value();
+    for ( int i = 0; i < featureAttributes.count(); ++i )
+      f.setAttribute( index++, featureAttributes.at( i ) );
+    return;
+  }
+
   // maybe user requested just a subset of layer's attributes
   // so we do not have to cache everything
-  QVector<int> subsetIndices;
-  if ( joinInfo->hasSubset() )
+  if ( joinInfo->hasSubset() && !mSubsetIndicesResolved )
   {
     const QStringList subsetNames = QgsVectorLayerJoinInfo::joinFieldNamesSubset( *joinInfo );
-    subsetIndices = QgsVectorLayerJoinBuffer::joinSubsetIndices( joinLayer, subsetNames );
+    mSubsetIndices = QgsVectorLayerJoinBuffer::joinSubsetIndices( joinLayer, subsetNames );
+    mSubsetIndicesResolved = true;
   }
 
   // select (no geometry)
@@ -979,31 +1041,40 @@ void QgsVectorLayerFeatureIterator::FetchJoinInfo::addJoinedAttributesDirect( Qg
 
   // get first feature
   QgsFeature fet;
+  QgsAttributes joinedAttributes;
   if ( fi.nextFeature( fet ) )
   {
-    int index = indexOffset;
-    QgsAttributes attr = fet.attributes();
+    const QgsAttributes attr = fet.attributes();
     if ( joinInfo->hasSubset() )
     {
-      for ( int i = 0; i < subsetIndices.count(); ++i )
-        f.setAttribute( index++, attr.at( subsetIndices.at( i ) ) );
+      joinedAttributes.reserve( mSubsetIndices.count() );
+      for ( int i = 0; i < mSubsetIndices.count(); ++i )
+        joinedAttributes.append( attr.at( mSubsetIndices.at( i ) ) );
     }
     else
     {
       // use all fields except for the one used for join (has same value as exiting field in target layer)
+      joinedAttributes.reserve( attr.count() );
       for ( int i = 0; i < attr.count(); ++i )
       {
         if ( i == joinField )
           continue;
 
-        f.setAttribute( index++, attr.at( i ) );
+        joinedAttributes.append( attr.at( i ) );
       }
     }
+
+    int index = indexOffset;
+    for ( int i = 0; i < joinedAttributes.count(); ++i )
+      f.setAttribute( index++, joinedAttributes.at( i ) );
   }
   else
   {
     // no suitable join feature found, keeping empty (null) attributes
   }
+
+  // cache the result (including misses) for following features with the same join value
+  mAttributeCache.insert( subsetString, joinedAttributes );
 }
 
 
@@ -1072,7 +1143,7 @@ void QgsVectorLayerFeatureIterator::updateChangedAttributes( QgsFeature &f )
     for ( QgsAttributeMap::const_iterator it = map.begin(); it != map.end(); ++it )
       attrs[it.key()] = it.value();
   }
-  f.setAttributes( attrs );
+  f.setAttributes( std::move( attrs ) );
 }
 
 void QgsVectorLayerFeatureIterator::updateFeatureGeometry( QgsFeature &f )
@@ -1084,7 +1155,7 @@ void QgsVectorLayerFeatureIterator::updateFeatureGeometry( QgsFeature &f )
 bool QgsVectorLayerFeatureIterator::prepareOrderBy( const QList<QgsFeatureRequest::OrderByClause> &orderBys )
 {
   Q_UNUSED( orderBys );
-  return true;
+  return mDelegatedOrderByToProvider;
 }
 
 
@@ -147,6 +147,23 @@ class CORE_EXPORT QgsVectorLayerFeatureIterator : public QgsAbstractFeatureItera
 
       void addJoinedAttributesCached( QgsFeature &f, const QVariant &joinValue ) const;
       void addJoinedAttributesDirect( QgsFeature &f, const QVariant &joinValue ) const;
+
+    private:
+
+      /**
+       * Joined attributes fetched from the provider so far during this iteration, keyed by
+       * the join filter expression built for the join value. Only the join values actually
+       * referenced by the iterated features are materialized, so repeated values (common for
+       * lookup style joins) do not trigger another provider request each. Misses are cached
+       * too, as empty attribute lists.
+       */
+      mutable QHash< QString, QgsAttributes > mAttributeCache;
+
+      //! Field indexes of the attribute subset requested from the joined layer, resolved on first use
+      mutable QVector<int> mSubsetIndices;
+
+      //! TRUE once mSubsetIndices has been resolved
+      mutable bool mSubsetIndicesResolved = false;
     };
 
 
@@ -267,8 +284,14 @@ class CORE_EXPORT QgsVectorLayerFeatureIterator : public QgsAbstractFeatureItera
     QList< FetchJoinInfo > mOrderedJoinInfoList;
 
     /**
-     * Will always return TRUE. We assume that ordering has been done on provider level already.
-     *
+     * TRUE if the requested order by clauses were handed to the provider request, so the
+     * provider streams the features pre-sorted and no local sort is required.
+     */
+    bool mDelegatedOrderByToProvider = true;
+
+    /**
+     * Returns TRUE if ordering has been delegated to the provider level, FALSE if the
+     * fallback local sort in setupOrderBy() has to run on top of this iterator.
      */
     bool prepareOrderBy( const QList<QgsFeatureRequest::OrderByClause> &orderBys ) override;
 
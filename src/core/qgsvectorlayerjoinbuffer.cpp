@@ -74,11 +74,11 @@ bool QgsVectorLayerJoinBuffer::addJoin( const QgsVectorLayerJoinInfo &joinInfo )
     return false;
   }
 
-  //cache joined layer to virtual memory if specified by user
-  if ( joinInfo.isUsingMemoryCache() )
-  {
-    cacheJoinLayer( mVectorJoins.last() );
-  }
+  // if the user requested a memory cache, the joined layer's hash table is NOT
+  // built here - the join info is left with cacheDirty set and the cache is
+  // created lazily on first access by QgsVectorLayerFeatureSource (which calls
+  // createJoinCaches()). Building it eagerly would scan the joined layer during
+  // project load, before anything has asked for joined attributes.
 
   // Wait for notifications about changed fields in joined layer to propagate them.
   // During project load the joined layers possibly do not exist yet so the connection will not be created,
@@ -136,6 +136,11 @@ void QgsVectorLayerJoinBuffer::cacheJoinLayer( QgsVectorLayerJoinInfo &joinInfo
 
     joinInfo.cachedAttributes.clear();
 
+    // size the hash upfront to avoid repeated rehashing while the cache is built up
+    const long layerFeatureCount = cacheLayer->featureCount();
+    if ( layerFeatureCount > 0 )
+      joinInfo.cachedAttributes.reserve( static_cast< int >( layerFeatureCount ) );
+
     QgsFeatureRequest request;
     request.setFlags( QgsFeatureRequest::NoGeometry );
     // maybe user requested just a subset of layer's attributes
@@ -468,6 +473,9 @@ QgsFeature QgsVectorLayerJoinBuffer::targetedFeatureOf( const QgsVectorLayerJoin
 
 QgsVectorLayerJoinBuffer *QgsVectorLayerJoinBuffer::clone() const
 {
+  // copying the join list must not run concurrently with a cache fill in
+  // createJoinCaches(), which mutates the joins' cached attributes
+  QMutexLocker locker( &mMutex );
   QgsVectorLayerJoinBuffer *cloned = new QgsVectorLayerJoinBuffer( mLayer );
   cloned->mVectorJoins = mVectorJoins;
   return cloned;
@@ -639,18 +647,64 @@ bool QgsVectorLayerJoinBuffer::changeAttributeValue( QgsFeatureId fid, int field
 
 bool QgsVectorLayerJoinBuffer::changeAttributeValues( QgsFeatureId fid, const QgsAttributeMap &newValues, const QgsAttributeMap &oldValues )
 {
+  // group the updates by join, so that each joined feature is located once and
+  // updated through a single bulk call on the join layer -- locating the joined
+  // feature requires a filtered scan of the join layer, which must not be
+  // repeated per field (e.g. moving labels updates X and Y together)
+  QHash< const QgsVectorLayerJoinInfo *, QgsAttributeMap > newValuesByJoin;
+  QHash< const QgsVectorLayerJoinInfo *, QgsAttributeMap > oldValuesByJoin;
+  QHash< const QgsVectorLayerJoinInfo *, QgsAttributeMap > targetValuesByJoin;
+
   bool success = true;
 
   for ( auto it = newValues.constBegin(); it != newValues.constEnd(); ++it )
   {
     const int field = it.key();
-    const QVariant newValue = it.value();
-    QVariant oldValue;
 
+    if ( mLayer->fields().fieldOrigin( field ) != QgsFields::OriginJoin )
+      continue;
+
+    int srcFieldIndex;
+    const QgsVectorLayerJoinInfo *info = joinForFieldIndex( field, mLayer->fields(), srcFieldIndex );
+    if ( !info || !info->joinLayer() || !info->isEditable() )
+    {
+      success = false;
+      continue;
+    }
+
+    newValuesByJoin[info].insert( srcFieldIndex, it.value() );
+    targetValuesByJoin[info].insert( field, it.value() );
     if ( oldValues.contains( field ) )
-      oldValue = oldValues[field];
+      oldValuesByJoin[info].insert( srcFieldIndex, oldValues[field] );
+  }
 
-    success &= changeAttributeValue( fid, field, newValue, oldValue );
+  if ( newValuesByJoin.isEmpty() )
+    return false;
+
+  for ( auto it = newValuesByJoin.constBegin(); it != newValuesByJoin.constEnd(); ++it )
+  {
+    const QgsVectorLayerJoinInfo *info = it.key();
+
+    QgsFeature feature = mLayer->getFeature( fid );
+    if ( !feature.isValid() )
+    {
+      success = false;
+      continue;
+    }
+
+    const QgsFeature joinFeature = joinedFeatureOf( info, feature );
+    if ( joinFeature.isValid() )
+    {
+      success &= info->joinLayer()->changeAttributeValues( joinFeature.id(), it.value(), oldValuesByJoin.value( info ) );
+    }
+    else
+    {
+      const QgsAttributeMap &targetValues = targetValuesByJoin.value( info );
+      for ( auto fieldIt = targetValues.constBegin(); fieldIt != targetValues.constEnd(); ++fieldIt )
+        feature.setAttribute( fieldIt.key(), fieldIt.value() );
+      QgsFeatureList features = QgsFeatureList() << feature;
+      success &= addFeatures( features );
+    }
   }
 
   return success;
@@ -245,7 +245,7 @@ class CORE_EXPORT QgsVectorLayerJoinBuffer : public QObject, public QgsFeatureSi
     void cacheJoinLayer( QgsVectorLayerJoinInfo &joinInfo );
 
     //! Main mutex to protect most data members that can be modified concurrently
-    QMutex mMutex;
+    mutable QMutex mMutex;
 };
 
 #endif // QGSVECTORLAYERJOINBUFFER_H
@@ -22,12 +22,16 @@
 #include "qgspallabeling.h"
 #include "qgsrenderer.h"
 #include "qgsrendercontext.h"
+#include "qgsrenderstagestatistics.h"
 #include "qgssinglesymbolrenderer.h"
 #include "qgssymbollayer.h"
 #include "qgssymbollayerutils.h"
 #include "qgssymbol.h"
 #include "qgsvectorlayer.h"
 #include "qgsvectorlayerdiagramprovider.h"
+#include "qgsmaprenderercache.h"
+#include "qgsreadaheadfeatureiterator.h"
+#include "qgsretainedfeatureiterator.h"
 #include "qgsvectorlayerfeatureiterator.h"
 #include "qgsvectorlayerlabeling.h"
 #include "qgsvectorlayerlabelprovider.h"
@@ -37,8 +41,56 @@
 #include "qgslogger.h"
 #include "qgssettings.h"
 #include "qgsexpressioncontextutils.h"
+#include "qgspoint.h"
+#include "qgstraceprofiler.h"
 
+#include <QBitArray>
+#include <QElapsedTimer>
+#include <QMutex>
 #include <QPicture>
+#include <QThread>
+#include <QtConcurrentMap>
+
+#include <cmath>
+
+//! Upper bound on the number of features retained between render jobs per layer
+const int RETAINED_FEATURE_LIMIT = 100000;
+
+//! Vertices a single layer may contribute to a frame before adaptive simplification coarsens the tolerance
+const qint64 ADAPTIVE_VERTEX_BUDGET = 500000;
+
+/**
+ * Vertex counts observed per layer the first time it was rendered within a
+ * scale bucket, so that later frames at a similar scale can tune the
+ * simplification tolerance without sampling again. Kept for the lifetime of
+ * the process; a layer id / bucket pair occupies a few dozen bytes only.
+ */
+static QHash< QString, qint64 > sVertexDensityStats;
+static QMutex sVertexDensityMutex;
+
+//! Scale buckets are powers of two of the map units per pixel value
+static int _vertexDensityBucket( double mapUnitsPerPixel )
+{
+  return static_cast< int >( std::floor( std::log2( mapUnitsPerPixel ) ) );
+}
+
+static QString _vertexDensityKey( const QString &layerId, int bucket )
+{
+  return layerId + QLatin1Char( '|' ) + QString::number( bucket );
+}
+
+//! Returns the recorded vertex count for a layer and scale bucket, or -1 if never sampled
+static qint64 _recordedVertexCount( const QString &layerId, int bucket )
+{
+  QMutexLocker locker( &sVertexDensityMutex );
+  return sVertexDensityStats.value( _vertexDensityKey( layerId, bucket ), -1 );
+}
+
+static void _recordVertexCount( const QString &layerId, int bucket, qint64 count )
+{
+  QMutexLocker locker( &sVertexDensityMutex );
+  sVertexDensityStats.insert( _vertexDensityKey( layerId, bucket ), count );
+}
 
 
 QgsVectorLayerRenderer::QgsVectorLayerRenderer( QgsVectorLayer *layer, QgsRenderContext &context )
@@ -53,7 +105,7 @@ QgsVectorLayerRenderer::QgsVectorLayerRenderer( QgsVectorLayer *layer, QgsRender
   mSource = new QgsVectorLayerFeatureSource( layer );
 
   mRenderer = layer->renderer() ? layer->renderer()->clone() : nullptr;
-  mSelectedFeatureIds = layer->selectedFeatureIds();
+  mSelectedFeatureIds = QgsPackedFeatureIds( layer->selectedFeatureIds() );
 
   mDrawVertexMarkers = nullptr != layer->editBuffer();
 
@@ -82,6 +134,12 @@ QgsVectorLayerRenderer::QgsVectorLayerRenderer( QgsVectorLayer *layer, QgsRender
 
   mVertexMarkerSize = settings.value( QStringLiteral( "qgis/digitizing/marker_size_mm" ), 2.0 ).toDouble();
 
+  mTiledRendering = settings.value( QStringLiteral( "qgis/parallel_layer_tile_rendering" ), false ).toBool();
+  mAdaptiveSimplify = settings.value( QStringLiteral( "qgis/adaptive_simplification" ), false ).toBool();
+  mDecimatePoints = settings.value( QStringLiteral( "qgis/point_decimation_rendering" ), false ).toBool();
+  mFeatureReadahead = settings.value( QStringLiteral( "qgis/featureReadahead" ), false ).toBool();
+  mFeatureRetention = settings.value( QStringLiteral( "qgis/featureRetentionCache" ), false ).toBool();
+
   if ( !mRenderer )
     return;
 
@@ -115,6 +173,8 @@ QgsFeedback *QgsVectorLayerRenderer::feedback() const
 
 bool QgsVectorLayerRenderer::render()
 {
+  QGS_TRACE_ZONE( "vector layer render" );
+
   if ( mGeometryType == QgsWkbTypes::NullGeometry || mGeometryType == QgsWkbTypes::UnknownGeometry )
     return true;
 
@@ -165,10 +225,43 @@ bool QgsVectorLayerRenderer::render()
     featureRequest.combineFilterExpression( rendererFilter );
   }
 
+  // adaptive simplification: the first frame rendered within a scale bucket
+  // samples the vertex counts actually drawn for the layer, later frames at a
+  // similar scale tune the simplification tolerance so the layer stays within
+  // a fixed per-frame vertex budget. layers over budget are simplified even
+  // when their static settings leave simplification switched off
+  double adaptiveTolFactor = 1.0;
+  if ( mAdaptiveSimplify && mGeometryType != QgsWkbTypes::PointGeometry && mContext.useRenderingOptimization() )
+  {
+    mVertexDensityBucket = _vertexDensityBucket( mContext.mapToPixel().mapUnitsPerPixel() );
+    const qint64 recordedVertices = _recordedVertexCount( layerId(), mVertexDensityBucket );
+    if ( recordedVertices < 0 )
+    {
+      mSampleVertexDensity = true;
+    }
+    else if ( recordedVertices > ADAPTIVE_VERTEX_BUDGET )
+    {
+      // coarsen proportionally to how far over budget the layer is -- halving the
+      // vertex count requires roughly doubling the tolerance for typical line work
+      adaptiveTolFactor = std::min( 10.0, std::sqrt( static_cast< double >( recordedVertices ) / ADAPTIVE_VERTEX_BUDGET ) );
+      if ( !mSimplifyGeometry )
+      {
+        mSimplifyMethod.setSimplifyHints( mSimplifyMethod.simplifyHints() | QgsVectorSimplifyMethod::GeometrySimplification );
+        mSimplifyGeometry = true;
+      }
+      // let providers which can simplify during fetching do so
+      mSimplifyMethod.setForceLocalOptimization( false );
+    }
+  }
+
   // enable the simplification of the geometries (Using the current map2pixel context) before send it to renderer engine.
   if ( mSimplifyGeometry )
   {
-    double map2pixelTol = mSimplifyMethod.threshold();
+    double map2pixelTol = mSimplifyMethod.threshold() * adaptiveTolFactor;
+    // preview quality renders trade fidelity for speed -- simplify well below
+    // what would be acceptable for the final image
+    if ( mContext.testFlag( QgsRenderContext::RenderPreviewJob ) )
+      map2pixelTol *= 4;
     bool validTransform = true;
 
     const QgsMapToPixel &mtp = mContext.mapToPixel();
@@ -240,13 +333,75 @@ bool QgsVectorLayerRenderer::render()
     mContext.setVectorSimplifyMethod( vectorMethod );
   }
 
-  QgsFeatureIterator fit = mSource->getFeatures( featureRequest );
+  if ( mTiledRendering && renderParallelTiles( featureRequest ) )
+  {
+    if ( usingEffect )
+    {
+      mRenderer->paintEffect()->end( mContext );
+    }
+    return true;
+  }
+
+  // request-level dedup: reuse the features fetched by the previous job over an
+  // overlapping extent and only ask the provider for the newly exposed region.
+  // Only possible for plain rectangle requests -- renderer filters and order by
+  // change which features the provider returns
+  QgsRetainedFeatureIterator *retentionIterator = nullptr;
+  if ( mRendererCache && mFeatureRetention
+       && featureRequest.filterType() == QgsFeatureRequest::FilterNone
+       && featureRequest.orderBy().isEmpty()
+       && !requestExtent.isNull() )
+  {
+    QList<QgsFeature> retainedFeatures;
+    QList<QgsRectangle> fetchRects;
+    QgsRectangle retainedExtent;
+    const QList<QgsFeature> cached = mRendererCache->cachedFeatures( layerId(), mContext.mapToPixel().mapUnitsPerPixel(), retainedExtent );
+    if ( !cached.isEmpty() && retainedExtent.intersects( requestExtent ) )
+    {
+      retainedFeatures = cached;
+      // decompose the newly exposed region into up to four rectangles: full
+      // height strips left and right of the retained extent, and top/bottom
+      // strips covering the remaining horizontal band
+      if ( requestExtent.xMinimum() < retainedExtent.xMinimum() )
+        fetchRects << QgsRectangle( requestExtent.xMinimum(), requestExtent.yMinimum(), retainedExtent.xMinimum(), requestExtent.yMaximum() );
+      if ( requestExtent.xMaximum() > retainedExtent.xMaximum() )
+        fetchRects << QgsRectangle( retainedExtent.xMaximum(), requestExtent.yMinimum(), requestExtent.xMaximum(), requestExtent.yMaximum() );
+      const double bandXMin = std::max( requestExtent.xMinimum(), retainedExtent.xMinimum() );
+      const double bandXMax = std::min( requestExtent.xMaximum(), retainedExtent.xMaximum() );
+      if ( requestExtent.yMinimum() < retainedExtent.yMinimum() )
+        fetchRects << QgsRectangle( bandXMin, requestExtent.yMinimum(), bandXMax, retainedExtent.yMinimum() );
+      if ( requestExtent.yMaximum() > retainedExtent.yMaximum() )
+        fetchRects << QgsRectangle( bandXMin, retainedExtent.yMaximum(), bandXMax, requestExtent.yMaximum() );
+    }
+    else
+    {
+      // nothing usable retained -- fetch the full extent, but still collect
+      // the features so the next job can reuse them
+      fetchRects << requestExtent;
+    }
+    retentionIterator = new QgsRetainedFeatureIterator( mSource, featureRequest, retainedFeatures, fetchRects );
+  }
+
+  QgsFeatureIterator fit = retentionIterator
+                           ? QgsFeatureIterator( retentionIterator )
+                           : mSource->getFeatures( featureRequest );
   // Attach an interruption checker so that iterators that have potentially
   // slow fetchFeature() implementations, such as in the WFS provider, can
   // check it, instead of relying on just the mContext.renderingStopped() check
   // in drawRenderer()
   fit.setInterruptionChecker( mInterruptionChecker.get() );
 
+  if ( mFeatureReadahead && !retentionIterator )
+  {
+    // fetch features on a background thread while rendering the previous ones.
+    // The interruption checker must already be attached to the wrapped iterator
+    // at this point, as it cannot be modified once the readahead has started.
+    // Readahead consumes the wrapped iterator from a worker thread, which would
+    // race with reading back the retained feature set, so the two are mutually
+    // exclusive.
+    fit = QgsFeatureIterator( new QgsReadaheadFeatureIterator( fit ) );
+  }
+
   if ( ( mRenderer->capabilities() & QgsFeatureRenderer::SymbolLevels ) && mRenderer->usingSymbolLevels() )
     drawRendererLevels( fit );
   else
@@ -257,6 +412,15 @@ bool QgsVectorLayerRenderer::render()
     mErrors.append( QStringLiteral( "Data source invalid" ) );
   }
 
+  if ( retentionIterator && retentionIterator->fetchComplete() && !mContext.renderingStopped() )
+  {
+    // keep the fetched features for the next job, unless the layer is too big
+    // for retention to be a worthwhile memory trade
+    const QList<QgsFeature> fetched = retentionIterator->fetchedFeatures();
+    if ( fetched.count() <= RETAINED_FEATURE_LIMIT )
+      mRendererCache->setCachedFeatures( mLayer, requestExtent, mContext.mapToPixel().mapUnitsPerPixel(), fetched );
+  }
+
   if ( usingEffect )
   {
     mRenderer->paintEffect()->end( mContext );
@@ -266,14 +430,256 @@ bool QgsVectorLayerRenderer::render()
 }
 
 
+///@cond PRIVATE
+namespace
+{
+  //! Single tile of a parallel intra-layer render pass
+  struct TileRenderJob
+  {
+    //! Tile position in device (pixel) coordinates
+    QRect pixelRect;
+    //! Tile extent in layer coordinates, used as feature request filter rectangle
+    QgsRectangle filterExtent;
+    //! Resulting tile image, null if the tile was not rendered
+    QImage image;
+  };
+}
+///@endcond
+
+bool QgsVectorLayerRenderer::renderParallelTiles( const QgsFeatureRequest &request )
+{
+  QPainter *destPainter = mContext.painter();
+  if ( !destPainter || !destPainter->device() )
+    return false;
+
+  const int width = destPainter->device()->width();
+  const int height = destPainter->device()->height();
+  if ( width <= 0 || height <= 0 )
+    return false;
+
+  // labeling and diagrams require registration of features in a deterministic order,
+  // so fall back to the sequential path whenever a provider is active for this layer
+  if ( mContext.labelingEngine() && ( mLabelProvider || mDiagramProvider ) )
+    return false;
+
+  // symbol level rendering draws in symbol order, not feature order - incompatible with
+  // independent tiles
+  if ( ( mRenderer->capabilities() & QgsFeatureRenderer::SymbolLevels ) && mRenderer->usingSymbolLevels() )
+    return false;
+
+  // per feature blending needs all features composited on a single surface
+  if ( mFeatureBlendMode != QPainter::CompositionMode_SourceOver )
+    return false;
+
+  // only the renderers known to draw each feature independently can be split into
+  // tiles. Renderers which accumulate state across features or in device space
+  // (heatmap, point displacement/cluster, inverted polygons) must take the
+  // sequential path, as must unknown third-party renderer types
+  static const QSet< QString > sTileableRendererTypes
+  {
+    QStringLiteral( "singleSymbol" ),
+    QStringLiteral( "categorizedSymbol" ),
+    QStringLiteral( "graduatedSymbol" ),
+    QStringLiteral( "RuleRenderer" ),
+    QStringLiteral( "nullSymbol" )
+  };
+  if ( !sTileableRendererTypes.contains( mRenderer->type() ) )
+    return false;
+
+  // defensive check for subclasses reusing one of the tileable type strings: a
+  // renderer expanding the request extent is signalling device-space state which
+  // per-tile filter rects would invalidate
+  QgsRectangle probeExtent = mContext.extent();
+  mRenderer->modifyRequestExtent( probeExtent, mContext );
+  if ( probeExtent != mContext.extent() )
+    return false;
+
+  const int threadCount = std::max( 1, QThread::idealThreadCount() );
+  if ( threadCount < 2 )
+    return false;
+
+  // aim for roughly two tiles per available core for load balancing - tiles covering
+  // dense areas take much longer than tiles covering sparse ones
+  const int tileCount = threadCount * 2;
+  const int cols = std::max( 1, static_cast< int >( std::ceil( std::sqrt( static_cast< double >( tileCount ) ) ) ) );
+  const int rows = std::max( 1, ( tileCount + cols - 1 ) / cols );
+
+  const QgsMapToPixel &mtp = mContext.mapToPixel();
+  const QgsCoordinateTransform ct = mContext.coordinateTransform();
+
+  // symbols paint outside the feature geometry (marker sizes, line widths,
+  // offsets), so each tile must also fetch the features lying just outside its
+  // extent whose symbols bleed into it - otherwise symbols get clipped at seams
+  double maxBleedPixels = 0;
+  const QgsSymbolList symbolList = mRenderer->symbols( mContext );
+  for ( QgsSymbol *symbol : symbolList )
+  {
+    maxBleedPixels = std::max( maxBleedPixels, QgsSymbolLayerUtils::estimateMaxSymbolBleed( symbol, mContext ) );
+  }
+  // extra slack for effects and data defined sizes the estimate cannot see
+  maxBleedPixels = maxBleedPixels * 2 + 1;
+
+  QVector< TileRenderJob > jobs;
+  jobs.reserve( cols * rows );
+  for ( int row = 0; row < rows; row++ )
+  {
+    for ( int col = 0; col < cols; col++ )
+    {
+      TileRenderJob job;
+      job.pixelRect = QRect( col * width / cols, row * height / rows,
+                             ( col + 1 ) * width / cols - col * width / cols,
+                             ( row + 1 ) * height / rows - row * height / rows );
+      if ( job.pixelRect.isEmpty() )
+        continue;
+
+      // take the bounding box of the tile corners in map units - this stays valid
+      // when the map is rotated
+      QgsRectangle tileExtent( mtp.toMapCoordinates( job.pixelRect.left(), job.pixelRect.top() ) );
+      tileExtent.combineExtentWith( mtp.toMapCoordinates( job.pixelRect.right() + 1, job.pixelRect.top() ) );
+      tileExtent.combineExtentWith( mtp.toMapCoordinates( job.pixelRect.left(), job.pixelRect.bottom() + 1 ) );
+      tileExtent.combineExtentWith( mtp.toMapCoordinates( job.pixelRect.right() + 1, job.pixelRect.bottom() + 1 ) );
+      tileExtent.grow( maxBleedPixels * mtp.mapUnitsPerPixel() );
+
+      if ( ct.isValid() && !ct.isShortCircuited() )
+      {
+        try
+        {
+          tileExtent = ct.transformBoundingBox( tileExtent, QgsCoordinateTransform::ReverseTransform );
+        }
+        catch ( QgsCsException & )
+        {
+          QgsDebugMsg( QStringLiteral( "Could not transform tile extent to layer CRS, falling back to sequential rendering" ) );
+          return false;
+        }
+      }
+      job.filterExtent = tileExtent;
+      jobs.append( job );
+    }
+  }
+
+  if ( jobs.size() < 2 )
+    return false;
+
+  const auto renderTile = [this, &request]( TileRenderJob & job )
+  {
+    if ( mContext.renderingStopped() )
+      return;
+
+    QImage image( job.pixelRect.size(), QImage::Format_ARGB32_Premultiplied );
+    image.fill( 0 );
+    QPainter painter( &image );
+    painter.setRenderHints( mContext.painter()->renderHints() );
+    // shift the painter so that features crossing tile borders are clipped by the
+    // image bounds at exactly the tile seams
+    painter.translate( -job.pixelRect.topLeft() );
+
+    QgsRenderContext context = mContext;
+    context.setPainter( &painter );
+
+    std::unique_ptr< QgsFeatureRenderer > renderer( mRenderer->clone() );
+    renderer->startRender( context, mFields );
+
+    QgsFeatureRequest tileRequest( request );
+    tileRequest.setFilterRect( job.filterExtent );
+
+    QgsFeatureIterator fit = mSource->getFeatures( tileRequest );
+    fit.setInterruptionChecker( mInterruptionChecker.get() );
+
+    QgsExpressionContextScope *symbolScope = QgsExpressionContextUtils::updateSymbolScope( nullptr, new QgsExpressionContextScope() );
+    context.expressionContext().appendScope( symbolScope );
+
+    QgsFeature fet;
+    while ( fit.nextFeature( fet ) )
+    {
+      if ( mContext.renderingStopped() )
+        break;
+
+      if ( !fet.hasGeometry() || fet.geometry().isEmpty() )
+        continue;
+
+      context.expressionContext().setFeature( fet );
+
+      const bool sel = context.showSelection() && mSelectedFeatureIds.contains( fet.id() );
+      const bool drawMarker = ( mDrawVertexMarkers && context.drawEditingInformation() && ( !mVertexMarkerOnlyForSelection || sel ) );
+
+      try
+      {
+        renderer->renderFeature( fet, context, -1, sel, drawMarker );
+      }
+      catch ( const QgsCsException &cse )
+      {
+        Q_UNUSED( cse );
+        QgsDebugMsg( QStringLiteral( "Failed to transform a point while drawing a feature with ID '%1'. Ignoring this feature. %2" )
+                     .arg( fet.id() ).arg( cse.what() ) );
+      }
+    }
+
+    delete context.expressionContext().popScope();
+    renderer->stopRender( context );
+    painter.end();
+
+    job.image = image;
+  };
+
+  QtConcurrent::blockingMap( jobs, renderTile );
+
+  // tiles cover disjoint pixel rectangles, so composition order does not matter
+  for ( const TileRenderJob &job : qgis::as_const( jobs ) )
+  {
+    if ( !job.image.isNull() && !mContext.renderingStopped() )
+      destPainter->drawImage( job.pixelRect.topLeft(), job.image );
+  }
+
+  stopRenderer( nullptr );
+  return true;
+}
+
 void QgsVectorLayerRenderer::drawRenderer( QgsFeatureIterator &fit )
 {
   QgsExpressionContextScope *symbolScope = QgsExpressionContextUtils::updateSymbolScope( nullptr, new QgsExpressionContextScope() );
   mContext.expressionContext().appendScope( symbolScope );
 
+  // optional density culling: at small scales many identical point symbols land on the
+  // same pixel, and once that pixel has been covered by a symbol of a legend category,
+  // drawing further features of the same category anchored there changes nothing.
+  // Disabled whenever skipping a feature would be observable elsewhere (labeling or
+  // diagrams, editing vertex markers, feature blending).
+  QPainter *painter = mContext.painter();
+  const bool decimate = mDecimatePoints
+                        && mGeometryType == QgsWkbTypes::PointGeometry
+                        && !( mContext.labelingEngine() && ( mLabelProvider || mDiagramProvider ) )
+                        && !mDrawVertexMarkers
+                        && mFeatureBlendMode == QPainter::CompositionMode_SourceOver
+                        && painter && painter->device();
+  const int deviceWidth = decimate ? painter->device()->width() : 0;
+  const int deviceHeight = decimate ? painter->device()->height() : 0;
+  QHash< QString, QBitArray > occupiedPixels;
+  const QgsCoordinateTransform ct = mContext.coordinateTransform();
+
+  // optional per-stage instrumentation: a timestamp is taken at each stage
+  // boundary, so without an attached collector the only cost per feature is a
+  // null pointer check
+  QgsRenderStageStatistics *stageStats = mContext.stageStatistics();
+  QElapsedTimer stageTimer;
+  qint64 stageMarkNs = 0;
+  qint64 fetchNs = 0;
+  qint64 renderNs = 0;
+  qint64 labelingNs = 0;
+  qint64 fetchedFeatures = 0;
+  if ( stageStats )
+    stageTimer.start();
+
   QgsFeature fet;
   while ( fit.nextFeature( fet ) )
   {
+    if ( stageStats )
+    {
+      const qint64 now = stageTimer.nsecsElapsed();
+      fetchNs += now - stageMarkNs;
+      stageMarkNs = now;
+      ++fetchedFeatures;
+    }
+
     try
     {
       if ( mContext.renderingStopped() )
@@ -285,14 +691,84 @@ void QgsVectorLayerRenderer::drawRenderer( QgsFeatureIterator &fit )
       if ( !fet.hasGeometry() || fet.geometry().isEmpty() )
         continue; // skip features without geometry
 
+      if ( mSampleVertexDensity )
+        mRenderedVertexCount += fet.geometry().constGet()->nCoordinates();
+
       mContext.expressionContext().setFeature( fet );
 
       bool sel = mContext.showSelection() && mSelectedFeatureIds.contains( fet.id() );
       bool drawMarker = ( mDrawVertexMarkers && mContext.drawEditingInformation() && ( !mVertexMarkerOnlyForSelection || sel ) );
 
+      if ( decimate && !sel )
+      {
+        const QgsAbstractGeometry *geom = fet.geometry().constGet();
+        if ( geom && QgsWkbTypes::flatType( geom->wkbType() ) == QgsWkbTypes::Point )
+        {
+          const QgsPoint *point = static_cast< const QgsPoint * >( geom );
+          QgsPointXY mapPoint( point->x(), point->y() );
+          bool transformOk = true;
+          if ( ct.isValid() && !ct.isShortCircuited() )
+          {
+            try
+            {
+              mapPoint = ct.transform( mapPoint );
+            }
+            catch ( const QgsCsException & )
+            {
+              transformOk = false;
+            }
+          }
+          if ( transformOk )
+          {
+            double x = mapPoint.x();
+            double y = mapPoint.y();
+            mContext.mapToPixel().transformInPlace( x, y );
+            const int px = static_cast< int >( x );
+            const int py = static_cast< int >( y );
+            if ( px >= 0 && px < deviceWidth && py >= 0 && py < deviceHeight )
+            {
+              const int pixelIndex = py * deviceWidth + px;
+              const QSet< QString > keys = mRenderer->legendKeysForFeature( fet, mContext );
+              // the feature only draws something new if the anchor pixel has not yet
+              // been covered by every one of its legend categories
+              bool covered = !keys.isEmpty();
+              for ( const QString &key : keys )
+              {
+                QBitArray &occupied = occupiedPixels[ key ];
+                if ( occupied.isEmpty() )
+                  occupied.resize( deviceWidth * deviceHeight );
+                if ( !occupied.testBit( pixelIndex ) )
+                {
+                  covered = false;
+                  occupied.setBit( pixelIndex );
+                }
+              }
+              if ( covered )
+                continue;
+            }
+          }
+        }
+      }
+
+      if ( stageStats )
+      {
+        //time spent since the fetch mark covers expression context setup and
+        //density culling -- attribute it to the fetch stage
+        const qint64 now = stageTimer.nsecsElapsed();
+        fetchNs += now - stageMarkNs;
+        stageMarkNs = now;
+      }
+
       // render feature
       bool rendered = mRenderer->renderFeature( fet, mContext, -1, sel, drawMarker );
 
+      if ( stageStats )
+      {
+        const qint64 now = stageTimer.nsecsElapsed();
+        renderNs += now - stageMarkNs;
+        stageMarkNs = now;
+      }
+
       // labeling - register feature
       if ( rendered )
       {
@@ -321,6 +797,13 @@ void QgsVectorLayerRenderer::drawRenderer( QgsFeatureIterator &fit )
             mDiagramProvider->registerFeature( fet, mContext, obstacleGeometry );
           }
         }
+
+        if ( stageStats )
+        {
+          const qint64 now = stageTimer.nsecsElapsed();
+          labelingNs += now - stageMarkNs;
+          stageMarkNs = now;
+        }
       }
     }
     catch ( const QgsCsException &cse )
@@ -331,6 +814,20 @@ void QgsVectorLayerRenderer::drawRenderer( QgsFeatureIterator &fit )
     }
   }
 
+  if ( stageStats )
+  {
+    //the final (unsuccessful) nextFeature() call since the last mark also counts as fetching
+    fetchNs += stageTimer.nsecsElapsed() - stageMarkNs;
+    stageStats->addTime( QgsRenderStageStatistics::FeatureFetch, fetchNs );
+    stageStats->addTime( QgsRenderStageStatistics::SymbolRender, renderNs );
+    stageStats->addTime( QgsRenderStageStatistics::Labeling, labelingNs );
+    stageStats->addFeatureCount( fetchedFeatures );
+  }
+
+  // only complete frames may be recorded -- an interrupted render undercounts
+  if ( mSampleVertexDensity && !mContext.renderingStopped() )
+    _recordVertexCount( layerId(), mVertexDensityBucket, mRenderedVertexCount );
+
   delete mContext.expressionContext().popScope();
 
   stopRenderer( nullptr );
@@ -367,6 +864,9 @@ void QgsVectorLayerRenderer::drawRendererLevels( QgsFeatureIterator &fit )
     if ( !fet.hasGeometry() )
       continue; // skip features without geometry
 
+    if ( mSampleVertexDensity )
+      mRenderedVertexCount += fet.geometry().constGet()->nCoordinates();
+
     mContext.expressionContext().setFeature( fet );
     QgsSymbol *sym = mRenderer->symbolForFeature( fet, mContext );
     if ( !sym )
@@ -409,6 +909,10 @@ void QgsVectorLayerRenderer::drawRendererLevels( QgsFeatureIterator &fit )
 
   delete mContext.expressionContext().popScope();
 
+  // only complete frames may be recorded -- an interrupted render undercounts
+  if ( mSampleVertexDensity && !mContext.renderingStopped() )
+    _recordVertexCount( layerId(), mVertexDensityBucket, mRenderedVertexCount );
+
   if ( features.empty() )
   {
     // nothing to draw
@@ -40,11 +40,13 @@ typedef QList<int> QgsAttributeList;
 #include "qgsvectorsimplifymethod.h"
 #include "qgsfeedback.h"
 #include "qgsfeatureid.h"
+#include "qgspackedfeatureids.h"
 
 #include "qgsmaplayerrenderer.h"
 
 class QgsVectorLayerLabelProvider;
 class QgsVectorLayerDiagramProvider;
+class QgsMapRendererCache;
 
 /**
  * \ingroup core
@@ -80,6 +82,14 @@ class QgsVectorLayerRenderer : public QgsMapLayerRenderer
 
     bool render() override;
 
+    /**
+     * Sets the render \a cache used to retain fetched features between
+     * consecutive render jobs, so that panning only fetches the newly exposed
+     * region from the provider. Ownership is not transferred.
+     * \since QGIS 3.8
+     */
+    void setRendererCache( QgsMapRendererCache *cache ) { mRendererCache = cache; }
+
   private:
 
     /**
@@ -90,6 +100,21 @@ class QgsVectorLayerRenderer : public QgsMapLayerRenderer
     void prepareLabeling( QgsVectorLayer *layer, QSet<QString> &attributeNames );
     void prepareDiagrams( QgsVectorLayer *layer, QSet<QString> &attributeNames );
 
+    /**
+     * Renders the layer by splitting the map into a grid of tiles which are rendered
+     * concurrently on the global thread pool and composited onto the destination painter.
+     *
+     * \param request feature request to use for fetching features, the filter rectangle
+     * will be replaced by the individual tile extents
+     *
+     * Returns FALSE if tiled rendering is not possible for the current context (e.g.
+     * labeling is active, or symbol levels are in use), in which case the caller must
+     * fall back to the sequential rendering path.
+     *
+     * \since QGIS 3.8
+     */
+    bool renderParallelTiles( const QgsFeatureRequest &request );
+
     /**
      * Draw layer with renderer V2. QgsFeatureRenderer::startRender() needs to be called before using this method
      */
@@ -115,7 +140,8 @@ class QgsVectorLayerRenderer : public QgsMapLayerRenderer
 
     QgsFields mFields; // TODO: use fields from mSource
 
-    QgsFeatureIds mSelectedFeatureIds;
+    //! Selected feature ids, packed for fast per-feature membership checks
+    QgsPackedFeatureIds mSelectedFeatureIds;
 
     QgsVectorLayerFeatureSource *mSource = nullptr;
 
@@ -151,6 +177,33 @@ class QgsVectorLayerRenderer : public QgsMapLayerRenderer
 
     QgsVectorSimplifyMethod mSimplifyMethod;
     bool mSimplifyGeometry;
+
+    //! TRUE if the layer may be rendered as a grid of concurrently painted tiles
+    bool mTiledRendering = false;
+
+    //! TRUE if identical point symbols landing on an already occupied pixel may be skipped
+    bool mDecimatePoints = false;
+
+    //! TRUE if the simplification tolerance is automatically tuned from recorded vertex density statistics
+    bool mAdaptiveSimplify = false;
+
+    //! TRUE if this render must sample the layer's vertex density for the current scale bucket
+    bool mSampleVertexDensity = false;
+
+    //! Scale bucket the vertex density statistics of this render belong to
+    int mVertexDensityBucket = 0;
+
+    //! Vertices drawn so far, accumulated while sampling vertex density
+    qint64 mRenderedVertexCount = 0;
+
+    //! TRUE if features should be fetched on a background thread during rendering
+    bool mFeatureReadahead = false;
+
+    //! TRUE if features may be retained between render jobs and reused for overlapping extents
+    bool mFeatureRetention = false;
+
+    //! Render cache holding the features retained from the previous job, may be NULLPTR
+    QgsMapRendererCache *mRendererCache = nullptr;
 };
 
 
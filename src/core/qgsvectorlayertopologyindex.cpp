@@ -0,0 +1,133 @@
+/***************************************************************************
+    qgsvectorlayertopologyindex.cpp
+    -------------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgsvectorlayertopologyindex.h"
+
+#include "qgsfeatureiterator.h"
+#include "qgsfeaturerequest.h"
+#include "qgsvectorlayer.h"
+
+QgsVectorLayerTopologyIndex *QgsVectorLayerTopologyIndex::forLayer( QgsVectorLayer *layer )
+{
+  QgsVectorLayerTopologyIndex *index = layer->findChild< QgsVectorLayerTopologyIndex * >( QString(), Qt::FindDirectChildrenOnly );
+  if ( !index )
+    index = new QgsVectorLayerTopologyIndex( layer );
+  return index;
+}
+
+QgsVectorLayerTopologyIndex::QgsVectorLayerTopologyIndex( QgsVectorLayer *layer )
+  : QObject( layer )
+  , mLayer( layer )
+{
+  connect( layer, &QgsVectorLayer::featureAdded, this, &QgsVectorLayerTopologyIndex::onFeatureAdded );
+  connect( layer, &QgsVectorLayer::featureDeleted, this, &QgsVectorLayerTopologyIndex::onFeatureDeleted );
+  connect( layer, &QgsVectorLayer::geometryChanged, this, &QgsVectorLayerTopologyIndex::onGeometryChanged );
+  // committing reassigns the ids of added features, and external changes are
+  // invisible to the edit signals -- throw the index away in both cases
+  connect( layer, &QgsVectorLayer::editingStopped, this, &QgsVectorLayerTopologyIndex::invalidate );
+  connect( layer, &QgsVectorLayer::dataChanged, this, &QgsVectorLayerTopologyIndex::invalidate );
+}
+
+QgsFeatureIds QgsVectorLayerTopologyIndex::intersects( const QgsRectangle &rectangle )
+{
+  ensureIndexed();
+
+  QgsFeatureIds result;
+  const QList< QgsFeatureId > candidates = mIndex.intersects( rectangle );
+  for ( QgsFeatureId fid : candidates )
+    result << fid;
+  return result;
+}
+
+void QgsVectorLayerTopologyIndex::ensureIndexed()
+{
+  if ( mValid )
+    return;
+
+  mIndex = QgsSpatialIndex();
+  mBounds.clear();
+
+  QgsFeatureIterator fit = mLayer->getFeatures( QgsFeatureRequest().setNoAttributes() );
+  QgsFeature f;
+  while ( fit.nextFeature( f ) )
+  {
+    if ( !f.hasGeometry() )
+      continue;
+
+    const QgsRectangle bounds = f.geometry().boundingBox();
+    mIndex.addFeature( f.id(), bounds );
+    mBounds.insert( f.id(), bounds );
+  }
+
+  mValid = true;
+}
+
+void QgsVectorLayerTopologyIndex::removeEntry( QgsFeatureId fid )
+{
+  const auto it = mBounds.constFind( fid );
+  if ( it == mBounds.constEnd() )
+    return;
+
+  // QgsSpatialIndex identifies the entry to remove by the feature's bounding
+  // box, so a placeholder feature with the stored bounds suffices
+  QgsFeature f( fid );
+  f.setGeometry( QgsGeometry::fromRect( it.value() ) );
+  mIndex.deleteFeature( f );
+  mBounds.remove( fid );
+}
+
+void QgsVectorLayerTopologyIndex::onFeatureAdded( QgsFeatureId fid )
+{
+  if ( !mValid )
+    return;
+
+  const QgsGeometry geom = mLayer->getGeometry( fid );
+  if ( geom.isNull() )
+    return;
+
+  const QgsRectangle bounds = geom.boundingBox();
+  mIndex.addFeature( fid, bounds );
+  mBounds.insert( fid, bounds );
+}
+
+void QgsVectorLayerTopologyIndex::onFeatureDeleted( QgsFeatureId fid )
+{
+  if ( !mValid )
+    return;
+
+  removeEntry( fid );
+}
+
+void QgsVectorLayerTopologyIndex::onGeometryChanged( QgsFeatureId fid, const QgsGeometry &geometry )
+{
+  if ( !mValid )
+    return;
+
+  removeEntry( fid );
+
+  if ( geometry.isNull() )
+    return;
+
+  const QgsRectangle bounds = geometry.boundingBox();
+  mIndex.addFeature( fid, bounds );
+  mBounds.insert( fid, bounds );
+}
+
+void QgsVectorLayerTopologyIndex::invalidate()
+{
+  mValid = false;
+  mIndex = QgsSpatialIndex();
+  mBounds.clear();
+}
@@ -0,0 +1,91 @@
+/***************************************************************************
+    qgsvectorlayertopologyindex.h
+    -----------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef QGSVECTORLAYERTOPOLOGYINDEX_H
+#define QGSVECTORLAYERTOPOLOGYINDEX_H
+
+#define SIP_NO_FILE
+
+#include "qgis_core.h"
+#include "qgsfeatureid.h"
+#include "qgsrectangle.h"
+#include "qgsspatialindex.h"
+
+#include <QHash>
+#include <QObject>
+
+class QgsGeometry;
+class QgsVectorLayer;
+
+/**
+ * \class QgsVectorLayerTopologyIndex
+ * \ingroup core
+ * A persistent spatial index over the feature bounding boxes of a vector
+ * layer, used to resolve the features affected by a topological edit without
+ * issuing a provider scan per edit.
+ *
+ * The index is built lazily on the first query and afterwards maintained
+ * incrementally from the layer's edit signals, so repeated topological
+ * operations (e.g. dragging a shared parcel corner) only pay an in-memory
+ * R-tree lookup. It is discarded whenever the layer reports a data change it
+ * cannot track incrementally, and rebuilt on the next query.
+ *
+ * \note not available in Python bindings
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsVectorLayerTopologyIndex : public QObject
+{
+    Q_OBJECT
+
+  public:
+
+    /**
+     * Returns the topology index for \a layer, creating it on first use. The
+     * index is owned by the layer and lives for the layer's lifetime.
+     */
+    static QgsVectorLayerTopologyIndex *forLayer( QgsVectorLayer *layer );
+
+    /**
+     * Returns the ids of the features whose bounding box intersects
+     * \a rectangle, building the index first if required. Callers must still
+     * perform exact geometry tests on the returned candidates.
+     */
+    QgsFeatureIds intersects( const QgsRectangle &rectangle );
+
+  private slots:
+
+    void onFeatureAdded( QgsFeatureId fid );
+    void onFeatureDeleted( QgsFeatureId fid );
+    void onGeometryChanged( QgsFeatureId fid, const QgsGeometry &geometry );
+
+    //! Discards the index; it is rebuilt on the next query
+    void invalidate();
+
+  private:
+
+    explicit QgsVectorLayerTopologyIndex( QgsVectorLayer *layer );
+
+    void ensureIndexed();
+    void removeEntry( QgsFeatureId fid );
+
+    QgsVectorLayer *mLayer = nullptr;
+    QgsSpatialIndex mIndex;
+    //! Bounding box of every indexed feature, needed to remove entries again
+    QHash< QgsFeatureId, QgsRectangle > mBounds;
+    bool mValid = false;
+
+};
+
+#endif // QGSVECTORLAYERTOPOLOGYINDEX_H
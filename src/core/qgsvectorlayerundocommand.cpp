@@ -105,6 +105,22 @@ void QgsVectorLayerUndoCommandDeleteFeature::redo()
 
 
 
+QgsUndoCompressedGeometry::QgsUndoCompressedGeometry( const QgsGeometry &geometry )
+  : mIsNull( geometry.isNull() )
+{
+  if ( !mIsNull )
+    mCompressedWkb = qCompress( geometry.asWkb() );
+}
+
+QgsGeometry QgsUndoCompressedGeometry::geometry() const
+{
+  QgsGeometry geometry;
+  if ( !mIsNull )
+    geometry.fromWkb( qUncompress( mCompressedWkb ) );
+  return geometry;
+}
+
+
 QgsVectorLayerUndoCommandChangeGeometry::QgsVectorLayerUndoCommandChangeGeometry( QgsVectorLayerEditBuffer *buffer, QgsFeatureId fid, const QgsGeometry &newGeom )
   : QgsVectorLayerUndoCommand( buffer )
   , mFid( fid )
@@ -114,11 +130,11 @@ QgsVectorLayerUndoCommandChangeGeometry::QgsVectorLayerUndoCommandChangeGeometry
   {
     QgsFeatureMap::const_iterator it = mBuffer->mAddedFeatures.constFind( mFid );
     Q_ASSERT( it != mBuffer->mAddedFeatures.constEnd() );
-    mOldGeom = ( it.value().geometry() );
+    mOldGeom = QgsUndoCompressedGeometry( it.value().geometry() );
   }
   else
   {
-    mOldGeom = mBuffer->mChangedGeometries.value( mFid, QgsGeometry() );
+    mOldGeom = QgsUndoCompressedGeometry( mBuffer->mChangedGeometries.value( mFid, QgsGeometry() ) );
   }
 }
 
@@ -140,27 +156,28 @@ bool QgsVectorLayerUndoCommandChangeGeometry::mergeWith( const QUndoCommand *oth
     return false;
 
   mNewGeom = merge->mNewGeom;
-  merge->mNewGeom = QgsGeometry();
+  merge->mNewGeom = QgsUndoCompressedGeometry();
 
   return true;
 }
 
 void QgsVectorLayerUndoCommandChangeGeometry::undo()
 {
+  const QgsGeometry oldGeom = mOldGeom.geometry();
   if ( FID_IS_NEW( mFid ) )
   {
     // modify added features
     QgsFeatureMap::iterator it = mBuffer->mAddedFeatures.find( mFid );
     Q_ASSERT( it != mBuffer->mAddedFeatures.end() );
-    it.value().setGeometry( mOldGeom );
+    it.value().setGeometry( oldGeom );
 
-    emit mBuffer->geometryChanged( mFid, mOldGeom );
+    emit mBuffer->geometryChanged( mFid, oldGeom );
   }
   else
   {
     // existing feature
 
-    if ( mOldGeom.isNull() )
+    if ( oldGeom.isNull() )
     {
       mBuffer->mChangedGeometries.remove( mFid );
 
@@ -172,8 +189,8 @@ void QgsVectorLayerUndoCommandChangeGeometry::undo()
     }
     else
     {
-      mBuffer->mChangedGeometries[mFid] = mOldGeom;
-      emit mBuffer->geometryChanged( mFid, mOldGeom );
+      mBuffer->mChangedGeometries[mFid] = oldGeom;
+      emit mBuffer->geometryChanged( mFid, oldGeom );
     }
   }
 
@@ -181,18 +198,19 @@ void QgsVectorLayerUndoCommandChangeGeometry::undo()
 
 void QgsVectorLayerUndoCommandChangeGeometry::redo()
 {
+  const QgsGeometry newGeom = mNewGeom.geometry();
   if ( FID_IS_NEW( mFid ) )
   {
     // modify added features
     QgsFeatureMap::iterator it = mBuffer->mAddedFeatures.find( mFid );
     Q_ASSERT( it != mBuffer->mAddedFeatures.end() );
-    it.value().setGeometry( mNewGeom );
+    it.value().setGeometry( newGeom );
   }
   else
   {
-    mBuffer->mChangedGeometries[ mFid ] = mNewGeom;
+    mBuffer->mChangedGeometries[ mFid ] = newGeom;
   }
-  emit mBuffer->geometryChanged( mFid, mNewGeom );
+  emit mBuffer->geometryChanged( mFid, newGeom );
 }
 
 
@@ -286,6 +304,118 @@ void QgsVectorLayerUndoCommandChangeAttribute::redo()
 }
 
 
+QgsVectorLayerUndoCommandChangeAttributes::QgsVectorLayerUndoCommandChangeAttributes( QgsVectorLayerEditBuffer *buffer, const QgsChangedAttributesMap &newValues, const QgsChangedAttributesMap &oldValues )
+  : QgsVectorLayerUndoCommand( buffer )
+  , mNewValues( newValues )
+  , mOldValues( oldValues )
+{
+  for ( auto fidIt = mNewValues.constBegin(); fidIt != mNewValues.constEnd(); ++fidIt )
+  {
+    const QgsFeatureId fid = fidIt.key();
+    if ( FID_IS_NEW( fid ) )
+    {
+      // work with added feature
+      QgsFeatureMap::const_iterator addedIt = mBuffer->mAddedFeatures.constFind( fid );
+      Q_ASSERT( addedIt != mBuffer->mAddedFeatures.constEnd() );
+      for ( auto fieldIt = fidIt.value().constBegin(); fieldIt != fidIt.value().constEnd(); ++fieldIt )
+      {
+        const int fieldIndex = fieldIt.key();
+        if ( addedIt.value().attribute( fieldIndex ).isValid() )
+          mOldValues[fid][fieldIndex] = addedIt.value().attribute( fieldIndex );
+        else
+          mFirstChanges[fid].insert( fieldIndex );
+      }
+    }
+    else
+    {
+      for ( auto fieldIt = fidIt.value().constBegin(); fieldIt != fidIt.value().constEnd(); ++fieldIt )
+      {
+        const int fieldIndex = fieldIt.key();
+        if ( mBuffer->mChangedAttributeValues.contains( fid ) && mBuffer->mChangedAttributeValues[fid].contains( fieldIndex ) )
+          mOldValues[fid][fieldIndex] = mBuffer->mChangedAttributeValues[fid][fieldIndex];
+        else
+          mFirstChanges[fid].insert( fieldIndex );
+      }
+    }
+  }
+}
+
+void QgsVectorLayerUndoCommandChangeAttributes::undo()
+{
+  for ( auto fidIt = mNewValues.constBegin(); fidIt != mNewValues.constEnd(); ++fidIt )
+  {
+    const QgsFeatureId fid = fidIt.key();
+    const QSet<int> firstChanges = mFirstChanges.value( fid );
+    for ( auto fieldIt = fidIt.value().constBegin(); fieldIt != fidIt.value().constEnd(); ++fieldIt )
+    {
+      const int fieldIndex = fieldIt.key();
+      const QVariant oldValue = mOldValues.value( fid ).value( fieldIndex );
+      QVariant original = oldValue;
+
+      if ( FID_IS_NEW( fid ) )
+      {
+        // added feature
+        QgsFeatureMap::iterator it = mBuffer->mAddedFeatures.find( fid );
+        Q_ASSERT( it != mBuffer->mAddedFeatures.end() );
+        it.value().setAttribute( fieldIndex, oldValue );
+      }
+      else if ( firstChanges.contains( fieldIndex ) )
+      {
+        // existing feature
+        mBuffer->mChangedAttributeValues[fid].remove( fieldIndex );
+        if ( mBuffer->mChangedAttributeValues[fid].isEmpty() )
+          mBuffer->mChangedAttributeValues.remove( fid );
+
+        if ( !oldValue.isValid() )
+        {
+          // get old value from provider
+          QgsFeature tmp;
+          QgsFeatureRequest request;
+          request.setFilterFid( fid );
+          request.setFlags( QgsFeatureRequest::NoGeometry );
+          request.setSubsetOfAttributes( QgsAttributeList() << fieldIndex );
+          QgsFeatureIterator fi = layer()->getFeatures( request );
+          if ( fi.nextFeature( tmp ) )
+            original = tmp.attribute( fieldIndex );
+        }
+      }
+      else
+      {
+        mBuffer->mChangedAttributeValues[fid][fieldIndex] = oldValue;
+      }
+
+      emit mBuffer->attributeValueChanged( fid, fieldIndex, original );
+    }
+  }
+}
+
+void QgsVectorLayerUndoCommandChangeAttributes::redo()
+{
+  for ( auto fidIt = mNewValues.constBegin(); fidIt != mNewValues.constEnd(); ++fidIt )
+  {
+    const QgsFeatureId fid = fidIt.key();
+    if ( FID_IS_NEW( fid ) )
+    {
+      // updated added feature
+      QgsFeatureMap::iterator it = mBuffer->mAddedFeatures.find( fid );
+      Q_ASSERT( it != mBuffer->mAddedFeatures.end() );
+      for ( auto fieldIt = fidIt.value().constBegin(); fieldIt != fidIt.value().constEnd(); ++fieldIt )
+        it.value().setAttribute( fieldIt.key(), fieldIt.value() );
+    }
+    else
+    {
+      // changed attributes of existing feature
+      QgsAttributeMap &changedValues = mBuffer->mChangedAttributeValues[fid];
+      for ( auto fieldIt = fidIt.value().constBegin(); fieldIt != fidIt.value().constEnd(); ++fieldIt )
+        changedValues.insert( fieldIt.key(), fieldIt.value() );
+    }
+
+    for ( auto fieldIt = fidIt.value().constBegin(); fieldIt != fidIt.value().constEnd(); ++fieldIt )
+      emit mBuffer->attributeValueChanged( fid, fieldIt.key(), fieldIt.value() );
+  }
+}
+
+
 QgsVectorLayerUndoCommandAddAttribute::QgsVectorLayerUndoCommandAddAttribute( QgsVectorLayerEditBuffer *buffer, const QgsField &field )
   : QgsVectorLayerUndoCommand( buffer )
   , mField( field )
@@ -111,6 +111,44 @@ class CORE_EXPORT QgsVectorLayerUndoCommandDeleteFeature : public QgsVectorLayer
     QgsFeature mOldAddedFeature;
 };
 
+#ifndef SIP_RUN
+///@cond PRIVATE
+
+/**
+ * Compact geometry storage for undo commands.
+ *
+ * Geometries held on the undo stack are only needed again when their command
+ * is undone or redone, so they are kept as compressed WKB instead of live
+ * geometry objects. Long edit sessions on large polygons keep two geometry
+ * copies per change on the stack, and the compressed form shrinks that
+ * footprint by an order of magnitude for typical boundary data.
+ *
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsUndoCompressedGeometry
+{
+  public:
+
+    QgsUndoCompressedGeometry() = default;
+
+    //! Stores \a geometry in compressed form
+    explicit QgsUndoCompressedGeometry( const QgsGeometry &geometry );
+
+    //! Returns the stored geometry, decompressing it
+    QgsGeometry geometry() const;
+
+    //! Returns TRUE if a null geometry is stored
+    bool isNull() const { return mIsNull; }
+
+  private:
+
+    QByteArray mCompressedWkb;
+    bool mIsNull = true;
+};
+
+///@endcond
+#endif
+
 /**
  * \ingroup core
  * \class QgsVectorLayerUndoCommandChangeGeometry
@@ -136,8 +174,10 @@ class CORE_EXPORT QgsVectorLayerUndoCommandChangeGeometry : public QgsVectorLaye
 
   private:
     QgsFeatureId mFid;
-    QgsGeometry mOldGeom;
-    mutable QgsGeometry mNewGeom;
+#ifndef SIP_RUN
+    QgsUndoCompressedGeometry mOldGeom;
+    mutable QgsUndoCompressedGeometry mNewGeom;
+#endif
 };
 
 
@@ -171,6 +211,35 @@ class CORE_EXPORT QgsVectorLayerUndoCommandChangeAttribute : public QgsVectorLay
     bool mFirstChange;
 };
 
+/**
+ * \ingroup core
+ * \class QgsVectorLayerUndoCommandChangeAttributes
+ * \brief Undo command for changing attribute values of multiple features in a vector layer,
+ * recorded as a single undo stack entry.
+ * \since QGIS 3.8
+ */
+
+class CORE_EXPORT QgsVectorLayerUndoCommandChangeAttributes : public QgsVectorLayerUndoCommand
+{
+  public:
+
+    /**
+     * Constructor for QgsVectorLayerUndoCommandChangeAttributes
+     * \param buffer associated edit buffer
+     * \param newValues map of feature IDs to attribute changes to apply
+     * \param oldValues map of feature IDs to previous attribute values
+     */
+    QgsVectorLayerUndoCommandChangeAttributes( QgsVectorLayerEditBuffer *buffer SIP_TRANSFER, const QgsChangedAttributesMap &newValues, const QgsChangedAttributesMap &oldValues );
+    void undo() override;
+    void redo() override;
+
+  private:
+    QgsChangedAttributesMap mNewValues;
+    QgsChangedAttributesMap mOldValues;
+    //! Fields changed for the first time within this edit session, per feature
+    QMap< QgsFeatureId, QSet<int> > mFirstChanges;
+};
+
 /**
  * \ingroup core
  * \class QgsVectorLayerUndoCommandAddAttribute
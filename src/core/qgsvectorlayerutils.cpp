@@ -23,6 +23,7 @@
 #include "qgsproject.h"
 #include "qgsrelationmanager.h"
 #include "qgsfeedback.h"
+#include "qgsproxyprogresstask.h"
 #include "qgsvectorlayer.h"
 #include "qgsthreadingutils.h"
 #include "qgsgeometrycollection.h"
@@ -347,6 +348,58 @@ QVariant QgsVectorLayerUtils::createUniqueValueFromCache( const QgsVectorLayer *
 
 bool QgsVectorLayerUtils::validateAttribute( const QgsVectorLayer *layer, const QgsFeature &feature, int attributeIndex, QStringList &errors,
     QgsFieldConstraints::ConstraintStrength strength, QgsFieldConstraints::ConstraintOrigin origin )
+{
+  return validateAttributeInternal( layer, feature, attributeIndex, errors, strength, origin, nullptr );
+}
+
+bool QgsVectorLayerUtils::validateAttributes( const QgsVectorLayer *layer, const QgsFeatureList &features, QStringList &errors,
+    QgsFieldConstraints::ConstraintStrength strength, QgsFieldConstraints::ConstraintOrigin origin )
+{
+  errors.clear();
+
+  if ( !layer )
+    return false;
+
+  const QgsFields fields = layer->fields();
+
+  // fetch the existing values of every field carrying a unique constraint once, instead
+  // of issuing a provider query for each value of each validated feature
+  QMap< int, QSet< QVariant > > uniqueValueCaches;
+  for ( int idx = 0; idx < fields.count(); ++idx )
+  {
+    if ( fields.at( idx ).constraints().constraints() & QgsFieldConstraints::ConstraintUnique )
+      uniqueValueCaches.insert( idx, layer->uniqueValues( idx ) );
+  }
+
+  QgsScopedProxyProgressTask task( QObject::tr( "Validating constraints on %1" ).arg( layer->name() ) );
+
+  bool valid = true;
+  for ( int featureIndex = 0; featureIndex < features.count(); ++featureIndex )
+  {
+    const QgsFeature &feature = features.at( featureIndex );
+    for ( int idx = 0; idx < fields.count(); ++idx )
+    {
+      if ( !( fields.at( idx ).constraints().constraints() ) )
+        continue;
+
+      QStringList featureErrors;
+      const auto cacheIt = uniqueValueCaches.find( idx );
+      if ( !validateAttributeInternal( layer, feature, idx, featureErrors, strength, origin,
+                                       cacheIt != uniqueValueCaches.end() ? &cacheIt.value() : nullptr ) )
+      {
+        valid = false;
+        for ( const QString &error : qgis::as_const( featureErrors ) )
+          errors << QObject::tr( "feature %1, field %2: %3" ).arg( featureIndex ).arg( fields.at( idx ).name(), error );
+      }
+    }
+    task.setProgress( 100.0 * static_cast< double >( featureIndex + 1 ) / features.count() );
+  }
+
+  return valid;
+}
+
+bool QgsVectorLayerUtils::validateAttributeInternal( const QgsVectorLayer *layer, const QgsFeature &feature, int attributeIndex, QStringList &errors,
+    QgsFieldConstraints::ConstraintStrength strength, QgsFieldConstraints::ConstraintOrigin origin, QSet<QVariant> *uniqueValueCache )
 {
   if ( !layer )
     return false;
@@ -424,7 +477,21 @@ bool QgsVectorLayerUtils::validateAttribute( const QgsVectorLayer *layer, const
 
     if ( !exempt )
     {
-      bool alreadyExists = QgsVectorLayerUtils::valueExists( layer, attributeIndex, value, QgsFeatureIds() << feature.id() );
+      bool alreadyExists = false;
+      if ( uniqueValueCache )
+      {
+        // provider-side uniqueness never trips on NULL values, so neither must the cache
+        if ( !value.isNull() )
+        {
+          alreadyExists = uniqueValueCache->contains( value );
+          if ( !alreadyExists )
+            uniqueValueCache->insert( value );
+        }
+      }
+      else
+      {
+        alreadyExists = QgsVectorLayerUtils::valueExists( layer, attributeIndex, value, QgsFeatureIds() << feature.id() );
+      }
       valid = valid && !alreadyExists;
 
       if ( alreadyExists )
@@ -172,6 +172,27 @@ class CORE_EXPORT QgsVectorLayerUtils
                                    QgsFieldConstraints::ConstraintStrength strength = QgsFieldConstraints::ConstraintStrengthNotSet,
                                    QgsFieldConstraints::ConstraintOrigin origin = QgsFieldConstraints::ConstraintOriginNotSet );
 
+    /**
+     * Validates the attribute values of a whole set of \a features against the constraints
+     * present on the layer's fields, in a single batched pass suited to bulk loads.
+     *
+     * Unlike calling validateAttribute() for each feature -- which issues a provider query
+     * for every value of every field carrying a unique constraint -- this fetches the
+     * existing values of each constrained field once and serves all uniqueness checks from
+     * that set. Duplicated values within \a features themselves are reported too. Any
+     * constraint failures are reported in the \a errors argument, prefixed with the
+     * position of the offending feature in the list, and progress is reported through the
+     * application task manager while the validation runs.
+     *
+     * Returns TRUE if all attribute values are valid for their fields.
+     *
+     * \see validateAttribute()
+     * \since QGIS 3.8
+     */
+    static bool validateAttributes( const QgsVectorLayer *layer, const QgsFeatureList &features, QStringList &errors SIP_OUT,
+                                    QgsFieldConstraints::ConstraintStrength strength = QgsFieldConstraints::ConstraintStrengthNotSet,
+                                    QgsFieldConstraints::ConstraintOrigin origin = QgsFieldConstraints::ConstraintOriginNotSet );
+
     /**
      * Creates a new feature ready for insertion into a layer. Default values and constraints
      * (e.g., unique constraints) will automatically be handled. An optional attribute map can be
@@ -283,6 +304,19 @@ class CORE_EXPORT QgsVectorLayerUtils
      */
     static QgsFeatureList makeFeaturesCompatible( const QgsFeatureList &features, const QgsVectorLayer *layer );
 
+  private:
+
+    /**
+     * Implementation of attribute validation shared by validateAttribute() and
+     * validateAttributes(). When \a uniqueValueCache is not NULLPTR, uniqueness checks
+     * are served from the cached value set -- with each checked value added to the set,
+     * so that duplicates within a validated batch collide -- instead of querying the
+     * provider per value.
+     */
+    static bool validateAttributeInternal( const QgsVectorLayer *layer, const QgsFeature &feature, int attributeIndex, QStringList &errors,
+                                           QgsFieldConstraints::ConstraintStrength strength, QgsFieldConstraints::ConstraintOrigin origin,
+                                           QSet<QVariant> *uniqueValueCache );
+
 };
 
 
@@ -134,6 +134,16 @@ QgsRasterBlock *QgsBrightnessContrastFilter::block( int bandNo, QgsRectangle  co
   }
 
   // adjust image
+  // the input is a rendered image (see setInput()), so the ARGB data can be
+  // accessed directly instead of going through the per-pixel color() accessor
+  const QRgb *inputBits = inputBlock->colorData();
+  QRgb *outputBits = outputBlock->colorData();
+  if ( !inputBits || !outputBits )
+  {
+    QgsDebugMsg( QStringLiteral( "Input raster is not a rendered image" ) );
+    return outputBlock.release();
+  }
+
   QRgb myNoDataColor = qRgba( 0, 0, 0, 0 );
   QRgb myColor;
 
@@ -142,20 +152,20 @@ QgsRasterBlock *QgsBrightnessContrastFilter::block( int bandNo, QgsRectangle  co
 
   for ( qgssize i = 0; i < ( qgssize )width * height; i++ )
   {
-    if ( inputBlock->color( i ) == myNoDataColor )
+    myColor = inputBits[i];
+    if ( myColor == myNoDataColor )
     {
-      outputBlock->setColor( i, myNoDataColor );
+      outputBits[i] = myNoDataColor;
       continue;
     }
 
-    myColor = inputBlock->color( i );
     alpha = qAlpha( myColor );
 
     r = adjustColorComponent( qRed( myColor ), alpha, mBrightness, f );
     g = adjustColorComponent( qGreen( myColor ), alpha, mBrightness, f );
     b = adjustColorComponent( qBlue( myColor ), alpha, mBrightness, f );
 
-    outputBlock->setColor( i, qRgba( r, g, b, alpha ) );
+    outputBits[i] = qRgba( r, g, b, alpha );
   }
 
   return outputBlock.release();
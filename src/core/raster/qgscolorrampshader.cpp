@@ -49,6 +49,7 @@ QgsColorRampShader::QgsColorRampShader( const QgsColorRampShader &other )
   , mLUTOffset( other.mLUTOffset )
   , mLUTFactor( other.mLUTFactor )
   , mLUTInitialized( other.mLUTInitialized )
+  , mColorCache( other.mColorCache )
   , mClip( other.mClip )
 {
   if ( other.sourceColorRamp() )
@@ -69,6 +70,7 @@ QgsColorRampShader &QgsColorRampShader::operator=( const QgsColorRampShader &oth
   mLUTOffset = other.mLUTOffset;
   mLUTFactor = other.mLUTFactor;
   mLUTInitialized = other.mLUTInitialized;
+  mColorCache = other.mColorCache;
   mClip = other.mClip;
   mColorRampItemList = other.mColorRampItemList;
   return *this;
@@ -94,6 +96,7 @@ void QgsColorRampShader::setColorRampItemList( const QList<QgsColorRampShader::C
   // Reset the look up table when the color ramp is changed
   mLUTInitialized = false;
   mLUT.clear();
+  mColorCache.clear();
 }
 
 void QgsColorRampShader::setColorRampType( QgsColorRampShader::Type colorRampType )
@@ -316,50 +319,54 @@ void QgsColorRampShader::classifyColorRamp( const int band, const QgsRectangle &
   classifyColorRamp( colorRampItemList().count(), band, extent, input );
 }
 
-bool QgsColorRampShader::shade( double value, int *returnRedValue, int *returnGreenValue, int *returnBlueValue, int *returnAlphaValue ) const
+void QgsColorRampShader::initializeLUT() const
 {
-  if ( mColorRampItemList.isEmpty() )
-  {
-    return false;
-  }
-  if ( std::isnan( value ) || std::isinf( value ) )
-    return false;
-
   int colorRampItemListCount = mColorRampItemList.count();
   const QgsColorRampShader::ColorRampItem *colorRampItems = mColorRampItemList.constData();
-  int idx;
-  if ( !mLUTInitialized )
+
+  // calculate LUT for faster index recovery
+  mLUTFactor = 1.0;
+  double minimumValue = colorRampItems[0].value;
+  mLUTOffset = minimumValue + DOUBLE_DIFF_THRESHOLD;
+  // Only make lut if at least 3 items, with 2 items the low and high cases handle both
+  if ( colorRampItemListCount >= 3 )
   {
-    // calculate LUT for faster index recovery
-    mLUTFactor = 1.0;
-    double minimumValue = colorRampItems[0].value;
-    mLUTOffset = minimumValue + DOUBLE_DIFF_THRESHOLD;
-    // Only make lut if at least 3 items, with 2 items the low and high cases handle both
-    if ( colorRampItemListCount >= 3 )
+    double rangeValue = colorRampItems[colorRampItemListCount - 2].value - minimumValue;
+    if ( rangeValue > 0 )
     {
-      double rangeValue = colorRampItems[colorRampItemListCount - 2].value - minimumValue;
-      if ( rangeValue > 0 )
+      int lutSize = 256; // TODO: test if speed can be increased with a different LUT size
+      mLUTFactor = ( lutSize - 0.0000001 ) / rangeValue; // decrease slightly to make sure last LUT category is correct
+      int idx = 0;
+      double val;
+      mLUT.reserve( lutSize );
+      for ( int i = 0; i < lutSize; i++ )
       {
-        int lutSize = 256; // TODO: test if speed can be increased with a different LUT size
-        mLUTFactor = ( lutSize - 0.0000001 ) / rangeValue; // decrease slightly to make sure last LUT category is correct
-        idx = 0;
-        double val;
-        mLUT.reserve( lutSize );
-        for ( int i = 0; i < lutSize; i++ )
+        val = ( i / mLUTFactor ) + mLUTOffset;
+        while ( idx < colorRampItemListCount
+                && colorRampItems[idx].value - DOUBLE_DIFF_THRESHOLD < val )
         {
-          val = ( i / mLUTFactor ) + mLUTOffset;
-          while ( idx < colorRampItemListCount
-                  && colorRampItems[idx].value - DOUBLE_DIFF_THRESHOLD < val )
-          {
-            idx++;
-          }
-          mLUT.push_back( idx );
+          idx++;
         }
+        mLUT.push_back( idx );
       }
     }
-    mLUTInitialized = true;
   }
 
+  // cache the item colors as QRgb - QColor accessors are too heavy to call per pixel
+  mColorCache.clear();
+  mColorCache.reserve( colorRampItemListCount );
+  for ( int i = 0; i < colorRampItemListCount; ++i )
+    mColorCache.push_back( colorRampItems[i].color.rgba() );
+
+  mLUTInitialized = true;
+}
+
+bool QgsColorRampShader::shadeValue( double value, QRgb &result ) const
+{
+  int colorRampItemListCount = mColorRampItemList.count();
+  const QgsColorRampShader::ColorRampItem *colorRampItems = mColorRampItemList.constData();
+  int idx;
+
   // overflow indicates that value > maximum value + DOUBLE_DIFF_THRESHOLD
   // that way idx can point to the last valid item
   bool overflow = false;
@@ -412,10 +419,7 @@ bool QgsColorRampShader::shade( double value, int *returnRedValue, int *returnGr
       {
         return false;
       }
-      *returnRedValue   = currentColorRampItem.color.red();
-      *returnGreenValue = currentColorRampItem.color.green();
-      *returnBlueValue  = currentColorRampItem.color.blue();
-      *returnAlphaValue = currentColorRampItem.color.alpha();
+      result = mColorCache.at( idx );
       return true;
     }
 
@@ -424,13 +428,13 @@ bool QgsColorRampShader::shade( double value, int *returnRedValue, int *returnGr
     float currentRampRange = currentColorRampItem.value - previousColorRampItem.value;
     float offsetInRange = value - previousColorRampItem.value;
     float scale = offsetInRange / currentRampRange;
-    const QRgb c1 = previousColorRampItem.color.rgba();
-    const QRgb c2 = currentColorRampItem.color.rgba();
+    const QRgb c1 = mColorCache.at( idx - 1 );
+    const QRgb c2 = mColorCache.at( idx );
 
-    *returnRedValue   = qRed( c1 )   + static_cast< int >( ( qRed( c2 )   - qRed( c1 ) )   * scale );
-    *returnGreenValue = qGreen( c1 ) + static_cast< int >( ( qGreen( c2 ) - qGreen( c1 ) ) * scale );
-    *returnBlueValue  = qBlue( c1 )  + static_cast< int >( ( qBlue( c2 )  - qBlue( c1 ) )  * scale );
-    *returnAlphaValue = qAlpha( c1 ) + static_cast< int >( ( qAlpha( c2 ) - qAlpha( c1 ) ) * scale );
+    result = qRgba( qRed( c1 )   + static_cast< int >( ( qRed( c2 )   - qRed( c1 ) )   * scale ),
+                    qGreen( c1 ) + static_cast< int >( ( qGreen( c2 ) - qGreen( c1 ) ) * scale ),
+                    qBlue( c1 )  + static_cast< int >( ( qBlue( c2 )  - qBlue( c1 ) )  * scale ),
+                    qAlpha( c1 ) + static_cast< int >( ( qAlpha( c2 ) - qAlpha( c1 ) ) * scale ) );
     return true;
   }
   else if ( colorRampType() == Discrete )
@@ -442,10 +446,7 @@ bool QgsColorRampShader::shade( double value, int *returnRedValue, int *returnGr
     {
       return false;
     }
-    *returnRedValue   = currentColorRampItem.color.red();
-    *returnGreenValue = currentColorRampItem.color.green();
-    *returnBlueValue  = currentColorRampItem.color.blue();
-    *returnAlphaValue = currentColorRampItem.color.alpha();
+    result = mColorCache.at( idx );
     return true;
   }
   else // EXACT
@@ -453,10 +454,7 @@ bool QgsColorRampShader::shade( double value, int *returnRedValue, int *returnGr
     // Assign the color of the exact matching value in the color ramp item list
     if ( !overflow && currentColorRampItem.value - DOUBLE_DIFF_THRESHOLD <= value )
     {
-      *returnRedValue   = currentColorRampItem.color.red();
-      *returnGreenValue = currentColorRampItem.color.green();
-      *returnBlueValue  = currentColorRampItem.color.blue();
-      *returnAlphaValue = currentColorRampItem.color.alpha();
+      result = mColorCache.at( idx );
       return true;
     }
     else
@@ -466,6 +464,58 @@ bool QgsColorRampShader::shade( double value, int *returnRedValue, int *returnGr
   }
 }
 
+bool QgsColorRampShader::shade( double value, int *returnRedValue, int *returnGreenValue, int *returnBlueValue, int *returnAlphaValue ) const
+{
+  if ( mColorRampItemList.isEmpty() )
+  {
+    return false;
+  }
+  if ( std::isnan( value ) || std::isinf( value ) )
+    return false;
+
+  if ( !mLUTInitialized )
+    initializeLUT();
+
+  QRgb rgb = 0;
+  if ( !shadeValue( value, rgb ) )
+    return false;
+
+  *returnRedValue   = qRed( rgb );
+  *returnGreenValue = qGreen( rgb );
+  *returnBlueValue  = qBlue( rgb );
+  *returnAlphaValue = qAlpha( rgb );
+  return true;
+}
+
+void QgsColorRampShader::shadeBlock( const QgsRasterBlock *input, QRgb *colors, QRgb defaultColor ) const
+{
+  const qgssize count = static_cast< qgssize >( input->width() ) * input->height();
+
+  if ( mColorRampItemList.isEmpty() )
+  {
+    for ( qgssize i = 0; i < count; i++ )
+      colors[i] = defaultColor;
+    return;
+  }
+
+  if ( !mLUTInitialized )
+    initializeLUT();
+
+  bool isNoData = false;
+  for ( qgssize i = 0; i < count; i++ )
+  {
+    const double value = input->valueAndNoData( i, isNoData );
+    QRgb rgb = 0;
+    if ( isNoData || std::isnan( value ) || std::isinf( value ) || !shadeValue( value, rgb ) )
+    {
+      colors[i] = defaultColor;
+      continue;
+    }
+    // output blocks hold premultiplied colors
+    colors[i] = qPremultiply( rgb );
+  }
+}
+
 bool QgsColorRampShader::shade( double redValue, double greenValue,
                                 double blueValue, double alphaValue,
                                 int *returnRedValue, int *returnGreenValue,
@@ -23,8 +23,31 @@
 #include "qgsrasterblock.h"
 #include "qgsrectangle.h"
 #include "qgsmessagelog.h"
+
+#include <QCache>
+#include <QMutex>
+
+#include <limits>
 #include <memory>
 
+///@cond PRIVATE
+
+//! The dz/dx, dz/dy gradient field of one block, NaN marks nodata pixels
+struct QgsHillshadeGradientField
+{
+  QVector<float> derX;
+  QVector<float> derY;
+};
+
+///@endcond
+
+// The gradient field only depends on the input data, not on the sun
+// parameters, so it is cached across render jobs -- interactively dragging
+// the azimuth/altitude sliders only re-evaluates the cheap shading formula.
+// Cost is in KiB.
+static QCache<QString, QgsHillshadeGradientField> sGradientFieldCache( 32 * 1024 );
+static QMutex sGradientFieldCacheMutex;
+
 #ifdef HAVE_OPENCL
 #ifdef QGISDEBUG
 #include <chrono>
@@ -370,154 +393,206 @@ QgsRasterBlock *QgsHillshadeRenderer::block( int bandNo, const QgsRectangle &ext
 
 #endif
 
-    for ( qgssize i = 0; i < static_cast<qgssize>( height ); i++ )
-    {
+    // Stage 1: compute (or fetch from the cache) the dz/dx, dz/dy gradient
+    // field. This is the expensive part -- nine neighbor reads per pixel --
+    // and it does not depend on the sun parameters, so it is reused when only
+    // the azimuth/altitude changed between jobs.
+    const QString gradientKey = QStringLiteral( "%1:%2:%3:%4:%5" )
+                                .arg( mBand ).arg( extent.toString() ).arg( width ).arg( height )
+                                .arg( qHash( inputBlock->data() ) );
 
-      for ( qgssize j = 0; j < static_cast<qgssize>( width ); j++ )
+    std::unique_ptr< QgsHillshadeGradientField > field;
+    {
+      QMutexLocker locker( &sGradientFieldCacheMutex );
+      if ( QgsHillshadeGradientField *cached = sGradientFieldCache.object( gradientKey ) )
       {
+        // take a copy -- the cached entry may be evicted by a concurrent job
+        field.reset( new QgsHillshadeGradientField( *cached ) );
+      }
+    }
 
-        if ( inputBlock->isNoData( i,  j ) )
-        {
-          outputBlock->setColor( static_cast<int>( i ), static_cast<int>( j ), defaultNodataColor );
-          continue;
-        }
-
-        qgssize iUp, iDown, jLeft, jRight;
-        if ( i == 0 )
-        {
-          iUp = i;
-          iDown = i + 1;
-        }
-        else if ( i < static_cast<qgssize>( height ) - 1 )
-        {
-          iUp = i - 1;
-          iDown = i + 1;
-        }
-        else
-        {
-          iUp = i - 1;
-          iDown = i;
-        }
-
-        if ( j == 0 )
-        {
-          jLeft = j;
-          jRight = j + 1;
-        }
-        else if ( j <  static_cast<qgssize>( width ) - 1 )
-        {
-          jLeft = j - 1;
-          jRight = j + 1;
-        }
-        else
+    if ( !field )
+    {
+      field.reset( new QgsHillshadeGradientField() );
+      field->derX.resize( width * height );
+      field->derY.resize( width * height );
+      float *derXData = field->derX.data();
+      float *derYData = field->derY.data();
+      const float noDataMarker = std::numeric_limits<float>::quiet_NaN();
+
+      for ( qgssize i = 0; i < static_cast<qgssize>( height ); i++ )
+      {
+        for ( qgssize j = 0; j < static_cast<qgssize>( width ); j++ )
         {
-          jLeft = j - 1;
-          jRight = j;
-        }
-
-        double x11;
-        double x21;
-        double x31;
-        double x12;
-        double x22; // Working cell
-        double x32;
-        double x13;
-        double x23;
-        double x33;
-
-        // This is center cell. It is not nodata. Use this in place of nodata neighbors
-        x22 = inputBlock->value( i, j );
-
-        x11 = inputBlock->isNoData( iUp, jLeft )  ? x22 : inputBlock->value( iUp, jLeft );
-        x21 = inputBlock->isNoData( i, jLeft )     ? x22 : inputBlock->value( i, jLeft );
-        x31 = inputBlock->isNoData( iDown, jLeft ) ? x22 : inputBlock->value( iDown, jLeft );
-
-        x12 = inputBlock->isNoData( iUp, j )       ? x22 : inputBlock->value( iUp, j );
-        // x22
-        x32 = inputBlock->isNoData( iDown, j )     ? x22 : inputBlock->value( iDown, j );
+          const qgssize index = i * static_cast<qgssize>( width ) + j;
 
-        x13 = inputBlock->isNoData( iUp, jRight )   ? x22 : inputBlock->value( iUp, jRight );
-        x23 = inputBlock->isNoData( i, jRight )     ? x22 : inputBlock->value( i, jRight );
-        x33 = inputBlock->isNoData( iDown, jRight ) ? x22 : inputBlock->value( iDown, jRight );
-
-        double derX = calcFirstDerX( x11, x21, x31, x12, x22, x32, x13, x23, x33, cellXSize );
-        double derY = calcFirstDerY( x11, x21, x31, x12, x22, x32, x13, x23, x33, cellYSize );
+          if ( inputBlock->isNoData( i,  j ) )
+          {
+            derXData[index] = noDataMarker;
+            derYData[index] = noDataMarker;
+            continue;
+          }
 
-        // Fast formula
+          qgssize iUp, iDown, jLeft, jRight;
+          if ( i == 0 )
+          {
+            iUp = i;
+            iDown = i + 1;
+          }
+          else if ( i < static_cast<qgssize>( height ) - 1 )
+          {
+            iUp = i - 1;
+            iDown = i + 1;
+          }
+          else
+          {
+            iUp = i - 1;
+            iDown = i;
+          }
 
-        double grayValue;
-        if ( !mMultiDirectional )
-        {
-          // Standard single direction hillshade
-          grayValue = qBound( 0.0, ( sin_altRadians_mul_254 -
-                                     ( derY * cos_az_mul_cos_alt_mul_z_mul_254 -
-                                       derX * sin_az_mul_cos_alt_mul_z_mul_254 ) ) /
-                              std::sqrt( 1 + square_z * ( derX * derX + derY * derY ) )
-                              , 255.0 );
-        }
-        else
-        {
-          // Weighted multi direction as in http://pubs.usgs.gov/of/1992/of92-422/of92-422.pdf
-          // Fast formula from GDAL DEM
-          const float xx = derX * derX;
-          const float yy = derY * derY;
-          const float xx_plus_yy = xx + yy;
-          // Flat?
-          if ( xx_plus_yy == 0.0 )
+          if ( j == 0 )
+          {
+            jLeft = j;
+            jRight = j + 1;
+          }
+          else if ( j <  static_cast<qgssize>( width ) - 1 )
           {
-            grayValue = qBound( 0.0f, static_cast<float>( 1.0 + sin_altRadians_mul_254 ), 255.0f );
+            jLeft = j - 1;
+            jRight = j + 1;
           }
           else
           {
-            // ... then the shade value from different azimuth
-            float val225_mul_127 = sin_altRadians_mul_127 +
-                                   ( derX - derY ) * cos225_az_mul_cos_alt_mul_z_mul_127;
-            val225_mul_127 = ( val225_mul_127 <= 0.0 ) ? 0.0 : val225_mul_127;
-            float val270_mul_127 = sin_altRadians_mul_127 -
-                                   derX * cos_alt_mul_z_mul_127;
-            val270_mul_127 = ( val270_mul_127 <= 0.0 ) ? 0.0 : val270_mul_127;
-            float val315_mul_127 = sin_altRadians_mul_127 +
-                                   ( derX + derY ) * cos225_az_mul_cos_alt_mul_z_mul_127;
-            val315_mul_127 = ( val315_mul_127 <= 0.0 ) ? 0.0 : val315_mul_127;
-            float val360_mul_127 = sin_altRadians_mul_127 -
-                                   derY * cos_alt_mul_z_mul_127;
-            val360_mul_127 = ( val360_mul_127 <= 0.0 ) ? 0.0 : val360_mul_127;
-
-            // ... then the weighted shading
-            const float weight_225 = 0.5 * xx_plus_yy - derX * derY;
-            const float weight_270 = xx;
-            const float weight_315 = xx_plus_yy - weight_225;
-            const float weight_360 = yy;
-            const float cang_mul_127 = (
-                                         ( weight_225 * val225_mul_127 +
-                                           weight_270 * val270_mul_127 +
-                                           weight_315 * val315_mul_127 +
-                                           weight_360 * val360_mul_127 ) / xx_plus_yy ) /
-                                       ( 1 + square_z * xx_plus_yy );
-
-            grayValue = qBound( 0.0f, 1.0f + cang_mul_127, 255.0f );
+            jLeft = j - 1;
+            jRight = j;
           }
-        }
 
-        double currentAlpha = mOpacity;
-        if ( mRasterTransparency )
-        {
-          currentAlpha = mRasterTransparency->alphaValue( x22, mOpacity * 255 ) / 255.0;
-        }
-        if ( mAlphaBand > 0 )
-        {
-          currentAlpha *= alphaBlock->value( i ) / 255.0;
+          double x11;
+          double x21;
+          double x31;
+          double x12;
+          double x22; // Working cell
+          double x32;
+          double x13;
+          double x23;
+          double x33;
+
+          // This is center cell. It is not nodata. Use this in place of nodata neighbors
+          x22 = inputBlock->value( i, j );
+
+          x11 = inputBlock->isNoData( iUp, jLeft )  ? x22 : inputBlock->value( iUp, jLeft );
+          x21 = inputBlock->isNoData( i, jLeft )     ? x22 : inputBlock->value( i, jLeft );
+          x31 = inputBlock->isNoData( iDown, jLeft ) ? x22 : inputBlock->value( iDown, jLeft );
+
+          x12 = inputBlock->isNoData( iUp, j )       ? x22 : inputBlock->value( iUp, j );
+          // x22
+          x32 = inputBlock->isNoData( iDown, j )     ? x22 : inputBlock->value( iDown, j );
+
+          x13 = inputBlock->isNoData( iUp, jRight )   ? x22 : inputBlock->value( iUp, jRight );
+          x23 = inputBlock->isNoData( i, jRight )     ? x22 : inputBlock->value( i, jRight );
+          x33 = inputBlock->isNoData( iDown, jRight ) ? x22 : inputBlock->value( iDown, jRight );
+
+          derXData[index] = static_cast<float>( calcFirstDerX( x11, x21, x31, x12, x22, x32, x13, x23, x33, cellXSize ) );
+          derYData[index] = static_cast<float>( calcFirstDerY( x11, x21, x31, x12, x22, x32, x13, x23, x33, cellYSize ) );
         }
+      }
+
+      QMutexLocker locker( &sGradientFieldCacheMutex );
+      sGradientFieldCache.insert( gradientKey, new QgsHillshadeGradientField( *field ),
+                                  static_cast<int>( static_cast<qgssize>( width ) * height * 2 * sizeof( float ) / 1024 ) + 1 );
+    }
 
-        if ( qgsDoubleNear( currentAlpha, 1.0 ) )
+    // Stage 2: evaluate the shading formula over the contiguous gradient
+    // arrays. The loop is branch-light and operates on packed floats so that
+    // the compiler can vectorize it; this is also why multidirectional
+    // hillshade costs roughly the same as single direction.
+    const float *derXData = field->derX.constData();
+    const float *derYData = field->derY.constData();
+    QRgb *outputBits = outputBlock->colorData();
+
+    for ( qgssize index = 0; index < static_cast<qgssize>( width ) * height; index++ )
+    {
+      const float derX = derXData[index];
+      if ( std::isnan( derX ) )
+      {
+        outputBits[index] = defaultNodataColor;
+        continue;
+      }
+      const float derY = derYData[index];
+
+      // Fast formula
+
+      double grayValue;
+      if ( !mMultiDirectional )
+      {
+        // Standard single direction hillshade
+        grayValue = qBound( 0.0, ( sin_altRadians_mul_254 -
+                                   ( derY * cos_az_mul_cos_alt_mul_z_mul_254 -
+                                     derX * sin_az_mul_cos_alt_mul_z_mul_254 ) ) /
+                            std::sqrt( 1 + square_z * ( derX * derX + derY * derY ) )
+                            , 255.0 );
+      }
+      else
+      {
+        // Weighted multi direction as in http://pubs.usgs.gov/of/1992/of92-422/of92-422.pdf
+        // Fast formula from GDAL DEM
+        const float xx = derX * derX;
+        const float yy = derY * derY;
+        const float xx_plus_yy = xx + yy;
+        // Flat?
+        if ( xx_plus_yy == 0.0 )
         {
-          outputBlock->setColor( i, j, qRgba( grayValue, grayValue, grayValue, 255 ) );
+          grayValue = qBound( 0.0f, static_cast<float>( 1.0 + sin_altRadians_mul_254 ), 255.0f );
         }
         else
         {
-          outputBlock->setColor( i, j, qRgba( currentAlpha * grayValue, currentAlpha * grayValue, currentAlpha * grayValue, currentAlpha * 255 ) );
+          // ... then the shade value from different azimuth
+          float val225_mul_127 = sin_altRadians_mul_127 +
+                                 ( derX - derY ) * cos225_az_mul_cos_alt_mul_z_mul_127;
+          val225_mul_127 = ( val225_mul_127 <= 0.0 ) ? 0.0 : val225_mul_127;
+          float val270_mul_127 = sin_altRadians_mul_127 -
+                                 derX * cos_alt_mul_z_mul_127;
+          val270_mul_127 = ( val270_mul_127 <= 0.0 ) ? 0.0 : val270_mul_127;
+          float val315_mul_127 = sin_altRadians_mul_127 +
+                                 ( derX + derY ) * cos225_az_mul_cos_alt_mul_z_mul_127;
+          val315_mul_127 = ( val315_mul_127 <= 0.0 ) ? 0.0 : val315_mul_127;
+          float val360_mul_127 = sin_altRadians_mul_127 -
+                                 derY * cos_alt_mul_z_mul_127;
+          val360_mul_127 = ( val360_mul_127 <= 0.0 ) ? 0.0 : val360_mul_127;
+
+          // ... then the weighted shading
+          const float weight_225 = 0.5 * xx_plus_yy - derX * derY;
+          const float weight_270 = xx;
+          const float weight_315 = xx_plus_yy - weight_225;
+          const float weight_360 = yy;
+          const float cang_mul_127 = (
+                                       ( weight_225 * val225_mul_127 +
+                                         weight_270 * val270_mul_127 +
+                                         weight_315 * val315_mul_127 +
+                                         weight_360 * val360_mul_127 ) / xx_plus_yy ) /
+                                     ( 1 + square_z * xx_plus_yy );
+
+          grayValue = qBound( 0.0f, 1.0f + cang_mul_127, 255.0f );
         }
       }
+
+      double currentAlpha = mOpacity;
+      if ( mRasterTransparency )
+      {
+        currentAlpha = mRasterTransparency->alphaValue( inputBlock->value( index ), mOpacity * 255 ) / 255.0;
+      }
+      if ( mAlphaBand > 0 )
+      {
+        currentAlpha *= alphaBlock->value( index ) / 255.0;
+      }
+
+      if ( qgsDoubleNear( currentAlpha, 1.0 ) )
+      {
+        outputBits[index] = qRgba( grayValue, grayValue, grayValue, 255 );
+      }
+      else
+      {
+        outputBits[index] = qRgba( currentAlpha * grayValue, currentAlpha * grayValue, currentAlpha * grayValue, currentAlpha * 255 );
+      }
     }
 
 #ifdef HAVE_OPENCL
@@ -20,12 +20,14 @@
 
 #include <QDomDocument>
 #include <QDomElement>
+#include <QHash>
 
 
 QgsHueSaturationFilter::QgsHueSaturationFilter( QgsRasterInterface *input )
   : QgsRasterInterface( input )
   , mColorizeColor( QColor::fromRgb( 255, 128, 128 ) )
 {
+  setSaturation( mSaturation );
 }
 
 QgsHueSaturationFilter *QgsHueSaturationFilter::clone() const
@@ -139,6 +141,16 @@ QgsRasterBlock *QgsHueSaturationFilter::block( int bandNo, QgsRectangle  const &
   }
 
   // adjust image
+  // the input is a rendered image (see setInput()), so the ARGB data can be
+  // accessed directly instead of going through the per-pixel color() accessor
+  const QRgb *inputBits = inputBlock->colorData();
+  QRgb *outputBits = outputBlock->colorData();
+  if ( !inputBits || !outputBits )
+  {
+    QgsDebugMsg( QStringLiteral( "Input raster is not a rendered image" ) );
+    return outputBlock.release();
+  }
+
   QRgb myNoDataColor = qRgba( 0, 0, 0, 0 );
   QRgb myRgb;
   QColor myColor;
@@ -146,15 +158,29 @@ QgsRasterBlock *QgsHueSaturationFilter::block( int bandNo, QgsRectangle  const &
   int r, g, b, alpha;
   double alphaFactor = 1.0;
 
+  // Repeated colors are very common (especially in basemaps), and the per-pixel
+  // HSL round trip is far more expensive than a hash lookup, so remember the
+  // result for colors already transformed in this block. Bounded so that
+  // photographic imagery with millions of distinct colors cannot blow it up.
+  QHash< QRgb, QRgb > colorCache;
+  const int maxCacheSize = 10000;
+
   for ( qgssize i = 0; i < ( qgssize )width * height; i++ )
   {
-    if ( inputBlock->color( i ) == myNoDataColor )
+    myRgb = inputBits[i];
+    if ( myRgb == myNoDataColor )
+    {
+      outputBits[i] = myNoDataColor;
+      continue;
+    }
+
+    const QHash< QRgb, QRgb >::const_iterator cacheIt = colorCache.constFind( myRgb );
+    if ( cacheIt != colorCache.constEnd() )
     {
-      outputBlock->setColor( i, myNoDataColor );
+      outputBits[i] = cacheIt.value();
       continue;
     }
 
-    myRgb = inputBlock->color( i );
     myColor = QColor( myRgb );
 
     // Alpha must be taken from QRgb, since conversion from QRgb->QColor loses alpha
@@ -163,7 +189,7 @@ QgsRasterBlock *QgsHueSaturationFilter::block( int bandNo, QgsRectangle  const &
     if ( alpha == 0 )
     {
       // totally transparent, no changes required
-      outputBlock->setColor( i, myRgb );
+      outputBits[i] = myRgb;
       continue;
     }
 
@@ -203,7 +229,9 @@ QgsRasterBlock *QgsHueSaturationFilter::block( int bandNo, QgsRectangle  const &
       b *= alphaFactor;
     }
 
-    outputBlock->setColor( i, qRgba( r, g, b, alpha ) );
+    outputBits[i] = qRgba( r, g, b, alpha );
+    if ( colorCache.size() < maxCacheSize )
+      colorCache.insert( myRgb, outputBits[i] );
   }
 
   return outputBlock.release();
@@ -290,18 +318,9 @@ void QgsHueSaturationFilter::processSaturation( int &r, int &g, int &b, int &h,
     }
     case GrayscaleOff:
     {
-      // Not being made grayscale, do saturation change
-      if ( mSaturationScale < 1 )
-      {
-        // Lowering the saturation. Use a simple linear relationship
-        s = std::min( ( int )( s * mSaturationScale ), 255 );
-      }
-      else
-      {
-        // Raising the saturation. Use a saturation curve to prevent
-        // clipping at maximum saturation with ugly results.
-        s = std::min( ( int )( 255. * ( 1 - std::pow( 1 - ( s / 255. ), std::pow( mSaturationScale, 2 ) ) ) ), 255 );
-      }
+      // Not being made grayscale, do saturation change using the
+      // precomputed mapping (see setSaturation())
+      s = mSaturationLut[ qBound( 0, s, 255 ) ];
 
       // Saturation changed, so update rgb values
       myColor = QColor::fromHsl( h, s, l );
@@ -317,6 +336,24 @@ void QgsHueSaturationFilter::setSaturation( int saturation )
 
   // Scale saturation value to [0-2], where 0 = desaturated
   mSaturationScale = ( ( double ) mSaturation / 100 ) + 1;
+
+  // Precompute the saturation mapping for all possible values -- the curve for
+  // raised saturation needs a std::pow per value, far too expensive to evaluate
+  // per pixel
+  for ( int i = 0; i < 256; ++i )
+  {
+    if ( mSaturationScale < 1 )
+    {
+      // Lowering the saturation. Use a simple linear relationship
+      mSaturationLut[i] = std::min( ( int )( i * mSaturationScale ), 255 );
+    }
+    else
+    {
+      // Raising the saturation. Use a saturation curve to prevent
+      // clipping at maximum saturation with ugly results.
+      mSaturationLut[i] = std::min( ( int )( 255. * ( 1 - std::pow( 1 - ( i / 255. ), std::pow( mSaturationScale, 2 ) ) ) ), 255 );
+    }
+  }
 }
 
 void QgsHueSaturationFilter::setColorizeColor( const QColor &colorizeColor )
@@ -81,6 +81,9 @@ class CORE_EXPORT QgsHueSaturationFilter : public QgsRasterInterface
     int mSaturation = 0;
     double mSaturationScale = 1;
 
+    //! Precomputed saturation mapping for all possible values, updated by setSaturation()
+    int mSaturationLut[256];
+
     //! Current grayscale mode
     QgsHueSaturationFilter::GrayscaleMode mGrayscaleMode = QgsHueSaturationFilter::GrayscaleOff;
 
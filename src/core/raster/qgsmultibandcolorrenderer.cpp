@@ -21,6 +21,7 @@
 #include "qgsrasterviewport.h"
 
 #include <QDomDocument>
+#include <QtConcurrentMap>
 #include <QDomElement>
 #include <QImage>
 #include <QSet>
@@ -200,6 +201,25 @@ QgsRasterBlock *QgsMultiBandColorRenderer::block( int bandNo, QgsRectangle  cons
     }
   }
 
+  bool allBandsNoData = true;
+  QMap<int, QgsRasterBlock *>::const_iterator blockIt = bandBlocks.constBegin();
+  for ( ; blockIt != bandBlocks.constEnd(); ++blockIt )
+  {
+    if ( !blockIt.value()->isEntirelyNoData() )
+    {
+      allBandsNoData = false;
+      break;
+    }
+  }
+  if ( allBandsNoData )
+  {
+    // every input band is entirely nodata -- emit a transparent block without the per-pixel loop
+    if ( outputBlock->reset( Qgis::ARGB32_Premultiplied, width, height ) )
+      outputBlock->setIsNoData();
+    qDeleteAll( bandBlocks );
+    return outputBlock.release();
+  }
+
   if ( mRedBand > 0 )
   {
     redBlock = bandBlocks[mRedBand];
@@ -262,9 +282,9 @@ QgsRasterBlock *QgsMultiBandColorRenderer::block( int bandNo, QgsRectangle  cons
   }
 
   qgssize count = ( qgssize )width * height;
-  for ( qgssize i = 0; i < count; i++ )
+  if ( fastDraw ) //fast rendering if no transparency, stretching, color inversion, etc.
   {
-    if ( fastDraw ) //fast rendering if no transparency, stretching, color inversion, etc.
+    for ( qgssize i = 0; i < count; i++ )
     {
       if ( redBlock->isNoData( i ) ||
            greenBlock->isNoData( i ) ||
@@ -286,73 +306,98 @@ QgsRasterBlock *QgsMultiBandColorRenderer::block( int bandNo, QgsRectangle  cons
           outputBlockColorData[i] = qRgb( redVal, greenVal, blueVal );
         }
       }
-      continue;
-    }
-
-    bool isNoData = false;
-    double redVal = 0;
-    double greenVal = 0;
-    double blueVal = 0;
-    if ( mRedBand > 0 )
-    {
-      redVal = redBlock->valueAndNoData( i, isNoData );
-    }
-    if ( !isNoData && mGreenBand > 0 )
-    {
-      greenVal = greenBlock->valueAndNoData( i, isNoData );
-    }
-    if ( !isNoData && mBlueBand > 0 )
-    {
-      blueVal = blueBlock->valueAndNoData( i, isNoData );
-    }
-    if ( isNoData )
-    {
-      outputBlock->setColor( i, myDefaultColor );
-      continue;
-    }
-
-    //apply default color if red, green or blue not in displayable range
-    if ( ( mRedContrastEnhancement && !mRedContrastEnhancement->isValueInDisplayableRange( redVal ) )
-         || ( mGreenContrastEnhancement && !mGreenContrastEnhancement->isValueInDisplayableRange( redVal ) )
-         || ( mBlueContrastEnhancement && !mBlueContrastEnhancement->isValueInDisplayableRange( redVal ) ) )
-    {
-      outputBlock->setColor( i, myDefaultColor );
-      continue;
     }
-
-    //stretch color values
+  }
+  else
+  {
+    // force any lookup tables to be built up front -- enhanceContrast()
+    // generates them lazily, which would race between the worker threads below
     if ( mRedContrastEnhancement )
-    {
-      redVal = mRedContrastEnhancement->enhanceContrast( redVal );
-    }
+      mRedContrastEnhancement->enhanceContrast( mRedContrastEnhancement->minimumValue() );
     if ( mGreenContrastEnhancement )
-    {
-      greenVal = mGreenContrastEnhancement->enhanceContrast( greenVal );
-    }
+      mGreenContrastEnhancement->enhanceContrast( mGreenContrastEnhancement->minimumValue() );
     if ( mBlueContrastEnhancement )
-    {
-      blueVal = mBlueContrastEnhancement->enhanceContrast( blueVal );
-    }
+      mBlueContrastEnhancement->enhanceContrast( mBlueContrastEnhancement->minimumValue() );
 
-    //opacity
-    double currentOpacity = mOpacity;
-    if ( mRasterTransparency )
-    {
-      currentOpacity = mRasterTransparency->alphaValue( redVal, greenVal, blueVal, mOpacity * 255 ) / 255.0;
-    }
-    if ( mAlphaBand > 0 )
+    QgsRasterBlock *output = outputBlock.get();
+    const auto renderPixelRange = [this, output, redBlock, greenBlock, blueBlock, alphaBlock, myDefaultColor]( const QPair<qgssize, qgssize> &range )
     {
-      currentOpacity *= alphaBlock->value( i ) / 255.0;
-    }
+      for ( qgssize i = range.first; i < range.second; i++ )
+      {
+        bool isNoData = false;
+        double redVal = 0;
+        double greenVal = 0;
+        double blueVal = 0;
+        if ( mRedBand > 0 )
+        {
+          redVal = redBlock->valueAndNoData( i, isNoData );
+        }
+        if ( !isNoData && mGreenBand > 0 )
+        {
+          greenVal = greenBlock->valueAndNoData( i, isNoData );
+        }
+        if ( !isNoData && mBlueBand > 0 )
+        {
+          blueVal = blueBlock->valueAndNoData( i, isNoData );
+        }
+        if ( isNoData )
+        {
+          output->setColor( i, myDefaultColor );
+          continue;
+        }
 
-    if ( qgsDoubleNear( currentOpacity, 1.0 ) )
-    {
-      outputBlock->setColor( i, qRgba( redVal, greenVal, blueVal, 255 ) );
-    }
+        //apply default color if red, green or blue not in displayable range
+        if ( ( mRedContrastEnhancement && !mRedContrastEnhancement->isValueInDisplayableRange( redVal ) )
+             || ( mGreenContrastEnhancement && !mGreenContrastEnhancement->isValueInDisplayableRange( redVal ) )
+             || ( mBlueContrastEnhancement && !mBlueContrastEnhancement->isValueInDisplayableRange( redVal ) ) )
+        {
+          output->setColor( i, myDefaultColor );
+          continue;
+        }
+
+        //stretch color values
+        if ( mRedContrastEnhancement )
+        {
+          redVal = mRedContrastEnhancement->enhanceContrast( redVal );
+        }
+        if ( mGreenContrastEnhancement )
+        {
+          greenVal = mGreenContrastEnhancement->enhanceContrast( greenVal );
+        }
+        if ( mBlueContrastEnhancement )
+        {
+          blueVal = mBlueContrastEnhancement->enhanceContrast( blueVal );
+        }
+
+        //opacity
+        double currentOpacity = mOpacity;
+        if ( mRasterTransparency )
+        {
+          currentOpacity = mRasterTransparency->alphaValue( redVal, greenVal, blueVal, mOpacity * 255 ) / 255.0;
+        }
+        if ( mAlphaBand > 0 )
+        {
+          currentOpacity *= alphaBlock->value( i ) / 255.0;
+        }
+
+        if ( qgsDoubleNear( currentOpacity, 1.0 ) )
+        {
+          output->setColor( i, qRgba( redVal, greenVal, blueVal, 255 ) );
+        }
+        else
+        {
+          output->setColor( i, qRgba( currentOpacity * redVal, currentOpacity * greenVal, currentOpacity * blueVal, currentOpacity * 255 ) );
+        }
+      }
+    };
+
+    // the per-pixel stretch is CPU bound on large blocks -- spread contiguous
+    // row ranges over the worker threads, each writing disjoint output pixels
+    QVector< QPair< qgssize, qgssize > > ranges = QgsRasterBlock::splitIntoRowRanges( width, height );
+    if ( ranges.size() == 1 )
+      renderPixelRange( ranges.at( 0 ) );
     else
-    {
-      outputBlock->setColor( i, qRgba( currentOpacity * redVal, currentOpacity * greenVal, currentOpacity * blueVal, currentOpacity * 255 ) );
-    }
+      QtConcurrent::blockingMap( ranges, renderPixelRange );
   }
 
   //delete input blocks
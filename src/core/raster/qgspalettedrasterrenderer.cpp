@@ -135,6 +135,14 @@ QgsRasterBlock *QgsPalettedRasterRenderer::block( int, QgsRectangle  const &exte
     return outputBlock.release();
   }
 
+  if ( inputBlock->isEntirelyNoData() )
+  {
+    // the whole block is nodata -- emit a transparent block without classifying pixels
+    if ( outputBlock->reset( Qgis::ARGB32_Premultiplied, width, height ) )
+      outputBlock->setIsNoData();
+    return outputBlock.release();
+  }
+
   double currentOpacity = mOpacity;
 
   //rendering is faster without considering user-defined transparency
@@ -177,7 +185,8 @@ QgsRasterBlock *QgsPalettedRasterRenderer::block( int, QgsRectangle  const &exte
       continue;
     }
     int val = static_cast< int >( value );
-    if ( !mColors.contains( val ) )
+    const auto colorIt = mColors.constFind( val );
+    if ( colorIt == mColors.constEnd() )
     {
       outputData[i] = myDefaultColor;
       continue;
@@ -185,7 +194,7 @@ QgsRasterBlock *QgsPalettedRasterRenderer::block( int, QgsRectangle  const &exte
 
     if ( !hasTransparency )
     {
-      outputData[i] = mColors.value( val );
+      outputData[i] = colorIt.value();
     }
     else
     {
@@ -199,7 +208,7 @@ QgsRasterBlock *QgsPalettedRasterRenderer::block( int, QgsRectangle  const &exte
         currentOpacity *= alphaBlock->value( i ) / 255.0;
       }
 
-      QRgb c = mColors.value( val );
+      QRgb c = colorIt.value();
       outputData[i] = qRgba( currentOpacity * qRed( c ), currentOpacity * qGreen( c ), currentOpacity * qBlue( c ), currentOpacity * qAlpha( c ) );
     }
   }
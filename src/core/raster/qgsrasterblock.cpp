@@ -15,10 +15,13 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <limits>
+#include <memory>
 
 #include <QByteArray>
 #include <QColor>
+#include <QThread>
 
 #include "qgslogger.h"
 #include "qgsrasterblock.h"
@@ -66,6 +69,7 @@ bool QgsRasterBlock::reset( Qgis::DataType dataType, int width, int height )
   mHasNoDataValue = false;
   mNoDataValue = std::numeric_limits<double>::quiet_NaN();
   mValid = false;
+  mEntirelyNoData = false;
 
   if ( typeIsNumeric( dataType ) )
   {
@@ -101,6 +105,37 @@ bool QgsRasterBlock::reset( Qgis::DataType dataType, int width, int height )
   return true;
 }
 
+QgsRasterBlock *QgsRasterBlock::clone() const
+{
+  std::unique_ptr< QgsRasterBlock > block( new QgsRasterBlock( mDataType, mWidth, mHeight ) );
+  if ( block->isEmpty() && !isEmpty() )
+  {
+    // allocation failed
+    return nullptr;
+  }
+
+  if ( mData && block->mData )
+  {
+    memcpy( block->mData, mData, mTypeSize * static_cast< qgssize >( mWidth ) * mHeight );
+  }
+  if ( mImage && block->mImage )
+  {
+    *block->mImage = *mImage;
+  }
+  if ( mNoDataBitmap )
+  {
+    if ( !block->createNoDataBitmap() )
+      return nullptr;
+    memcpy( block->mNoDataBitmap, mNoDataBitmap, mNoDataBitmapSize );
+  }
+
+  block->mHasNoDataValue = mHasNoDataValue;
+  block->mNoDataValue = mNoDataValue;
+  block->mValid = mValid;
+  block->mEntirelyNoData = mEntirelyNoData;
+  return block.release();
+}
+
 QImage::Format QgsRasterBlock::imageFormat( Qgis::DataType dataType )
 {
   if ( dataType == Qgis::ARGB32 )
@@ -234,6 +269,8 @@ void QgsRasterBlock::resetNoDataValue()
 bool QgsRasterBlock::setIsNoData()
 {
   QgsDebugMsgLevel( QStringLiteral( "Entered" ), 4 );
+  if ( mEntirelyNoData )
+    return true;
   if ( typeIsNumeric( mDataType ) )
   {
     if ( mHasNoDataValue )
@@ -267,6 +304,7 @@ bool QgsRasterBlock::setIsNoData()
       QgsDebugMsgLevel( QStringLiteral( "set mNoDataBitmap to 1" ), 4 );
       memset( mNoDataBitmap, 0xff, mNoDataBitmapSize );
     }
+    mEntirelyNoData = true;
     return true;
   }
   else
@@ -279,12 +317,16 @@ bool QgsRasterBlock::setIsNoData()
     }
     QgsDebugMsgLevel( QStringLiteral( "Fill image" ), 4 );
     mImage->fill( NO_DATA_COLOR );
+    mEntirelyNoData = true;
     return true;
   }
 }
 
 bool QgsRasterBlock::setIsNoDataExcept( QRect exceptRect )
 {
+  // the excepted rectangle is expected to receive data
+  mEntirelyNoData = false;
+
   int top = exceptRect.top();
   int bottom = exceptRect.bottom();
   int left = exceptRect.left();
@@ -458,6 +500,8 @@ void QgsRasterBlock::setData( const QByteArray &data, int offset )
   if ( offset < 0 )
     return;  // negative offsets not allowed
 
+  mEntirelyNoData = false;
+
   if ( mData )
   {
     int len = std::min( data.size(), typeSize( mDataType ) * mWidth * mHeight - offset );
@@ -478,6 +522,8 @@ char *QgsRasterBlock::bits( qgssize index )
     QgsDebugMsgLevel( QStringLiteral( "Index %1 out of range (%2 x %3)" ).arg( index ).arg( mWidth ).arg( mHeight ), 4 );
     return nullptr;
   }
+  // the caller may write through the returned pointer
+  mEntirelyNoData = false;
   if ( mData )
   {
     return reinterpret_cast< char * >( mData ) + index * mTypeSize;
@@ -497,6 +543,8 @@ char *QgsRasterBlock::bits( int row, int column )
 
 char *QgsRasterBlock::bits()
 {
+  // the caller may write through the returned pointer
+  mEntirelyNoData = false;
   if ( mData )
   {
     return reinterpret_cast< char * >( mData );
@@ -723,6 +771,28 @@ QByteArray QgsRasterBlock::valueBytes( Qgis::DataType dataType, double value )
   return ba;
 }
 
+QVector< QPair< qgssize, qgssize > > QgsRasterBlock::splitIntoRowRanges( int width, int height )
+{
+  QVector< QPair< qgssize, qgssize > > ranges;
+  const qgssize count = static_cast< qgssize >( width ) * height;
+  const int threadCount = std::min( QThread::idealThreadCount(), height );
+  if ( threadCount < 2 || count < 250000 )
+  {
+    // too small for the threading overhead to pay off -- process the whole block at once
+    ranges << qMakePair( static_cast< qgssize >( 0 ), count );
+    return ranges;
+  }
+
+  const int rowsPerRange = ( height + threadCount - 1 ) / threadCount;
+  for ( int row = 0; row < height; row += rowsPerRange )
+  {
+    const qgssize start = static_cast< qgssize >( row ) * width;
+    const qgssize end = std::min( count, static_cast< qgssize >( row + rowsPerRange ) * width );
+    ranges << qMakePair( start, end );
+  }
+  return ranges;
+}
+
 bool QgsRasterBlock::createNoDataBitmap()
 {
   mNoDataBitmapWidth = mWidth / 8 + 1;
@@ -57,6 +57,13 @@ class CORE_EXPORT QgsRasterBlock
      */
     bool reset( Qgis::DataType dataType, int width, int height );
 
+    /**
+     * Returns a deep copy of the block, including its data, image and
+     * no data information.
+     * \since QGIS 3.8
+     */
+    QgsRasterBlock *clone() const SIP_FACTORY;
+
     // TODO: consider if use isValid() at all, isEmpty() should be sufficient
     // and works also if block is valid but empty - difference between valid and empty?
 
@@ -77,6 +84,19 @@ class CORE_EXPORT QgsRasterBlock
      */
     bool isEmpty() const;
 
+    /**
+     * Returns TRUE if the block is known to contain only nodata values.
+     *
+     * This is a cheap flag set by setIsNoData() and cleared again by any write
+     * access to the block, so FALSE only means the block is not *known* to be
+     * entirely nodata. Renderers, filters and the projector use it to skip
+     * nodata-only blocks wholesale (common for coastal scenes and rotated
+     * mosaics) instead of testing every pixel.
+     *
+     * \since QGIS 3.8
+     */
+    bool isEntirelyNoData() const { return mEntirelyNoData; }
+
     // Return data type size in bytes
     static int typeSize( int dataType )
     {
@@ -180,6 +200,20 @@ class CORE_EXPORT QgsRasterBlock
     */
     static QByteArray valueBytes( Qgis::DataType dataType, double value );
 
+    /**
+     * Splits a block of \a width x \a height pixels into contiguous ranges of
+     * pixel indices, one per available worker thread, suitable for processing
+     * rows of the block in parallel (e.g. via QtConcurrent::blockingMap).
+     *
+     * Ranges always cover whole rows. A single range covering the complete
+     * block is returned when the block is too small for the threading overhead
+     * to pay off.
+     *
+     * \note Not available in Python bindings
+     * \since QGIS 3.8
+    */
+    static QVector< QPair< qgssize, qgssize > > splitIntoRowRanges( int width, int height ) SIP_SKIP;
+
     /**
      * Read a single value if type of block is numeric. If type is color,
      * returned value is undefined.
@@ -364,6 +398,7 @@ class CORE_EXPORT QgsRasterBlock
         return false;
       }
       writeValue( mData, mDataType, index, value );
+      mEntirelyNoData = false;
       return true;
     }
 
@@ -402,6 +437,7 @@ class CORE_EXPORT QgsRasterBlock
       // setPixel() is slow, see Qt doc -> use direct access
       QRgb *bits = reinterpret_cast< QRgb * >( mImage->bits() );
       bits[index] = color;
+      mEntirelyNoData = false;
       return true;
     }
 
@@ -416,9 +452,114 @@ class CORE_EXPORT QgsRasterBlock
     {
       if ( !mImage )
         return nullptr;
+      // the caller may write through the returned pointer
+      mEntirelyNoData = false;
       return reinterpret_cast< QRgb * >( mImage->bits() );
     }
 
+    /**
+     * Resolves the block's data type once and invokes \a functor with a typed
+     * pointer to the raw pixel data and the number of pixels in the block.
+     *
+     * The functor is called with each of the possible numeric pixel types, so
+     * it must be a generic callable, e.g. a struct with a templated call
+     * operator:
+     *
+     * \code{.cpp}
+     * struct Visitor
+     * {
+     *   template <typename T> void operator()( T *data, qgssize count ) { ... }
+     * };
+     * \endcode
+     *
+     * Returns FALSE without invoking the functor if the block holds color data
+     * or no data is allocated. Filters and renderers iterating whole blocks
+     * should prefer this over value()/setValue(), which re-dispatch on the
+     * data type for every single pixel.
+     *
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    template <typename Functor>
+    bool typedDispatch( Functor &functor ) SIP_SKIP
+    {
+      if ( !mData )
+        return false;
+
+      // the functor may write through the typed pointer
+      mEntirelyNoData = false;
+
+      const qgssize count = static_cast< qgssize >( mWidth ) * mHeight;
+      switch ( mDataType )
+      {
+        case Qgis::Byte:
+          functor( static_cast< quint8 * >( mData ), count );
+          return true;
+        case Qgis::UInt16:
+          functor( static_cast< quint16 * >( mData ), count );
+          return true;
+        case Qgis::Int16:
+          functor( static_cast< qint16 * >( mData ), count );
+          return true;
+        case Qgis::UInt32:
+          functor( static_cast< quint32 * >( mData ), count );
+          return true;
+        case Qgis::Int32:
+          functor( static_cast< qint32 * >( mData ), count );
+          return true;
+        case Qgis::Float32:
+          functor( static_cast< float * >( mData ), count );
+          return true;
+        case Qgis::Float64:
+          functor( static_cast< double * >( mData ), count );
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    /**
+     * Resolves the block's data type once and invokes \a functor with a typed
+     * pointer to the raw pixel data and the number of pixels in the block.
+     * \note not available in Python bindings
+     * \see typedDispatch()
+     * \since QGIS 3.8
+     */
+    template <typename Functor>
+    bool typedDispatch( Functor &functor ) const SIP_SKIP
+    {
+      if ( !mData )
+        return false;
+
+      const qgssize count = static_cast< qgssize >( mWidth ) * mHeight;
+      switch ( mDataType )
+      {
+        case Qgis::Byte:
+          functor( static_cast< const quint8 * >( mData ), count );
+          return true;
+        case Qgis::UInt16:
+          functor( static_cast< const quint16 * >( mData ), count );
+          return true;
+        case Qgis::Int16:
+          functor( static_cast< const qint16 * >( mData ), count );
+          return true;
+        case Qgis::UInt32:
+          functor( static_cast< const quint32 * >( mData ), count );
+          return true;
+        case Qgis::Int32:
+          functor( static_cast< const qint32 * >( mData ), count );
+          return true;
+        case Qgis::Float32:
+          functor( static_cast< const float * >( mData ), count );
+          return true;
+        case Qgis::Float64:
+          functor( static_cast< const double * >( mData ), count );
+          return true;
+        default:
+          return false;
+      }
+    }
+
     /**
      * \brief Set no data on pixel
      *  \param row row index
@@ -516,6 +657,7 @@ class CORE_EXPORT QgsRasterBlock
       int bit = column % 8;
       int nodata = 0x80 >> bit;
       mNoDataBitmap[byte] = mNoDataBitmap[byte] & ~nodata;
+      mEntirelyNoData = false;
     }
 
     /**
@@ -705,6 +847,10 @@ class CORE_EXPORT QgsRasterBlock
     // Has no data value
     bool mHasNoDataValue = false;
 
+    // Whether the block is known to contain nothing but nodata values. Set by
+    // setIsNoData(), conservatively cleared again by any write access.
+    bool mEntirelyNoData = false;
+
     // No data value
     double mNoDataValue;
 
@@ -0,0 +1,79 @@
+/***************************************************************************
+    qgsrasterblockcache.cpp - Process-wide cache of raster data blocks
+     --------------------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgsrasterblockcache.h"
+
+#include "qgis.h"
+#include "qgsrasterblock.h"
+#include "qgsrectangle.h"
+#include "qgssettings.h"
+
+QgsRasterBlockCache *QgsRasterBlockCache::instance()
+{
+  static QgsRasterBlockCache sInstance;
+  return &sInstance;
+}
+
+QgsRasterBlockCache::QgsRasterBlockCache()
+{
+  // The size is read once: toggling the cache requires a restart
+  mMaxCost = QgsSettings().value( QStringLiteral( "qgis/rasterBlockCacheSizeMB" ), 0 ).toLongLong() * 1024 * 1024;
+  if ( mMaxCost > 0 )
+    mCache.setMaxCost( static_cast< int >( std::min( mMaxCost, static_cast< qint64 >( std::numeric_limits<int>::max() ) ) ) );
+}
+
+QString QgsRasterBlockCache::blockKey( const QString &uri, int bandNo, const QgsRectangle &extent, int width, int height )
+{
+  return QStringLiteral( "%1|%2|%3|%4|%5|%6|%7|%8" ).arg( uri ).arg( bandNo )
+         .arg( qgsDoubleToString( extent.xMinimum() ),
+               qgsDoubleToString( extent.yMinimum() ),
+               qgsDoubleToString( extent.xMaximum() ),
+               qgsDoubleToString( extent.yMaximum() ) )
+         .arg( width ).arg( height );
+}
+
+QgsRasterBlock *QgsRasterBlockCache::block( const QString &key )
+{
+  QMutexLocker locker( &mMutex );
+  QgsRasterBlock *cached = mCache.object( key );
+  if ( !cached )
+    return nullptr;
+
+  return cached->clone();
+}
+
+void QgsRasterBlockCache::insert( const QString &key, const QgsRasterBlock *block )
+{
+  if ( !block || block->isEmpty() || !block->isValid() )
+    return;
+
+  const qgssize cost = QgsRasterBlock::typeSize( block->dataType() ) *
+                       static_cast< qgssize >( block->width() ) * block->height();
+  if ( cost == 0 || cost > static_cast< qgssize >( mCache.maxCost() ) )
+    return;
+
+  QgsRasterBlock *copy = block->clone();
+  if ( !copy )
+    return;
+
+  QMutexLocker locker( &mMutex );
+  mCache.insert( key, copy, static_cast< int >( cost ) );
+}
+
+void QgsRasterBlockCache::clear()
+{
+  QMutexLocker locker( &mMutex );
+  mCache.clear();
+}
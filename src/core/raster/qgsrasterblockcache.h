@@ -0,0 +1,85 @@
+/***************************************************************************
+    qgsrasterblockcache.h - Process-wide cache of raster data blocks
+     --------------------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+#ifndef QGSRASTERBLOCKCACHE_H
+#define QGSRASTERBLOCKCACHE_H
+
+#define SIP_NO_FILE
+
+#include "qgis_core.h"
+
+#include <QCache>
+#include <QMutex>
+#include <QString>
+
+class QgsRasterBlock;
+class QgsRectangle;
+
+/**
+ * \ingroup core
+ * A process-wide cache of raster data blocks, sitting between the raster
+ * pipe and the data providers.
+ *
+ * Blocks are keyed by source URI, band and the exact requested extent and
+ * pixel size, so repeated requests for the same area - e.g. from the canvas
+ * and a layout preview of the same source, or from several pipes on layers
+ * sharing one source - skip the provider's read and decode entirely. Cached
+ * blocks are deep copies, and lookups return deep copies, so the cache never
+ * shares data with its callers.
+ *
+ * Total memory use is bounded by the qgis/rasterBlockCacheSizeMB setting,
+ * with least-recently-used eviction. The cache is disabled when that setting
+ * is 0 (the default): it trades memory and potential staleness (a source
+ * modified on disk keeps serving old blocks until eviction) for decode time,
+ * which is a profitable trade for slow-to-decode formats only.
+ *
+ * This class is thread safe.
+ *
+ * \note not available in Python bindings
+ * \since QGIS 3.8
+ */
+class CORE_EXPORT QgsRasterBlockCache
+{
+  public:
+
+    //! Returns the global raster block cache
+    static QgsRasterBlockCache *instance();
+
+    //! Returns TRUE if the cache is enabled, i.e. a non-zero size is configured
+    bool enabled() const { return mMaxCost > 0; }
+
+    //! Builds the cache key for a block request
+    static QString blockKey( const QString &uri, int bandNo, const QgsRectangle &extent, int width, int height );
+
+    /**
+     * Returns a copy of the cached block for \a key, or a nullptr on cache miss.
+     * Ownership of the returned block is transferred to the caller.
+     */
+    QgsRasterBlock *block( const QString &key );
+
+    //! Stores a copy of \a block under \a key. Ownership is not transferred.
+    void insert( const QString &key, const QgsRasterBlock *block );
+
+    //! Removes all entries from the cache
+    void clear();
+
+  private:
+    QgsRasterBlockCache();
+
+    QMutex mMutex;
+    QCache< QString, QgsRasterBlock > mCache;
+    qint64 mMaxCost = 0;
+};
+
+#endif // QGSRASTERBLOCKCACHE_H
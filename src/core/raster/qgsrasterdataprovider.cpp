@@ -16,6 +16,7 @@
  ***************************************************************************/
 
 #include "qgsproviderregistry.h"
+#include "qgsrasterblockcache.h"
 #include "qgsrasterdataprovider.h"
 #include "qgsrasteridentifyresult.h"
 #include "qgsrasterprojector.h"
@@ -46,6 +47,24 @@ QgsRasterBlock *QgsRasterDataProvider::block( int bandNo, QgsRectangle  const &b
   QgsDebugMsgLevel( QStringLiteral( "bandNo = %1 width = %2 height = %3" ).arg( bandNo ).arg( width ).arg( height ), 4 );
   QgsDebugMsgLevel( QStringLiteral( "boundingBox = %1" ).arg( boundingBox.toString() ), 4 );
 
+  QgsRasterBlockCache *blockCache = QgsRasterBlockCache::instance();
+  QString cacheKey;
+  if ( blockCache->enabled() && !isEditable() )
+  {
+    cacheKey = QgsRasterBlockCache::blockKey( dataSourceUri(), bandNo, boundingBox, width, height );
+    // the per-instance settings applied below also shape the returned block,
+    // so they must be part of the key
+    if ( sourceHasNoDataValue( bandNo ) && useSourceNoDataValue( bandNo ) )
+      cacheKey += QLatin1Char( '|' ) + qgsDoubleToString( sourceNoDataValue( bandNo ) );
+    cacheKey += QStringLiteral( "|%1|%2" ).arg( bandScale( bandNo ) ).arg( bandOffset( bandNo ) );
+    const QgsRasterRangeList userNoData = userNoDataValues( bandNo );
+    for ( const QgsRasterRange &range : userNoData )
+      cacheKey += QStringLiteral( "|%1,%2" ).arg( qgsDoubleToString( range.min() ), qgsDoubleToString( range.max() ) );
+
+    if ( QgsRasterBlock *cachedBlock = blockCache->block( cacheKey ) )
+      return cachedBlock;
+  }
+
   QgsRasterBlock *block = new QgsRasterBlock( dataType( bandNo ), width, height );
   if ( sourceHasNoDataValue( bandNo ) && useSourceNoDataValue( bandNo ) )
   {
@@ -202,6 +221,10 @@ QgsRasterBlock *QgsRasterDataProvider::block( int bandNo, QgsRectangle  const &b
   block->applyScaleOffset( bandScale( bandNo ), bandOffset( bandNo ) );
   // apply user no data values
   block->applyNoDataValues( userNoDataValues( bandNo ) );
+
+  if ( !cacheKey.isEmpty() )
+    blockCache->insert( cacheKey, block );
+
   return block;
 }
 
@@ -276,21 +299,67 @@ QgsRasterIdentifyResult QgsRasterDataProvider::identify( const QgsPointXY &point
   int col = static_cast< int >( std::floor( ( point.x() - finalExtent.xMinimum() ) / xres ) );
   int row = static_cast< int >( std::floor( ( finalExtent.yMaximum() - point.y() ) / yres ) );
 
-  double xMin = finalExtent.xMinimum() + col * xres;
-  double xMax = xMin + xres;
-  double yMax = finalExtent.yMaximum() - row * yres;
-  double yMin = yMax - yres;
-  QgsRectangle pixelExtent( xMin, yMin, xMax, yMax );
+  // Read a small multi-band window around the point instead of a single pixel per
+  // band -- repeated identify/sample calls over nearby points (point sampling,
+  // draping) are then resolved from the cached window instead of issuing one
+  // provider read per point and band.
+  constexpr int IDENTIFY_WINDOW_SIZE = 32;
+  constexpr int IDENTIFY_WINDOW_CACHE_SIZE = 4;
 
-  for ( int i = 1; i <= bandCount(); i++ )
+  // windows are aligned to a grid so that scans over an area touch few distinct windows
+  const int col0 = static_cast< int >( std::floor( static_cast< double >( col ) / IDENTIFY_WINDOW_SIZE ) ) * IDENTIFY_WINDOW_SIZE;
+  const int row0 = static_cast< int >( std::floor( static_cast< double >( row ) / IDENTIFY_WINDOW_SIZE ) ) * IDENTIFY_WINDOW_SIZE;
+
+  QMutexLocker cacheLocker( &mIdentifyWindowCacheMutex );
+
+  int cacheIndex = -1;
+  for ( int i = 0; i < mIdentifyWindowCache.count(); i++ )
   {
-    std::unique_ptr< QgsRasterBlock > bandBlock( block( i, pixelExtent, 1, 1 ) );
+    const IdentifyWindowCache &entry = mIdentifyWindowCache.at( i );
+    if ( entry.col0 == col0 && entry.row0 == row0 && entry.contextWidth == width && entry.contextHeight == height &&
+         entry.contextExtent == finalExtent )
+    {
+      cacheIndex = i;
+      break;
+    }
+  }
 
-    if ( bandBlock )
+  if ( cacheIndex < 0 )
+  {
+    const QgsRectangle windowExtent( finalExtent.xMinimum() + col0 * xres,
+                                     finalExtent.yMaximum() - ( row0 + IDENTIFY_WINDOW_SIZE ) * yres,
+                                     finalExtent.xMinimum() + ( col0 + IDENTIFY_WINDOW_SIZE ) * xres,
+                                     finalExtent.yMaximum() - row0 * yres );
+
+    IdentifyWindowCache entry;
+    entry.contextExtent = finalExtent;
+    entry.contextWidth = width;
+    entry.contextHeight = height;
+    entry.col0 = col0;
+    entry.row0 = row0;
+    entry.bandBlocks.reserve( bandCount() );
+    for ( int i = 1; i <= bandCount(); i++ )
     {
-      double value = bandBlock->value( 0 );
+      entry.bandBlocks.append( std::shared_ptr< QgsRasterBlock >( block( i, windowExtent, IDENTIFY_WINDOW_SIZE, IDENTIFY_WINDOW_SIZE ) ) );
+    }
+    mIdentifyWindowCache.prepend( entry );
+    while ( mIdentifyWindowCache.count() > IDENTIFY_WINDOW_CACHE_SIZE )
+      mIdentifyWindowCache.removeLast();
+    cacheIndex = 0;
+  }
+  else if ( cacheIndex > 0 )
+  {
+    mIdentifyWindowCache.move( cacheIndex, 0 );
+    cacheIndex = 0;
+  }
 
-      results.insert( i, value );
+  const IdentifyWindowCache &entry = mIdentifyWindowCache.at( cacheIndex );
+  for ( int i = 1; i <= bandCount(); i++ )
+  {
+    const std::shared_ptr< QgsRasterBlock > &bandBlock = entry.bandBlocks.at( i - 1 );
+    if ( bandBlock )
+    {
+      results.insert( i, bandBlock->value( row - row0, col - col0 ) );
     }
     else
     {
@@ -318,6 +387,26 @@ double QgsRasterDataProvider::sample( const QgsPointXY &point, int band,
   return value.toDouble( ok );
 }
 
+QVector<double> QgsRasterDataProvider::sampleBatch( const QVector<QgsPointXY> &points, int band,
+    const QgsRectangle &boundingBox, int width, int height, int dpi )
+{
+  QVector<double> values;
+  values.reserve( points.size() );
+  // nearby points resolve from the same cached identify window, so a plain loop
+  // already collapses the per-point provider reads
+  for ( const QgsPointXY &point : points )
+  {
+    values.append( sample( point, band, nullptr, boundingBox, width, height, dpi ) );
+  }
+  return values;
+}
+
+void QgsRasterDataProvider::clearIdentifyWindowCache()
+{
+  QMutexLocker locker( &mIdentifyWindowCacheMutex );
+  mIdentifyWindowCache.clear();
+}
+
 QString QgsRasterDataProvider::lastErrorFormat()
 {
   return QStringLiteral( "text/plain" );
@@ -332,7 +421,10 @@ bool QgsRasterDataProvider::writeBlock( QgsRasterBlock *block, int band, int xOf
     QgsDebugMsg( QStringLiteral( "writeBlock() called on read-only provider." ) );
     return false;
   }
-  return write( block->bits(), band, block->width(), block->height(), xOffset, yOffset );
+  const bool result = write( block->bits(), band, block->width(), block->height(), xOffset, yOffset );
+  if ( result )
+    clearIdentifyWindowCache();
+  return result;
 }
 
 typedef QList<QPair<QString, QString> > *pyramidResamplingMethods_t();
@@ -26,8 +26,10 @@
 #include "qgis_core.h"
 #include "qgis_sip.h"
 #include <cmath>
+#include <memory>
 
 #include <QDateTime>
+#include <QMutex>
 #include <QVariant>
 #include <QImage>
 
@@ -380,6 +382,21 @@ class CORE_EXPORT QgsRasterDataProvider : public QgsDataProvider, public QgsRast
                            bool *ok SIP_OUT = nullptr,
                            const QgsRectangle &boundingBox = QgsRectangle(), int width = 0, int height = 0, int dpi = 96 );
 
+    /**
+     * Samples raster values from the specified \a band for many \a points at once, with
+     * the same context parameters as sample(). Values for points outside the data source
+     * extent (or for an invalid band number) are returned as NaN.
+     *
+     * This is considerably faster than calling sample() in a loop for workloads such as
+     * point sampling or draping, since nearby points are resolved from the same cached
+     * multi-band pixel window instead of issuing one provider read per point and band.
+     *
+     * \see sample()
+     * \since QGIS 3.8
+     */
+    virtual QVector<double> sampleBatch( const QVector<QgsPointXY> &points, int band,
+                                         const QgsRectangle &boundingBox = QgsRectangle(), int width = 0, int height = 0, int dpi = 96 );
+
     /**
      * \brief Returns the caption error text for the last error in this provider
      *
@@ -590,6 +607,37 @@ class CORE_EXPORT QgsRasterDataProvider : public QgsDataProvider, public QgsRast
 
     mutable QgsRectangle mExtent;
 
+    /**
+     * Drops all cached identify pixel windows. Must be called whenever the underlying
+     * raster data may have changed (e.g. after writing blocks).
+     * \since QGIS 3.8
+     */
+    void clearIdentifyWindowCache();
+
+  private:
+
+    //! A recently used multi-band window of pixel values kept for identify/sample queries
+    struct IdentifyWindowCache
+    {
+      //! Identify context extent the window was read for
+      QgsRectangle contextExtent;
+      //! Identify context size the window was read for
+      int contextWidth = 0;
+      //! Identify context size the window was read for
+      int contextHeight = 0;
+      //! Top-left corner of the window, in context pixel coordinates
+      int col0 = 0;
+      //! Top-left corner of the window, in context pixel coordinates
+      int row0 = 0;
+      //! One block per band, indexed from 0
+      QVector< std::shared_ptr< QgsRasterBlock > > bandBlocks;
+    };
+
+    //! Small MRU list of identify pixel windows, most recently used first
+    mutable QList< IdentifyWindowCache > mIdentifyWindowCache;
+    //! Protects mIdentifyWindowCache
+    mutable QMutex mIdentifyWindowCacheMutex;
+
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS( QgsRasterDataProvider::ProviderCapabilities )
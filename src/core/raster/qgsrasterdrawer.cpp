@@ -23,6 +23,7 @@
 #include "qgsrasterviewport.h"
 #include "qgsmaptopixel.h"
 #include "qgsrendercontext.h"
+#include "qgssettings.h"
 #include <QImage>
 #include <QPainter>
 #include <QPrinter>
@@ -43,6 +44,11 @@ void QgsRasterDrawer::draw( QPainter *p, QgsRasterViewPort *viewPort, const QgsM
   int bandNumber = 1;
   mIterator->startRasterRead( bandNumber, viewPort->mWidth, viewPort->mHeight, viewPort->mDrawnExtent, feedback );
 
+  // overlap fetching and processing of the next part with drawing of the current one
+  QgsSettings settings;
+  if ( settings.value( QStringLiteral( "qgis/raster_block_prefetch" ), false ).toBool() )
+    mIterator->setPrefetchEnabled( true );
+
   //number of cols/rows in output pixels
   int nCols = 0;
   int nRows = 0;
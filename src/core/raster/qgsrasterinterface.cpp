@@ -16,11 +16,17 @@
  ***************************************************************************/
 
 #include <limits>
+#include <numeric>
 #include <typeinfo>
+#include <utility>
 
 #include <QByteArray>
+#include <QThread>
 #include <QTime>
 #include <QStringList>
+#include <QtConcurrentMap>
+
+#include "qgis.h"
 
 #include "qgslogger.h"
 #include "qgsrasterbandstats.h"
@@ -450,7 +456,6 @@ QgsRasterHistogram QgsRasterInterface::histogram( int bandNo,
   double myBinSize = ( myMaximum - myMinimum ) / myBinCount;
 
   // TODO: progress signals
-  bool isNoData = false;
   for ( int myYBlock = 0; myYBlock < myNYBlocks; myYBlock++ )
   {
     for ( int myXBlock = 0; myXBlock < myNXBlocks; myXBlock++ )
@@ -470,26 +475,62 @@ QgsRasterHistogram QgsRasterInterface::histogram( int bandNo,
 
       std::unique_ptr< QgsRasterBlock > blk( block( bandNo, myPartExtent, myBlockWidth, myBlockHeight, feedback ) );
 
-      // Collect the histogram counts.
-      for ( qgssize i = 0; i < ( static_cast< qgssize >( myBlockHeight ) ) * myBlockWidth; i++ )
+      // Collect the histogram counts. Large blocks are binned in parallel,
+      // each stripe counting into its own local bins which are merged below.
+      const qgssize myBlockPixels = static_cast< qgssize >( myBlockHeight ) * myBlockWidth;
+
+      int myStripeCount = 1;
+      if ( myBlockPixels >= 131072 )
+        myStripeCount = std::max( 1, QThread::idealThreadCount() );
+      const qgssize myStripeSize = ( myBlockPixels + myStripeCount - 1 ) / myStripeCount;
+
+      auto binStripe = [&]( int myStripe ) -> std::pair< QgsRasterHistogram::HistogramVector, int >
       {
-        double myValue = blk->valueAndNoData( i, isNoData );
-        if ( isNoData )
+        QgsRasterHistogram::HistogramVector myBins( myBinCount );
+        int myNonNullCount = 0;
+        bool isNoData = false;
+        const qgssize myStart = myStripe * myStripeSize;
+        const qgssize myEnd = std::min( myBlockPixels, myStart + myStripeSize );
+        for ( qgssize i = myStart; i < myEnd; i++ )
         {
-          continue; // NULL
-        }
+          double myValue = blk->valueAndNoData( i, isNoData );
+          if ( isNoData )
+          {
+            continue; // NULL
+          }
 
-        int myBinIndex = static_cast <int>( std::floor( ( myValue - myMinimum ) /  myBinSize ) );
+          int myBinIndex = static_cast <int>( std::floor( ( myValue - myMinimum ) /  myBinSize ) );
 
-        if ( ( myBinIndex < 0 || myBinIndex > ( myBinCount - 1 ) ) && !includeOutOfRange )
-        {
-          continue;
+          if ( ( myBinIndex < 0 || myBinIndex > ( myBinCount - 1 ) ) && !includeOutOfRange )
+          {
+            continue;
+          }
+          if ( myBinIndex < 0 ) myBinIndex = 0;
+          if ( myBinIndex > ( myBinCount - 1 ) ) myBinIndex = myBinCount - 1;
+
+          myBins[myBinIndex] += 1;
+          myNonNullCount++;
         }
-        if ( myBinIndex < 0 ) myBinIndex = 0;
-        if ( myBinIndex > ( myBinCount - 1 ) ) myBinIndex = myBinCount - 1;
+        return std::make_pair( myBins, myNonNullCount );
+      };
 
-        myHistogram.histogramVector[myBinIndex] += 1;
-        myHistogram.nonNullCount++;
+      QVector< std::pair< QgsRasterHistogram::HistogramVector, int > > myStripeResults;
+      if ( myStripeCount == 1 )
+      {
+        myStripeResults << binStripe( 0 );
+      }
+      else
+      {
+        QVector<int> myStripes( myStripeCount );
+        std::iota( myStripes.begin(), myStripes.end(), 0 );
+        myStripeResults = QtConcurrent::blockingMapped( myStripes, binStripe );
+      }
+
+      for ( const auto &myStripeResult : qgis::as_const( myStripeResults ) )
+      {
+        for ( int myBin = 0; myBin < myBinCount; myBin++ )
+          myHistogram.histogramVector[myBin] += myStripeResult.first.at( myBin );
+        myHistogram.nonNullCount += myStripeResult.second;
       }
     }
   }
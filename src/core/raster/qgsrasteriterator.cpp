@@ -18,6 +18,8 @@
 #include "qgsrasterviewport.h"
 #include "qgsrasterdataprovider.h"
 
+#include <QtConcurrentRun>
+
 QgsRasterIterator::QgsRasterIterator( QgsRasterInterface *input )
   : mInput( input )
   , mMaximumTileWidth( DEFAULT_MAXIMUM_TILE_WIDTH )
@@ -35,6 +37,14 @@ QgsRasterIterator::QgsRasterIterator( QgsRasterInterface *input )
   }
 }
 
+QgsRasterIterator::~QgsRasterIterator()
+{
+  // wait for any pending background fetches - they reference the input interface
+  const QList< int > bands = mRasterPartInfos.keys();
+  for ( int band : bands )
+    removePartInfo( band );
+}
+
 void QgsRasterIterator::startRasterRead( int bandNumber, int nCols, int nRows, const QgsRectangle &extent, QgsRasterBlockFeedback *feedback )
 {
   if ( !mInput )
@@ -100,8 +110,48 @@ bool QgsRasterIterator::readNextRasterPartInternal( int bandNumber, int &nCols,
     return false;
   }
 
-  //remove last data block
+  if ( pInfo.prefetchActive )
+  {
+    // consume the part fetched on a background thread during the previous call
+    QgsRasterBlock *prefetched = pInfo.prefetchFuture.result();
+    pInfo.prefetchActive = false;
+
+    nCols = pInfo.prefetchCols;
+    nRows = pInfo.prefetchRows;
+    topLeftCol = pInfo.prefetchTopLeftCol;
+    topLeftRow = pInfo.prefetchTopLeftRow;
+    if ( blockExtent )
+      *blockExtent = pInfo.prefetchExtent;
+
+    if ( block )
+      block->reset( prefetched );
+    else
+      delete prefetched;
+
+    if ( mPrefetchEnabled && block )
+      startPrefetch( bandNumber, pInfo );
+
+    return true;
+  }
+
+  QgsRectangle blockRect;
+  if ( !calculateNextRasterPart( pInfo, nCols, nRows, topLeftCol, topLeftRow, blockRect ) )
+    return false;
+
+  if ( blockExtent )
+    *blockExtent = blockRect;
+
+  if ( block )
+    block->reset( mInput->block( bandNumber, blockRect, nCols, nRows, mFeedback ) );
 
+  if ( mPrefetchEnabled && block )
+    startPrefetch( bandNumber, pInfo );
+
+  return true;
+}
+
+bool QgsRasterIterator::calculateNextRasterPart( RasterPartInfo &pInfo, int &nCols, int &nRows, int &topLeftCol, int &topLeftRow, QgsRectangle &blockExtent ) const
+{
   //already at end
   if ( pInfo.currentCol == pInfo.nCols && pInfo.currentRow == pInfo.nRows )
   {
@@ -121,13 +171,8 @@ bool QgsRasterIterator::readNextRasterPartInternal( int bandNumber, int &nCols,
   double ymin = pInfo.currentRow + nRows == pInfo.nRows ? viewPortExtent.yMinimum() :  // avoid extra FP math if not necessary
                 viewPortExtent.yMaximum() - ( pInfo.currentRow + nRows ) / static_cast< double >( pInfo.nRows ) * viewPortExtent.height();
   double ymax = viewPortExtent.yMaximum() - pInfo.currentRow / static_cast< double >( pInfo.nRows ) * viewPortExtent.height();
-  QgsRectangle blockRect( xmin, ymin, xmax, ymax );
-
-  if ( blockExtent )
-    *blockExtent = blockRect;
+  blockExtent = QgsRectangle( xmin, ymin, xmax, ymax );
 
-  if ( block )
-    block->reset( mInput->block( bandNumber, blockRect, nCols, nRows, mFeedback ) );
   topLeftCol = pInfo.currentCol;
   topLeftRow = pInfo.currentRow;
 
@@ -145,6 +190,25 @@ bool QgsRasterIterator::readNextRasterPartInternal( int bandNumber, int &nCols,
   return true;
 }
 
+void QgsRasterIterator::startPrefetch( int bandNumber, RasterPartInfo &pInfo )
+{
+  QgsRectangle blockRect;
+  if ( !calculateNextRasterPart( pInfo, pInfo.prefetchCols, pInfo.prefetchRows, pInfo.prefetchTopLeftCol, pInfo.prefetchTopLeftRow, blockRect ) )
+    return;
+
+  pInfo.prefetchExtent = blockRect;
+  pInfo.prefetchActive = true;
+
+  QgsRasterInterface *input = mInput;
+  QgsRasterBlockFeedback *feedback = mFeedback;
+  const int nCols = pInfo.prefetchCols;
+  const int nRows = pInfo.prefetchRows;
+  pInfo.prefetchFuture = QtConcurrent::run( [input, bandNumber, blockRect, nCols, nRows, feedback]() -> QgsRasterBlock *
+  {
+    return input->block( bandNumber, blockRect, nCols, nRows, feedback );
+  } );
+}
+
 void QgsRasterIterator::stopRasterRead( int bandNumber )
 {
   removePartInfo( bandNumber );
@@ -152,9 +216,13 @@ void QgsRasterIterator::stopRasterRead( int bandNumber )
 
 void QgsRasterIterator::removePartInfo( int bandNumber )
 {
-  auto partIt = mRasterPartInfos.constFind( bandNumber );
-  if ( partIt != mRasterPartInfos.constEnd() )
+  auto partIt = mRasterPartInfos.find( bandNumber );
+  if ( partIt != mRasterPartInfos.end() )
   {
+    // make sure any pending background fetch has finished before dropping the part,
+    // as it may still be accessing the input interface and feedback object
+    if ( partIt.value().prefetchActive )
+      delete partIt.value().prefetchFuture.result();
     mRasterPartInfos.remove( bandNumber );
   }
 }
@@ -18,6 +18,7 @@
 #include "qgis_core.h"
 #include "qgsrectangle.h"
 #include "qgis_sip.h"
+#include <QFuture>
 #include <QMap>
 
 class QgsMapToPixel;
@@ -40,6 +41,8 @@ class CORE_EXPORT QgsRasterIterator
      */
     QgsRasterIterator( QgsRasterInterface *input );
 
+    ~QgsRasterIterator();
+
     /**
      * Start reading of raster band. Raster data can then be retrieved by calling readNextRasterPart until it returns FALSE.
      * \param bandNumber number of raster band to read
@@ -144,6 +147,27 @@ class CORE_EXPORT QgsRasterIterator
      */
     int maximumTileHeight() const { return mMaximumTileHeight; }
 
+    /**
+     * Sets whether the iterator prefetches the next part from the input on a
+     * background thread while the caller is still processing the current one, so
+     * that decode and I/O latency overlaps with downstream processing.
+     *
+     * \warning While prefetching is enabled, callers must not access the input
+     * raster interface between calls to readNextRasterPart().
+     *
+     * \see prefetchEnabled()
+     * \since QGIS 3.8
+     */
+    void setPrefetchEnabled( bool enabled ) { mPrefetchEnabled = enabled; }
+
+    /**
+     * Returns TRUE if the next part is prefetched on a background thread while the
+     * current one is being processed.
+     * \see setPrefetchEnabled()
+     * \since QGIS 3.8
+     */
+    bool prefetchEnabled() const { return mPrefetchEnabled; }
+
     //! Default maximum tile width
     static const int DEFAULT_MAXIMUM_TILE_WIDTH = 2000;
 
@@ -158,6 +182,17 @@ class CORE_EXPORT QgsRasterIterator
       int currentRow;
       int nCols;
       int nRows;
+
+      //! TRUE if a background fetch of the next part has been started
+      bool prefetchActive = false;
+      //! Geometry of the part being prefetched
+      int prefetchCols = 0;
+      int prefetchRows = 0;
+      int prefetchTopLeftCol = 0;
+      int prefetchTopLeftRow = 0;
+      QgsRectangle prefetchExtent;
+      //! Pending background fetch, only valid while prefetchActive is TRUE
+      QFuture< QgsRasterBlock * > prefetchFuture;
     };
 
     QgsRasterInterface *mInput = nullptr;
@@ -168,9 +203,17 @@ class CORE_EXPORT QgsRasterIterator
     int mMaximumTileWidth;
     int mMaximumTileHeight;
 
+    bool mPrefetchEnabled = false;
+
     //! Remove part into and release memory
     void removePartInfo( int bandNumber );
     bool readNextRasterPartInternal( int bandNumber, int &nCols, int &nRows, std::unique_ptr<QgsRasterBlock> *block, int &topLeftCol, int &topLeftRow, QgsRectangle *blockExtent );
+
+    //! Calculates the geometry of the next part and advances the iterator, returns FALSE at the end of the raster
+    bool calculateNextRasterPart( RasterPartInfo &pInfo, int &nCols, int &nRows, int &topLeftCol, int &topLeftRow, QgsRectangle &blockExtent ) const;
+
+    //! Starts a background fetch of the next part, if any
+    void startPrefetch( int bandNumber, RasterPartInfo &pInfo );
 };
 
 #endif // QGSRASTERITERATOR_H
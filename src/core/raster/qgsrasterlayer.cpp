@@ -1487,6 +1487,16 @@ bool QgsRasterLayer::writeSld( QDomNode &node, QDomDocument &doc, QString &error
 }
 
 
+//! Serialized form of a raster renderer, used to detect writes which do not change the definition
+static QString _rendererDefinition( const QgsRasterRenderer *renderer )
+{
+  QDomDocument doc;
+  QDomElement elem = doc.createElement( QStringLiteral( "pipe" ) );
+  renderer->writeXml( doc, elem );
+  doc.appendChild( elem );
+  return doc.toString( 0 );
+}
+
 void QgsRasterLayer::setRenderer( QgsRasterRenderer *renderer )
 {
   QgsDebugMsgLevel( QStringLiteral( "Entered" ), 4 );
@@ -1495,6 +1505,17 @@ void QgsRasterLayer::setRenderer( QgsRasterRenderer *renderer )
     return;
   }
 
+  // re-applying an unchanged renderer must not cascade cache invalidation and
+  // full redraws through every connected canvas. The passed renderer is still
+  // installed into the pipe so that callers keeping the raw pointer remain
+  // valid - only the signals are skipped
+  if ( this->renderer() && renderer != this->renderer()
+       && _rendererDefinition( renderer ) == _rendererDefinition( this->renderer() ) )
+  {
+    mPipe.set( renderer );
+    return;
+  }
+
   mPipe.set( renderer );
   emit rendererChanged();
   emit styleChanged();
@@ -1745,6 +1766,15 @@ bool QgsRasterLayer::readXml( const QDomNode &layer_node, QgsReadWriteContext &c
     // <<< BACKWARD COMPATIBILITY < 1.9
   }
 
+  if ( mReadFlags & QgsMapLayer::FlagDontResolveLayers )
+  {
+    // provider resolution was deferred -- the symbology and other provider
+    // dependent state are restored from originalXmlProperties() once the
+    // data source is set
+    readStyleManager( layer_node );
+    return true;
+  }
+
   QgsDataProvider::ProviderOptions providerOptions;
   setDataProvider( mProviderKey, providerOptions );
 
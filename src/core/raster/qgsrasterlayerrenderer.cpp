@@ -24,6 +24,7 @@
 #include "qgsrendercontext.h"
 #include "qgsproject.h"
 #include "qgsexception.h"
+#include "qgstraceprofiler.h"
 
 
 ///@cond PRIVATE
@@ -243,6 +244,8 @@ QgsRasterLayerRenderer::~QgsRasterLayerRenderer()
 
 bool QgsRasterLayerRenderer::render()
 {
+  QGS_TRACE_ZONE( "raster layer render" );
+
   if ( !mRasterViewPort )
     return true; // outside of layer extent - nothing to do
 
@@ -18,6 +18,49 @@
 #include "qgsrasterdataprovider.h"
 #include "qgsrasternuller.h"
 
+namespace
+{
+
+  //! Applies the user no data ranges to one block, with the data type resolved once per block
+  struct NullerVisitor
+  {
+    const QgsRasterBlock *inputBlock = nullptr;
+    QgsRasterBlock *outputBlock = nullptr;
+    QgsRasterRangeList noDataRanges;
+
+    template <typename T>
+    void operator()( const T *data, qgssize count )
+    {
+      const bool hasInputNoDataValue = inputBlock->hasNoDataValue();
+      const double inputNoDataValue = inputBlock->noDataValue();
+      const bool checkInputBitmap = !hasInputNoDataValue && inputBlock->hasNoData();
+      const bool hasOutputNoDataValue = outputBlock->hasNoDataValue();
+      const double outputNoDataValue = outputBlock->noDataValue();
+      T *output = reinterpret_cast< T * >( outputBlock->bits() );
+
+      for ( qgssize i = 0; i < count; i++ )
+      {
+        const double value = static_cast< double >( data[i] );
+        bool isNoData = hasInputNoDataValue && ( std::isnan( value ) || qgsDoubleNear( value, inputNoDataValue ) );
+        if ( checkInputBitmap && inputBlock->isNoData( i ) )
+          isNoData = true;
+        if ( QgsRasterRange::contains( value, noDataRanges ) )
+          isNoData = true;
+
+        output[i] = data[i];
+        if ( isNoData )
+        {
+          if ( hasOutputNoDataValue )
+            output[i] = static_cast< T >( outputNoDataValue );
+          else
+            outputBlock->setIsNoData( i );
+        }
+      }
+    }
+  };
+
+}
+
 QgsRasterNuller::QgsRasterNuller( QgsRasterInterface *input )
   : QgsRasterInterface( input )
 {
@@ -100,25 +143,32 @@ QgsRasterBlock *QgsRasterNuller::block( int bandNo, QgsRectangle  const &extent,
     outputBlock->setNoDataValue( noDataValue );
   }
 
-  bool isNoData = false;
-  for ( int i = 0; i < height; i++ )
+  NullerVisitor visitor;
+  visitor.inputBlock = inputBlock.get();
+  visitor.outputBlock = outputBlock.get();
+  visitor.noDataRanges = mNoData.value( bandNo - 1 );
+
+  const QgsRasterBlock *constInputBlock = inputBlock.get();
+  if ( !constInputBlock->typedDispatch( visitor ) )
   {
-    for ( int j = 0; j < width; j++ )
+    // complex types cannot be dispatched to a typed loop, fall back to the
+    // generic per-pixel accessors
+    bool isNoData = false;
+    for ( int i = 0; i < height; i++ )
     {
-      double value = inputBlock->valueAndNoData( i, j, isNoData );
-
-      if ( QgsRasterRange::contains( value, mNoData.value( bandNo - 1 ) ) )
-      {
-        isNoData = true;
-      }
-      outputBlock->setValue( i, j, inputBlock->value( i, j ) );
-      if ( isNoData )
-      {
-        outputBlock->setIsNoData( i, j );
-      }
-      else
+      for ( int j = 0; j < width; j++ )
       {
+        double value = inputBlock->valueAndNoData( i, j, isNoData );
+
+        if ( QgsRasterRange::contains( value, mNoData.value( bandNo - 1 ) ) )
+        {
+          isNoData = true;
+        }
         outputBlock->setValue( i, j, value );
+        if ( isNoData )
+        {
+          outputBlock->setIsNoData( i, j );
+        }
       }
     }
   }
@@ -494,16 +494,22 @@ bool ProjectorData::approximateSrcRowCol( int destRow, int destCol, int *srcRow,
     nextHelper();
   }
 
-  double myDestY = mDestExtent.yMaximum() - ( destRow + 0.5 ) * mDestYRes;
-
   // See the schema in javax.media.jai.WarpGrid doc (but up side down)
-  // TODO: use some kind of cache of values which can be reused
-  double myDestXMin, myDestYMin, myDestXMax, myDestYMax;
+  // The vertical interpolation fraction only depends on the destination row,
+  // so it is cached and recomputed just once per row instead of per pixel
+  if ( destRow != mYFracRow )
+  {
+    double myDestY = mDestExtent.yMaximum() - ( destRow + 0.5 ) * mDestYRes;
 
-  destPointOnCPMatrix( myMatrixRow + 1, myMatrixCol, &myDestXMin, &myDestYMin );
-  destPointOnCPMatrix( myMatrixRow, myMatrixCol + 1, &myDestXMax, &myDestYMax );
+    double myDestXMin, myDestYMin, myDestXMax, myDestYMax;
 
-  double yfrac = ( myDestY - myDestYMin ) / ( myDestYMax - myDestYMin );
+    destPointOnCPMatrix( myMatrixRow + 1, myMatrixCol, &myDestXMin, &myDestYMin );
+    destPointOnCPMatrix( myMatrixRow, myMatrixCol + 1, &myDestXMax, &myDestYMax );
+
+    mYFrac = ( myDestY - myDestYMin ) / ( myDestYMax - myDestYMin );
+    mYFracRow = destRow;
+  }
+  double yfrac = mYFrac;
 
   QgsPointXY &myTop = pHelperTop[destCol];
   QgsPointXY &myBot = pHelperBottom[destCol];
@@ -519,7 +525,10 @@ bool ProjectorData::approximateSrcRowCol( int destRow, int destCol, int *srcRow,
   double mySrcX = bx + ( tx - bx ) * yfrac;
   double mySrcY = by + ( ty - by ) * yfrac;
 
-  if ( !mExtent.contains( QgsPointXY( mySrcX, mySrcY ) ) )
+  // direct comparison instead of QgsRectangle::contains() avoids constructing
+  // a temporary QgsPointXY for every destination pixel
+  if ( mySrcX < mExtent.xMinimum() || mySrcX > mExtent.xMaximum()
+       || mySrcY < mExtent.yMinimum() || mySrcY > mExtent.yMaximum() )
   {
     return false;
   }
@@ -610,9 +619,44 @@ void ProjectorData::calcCP( int row, int col, const QgsCoordinateTransform &ct )
 bool ProjectorData::calcRow( int row, const QgsCoordinateTransform &ct )
 {
   QgsDebugMsgLevel( QStringLiteral( "theRow = %1" ).arg( row ), 3 );
+
+  if ( !ct.isValid() )
+  {
+    for ( int i = 0; i < mCPCols; i++ )
+    {
+      mCPLegalMatrix[row][i] = false;
+    }
+    return true;
+  }
+
+  // transform the whole row in a single call - this saves one call into the
+  // projection library per control point, which dominates matrix construction
+  // for dense grids
+  QVector<double> x( mCPCols );
+  QVector<double> y( mCPCols );
+  QVector<double> z( mCPCols, 0.0 );
   for ( int i = 0; i < mCPCols; i++ )
   {
-    calcCP( row, i, ct );
+    destPointOnCPMatrix( row, i, &x[i], &y[i] );
+  }
+  try
+  {
+    ct.transformCoords( mCPCols, x.data(), y.data(), z.data() );
+  }
+  catch ( QgsCsException & )
+  {
+    // fall back to transforming the control points one by one, so that a
+    // single failing point does not invalidate the whole row
+    for ( int i = 0; i < mCPCols; i++ )
+    {
+      calcCP( row, i, ct );
+    }
+    return true;
+  }
+  for ( int i = 0; i < mCPCols; i++ )
+  {
+    mCPMatrix[row][i] = QgsPointXY( x[i], y[i] );
+    mCPLegalMatrix[row][i] = true;
   }
 
   return true;
@@ -621,9 +665,40 @@ bool ProjectorData::calcRow( int row, const QgsCoordinateTransform &ct )
 bool ProjectorData::calcCol( int col, const QgsCoordinateTransform &ct )
 {
   QgsDebugMsgLevel( QStringLiteral( "theCol = %1" ).arg( col ), 3 );
+
+  if ( !ct.isValid() )
+  {
+    for ( int i = 0; i < mCPRows; i++ )
+    {
+      mCPLegalMatrix[i][col] = false;
+    }
+    return true;
+  }
+
+  // see calcRow() - transform the whole column in a single call
+  QVector<double> x( mCPRows );
+  QVector<double> y( mCPRows );
+  QVector<double> z( mCPRows, 0.0 );
+  for ( int i = 0; i < mCPRows; i++ )
+  {
+    destPointOnCPMatrix( i, col, &x[i], &y[i] );
+  }
+  try
+  {
+    ct.transformCoords( mCPRows, x.data(), y.data(), z.data() );
+  }
+  catch ( QgsCsException & )
+  {
+    for ( int i = 0; i < mCPRows; i++ )
+    {
+      calcCP( i, col, ct );
+    }
+    return true;
+  }
   for ( int i = 0; i < mCPRows; i++ )
   {
-    calcCP( i, col, ct );
+    mCPMatrix[i][col] = QgsPointXY( x[i], y[i] );
+    mCPLegalMatrix[i][col] = true;
   }
 
   return true;
@@ -636,39 +711,54 @@ bool ProjectorData::checkCols( const QgsCoordinateTransform &ct )
     return false;
   }
 
+  // batch the verification points and transform them back in a single call -
+  // this check runs for every refinement iteration of the matrix
+  QVector<double> x;
+  QVector<double> y;
+  QVector<double> z;
+  QVector<QgsPointXY> destPoints;
+  const int pointCount = mCPCols * ( ( mCPRows - 1 ) / 2 );
+  x.reserve( pointCount );
+  y.reserve( pointCount );
+  z.reserve( pointCount );
+  destPoints.reserve( pointCount );
   for ( int c = 0; c < mCPCols; c++ )
   {
     for ( int r = 1; r < mCPRows - 1; r += 2 )
     {
-      double myDestX, myDestY;
-      destPointOnCPMatrix( r, c, &myDestX, &myDestY );
-      QgsPointXY myDestPoint( myDestX, myDestY );
-
-      QgsPointXY mySrcPoint1 = mCPMatrix[r - 1][c];
-      QgsPointXY mySrcPoint2 = mCPMatrix[r][c];
-      QgsPointXY mySrcPoint3 = mCPMatrix[r + 1][c];
-
-      QgsPointXY mySrcApprox( ( mySrcPoint1.x() + mySrcPoint3.x() ) / 2, ( mySrcPoint1.y() + mySrcPoint3.y() ) / 2 );
       if ( !mCPLegalMatrix[r - 1][c] || !mCPLegalMatrix[r][c] || !mCPLegalMatrix[r + 1][c] )
       {
         // There was an error earlier in transform, just abort
         return false;
       }
-      try
-      {
-        QgsPointXY myDestApprox = ct.transform( mySrcApprox, QgsCoordinateTransform::ReverseTransform );
-        double mySqrDist = myDestApprox.sqrDist( myDestPoint );
-        if ( mySqrDist > mSqrTolerance )
-        {
-          return false;
-        }
-      }
-      catch ( QgsCsException &e )
-      {
-        Q_UNUSED( e );
-        // Caught an error in transform
-        return false;
-      }
+
+      double myDestX, myDestY;
+      destPointOnCPMatrix( r, c, &myDestX, &myDestY );
+      destPoints.append( QgsPointXY( myDestX, myDestY ) );
+
+      QgsPointXY mySrcPoint1 = mCPMatrix[r - 1][c];
+      QgsPointXY mySrcPoint3 = mCPMatrix[r + 1][c];
+      x.append( ( mySrcPoint1.x() + mySrcPoint3.x() ) / 2 );
+      y.append( ( mySrcPoint1.y() + mySrcPoint3.y() ) / 2 );
+      z.append( 0.0 );
+    }
+  }
+  try
+  {
+    ct.transformCoords( x.size(), x.data(), y.data(), z.data(), QgsCoordinateTransform::ReverseTransform );
+  }
+  catch ( QgsCsException &e )
+  {
+    Q_UNUSED( e );
+    // Caught an error in transform
+    return false;
+  }
+  for ( int i = 0; i < x.size(); i++ )
+  {
+    double mySqrDist = destPoints.at( i ).sqrDist( x.at( i ), y.at( i ) );
+    if ( mySqrDist > mSqrTolerance )
+    {
+      return false;
     }
   }
   return true;
@@ -681,39 +771,53 @@ bool ProjectorData::checkRows( const QgsCoordinateTransform &ct )
     return false;
   }
 
+  // see checkCols() - batch the verification points into a single call
+  QVector<double> x;
+  QVector<double> y;
+  QVector<double> z;
+  QVector<QgsPointXY> destPoints;
+  const int pointCount = mCPRows * ( ( mCPCols - 1 ) / 2 );
+  x.reserve( pointCount );
+  y.reserve( pointCount );
+  z.reserve( pointCount );
+  destPoints.reserve( pointCount );
   for ( int r = 0; r < mCPRows; r++ )
   {
     for ( int c = 1; c < mCPCols - 1; c += 2 )
     {
-      double myDestX, myDestY;
-      destPointOnCPMatrix( r, c, &myDestX, &myDestY );
-
-      QgsPointXY myDestPoint( myDestX, myDestY );
-      QgsPointXY mySrcPoint1 = mCPMatrix[r][c - 1];
-      QgsPointXY mySrcPoint2 = mCPMatrix[r][c];
-      QgsPointXY mySrcPoint3 = mCPMatrix[r][c + 1];
-
-      QgsPointXY mySrcApprox( ( mySrcPoint1.x() + mySrcPoint3.x() ) / 2, ( mySrcPoint1.y() + mySrcPoint3.y() ) / 2 );
       if ( !mCPLegalMatrix[r][c - 1] || !mCPLegalMatrix[r][c] || !mCPLegalMatrix[r][c + 1] )
       {
         // There was an error earlier in transform, just abort
         return false;
       }
-      try
-      {
-        QgsPointXY myDestApprox = ct.transform( mySrcApprox, QgsCoordinateTransform::ReverseTransform );
-        double mySqrDist = myDestApprox.sqrDist( myDestPoint );
-        if ( mySqrDist > mSqrTolerance )
-        {
-          return false;
-        }
-      }
-      catch ( QgsCsException &e )
-      {
-        Q_UNUSED( e );
-        // Caught an error in transform
-        return false;
-      }
+
+      double myDestX, myDestY;
+      destPointOnCPMatrix( r, c, &myDestX, &myDestY );
+      destPoints.append( QgsPointXY( myDestX, myDestY ) );
+
+      QgsPointXY mySrcPoint1 = mCPMatrix[r][c - 1];
+      QgsPointXY mySrcPoint3 = mCPMatrix[r][c + 1];
+      x.append( ( mySrcPoint1.x() + mySrcPoint3.x() ) / 2 );
+      y.append( ( mySrcPoint1.y() + mySrcPoint3.y() ) / 2 );
+      z.append( 0.0 );
+    }
+  }
+  try
+  {
+    ct.transformCoords( x.size(), x.data(), y.data(), z.data(), QgsCoordinateTransform::ReverseTransform );
+  }
+  catch ( QgsCsException &e )
+  {
+    Q_UNUSED( e );
+    // Caught an error in transform
+    return false;
+  }
+  for ( int i = 0; i < x.size(); i++ )
+  {
+    double mySqrDist = destPoints.at( i ).sqrDist( x.at( i ), y.at( i ) );
+    if ( mySqrDist > mSqrTolerance )
+    {
+      return false;
     }
   }
   return true;
@@ -781,12 +885,20 @@ QgsRasterBlock *QgsRasterProjector::block( int bandNo, QgsRectangle  const &exte
   {
     outputBlock->setNoDataValue( inputBlock->noDataValue() );
   }
+
   if ( !outputBlock->isValid() )
   {
     QgsDebugMsg( QStringLiteral( "Cannot create block" ) );
     return outputBlock.release();
   }
 
+  if ( inputBlock->isEntirelyNoData() )
+  {
+    // the whole source region is nodata -- no need to run the per-pixel reprojection loop
+    outputBlock->setIsNoData();
+    return outputBlock.release();
+  }
+
   // set output to no data, it should be fast
   outputBlock->setIsNoData();
 
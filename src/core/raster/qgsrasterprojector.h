@@ -266,6 +266,12 @@ class ProjectorData
     //! Current mHelperTop matrix row
     int mHelperTopRow;
 
+    //! Destination row for which mYFrac is valid, or -1 if not yet calculated
+    int mYFracRow = -1;
+
+    //! Cached vertical interpolation fraction for destination row mYFracRow
+    double mYFrac = 0.0;
+
     //! Number of mCPMatrix columns
     int mCPCols;
     //! Number of mCPMatrix rows
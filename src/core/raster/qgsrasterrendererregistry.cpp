@@ -17,6 +17,7 @@
 
 #include "qgsrasterrendererregistry.h"
 #include "qgsrasterdataprovider.h"
+#include "qgsrasterlayer.h"
 #include "qgsrastershader.h"
 #include "qgsrastertransparency.h"
 #include "qgsmultibandcolorrenderer.h"
@@ -209,7 +210,9 @@ bool QgsRasterRendererRegistry::minMaxValuesForBand( int band, QgsRasterDataProv
   QgsSettings s;
   if ( s.value( QStringLiteral( "/Raster/useStandardDeviation" ), false ).toBool() )
   {
-    QgsRasterBandStats stats = provider->bandStatistics( band, QgsRasterBandStats::Mean | QgsRasterBandStats::StdDev );
+    // a sample is sufficient for a default contrast stretch, and lets the
+    // provider read from overviews instead of scanning the full resolution data
+    QgsRasterBandStats stats = provider->bandStatistics( band, QgsRasterBandStats::Mean | QgsRasterBandStats::StdDev, QgsRectangle(), QgsRasterLayer::SAMPLE_SIZE );
 
     double stdDevFactor = s.value( QStringLiteral( "/Raster/defaultStandardDeviation" ), 2.0 ).toDouble();
     double diff = stdDevFactor * stats.stdDev;
@@ -218,7 +221,7 @@ bool QgsRasterRendererRegistry::minMaxValuesForBand( int band, QgsRasterDataProv
   }
   else
   {
-    QgsRasterBandStats stats = provider->bandStatistics( band, QgsRasterBandStats::Min | QgsRasterBandStats::Max );
+    QgsRasterBandStats stats = provider->bandStatistics( band, QgsRasterBandStats::Min | QgsRasterBandStats::Max, QgsRectangle(), QgsRasterLayer::SAMPLE_SIZE );
     minValue = stats.minimumValue;
     maxValue = stats.maximumValue;
   }
@@ -19,6 +19,7 @@
 #include "qgscontrastenhancement.h"
 #include "qgsrastertransparency.h"
 #include <QDomDocument>
+#include <QtConcurrentMap>
 #include <QDomElement>
 #include <QImage>
 #include <QColor>
@@ -95,6 +96,14 @@ QgsRasterBlock *QgsSingleBandGrayRenderer::block( int bandNo, const QgsRectangle
     return outputBlock.release();
   }
 
+  if ( inputBlock->isEntirelyNoData() )
+  {
+    // the whole block is nodata -- emit a transparent block without running the color loop
+    if ( outputBlock->reset( Qgis::ARGB32_Premultiplied, width, height ) )
+      outputBlock->setIsNoData();
+    return outputBlock.release();
+  }
+
   std::shared_ptr< QgsRasterBlock > alphaBlock;
 
   if ( mAlphaBand > 0 && mGrayBand != mAlphaBand )
@@ -117,51 +126,69 @@ QgsRasterBlock *QgsSingleBandGrayRenderer::block( int bandNo, const QgsRectangle
   }
 
   QRgb myDefaultColor = NODATA_COLOR;
-  bool isNoData = false;
-  for ( qgssize i = 0; i < ( qgssize )width * height; i++ )
-  {
-    double grayVal = inputBlock->valueAndNoData( i, isNoData );
 
-    if ( isNoData )
-    {
-      outputBlock->setColor( i, myDefaultColor );
-      continue;
-    }
+  // force any lookup table to be built up front -- enhanceContrast()
+  // generates it lazily, which would race between the worker threads below
+  if ( mContrastEnhancement )
+    mContrastEnhancement->enhanceContrast( mContrastEnhancement->minimumValue() );
 
-    double currentAlpha = mOpacity;
-    if ( mRasterTransparency )
-    {
-      currentAlpha = mRasterTransparency->alphaValue( grayVal, mOpacity * 255 ) / 255.0;
-    }
-    if ( mAlphaBand > 0 )
+  QgsRasterBlock *output = outputBlock.get();
+  const auto renderPixelRange = [this, output, inputBlock, alphaBlock, myDefaultColor]( const QPair<qgssize, qgssize> &range )
+  {
+    bool isNoData = false;
+    for ( qgssize i = range.first; i < range.second; i++ )
     {
-      currentAlpha *= alphaBlock->value( i ) / 255.0;
-    }
+      double grayVal = inputBlock->valueAndNoData( i, isNoData );
 
-    if ( mContrastEnhancement )
-    {
-      if ( !mContrastEnhancement->isValueInDisplayableRange( grayVal ) )
+      if ( isNoData )
       {
-        outputBlock->setColor( i, myDefaultColor );
+        output->setColor( i, myDefaultColor );
         continue;
       }
-      grayVal = mContrastEnhancement->enhanceContrast( grayVal );
-    }
 
-    if ( mGradient == WhiteToBlack )
-    {
-      grayVal = 255 - grayVal;
-    }
+      double currentAlpha = mOpacity;
+      if ( mRasterTransparency )
+      {
+        currentAlpha = mRasterTransparency->alphaValue( grayVal, mOpacity * 255 ) / 255.0;
+      }
+      if ( mAlphaBand > 0 )
+      {
+        currentAlpha *= alphaBlock->value( i ) / 255.0;
+      }
 
-    if ( qgsDoubleNear( currentAlpha, 1.0 ) )
-    {
-      outputBlock->setColor( i, qRgba( grayVal, grayVal, grayVal, 255 ) );
-    }
-    else
-    {
-      outputBlock->setColor( i, qRgba( currentAlpha * grayVal, currentAlpha * grayVal, currentAlpha * grayVal, currentAlpha * 255 ) );
+      if ( mContrastEnhancement )
+      {
+        if ( !mContrastEnhancement->isValueInDisplayableRange( grayVal ) )
+        {
+          output->setColor( i, myDefaultColor );
+          continue;
+        }
+        grayVal = mContrastEnhancement->enhanceContrast( grayVal );
+      }
+
+      if ( mGradient == WhiteToBlack )
+      {
+        grayVal = 255 - grayVal;
+      }
+
+      if ( qgsDoubleNear( currentAlpha, 1.0 ) )
+      {
+        output->setColor( i, qRgba( grayVal, grayVal, grayVal, 255 ) );
+      }
+      else
+      {
+        output->setColor( i, qRgba( currentAlpha * grayVal, currentAlpha * grayVal, currentAlpha * grayVal, currentAlpha * 255 ) );
+      }
     }
-  }
+  };
+
+  // spread contiguous row ranges over the worker threads, each writing
+  // disjoint output pixels
+  QVector< QPair< qgssize, qgssize > > ranges = QgsRasterBlock::splitIntoRowRanges( width, height );
+  if ( ranges.size() == 1 )
+    renderPixelRange( ranges.at( 0 ) );
+  else
+    QtConcurrent::blockingMap( ranges, renderPixelRange );
 
   return outputBlock.release();
 }
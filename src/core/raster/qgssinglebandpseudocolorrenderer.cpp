@@ -211,6 +211,14 @@ QgsRasterBlock *QgsSingleBandPseudoColorRenderer::block( int bandNo, QgsRectangl
     return outputBlock.release();
   }
 
+  if ( inputBlock->isEntirelyNoData() )
+  {
+    // the whole block is nodata -- emit a transparent block without running the shader
+    if ( outputBlock->reset( Qgis::ARGB32_Premultiplied, width, height ) )
+      outputBlock->setIsNoData();
+    return outputBlock.release();
+  }
+
   //rendering is faster without considering user-defined transparency
   bool hasTransparency = usesTransparency();
 
@@ -237,6 +245,17 @@ QgsRasterBlock *QgsSingleBandPseudoColorRenderer::block( int bandNo, QgsRectangl
   QRgb *outputBlockData = outputBlock->colorData();
   const QgsRasterShaderFunction *fcn = mShader->rasterShaderFunction();
 
+  // without transparency handling a color ramp shader can color the whole block
+  // in one call, which avoids the per-pixel virtual shade() call
+  if ( !hasTransparency )
+  {
+    if ( const QgsColorRampShader *rampShader = dynamic_cast<const QgsColorRampShader *>( fcn ) )
+    {
+      rampShader->shadeBlock( inputBlock.get(), outputBlockData, myDefaultColor );
+      return outputBlock.release();
+    }
+  }
+
   qgssize count = ( qgssize )width * height;
   bool isNoData = false;
   for ( qgssize i = 0; i < count; i++ )
@@ -267,6 +267,18 @@ void QgsSimpleFillSymbolLayer::renderPolygon( const QPolygonF &points, QList<QPo
     return;
   }
 
+  if ( mBatchRendering )
+  {
+    if ( !context.selected() && ( !rings || rings->isEmpty() ) )
+    {
+      mBatchPath.addPolygon( points );
+      return;
+    }
+    // features the batch cannot absorb are drawn immediately, so flush the
+    // pending batch first to preserve the draw order
+    flushFeatureBatch( p );
+  }
+
   applyDataDefinedSymbology( context, mBrush, mPen, mSelPen );
 
   p->setBrush( context.selected() ? mSelBrush : mBrush );
@@ -288,6 +300,49 @@ void QgsSimpleFillSymbolLayer::renderPolygon( const QPolygonF &points, QList<QPo
   }
 }
 
+bool QgsSimpleFillSymbolLayer::supportsFeatureBatching() const
+{
+  // merging features into one painter path changes the output for
+  // semi-transparent symbols, since overlapping features no longer composite
+  // on top of each other -- so only fully opaque fills may be batched
+  return !mDataDefinedProperties.hasActiveProperties()
+         && mOffset.isNull()
+         && ( mBrush.style() == Qt::NoBrush || ( mBrush.style() == Qt::SolidPattern && mBrush.color().alpha() == 255 ) )
+         && ( mPen.style() == Qt::NoPen || mPen.color().alpha() == 255 );
+}
+
+void QgsSimpleFillSymbolLayer::startFeatureBatch( QgsRenderContext &context )
+{
+  Q_UNUSED( context );
+  mBatchRendering = true;
+  mBatchPath = QPainterPath();
+  // the winding rule keeps overlapping features solid, unlike the default
+  // odd-even rule which would punch holes where features overlap
+  mBatchPath.setFillRule( Qt::WindingFill );
+}
+
+void QgsSimpleFillSymbolLayer::stopFeatureBatch( QgsRenderContext &context )
+{
+  if ( !mBatchRendering )
+    return;
+
+  flushFeatureBatch( context.painter() );
+  mBatchRendering = false;
+}
+
+void QgsSimpleFillSymbolLayer::flushFeatureBatch( QPainter *p )
+{
+  if ( mBatchPath.isEmpty() || !p )
+    return;
+
+  p->setBrush( mBrush );
+  p->setPen( mPen );
+  p->drawPath( mBatchPath );
+
+  mBatchPath = QPainterPath();
+  mBatchPath.setFillRule( Qt::WindingFill );
+}
+
 QgsStringMap QgsSimpleFillSymbolLayer::properties() const
 {
   QgsStringMap map;
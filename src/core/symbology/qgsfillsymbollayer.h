@@ -31,6 +31,7 @@
 
 #include <QPen>
 #include <QBrush>
+#include <QPainterPath>
 
 /**
  * \ingroup core
@@ -62,6 +63,10 @@ class CORE_EXPORT QgsSimpleFillSymbolLayer : public QgsFillSymbolLayer
 
     void renderPolygon( const QPolygonF &points, QList<QPolygonF> *rings, QgsSymbolRenderContext &context ) override;
 
+    bool supportsFeatureBatching() const override;
+    void startFeatureBatch( QgsRenderContext &context ) override;
+    void stopFeatureBatch( QgsRenderContext &context ) override;
+
     QgsStringMap properties() const override;
 
     QgsSimpleFillSymbolLayer *clone() const override SIP_FACTORY;
@@ -156,6 +161,14 @@ class CORE_EXPORT QgsSimpleFillSymbolLayer : public QgsFillSymbolLayer
     QgsUnitTypes::RenderUnit mOffsetUnit = QgsUnitTypes::RenderMillimeters;
     QgsMapUnitScale mOffsetMapUnitScale;
 
+    //! TRUE while a feature batch is being accumulated, see startFeatureBatch()
+    bool mBatchRendering = false;
+    //! Merged path of the batched features, drawn in one operation when the batch ends
+    QPainterPath mBatchPath;
+
+    //! Draws any pending batched features and resets the batch path
+    void flushFeatureBatch( QPainter *p );
+
   private:
     //helper functions for data defined symbology
     void applyDataDefinedSymbology( QgsSymbolRenderContext &context, QBrush &brush, QPen &pen, QPen &selPen );
@@ -485,6 +485,45 @@ bool QgsGraduatedSymbolRenderer::updateRangeRenderState( int rangeIndex, bool va
   return true;
 }
 
+QString QgsGraduatedSymbolRenderer::filter( const QgsFields &fields )
+{
+  if ( mRanges.isEmpty() )
+    return QString();
+
+  const int attrNum = fields.lookupField( mAttrName );
+  // classifying by an expression -- take the expression text as-is
+  const QString attrRef = attrNum >= 0 ? QgsExpression::quotedColumnRef( mAttrName ) : QStringLiteral( "(%1)" ).arg( mAttrName );
+
+  QStringList activeRanges;
+  bool hasInactiveRange = false;
+  for ( const QgsRendererRange &range : qgis::as_const( mRanges ) )
+  {
+    if ( !range.renderState() )
+    {
+      hasInactiveRange = true;
+      continue;
+    }
+
+    activeRanges << QStringLiteral( "(%1 >= %2 AND %1 <= %3)" ).arg( attrRef,
+                 qgsDoubleToString( range.lowerValue() ),
+                 qgsDoubleToString( range.upperValue() ) );
+  }
+
+  // with every class checked the ranges cover the classified data anyway, so
+  // skip the filter rather than making the provider evaluate it per feature
+  if ( !hasInactiveRange )
+    return QString();
+
+  if ( activeRanges.isEmpty() )
+    return QStringLiteral( "FALSE" );
+
+  // features whose value is NULL or outside every active range are never drawn,
+  // so they can be excluded provider side. overlapping ranges use first-match
+  // semantics in symbolForValue(), so this filter is a (safe) superset of the
+  // features which actually get a symbol
+  return activeRanges.join( QLatin1String( " OR " ) );
+}
+
 QString QgsGraduatedSymbolRenderer::dump() const
 {
   QString s = QStringLiteral( "GRADUATED: attr %1\n" ).arg( mAttrName );
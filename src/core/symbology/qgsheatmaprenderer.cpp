@@ -50,6 +50,21 @@ void QgsHeatmapRenderer::initializeValues( QgsRenderContext &context )
   mFeaturesRendered = 0;
   mRadiusPixels = std::round( context.convertToPainterUnits( mRadius, mRadiusUnit, mRadiusMapUnitScale ) / mRenderQuality );
   mRadiusSquared = mRadiusPixels * mRadiusPixels;
+
+  // precompute the kernel falloff for every pixel offset covered by the radius,
+  // so splatting a point degenerates to multiply-adds over contiguous rows which
+  // the compiler can vectorize, instead of a pow/sqrt evaluation per pixel
+  const int stampSize = 2 * mRadiusPixels;
+  mKernelStamp.resize( stampSize * stampSize );
+  double *stamp = mKernelStamp.data();
+  for ( int dy = -mRadiusPixels; dy < mRadiusPixels; ++dy )
+  {
+    for ( int dx = -mRadiusPixels; dx < mRadiusPixels; ++dx )
+    {
+      double distanceSquared = static_cast< double >( dx ) * dx + static_cast< double >( dy ) * dy;
+      *stamp++ = distanceSquared <= mRadiusSquared ? quarticKernel( std::sqrt( distanceSquared ), mRadiusPixels ) : 0.0;
+    }
+  }
 }
 
 void QgsHeatmapRenderer::startRender( QgsRenderContext &context, const QgsFields &fields )
@@ -140,34 +155,29 @@ bool QgsHeatmapRenderer::renderFeature( const QgsFeature &feature, QgsRenderCont
   //convert point to multipoint
   QgsMultiPointXY multiPoint = convertToMultipoint( &geom );
 
-  //loop through all points in multipoint
+  //loop through all points in multipoint, stamping the precomputed kernel onto the value grid
+  const int stampSize = 2 * mRadiusPixels;
   for ( QgsMultiPointXY::const_iterator pointIt = multiPoint.constBegin(); pointIt != multiPoint.constEnd(); ++pointIt )
   {
     QgsPointXY pixel = context.mapToPixel().transform( *pointIt );
     int pointX = pixel.x() / mRenderQuality;
     int pointY = pixel.y() / mRenderQuality;
-    for ( int x = std::max( pointX - mRadiusPixels, 0 ); x < std::min( pointX + mRadiusPixels, width ); ++x )
+    const int xMin = std::max( pointX - mRadiusPixels, 0 );
+    const int xMax = std::min( pointX + mRadiusPixels, width );
+    const int yMin = std::max( pointY - mRadiusPixels, 0 );
+    const int yMax = std::min( pointY + mRadiusPixels, height );
+    for ( int y = yMin; y < yMax; ++y )
     {
-      for ( int y = std::max( pointY - mRadiusPixels, 0 ); y < std::min( pointY + mRadiusPixels, height ); ++y )
+      const double *stampRow = mKernelStamp.constData() + ( y - pointY + mRadiusPixels ) * stampSize + ( xMin - pointX + mRadiusPixels );
+      double *valueRow = mValues.data() + y * width + xMin;
+      int rowLength = xMax - xMin;
+      //the value grid may hold slightly fewer cells than width * height because of
+      //integer rounding in initializeValues(), so clamp the last rows
+      if ( y * width + xMin + rowLength > mValues.count() )
+        rowLength = std::max( 0, mValues.count() - ( y * width + xMin ) );
+      for ( int i = 0; i < rowLength; ++i )
       {
-        int index = y * width + x;
-        if ( index >= mValues.count() )
-        {
-          continue;
-        }
-        double distanceSquared = std::pow( pointX - x, 2.0 ) + std::pow( pointY - y, 2.0 );
-        if ( distanceSquared > mRadiusSquared )
-        {
-          continue;
-        }
-
-        double score = weight * quarticKernel( std::sqrt( distanceSquared ), mRadiusPixels );
-        double value = mValues.at( index ) + score;
-        if ( value > mCalculatedMaxValue )
-        {
-          mCalculatedMaxValue = value;
-        }
-        mValues[ index ] = value;
+        valueRow[i] += weight * stampRow[i];
       }
     }
   }
@@ -231,11 +241,26 @@ void QgsHeatmapRenderer::renderImage( QgsRenderContext &context )
                 QImage::Format_ARGB32 );
   image.fill( Qt::transparent );
 
+  mCalculatedMaxValue = 0;
+  for ( int i = 0; i < mValues.count(); ++i )
+  {
+    if ( mValues.at( i ) > mCalculatedMaxValue )
+      mCalculatedMaxValue = mValues.at( i );
+  }
   double scaleMax = mExplicitMax > 0 ? mExplicitMax : mCalculatedMaxValue;
 
+  //evaluating the gradient ramp per pixel is expensive -- sample it once into a
+  //lookup table and index that with the scaled value instead
+  constexpr int RAMP_LUT_SIZE = 1024;
+  QVector< QRgb > rampLut;
+  rampLut.reserve( RAMP_LUT_SIZE );
+  for ( int i = 0; i < RAMP_LUT_SIZE; ++i )
+  {
+    rampLut << mGradientRamp->color( static_cast< double >( i ) / ( RAMP_LUT_SIZE - 1 ) ).rgba();
+  }
+
   int idx = 0;
   double pixVal = 0;
-  QColor pixColor;
   for ( int heightIndex = 0; heightIndex < image.height(); ++heightIndex )
   {
     QRgb *scanLine = reinterpret_cast< QRgb * >( image.scanLine( heightIndex ) );
@@ -244,10 +269,8 @@ void QgsHeatmapRenderer::renderImage( QgsRenderContext &context )
       //scale result to fit in the range [0, 1]
       pixVal = mValues.at( idx ) > 0 ? std::min( ( mValues.at( idx ) / scaleMax ), 1.0 ) : 0;
 
-      //convert value to color from ramp
-      pixColor = mGradientRamp->color( pixVal );
-
-      scanLine[widthIndex] = pixColor.rgba();
+      //convert value to color from the ramp lookup table
+      scanLine[widthIndex] = rampLut.at( static_cast< int >( pixVal * ( RAMP_LUT_SIZE - 1 ) + 0.5 ) );
       idx++;
     }
   }
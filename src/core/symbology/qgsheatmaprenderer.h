@@ -187,6 +187,8 @@ class CORE_EXPORT QgsHeatmapRenderer : public QgsFeatureRenderer
     double mRadius = 10;
     int mRadiusPixels = 0;
     double mRadiusSquared = 0;
+    //! Precomputed kernel falloff for every pixel offset covered by the radius
+    QVector<double> mKernelStamp;
     QgsUnitTypes::RenderUnit mRadiusUnit = QgsUnitTypes::RenderMillimeters;
     QgsMapUnitScale mRadiusMapUnitScale;
 
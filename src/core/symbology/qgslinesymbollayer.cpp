@@ -315,6 +315,18 @@ void QgsSimpleLineSymbolLayer::renderPolyline( const QPolygonF &points, QgsSymbo
     return;
   }
 
+  if ( mBatchRendering )
+  {
+    if ( !context.selected() )
+    {
+      mBatchPath.addPolygon( points );
+      return;
+    }
+    // features the batch cannot absorb are drawn immediately, so flush the
+    // pending batch first to preserve the draw order
+    flushFeatureBatch( p );
+  }
+
   double offset = mOffset;
   applyDataDefinedSymbology( context, mPen, mSelPen, offset );
 
@@ -366,6 +378,45 @@ void QgsSimpleLineSymbolLayer::renderPolyline( const QPolygonF &points, QgsSymbo
   }
 }
 
+bool QgsSimpleLineSymbolLayer::supportsFeatureBatching() const
+{
+  // merging features into one stroked path changes the output for
+  // semi-transparent pens, since overlapping strokes no longer composite on
+  // top of each other -- so only fully opaque lines may be batched
+  return !mDataDefinedProperties.hasActiveProperties()
+         && qgsDoubleNear( mOffset, 0 )
+         && !mDrawInsidePolygon
+         && ( mPen.style() == Qt::NoPen || mPen.color().alpha() == 255 );
+}
+
+void QgsSimpleLineSymbolLayer::startFeatureBatch( QgsRenderContext &context )
+{
+  Q_UNUSED( context );
+  mBatchRendering = true;
+  mBatchPath = QPainterPath();
+}
+
+void QgsSimpleLineSymbolLayer::stopFeatureBatch( QgsRenderContext &context )
+{
+  if ( !mBatchRendering )
+    return;
+
+  flushFeatureBatch( context.painter() );
+  mBatchRendering = false;
+}
+
+void QgsSimpleLineSymbolLayer::flushFeatureBatch( QPainter *p )
+{
+  if ( mBatchPath.isEmpty() || !p )
+    return;
+
+  p->setPen( mPen );
+  p->setBrush( Qt::NoBrush );
+  p->drawPath( mBatchPath );
+
+  mBatchPath = QPainterPath();
+}
+
 QgsStringMap QgsSimpleLineSymbolLayer::properties() const
 {
   QgsStringMap map;
@@ -20,6 +20,7 @@
 #include "qgis.h"
 #include "qgssymbollayer.h"
 
+#include <QPainterPath>
 #include <QPen>
 #include <QVector>
 
@@ -60,6 +61,10 @@ class CORE_EXPORT QgsSimpleLineSymbolLayer : public QgsLineSymbolLayer
     //overridden so that clip path can be set when using draw inside polygon option
     void renderPolygonStroke( const QPolygonF &points, QList<QPolygonF> *rings, QgsSymbolRenderContext &context ) override;
 
+    bool supportsFeatureBatching() const override;
+    void startFeatureBatch( QgsRenderContext &context ) override;
+    void stopFeatureBatch( QgsRenderContext &context ) override;
+
     QgsStringMap properties() const override;
 
     QgsSimpleLineSymbolLayer *clone() const override SIP_FACTORY;
@@ -155,6 +160,14 @@ class CORE_EXPORT QgsSimpleLineSymbolLayer : public QgsLineSymbolLayer
 
     bool mDrawInsidePolygon = false;
 
+    //! TRUE while a feature batch is being accumulated, see startFeatureBatch()
+    bool mBatchRendering = false;
+    //! Merged path of the batched features, stroked in one operation when the batch ends
+    QPainterPath mBatchPath;
+
+    //! Strokes any pending batched features and resets the batch path
+    void flushFeatureBatch( QPainter *p );
+
   private:
     //helper functions for data defined symbology
     void applyDataDefinedSymbology( QgsSymbolRenderContext &context, QPen &pen, QPen &selPen, double &offset );
@@ -1956,6 +1956,8 @@ void QgsSvgMarkerSymbolLayer::startRender( QgsSymbolRenderContext &context )
 void QgsSvgMarkerSymbolLayer::stopRender( QgsSymbolRenderContext &context )
 {
   Q_UNUSED( context );
+  mOpacityImage = QImage();
+  mOpacityImageKey.clear();
 }
 
 void QgsSvgMarkerSymbolLayer::renderPoint( QPointF point, QgsSymbolRenderContext &context )
@@ -2032,10 +2034,24 @@ void QgsSvgMarkerSymbolLayer::renderPoint( QPointF point, QgsSymbolRenderContext
       //consider transparency
       if ( !qgsDoubleNear( context.opacity(), 1.0 ) )
       {
-        QImage transparentImage = img.copy();
-        QgsSymbolLayerUtils::multiplyImageOpacity( &transparentImage, context.opacity() );
-        p->drawImage( -transparentImage.width() / 2.0, -transparentImage.height() / 2.0, transparentImage );
-        hwRatio = static_cast< double >( transparentImage.height() ) / static_cast< double >( transparentImage.width() );
+        // copying the image and multiplying its opacity is expensive, so the result is
+        // cached until any of the parameters it was built from change
+        const QString opacityImageKey = QStringLiteral( "%1|%2|%3|%4|%5|%6|%7" )
+                                        .arg( path )
+                                        .arg( size )
+                                        .arg( fillColor.name( QColor::HexArgb ),
+                                              strokeColor.name( QColor::HexArgb ) )
+                                        .arg( strokeWidth )
+                                        .arg( aspectRatio )
+                                        .arg( context.opacity() );
+        if ( opacityImageKey != mOpacityImageKey )
+        {
+          mOpacityImage = img.copy();
+          QgsSymbolLayerUtils::multiplyImageOpacity( &mOpacityImage, context.opacity() );
+          mOpacityImageKey = opacityImageKey;
+        }
+        p->drawImage( -mOpacityImage.width() / 2.0, -mOpacityImage.height() / 2.0, mOpacityImage );
+        hwRatio = static_cast< double >( mOpacityImage.height() ) / static_cast< double >( mOpacityImage.width() );
       }
       else
       {
@@ -633,6 +633,11 @@ class CORE_EXPORT QgsSvgMarkerSymbolLayer : public QgsMarkerSymbolLayer
     double calculateSize( QgsSymbolRenderContext &context, bool &hasDataDefinedSize ) const;
     void calculateOffsetAndRotation( QgsSymbolRenderContext &context, double scaledSize, QPointF &offset, double &angle ) const;
 
+    //! Cached copy of the marker image with the layer opacity premultiplied, to avoid re-copying it for every point
+    QImage mOpacityImage;
+    //! Marker parameters mOpacityImage was built from
+    QString mOpacityImageKey;
+
 };
 
 
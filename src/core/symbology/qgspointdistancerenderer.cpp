@@ -19,7 +19,6 @@
 #include "qgsgeometry.h"
 #include "qgssymbollayerutils.h"
 #include "qgsspatialindex.h"
-#include "qgsmultipoint.h"
 #include "qgslogger.h"
 
 #include <QDomElement>
@@ -89,9 +88,8 @@ bool QgsPointDistanceRenderer::renderFeature( const QgsFeature &feature, QgsRend
     transformedFeature.setGeometry( geom );
   }
 
-  double searchDistance = context.convertToMapUnits( mTolerance, mToleranceUnit, mToleranceMapUnitScale );
   QgsPointXY point = transformedFeature.geometry().asPoint();
-  QList<QgsFeatureId> intersectList = mSpatialIndex->intersects( searchRect( point, searchDistance ) );
+  QList<QgsFeatureId> intersectList = mSpatialIndex->intersects( searchRect( point, mSearchDistance ) );
   if ( intersectList.empty() )
   {
     mSpatialIndex->addFeature( transformedFeature );
@@ -138,15 +136,11 @@ bool QgsPointDistanceRenderer::renderFeature( const QgsFeature &feature, QgsRend
 
 void QgsPointDistanceRenderer::drawGroup( const ClusteredGroup &group, QgsRenderContext &context )
 {
-  //calculate centroid of all points, this will be center of group
-  QgsMultiPoint *groupMultiPoint = new QgsMultiPoint();
-  Q_FOREACH ( const GroupedFeature &f, group )
-  {
-    groupMultiPoint->addGeometry( f.feature.geometry().constGet()->clone() );
-  }
-  QgsGeometry groupGeom( groupMultiPoint );
-  QgsGeometry centroid = groupGeom.centroid();
-  QPointF pt = centroid.asQPointF();
+  // the group's centroid is maintained incrementally while clustering, so there's no
+  // need to build a temporary multipoint geometry here just to get the group's center.
+  // The group is keyed by the id of the first feature added to it.
+  QgsPointXY center = mGroupLocations.value( group.at( 0 ).feature.id() );
+  QPointF pt( center.x(), center.y() );
   context.mapToPixel().transformInPlace( pt.rx(), pt.ry() );
 
   context.expressionContext().appendScope( createGroupScope( group ) );
@@ -301,6 +295,10 @@ void QgsPointDistanceRenderer::startRender( QgsRenderContext &context, const Qgs
   mGroupLocations.clear();
   mSpatialIndex = new QgsSpatialIndex;
 
+  // the tolerance does not change during the render, so convert it once here
+  // instead of for every rendered feature
+  mSearchDistance = context.convertToMapUnits( mTolerance, mToleranceUnit, mToleranceMapUnitScale );
+
   if ( mLabelAttributeName.isEmpty() )
   {
     mLabelIndex = -1;
@@ -286,6 +286,9 @@ class CORE_EXPORT QgsPointDistanceRenderer: public QgsFeatureRenderer
      */
     virtual void drawGroup( QPointF centerPoint, QgsRenderContext &context, const ClusteredGroup &group ) = 0 SIP_FORCE;
 
+    //! Distance tolerance in map units, converted once per render in startRender().
+    double mSearchDistance = 0;
+
     //! Creates a search rectangle with specified distance tolerance.
     QgsRectangle searchRect( const QgsPointXY &p, double distance ) const;
 
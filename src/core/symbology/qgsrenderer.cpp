@@ -102,13 +102,21 @@ void QgsFeatureRenderer::startRender( QgsRenderContext &, const QgsFields & )
     Q_ASSERT_X( mThread == QThread::currentThread(), "QgsFeatureRenderer::startRender", "startRender called in a different thread - use a cloned renderer instead" );
   }
 #endif
+
+  mCurrentBatchSymbol = nullptr;
 }
 
-void QgsFeatureRenderer::stopRender( QgsRenderContext & )
+void QgsFeatureRenderer::stopRender( QgsRenderContext &context )
 {
 #ifdef QGISDEBUG
   Q_ASSERT_X( mThread == QThread::currentThread(), "QgsFeatureRenderer::stopRender", "stopRender called in a different thread - use a cloned renderer instead" );
 #endif
+
+  if ( mCurrentBatchSymbol )
+  {
+    mCurrentBatchSymbol->stopFeatureBatch( context );
+    mCurrentBatchSymbol = nullptr;
+  }
 }
 
 bool QgsFeatureRenderer::filterNeedsGeometry() const
@@ -132,6 +140,27 @@ bool QgsFeatureRenderer::renderFeature( const QgsFeature &feature, QgsRenderCont
 
 void QgsFeatureRenderer::renderFeatureWithSymbol( const QgsFeature &feature, QgsSymbol *symbol, QgsRenderContext &context, int layer, bool selected, bool drawVertexMarker )
 {
+  if ( drawVertexMarker )
+  {
+    // vertex markers paint immediately, so deferring the feature draws would
+    // paint the features over their own markers -- don't batch while editing
+    if ( mCurrentBatchSymbol )
+    {
+      mCurrentBatchSymbol->stopFeatureBatch( context );
+      mCurrentBatchSymbol = nullptr;
+    }
+  }
+  else if ( symbol != mCurrentBatchSymbol )
+  {
+    // consecutive features sharing a symbol are batched by the symbol's
+    // layers -- flush the previous symbol's batch before another symbol
+    // paints over it
+    if ( mCurrentBatchSymbol )
+      mCurrentBatchSymbol->stopFeatureBatch( context );
+    symbol->startFeatureBatch( context );
+    mCurrentBatchSymbol = symbol;
+  }
+
   symbol->renderFeature( feature, context, layer, selected, drawVertexMarker, mCurrentVertexMarkerType, mCurrentVertexMarkerSize );
 }
 
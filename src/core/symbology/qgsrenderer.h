@@ -538,6 +538,13 @@ class CORE_EXPORT QgsFeatureRenderer
     QThread *mThread = nullptr;
 #endif
 
+    /**
+     * Symbol currently accumulating a batch of consecutive features, flushed
+     * when a feature resolves to a different symbol or when rendering stops.
+     * See renderFeatureWithSymbol().
+     */
+    QgsSymbol *mCurrentBatchSymbol = nullptr;
+
     Q_DISABLE_COPY( QgsFeatureRenderer )
 };
 
@@ -374,6 +374,13 @@ void QgsRuleBasedRenderer::Rule::toSld( QDomDocument &doc, QDomElement &element,
 bool QgsRuleBasedRenderer::Rule::startRender( QgsRenderContext &context, const QgsFields &fields, QString &filter )
 {
   mActiveChildren.clear();
+  mScaleActive = false;
+
+  // the filter is still evaluated per feature when this rule is disabled or
+  // out of scale (it decides whether matching features are withheld from else
+  // rules), so prepare it regardless
+  if ( mFilter )
+    mFilter->prepare( &context.expressionContext() );
 
   if ( ! mIsActive )
     return false;
@@ -382,9 +389,9 @@ bool QgsRuleBasedRenderer::Rule::startRender( QgsRenderContext &context, const Q
   if ( !isScaleOK( context.rendererScale() ) )
     return false;
 
+  mScaleActive = true;
+
   // init this rule
-  if ( mFilter )
-    mFilter->prepare( &context.expressionContext() );
   if ( mSymbol )
     mSymbol->startRender( context, fields );
 
@@ -516,10 +523,19 @@ QgsRuleBasedRenderer::Rule::RenderResult QgsRuleBasedRenderer::Rule::renderFeatu
   if ( !isFilterOK( featToRender.feat, &context ) )
     return Filtered;
 
+  // a disabled or out-of-scale subtree can never queue a render job (no
+  // normalized z-levels were assigned below it), so only this rule's filter
+  // result matters: it decides whether the feature is withheld from else
+  // rules. Skip the per-feature walk of all the descendants.
+  if ( !mIsActive )
+    return Inactive;
+  if ( !mScaleActive )
+    return mSymbol ? Inactive : Filtered;
+
   bool rendered = false;
 
   // create job for this feature and this symbol, add to list of jobs
-  if ( mSymbol && mIsActive )
+  if ( mSymbol )
   {
     // add job to the queue: each symbol's zLevel must be added
     Q_FOREACH ( int normZLevel, mSymbolNormZLevels )
@@ -453,6 +453,8 @@ class CORE_EXPORT QgsRuleBasedRenderer : public QgsFeatureRenderer
         // temporary while rendering
         QSet<int> mSymbolNormZLevels;
         RuleList mActiveChildren;
+        //! Whether the rule passed the scale check at startRender(), allowing renderFeature() to skip its subtree
+        bool mScaleActive = false;
 
         /**
          * Check which child rules are else rules and update the internal list of else rules
@@ -15,6 +15,7 @@
 
 #include "qgsstyle.h"
 
+#include "qgis.h"
 #include "qgssymbol.h"
 #include "qgscolorramp.h"
 #include "qgssymbollayerregistry.h"
@@ -31,6 +32,8 @@
 #include <QTextStream>
 #include <QByteArray>
 
+#include <algorithm>
+
 #include <sqlite3.h>
 #include "qgssqliteutils.h"
 
@@ -81,6 +84,8 @@ void QgsStyle::clear()
 
   mSymbols.clear();
   mColorRamps.clear();
+  mDeferredSymbols.clear();
+  mDeferredRamps.clear();
   mCachedColorRampTags.clear();
   mCachedSymbolTags.clear();
 }
@@ -90,6 +95,11 @@ bool QgsStyle::addSymbol( const QString &name, QgsSymbol *symbol, bool update )
   if ( !symbol || name.isEmpty() )
     return false;
 
+  // a still deferred symbol of the same name must be materialized first, so
+  // that it is correctly replaced below
+  if ( !mSymbols.contains( name ) && mDeferredSymbols.contains( name ) )
+    loadDeferredSymbol( name );
+
   // delete previous symbol (if any)
   if ( mSymbols.contains( name ) )
   {
@@ -142,8 +152,9 @@ bool QgsStyle::saveSymbol( const QString &name, QgsSymbol *symbol, bool favorite
 
 bool QgsStyle::removeSymbol( const QString &name )
 {
+  const bool wasDeferred = mDeferredSymbols.remove( name );
   QgsSymbol *symbol = mSymbols.take( name );
-  if ( !symbol )
+  if ( !symbol && !wasDeferred )
     return false;
 
   // remove from map and delete
@@ -180,17 +191,24 @@ QgsSymbol *QgsStyle::symbol( const QString &name )
 
 const QgsSymbol *QgsStyle::symbolRef( const QString &name ) const
 {
+  if ( !mSymbols.contains( name ) && mDeferredSymbols.contains( name ) )
+    loadDeferredSymbol( name );
+
   return mSymbols.value( name );
 }
 
 int QgsStyle::symbolCount()
 {
-  return mSymbols.count();
+  return mSymbols.count() + mDeferredSymbols.count();
 }
 
 QStringList QgsStyle::symbolNames()
 {
-  return mSymbols.keys();
+  QStringList names = mSymbols.keys();
+  for ( const QString &name : qgis::as_const( mDeferredSymbols ) )
+    names << name;
+  std::sort( names.begin(), names.end() );
+  return names;
 }
 
 
@@ -199,6 +217,11 @@ bool QgsStyle::addColorRamp( const QString &name, QgsColorRamp *colorRamp, bool
   if ( !colorRamp || name.isEmpty() )
     return false;
 
+  // a still deferred ramp of the same name must be materialized first, so
+  // that it is correctly replaced below
+  if ( !mColorRamps.contains( name ) && mDeferredRamps.contains( name ) )
+    loadDeferredColorRamp( name );
+
   // delete previous color ramps (if any)
   if ( mColorRamps.contains( name ) )
   {
@@ -251,8 +274,9 @@ bool QgsStyle::saveColorRamp( const QString &name, QgsColorRamp *ramp, bool favo
 
 bool QgsStyle::removeColorRamp( const QString &name )
 {
+  const bool wasDeferred = mDeferredRamps.remove( name );
   std::unique_ptr< QgsColorRamp > ramp( mColorRamps.take( name ) );
-  if ( !ramp )
+  if ( !ramp && !wasDeferred )
     return false;
 
   auto query = QgsSqlite3Mprintf( "DELETE FROM colorramp WHERE name='%q'", name.toUtf8().constData() );
@@ -277,17 +301,24 @@ QgsColorRamp *QgsStyle::colorRamp( const QString &name ) const
 
 const QgsColorRamp *QgsStyle::colorRampRef( const QString &name ) const
 {
+  if ( !mColorRamps.contains( name ) && mDeferredRamps.contains( name ) )
+    loadDeferredColorRamp( name );
+
   return mColorRamps.value( name );
 }
 
 int QgsStyle::colorRampCount()
 {
-  return mColorRamps.count();
+  return mColorRamps.count() + mDeferredRamps.count();
 }
 
 QStringList QgsStyle::colorRampNames()
 {
-  return mColorRamps.keys();
+  QStringList names = mColorRamps.keys();
+  for ( const QString &name : qgis::as_const( mDeferredRamps ) )
+    names << name;
+  std::sort( names.begin(), names.end() );
+  return names;
 }
 
 bool QgsStyle::openDatabase( const QString &filename )
@@ -378,8 +409,10 @@ bool QgsStyle::load( const QString &filename )
                                 );
   runEmptyQuery( query );
 
-  // First create all the main symbols
-  query = QgsSqlite3Mprintf( "SELECT * FROM symbol" );
+  // Only read the entity names up front -- the XML of each symbol and color
+  // ramp is deserialized on first use, which keeps opening large style
+  // databases cheap and avoids materializing entities which are never touched
+  query = QgsSqlite3Mprintf( "SELECT name FROM symbol" );
 
   sqlite3_statement_unique_ptr statement;
   int rc;
@@ -387,43 +420,83 @@ bool QgsStyle::load( const QString &filename )
 
   while ( rc == SQLITE_OK && sqlite3_step( statement.get() ) == SQLITE_ROW )
   {
-    QDomDocument doc;
-    QString symbol_name = statement.columnAsText( SymbolName );
-    QString xmlstring = statement.columnAsText( SymbolXML );
-    if ( !doc.setContent( xmlstring ) )
-    {
-      QgsDebugMsg( "Cannot open symbol " + symbol_name );
-      continue;
-    }
-
-    QDomElement symElement = doc.documentElement();
-    QgsSymbol *symbol = QgsSymbolLayerUtils::loadSymbol( symElement, QgsReadWriteContext() );
-    if ( symbol )
-      mSymbols.insert( symbol_name, symbol );
+    mDeferredSymbols << statement.columnAsText( 0 );
   }
 
-  query = QgsSqlite3Mprintf( "SELECT * FROM colorramp" );
+  query = QgsSqlite3Mprintf( "SELECT name FROM colorramp" );
   statement = mCurrentDB.prepare( query, rc );
   while ( rc == SQLITE_OK && sqlite3_step( statement.get() ) == SQLITE_ROW )
   {
-    QDomDocument doc;
-    QString ramp_name = statement.columnAsText( ColorrampName );
-    QString xmlstring = statement.columnAsText( ColorrampXML );
-    if ( !doc.setContent( xmlstring ) )
-    {
-      QgsDebugMsg( "Cannot open symbol " + ramp_name );
-      continue;
-    }
-    QDomElement rampElement = doc.documentElement();
-    QgsColorRamp *ramp = QgsSymbolLayerUtils::loadColorRamp( rampElement );
-    if ( ramp )
-      mColorRamps.insert( ramp_name, ramp );
+    mDeferredRamps << statement.columnAsText( 0 );
   }
 
   mFileName = filename;
   return true;
 }
 
+bool QgsStyle::loadDeferredSymbol( const QString &name ) const
+{
+  mDeferredSymbols.remove( name );
+
+  auto query = QgsSqlite3Mprintf( "SELECT xml FROM symbol WHERE name='%q'", name.toUtf8().constData() );
+  sqlite3_statement_unique_ptr statement;
+  int rc;
+  statement = mCurrentDB.prepare( query, rc );
+  if ( rc != SQLITE_OK || sqlite3_step( statement.get() ) != SQLITE_ROW )
+    return false;
+
+  QDomDocument doc;
+  if ( !doc.setContent( statement.columnAsText( 0 ) ) )
+  {
+    QgsDebugMsg( "Cannot open symbol " + name );
+    return false;
+  }
+
+  QgsSymbol *symbol = QgsSymbolLayerUtils::loadSymbol( doc.documentElement(), QgsReadWriteContext() );
+  if ( !symbol )
+    return false;
+
+  mSymbols.insert( name, symbol );
+  return true;
+}
+
+bool QgsStyle::loadDeferredColorRamp( const QString &name ) const
+{
+  mDeferredRamps.remove( name );
+
+  auto query = QgsSqlite3Mprintf( "SELECT xml FROM colorramp WHERE name='%q'", name.toUtf8().constData() );
+  sqlite3_statement_unique_ptr statement;
+  int rc;
+  statement = mCurrentDB.prepare( query, rc );
+  if ( rc != SQLITE_OK || sqlite3_step( statement.get() ) != SQLITE_ROW )
+    return false;
+
+  QDomDocument doc;
+  if ( !doc.setContent( statement.columnAsText( 0 ) ) )
+  {
+    QgsDebugMsg( "Cannot open color ramp " + name );
+    return false;
+  }
+
+  QgsColorRamp *ramp = QgsSymbolLayerUtils::loadColorRamp( doc.documentElement() );
+  if ( !ramp )
+    return false;
+
+  mColorRamps.insert( name, ramp );
+  return true;
+}
+
+void QgsStyle::loadAllDeferred() const
+{
+  const QSet< QString > symbols = mDeferredSymbols;
+  for ( const QString &name : symbols )
+    loadDeferredSymbol( name );
+
+  const QSet< QString > ramps = mDeferredRamps;
+  for ( const QString &name : ramps )
+    loadDeferredColorRamp( name );
+}
+
 
 
 bool QgsStyle::save( QString filename )
@@ -474,12 +547,15 @@ bool QgsStyle::save( QString filename )
 
 bool QgsStyle::renameSymbol( const QString &oldName, const QString &newName )
 {
-  if ( mSymbols.contains( newName ) )
+  if ( mSymbols.contains( newName ) || mDeferredSymbols.contains( newName ) )
   {
     QgsDebugMsg( QStringLiteral( "Symbol of new name already exists" ) );
     return false;
   }
 
+  if ( !mSymbols.contains( oldName ) && mDeferredSymbols.contains( oldName ) )
+    loadDeferredSymbol( oldName );
+
   QgsSymbol *symbol = mSymbols.take( oldName );
   if ( !symbol )
     return false;
@@ -510,12 +586,15 @@ bool QgsStyle::renameSymbol( const QString &oldName, const QString &newName )
 
 bool QgsStyle::renameColorRamp( const QString &oldName, const QString &newName )
 {
-  if ( mColorRamps.contains( newName ) )
+  if ( mColorRamps.contains( newName ) || mDeferredRamps.contains( newName ) )
   {
     QgsDebugMsg( QStringLiteral( "Color ramp of new name already exists." ) );
     return false;
   }
 
+  if ( !mColorRamps.contains( oldName ) && mDeferredRamps.contains( oldName ) )
+    loadDeferredColorRamp( oldName );
+
   QgsColorRamp *ramp = mColorRamps.take( oldName );
   if ( !ramp )
     return false;
@@ -1501,6 +1580,9 @@ bool QgsStyle::exportXml( const QString &filename )
     return false;
   }
 
+  // a whole-style export needs every entity materialized
+  loadAllDeferred();
+
   QDomDocument doc( QStringLiteral( "qgis_style" ) );
   QDomElement root = doc.createElement( QStringLiteral( "qgis_style" ) );
   root.setAttribute( QStringLiteral( "version" ), QStringLiteral( STYLE_CURRENT_VERSION ) );
@@ -20,6 +20,7 @@
 #include "qgis.h"
 #include <QMap>
 #include <QMultiMap>
+#include <QSet>
 #include <QString>
 
 #include <sqlite3.h>
@@ -543,8 +544,17 @@ class CORE_EXPORT QgsStyle : public QObject
 
   private:
 
-    QgsSymbolMap mSymbols;
-    QgsVectorColorRampMap mColorRamps;
+    // mutable so that deferred entities can be materialized from const accessors
+    mutable QgsSymbolMap mSymbols;
+    mutable QgsVectorColorRampMap mColorRamps;
+
+    /**
+     * Names of the entities present in the database whose XML has not been
+     * deserialized yet. Disjoint from the keys of the materialized maps --
+     * a name moves from here into the map on first use.
+     */
+    mutable QSet< QString > mDeferredSymbols;
+    mutable QSet< QString > mDeferredRamps;
 
     QHash< QString, QStringList > mCachedSymbolTags;
     QHash< QString, QStringList > mCachedColorRampTags;
@@ -552,7 +562,7 @@ class CORE_EXPORT QgsStyle : public QObject
     QString mErrorString;
     QString mFileName;
 
-    sqlite3_database_unique_ptr mCurrentDB;
+    mutable sqlite3_database_unique_ptr mCurrentDB;
 
     static QgsStyle *sDefaultStyle;
 
@@ -585,6 +595,29 @@ class CORE_EXPORT QgsStyle : public QObject
 
     void clearCachedTags( StyleEntity type, const QString &name );
 
+    /**
+     * Deserializes a symbol whose loading was deferred by load(), moving it
+     * from mDeferredSymbols into mSymbols. Returns FALSE if the symbol's XML
+     * could not be parsed.
+     * \since QGIS 3.8
+     */
+    bool loadDeferredSymbol( const QString &name ) const;
+
+    /**
+     * Deserializes a color ramp whose loading was deferred by load(), moving
+     * it from mDeferredRamps into mColorRamps. Returns FALSE if the ramp's
+     * XML could not be parsed.
+     * \since QGIS 3.8
+     */
+    bool loadDeferredColorRamp( const QString &name ) const;
+
+    /**
+     * Materializes every remaining deferred symbol and color ramp, e.g.
+     * before a whole-style export.
+     * \since QGIS 3.8
+     */
+    void loadAllDeferred() const;
+
     Q_DISABLE_COPY( QgsStyle )
 };
 
@@ -17,6 +17,7 @@
 
 #include "qgssvgcache.h"
 #include "qgis.h"
+#include "qgscachebudgetmanager.h"
 #include "qgslogger.h"
 #include "qgsnetworkaccessmanager.h"
 #include "qgsmessagelog.h"
@@ -36,6 +37,12 @@
 #include <QFileInfo>
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QtConcurrentRun>
+
+#include <algorithm>
+
+//! Maximum number of parsed SVG documents to retain
+static const int MAX_SVG_DOCUMENT_CACHE_SIZE = 30;
 
 ///@cond PRIVATE
 
@@ -117,15 +124,42 @@ QgsSvgCache::QgsSvgCache( QObject *parent )
   }
 
   connect( this, &QgsAbstractContentCacheBase::remoteContentFetched, this, &QgsSvgCache::remoteSvgFetched );
+
+  mCacheBudgetHandle = QgsCacheBudgetManager::instance()->registerCache( QStringLiteral( "SVGs" ),
+                       [this]() -> qint64
+  {
+    QMutexLocker locker( &mMutex );
+    return mTotalSize;
+  },
+  [this]( qint64 maximumCost )
+  {
+    QMutexLocker locker( &mMutex );
+    mMaxCacheSize = static_cast< long >( maximumCost );
+    trimToMaximumSize();
+  } );
+}
+
+QgsSvgCache::~QgsSvgCache()
+{
+  for ( QFuture< void > &future : mPrefetchFutures )
+    future.waitForFinished();
+
+  QgsCacheBudgetManager::instance()->unregisterCache( mCacheBudgetHandle );
 }
 
 QImage QgsSvgCache::svgAsImage( const QString &file, double size, const QColor &fill, const QColor &stroke, double strokeWidth,
                                 double widthScaleFactor, bool &fitsInCache, double fixedAspectRatio )
+{
+  return renderImage( file, size, fill, stroke, strokeWidth, widthScaleFactor, fitsInCache, fixedAspectRatio, true );
+}
+
+QImage QgsSvgCache::renderImage( const QString &path, double size, const QColor &fill, const QColor &stroke, double strokeWidth,
+                                 double widthScaleFactor, bool &fitsInCache, double fixedAspectRatio, bool predictSizes )
 {
   QMutexLocker locker( &mMutex );
 
   fitsInCache = true;
-  QgsSvgCacheEntry *currentEntry = cacheEntry( file, size, fill, stroke, strokeWidth, widthScaleFactor, fixedAspectRatio );
+  QgsSvgCacheEntry *currentEntry = cacheEntry( path, size, fill, stroke, strokeWidth, widthScaleFactor, fixedAspectRatio );
 
   QImage result;
 
@@ -170,6 +204,17 @@ QImage QgsSvgCache::svgAsImage( const QString &file, double size, const QColor &
       result = *( currentEntry->image );
     }
     trimToMaximumSize();
+
+    if ( predictSizes )
+    {
+      // a synchronous render at a new size usually means the map scale just changed --
+      // anticipate the neighbouring zoom steps so the next change finds its image ready
+      for ( double predictedSize : { size / 2, size * 2 } )
+      {
+        if ( predictedSize >= 4 && predictedSize <= 512 )
+          prefetchImage( path, predictedSize, fill, stroke, strokeWidth, widthScaleFactor, fixedAspectRatio );
+      }
+    }
   }
   else
   {
@@ -179,6 +224,33 @@ QImage QgsSvgCache::svgAsImage( const QString &file, double size, const QColor &
   return result;
 }
 
+void QgsSvgCache::prefetchImage( const QString &path, double size, const QColor &fill, const QColor &stroke, double strokeWidth,
+                                 double widthScaleFactor, double fixedAspectRatio )
+{
+  const QString key = QStringLiteral( "%1|%2|%3|%4|%5|%6|%7" ).arg( path ).arg( size )
+                      .arg( fill.name( QColor::HexArgb ), stroke.name( QColor::HexArgb ) )
+                      .arg( strokeWidth ).arg( widthScaleFactor ).arg( fixedAspectRatio );
+
+  QMutexLocker locker( &mMutex );
+  if ( mPendingPrefetches.contains( key ) )
+    return;
+
+  mPendingPrefetches.insert( key );
+
+  // prune futures which have already finished so the list stays small
+  mPrefetchFutures.erase( std::remove_if( mPrefetchFutures.begin(), mPrefetchFutures.end(),
+                                          []( const QFuture< void > &future ) { return future.isFinished(); } ), mPrefetchFutures.end() );
+
+  mPrefetchFutures.append( QtConcurrent::run( [this, path, size, fill, stroke, strokeWidth, widthScaleFactor, fixedAspectRatio, key]
+  {
+    bool fitsInCache = true;
+    renderImage( path, size, fill, stroke, strokeWidth, widthScaleFactor, fitsInCache, fixedAspectRatio, false );
+
+    QMutexLocker locker( &mMutex );
+    mPendingPrefetches.remove( key );
+  } ) );
+}
+
 QPicture QgsSvgCache::svgAsPicture( const QString &path, double size, const QColor &fill, const QColor &stroke, double strokeWidth,
                                     double widthScaleFactor, bool forceVectorOutput, double fixedAspectRatio )
 {
@@ -266,7 +338,7 @@ void QgsSvgCache::containsParams( const QString &path,
   hasDefaultStrokeOpacity = false;
 
   QDomDocument svgDoc;
-  if ( !svgDoc.setContent( getContent( path, mMissingSvg, mFetchingSvg ) ) )
+  if ( !parsedSvgDocument( path, svgDoc ) )
   {
     return;
   }
@@ -279,6 +351,44 @@ void QgsSvgCache::containsParams( const QString &path,
                       hasStrokeOpacityParam, hasDefaultStrokeOpacity, defaultStrokeOpacity );
 }
 
+bool QgsSvgCache::parsedSvgDocument( const QString &path, QDomDocument &doc ) const
+{
+  // checking the modification time is much cheaper than re-reading and re-parsing the
+  // file, and keeps retained documents consistent with the file change detection
+  // performed for the rendered entries themselves
+  const QDateTime fileModified = QFileInfo( path ).lastModified();
+
+  {
+    QMutexLocker locker( &mSvgDocumentCacheMutex );
+    const auto it = mSvgDocumentCache.constFind( path );
+    if ( it != mSvgDocumentCache.constEnd() && it.value().first == fileModified )
+    {
+      // hand out a deep copy -- callers mutate the document when replacing params, and
+      // QDom instances cannot be safely shared between threads
+      doc = it.value().second.cloneNode( true ).toDocument();
+      return true;
+    }
+  }
+
+  const QByteArray content = getContent( path, mMissingSvg, mFetchingSvg );
+  QDomDocument parsedDoc;
+  if ( !parsedDoc.setContent( content ) )
+    return false;
+
+  // placeholder content served while a remote file is still being fetched (or is
+  // missing) must not be retained, or it would mask the real file once available
+  if ( content != mFetchingSvg && content != mMissingSvg )
+  {
+    QMutexLocker locker( &mSvgDocumentCacheMutex );
+    if ( mSvgDocumentCache.size() >= MAX_SVG_DOCUMENT_CACHE_SIZE && !mSvgDocumentCache.contains( path ) )
+      mSvgDocumentCache.erase( mSvgDocumentCache.begin() );
+    mSvgDocumentCache.insert( path, qMakePair( fileModified, parsedDoc.cloneNode( true ).toDocument() ) );
+  }
+
+  doc = parsedDoc;
+  return true;
+}
+
 void QgsSvgCache::replaceParamsAndCacheSvg( QgsSvgCacheEntry *entry )
 {
   if ( !entry )
@@ -287,7 +397,7 @@ void QgsSvgCache::replaceParamsAndCacheSvg( QgsSvgCacheEntry *entry )
   }
 
   QDomDocument svgDoc;
-  if ( !svgDoc.setContent( getContent( entry->path, mMissingSvg, mFetchingSvg ) ) )
+  if ( !parsedSvgDocument( entry->path, svgDoc ) )
   {
     return;
   }
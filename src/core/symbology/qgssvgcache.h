@@ -21,7 +21,11 @@
 #include "qgsabstractcontentcache.h"
 #include "qgis.h"
 
+#include <QDateTime>
+#include <QDomDocument>
+#include <QFuture>
 #include <QPicture>
+#include <QSet>
 
 class QDomElement;
 
@@ -109,6 +113,8 @@ class CORE_EXPORT QgsSvgCache : public QgsAbstractContentCache< QgsSvgCacheEntry
      */
     QgsSvgCache( QObject *parent SIP_TRANSFERTHIS = nullptr );
 
+    ~QgsSvgCache() override;
+
     /**
      * Gets SVG as QImage.
      * \param path Absolute path to SVG file.
@@ -186,6 +192,20 @@ class CORE_EXPORT QgsSvgCache : public QgsAbstractContentCache< QgsSvgCacheEntry
                          bool &hasStrokeWidthParam, bool &hasDefaultStrokeWidth, double &defaultStrokeWidth,
                          bool &hasStrokeOpacityParam, bool &hasDefaultStrokeOpacity, double &defaultStrokeOpacity ) const SIP_PYNAME( containsParamsV3 );
 
+    /**
+     * Requests that the rendered image for the given SVG be prepared in a background
+     * thread, so that a later svgAsImage() call with the same parameters can be served
+     * directly from the cache without stalling the render thread.
+     *
+     * Has no effect if the image was already prefetched. svgAsImage() schedules this
+     * automatically for the neighbouring zoom step sizes whenever it has to render an
+     * image synchronously.
+     *
+     * \since QGIS 3.8
+     */
+    void prefetchImage( const QString &path, double size, const QColor &fill, const QColor &stroke, double strokeWidth,
+                        double widthScaleFactor, double fixedAspectRatio = 0 );
+
     //! Gets image data
     QByteArray getImageData( const QString &path ) const;
 
@@ -213,6 +233,21 @@ class CORE_EXPORT QgsSvgCache : public QgsAbstractContentCache< QgsSvgCacheEntry
 
   private:
 
+    /**
+     * Implementation of svgAsImage(). When \a predictSizes is TRUE and the image had to
+     * be rendered synchronously, renders for the neighbouring zoom step sizes are
+     * scheduled in the background via prefetchImage().
+     */
+    QImage renderImage( const QString &path, double size, const QColor &fill, const QColor &stroke, double strokeWidth,
+                        double widthScaleFactor, bool &fitsInCache, double fixedAspectRatio, bool predictSizes );
+
+    /**
+     * Gets the parsed DOM document for the SVG file at \a path into \a doc, retaining
+     * parsed documents per path so that cache misses at new sizes of a file do not
+     * re-read and re-parse its content. Returns FALSE if the content could not be parsed.
+     */
+    bool parsedSvgDocument( const QString &path, QDomDocument &doc ) const;
+
     void replaceParamsAndCacheSvg( QgsSvgCacheEntry *entry );
     void cacheImage( QgsSvgCacheEntry *entry );
     void cachePicture( QgsSvgCacheEntry *entry, bool forceVectorOutput = false );
@@ -249,6 +284,17 @@ class CORE_EXPORT QgsSvgCache : public QgsAbstractContentCache< QgsSvgCacheEntry
 
     QByteArray mFetchingSvg;
 
+    //! Handle of this cache's registration with QgsCacheBudgetManager
+    int mCacheBudgetHandle = 0;
+
+    //! Parsed SVG documents with their file modification time, retained per path so new sizes of a file skip the XML parse
+    mutable QHash< QString, QPair< QDateTime, QDomDocument > > mSvgDocumentCache;
+    mutable QMutex mSvgDocumentCacheMutex;
+
+    //! Keys of prefetch renders which have been scheduled but not yet completed
+    QSet< QString > mPendingPrefetches;
+    QVector< QFuture< void > > mPrefetchFutures;
+
     friend class TestQgsSvgCache;
 };
 
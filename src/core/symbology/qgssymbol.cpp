@@ -114,7 +114,16 @@ QPolygonF QgsSymbol::_getLineString( QgsRenderContext &context, const QgsCurve &
     const double cw = e.width() / 10;
     const double ch = e.height() / 10;
     const QgsRectangle clipRect( e.xMinimum() - cw, e.yMinimum() - ch, e.xMaximum() + cw, e.yMaximum() + ch );
-    pts = QgsClipper::clippedLine( curve, clipRect );
+    if ( clipRect.contains( curve.boundingBox() ) )
+    {
+      // clipping a line which lies entirely inside the (grown) extent cannot
+      // remove anything -- skip the per-segment clipping work
+      pts = curve.asQPolygonF();
+    }
+    else
+    {
+      QgsClipper::clippedLine( curve, clipRect, pts );
+    }
   }
   else
   {
@@ -170,7 +179,7 @@ QPolygonF QgsSymbol::_getPolygonRing( QgsRenderContext &context, const QgsCurve
   const QRectF ptsRect = poly.boundingRect();
   if ( clipToExtent && !context.extent().contains( ptsRect ) )
   {
-    QgsClipper::trimPolygon( poly, clipRect );
+    QgsClipper::trimPolygon( poly, clipRect, context.clippingScratchBuffer() );
   }
 
   //transform the QPolygonF to screen coordinates
@@ -1058,6 +1067,32 @@ void QgsSymbol::renderFeature( const QgsFeature &feature, QgsRenderContext &cont
   }
 }
 
+void QgsSymbol::startFeatureBatch( QgsRenderContext &context )
+{
+  // deferred draws are only safe when every enabled layer takes part in the
+  // batch, otherwise the paint order between the symbol's layers would change
+  Q_FOREACH ( QgsSymbolLayer *layer, mLayers )
+  {
+    if ( layer->enabled() && !layer->supportsFeatureBatching() )
+      return;
+  }
+
+  Q_FOREACH ( QgsSymbolLayer *layer, mLayers )
+  {
+    if ( layer->enabled() )
+      layer->startFeatureBatch( context );
+  }
+}
+
+void QgsSymbol::stopFeatureBatch( QgsRenderContext &context )
+{
+  Q_FOREACH ( QgsSymbolLayer *layer, mLayers )
+  {
+    if ( layer->enabled() )
+      layer->stopFeatureBatch( context );
+  }
+}
+
 QgsSymbolRenderContext *QgsSymbol::symbolRenderContext()
 {
   return mSymbolRenderContext.get();
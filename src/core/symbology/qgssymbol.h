@@ -431,6 +431,32 @@ class CORE_EXPORT QgsSymbol
      */
     void renderFeature( const QgsFeature &feature, QgsRenderContext &context, int layer = -1, bool selected = false, bool drawVertexMarker = false, int currentVertexMarkerType = 0, double currentVertexMarkerSize = 0.0 );
 
+    /**
+     * Signals the start of a run of consecutive features which will all be
+     * rendered with this symbol, allowing the symbol layers to merge the
+     * features into batched paint operations. Has no effect unless every
+     * enabled symbol layer supports batching, since deferring only some
+     * layers' draws would change the paint order between the layers.
+     *
+     * Must be balanced by a call to stopFeatureBatch() before any other
+     * symbol paints to the destination.
+     *
+     * \see stopFeatureBatch()
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    void startFeatureBatch( QgsRenderContext &context ) SIP_SKIP;
+
+    /**
+     * Signals the end of a run of consecutive features started with
+     * startFeatureBatch(), flushing any batched paint operations.
+     *
+     * \see startFeatureBatch()
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    void stopFeatureBatch( QgsRenderContext &context ) SIP_SKIP;
+
     /**
      * Returns the symbol render context. Only valid between startRender and stopRender calls.
      *
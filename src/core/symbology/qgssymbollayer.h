@@ -239,6 +239,35 @@ class CORE_EXPORT QgsSymbolLayer
     virtual void startRender( QgsSymbolRenderContext &context ) = 0;
     virtual void stopRender( QgsSymbolRenderContext &context ) = 0;
 
+    /**
+     * Returns TRUE if the layer can merge consecutive features sharing this
+     * symbol into a single paint operation (see startFeatureBatch()). The
+     * default implementation returns FALSE.
+     *
+     * \since QGIS 3.8
+     */
+    virtual bool supportsFeatureBatching() const { return false; }
+
+    /**
+     * Called before a run of consecutive features sharing this layer's symbol
+     * is rendered, allowing the layer to accumulate the features' paths and
+     * submit them to the painter in one operation when stopFeatureBatch() is
+     * called. Only invoked when supportsFeatureBatching() returns TRUE.
+     *
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    virtual void startFeatureBatch( QgsRenderContext &context ) SIP_SKIP { Q_UNUSED( context ); }
+
+    /**
+     * Called when a run of consecutive features sharing this layer's symbol
+     * ends, flushing any paths accumulated since startFeatureBatch().
+     *
+     * \note not available in Python bindings
+     * \since QGIS 3.8
+     */
+    virtual void stopFeatureBatch( QgsRenderContext &context ) SIP_SKIP { Q_UNUSED( context ); }
+
     /**
      * Shall be reimplemented by subclasses to create a deep copy of the instance.
      */
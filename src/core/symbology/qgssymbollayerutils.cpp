@@ -33,12 +33,14 @@
 #include "qgsunittypes.h"
 #include "qgsexpressioncontextutils.h"
 
+#include <QCache>
 #include <QColor>
 #include <QFont>
 #include <QDomDocument>
 #include <QDomNode>
 #include <QDomElement>
 #include <QIcon>
+#include <QMutex>
 #include <QPainter>
 #include <QSettings>
 #include <QRegExp>
@@ -654,6 +656,24 @@ QIcon QgsSymbolLayerUtils::symbolPreviewIcon( const QgsSymbol *symbol, QSize siz
 QPixmap QgsSymbolLayerUtils::symbolPreviewPixmap( const QgsSymbol *symbol, QSize size, int padding, QgsRenderContext *customContext )
 {
   Q_ASSERT( symbol );
+
+  // previews of unchanged symbols are requested over and over again by the layer
+  // tree view, the style browser and layout legends, so cache them by symbol
+  // definition. Only plain previews are cacheable - a custom context or data
+  // defined properties may influence the rendering in arbitrary ways.
+  static QCache<QString, QPixmap> sPreviewCache( 20 * 1024 * 1024 );  // cost = bytes of pixmap data
+  QString cacheKey;
+  const bool canCache = !customContext && !symbol->hasDataDefinedProperties();
+  if ( canCache )
+  {
+    QDomDocument symbolDoc;
+    QDomElement symbolElem = saveSymbol( QString(), const_cast< QgsSymbol * >( symbol ), symbolDoc, QgsReadWriteContext() );
+    symbolDoc.appendChild( symbolElem );
+    cacheKey = QStringLiteral( "%1|%2x%3|%4" ).arg( symbolDoc.toString( -1 ) ).arg( size.width() ).arg( size.height() ).arg( padding );
+    if ( QPixmap *cachedPixmap = sPreviewCache.object( cacheKey ) )
+      return *cachedPixmap;
+  }
+
   QPixmap pixmap( size );
   pixmap.fill( Qt::transparent );
   QPainter painter;
@@ -700,6 +720,10 @@ QPixmap QgsSymbolLayerUtils::symbolPreviewPixmap( const QgsSymbol *symbol, QSize
   }
 
   painter.end();
+
+  if ( canCache )
+    sPreviewCache.insert( cacheKey, new QPixmap( pixmap ), pixmap.width() * pixmap.height() * 4 );
+
   return pixmap;
 }
 
@@ -3759,9 +3783,23 @@ QString QgsSymbolLayerUtils::svgSymbolNameToPath( const QString &n, const QgsPat
   if ( n.isEmpty() )
     return QString();
 
+  // successful resolutions are remembered for the session -- projects tend to
+  // reference the same handful of symbols over and over, and every miss below
+  // probes the whole list of svg search directories on disk
+  static QHash< QString, QString > sResolvedSvgPaths;
+  static QMutex sResolvedSvgPathsMutex;
+  QMutexLocker locker( &sResolvedSvgPathsMutex );
+  const auto cacheIt = sResolvedSvgPaths.constFind( n );
+  if ( cacheIt != sResolvedSvgPaths.constEnd() )
+    return cacheIt.value();
+
   // we might have a full path...
   if ( QFileInfo::exists( n ) )
-    return QFileInfo( n ).canonicalFilePath();
+  {
+    const QString path = QFileInfo( n ).canonicalFilePath();
+    sResolvedSvgPaths.insert( n, path );
+    return path;
+  }
 
   QString name = n;
   // or it might be an url...
@@ -3776,7 +3814,9 @@ QString QgsSymbolLayerUtils::svgSymbolNameToPath( const QString &n, const QgsPat
         name = url.toLocalFile();
         if ( QFile( name ).exists() )
         {
-          return QFileInfo( name ).canonicalFilePath();
+          const QString path = QFileInfo( name ).canonicalFilePath();
+          sResolvedSvgPaths.insert( n, path );
+          return path;
         }
       }
       else
@@ -3810,10 +3850,13 @@ QString QgsSymbolLayerUtils::svgSymbolNameToPath( const QString &n, const QgsPat
     if ( QFile( myLocalPath ).exists() )
     {
       QgsDebugMsgLevel( QStringLiteral( "Svg found in alternative path" ), 3 );
-      return QFileInfo( myLocalPath ).canonicalFilePath();
+      const QString path = QFileInfo( myLocalPath ).canonicalFilePath();
+      sResolvedSvgPaths.insert( n, path );
+      return path;
     }
   }
 
+  // not cached -- the result of the project specific resolver may differ for the next project
   return pathResolver.readPath( name );
 }
 
@@ -87,6 +87,23 @@ bool QgsAttributeTableModel::loadFeatureAtId( QgsFeatureId fid ) const
     return false;
   }
 
+  if ( !mLayerCache->isFidCached( fid ) )
+  {
+    // cache miss - most likely the view is scrolling through the table, so
+    // ask the cache to fetch the features for the following rows in the
+    // background before they are requested
+    const int row = idToRow( fid );
+    if ( row >= 0 )
+    {
+      const int lastPrefetchRow = std::min( row + 100, mRowIdMap.size() - 1 );
+      QgsFeatureIds prefetchIds;
+      for ( int r = row + 1; r <= lastPrefetchRow; ++r )
+        prefetchIds.insert( rowToId( r ) );
+      if ( !prefetchIds.isEmpty() )
+        mLayerCache->prefetchFeatures( prefetchIds );
+    }
+  }
+
   return mLayerCache->featureAtId( fid, mFeat );
 }
 
@@ -109,6 +109,11 @@ QWidget *QgsValueRelationWidgetWrapper::createWidget( QWidget *parent )
     connect( form, &QgsAttributeForm::widgetValueChanged, this, &QgsValueRelationWidgetWrapper::widgetValueChanged );
 
   mExpression = config().value( QStringLiteral( "FilterExpression" ) ).toString();
+  // analyzing the expression involves parsing it, so do this once here instead
+  // of on every value change and populate() call
+  mExpressionRequiresFormScope = QgsValueRelationFieldFormatter::expressionRequiresFormScope( mExpression );
+  if ( mExpressionRequiresFormScope )
+    mExpressionFormAttributes = QgsValueRelationFieldFormatter::expressionFormAttributes( mExpression );
 
   if ( config( QStringLiteral( "AllowMulti" ) ).toBool() )
   {
@@ -242,8 +247,8 @@ void QgsValueRelationWidgetWrapper::widgetValueChanged( const QString &attribute
     QVariant oldValue( value( ) );
     setFormFeatureAttribute( attribute, newValue );
     // Update combos if the value used in the filter expression has changed
-    if ( QgsValueRelationFieldFormatter::expressionRequiresFormScope( mExpression )
-         && QgsValueRelationFieldFormatter::expressionFormAttributes( mExpression ).contains( attribute ) )
+    if ( mExpressionRequiresFormScope
+         && mExpressionFormAttributes.contains( attribute ) )
     {
       populate();
       // Restore value
@@ -292,7 +297,7 @@ int QgsValueRelationWidgetWrapper::columnCount() const
 void QgsValueRelationWidgetWrapper::populate( )
 {
   // Initialize, note that signals are blocked, to avoid double signals on new features
-  if ( QgsValueRelationFieldFormatter::expressionRequiresFormScope( mExpression ) )
+  if ( mExpressionRequiresFormScope )
   {
     mCache = QgsValueRelationFieldFormatter::createCache( config( ), formFeature() );
   }
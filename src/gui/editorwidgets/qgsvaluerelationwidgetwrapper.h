@@ -127,6 +127,10 @@ class GUI_EXPORT QgsValueRelationWidgetWrapper : public QgsEditorWidgetWrapper
 
     bool mEnabled = true;
     QString mExpression;
+    //! Whether mExpression uses fields or geometry of the currently edited feature, determined once in createWidget()
+    bool mExpressionRequiresFormScope = false;
+    //! Form attributes referenced by mExpression, determined once in createWidget()
+    QSet<QString> mExpressionFormAttributes;
 
     friend class QgsValueRelationWidgetFactory;
     friend class TestQgsValueRelationWidgetWrapper;
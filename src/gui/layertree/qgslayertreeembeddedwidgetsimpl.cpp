@@ -95,12 +95,16 @@ void QgsLayerTreeOpacityWidget::updateOpacityFromSlider()
   {
     case QgsMapLayer::VectorLayer:
     {
+      // setOpacity() advises canvases to re-composite their cached rendering of
+      // the layer -- a full triggerRepaint() would needlessly discard it
       qobject_cast<QgsVectorLayer *>( mLayer )->setOpacity( value / 1000.0 );
       break;
     }
     case QgsMapLayer::RasterLayer:
     {
+      // raster opacity is applied while rendering, so a full repaint is required
       qobject_cast<QgsRasterLayer *>( mLayer )->renderer()->setOpacity( 1 - value / 1000.0 );
+      mLayer->triggerRepaint();
       break;
     }
 
@@ -108,8 +112,6 @@ void QgsLayerTreeOpacityWidget::updateOpacityFromSlider()
     case QgsMapLayer::MeshLayer:
       break;
   }
-
-  mLayer->triggerRepaint();
 }
 
 void QgsLayerTreeOpacityWidget::layerTrChanged()
@@ -67,6 +67,7 @@ email                : sherman at mrcc.com
 #include "qgsrubberband.h"
 #include "qgsvectorlayer.h"
 #include "qgsmapthemecollection.h"
+#include "qgsmapthemeprerendertask.h"
 #include "qgscoordinatetransformcontext.h"
 #include "qgssvgcache.h"
 #include "qgsimagecache.h"
@@ -222,6 +223,8 @@ QgsMapCanvas::~QgsMapCanvas()
   }
   mLastNonZoomMapTool = nullptr;
 
+  cancelThemePreRenderTask();
+
   // rendering job may still end up writing into canvas map item
   // so kill it before deleting canvas items
   if ( mJob )
@@ -344,6 +347,8 @@ void QgsMapCanvas::setLayersPrivate( const QList<QgsMapLayer *> &layers )
   Q_FOREACH ( QgsMapLayer *layer, oldLayers )
   {
     disconnect( layer, &QgsMapLayer::repaintRequested, this, &QgsMapCanvas::layerRepaintRequested );
+    disconnect( layer, &QgsMapLayer::recompositionRequested, this, &QgsMapCanvas::layerRecompositionRequested );
+    disconnect( layer, &QgsMapLayer::labelsRepaintRequested, this, &QgsMapCanvas::layerLabelsRepaintRequested );
     disconnect( layer, &QgsMapLayer::autoRefreshIntervalChanged, this, &QgsMapCanvas::updateAutoRefreshTimer );
     if ( QgsVectorLayer *vlayer = qobject_cast<QgsVectorLayer *>( layer ) )
     {
@@ -358,6 +363,8 @@ void QgsMapCanvas::setLayersPrivate( const QList<QgsMapLayer *> &layers )
     if ( !layer )
       continue;
     connect( layer, &QgsMapLayer::repaintRequested, this, &QgsMapCanvas::layerRepaintRequested );
+    connect( layer, &QgsMapLayer::recompositionRequested, this, &QgsMapCanvas::layerRecompositionRequested );
+    connect( layer, &QgsMapLayer::labelsRepaintRequested, this, &QgsMapCanvas::layerLabelsRepaintRequested );
     connect( layer, &QgsMapLayer::autoRefreshIntervalChanged, this, &QgsMapCanvas::updateAutoRefreshTimer );
     if ( QgsVectorLayer *vlayer = qobject_cast<QgsVectorLayer *>( layer ) )
     {
@@ -528,6 +535,7 @@ void QgsMapCanvas::refreshMap()
 
   stopRendering(); // if any...
   stopPreviewJobs();
+  cancelThemePreRenderTask();
 
   //build the expression context
   QgsExpressionContext expressionContext;
@@ -661,6 +669,8 @@ void QgsMapCanvas::rendererJobFinished()
     }
     if ( mUsePreviewJobs )
       startPreviewJobs();
+
+    startThemePreRenderTask();
   }
 
   // now we are in a slot called from mJob - do not delete it immediately
@@ -1852,7 +1862,28 @@ void QgsMapCanvas::setTheme( const QString &theme )
   if ( mTheme == theme )
     return;
 
-  clearCache();
+  cancelThemePreRenderTask();
+
+  // only drop the cached images of layers whose style differs between the
+  // old and the new theme -- layers shown identically in both themes (and
+  // layers pre-rendered by QgsMapThemePreRenderTask) keep their cached
+  // rendering, so the theme switch only composites cached images
+  if ( mCache )
+  {
+    const QMap<QString, QString> oldOverrides = mSettings.layerStyleOverrides();
+    QMap<QString, QString> newOverrides;
+    if ( !theme.isEmpty() && QgsProject::instance()->mapThemeCollection()->hasMapTheme( theme ) )
+      newOverrides = QgsProject::instance()->mapThemeCollection()->mapThemeStyleOverrides( theme );
+
+    QSet<QString> layerIds = oldOverrides.keys().toSet();
+    layerIds.unite( newOverrides.keys().toSet() );
+    for ( const QString &layerId : qgis::as_const( layerIds ) )
+    {
+      if ( oldOverrides.value( layerId ) != newOverrides.value( layerId ) )
+        mCache->clearCacheImage( layerId );
+    }
+  }
+
   if ( theme.isEmpty() || !QgsProject::instance()->mapThemeCollection()->hasMapTheme( theme ) )
   {
     mTheme.clear();
@@ -1894,6 +1925,25 @@ void QgsMapCanvas::layerRepaintRequested( bool deferred )
     refresh();
 }
 
+void QgsMapCanvas::layerRecompositionRequested()
+{
+  // the cached rendering of the layer is still valid -- refreshing without
+  // dropping it just re-composites the cached images with the layer's new
+  // opacity or blend mode
+  refresh();
+}
+
+void QgsMapCanvas::layerLabelsRepaintRequested()
+{
+  // only the label solution is stale -- dropping just the label cache leaves
+  // the rendered images of layers not participating in labeling (and any
+  // retained feature sets) intact, so the refresh re-runs the labeling stage
+  // without re-rendering the whole layer stack
+  if ( mCache )
+    mCache->clearCacheImage( QgsMapRendererJob::LABEL_CACHE_ID );
+  refresh();
+}
+
 void QgsMapCanvas::autoRefreshTriggered()
 {
   if ( mJob )
@@ -2369,6 +2419,36 @@ void QgsMapCanvas::stopPreviewJobs()
   mPreviewJobs.clear();
 }
 
+void QgsMapCanvas::startThemePreRenderTask()
+{
+  if ( !mCache )
+    return;
+
+  QgsSettings settings;
+  if ( !settings.value( QStringLiteral( "qgis/preRenderMapThemes" ), false ).toBool() )
+    return;
+
+  QgsMapThemeCollection *themeCollection = QgsProject::instance()->mapThemeCollection();
+  // only worthwhile when there is at least one other theme to prepare
+  if ( themeCollection->mapThemes().count() < ( mTheme.isEmpty() ? 1 : 2 ) )
+    return;
+
+  cancelThemePreRenderTask();
+
+  mThemePreRenderTask = new QgsMapThemePreRenderTask( mSettings, themeCollection, mCache, mTheme );
+  // below default priority, so user triggered tasks go first
+  QgsApplication::taskManager()->addTask( mThemePreRenderTask, -1 );
+}
+
+void QgsMapCanvas::cancelThemePreRenderTask()
+{
+  if ( mThemePreRenderTask )
+  {
+    mThemePreRenderTask->cancel();
+    mThemePreRenderTask = nullptr;
+  }
+}
+
 void QgsMapCanvas::schedulePreviewJob( int number )
 {
   mPreviewTimer.setSingleShot( true );
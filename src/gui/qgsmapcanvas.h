@@ -58,6 +58,7 @@ class QgsLabelingResults;
 class QgsMapRendererCache;
 class QgsMapRendererQImageJob;
 class QgsMapSettings;
+class QgsMapThemePreRenderTask;
 class QgsMapCanvasMap;
 class QgsMapOverviewCanvas;
 class QgsMapTool;
@@ -901,6 +902,10 @@ class GUI_EXPORT QgsMapCanvas : public QGraphicsView
 
     void layerRepaintRequested( bool deferred );
 
+    void layerRecompositionRequested();
+
+    void layerLabelsRepaintRequested();
+
     void autoRefreshTriggered();
 
     void updateAutoRefreshTimer();
@@ -977,6 +982,9 @@ class GUI_EXPORT QgsMapCanvas : public QGraphicsView
 
     QList< QgsMapRendererQImageJob * > mPreviewJobs;
 
+    //! Background task pre-rendering the non-active map themes, owned by the task manager
+    QPointer< QgsMapThemePreRenderTask > mThemePreRenderTask;
+
     //! lock the scale, so zooming can be performed using magnication
     bool mScaleLocked = false;
 
@@ -1049,6 +1057,18 @@ class GUI_EXPORT QgsMapCanvas : public QGraphicsView
     void stopPreviewJobs();
     void schedulePreviewJob( int number );
 
+    /**
+     * Starts a background task which pre-renders the layers of the non-active
+     * map themes into the canvas cache, so that theme switches only composite
+     * cached images. No-op unless the qgis/preRenderMapThemes setting is
+     * enabled and the project defines other themes.
+     * \since QGIS 3.8
+     */
+    void startThemePreRenderTask();
+
+    //! Cancels a running theme pre-render task, if any
+    void cancelThemePreRenderTask();
+
     friend class TestQgsMapCanvas;
 
 }; // class QgsMapCanvas
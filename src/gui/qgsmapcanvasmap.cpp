@@ -32,7 +32,32 @@ QgsMapCanvasMap::QgsMapCanvasMap( QgsMapCanvas *canvas )
 
 void QgsMapCanvasMap::setContent( const QImage &image, const QgsRectangle &rect )
 {
-  mPreviewImages.clear();
+  if ( rect != mRect )
+  {
+    // extent changed, i.e. the refresh was triggered by navigation. Keep previously
+    // rendered preview tiles around -- they are still valid margin content until the
+    // next round of preview jobs lands, so an immediate follow-up pan (or a small zoom,
+    // where ::paint warps them through the current transform) is served from cached
+    // renders instead of blank margins. Tiles completely covered by the fresh image
+    // no longer add anything and are dropped, as are the oldest tiles when the cache
+    // grows beyond two generations of preview jobs.
+    QList< QPair< QImage, QgsRectangle > >::iterator partIt = mPreviewImages.begin();
+    while ( partIt != mPreviewImages.end() )
+    {
+      if ( rect.contains( partIt->second ) )
+        partIt = mPreviewImages.erase( partIt );
+      else
+        ++partIt;
+    }
+    while ( mPreviewImages.size() > 16 )
+      mPreviewImages.removeFirst();
+  }
+  else
+  {
+    // same extent re-render (e.g. after layer edits) -- cached tiles may show
+    // outdated content, discard them
+    mPreviewImages.clear();
+  }
 
   mImage = image;
 
@@ -54,7 +54,11 @@ class QgsMapCanvasMap : public QgsMapCanvasItem
 
     QImage mImage;
 
-    //! Preview images for panning. Usually cover area around the rendered image
+    /**
+     * Preview images for panning. Usually cover area around the rendered image.
+     * Kept across navigation triggered refreshes so that margins stay populated
+     * until fresh preview jobs complete.
+     */
     QList< QPair< QImage, QgsRectangle > > mPreviewImages;
 };
 
@@ -51,6 +51,7 @@
 #include <QStatusBar>
 #include <QVariant>
 #include <QMenu>
+#include <QtConcurrentMap>
 
 QgsMapToolIdentify::QgsMapToolIdentify( QgsMapCanvas *canvas )
   : QgsMapTool( canvas )
@@ -143,36 +144,85 @@ QList<QgsMapToolIdentify::IdentifyResult> QgsMapToolIdentify::identify( const Qg
   {
     QApplication::setOverrideCursor( Qt::WaitCursor );
 
-    int layerCount;
+    QList< QgsMapLayer * > targetLayers;
     if ( layerList.isEmpty() )
-      layerCount = mCanvas->layerCount();
+    {
+      for ( int i = 0; i < mCanvas->layerCount(); i++ )
+        targetLayers << mCanvas->layer( i );
+    }
     else
-      layerCount = layerList.count();
-
+    {
+      targetLayers = layerList;
+    }
 
-    for ( int i = 0; i < layerCount; i++ )
+    // fetch the candidate features of all identifiable vector layers in
+    // parallel before the sequential per-layer processing below -- provider
+    // I/O dominates identify time on projects with many layers. Not worth it
+    // for "stop at first" mode, where the lower layers are usually never reached.
+    QHash< QgsVectorLayer *, QgsFeatureList > prefetchedCandidates;
+    if ( mode != TopDownStopAtFirst && layerType.testFlag( VectorLayer ) )
     {
+      struct LayerFetchJob
+      {
+        QgsVectorLayer *layer = nullptr;
+        QgsFeatureList features;
+      };
 
-      QgsMapLayer *layer = nullptr;
-      if ( layerList.isEmpty() )
-        layer = mCanvas->layer( i );
-      else
-        layer = layerList.value( i );
+      QList< LayerFetchJob > jobs;
+      for ( QgsMapLayer *layer : qgis::as_const( targetLayers ) )
+      {
+        QgsVectorLayer *vlayer = qobject_cast< QgsVectorLayer * >( layer );
+        if ( vlayer && vlayer->isSpatial()
+             && layer->flags().testFlag( QgsMapLayer::Identifiable )
+             && vlayer->isInScaleRange( mCanvas->mapSettings().scale() ) )
+        {
+          LayerFetchJob job;
+          job.layer = vlayer;
+          jobs << job;
+        }
+      }
+
+      if ( jobs.count() > 1 )
+      {
+        QtConcurrent::blockingMap( jobs, [this]( LayerFetchJob & job )
+        {
+          job.features = collectIdentifyCandidates( job.layer, mLastGeometry );
+        } );
+        for ( const LayerFetchJob &job : qgis::as_const( jobs ) )
+          prefetchedCandidates.insert( job.layer, job.features );
+      }
+    }
+
+    for ( int i = 0; i < targetLayers.count(); i++ )
+    {
+      QgsMapLayer *layer = targetLayers.value( i );
 
-      emit identifyProgress( i, mCanvas->layerCount() );
+      emit identifyProgress( i, targetLayers.count() );
       emit identifyMessage( tr( "Identifying on %1…" ).arg( layer->name() ) );
 
       if ( !layer->flags().testFlag( QgsMapLayer::Identifiable ) )
         continue;
 
-      if ( identifyLayer( &results, layer,  mLastGeometry, mLastExtent, mLastMapUnitsPerPixel, layerType ) )
+      bool identified = false;
+      QgsVectorLayer *vlayer = qobject_cast< QgsVectorLayer * >( layer );
+      if ( vlayer && prefetchedCandidates.contains( vlayer ) )
+      {
+        const QgsFeatureList candidates = prefetchedCandidates.value( vlayer );
+        identified = identifyVectorLayer( &results, vlayer, mLastGeometry, &candidates );
+      }
+      else
+      {
+        identified = identifyLayer( &results, layer,  mLastGeometry, mLastExtent, mLastMapUnitsPerPixel, layerType );
+      }
+
+      if ( identified )
       {
         if ( mode == TopDownStopAtFirst )
           break;
       }
     }
 
-    emit identifyProgress( mCanvas->layerCount(), mCanvas->layerCount() );
+    emit identifyProgress( targetLayers.count(), targetLayers.count() );
     emit identifyMessage( tr( "Identifying done." ) );
   }
 
@@ -326,18 +376,12 @@ QMap<QString, QString> QgsMapToolIdentify::derivedAttributesForPoint( const QgsP
 
 bool QgsMapToolIdentify::identifyVectorLayer( QList<QgsMapToolIdentify::IdentifyResult> *results, QgsVectorLayer *layer, const QgsGeometry &geometry )
 {
-  if ( !layer || !layer->isSpatial() )
-    return false;
-
-  if ( !layer->isInScaleRange( mCanvas->mapSettings().scale() ) )
-  {
-    QgsDebugMsg( QStringLiteral( "Out of scale limits" ) );
-    return false;
-  }
-
-  QApplication::setOverrideCursor( Qt::WaitCursor );
+  return identifyVectorLayer( results, layer, geometry, nullptr );
+}
 
-  QMap< QString, QString > commonDerivedAttributes;
+QgsFeatureList QgsMapToolIdentify::collectIdentifyCandidates( QgsVectorLayer *layer, const QgsGeometry &geometry )
+{
+  QgsFeatureList featureList;
 
   QgsGeometry selectionGeom = geometry;
   bool isPointOrRectangle;
@@ -347,8 +391,6 @@ bool QgsMapToolIdentify::identifyVectorLayer( QList<QgsMapToolIdentify::Identify
   {
     isPointOrRectangle = true;
     point = selectionGeom.asPoint();
-
-    commonDerivedAttributes = derivedAttributesForPoint( QgsPoint( point ) );
   }
   else
   {
@@ -356,9 +398,6 @@ bool QgsMapToolIdentify::identifyVectorLayer( QList<QgsMapToolIdentify::Identify
     isPointOrRectangle = QgsGeometry::fromRect( selectionGeom.boundingBox() ).isGeosEqual( selectionGeom );
   }
 
-  int featureCount = 0;
-
-  QgsFeatureList featureList;
   std::unique_ptr<QgsGeometryEngine> selectionGeomPrepared;
 
   // toLayerCoordinates will throw an exception for an 'invalid' point.
@@ -402,6 +441,36 @@ bool QgsMapToolIdentify::identifyVectorLayer( QList<QgsMapToolIdentify::Identify
     QgsDebugMsg( QStringLiteral( "Caught CRS exception %1" ).arg( cse.what() ) );
   }
 
+  return featureList;
+}
+
+bool QgsMapToolIdentify::identifyVectorLayer( QList<QgsMapToolIdentify::IdentifyResult> *results, QgsVectorLayer *layer, const QgsGeometry &geometry, const QgsFeatureList *candidates )
+{
+  if ( !layer || !layer->isSpatial() )
+    return false;
+
+  if ( !layer->isInScaleRange( mCanvas->mapSettings().scale() ) )
+  {
+    QgsDebugMsg( QStringLiteral( "Out of scale limits" ) );
+    return false;
+  }
+
+  QApplication::setOverrideCursor( Qt::WaitCursor );
+
+  QMap< QString, QString > commonDerivedAttributes;
+
+  bool isSingleClick = geometry.type() == QgsWkbTypes::PointGeometry;
+  QgsPointXY point;
+  if ( isSingleClick )
+  {
+    point = geometry.asPoint();
+    commonDerivedAttributes = derivedAttributesForPoint( QgsPoint( point ) );
+  }
+
+  int featureCount = 0;
+
+  const QgsFeatureList featureList = candidates ? *candidates : collectIdentifyCandidates( layer, geometry );
+
   bool filter = false;
 
   QgsRenderContext context( QgsRenderContext::fromMapSettings( mCanvas->mapSettings() ) );
@@ -206,8 +206,18 @@ class GUI_EXPORT QgsMapToolIdentify : public QgsMapTool
     bool identifyLayer( QList<QgsMapToolIdentify::IdentifyResult> *results, QgsMapLayer *layer, const QgsGeometry &geometry, const QgsRectangle &viewExtent, double mapUnitsPerPixel, QgsMapToolIdentify::LayerType layerType = AllLayers );
     bool identifyRasterLayer( QList<QgsMapToolIdentify::IdentifyResult> *results, QgsRasterLayer *layer, const QgsGeometry &geometry, const QgsRectangle &viewExtent, double mapUnitsPerPixel );
     bool identifyVectorLayer( QList<QgsMapToolIdentify::IdentifyResult> *results, QgsVectorLayer *layer, const QgsGeometry &geometry );
+    bool identifyVectorLayer( QList<QgsMapToolIdentify::IdentifyResult> *results, QgsVectorLayer *layer, const QgsGeometry &geometry, const QgsFeatureList *candidates );
     bool identifyMeshLayer( QList<QgsMapToolIdentify::IdentifyResult> *results, QgsMeshLayer *layer, const QgsGeometry &geometry );
 
+    /**
+     * Collects the features of a vector \a layer which are candidates for an
+     * identify result on \a geometry, i.e. the features intersecting the
+     * search area. Only uses the layer's feature iteration interfaces, so it
+     * may run on a worker thread while the main thread blocks waiting for it.
+     * \since QGIS 3.8
+     */
+    QgsFeatureList collectIdentifyCandidates( QgsVectorLayer *layer, const QgsGeometry &geometry );
+
     /**
      * Desired units for distance display.
      * \see displayAreaUnits()
@@ -17,6 +17,10 @@
 #include "qgsarcgisrestutils.h"
 #include "qgslogger.h"
 
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QtConcurrentRun>
+
 void QgsAfsSharedData::clearCache()
 {
   QMutexLocker locker( &mMutex );
@@ -35,6 +39,61 @@ bool QgsAfsSharedData::getFeature( QgsFeatureId id, QgsFeature &f, const QgsRect
     return filterRect.isNull() || ( f.hasGeometry() && f.geometry().intersects( filterRect ) );
   }
 
+  const int startId = ( id / 100 ) * 100;
+
+  // If a read-ahead fetch of this feature's block is already underway, wait for it
+  // to complete instead of requesting the same block a second time
+  while ( mBlocksBeingFetched.contains( startId ) )
+  {
+    if ( feedback && feedback->isCanceled() )
+      return false;
+    mBlockFetched.wait( &mMutex, 500 );
+  }
+  it = mCache.constFind( id );
+  if ( it != mCache.constEnd() )
+  {
+    f = it.value();
+    return filterRect.isNull() || ( f.hasGeometry() && f.geometry().intersects( filterRect ) );
+  }
+
+  locker.unlock();
+  if ( !fetchFeatureBlock( startId, filterRect, feedback ) )
+    return false;
+  locker.relock();
+
+  // Read ahead the following block while the caller processes this one, so that
+  // sequential scans don't pay a full server round trip per block of features
+  const int nextStartId = startId + 100;
+  if ( nextStartId < mObjectIds.count() && !mCache.contains( nextStartId ) && !mBlocksBeingFetched.contains( nextStartId ) )
+  {
+    mBlocksBeingFetched.insert( nextStartId );
+    // the worker keeps this object alive -- iterators may be closed and the provider
+    // deleted while the fetch is still in flight
+    std::shared_ptr<QgsAfsSharedData> sharedThis = shared_from_this();
+    QtConcurrent::run( [sharedThis, nextStartId, filterRect]
+    {
+      sharedThis->fetchFeatureBlock( nextStartId, filterRect );
+      QMutexLocker locker( &sharedThis->mMutex );
+      sharedThis->mBlocksBeingFetched.remove( nextStartId );
+      sharedThis->mBlockFetched.wakeAll();
+    } );
+  }
+
+  // If added to cache, return feature
+  it = mCache.constFind( id );
+  if ( it != mCache.constEnd() )
+  {
+    f = it.value();
+    return filterRect.isNull() || ( f.hasGeometry() && f.geometry().intersects( filterRect ) );
+  }
+
+  return false;
+}
+
+bool QgsAfsSharedData::fetchFeatureBlock( int startId, const QgsRectangle &filterRect, QgsFeedback *feedback )
+{
+  QMutexLocker locker( &mMutex );
+
   // When fetching from server, fetch all attributes and geometry by default so that we can cache them
   QStringList fetchAttribNames;
   QList<int> fetchAttribIdx;
@@ -47,7 +106,6 @@ bool QgsAfsSharedData::getFeature( QgsFeatureId id, QgsFeature &f, const QgsRect
   }
 
   // Fetch 100 features at the time
-  int startId = ( id / 100 ) * 100;
   int stopId = std::min( startId + 100, mObjectIds.length() );
   QList<quint32> objectIds;
   objectIds.reserve( stopId );
@@ -75,7 +133,7 @@ bool QgsAfsSharedData::getFeature( QgsFeatureId id, QgsFeature &f, const QgsRect
   if ( !referer.isEmpty() )
     headers[ QStringLiteral( "Referer" )] = referer;
 
-  const QVariantMap queryData = QgsArcGisRestUtils::getObjects(
+  const QJsonObject queryData = QgsArcGisRestUtils::getObjects(
                                   mDataSource.param( QStringLiteral( "url" ) ), authcfg, objectIds, mDataSource.param( QStringLiteral( "crs" ) ), true,
                                   fetchAttribNames, QgsWkbTypes::hasM( mGeometryType ), QgsWkbTypes::hasZ( mGeometryType ),
                                   filterRect, errorTitle, errorMessage, headers, feedback );
@@ -89,27 +147,28 @@ bool QgsAfsSharedData::getFeature( QgsFeatureId id, QgsFeature &f, const QgsRect
 
   // but re-lock while updating cache
   locker.relock();
-  const QVariantList featuresData = queryData[QStringLiteral( "features" )].toList();
+  const QJsonArray featuresData = queryData.value( QStringLiteral( "features" ) ).toArray();
   if ( featuresData.isEmpty() )
   {
     QgsDebugMsgLevel( QStringLiteral( "Query returned no features" ), 3 );
     return false;
   }
+  const QString geometryType = queryData.value( QStringLiteral( "geometryType" ) ).toString();
   for ( int i = 0, n = featuresData.size(); i < n; ++i )
   {
-    const QVariantMap featureData = featuresData[i].toMap();
+    const QJsonObject featureData = featuresData.at( i ).toObject();
     QgsFeature feature;
     int featureId = startId + i;
 
     // Set attributes
     if ( !fetchAttribIdx.isEmpty() )
     {
-      const QVariantMap attributesData = featureData[QStringLiteral( "attributes" )].toMap();
+      const QJsonObject attributesData = featureData.value( QStringLiteral( "attributes" ) ).toObject();
       feature.setFields( mFields );
       QgsAttributes attributes( mFields.size() );
       for ( int idx : qgis::as_const( fetchAttribIdx ) )
       {
-        QVariant attribute = attributesData[mFields.at( idx ).name()];
+        QVariant attribute = attributesData.value( mFields.at( idx ).name() ).toVariant();
         if ( attribute.isNull() )
         {
           // ensure that null values are mapped correctly for PyQGIS
@@ -122,23 +181,24 @@ bool QgsAfsSharedData::getFeature( QgsFeatureId id, QgsFeature &f, const QgsRect
 
         if ( !mFields.at( idx ).convertCompatible( attribute ) )
         {
-          QgsDebugMsg( QStringLiteral( "Invalid value %1 for field %2 of type %3" ).arg( attributesData[mFields.at( idx ).name()].toString(), mFields.at( idx ).name(), mFields.at( idx ).typeName() ) );
+          QgsDebugMsg( QStringLiteral( "Invalid value %1 for field %2 of type %3" ).arg( attributesData.value( mFields.at( idx ).name() ).toVariant().toString(), mFields.at( idx ).name(), mFields.at( idx ).typeName() ) );
         }
         attributes[idx] = attribute;
         if ( mFields.at( idx ).name() == mObjectIdFieldName )
         {
-          featureId = startId + objectIds.indexOf( attributesData[mFields.at( idx ).name()].toInt() );
+          featureId = startId + objectIds.indexOf( attributesData.value( mFields.at( idx ).name() ).toInt() );
         }
       }
-      feature.setAttributes( attributes );
+      feature.setAttributes( std::move( attributes ) );
     }
 
     // Set FID
     feature.setId( featureId );
 
-    // Set geometry
-    const QVariantMap geometryData = featureData[QStringLiteral( "geometry" )].toMap();
-    std::unique_ptr< QgsAbstractGeometry > geometry = QgsArcGisRestUtils::parseEsriGeoJSON( geometryData, queryData[QStringLiteral( "geometryType" )].toString(),
+    // Set geometry -- only this feature's geometry subtree is converted to variants
+    // for the parser, the rest of the reply document stays in Qt's binary JSON form
+    const QVariantMap geometryData = featureData.value( QStringLiteral( "geometry" ) ).toObject().toVariantMap();
+    std::unique_ptr< QgsAbstractGeometry > geometry = QgsArcGisRestUtils::parseEsriGeoJSON( geometryData, geometryType,
         QgsWkbTypes::hasM( mGeometryType ), QgsWkbTypes::hasZ( mGeometryType ) );
     // Above might return 0, which is OK since in theory empty geometries are allowed
     if ( geometry )
@@ -147,15 +207,7 @@ bool QgsAfsSharedData::getFeature( QgsFeatureId id, QgsFeature &f, const QgsRect
     mCache.insert( feature.id(), feature );
   }
 
-  // If added to cache, return feature
-  it = mCache.constFind( id );
-  if ( it != mCache.constEnd() )
-  {
-    f = it.value();
-    return filterRect.isNull() || ( f.hasGeometry() && f.geometry().intersects( filterRect ) );
-  }
-
-  return false;
+  return true;
 }
 
 QgsFeatureIds QgsAfsSharedData::getFeatureIdsInExtent( const QgsRectangle &extent, QgsFeedback *feedback )
@@ -16,8 +16,12 @@
 #ifndef QGSAFSSHAREDDATA_H
 #define QGSAFSSHAREDDATA_H
 
+#include <memory>
+
 #include <QObject>
 #include <QMutex>
+#include <QSet>
+#include <QWaitCondition>
 #include "qgsfields.h"
 #include "qgsfeature.h"
 #include "qgsdatasourceuri.h"
@@ -27,7 +31,7 @@ class QgsFeedback;
 /**
  * \brief This class holds data, shared between QgsAfsProvider and QgsAfsFeatureIterator
  **/
-class QgsAfsSharedData : public QObject
+class QgsAfsSharedData : public QObject, public std::enable_shared_from_this<QgsAfsSharedData>
 {
     Q_OBJECT
   public:
@@ -45,7 +49,13 @@ class QgsAfsSharedData : public QObject
 
   private:
     friend class QgsAfsProvider;
+
+    //! Fetches the block of 100 features starting at \a startId from the server into the cache
+    bool fetchFeatureBlock( int startId, const QgsRectangle &filterRect = QgsRectangle(), QgsFeedback *feedback = nullptr );
+
     QMutex mMutex;
+    //! Signalled whenever a read-ahead block fetch completes
+    QWaitCondition mBlockFetched;
     QgsDataSourceUri mDataSource;
     QgsRectangle mExtent;
     QgsWkbTypes::Type mGeometryType = QgsWkbTypes::Unknown;
@@ -53,6 +63,8 @@ class QgsAfsSharedData : public QObject
     QString mObjectIdFieldName;
     QList<quint32> mObjectIds;
     QMap<QgsFeatureId, QgsFeature> mCache;
+    //! Start ids of blocks currently being fetched by read-ahead threads
+    QSet<int> mBlocksBeingFetched;
     QgsCoordinateReferenceSystem mSourceCRS;
 };
 
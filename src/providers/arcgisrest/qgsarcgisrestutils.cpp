@@ -419,7 +419,7 @@ QVariantMap QgsArcGisRestUtils::getObjectIds( const QString &layerurl, const QSt
   return queryServiceJSON( queryUrl, authcfg, errorTitle, errorText, requestHeaders );
 }
 
-QVariantMap QgsArcGisRestUtils::getObjects( const QString &layerurl, const QString &authcfg, const QList<quint32> &objectIds, const QString &crs,
+QJsonObject QgsArcGisRestUtils::getObjects( const QString &layerurl, const QString &authcfg, const QList<quint32> &objectIds, const QString &crs,
     bool fetchGeometry, const QStringList &fetchAttributes,
     bool fetchM, bool fetchZ,
     const QgsRectangle &filterRect,
@@ -457,7 +457,7 @@ QVariantMap QgsArcGisRestUtils::getObjects( const QString &layerurl, const QStri
     queryUrl.addQueryItem( QStringLiteral( "geometryType" ), QStringLiteral( "esriGeometryEnvelope" ) );
     queryUrl.addQueryItem( QStringLiteral( "spatialRel" ), QStringLiteral( "esriSpatialRelEnvelopeIntersects" ) );
   }
-  return queryServiceJSON( queryUrl,  authcfg, errorTitle, errorText, requestHeaders, feedback );
+  return queryServiceJSONObject( queryUrl,  authcfg, errorTitle, errorText, requestHeaders, feedback );
 }
 
 QList<quint32> QgsArcGisRestUtils::getObjectIdsByExtent( const QString &layerurl, const QgsRectangle &filterRect, QString &errorTitle, QString &errorText, const QString &authcfg, const QgsStringMap &requestHeaders, QgsFeedback *feedback )
@@ -520,14 +520,19 @@ QByteArray QgsArcGisRestUtils::queryService( const QUrl &u, const QString &authc
 }
 
 QVariantMap QgsArcGisRestUtils::queryServiceJSON( const QUrl &url, const QString &authcfg, QString &errorTitle, QString &errorText, const QgsStringMap &requestHeaders, QgsFeedback *feedback )
+{
+  return queryServiceJSONObject( url, authcfg, errorTitle, errorText, requestHeaders, feedback ).toVariantMap();
+}
+
+QJsonObject QgsArcGisRestUtils::queryServiceJSONObject( const QUrl &url, const QString &authcfg, QString &errorTitle, QString &errorText, const QgsStringMap &requestHeaders, QgsFeedback *feedback )
 {
   QByteArray reply = queryService( url, authcfg, errorTitle, errorText, requestHeaders, feedback );
   if ( !errorTitle.isEmpty() )
   {
-    return QVariantMap();
+    return QJsonObject();
   }
   if ( feedback && feedback->isCanceled() )
-    return QVariantMap();
+    return QJsonObject();
 
   // Parse data
   QJsonParseError err;
@@ -537,15 +542,15 @@ QVariantMap QgsArcGisRestUtils::queryServiceJSON( const QUrl &url, const QString
     errorTitle = QStringLiteral( "Parsing error" );
     errorText = err.errorString();
     QgsDebugMsg( QStringLiteral( "Parsing error: %1" ).arg( err.errorString() ) );
-    return QVariantMap();
+    return QJsonObject();
   }
-  const QVariantMap res = doc.object().toVariantMap();
+  const QJsonObject res = doc.object();
   if ( res.contains( QStringLiteral( "error" ) ) )
   {
-    const QVariantMap error = res.value( QStringLiteral( "error" ) ).toMap();
+    const QJsonObject error = res.value( QStringLiteral( "error" ) ).toObject();
     errorText = error.value( QStringLiteral( "message" ) ).toString();
-    errorTitle = QObject::tr( "Error %1" ).arg( error.value( QStringLiteral( "code" ) ).toString() );
-    return QVariantMap();
+    errorTitle = QObject::tr( "Error %1" ).arg( error.value( QStringLiteral( "code" ) ).toVariant().toString() );
+    return QJsonObject();
   }
   return res;
 }
@@ -18,6 +18,7 @@
 #include "qgsdelimitedtextprovider.h"
 
 #include <QtGlobal>
+#include <QDateTime>
 #include <QFile>
 #include <QFileInfo>
 #include <QDataStream>
@@ -141,6 +142,11 @@ QgsDelimitedTextProvider::QgsDelimitedTextProvider( const QString &uri, const Pr
     mBuildSpatialIndex = ! url.queryItemValue( QStringLiteral( "spatialIndex" ) ).toLower().startsWith( 'n' );
   }
 
+  if ( url.hasQueryItem( QStringLiteral( "scanCache" ) ) )
+  {
+    mUseScanCache = ! url.queryItemValue( QStringLiteral( "scanCache" ) ).toLower().startsWith( 'n' );
+  }
+
   if ( url.hasQueryItem( QStringLiteral( "subset" ) ) )
   {
     // We need to specify FullyDecoded so that %25 is decoded as %
@@ -282,6 +288,178 @@ bool QgsDelimitedTextProvider::createSpatialIndex()
   return true;
 }
 
+// Sidecar cache of scan results.  Scanning a large file is expensive (the
+// whole file is parsed to determine field types, the extent and the feature
+// count, and to build the indexes), so with scanCache=yes the results are
+// written to a binary sidecar next to the file and restored on subsequent
+// opens as long as the file and the scan parameters are unchanged.
+
+static const quint32 SCAN_CACHE_MAGIC = 0x51474454; // "QGDT"
+static const quint32 SCAN_CACHE_VERSION = 1;
+
+QString QgsDelimitedTextProvider::scanCacheFileName() const
+{
+  return mFile->fileName() + QStringLiteral( ".qgsidx" );
+}
+
+QString QgsDelimitedTextProvider::scanCacheSignature() const
+{
+  // the file url covers the delimiter configuration, the remaining parts are
+  // the provider level parameters which influence the scan
+  return QStringLiteral( "%1|%2|%3|%4|%5|%6|%7" )
+         .arg( mFile->url().toString() )
+         .arg( mGeomRep )
+         .arg( mWktFieldName, mXFieldName, mYFieldName, mDecimalPoint )
+         .arg( QStringLiteral( "%1,%2" ).arg( mXyDms ).arg( mDetectTypes ) );
+}
+
+bool QgsDelimitedTextProvider::loadScanCache( bool buildSpatialIndex, bool buildSubsetIndex )
+{
+  QFile cacheFile( scanCacheFileName() );
+  if ( !cacheFile.open( QIODevice::ReadOnly ) )
+    return false;
+
+  QDataStream stream( &cacheFile );
+  stream.setVersion( QDataStream::Qt_5_0 );
+
+  quint32 magic = 0;
+  quint32 version = 0;
+  QString signature;
+  qint64 fileSize = 0;
+  qint64 fileModified = 0;
+  stream >> magic >> version >> signature >> fileSize >> fileModified;
+
+  QFileInfo fi( mFile->fileName() );
+  if ( magic != SCAN_CACHE_MAGIC
+       || version != SCAN_CACHE_VERSION
+       || signature != scanCacheSignature()
+       || fileSize != fi.size()
+       || fileModified != fi.lastModified().toMSecsSinceEpoch() )
+    return false;
+
+  bool cacheHasSpatialIndex = false;
+  bool cacheHasSubsetIndex = false;
+  stream >> cacheHasSpatialIndex >> cacheHasSubsetIndex;
+  if ( cacheHasSpatialIndex != buildSpatialIndex || cacheHasSubsetIndex != buildSubsetIndex )
+    return false;
+
+  qint32 geometryType = 0;
+  qint32 wkbType = 0;
+  qint64 numberFeatures = 0;
+  qint32 fieldCount = 0;
+  double xmin = 0, ymin = 0, xmax = 0, ymax = 0;
+  stream >> geometryType >> wkbType >> mWktHasPrefix;
+  stream >> xmin >> ymin >> xmax >> ymax;
+  stream >> numberFeatures >> fieldCount;
+
+  QList<int> columns;
+  stream >> columns;
+
+  qint32 nFields = 0;
+  stream >> nFields;
+  QgsFields fields;
+  for ( qint32 i = 0; i < nFields; i++ )
+  {
+    QgsField field;
+    stream >> field;
+    fields.append( field );
+  }
+
+  bool useSubsetIndex = false;
+  QVector<quint64> subsetIndex;
+  stream >> useSubsetIndex >> subsetIndex;
+
+  QVector<quint64> indexIds;
+  QVector<QgsRectangle> indexRects;
+  if ( cacheHasSpatialIndex )
+  {
+    qint32 nIndexed = 0;
+    stream >> nIndexed;
+    indexIds.reserve( nIndexed );
+    indexRects.reserve( nIndexed );
+    for ( qint32 i = 0; i < nIndexed; i++ )
+    {
+      quint64 id = 0;
+      double rxmin = 0, rymin = 0, rxmax = 0, rymax = 0;
+      stream >> id >> rxmin >> rymin >> rxmax >> rymax;
+      indexIds.append( id );
+      indexRects.append( QgsRectangle( rxmin, rymin, rxmax, rymax ) );
+    }
+  }
+
+  if ( stream.status() != QDataStream::Ok )
+    return false;
+
+  // everything read successfully - apply
+  mGeometryType = static_cast< QgsWkbTypes::GeometryType >( geometryType );
+  mWkbType = static_cast< QgsWkbTypes::Type >( wkbType );
+  mExtent = QgsRectangle( xmin, ymin, xmax, ymax );
+  mNumberFeatures = static_cast< long >( numberFeatures );
+  mFieldCount = fieldCount;
+  attributeColumns = columns;
+  attributeFields = fields;
+
+  mUseSubsetIndex = useSubsetIndex;
+  mSubsetIndex.clear();
+  for ( quint64 id : qgis::as_const( subsetIndex ) )
+    mSubsetIndex.append( static_cast< quintptr >( id ) );
+
+  if ( cacheHasSpatialIndex && mSpatialIndex )
+  {
+    for ( int i = 0; i < indexIds.size(); i++ )
+      mSpatialIndex->addFeature( static_cast< QgsFeatureId >( indexIds.at( i ) ), indexRects.at( i ) );
+  }
+  mUseSpatialIndex = cacheHasSpatialIndex;
+
+  QgsDebugMsg( QStringLiteral( "Restored delimited text scan results from %1" ).arg( scanCacheFileName() ) );
+  return true;
+}
+
+void QgsDelimitedTextProvider::saveScanCache( bool buildSpatialIndex, bool buildSubsetIndex, const QVector<quint64> &indexIds, const QVector<QgsRectangle> &indexRects ) const
+{
+  QFile cacheFile( scanCacheFileName() );
+  if ( !cacheFile.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+  {
+    QgsDebugMsg( QStringLiteral( "Cannot write delimited text scan cache %1" ).arg( scanCacheFileName() ) );
+    return;
+  }
+
+  QDataStream stream( &cacheFile );
+  stream.setVersion( QDataStream::Qt_5_0 );
+
+  QFileInfo fi( mFile->fileName() );
+  stream << SCAN_CACHE_MAGIC << SCAN_CACHE_VERSION << scanCacheSignature()
+         << static_cast< qint64 >( fi.size() ) << static_cast< qint64 >( fi.lastModified().toMSecsSinceEpoch() );
+
+  stream << buildSpatialIndex << buildSubsetIndex;
+
+  stream << static_cast< qint32 >( mGeometryType ) << static_cast< qint32 >( mWkbType ) << mWktHasPrefix;
+  stream << mExtent.xMinimum() << mExtent.yMinimum() << mExtent.xMaximum() << mExtent.yMaximum();
+  stream << static_cast< qint64 >( mNumberFeatures ) << static_cast< qint32 >( mFieldCount );
+
+  stream << attributeColumns;
+
+  stream << static_cast< qint32 >( attributeFields.count() );
+  for ( const QgsField &field : attributeFields )
+    stream << field;
+
+  QVector<quint64> subsetIndex;
+  subsetIndex.reserve( mSubsetIndex.size() );
+  for ( quintptr id : qgis::as_const( mSubsetIndex ) )
+    subsetIndex.append( static_cast< quint64 >( id ) );
+  stream << mUseSubsetIndex << subsetIndex;
+
+  if ( buildSpatialIndex )
+  {
+    stream << static_cast< qint32 >( indexIds.size() );
+    for ( int i = 0; i < indexIds.size(); i++ )
+    {
+      const QgsRectangle &rect = indexRects.at( i );
+      stream << indexIds.at( i ) << rect.xMinimum() << rect.yMinimum() << rect.xMaximum() << rect.yMaximum();
+    }
+  }
+}
+
 // Really want to merge scanFile and rescan into single code.  Currently the reason
 // this is not done is that scanFile is done initially to create field names and, rescan
 // file includes building subset expression and assumes field names/types are already
@@ -356,6 +534,19 @@ void QgsDelimitedTextProvider::scanFile( bool buildIndexes )
     return;
   }
 
+  // Try to restore a previous scan from the sidecar cache.  The cache is
+  // keyed on file size, modification time and scan parameters, so any change
+  // to the file or the layer definition forces a full scan.
+  if ( mUseScanCache && buildIndexes && loadScanCache( buildSpatialIndex, buildSubsetIndex ) )
+  {
+    mValid = mGeometryType != QgsWkbTypes::UnknownGeometry;
+    mLayerValid = mValid;
+
+    // If it is valid, then watch for changes to the file
+    connect( mFile.get(), &QgsDelimitedTextFile::fileUpdated, this, &QgsDelimitedTextProvider::onFileUpdated );
+    return;
+  }
+
   // Scan the entire file to determine
   // 1) the number of fields (this is handled by QgsDelimitedTextFile mFile
   // 2) the number of valid features.  Note that the selection of valid features
@@ -380,6 +571,11 @@ void QgsDelimitedTextProvider::scanFile( bool buildIndexes )
   QList<bool> couldBeDouble;
   bool foundFirstGeometry = false;
 
+  // record ids and bounding boxes of indexed features, for the sidecar cache
+  const bool collectIndexForCache = mUseScanCache && buildSpatialIndex;
+  QVector<quint64> cacheIndexIds;
+  QVector<QgsRectangle> cacheIndexRects;
+
   while ( true )
   {
     QgsDelimitedTextFile::Status status = mFile->nextRecord( parts );
@@ -448,6 +644,11 @@ void QgsDelimitedTextProvider::scanFile( bool buildIndexes )
                 f.setId( mFile->recordId() );
                 f.setGeometry( geom );
                 mSpatialIndex->addFeature( f );
+                if ( collectIndexForCache )
+                {
+                  cacheIndexIds.append( mFile->recordId() );
+                  cacheIndexRects.append( geom.boundingBox() );
+                }
               }
             }
             else
@@ -503,6 +704,11 @@ void QgsDelimitedTextProvider::scanFile( bool buildIndexes )
             f.setId( mFile->recordId() );
             f.setGeometry( QgsGeometry::fromPointXY( pt ) );
             mSpatialIndex->addFeature( f );
+            if ( collectIndexForCache )
+            {
+              cacheIndexIds.append( mFile->recordId() );
+              cacheIndexRects.append( QgsRectangle( pt.x(), pt.y(), pt.x(), pt.y() ) );
+            }
           }
         }
         else
@@ -684,6 +890,9 @@ void QgsDelimitedTextProvider::scanFile( bool buildIndexes )
   mValid = mGeometryType != QgsWkbTypes::UnknownGeometry;
   mLayerValid = mValid;
 
+  if ( mUseScanCache && buildIndexes && mLayerValid )
+    saveScanCache( buildSpatialIndex, buildSubsetIndex, cacheIndexIds, cacheIndexRects );
+
   // If it is valid, then watch for changes to the file
   connect( mFile.get(), &QgsDelimitedTextFile::fileUpdated, this, &QgsDelimitedTextProvider::onFileUpdated );
 }
@@ -209,6 +209,20 @@ class QgsDelimitedTextProvider : public QgsVectorDataProvider
     static bool pointFromXY( QString &sX, QString &sY, QgsPointXY &point, const QString &decimalPoint, bool xyDms );
     static double dmsStringToDouble( const QString &sX, bool *xOk );
 
+    //! Path of the binary sidecar file caching the results of a full scan
+    QString scanCacheFileName() const;
+    //! String identifying the scan parameters, invalidating the sidecar cache when they change
+    QString scanCacheSignature() const;
+
+    /**
+     * Restores fields, extent, feature count and indexes from the sidecar
+     * cache. Returns FALSE if the cache is missing, stale, or was built with
+     * different index requirements, in which case a full scan is needed.
+     */
+    bool loadScanCache( bool buildSpatialIndex, bool buildSubsetIndex );
+    //! Writes the results of a completed scan to the sidecar cache
+    void saveScanCache( bool buildSpatialIndex, bool buildSubsetIndex, const QVector<quint64> &indexIds, const QVector<QgsRectangle> &indexRects ) const;
+
     // mLayerValid defines whether the layer has been loaded as a valid layer
     bool mLayerValid = false;
     // mValid defines whether the layer is currently valid (may differ from
@@ -271,6 +285,9 @@ class QgsDelimitedTextProvider : public QgsVectorDataProvider
     QgsWkbTypes::Type mWkbType = QgsWkbTypes::NoGeometry;
     QgsWkbTypes::GeometryType mGeometryType = QgsWkbTypes::UnknownGeometry;
 
+    //! Whether scan results are persisted to (and restored from) a binary sidecar file
+    bool mUseScanCache = false;
+
     // Spatial index
     bool mBuildSpatialIndex = false;
     mutable bool mUseSpatialIndex;
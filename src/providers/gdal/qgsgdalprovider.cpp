@@ -168,6 +168,18 @@ QgsGdalProvider::QgsGdalProvider( const QString &uri, const ProviderOptions &opt
     CPLSetConfigOption( "AAIGRID_DATATYPE", "Float64" );
   }
 
+  if ( !CPLGetConfigOption( "GDAL_MAX_DATASET_POOL_SIZE", nullptr ) )
+  {
+    // GDAL's pool of open member datasets defaults to 100 handles, which
+    // thrashes badly on VRT mosaics built from thousands of files: every
+    // request touching more members constantly reopens them. Use a more
+    // mosaic-friendly default, tunable for installations that need to
+    // respect a low file descriptor limit. Must be set before the first
+    // VRT is opened, as GDAL instantiates the pool only once.
+    int poolSize = QgsSettings().value( QStringLiteral( "gdal/maxDatasetPoolSize" ), 450 ).toInt();
+    CPLSetConfigOption( "GDAL_MAX_DATASET_POOL_SIZE", QString::number( poolSize ).toUtf8().constData() );
+  }
+
 #if !(GDAL_VERSION_MAJOR > 2 || (GDAL_VERSION_MAJOR == 2 && GDAL_VERSION_MINOR >= 3))
   if ( !CPLGetConfigOption( "VRT_SHARED_SOURCE", nullptr ) )
   {
@@ -1706,6 +1718,12 @@ QString QgsGdalProvider::buildPyramids( const QList<QgsRasterPyramid> &rasterPyr
     }
   }
 
+  // let GDAL parallelize overview computation and compression across the
+  // available cores, unless the user already configured a specific value
+  myConfigOptionsOld[ QStringLiteral( "GDAL_NUM_THREADS" )] = QString( CPLGetConfigOption( "GDAL_NUM_THREADS", nullptr ) );
+  if ( !CPLGetConfigOption( "GDAL_NUM_THREADS", nullptr ) )
+    CPLSetConfigOption( "GDAL_NUM_THREADS", "ALL_CPUS" );
+
   // add any driver-specific configuration options, save values to be restored later
   if ( format != QgsRaster::PyramidsErdas && ! configOptions.isEmpty() )
   {
@@ -1780,10 +1798,29 @@ QString QgsGdalProvider::buildPyramids( const QList<QgsRasterPyramid> &rasterPyr
     myProg.type = QgsRaster::ProgressPyramids;
     myProg.provider = this;
     myProg.feedback = feedback;
-    myError = GDALBuildOverviews( mGdalBaseDataset, method,
-                                  myOverviewLevelsVector.size(), myOverviewLevelsVector.data(),
-                                  0, nullptr,
-                                  progressCallback, &myProg ); //this is the arg for the gdal progress callback
+
+    // Build one level per call instead of all levels at once: each completed
+    // level is flushed to disk before the next one starts, so a canceled
+    // build keeps its finished levels and a later run -- which only marks
+    // the still missing levels for building -- resumes where it stopped.
+    myError = CE_None;
+    for ( int levelIndex = 0; levelIndex < myOverviewLevelsVector.size(); levelIndex++ )
+    {
+      void *scaledProgress = GDALCreateScaledProgress(
+                               static_cast<double>( levelIndex ) / myOverviewLevelsVector.size(),
+                               static_cast<double>( levelIndex + 1 ) / myOverviewLevelsVector.size(),
+                               progressCallback, &myProg ); //this is the arg for the gdal progress callback
+      myError = GDALBuildOverviews( mGdalBaseDataset, method,
+                                    1, &myOverviewLevelsVector[levelIndex],
+                                    0, nullptr,
+                                    GDALScaledProgress, scaledProgress );
+      GDALDestroyScaledProgress( scaledProgress );
+
+      if ( ( feedback && feedback->isCanceled() ) || myError == CE_Failure || CPLGetLastErrorNo() == CPLE_NotSupported )
+        break;
+
+      GDALFlushCache( mGdalBaseDataset );
+    }
 
     if ( ( feedback && feedback->isCanceled() ) || myError == CE_Failure || CPLGetLastErrorNo() == CPLE_NotSupported )
     {
@@ -20,10 +20,25 @@
 #include "gdal_utils.h"
 #include "qgsogrutils.h"
 
+#include "qgis.h"
 #include "qgsgeopackagerasterwriter.h"
 #include "qgscplerrorhandler.h"
+#include "qgssqliteutils.h"
 
+#include <QFile>
 #include <QMessageBox>
+#include <QThread>
+#include <QtConcurrentRun>
+
+#include <atomic>
+#include <cmath>
+#include <sqlite3.h>
+
+//! Tile size the GeoPackage driver uses by default
+const int GPKG_TILE_SIZE = 256;
+
+//! Below this pixel count a single translate pass beats the strip setup cost
+const qint64 PARALLEL_WRITE_THRESHOLD = 16 * 1024 * 1024;
 
 QgsGeoPackageRasterWriter::QgsGeoPackageRasterWriter( const QgsMimeDataUtils::Uri &sourceUri, const QString &outputUrl ):
   mSourceUri( sourceUri ),
@@ -33,6 +48,14 @@ QgsGeoPackageRasterWriter::QgsGeoPackageRasterWriter( const QgsMimeDataUtils::Ur
 }
 
 QgsGeoPackageRasterWriter::WriterError QgsGeoPackageRasterWriter::writeRaster( QgsFeedback *feedback, QString *errorMessage )
+{
+  WriterError error = NoError;
+  if ( writeRasterParallel( feedback, errorMessage, error ) )
+    return error;
+  return writeRasterSequential( feedback, errorMessage );
+}
+
+QgsGeoPackageRasterWriter::WriterError QgsGeoPackageRasterWriter::writeRasterSequential( QgsFeedback *feedback, QString *errorMessage )
 {
   const char *args[] = { "-of", "gpkg", "-co", QStringLiteral( "RASTER_TABLE=%1" ).arg( mSourceUri.name ).toUtf8().constData(), "-co", "APPEND_SUBDATASET=YES", nullptr };
   // This sends OGR/GDAL errors to the message log
@@ -67,4 +90,237 @@ QgsGeoPackageRasterWriter::WriterError QgsGeoPackageRasterWriter::writeRaster( Q
   return ( feedback && feedback->isCanceled() ) ? ErrUserCanceled : ( mHasError ? WriteError : NoError );
 }
 
+namespace
+{
+
+  //! Shared progress state of the strip translate workers
+  struct StripProgress
+  {
+    QgsFeedback *feedback = nullptr;
+    std::vector< std::atomic< int > > *percentages = nullptr;
+    int stripIndex = 0;
+  };
+
+  int stripProgressCallback( double dfComplete, const char *pszMessage, void *pProgressData )
+  {
+    Q_UNUSED( pszMessage );
+    StripProgress *progress = static_cast< StripProgress * >( pProgressData );
+    ( *progress->percentages )[ progress->stripIndex ].store( static_cast< int >( dfComplete * 100 ) );
+    if ( progress->feedback )
+    {
+      int total = 0;
+      for ( const std::atomic< int > &stripPercent : *progress->percentages )
+        total += stripPercent.load();
+      progress->feedback->setProgress( static_cast< double >( total ) / progress->percentages->size() );
+      return ! progress->feedback->isCanceled();
+    }
+    return true;
+  }
+
+}
+
+bool QgsGeoPackageRasterWriter::writeRasterParallel( QgsFeedback *feedback, QString *errorMessage, WriterError &error )
+{
+  const int threadCount = QThread::idealThreadCount();
+  if ( threadCount < 2 )
+    return false;
+
+  gdal::dataset_unique_ptr hSrcDS( GDALOpen( mSourceUri.uri.toUtf8().constData(), GA_ReadOnly ) );
+  if ( ! hSrcDS )
+  {
+    // let the sequential writer produce its usual error message
+    return false;
+  }
+
+  const int width = GDALGetRasterXSize( hSrcDS.get() );
+  const int height = GDALGetRasterYSize( hSrcDS.get() );
+  if ( static_cast< qint64 >( width ) * height < PARALLEL_WRITE_THRESHOLD )
+    return false;
+
+  // tile based merging relies on the strip grids lining up with the output
+  // grid, which only holds for unrotated north-up rasters
+  double geoTransform[6];
+  if ( GDALGetGeoTransform( hSrcDS.get(), geoTransform ) != CE_None
+       || !qgsDoubleNear( geoTransform[2], 0.0 ) || !qgsDoubleNear( geoTransform[4], 0.0 )
+       || geoTransform[1] <= 0 || geoTransform[5] >= 0 )
+    return false;
+
+  // non Byte sources are written as gridded coverages with extra metadata
+  // tables, keep those on the plain path
+  if ( GDALGetRasterDataType( GDALGetRasterBand( hSrcDS.get(), 1 ) ) != GDT_Byte )
+    return false;
+
+  // split into row strips aligned to the tile grid, so that every strip except
+  // the last holds complete tiles only and its tiles map 1:1 onto output tiles
+  const int tileRows = ( height + GPKG_TILE_SIZE - 1 ) / GPKG_TILE_SIZE;
+  const int tileRowsPerStrip = std::max( 1, ( tileRows + threadCount - 1 ) / threadCount );
+  const int stripCount = ( tileRows + tileRowsPerStrip - 1 ) / tileRowsPerStrip;
+  if ( stripCount < 2 )
+    return false;
+
+  QgsCPLErrorHandler handler;
+  CPLErrorReset();
+
+  std::vector< std::atomic< int > > stripPercentages( stripCount );
+  for ( std::atomic< int > &stripPercent : stripPercentages )
+    stripPercent.store( 0 );
+  std::vector< StripProgress > stripProgresses( stripCount );
+
+  const QString tableName = mSourceUri.name;
+  QStringList stripFiles;
+  for ( int i = 0; i < stripCount; i++ )
+  {
+    // the first strip is translated straight into the output file and
+    // creates the table; the others go to temporary files merged in below
+    stripFiles << ( i == 0 ? mOutputUrl : mOutputUrl + QStringLiteral( ".strip_%1.tmp" ).arg( i ) );
+  }
+
+  std::atomic< bool > translateFailed( false );
+  const QString sourceUri = mSourceUri.uri;
+  const auto translateStrip = [&]( int stripIndex )
+  {
+    if ( translateFailed.load() || ( feedback && feedback->isCanceled() ) )
+      return;
+
+    // GDAL datasets are not thread safe -- every worker opens its own handle
+    gdal::dataset_unique_ptr hStripSrcDS( GDALOpen( sourceUri.toUtf8().constData(), GA_ReadOnly ) );
+    if ( ! hStripSrcDS )
+    {
+      translateFailed.store( true );
+      return;
+    }
+
+    const int rowOffset = stripIndex * tileRowsPerStrip * GPKG_TILE_SIZE;
+    const int stripHeight = std::min( height - rowOffset, tileRowsPerStrip * GPKG_TILE_SIZE );
+
+    QList<QByteArray> argStorage;
+    argStorage << "-of" << "gpkg"
+               << "-co" << QStringLiteral( "RASTER_TABLE=%1" ).arg( tableName ).toUtf8()
+               << "-co" << "APPEND_SUBDATASET=YES"
+               << "-srcwin" << "0" << QByteArray::number( rowOffset )
+               << QByteArray::number( width ) << QByteArray::number( stripHeight );
+    QVector< char * > args;
+    for ( QByteArray &arg : argStorage )
+      args << arg.data();
+    args << nullptr;
+
+    GDALTranslateOptions *psOptions = GDALTranslateOptionsNew( args.data(), nullptr );
+    stripProgresses[ stripIndex ] = { feedback, &stripPercentages, stripIndex };
+    GDALTranslateOptionsSetProgress( psOptions, stripProgressCallback, &stripProgresses[ stripIndex ] );
+
+    gdal::dataset_unique_ptr hStripDS( GDALTranslate( stripFiles.at( stripIndex ).toUtf8().constData(), hStripSrcDS.get(), psOptions, nullptr ) );
+    if ( ! hStripDS )
+      translateFailed.store( true );
+    GDALTranslateOptionsFree( psOptions );
+  };
+
+  hSrcDS.reset();
+
+  QList< QFuture< void > > futures;
+  for ( int i = 0; i < stripCount; i++ )
+    futures << QtConcurrent::run( translateStrip, i );
+  for ( QFuture< void > &future : futures )
+    future.waitForFinished();
+
+  const auto removeStripFiles = [&stripFiles]()
+  {
+    for ( int i = 1; i < stripFiles.size(); i++ )
+      QFile::remove( stripFiles.at( i ) );
+  };
+
+  if ( feedback && feedback->isCanceled() )
+  {
+    removeStripFiles();
+    error = ErrUserCanceled;
+    return true;
+  }
+  if ( translateFailed.load() )
+  {
+    removeStripFiles();
+    *errorMessage = QObject::tr( "Failed to import layer %1! See the OGR panel in the message logs for details.\n\n" ).arg( mSourceUri.name );
+    mHasError = true;
+    error = WriteError;
+    return true;
+  }
+
+  // merge the strip tiles into the output table, one transaction per strip.
+  // every strip holds a single zoom level covering the same pixel grid as the
+  // output base level, shifted by a whole number of tile rows
+  bool mergeOk = true;
+  sqlite3_database_unique_ptr database;
+  if ( database.open_v2( mOutputUrl, SQLITE_OPEN_READWRITE, nullptr ) != SQLITE_OK )
+  {
+    mergeOk = false;
+  }
+  else
+  {
+    QString sqlError;
+    const QString quotedTable = QgsSqliteUtils::quotedIdentifier( tableName );
+    int baseZoom = 0;
+    int status;
+    sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "SELECT MAX(zoom_level) FROM gpkg_tile_matrix WHERE table_name=%1" )
+                                             .arg( QgsSqliteUtils::quotedString( tableName ) ), status );
+    if ( status == SQLITE_OK && sqlite3_step( statement.get() ) == SQLITE_ROW )
+      baseZoom = sqlite3_column_int( statement.get(), 0 );
+    else
+      mergeOk = false;
+
+    for ( int i = 1; mergeOk && i < stripCount; i++ )
+    {
+      const int tileRowOffset = i * tileRowsPerStrip;
+      mergeOk = database.exec( QStringLiteral( "ATTACH DATABASE %1 AS strip" ).arg( QgsSqliteUtils::quotedString( stripFiles.at( i ) ) ), sqlError ) == SQLITE_OK
+                && database.exec( QStringLiteral( "BEGIN" ), sqlError ) == SQLITE_OK
+                && database.exec( QStringLiteral( "INSERT INTO %1 (zoom_level, tile_column, tile_row, tile_data) "
+                                  "SELECT %2, tile_column, tile_row + %3, tile_data FROM strip.%1" )
+                                  .arg( quotedTable ).arg( baseZoom ).arg( tileRowOffset ), sqlError ) == SQLITE_OK
+                && database.exec( QStringLiteral( "COMMIT" ), sqlError ) == SQLITE_OK
+                && database.exec( QStringLiteral( "DETACH DATABASE strip" ), sqlError ) == SQLITE_OK;
+    }
+
+    // grow the tile matrix and the recorded extents from the first strip to
+    // the full raster
+    if ( mergeOk )
+    {
+      const double minY = geoTransform[3] + geoTransform[5] * height;
+      mergeOk = database.exec( QStringLiteral( "UPDATE gpkg_tile_matrix SET matrix_height=%1 WHERE table_name=%2 AND zoom_level=%3" )
+                               .arg( tileRows ).arg( QgsSqliteUtils::quotedString( tableName ) ).arg( baseZoom ), sqlError ) == SQLITE_OK
+                && database.exec( QStringLiteral( "UPDATE gpkg_tile_matrix_set SET min_y=%1 WHERE table_name=%2" )
+                                  .arg( qgsDoubleToString( minY ), QgsSqliteUtils::quotedString( tableName ) ), sqlError ) == SQLITE_OK
+                && database.exec( QStringLiteral( "UPDATE gpkg_contents SET min_y=%1 WHERE table_name=%2" )
+                                  .arg( qgsDoubleToString( minY ), QgsSqliteUtils::quotedString( tableName ) ), sqlError ) == SQLITE_OK;
+    }
+  }
+  database.reset();
+  removeStripFiles();
+
+  if ( ! mergeOk )
+  {
+    *errorMessage = QObject::tr( "Failed to import layer %1! See the OGR panel in the message logs for details.\n\n" ).arg( mSourceUri.name );
+    mHasError = true;
+    error = WriteError;
+    return true;
+  }
+
+  // build the pyramid from the merged base level. the sequential writer has
+  // never produced overview levels, so a failure here only costs quality of
+  // zoomed out display, not correctness
+  gdal::dataset_unique_ptr hOutDS( GDALOpenEx( QStringLiteral( "GPKG:%1:%2" ).arg( mOutputUrl, tableName ).toUtf8().constData(),
+                                   GDAL_OF_RASTER | GDAL_OF_UPDATE, nullptr, nullptr, nullptr ) );
+  if ( hOutDS )
+  {
+    QVector< int > levels;
+    for ( int level = 2; std::max( width, height ) / level >= GPKG_TILE_SIZE; level *= 2 )
+      levels << level;
+    if ( ! levels.isEmpty() )
+    {
+      GDALBuildOverviews( hOutDS.get(), "AVERAGE", levels.size(), levels.data(), 0, nullptr, nullptr, nullptr );
+    }
+  }
+
+  if ( feedback )
+    feedback->setProgress( 100 );
+  error = ( feedback && feedback->isCanceled() ) ? ErrUserCanceled : NoError;
+  return true;
+}
+
 ///@endcond
@@ -40,6 +40,19 @@ class QgsGeoPackageRasterWriter
     const QString outputUrl() const { return mOutputUrl; }
 
   private:
+
+    //! Single GDALTranslate pass over the whole source, used when the parallel path does not apply
+    WriterError writeRasterSequential( QgsFeedback *feedback, QString *errorMessage );
+
+    /**
+     * Translates the source in parallel row strips which are merged into the
+     * output with batched SQLite inserts, then builds the pyramid levels.
+     * Returns FALSE if the source or output do not qualify for the strip
+     * path, in which case the caller must fall back to the sequential writer
+     * and \a error is left untouched.
+     */
+    bool writeRasterParallel( QgsFeedback *feedback, QString *errorMessage, WriterError &error );
+
     QgsMimeDataUtils::Uri mSourceUri;
     QString mOutputUrl;
     bool mHasError = false;
@@ -14,8 +14,13 @@
  ***************************************************************************/
 
 #include "qgsogrconnpool.h"
+#include "qgsapplication.h"
 #include "qgslogger.h"
 
+#include <QtConcurrentRun>
+
+#include <algorithm>
+
 QgsOgrConnPool *QgsOgrConnPool::sInstance = nullptr;
 
 // static public
@@ -40,4 +45,52 @@ QgsOgrConnPool::QgsOgrConnPool() : QgsConnectionPool<QgsOgrConn *, QgsOgrConnPoo
 QgsOgrConnPool::~QgsOgrConnPool()
 {
   QgsDebugCall;
+  for ( QFuture< void > &future : mWarmupFutures )
+  {
+    future.waitForFinished();
+  }
+}
+
+void QgsOgrConnPool::warmupConnections( const QString &connInfo )
+{
+  {
+    QMutexLocker locker( &mWarmupMutex );
+    if ( mWarmedUpGroups.contains( connInfo ) )
+      return;
+    mWarmedUpGroups.insert( connInfo );
+
+    // prune futures of warmups which have completed in the meantime
+    mWarmupFutures.erase( std::remove_if( mWarmupFutures.begin(), mWarmupFutures.end(),
+                                          []( const QFuture< void > &f ) { return f.isFinished(); } ),
+                          mWarmupFutures.end() );
+  }
+
+  // keep the group alive while the background task runs
+  ref( connInfo );
+
+  const QFuture< void > future = QtConcurrent::run( [this, connInfo]
+  {
+    const int targetCount = std::min( QgsApplication::instance()->maxConcurrentConnectionsPerPool(),
+                                      std::max( 1, QgsApplication::maxThreads() ) );
+    QVector< QgsOgrConn * > conns;
+    conns.reserve( targetCount );
+    for ( int i = 0; i < targetCount; ++i )
+    {
+      // don't block - if the pool is busy the render threads are already
+      // opening datasets themselves and warming up would add nothing
+      QgsOgrConn *conn = acquireConnection( connInfo, 0 );
+      if ( !conn )
+        break;
+      conns.append( conn );
+      if ( !conn->ds )
+        break; // dataset cannot be opened - no point in trying again
+    }
+    for ( QgsOgrConn *conn : qgis::as_const( conns ) )
+      releaseConnection( conn );
+
+    unref( connInfo );
+  } );
+
+  QMutexLocker locker( &mWarmupMutex );
+  mWarmupFutures.append( future );
 }
@@ -20,6 +20,9 @@
 #include "qgsogrprovider.h"
 #include <gdal.h>
 
+#include <QFuture>
+#include <QSet>
+
 
 struct QgsOgrConn
 {
@@ -162,10 +165,26 @@ class QgsOgrConnPool : public QgsConnectionPool<QgsOgrConn *, QgsOgrConnPoolGrou
       mMutex.unlock();
     }
 
+    /**
+     * \brief Opens as many connections for \a connInfo as a parallel render may
+     * use concurrently and hands them straight back to the pool.
+     *
+     * The datasets are opened in a background task so callers are not blocked;
+     * a later parallel render then finds idle connections instead of
+     * serializing on dataset opens. Each pool group is only ever warmed up
+     * once per session.
+     * \since QGIS 3.8
+     */
+    void warmupConnections( const QString &connInfo );
+
   private:
     QgsOgrConnPool();
     ~QgsOgrConnPool() override;
     static QgsOgrConnPool *sInstance;
+
+    QMutex mWarmupMutex;
+    QSet<QString> mWarmedUpGroups;
+    QVector< QFuture< void > > mWarmupFutures;
 };
 
 
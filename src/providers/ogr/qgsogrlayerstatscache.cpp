@@ -0,0 +1,152 @@
+/***************************************************************************
+                         qgsogrlayerstatscache.cpp
+                         -------------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by the QGIS development team
+    email                :
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "qgsogrlayerstatscache.h"
+#include "qgis.h"
+#include "qgsapplication.h"
+#include "qgslogger.h"
+#include "qgssettings.h"
+
+#include <QDir>
+#include <QFileInfo>
+
+#include <sqlite3.h>
+
+QgsOgrLayerStatsCache *QgsOgrLayerStatsCache::instance()
+{
+  static QgsOgrLayerStatsCache sInstance;
+  return &sInstance;
+}
+
+bool QgsOgrLayerStatsCache::isEnabled()
+{
+  static bool sEnabled = QgsSettings().value( QStringLiteral( "qgis/ogrLayerMetadataCache" ), false ).toBool();
+  return sEnabled;
+}
+
+bool QgsOgrLayerStatsCache::ensureDatabase()
+{
+  if ( mOpenAttempted )
+    return static_cast< bool >( mDatabase );
+
+  mOpenAttempted = true;
+
+  const QString path = QgsApplication::qgisSettingsDirPath() + QStringLiteral( "cache/ogr-layer-stats.sqlite" );
+  QDir().mkpath( QFileInfo( path ).absolutePath() );
+  if ( mDatabase.open_v2( path, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr ) != SQLITE_OK )
+  {
+    QgsDebugMsg( QStringLiteral( "Could not open OGR layer stats cache %1: %2" ).arg( path, mDatabase.errorMessage() ) );
+    mDatabase.reset();
+    return false;
+  }
+
+  QString errorMessage;
+  if ( mDatabase.exec( QStringLiteral( "CREATE TABLE IF NOT EXISTS layer_stats("
+                                       "uri TEXT PRIMARY KEY,"
+                                       "modified INTEGER NOT NULL,"
+                                       "feature_count INTEGER,"
+                                       "xmin REAL, ymin REAL, xmax REAL, ymax REAL)" ), errorMessage ) != SQLITE_OK )
+  {
+    QgsDebugMsg( QStringLiteral( "Could not initialize OGR layer stats cache: %1" ).arg( errorMessage ) );
+    mDatabase.reset();
+    return false;
+  }
+
+  return true;
+}
+
+bool QgsOgrLayerStatsCache::cachedFeatureCount( const QString &uri, const QDateTime &lastModified, long &count )
+{
+  QMutexLocker locker( &mMutex );
+  if ( !ensureDatabase() )
+    return false;
+
+  int resultCode = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = mDatabase.prepare(
+        QStringLiteral( "SELECT feature_count FROM layer_stats WHERE uri=%1 AND modified=%2 AND feature_count IS NOT NULL" )
+        .arg( QgsSqliteUtils::quotedString( uri ) )
+        .arg( lastModified.toMSecsSinceEpoch() ), resultCode );
+  if ( resultCode != SQLITE_OK || statement.step() != SQLITE_ROW )
+    return false;
+
+  count = static_cast< long >( statement.columnAsInt64( 0 ) );
+  return true;
+}
+
+void QgsOgrLayerStatsCache::setCachedFeatureCount( const QString &uri, const QDateTime &lastModified, long count )
+{
+  QMutexLocker locker( &mMutex );
+  if ( !ensureDatabase() )
+    return;
+
+  // values stored for an older modification date are stale and dropped as a whole,
+  // while a matching row keeps its cached extent
+  const QString quotedUri = QgsSqliteUtils::quotedString( uri );
+  const qlonglong modified = lastModified.toMSecsSinceEpoch();
+  QString errorMessage;
+  if ( mDatabase.exec( QStringLiteral( "DELETE FROM layer_stats WHERE uri=%1 AND modified<>%2;"
+                                       "INSERT OR IGNORE INTO layer_stats(uri,modified) VALUES(%1,%2);"
+                                       "UPDATE layer_stats SET feature_count=%3 WHERE uri=%1" )
+                       .arg( quotedUri )
+                       .arg( modified )
+                       .arg( static_cast< qlonglong >( count ) ), errorMessage ) != SQLITE_OK )
+  {
+    QgsDebugMsg( QStringLiteral( "Could not store feature count for %1: %2" ).arg( uri, errorMessage ) );
+  }
+}
+
+bool QgsOgrLayerStatsCache::cachedExtent( const QString &uri, const QDateTime &lastModified, QgsRectangle &extent )
+{
+  QMutexLocker locker( &mMutex );
+  if ( !ensureDatabase() )
+    return false;
+
+  int resultCode = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = mDatabase.prepare(
+        QStringLiteral( "SELECT xmin,ymin,xmax,ymax FROM layer_stats WHERE uri=%1 AND modified=%2 AND xmin IS NOT NULL" )
+        .arg( QgsSqliteUtils::quotedString( uri ) )
+        .arg( lastModified.toMSecsSinceEpoch() ), resultCode );
+  if ( resultCode != SQLITE_OK || statement.step() != SQLITE_ROW )
+    return false;
+
+  extent.set( statement.columnAsDouble( 0 ), statement.columnAsDouble( 1 ),
+              statement.columnAsDouble( 2 ), statement.columnAsDouble( 3 ) );
+  return true;
+}
+
+void QgsOgrLayerStatsCache::setCachedExtent( const QString &uri, const QDateTime &lastModified, const QgsRectangle &extent )
+{
+  QMutexLocker locker( &mMutex );
+  if ( !ensureDatabase() )
+    return;
+
+  const QString quotedUri = QgsSqliteUtils::quotedString( uri );
+  const qlonglong modified = lastModified.toMSecsSinceEpoch();
+  QString errorMessage;
+  if ( mDatabase.exec( QStringLiteral( "DELETE FROM layer_stats WHERE uri=%1 AND modified<>%2;"
+                                       "INSERT OR IGNORE INTO layer_stats(uri,modified) VALUES(%1,%2);"
+                                       "UPDATE layer_stats SET xmin=%3,ymin=%4,xmax=%5,ymax=%6 WHERE uri=%1" )
+                       .arg( quotedUri )
+                       .arg( modified )
+                       .arg( qgsDoubleToString( extent.xMinimum() ),
+                             qgsDoubleToString( extent.yMinimum() ),
+                             qgsDoubleToString( extent.xMaximum() ),
+                             qgsDoubleToString( extent.yMaximum() ) ), errorMessage ) != SQLITE_OK )
+  {
+    QgsDebugMsg( QStringLiteral( "Could not store extent for %1: %2" ).arg( uri, errorMessage ) );
+  }
+}
@@ -0,0 +1,87 @@
+/***************************************************************************
+                         qgsogrlayerstatscache.h
+                         -----------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by the QGIS development team
+    email                :
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef QGSOGRLAYERSTATSCACHE_H
+#define QGSOGRLAYERSTATSCACHE_H
+
+#include "qgssqliteutils.h"
+#include "qgsrectangle.h"
+
+#include <QDateTime>
+#include <QMutex>
+#include <QString>
+
+/**
+ * \class QgsOgrLayerStatsCache
+ * \brief Persistent cache of expensive per-layer statistics (feature count and
+ * extent) for file based OGR sources.
+ *
+ * Some OGR drivers (notably CSV and GeoJSON) have to scan the complete file to
+ * answer a feature count or extent request, so reopening a project with many
+ * such layers repeats the same scans on every load. This cache stores the last
+ * computed values in a small SQLite database in the user profile, keyed by the
+ * layer URI and the datasource modification date, so the values are
+ * transparently invalidated whenever the underlying file changes.
+ *
+ * The cache is disabled by default and enabled with the
+ * "qgis/ogrLayerMetadataCache" setting. All methods are thread safe.
+ *
+ * \since QGIS 3.8
+ */
+class QgsOgrLayerStatsCache
+{
+  public:
+
+    //! Returns the singleton instance
+    static QgsOgrLayerStatsCache *instance();
+
+    //! Returns TRUE if the cache has been enabled in the settings
+    static bool isEnabled();
+
+    /**
+     * Retrieves the cached feature count for \a uri into \a count. Returns FALSE
+     * if no value is cached or the cached value was computed for a different
+     * modification date than \a lastModified.
+     */
+    bool cachedFeatureCount( const QString &uri, const QDateTime &lastModified, long &count );
+
+    //! Stores the feature \a count computed for \a uri at modification date \a lastModified
+    void setCachedFeatureCount( const QString &uri, const QDateTime &lastModified, long count );
+
+    /**
+     * Retrieves the cached extent for \a uri into \a extent. Returns FALSE if no
+     * value is cached or the cached value was computed for a different
+     * modification date than \a lastModified.
+     */
+    bool cachedExtent( const QString &uri, const QDateTime &lastModified, QgsRectangle &extent );
+
+    //! Stores the \a extent computed for \a uri at modification date \a lastModified
+    void setCachedExtent( const QString &uri, const QDateTime &lastModified, const QgsRectangle &extent );
+
+  private:
+
+    QgsOgrLayerStatsCache() = default;
+
+    //! Opens (and creates if needed) the cache database. Must be called with mMutex held.
+    bool ensureDatabase();
+
+    sqlite3_database_unique_ptr mDatabase;
+    bool mOpenAttempted = false;
+    QMutex mMutex;
+};
+
+#endif // QGSOGRLAYERSTATSCACHE_H
@@ -38,6 +38,7 @@ email                : sherman at mrcc.com
 #include "qgswkbtypes.h"
 #include "qgsnetworkaccessmanager.h"
 #include "qgsogrtransaction.h"
+#include "qgsogrlayerstatscache.h"
 #include "qgsgeopackageprojectstorage.h"
 #include "qgsprojectstorageregistry.h"
 
@@ -95,6 +96,8 @@ static OGRwkbGeometryType ogrWkbGeometryTypeFromName( const QString &typeName );
 
 static bool IsLocalFile( const QString &path );
 
+static QDateTime getLastModified( const QString &dsName );
+
 QMutex QgsOgrProviderUtils::sGlobalMutex( QMutex::Recursive );
 
 QMap< QgsOgrProviderUtils::DatasetIdentification,
@@ -1254,6 +1257,22 @@ QgsRectangle QgsOgrProvider::extent() const
     }
 #endif
 
+    // reuse the extent from a previous session when the file was not modified,
+    // since GetExtent() scans the whole file on drivers without extent metadata
+    QDateTime statsCacheStamp;
+    if ( QgsOgrLayerStatsCache::isEnabled() && !mForceRecomputeExtent && QFileInfo::exists( mFilePath ) )
+      statsCacheStamp = getLastModified( mFilePath );
+    QgsRectangle cachedExtent;
+    if ( statsCacheStamp.isValid() && QgsOgrLayerStatsCache::instance()->cachedExtent( dataSourceUri(), statsCacheStamp, cachedExtent ) )
+    {
+      mExtent->MinX = cachedExtent.xMinimum();
+      mExtent->MinY = cachedExtent.yMinimum();
+      mExtent->MaxX = cachedExtent.xMaximum();
+      mExtent->MaxY = cachedExtent.yMaximum();
+      mExtentRect = cachedExtent;
+      return mExtentRect;
+    }
+
     mExtent->MinX = std::numeric_limits<double>::max();
     mExtent->MinY = std::numeric_limits<double>::max();
     mExtent->MaxX = -std::numeric_limits<double>::max();
@@ -1286,6 +1305,10 @@ QgsRectangle QgsOgrProvider::extent() const
       mOgrLayer->ResetReading();
     }
 
+    if ( statsCacheStamp.isValid() && mExtent->MinX <= mExtent->MaxX )
+      QgsOgrLayerStatsCache::instance()->setCachedExtent( dataSourceUri(), statsCacheStamp,
+          QgsRectangle( mExtent->MinX, mExtent->MinY, mExtent->MaxX, mExtent->MaxY ) );
+
     QgsDebugMsg( QStringLiteral( "Finished get extent" ) );
   }
 
@@ -1629,6 +1652,8 @@ bool QgsOgrProvider::addFeatures( QgsFeatureList &flist, Flags flags )
 
   setRelevantFields( true, attributeIndexes() );
 
+  const bool rebuildSpatialIndex = dropSpatialIndexForBulkWrite( flist.size() );
+
   const bool inTransaction = startTransaction();
 
   bool returnvalue = true;
@@ -1645,6 +1670,9 @@ bool QgsOgrProvider::addFeatures( QgsFeatureList &flist, Flags flags )
     commitTransaction();
   }
 
+  if ( rebuildSpatialIndex )
+    createSpatialIndex();
+
   if ( !syncToDisc() )
   {
     returnvalue = false;
@@ -2039,68 +2067,40 @@ bool QgsOgrProvider::_setSubsetString( const QString &theSQL, bool updateFeature
 }
 
 
-bool QgsOgrProvider::changeAttributeValues( const QgsChangedAttributesMap &attr_map )
+void QgsOgrProvider::changeAttributesOfFeature( OGRFeatureH of, QgsFeatureId fid, const QgsAttributeMap &attr )
 {
-  if ( !doInitialActionsForEdition() )
-    return false;
-
-  if ( attr_map.isEmpty() )
-    return true;
-
-  clearMinMaxCache();
-
-  setRelevantFields( true, attributeIndexes() );
-
-  const bool inTransaction = startTransaction();
+  QgsLocaleNumC l;
 
-  for ( QgsChangedAttributesMap::const_iterator it = attr_map.begin(); it != attr_map.end(); ++it )
+  for ( QgsAttributeMap::const_iterator it2 = attr.begin(); it2 != attr.end(); ++it2 )
   {
-    QgsFeatureId fid = it.key();
-
-    const QgsAttributeMap &attr = it.value();
-    if ( attr.isEmpty() )
-      continue;
-
-    gdal::ogr_feature_unique_ptr of( mOgrLayer->GetFeature( FID_TO_NUMBER( fid ) ) );
-    if ( !of )
-    {
-      pushError( tr( "Feature %1 for attribute update not found." ).arg( fid ) );
-      continue;
-    }
-    mOgrLayer->ResetReading(); // needed for SQLite-based to clear iterator
-
-    QgsLocaleNumC l;
-
-    for ( QgsAttributeMap::const_iterator it2 = attr.begin(); it2 != attr.end(); ++it2 )
+    int f = it2.key();
+    if ( mFirstFieldIsFid )
     {
-      int f = it2.key();
-      if ( mFirstFieldIsFid )
+      if ( f == 0 )
       {
-        if ( f == 0 )
+        if ( it2->toLongLong() != fid )
         {
-          if ( it2->toLongLong() != fid )
-          {
-            pushError( tr( "Changing feature id of feature %1 is not allowed." ).arg( fid ) );
-            continue;
-          }
-        }
-        else
-        {
-          --f;
+          pushError( tr( "Changing feature id of feature %1 is not allowed." ).arg( fid ) );
+          continue;
         }
       }
-
-      OGRFieldDefnH fd = OGR_F_GetFieldDefnRef( of.get(), f );
-      if ( !fd )
+      else
       {
-        pushError( tr( "Field %1 of feature %2 doesn't exist." ).arg( f ).arg( fid ) );
-        continue;
+        --f;
       }
+    }
 
-      OGRFieldType type = OGR_Fld_GetType( fd );
+    OGRFieldDefnH fd = OGR_F_GetFieldDefnRef( of, f );
+    if ( !fd )
+    {
+      pushError( tr( "Field %1 of feature %2 doesn't exist." ).arg( f ).arg( fid ) );
+      continue;
+    }
 
-      if ( it2->isNull() || ( type != OFTString && it2->toString().isEmpty() ) )
-      {
+    OGRFieldType type = OGR_Fld_GetType( fd );
+
+    if ( it2->isNull() || ( type != OFTString && it2->toString().isEmpty() ) )
+    {
 // Starting with GDAL 2.2, there are 2 concepts: unset fields and null fields
 // whereas previously there was only unset fields. For a GeoJSON output,
 // leaving a field unset will cause it to not appear at all in the output
@@ -2109,79 +2109,112 @@ bool QgsOgrProvider::changeAttributeValues( const QgsChangedAttributesMap &attr_
 // field to not be present at all in the output, and thus on reading to
 // have disappeared. #16812
 #ifdef OGRNullMarker
-        OGR_F_SetFieldNull( of.get(), f );
+      OGR_F_SetFieldNull( of, f );
 #else
-        OGR_F_UnsetField( of.get(), f );
+      OGR_F_UnsetField( of, f );
 #endif
-      }
-      else
-      {
+    }
+    else
+    {
 
-        switch ( type )
+      switch ( type )
+      {
+        case OFTInteger:
+          OGR_F_SetFieldInteger( of, f, it2->toInt() );
+          break;
+        case OFTInteger64:
+          OGR_F_SetFieldInteger64( of, f, it2->toLongLong() );
+          break;
+        case OFTReal:
+          OGR_F_SetFieldDouble( of, f, it2->toDouble() );
+          break;
+        case OFTDate:
+          OGR_F_SetFieldDateTime( of, f,
+                                  it2->toDate().year(),
+                                  it2->toDate().month(),
+                                  it2->toDate().day(),
+                                  0, 0, 0,
+                                  0 );
+          break;
+        case OFTTime:
+          OGR_F_SetFieldDateTime( of, f,
+                                  0, 0, 0,
+                                  it2->toTime().hour(),
+                                  it2->toTime().minute(),
+                                  it2->toTime().second(),
+                                  0 );
+          break;
+        case OFTDateTime:
+          OGR_F_SetFieldDateTime( of, f,
+                                  it2->toDateTime().date().year(),
+                                  it2->toDateTime().date().month(),
+                                  it2->toDateTime().date().day(),
+                                  it2->toDateTime().time().hour(),
+                                  it2->toDateTime().time().minute(),
+                                  it2->toDateTime().time().second(),
+                                  0 );
+          break;
+        case OFTString:
         {
-          case OFTInteger:
-            OGR_F_SetFieldInteger( of.get(), f, it2->toInt() );
-            break;
-          case OFTInteger64:
-            OGR_F_SetFieldInteger64( of.get(), f, it2->toLongLong() );
-            break;
-          case OFTReal:
-            OGR_F_SetFieldDouble( of.get(), f, it2->toDouble() );
-            break;
-          case OFTDate:
-            OGR_F_SetFieldDateTime( of.get(), f,
-                                    it2->toDate().year(),
-                                    it2->toDate().month(),
-                                    it2->toDate().day(),
-                                    0, 0, 0,
-                                    0 );
-            break;
-          case OFTTime:
-            OGR_F_SetFieldDateTime( of.get(), f,
-                                    0, 0, 0,
-                                    it2->toTime().hour(),
-                                    it2->toTime().minute(),
-                                    it2->toTime().second(),
-                                    0 );
-            break;
-          case OFTDateTime:
-            OGR_F_SetFieldDateTime( of.get(), f,
-                                    it2->toDateTime().date().year(),
-                                    it2->toDateTime().date().month(),
-                                    it2->toDateTime().date().day(),
-                                    it2->toDateTime().time().hour(),
-                                    it2->toDateTime().time().minute(),
-                                    it2->toDateTime().time().second(),
-                                    0 );
-            break;
-          case OFTString:
-          {
-            QString stringValue;
+          QString stringValue;
 #if GDAL_VERSION_NUM >= GDAL_COMPUTE_VERSION(2,4,0)
-            if ( OGR_Fld_GetSubType( fd ) == OFSTJSON )
-              stringValue = jsonStringValue( it2.value() );
-            else
-              stringValue = it2->toString();
-#else
+          if ( OGR_Fld_GetSubType( fd ) == OFSTJSON )
+            stringValue = jsonStringValue( it2.value() );
+          else
             stringValue = it2->toString();
+#else
+          stringValue = it2->toString();
 #endif
-            OGR_F_SetFieldString( of.get(), f, textEncoding()->fromUnicode( stringValue ).constData() );
-            break;
-          }
-
-          case OFTBinary:
-          {
-            const QByteArray ba = it2->toByteArray();
-            OGR_F_SetFieldBinary( of.get(), f, ba.size(), const_cast< GByte * >( reinterpret_cast< const GByte * >( ba.data() ) ) );
-            break;
-          }
+          OGR_F_SetFieldString( of, f, textEncoding()->fromUnicode( stringValue ).constData() );
+          break;
+        }
 
-          default:
-            pushError( tr( "Type %1 of attribute %2 of feature %3 unknown." ).arg( type ).arg( fid ).arg( f ) );
-            break;
+        case OFTBinary:
+        {
+          const QByteArray ba = it2->toByteArray();
+          OGR_F_SetFieldBinary( of, f, ba.size(), const_cast< GByte * >( reinterpret_cast< const GByte * >( ba.data() ) ) );
+          break;
         }
+
+        default:
+          pushError( tr( "Type %1 of attribute %2 of feature %3 unknown." ).arg( type ).arg( fid ).arg( f ) );
+          break;
       }
     }
+  }
+}
+
+bool QgsOgrProvider::changeAttributeValues( const QgsChangedAttributesMap &attr_map )
+{
+  if ( !doInitialActionsForEdition() )
+    return false;
+
+  if ( attr_map.isEmpty() )
+    return true;
+
+  clearMinMaxCache();
+
+  setRelevantFields( true, attributeIndexes() );
+
+  const bool inTransaction = startTransaction();
+
+  for ( QgsChangedAttributesMap::const_iterator it = attr_map.begin(); it != attr_map.end(); ++it )
+  {
+    QgsFeatureId fid = it.key();
+
+    const QgsAttributeMap &attr = it.value();
+    if ( attr.isEmpty() )
+      continue;
+
+    gdal::ogr_feature_unique_ptr of( mOgrLayer->GetFeature( FID_TO_NUMBER( fid ) ) );
+    if ( !of )
+    {
+      pushError( tr( "Feature %1 for attribute update not found." ).arg( fid ) );
+      continue;
+    }
+    mOgrLayer->ResetReading(); // needed for SQLite-based to clear iterator
+
+    changeAttributesOfFeature( of.get(), fid, attr );
 
     if ( mOgrLayer->SetFeature( of.get() ) != OGRERR_NONE )
     {
@@ -2205,6 +2238,81 @@ bool QgsOgrProvider::changeAttributeValues( const QgsChangedAttributesMap &attr_
   return true;
 }
 
+bool QgsOgrProvider::changeGeometryOfFeature( OGRFeatureH of, QgsFeatureId fid, const QgsGeometry &geometry )
+{
+  OGRGeometryH newGeometry = nullptr;
+  QByteArray wkb = geometry.asWkb();
+  // We might receive null geometries. It is OK, but don't go through the
+  // OGR_G_CreateFromWkb() route then
+  if ( !wkb.isEmpty() )
+  {
+    //create an OGRGeometry
+    if ( OGR_G_CreateFromWkb( reinterpret_cast<unsigned char *>( const_cast<char *>( wkb.constData() ) ),
+                              mOgrLayer->GetSpatialRef(),
+                              &newGeometry,
+                              wkb.length() ) != OGRERR_NONE )
+    {
+      pushError( tr( "OGR error creating geometry for feature %1: %2" ).arg( fid ).arg( CPLGetLastErrorMsg() ) );
+      OGR_G_DestroyGeometry( newGeometry );
+      newGeometry = nullptr;
+      return false;
+    }
+
+    if ( !newGeometry )
+    {
+      pushError( tr( "OGR error in feature %1: geometry is null" ).arg( fid ) );
+      return false;
+    }
+
+    newGeometry = ConvertGeometryIfNecessary( newGeometry );
+  }
+
+  //set the new geometry
+  if ( OGR_F_SetGeometryDirectly( of, newGeometry ) != OGRERR_NONE )
+  {
+    pushError( tr( "OGR error setting geometry of feature %1: %2" ).arg( fid ).arg( CPLGetLastErrorMsg() ) );
+    // Shouldn't happen normally. If it happens, ownership of the geometry
+    // may be not really well defined, so better not destroy it, but just
+    // the feature.
+    return false;
+  }
+
+  return true;
+}
+
+bool QgsOgrProvider::dropSpatialIndexForBulkWrite( int featureCount )
+{
+  // below this size the per-row index updates are cheaper than a full rebuild
+  const int minFeatureCountForRebuild = 1000;
+  if ( featureCount < minFeatureCountForRebuild )
+    return false;
+
+  if ( mGDALDriverName != QLatin1String( "GPKG" ) || !mOgrOrigLayer )
+    return false;
+
+  QMutex *mutex = nullptr;
+  OGRLayerH layer = mOgrOrigLayer->getHandleAndMutex( mutex );
+  QByteArray geometryColumn( OGR_L_GetGeometryColumn( layer ) );
+  if ( geometryColumn.isEmpty() )
+    return false;
+
+  QByteArray args = quotedIdentifier( mOgrOrigLayer->name() ) + "," + quotedIdentifier( geometryColumn );
+
+  // only drop an index which actually exists, so that a layer created without
+  // one doesn't end up with an index it never asked for
+  QgsOgrLayerUniquePtr l = mOgrOrigLayer->ExecuteSQL( QByteArray( "SELECT HasSpatialIndex(" ) + args + ")" );
+  if ( !l )
+    return false;
+  gdal::ogr_feature_unique_ptr f( l->GetNextFeature() );
+  if ( !f || !OGR_F_GetFieldAsInteger( f.get(), 0 ) )
+    return false;
+
+  // updating the R-tree row by row is the dominant cost of big GeoPackage
+  // edits -- drop it for the duration of the batch and rebuild it in one go
+  mOgrOrigLayer->ExecuteSQLNoReturn( QByteArray( "SELECT DisableSpatialIndex(" ) + args + ")" );
+  return true;
+}
+
 bool QgsOgrProvider::changeGeometryValues( const QgsGeometryMap &geometry_map )
 {
   if ( !doInitialActionsForEdition() )
@@ -2212,6 +2320,8 @@ bool QgsOgrProvider::changeGeometryValues( const QgsGeometryMap &geometry_map )
 
   setRelevantFields( true, attributeIndexes() );
 
+  const bool rebuildSpatialIndex = dropSpatialIndexForBulkWrite( geometry_map.size() );
+
   const bool inTransaction = startTransaction();
 
   for ( QgsGeometryMap::const_iterator it = geometry_map.constBegin(); it != geometry_map.constEnd(); ++it )
@@ -2224,59 +2334,106 @@ bool QgsOgrProvider::changeGeometryValues( const QgsGeometryMap &geometry_map )
     }
     mOgrLayer->ResetReading(); // needed for SQLite-based to clear iterator
 
-    OGRGeometryH newGeometry = nullptr;
-    QByteArray wkb = it->asWkb();
-    // We might receive null geometries. It is OK, but don't go through the
-    // OGR_G_CreateFromWkb() route then
-    if ( !wkb.isEmpty() )
+    if ( !changeGeometryOfFeature( theOGRFeature.get(), it.key(), it.value() ) )
+      continue;
+
+    if ( mOgrLayer->SetFeature( theOGRFeature.get() ) != OGRERR_NONE )
     {
-      //create an OGRGeometry
-      if ( OGR_G_CreateFromWkb( reinterpret_cast<unsigned char *>( const_cast<char *>( wkb.constData() ) ),
-                                mOgrLayer->GetSpatialRef(),
-                                &newGeometry,
-                                wkb.length() ) != OGRERR_NONE )
-      {
-        pushError( tr( "OGR error creating geometry for feature %1: %2" ).arg( it.key() ).arg( CPLGetLastErrorMsg() ) );
-        OGR_G_DestroyGeometry( newGeometry );
-        newGeometry = nullptr;
-        continue;
-      }
+      pushError( tr( "OGR error setting feature %1: %2" ).arg( it.key() ).arg( CPLGetLastErrorMsg() ) );
+      continue;
+    }
+    mShapefileMayBeCorrupted = true;
 
-      if ( !newGeometry )
-      {
-        pushError( tr( "OGR error in feature %1: geometry is null" ).arg( it.key() ) );
-        continue;
-      }
+    invalidateCachedExtent( true );
+  }
 
-      newGeometry = ConvertGeometryIfNecessary( newGeometry );
-    }
+  if ( inTransaction )
+  {
+    commitTransaction();
+  }
+
+  if ( rebuildSpatialIndex )
+    createSpatialIndex();
+
+  if ( mTransaction )
+    mTransaction->dirtyLastSavePoint();
+
+  QgsOgrConnPool::instance()->invalidateConnections( QgsOgrProviderUtils::connectionPoolId( dataSourceUri( true ), mShareSameDatasetAmongLayers ) );
+  return syncToDisc();
+}
+
+bool QgsOgrProvider::changeFeatures( const QgsChangedAttributesMap &attr_map, const QgsGeometryMap &geometry_map )
+{
+  if ( !doInitialActionsForEdition() )
+    return false;
+
+  if ( attr_map.isEmpty() && geometry_map.isEmpty() )
+    return true;
+
+  if ( !attr_map.isEmpty() )
+    clearMinMaxCache();
+
+  setRelevantFields( true, attributeIndexes() );
+
+  const bool rebuildSpatialIndex = dropSpatialIndexForBulkWrite( geometry_map.size() );
+
+  const bool inTransaction = startTransaction();
 
-    //set the new geometry
-    if ( OGR_F_SetGeometryDirectly( theOGRFeature.get(), newGeometry ) != OGRERR_NONE )
+  // fetch and rewrite each feature only once, even when both its attributes
+  // and its geometry changed -- the generic implementation would do two
+  // GetFeature()/SetFeature() round trips per feature in that case
+  QgsFeatureIds fids;
+  for ( QgsChangedAttributesMap::const_iterator it = attr_map.constBegin(); it != attr_map.constEnd(); ++it )
+    fids << it.key();
+  for ( QgsGeometryMap::const_iterator it = geometry_map.constBegin(); it != geometry_map.constEnd(); ++it )
+    fids << it.key();
+
+  bool geometryChanged = false;
+  for ( QgsFeatureId fid : qgis::as_const( fids ) )
+  {
+    gdal::ogr_feature_unique_ptr of( mOgrLayer->GetFeature( FID_TO_NUMBER( fid ) ) );
+    if ( !of )
     {
-      pushError( tr( "OGR error setting geometry of feature %1: %2" ).arg( it.key() ).arg( CPLGetLastErrorMsg() ) );
-      // Shouldn't happen normally. If it happens, ownership of the geometry
-      // may be not really well defined, so better not destroy it, but just
-      // the feature.
+      pushError( tr( "Feature %1 for update not found." ).arg( fid ) );
       continue;
     }
+    mOgrLayer->ResetReading(); // needed for SQLite-based to clear iterator
 
+    const QgsChangedAttributesMap::const_iterator attrIt = attr_map.constFind( fid );
+    if ( attrIt != attr_map.constEnd() && !attrIt->isEmpty() )
+      changeAttributesOfFeature( of.get(), fid, attrIt.value() );
 
-    if ( mOgrLayer->SetFeature( theOGRFeature.get() ) != OGRERR_NONE )
+    const QgsGeometryMap::const_iterator geomIt = geometry_map.constFind( fid );
+    if ( geomIt != geometry_map.constEnd() )
     {
-      pushError( tr( "OGR error setting feature %1: %2" ).arg( it.key() ).arg( CPLGetLastErrorMsg() ) );
+      if ( !changeGeometryOfFeature( of.get(), fid, geomIt.value() ) )
+        continue;
+    }
+
+    if ( mOgrLayer->SetFeature( of.get() ) != OGRERR_NONE )
+    {
+      pushError( tr( "OGR error setting feature %1: %2" ).arg( fid ).arg( CPLGetLastErrorMsg() ) );
       continue;
     }
-    mShapefileMayBeCorrupted = true;
 
-    invalidateCachedExtent( true );
+    if ( geomIt != geometry_map.constEnd() )
+    {
+      mShapefileMayBeCorrupted = true;
+      geometryChanged = true;
+    }
   }
 
+  if ( geometryChanged )
+    invalidateCachedExtent( true );
+
   if ( inTransaction )
   {
     commitTransaction();
   }
 
+  if ( rebuildSpatialIndex )
+    createSpatialIndex();
+
   if ( mTransaction )
     mTransaction->dirtyLastSavePoint();
 
@@ -2543,6 +2700,9 @@ void QgsOgrProvider::computeCapabilities()
 
       ability |= ChangeAttributeValues;
       ability |= ChangeGeometries;
+      // attribute and geometry updates go through the same SetFeature() call,
+      // so combined updates can be handled in a single pass
+      ability |= ChangeFeatures;
     }
 
 #if 0
@@ -2610,7 +2770,7 @@ void QgsOgrProvider::computeCapabilities()
       if ( mAttributeFields.size() == 0 )
       {
         QgsMessageLog::logMessage( tr( "Shapefiles without attribute are considered read-only." ), tr( "OGR" ) );
-        ability &= ~( AddFeatures | DeleteFeatures | ChangeAttributeValues | AddAttributes | DeleteAttributes );
+        ability &= ~( AddFeatures | DeleteFeatures | ChangeAttributeValues | ChangeFeatures | AddAttributes | DeleteAttributes );
       }
 
       if ( ( ability & ChangeAttributeValues ) == 0 )
@@ -3713,6 +3873,60 @@ QStringList QgsOgrProvider::uniqueStringsMatching( int index, const QString &sub
   return results;
 }
 
+bool QgsOgrProvider::fetchNumericColumn( int index, QVector<double> &values, long long &nullCount, QgsFeedback *feedback ) const
+{
+  values.clear();
+  nullCount = 0;
+
+  if ( !mValid || index < 0 || index >= mAttributeFields.count() )
+    return false;
+
+  QgsField fld = mAttributeFields.at( index );
+  if ( fld.name().isNull() )
+  {
+    return false; //not a provider field
+  }
+
+  // For GPKG and SQLITE drivers PK fields are not exposed as real fields
+  // (see https://issues.qgis.org/issues/21311), let the iterator based
+  // implementation handle them
+  if ( ( mGDALDriverName == QLatin1String( "GPKG" ) || mGDALDriverName == QLatin1String( "SQLite" ) )
+       && mFirstFieldIsFid && index == 0 )
+  {
+    return QgsVectorDataProvider::fetchNumericColumn( index, values, nullCount, feedback );
+  }
+
+  QByteArray sql = "SELECT " + quotedIdentifier( textEncoding()->fromUnicode( fld.name() ) );
+  sql += " FROM " + quotedIdentifier( mOgrLayer->name() );
+
+  if ( !mSubsetString.isEmpty() )
+  {
+    sql += " WHERE " + textEncoding()->fromUnicode( mSubsetString );
+  }
+
+  QgsDebugMsg( QStringLiteral( "SQL: %1" ).arg( textEncoding()->toUnicode( sql ) ) );
+  QgsOgrLayerUniquePtr l = mOgrLayer->ExecuteSQL( sql );
+  if ( !l )
+  {
+    QgsDebugMsg( QStringLiteral( "Failed to execute SQL" ) );
+    return QgsVectorDataProvider::fetchNumericColumn( index, values, nullCount, feedback );
+  }
+
+  gdal::ogr_feature_unique_ptr f;
+  while ( f.reset( l->GetNextFeature() ), f )
+  {
+    if ( feedback && feedback->isCanceled() )
+      return false;
+
+    if ( OGR_F_IsFieldSetAndNotNull( f.get(), 0 ) )
+      values.append( OGR_F_GetFieldAsDouble( f.get(), 0 ) );
+    else
+      nullCount++;
+  }
+
+  return true;
+}
+
 QVariant QgsOgrProvider::minimumValue( int index ) const
 {
   if ( !mValid || index < 0 || index >= mAttributeFields.count() )
@@ -4129,6 +4343,22 @@ void QgsOgrProvider::recalculateFeatureCount()
     return;
   }
 
+  // for file based sources the count from a previous session can be reused as
+  // long as the file was not modified in the meantime. This avoids a full scan
+  // on drivers which cannot answer the count from a header (e.g. CSV, GeoJSON).
+  QDateTime statsCacheStamp;
+  if ( QgsOgrLayerStatsCache::isEnabled() && QFileInfo::exists( mFilePath ) )
+    statsCacheStamp = getLastModified( mFilePath );
+  if ( statsCacheStamp.isValid() )
+  {
+    long cachedCount = 0;
+    if ( QgsOgrLayerStatsCache::instance()->cachedFeatureCount( dataSourceUri(), statsCacheStamp, cachedCount ) )
+    {
+      mFeaturesCounted = cachedCount;
+      return;
+    }
+  }
+
   OGRGeometryH filter = mOgrLayer->GetSpatialFilter();
   if ( filter )
   {
@@ -4174,6 +4404,9 @@ void QgsOgrProvider::recalculateFeatureCount()
     mOgrLayer->SetSpatialFilter( filter );
   }
 
+  if ( statsCacheStamp.isValid() && mFeaturesCounted >= 0 )
+    QgsOgrLayerStatsCache::instance()->setCachedFeatureCount( dataSourceUri(), statsCacheStamp, mFeaturesCounted );
+
   QgsOgrConnPool::instance()->invalidateConnections( QgsOgrProviderUtils::connectionPoolId( dataSourceUri( true ), mShareSameDatasetAmongLayers ) );
 }
 
@@ -4351,6 +4584,15 @@ void QgsOgrProvider::open( OpenMode mode )
       if ( mode == OpenModeInitial )
       {
         computeCapabilities();
+
+        // For drivers which can serve several layers from one dataset (e.g.
+        // GeoPackage) pre-open pooled read-only connections in the background,
+        // so that the first parallel render does not serialize on dataset
+        // opens. Done once per file - the pool group is shared by all layers.
+        if ( mShareSameDatasetAmongLayers )
+        {
+          QgsOgrConnPool::instance()->warmupConnections( QgsOgrProviderUtils::connectionPoolId( dataSourceUri( true ), mShareSameDatasetAmongLayers ) );
+        }
       }
       QgsDebugMsg( QStringLiteral( "Data source is valid" ) );
     }
@@ -123,6 +123,7 @@ class QgsOgrProvider : public QgsVectorDataProvider
     bool renameAttributes( const QgsFieldNameMap &renamedAttributes ) override;
     bool changeAttributeValues( const QgsChangedAttributesMap &attr_map ) override;
     bool changeGeometryValues( const QgsGeometryMap &geometry_map ) override;
+    bool changeFeatures( const QgsChangedAttributesMap &attr_map, const QgsGeometryMap &geometry_map ) override;
     bool createSpatialIndex() override;
     bool createAttributeIndex( int field ) override;
     QgsVectorDataProvider::Capabilities capabilities() const override;
@@ -145,6 +146,8 @@ class QgsOgrProvider : public QgsVectorDataProvider
     QSet< QVariant > uniqueValues( int index, int limit = -1 ) const override;
     QStringList uniqueStringsMatching( int index, const QString &substring, int limit = -1,
                                        QgsFeedback *feedback = nullptr ) const override;
+    bool fetchNumericColumn( int index, QVector<double> &values, long long &nullCount,
+                             QgsFeedback *feedback = nullptr ) const override;
 
     QString name() const override;
     QString description() const override;
@@ -216,6 +219,14 @@ class QgsOgrProvider : public QgsVectorDataProvider
     //! Commits a transaction
     bool commitTransaction();
 
+    /**
+     * Drops the GeoPackage R-tree spatial index ahead of a bulk write of \a featureCount
+     * features, when the batch is large enough that row-by-row index maintenance would
+     * dominate the cost of the edit. Returns true if the index was dropped, in which case
+     * the caller must rebuild it with createSpatialIndex() once the batch has been written.
+     */
+    bool dropSpatialIndexForBulkWrite( int featureCount );
+
     //! Does the real job of settings the subset string and adds an argument to disable update capabilities
     bool _setSubsetString( const QString &theSQL, bool updateFeatureCount = true, bool updateCapabilities = true, bool hasExistingRef = true );
 
@@ -295,6 +306,11 @@ class QgsOgrProvider : public QgsVectorDataProvider
     //! Deletes one feature
     bool deleteFeature( QgsFeatureId id );
 
+    //! Applies the changed attribute values for \a fid to the fetched OGR feature, without writing it back
+    void changeAttributesOfFeature( OGRFeatureH of, QgsFeatureId fid, const QgsAttributeMap &attr );
+    //! Applies a new geometry for \a fid to the fetched OGR feature, without writing it back. Returns FALSE on error.
+    bool changeGeometryOfFeature( OGRFeatureH of, QgsFeatureId fid, const QgsGeometry &geometry );
+
     //! Calls OGR_L_SyncToDisk and recreates the spatial index if present
     bool syncToDisc();
 
@@ -38,7 +38,7 @@ QgsPostgresFeatureIterator::QgsPostgresFeatureIterator( QgsPostgresFeatureSource
 
   if ( !source->mTransactionConnection )
   {
-    mConn = QgsPostgresConnPool::instance()->acquireConnection( mSource->mConnInfo, request.timeout(), request.requestMayBeNested() );
+    mConn = QgsPostgresConnPool::instance()->acquireConnection( mSource->mConnInfo, request.timeout(), request.requestMayBeNested(), request.backgroundPriority() );
     mIsTransactionConnection = false;
   }
   else
@@ -71,6 +71,10 @@ QgsPostgresFeatureIterator::QgsPostgresFeatureIterator( QgsPostgresFeatureSource
   }
 
   mCursorName = mConn->uniqueCursorName();
+
+  // fetch batch size is tunable -- larger batches trade memory for fewer server round trips
+  mFeatureQueueSize = std::max( 1, QgsSettings().value( QStringLiteral( "qgis/postgresFeatureQueueSize" ), mFeatureQueueSize ).toInt() );
+
   QString whereClause;
 
   bool limitAtProvider = ( mRequest.limit() >= 0 );
@@ -263,10 +267,14 @@ bool QgsPostgresFeatureIterator::fetchFeature( QgsFeature &feature )
     QgsDebugMsgLevel( QStringLiteral( "fetching %1 features." ).arg( mFeatureQueueSize ), 4 );
 
     lock();
-    if ( mConn->PQsendQuery( fetch ) == 0 ) // fetch features asynchronously
+    if ( !mFetchPending )
     {
-      QgsMessageLog::logMessage( QObject::tr( "Fetching from cursor %1 failed\nDatabase error: %2" ).arg( mCursorName, mConn->PQerrorMessage() ), QObject::tr( "PostGIS" ) );
+      if ( mConn->PQsendQuery( fetch ) == 0 ) // fetch features asynchronously
+      {
+        QgsMessageLog::logMessage( QObject::tr( "Fetching from cursor %1 failed\nDatabase error: %2" ).arg( mCursorName, mConn->PQerrorMessage() ), QObject::tr( "PostGIS" ) );
+      }
     }
+    mFetchPending = false;
 
     QgsPostgresResult queryResult;
     for ( ;; )
@@ -293,6 +301,16 @@ bool QgsPostgresFeatureIterator::fetchFeature( QgsFeature &feature )
         getFeature( queryResult, row, mFeatureQueue.back() );
       } // for each row in queue
     }
+
+    // read-ahead: ask the server for the following batch now, so that it is
+    // prepared and transferred while this batch is being consumed. Shared
+    // transaction connections are excluded, as a pending result there would
+    // block other users of the connection.
+    if ( !mLastFetch && !mIsTransactionConnection && !mFeatureQueue.empty() )
+    {
+      if ( mConn->PQsendQuery( fetch ) != 0 )
+        mFetchPending = true;
+    }
     unlock();
 
 #if 0 //disabled dynamic queue size
@@ -380,6 +398,22 @@ void QgsPostgresFeatureIterator::unlock()
     mConn->unlock();
 }
 
+void QgsPostgresFeatureIterator::drainPendingFetch()
+{
+  if ( !mFetchPending )
+    return;
+
+  // collect (and discard) the results of any outstanding read-ahead FETCH, so
+  // that the connection is free to run other queries
+  QgsPostgresResult queryResult;
+  do
+  {
+    queryResult = mConn->PQgetResult();
+  }
+  while ( queryResult.result() );
+  mFetchPending = false;
+}
+
 bool QgsPostgresFeatureIterator::rewind()
 {
   if ( mClosed )
@@ -387,6 +421,7 @@ bool QgsPostgresFeatureIterator::rewind()
 
   // move cursor to first record
 
+  drainPendingFetch();
   mConn->PQexecNR( QStringLiteral( "move absolute 0 in %1" ).arg( mCursorName ) );
   mFeatureQueue.clear();
   mFetched = 0;
@@ -400,6 +435,7 @@ bool QgsPostgresFeatureIterator::close()
   if ( !mConn )
     return false;
 
+  drainPendingFetch();
   mConn->closeCursor( mCursorName );
 
   if ( !mIsTransactionConnection )
@@ -92,6 +92,7 @@ class QgsPostgresFeatureIterator : public QgsAbstractFeatureIteratorFromSource<Q
     bool getFeature( QgsPostgresResult &queryResult, int row, QgsFeature &feature );
     void getFeatureAttribute( int idx, QgsPostgresResult &queryResult, int row, int &col, QgsFeature &feature );
     bool declareCursor( const QString &whereClause, long limit = -1, bool closeOnFail = true, const QString &orderBy = QString() );
+    void drainPendingFetch();
 
     QString mCursorName;
 
@@ -122,6 +123,9 @@ class QgsPostgresFeatureIterator : public QgsAbstractFeatureIteratorFromSource<Q
     bool mExpressionCompiled = false;
     bool mOrderByCompiled = false;
     bool mLastFetch = false;
+
+    //! TRUE if a read-ahead FETCH has been sent to the server and its result not yet collected
+    bool mFetchPending = false;
     bool mFilterRequiresGeometry = false;
 
     QgsCoordinateTransform mTransform;
@@ -320,15 +320,88 @@ void QgsPostgresProvider::setListening( bool isListening )
   if ( isListening && !mListener )
   {
     mListener.reset( QgsPostgresListener::create( mUri.connectionInfo( false ) ).release() );
-    connect( mListener.get(), &QgsPostgresListener::notify, this, &QgsPostgresProvider::notify );
+    connect( mListener.get(), &QgsPostgresListener::notify, this, &QgsPostgresProvider::onListenerNotify );
   }
   else if ( !isListening && mListener )
   {
-    disconnect( mListener.get(), &QgsPostgresListener::notify, this, &QgsPostgresProvider::notify );
+    disconnect( mListener.get(), &QgsPostgresListener::notify, this, &QgsPostgresProvider::onListenerNotify );
     mListener.reset();
   }
 }
 
+void QgsPostgresProvider::onListenerNotify( const QString &msg )
+{
+  // a differential refresh message looks like
+  //   changed:<schema>.<table>:<fid>,<fid>,...[:<xmin> <ymin> <xmax> <ymax>]
+  // as emitted by e.g.
+  //   PERFORM pg_notify('qgis', 'changed:' || TG_TABLE_SCHEMA || '.' || TG_TABLE_NAME || ':' || NEW.id);
+  // the optional trailing bbox should cover both OLD and NEW geometries -- it is the
+  // only way to bound the previous location of moved or deleted features
+  if ( !msg.startsWith( QLatin1String( "changed:" ) ) )
+  {
+    emit notify( msg );
+    return;
+  }
+
+  // fids in the payload are only meaningful when the key is a plain integer column
+  const QStringList parts = msg.split( ':' );
+  if ( parts.size() < 3
+       || parts.at( 1 ) != QStringLiteral( "%1.%2" ).arg( mSchemaName, mTableName )
+       || ( mPrimaryKeyType != PktInt && mPrimaryKeyType != PktUint64 && mPrimaryKeyType != PktOid ) )
+  {
+    emit notify( msg );
+    return;
+  }
+
+  QgsFeatureIds fids;
+  const QStringList fidParts = parts.at( 2 ).split( ',', QString::SkipEmptyParts );
+  for ( const QString &fidPart : fidParts )
+  {
+    bool ok = false;
+    const QgsFeatureId fid = fidPart.toLongLong( &ok );
+    if ( !ok )
+    {
+      emit notify( msg );
+      return;
+    }
+    fids << fid;
+  }
+
+  QgsRectangle region;
+  if ( parts.size() >= 4 )
+  {
+    const QStringList coords = parts.at( 3 ).split( ' ', QString::SkipEmptyParts );
+    if ( coords.size() == 4 )
+      region = QgsRectangle( coords.at( 0 ).toDouble(), coords.at( 1 ).toDouble(),
+                             coords.at( 2 ).toDouble(), coords.at( 3 ).toDouble() );
+  }
+
+  // fetch only the changed features to pick up their current geometry
+  int fetched = 0;
+  QgsFeature f;
+  QgsFeatureIterator it = getFeatures( QgsFeatureRequest().setFilterFids( fids ).setSubsetOfAttributes( QgsAttributeList() ) );
+  while ( it.nextFeature( f ) )
+  {
+    fetched++;
+    if ( !f.hasGeometry() )
+      continue;
+    if ( region.isNull() )
+      region = f.geometry().boundingBox();
+    else
+      region.combineExtentWith( f.geometry().boundingBox() );
+  }
+
+  if ( region.isNull() || ( fetched < fids.size() && parts.size() < 4 ) )
+  {
+    // deleted or moved features without a trigger-supplied bbox -- the change
+    // cannot be bounded, fall back to a plain notification
+    emit notify( msg );
+    return;
+  }
+
+  emit dataRegionChanged( region );
+}
+
 QgsPostgresConn *QgsPostgresProvider::connectionRW()
 {
   if ( mTransaction )
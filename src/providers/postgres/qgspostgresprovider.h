@@ -234,6 +234,20 @@ class QgsPostgresProvider : public QgsVectorDataProvider
      */
     void setListening( bool isListening ) override;
 
+  private slots:
+
+    /**
+     * Interprets a NOTIFY message from the listener thread.
+     *
+     * Messages following the differential refresh convention
+     *   changed:<schema>.<table>:<fid>,<fid>,...[:<xmin> <ymin> <xmax> <ymax>]
+     * and targeting this provider's table are turned into a dataRegionChanged()
+     * signal covering only the changed features, so that views can re-render
+     * a small dirty rectangle instead of the whole layer. Any other message is
+     * forwarded untouched through notify().
+     */
+    void onListenerNotify( const QString &msg );
+
   private:
     Relkind relkind() const;
 
@@ -705,6 +705,23 @@ QgsSqliteHandle *QgsSqliteHandle::openDb( const QString &dbPath, bool shared )
   // activating Foreign Key constraints
   ( void )sqlite3_exec( database.get(), "PRAGMA foreign_keys = 1", nullptr, nullptr, nullptr );
 
+  // tuned access pragmas -- they apply to every connection, including the ones
+  // handed out to feature iterators by QgsSpatiaLiteConnPool. Memory mapped
+  // I/O in particular makes cold pans over large databases dramatically
+  // cheaper, as the R-tree pages stay in the OS page cache between sessions.
+  const QgsSettings settings;
+  const qlonglong mmapSize = settings.value( QStringLiteral( "qgis/spatialiteMmapSize" ), 268435456LL ).toLongLong();
+  if ( mmapSize > 0 )
+  {
+    ( void )sqlite3_exec( database.get(), QStringLiteral( "PRAGMA mmap_size = %1" ).arg( mmapSize ).toUtf8().constData(), nullptr, nullptr, nullptr );
+  }
+  const int cacheSizeKiB = settings.value( QStringLiteral( "qgis/spatialiteCacheSizeKiB" ), 0 ).toInt();
+  if ( cacheSizeKiB > 0 )
+  {
+    // negative cache_size values are interpreted by sqlite as KiB instead of pages
+    ( void )sqlite3_exec( database.get(), QStringLiteral( "PRAGMA cache_size = -%1" ).arg( cacheSizeKiB ).toUtf8().constData(), nullptr, nullptr, nullptr );
+  }
+
   QgsDebugMsg( QStringLiteral( "Connection to the database was successful" ) );
 
   QgsSqliteHandle *handle = new QgsSqliteHandle( std::move( database ), dbPath, shared );
@@ -32,6 +32,7 @@ email                : a.furieri@lqt.it
 #include "qgsfeedback.h"
 
 #include "qgsjsonutils.h"
+#include "qgssettings.h"
 #include "qgsvectorlayer.h"
 
 #ifdef HAVE_GUI
@@ -42,7 +43,9 @@ email                : a.furieri@lqt.it
 #include <QMessageBox>
 #include <QFileInfo>
 #include <QDir>
+#include <QMutex>
 #include <QRegularExpression>
+#include <QtConcurrentRun>
 
 
 const QString SPATIALITE_KEY = QStringLiteral( "spatialite" );
@@ -610,9 +613,50 @@ QgsSpatiaLiteProvider::QgsSpatiaLiteProvider( QString const &uri, const Provider
   if ( ! mSubsetString.isEmpty() )
     getTableSummary();
 
+  if ( mSpatialIndexRTree && QgsSettings().value( QStringLiteral( "qgis/spatialitePreWarmIndex" ), false ).toBool() )
+    prewarmSpatialIndex();
+
   mValid = true;
 }
 
+void QgsSpatiaLiteProvider::prewarmSpatialIndex()
+{
+  static QMutex sWarmedMutex;
+  static QSet<QString> sWarmedIndexes;
+
+  if ( mLayerExtent.isNull() )
+    return;
+
+  const QString idxName = QStringLiteral( "idx_%1_%2" ).arg( mIndexTable, mIndexGeometry );
+  const QString key = mSqlitePath + '|' + idxName;
+  {
+    QMutexLocker locker( &sWarmedMutex );
+    if ( sWarmedIndexes.contains( key ) )
+      return;
+    sWarmedIndexes.insert( key );
+  }
+
+  const QString sqlitePath = mSqlitePath;
+  const QgsRectangle extent = mLayerExtent;
+  QtConcurrent::run( [sqlitePath, idxName, extent]
+  {
+    QgsSqliteHandle *handle = QgsSpatiaLiteConnPool::instance()->acquireConnection( sqlitePath );
+    if ( !handle )
+      return;
+
+    // a counting scan restricted to the extent reads every R-tree node that
+    // later bounding box queries will touch, pulling them into the page cache
+    const QString sql = QStringLiteral( "SELECT count(*) FROM %1 WHERE xmin <= %2 AND xmax >= %3 AND ymin <= %4 AND ymax >= %5" )
+                        .arg( QgsSqliteUtils::quotedIdentifier( idxName ),
+                              qgsDoubleToString( extent.xMaximum() ),
+                              qgsDoubleToString( extent.xMinimum() ),
+                              qgsDoubleToString( extent.yMaximum() ),
+                              qgsDoubleToString( extent.yMinimum() ) );
+    ( void )sqlite3_exec( handle->handle(), sql.toUtf8().constData(), nullptr, nullptr, nullptr );
+    QgsSpatiaLiteConnPool::instance()->releaseConnection( handle );
+  } );
+}
+
 QgsSpatiaLiteProvider::~QgsSpatiaLiteProvider()
 {
   closeDb();
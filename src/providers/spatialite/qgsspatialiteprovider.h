@@ -343,6 +343,14 @@ class QgsSpatiaLiteProvider: public QgsVectorDataProvider
 
     void updatePrimaryKeyCapabilities();
 
+    /**
+     * Touches the R-tree pages covering the layer extent on a background
+     * thread, so that the first bounding box queries on a cold database
+     * don't pay for walking the index from disk. Runs at most once per
+     * database and index per session.
+     */
+    void prewarmSpatialIndex();
+
     int computeSizeFromMultiWKB2D( const unsigned char *p_in, int nDims,
                                    int little_endian,
                                    int endian_arch );
@@ -20,7 +20,10 @@ extern "C"
 #include <spatialite.h>
 }
 
+#include <QRegularExpression>
+#include <QTimer>
 #include <QUrl>
+#include <QtConcurrentRun>
 
 #include <stdexcept>
 
@@ -32,6 +35,7 @@ extern "C"
 #include "qgsdatasourceuri.h"
 #include "qgslogger.h"
 #include "qgsapplication.h"
+#include "qgssettings.h"
 
 #include "qgsvirtuallayerprovider.h"
 #include "qgsvirtuallayersqlitemodule.h"
@@ -47,6 +51,11 @@ const QString VIRTUAL_LAYER_DESCRIPTION = QStringLiteral( "Virtual layer data pr
 
 const QString VIRTUAL_LAYER_QUERY_VIEW = QStringLiteral( "_query" );
 
+const QString VIRTUAL_LAYER_MATERIALIZED_TABLE = QStringLiteral( "_materialized" );
+
+//! Delay before a materialization refresh starts, so that bursts of edit signals coalesce into one refresh
+const int MATERIALIZATION_REFRESH_DELAY_MS = 500;
+
 static QString quotedColumn( QString name )
 {
   return "\"" + name.replace( QLatin1String( "\"" ), QLatin1String( "\"\"" ) ) + "\"";
@@ -77,6 +86,10 @@ QgsVirtualLayerProvider::QgsVirtualLayerProvider( QString const &uri, const QgsD
   {
     mDefinition = QgsVirtualLayerDefinition::fromUrl( url );
 
+    QgsSettings settings;
+    mMaterialized = settings.value( QStringLiteral( "qgis/virtual_layer_materialize" ), false ).toBool()
+                    && !mDefinition.query().isEmpty();
+
     if ( !mDefinition.isLazy() )
     {
       reloadData();
@@ -95,6 +108,12 @@ QgsVirtualLayerProvider::QgsVirtualLayerProvider( QString const &uri, const QgsD
   }
 }
 
+QgsVirtualLayerProvider::~QgsVirtualLayerProvider()
+{
+  // a background refresh still works on our sqlite handle
+  mRefreshFuture.waitForFinished();
+}
+
 void QgsVirtualLayerProvider::reloadData()
 {
   if ( mDefinition.sourceLayers().empty() && !mDefinition.filePath().isEmpty() && mDefinition.query().isEmpty() )
@@ -134,6 +153,17 @@ bool QgsVirtualLayerProvider::loadSourceLayers()
       connect( vl, &QgsVectorLayer::featureDeleted, this, &QgsVirtualLayerProvider::invalidateStatistics );
       connect( vl, &QgsVectorLayer::geometryChanged, this, &QgsVirtualLayerProvider::invalidateStatistics );
       connect( vl, &QgsVectorLayer::updatedFields, this, [ = ] { createVirtualTable( vl, layer.name() ); } );
+
+      if ( mMaterialized )
+      {
+        // track which source rows changed, so the materialized result can be
+        // refreshed incrementally where the query structure allows it
+        connect( vl, &QgsVectorLayer::featureAdded, this, &QgsVirtualLayerProvider::sourceFeatureChanged );
+        connect( vl, &QgsVectorLayer::featureDeleted, this, &QgsVirtualLayerProvider::sourceFeatureChanged );
+        connect( vl, &QgsVectorLayer::geometryChanged, this, [ = ]( QgsFeatureId fid, const QgsGeometry & ) { sourceFeatureChanged( fid ); } );
+        connect( vl, &QgsVectorLayer::attributeValueChanged, this, [ = ]( QgsFeatureId fid, int, const QVariant & ) { sourceFeatureChanged( fid ); } );
+        connect( vl, &QgsVectorLayer::dataChanged, this, &QgsVirtualLayerProvider::sourceWholesaleChanged );
+      }
     }
     else
     {
@@ -201,6 +231,12 @@ bool QgsVirtualLayerProvider::openIt()
   else
   {
     mTableName = VIRTUAL_LAYER_QUERY_VIEW;
+
+    // a materialization persisted in the file serves the last good result
+    // instantly; it is refreshed in the background in case the embedded
+    // sources changed on disk
+    if ( mMaterialized )
+      initializeMaterialization();
   }
 
   return true;
@@ -453,9 +489,153 @@ bool QgsVirtualLayerProvider::createIt()
     q.step();
   }
 
+  if ( mMaterialized )
+  {
+    initializeMaterialization();
+  }
+
   return true;
 }
 
+void QgsVirtualLayerProvider::initializeMaterialization()
+{
+  // the result can be refreshed row by row only when the query draws from a
+  // single live source, keeps one result row per source feature and carries a
+  // unique id column whose values are the source feature ids. joins,
+  // aggregation and limits break that mapping and force wholesale rebuilds
+  const QRegularExpression nonIncremental( QStringLiteral( "\\b(JOIN|GROUP\\s+BY|DISTINCT|UNION|INTERSECT|EXCEPT|LIMIT)\\b" ),
+      QRegularExpression::CaseInsensitiveOption );
+  int referencedSources = 0;
+  Q_FOREACH ( const SourceLayer &l, mLayers )
+  {
+    if ( l.layer )
+      referencedSources++;
+  }
+  mIncrementalPossible = referencedSources == 1 && mLayers.size() == 1
+                         && !mDefinition.uid().isNull()
+                         && !mDefinition.query().contains( nonIncremental );
+
+  bool exists = false;
+  {
+    Sqlite::Query q( mSqlite.get(), QStringLiteral( "SELECT name FROM sqlite_master WHERE type='table' AND name='%1'" ).arg( VIRTUAL_LAYER_MATERIALIZED_TABLE ) );
+    exists = q.step() == SQLITE_ROW;
+  }
+
+  if ( exists )
+  {
+    // a file-backed layer keeps its materialization across sessions -- serve
+    // the last good result instantly and refresh it in the background
+    mTableName = VIRTUAL_LAYER_MATERIALIZED_TABLE;
+    mFullRefreshNeeded = true;
+    scheduleMaterializationRefresh();
+  }
+  else
+  {
+    try
+    {
+      Sqlite::Query::exec( mSqlite.get(), QStringLiteral( "CREATE TABLE %1 AS SELECT * FROM %2" )
+                           .arg( VIRTUAL_LAYER_MATERIALIZED_TABLE, VIRTUAL_LAYER_QUERY_VIEW ) );
+      mTableName = VIRTUAL_LAYER_MATERIALIZED_TABLE;
+    }
+    catch ( std::runtime_error &e )
+    {
+      // fall back to the live view
+      QgsDebugMsg( QStringLiteral( "Could not materialize virtual layer query: %1" ).arg( e.what() ) );
+      mMaterialized = false;
+    }
+  }
+}
+
+void QgsVirtualLayerProvider::sourceFeatureChanged( QgsFeatureId fid )
+{
+  if ( !mMaterialized )
+    return;
+
+  if ( mIncrementalPossible )
+    mChangedUids.insert( fid );
+  else
+    mFullRefreshNeeded = true;
+  scheduleMaterializationRefresh();
+}
+
+void QgsVirtualLayerProvider::sourceWholesaleChanged()
+{
+  if ( !mMaterialized )
+    return;
+
+  mFullRefreshNeeded = true;
+  scheduleMaterializationRefresh();
+}
+
+void QgsVirtualLayerProvider::scheduleMaterializationRefresh()
+{
+  if ( mRefreshScheduled )
+    return;
+  mRefreshScheduled = true;
+  QTimer::singleShot( MATERIALIZATION_REFRESH_DELAY_MS, this, &QgsVirtualLayerProvider::refreshMaterialization );
+}
+
+void QgsVirtualLayerProvider::refreshMaterialization()
+{
+  mRefreshScheduled = false;
+
+  const bool full = mFullRefreshNeeded;
+  const QgsFeatureIds changedUids = mChangedUids;
+  mFullRefreshNeeded = false;
+  mChangedUids.clear();
+  if ( !full && changedUids.isEmpty() )
+    return;
+
+  // readers keep using the last good result while the refresh runs
+  sqlite3 *db = mSqlite.get();
+  const QString uidColumn = quotedColumn( mDefinition.uid() );
+  mRefreshFuture = QtConcurrent::run( [ this, db, full, changedUids, uidColumn ]()
+  {
+    QMutexLocker locker( &mRefreshMutex );
+    try
+    {
+      if ( full )
+      {
+        // rebuild next to the live table and swap, so a reader never sees a
+        // half filled result
+        Sqlite::Query::exec( db, QStringLiteral( "DROP TABLE IF EXISTS %1_new; CREATE TABLE %1_new AS SELECT * FROM %2;" )
+                             .arg( VIRTUAL_LAYER_MATERIALIZED_TABLE, VIRTUAL_LAYER_QUERY_VIEW ) );
+        Sqlite::Query::exec( db, QStringLiteral( "BEGIN; DROP TABLE IF EXISTS %1; ALTER TABLE %1_new RENAME TO %1; COMMIT;" )
+                             .arg( VIRTUAL_LAYER_MATERIALIZED_TABLE ) );
+      }
+      else
+      {
+        QStringList ids;
+        ids.reserve( changedUids.size() );
+        Q_FOREACH ( QgsFeatureId fid, changedUids )
+          ids << QString::number( fid );
+        Sqlite::Query::exec( db, QStringLiteral( "BEGIN; DELETE FROM %1 WHERE %2 IN (%3); "
+                             "INSERT INTO %1 SELECT * FROM %4 WHERE %2 IN (%3); COMMIT;" )
+                             .arg( VIRTUAL_LAYER_MATERIALIZED_TABLE, uidColumn, ids.join( ',' ), VIRTUAL_LAYER_QUERY_VIEW ) );
+      }
+    }
+    catch ( std::runtime_error &e )
+    {
+      // e.g. the table was locked by a running reader -- retry wholesale later
+      QgsDebugMsg( QStringLiteral( "Materialization refresh failed: %1" ).arg( e.what() ) );
+      mFullRefreshNeeded = true;
+    }
+    QMetaObject::invokeMethod( this, "materializationFinished", Qt::QueuedConnection );
+  } );
+}
+
+void QgsVirtualLayerProvider::materializationFinished()
+{
+  if ( mFullRefreshNeeded )
+  {
+    // the last refresh failed, try again
+    scheduleMaterializationRefresh();
+    return;
+  }
+  mCachedStatistics = false;
+  emit dataChanged();
+}
+
 void QgsVirtualLayerProvider::createVirtualTable( QgsVectorLayer *vlayer, const QString &vname )
 {
   QString createStr = QStringLiteral( "DROP TABLE IF EXISTS \"%1\"; CREATE VIRTUAL TABLE \"%1\" USING QgsVLayer(%2);" ).arg( vname, vlayer->id() );
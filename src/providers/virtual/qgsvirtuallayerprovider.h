@@ -23,6 +23,9 @@ email                : hugo dot mercier at oslandia dot com
 #include "qgsvirtuallayerdefinition.h"
 #include "qgsvirtuallayersqlitehelper.h"
 
+#include <QFuture>
+#include <QMutex>
+
 class QgsVirtualLayerFeatureIterator;
 
 class QgsVirtualLayerProvider: public QgsVectorDataProvider
@@ -36,6 +39,7 @@ class QgsVirtualLayerProvider: public QgsVectorDataProvider
      * \param options generic data provider options
      */
     explicit QgsVirtualLayerProvider( QString const &uri, const ProviderOptions &options );
+    ~QgsVirtualLayerProvider() override;
 
     QgsAbstractFeatureSource *featureSource() const override;
     QString storageType() const override;
@@ -113,10 +117,35 @@ class QgsVirtualLayerProvider: public QgsVectorDataProvider
     bool loadSourceLayers();
     void createVirtualTable( QgsVectorLayer *vlayer, const QString &name );
 
+    //! TRUE if the query result is materialized into a real table instead of evaluated on every read
+    bool mMaterialized = false;
+
+    //! TRUE if changed rows can be re-queried individually instead of rebuilding the whole materialization
+    bool mIncrementalPossible = false;
+
+    //! TRUE if the pending refresh must rebuild the materialization wholesale
+    bool mFullRefreshNeeded = false;
+
+    //! TRUE while a coalescing refresh is scheduled but has not started yet
+    bool mRefreshScheduled = false;
+
+    //! Uid values of source features changed since the last refresh, when incremental refresh is possible
+    QgsFeatureIds mChangedUids;
+
+    QFuture<void> mRefreshFuture;
+    QMutex mRefreshMutex;
+
+    void initializeMaterialization();
+    void sourceFeatureChanged( QgsFeatureId fid );
+    void sourceWholesaleChanged();
+    void scheduleMaterializationRefresh();
+
     friend class QgsVirtualLayerFeatureSource;
 
   private slots:
     void invalidateStatistics();
+    void refreshMaterialization();
+    void materializationFinished();
 
 };
 
@@ -36,9 +36,11 @@
 
 #include <algorithm>
 #include <QDir>
+#include <QFutureWatcher>
 #include <QProgressDialog>
 #include <QTimer>
 #include <QStyle>
+#include <QtConcurrentRun>
 
 #include <sqlite3.h>
 
@@ -84,6 +86,35 @@ QString QgsWFSFeatureHitsAsyncRequest::errorMessageWithReason( const QString &re
 
 // -------------------------
 
+QgsWFSPagePrefetchRequest::QgsWFSPagePrefetchRequest( QgsWFSDataSourceURI &uri )
+  : QgsWfsRequest( uri )
+  , mFinished( false )
+{
+  connect( this, &QgsWfsRequest::downloadFinished, this, &QgsWFSPagePrefetchRequest::prefetchReplyFinished );
+}
+
+void QgsWFSPagePrefetchRequest::launch( const QUrl &url )
+{
+  mUrl = url;
+  mFinished = false;
+  sendGET( url,
+           false, /* synchronous */
+           true, /* forceRefresh */
+           false /* cache */ );
+}
+
+void QgsWFSPagePrefetchRequest::prefetchReplyFinished()
+{
+  mFinished = true;
+}
+
+QString QgsWFSPagePrefetchRequest::errorMessageWithReason( const QString &reason )
+{
+  return tr( "Download of next feature page failed: %1" ).arg( reason );
+}
+
+// -------------------------
+
 QgsWFSFeatureDownloader::QgsWFSFeatureDownloader( QgsWFSSharedData *shared )
   : QgsWfsRequest( shared->mURI )
   , mShared( shared )
@@ -485,6 +516,10 @@ void QgsWFSFeatureDownloader::run( bool serializeFeatures, int maxFeatures )
   bool truncatedResponse = false;
   QgsSettings s;
   const int maxRetry = s.value( QStringLiteral( "qgis/defaultTileMaxRetry" ), "3" ).toInt();
+  const bool prefetchNextPage = s.value( QStringLiteral( "qgis/wfsPrefetchNextPage" ), false ).toBool();
+  QgsWFSPagePrefetchRequest prefetchRequest( mShared->mURI );
+  connect( &prefetchRequest, &QgsWfsRequest::downloadFinished, &loop, &QEventLoop::quit );
+  bool prefetchPending = false;
   int retryIter = 0;
   int lastValidTotalDownloadedFeatureCount = 0;
   int pagingIter = 1;
@@ -536,17 +571,58 @@ void QgsWFSFeatureDownloader::run( bool serializeFeatures, int maxFeatures )
       url.addQueryItem( QStringLiteral( "RETRY" ), QString::number( retryIter ) );
     }
 
-    sendGET( url,
-             false, /* synchronous */
-             true, /* forceRefresh */
-             false /* cache */ );
+    bool usePrefetchedPage = false;
+    QByteArray prefetchedPageData;
+    if ( prefetchPending )
+    {
+      prefetchPending = false;
+      // Only use the prefetched response if it was issued for the exact URL
+      // we are about to request. The URL may have changed in the meanwhile,
+      // e.g. if one of the paging or namespace workarounds has kicked in.
+      if ( prefetchRequest.url() == url )
+      {
+        while ( !prefetchRequest.isFinished() && !mStop )
+        {
+          loop.exec( QEventLoop::ExcludeUserInputEvents );
+        }
+        if ( !mStop && prefetchRequest.errorCode() == QgsWfsRequest::NoError )
+        {
+          usePrefetchedPage = true;
+          prefetchedPageData = prefetchRequest.response();
+        }
+      }
+      if ( !usePrefetchedPage )
+      {
+        // On error, fall back to requesting the page again below
+        prefetchRequest.abort();
+      }
+    }
+
+    if ( !usePrefetchedPage )
+    {
+      sendGET( url,
+               false, /* synchronous */
+               true, /* forceRefresh */
+               false /* cache */ );
+    }
+
+    if ( prefetchNextPage && mShared->mPageSize > 0 && retryIter == 0 &&
+         ( maxTotalFeatures <= 0 || mTotalDownloadedFeatureCount + mShared->mPageSize < maxTotalFeatures ) )
+    {
+      // Request the next page while the current one is being streamed, parsed
+      // and cached. If the current page turns out to be the last one, the
+      // pending request is simply aborted.
+      prefetchRequest.launch( buildURL( mTotalDownloadedFeatureCount + mShared->mPageSize,
+                                        mShared->mPageSize, false ) );
+      prefetchPending = true;
+    }
 
     int featureCountForThisResponse = 0;
     bool bytesStillAvailableInReply = false;
     // Loop until there is no data coming from the current request
     while ( true )
     {
-      if ( !bytesStillAvailableInReply )
+      if ( !bytesStillAvailableInReply && !usePrefetchedPage )
       {
         loop.exec( QEventLoop::ExcludeUserInputEvents );
       }
@@ -564,7 +640,14 @@ void QgsWFSFeatureDownloader::run( bool serializeFeatures, int maxFeatures )
 
       QByteArray data;
       bool finished = false;
-      if ( mReply )
+      if ( usePrefetchedPage )
+      {
+        // The whole page has already been downloaded in advance
+        data = prefetchedPageData;
+        prefetchedPageData.clear();
+        finished = true;
+      }
+      else if ( mReply )
       {
         // Limit the number of bytes to process at once, to avoid the GML parser to
         // create too many objects.
@@ -576,9 +659,23 @@ void QgsWFSFeatureDownloader::run( bool serializeFeatures, int maxFeatures )
         data = mResponse;
         finished = true;
       }
-      // Parse the received chunk of data
+      // Parse the received chunk of data on a worker thread, while this
+      // thread keeps running the event loop. Otherwise the network reply is
+      // not serviced while a large chunk is parsed and the TCP window closes,
+      // stalling the download behind the parser.
       QString gmlProcessErrorMsg;
-      if ( !parser->processData( data, finished, gmlProcessErrorMsg ) )
+      QFutureWatcher<bool> parseWatcher;
+      connect( &parseWatcher, &QFutureWatcher<bool>::finished, &loop, &QEventLoop::quit );
+      parseWatcher.setFuture( QtConcurrent::run( [parser, &data, finished, &gmlProcessErrorMsg]() -> bool
+      {
+        return parser->processData( data, finished, gmlProcessErrorMsg );
+      } ) );
+      while ( !parseWatcher.isFinished() )
+      {
+        // woken up by download progress too -- just keep waiting for the parser
+        loop.exec( QEventLoop::ExcludeUserInputEvents );
+      }
+      if ( !parseWatcher.result() )
       {
         success = false;
         mErrorMessage = tr( "Error when parsing GetFeature response" ) + " : " + gmlProcessErrorMsg;
@@ -874,6 +971,7 @@ void QgsWFSFeatureDownloader::run( bool serializeFeatures, int maxFeatures )
   // otherwise will deadlock because deleteLayer() will not have a valid thread to post
   abort();
   mFeatureHitsAsyncRequest.abort();
+  prefetchRequest.abort();
 }
 
 QString QgsWFSFeatureDownloader::errorMessageWithReason( const QString &reason )
@@ -61,6 +61,36 @@ class QgsWFSFeatureHitsAsyncRequest: public QgsWfsRequest
     int mNumberMatched;
 };
 
+/**
+ * Utility class for QgsWFSFeatureDownloader. Downloads a whole GetFeature
+    page in the background, so that the next page can be requested while the
+    current one is still being parsed and cached. */
+class QgsWFSPagePrefetchRequest: public QgsWfsRequest
+{
+    Q_OBJECT
+  public:
+    explicit QgsWFSPagePrefetchRequest( QgsWFSDataSourceURI &uri );
+
+    //! Starts the asynchronous download of \a url
+    void launch( const QUrl &url );
+
+    //! Returns the url passed to launch()
+    QUrl url() const { return mUrl; }
+
+    //! Returns whether the download has completed (successfully or not)
+    bool isFinished() const { return mFinished; }
+
+  protected:
+    QString errorMessageWithReason( const QString &reason ) override;
+
+  private slots:
+    void prefetchReplyFinished();
+
+  private:
+    QUrl mUrl;
+    bool mFinished;
+};
+
 
 //! Utility class for QgsWFSFeatureDownloader
 class QgsWFSProgressDialog: public QProgressDialog
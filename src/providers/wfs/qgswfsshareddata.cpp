@@ -1018,6 +1018,11 @@ void QgsWFSSharedData::serializeFeatures( QVector<QgsWFSFeatureGmlIdPair> &featu
     QMutexLocker lockerWrite( &mCacheWriteMutex );
     bool cacheOk = mCacheDataProvider->addFeatures( featureListToCache );
 
+    // Batch the per-feature id_cache statements below in a single transaction
+    // per page, rather than one implicit transaction per statement.
+    QString idCacheErrorMsg;
+    bool idCacheTransaction = mCacheIdDb.exec( QStringLiteral( "BEGIN" ), idCacheErrorMsg ) == SQLITE_OK;
+
     // Update the feature ids of the non-cached feature, i.e. the one that
     // will be notified to the user, from the feature id of the database
     // That way we will always have a consistent feature id, even in case of
@@ -1078,6 +1083,9 @@ void QgsWFSSharedData::serializeFeatures( QVector<QgsWFSFeatureGmlIdPair> &featu
       updatedFeatureList[i].first.setId( qgisId );
     }
 
+    if ( idCacheTransaction )
+      ( void )mCacheIdDb.exec( QStringLiteral( "COMMIT" ), idCacheErrorMsg );
+
     {
       QMutexLocker locker( &mMutex );
       if ( mRequestLimit != 1 )
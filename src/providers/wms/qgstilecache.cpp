@@ -17,22 +17,35 @@
 
 #include "qgsnetworkaccessmanager.h"
 #include "qgsapplication.h"
+#include "qgssettings.h"
 #include <QAbstractNetworkCache>
 #include <QImage>
 
 QCache<QUrl, QImage> QgsTileCache::sTileCache( 256 );
 QMutex QgsTileCache::sTileCacheMutex;
+bool QgsTileCache::sTileCacheInitialized = false;
 
+void QgsTileCache::initCacheSize()
+{
+  // number of decoded tiles kept in memory - without enough of them panning of
+  // tiled layers is bound by image decoding even when all data is in the network cache
+  sTileCache.setMaxCost( QgsSettings().value( QStringLiteral( "qgis/wmsTileCacheSize" ), 256 ).toInt() );
+  sTileCacheInitialized = true;
+}
 
 void QgsTileCache::insertTile( const QUrl &url, const QImage &image )
 {
   QMutexLocker locker( &sTileCacheMutex );
+  if ( !sTileCacheInitialized )
+    initCacheSize();
   sTileCache.insert( url, new QImage( image ) );
 }
 
 bool QgsTileCache::tile( const QUrl &url, QImage &image )
 {
   QMutexLocker locker( &sTileCacheMutex );
+  if ( !sTileCacheInitialized )
+    initCacheSize();
   bool success = false;
   if ( QImage *i = sTileCache.object( url ) )
   {
@@ -50,10 +50,15 @@ class QgsTileCache
     static int maxCost() { return sTileCache.maxCost(); }
 
   private:
+    //! reads the configured cache size - to be called with the mutex locked
+    static void initCacheSize();
+
     //! in-memory cache
     static QCache<QUrl, QImage> sTileCache;
     //! mutex to protect the in-memory cache
     static QMutex sTileCacheMutex;
+    //! whether the cache size has been read from the settings yet
+    static bool sTileCacheInitialized;
 };
 
 #endif // QGSTILECACHE_H
@@ -724,6 +724,21 @@ QImage *QgsWmsProvider::draw( QgsRectangle const &viewExtent, int pixelWidth, in
     int col0, col1, row0, row1;
     tm->viewExtentIntersection( viewExtent, tml, col0, row0, col1, row1 );
 
+    // optionally extend the range by one ring of tiles around the view, so that
+    // a subsequent pan in any direction can be served from the tile cache
+    if ( !( feedback && feedback->isPreviewOnly() ) &&
+         QgsSettings().value( QStringLiteral( "qgis/wmsTilePrefetch" ), false ).toBool() )
+    {
+      const int minCol = tml ? tml->minTileCol : 0;
+      const int maxCol = tml ? tml->maxTileCol : tm->matrixWidth - 1;
+      const int minRow = tml ? tml->minTileRow : 0;
+      const int maxRow = tml ? tml->maxTileRow : tm->matrixHeight - 1;
+      col0 = std::max( col0 - 1, minCol );
+      col1 = std::min( col1 + 1, maxCol );
+      row0 = std::max( row0 - 1, minRow );
+      row1 = std::min( row1 + 1, maxRow );
+    }
+
 #ifdef QGISDEBUG
     int n = ( col1 - col0 + 1 ) * ( row1 - row0 + 1 );
     QgsDebugMsg( QStringLiteral( "tile number: %1x%2 = %3" ).arg( col1 - col0 + 1 ).arg( row1 - row0 + 1 ).arg( n ) );
@@ -117,6 +117,13 @@ QgsFcgiServerRequest::QgsFcgiServerRequest()
   setUrl( url );
   setMethod( method );
 
+  // forward the validator header, so that services can answer with 304 Not Modified
+  const char *ifNoneMatch = getenv( "HTTP_IF_NONE_MATCH" );
+  if ( ifNoneMatch )
+  {
+    setHeader( QStringLiteral( "If-None-Match" ), ifNoneMatch );
+  }
+
   // Output debug infos
   Qgis::MessageLevel logLevel = QgsServerLogger::instance()->logLevel();
   if ( logLevel <= Qgis::Info )
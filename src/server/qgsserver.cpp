@@ -33,6 +33,7 @@
 #include "qgsserverlogger.h"
 #include "qgsserverrequest.h"
 #include "qgsfilterresponsedecorator.h"
+#include "qgsserverexception.h"
 #include "qgsservice.h"
 #include "qgsserverparameters.h"
 #include "qgsapplication.h"
@@ -246,6 +247,25 @@ bool QgsServer::init()
   qDebug() << "Initializing server modules from " << modulePath << endl;
   sServiceRegistry->init( modulePath,  sServerInterface );
 
+  // optionally preload the configured project, so that this worker pays the
+  // parsing cost during startup instead of during its first request
+  if ( sSettings.projectCachePreload() )
+  {
+    const QString preloadPath = configPath( defaultConfigFilePath, QString() );
+    if ( !preloadPath.isEmpty() && QFileInfo::exists( preloadPath ) )
+    {
+      QgsMessageLog::logMessage( QStringLiteral( "Preloading project file: %1" ).arg( preloadPath ), QStringLiteral( "Server" ), Qgis::Info );
+      try
+      {
+        QgsConfigCache::instance()->project( preloadPath );
+      }
+      catch ( QgsServerException &ex )
+      {
+        QgsMessageLog::logMessage( QStringLiteral( "Error preloading project file '%1': %2" ).arg( preloadPath, ex.what() ), QStringLiteral( "Server" ), Qgis::Critical );
+      }
+    }
+  }
+
   sInitialized = true;
   QgsMessageLog::logMessage( QStringLiteral( "Server initialized" ), QStringLiteral( "Server" ), Qgis::Info );
   return true;
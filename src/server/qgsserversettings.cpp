@@ -139,6 +139,28 @@ void QgsServerSettings::initSettings()
                                QVariant()
                              };
   mSettings[ sCacheSize.envVar ] = sCacheSize;
+
+  // max render time
+  const Setting sMaxRenderTime = { QgsServerSettingsEnv::QGIS_SERVER_WMS_MAX_RENDER_TIME,
+                                   QgsServerSettingsEnv::DEFAULT_VALUE,
+                                   "Maximum time in seconds allowed for a WMS GetMap rendering job (0 for no limit)",
+                                   "/qgis/wms_max_render_time",
+                                   QVariant::Int,
+                                   QVariant( 0 ),
+                                   QVariant()
+                                 };
+  mSettings[ sMaxRenderTime.envVar ] = sMaxRenderTime;
+
+  // project cache preload
+  const Setting sProjectPreload = { QgsServerSettingsEnv::QGIS_SERVER_PROJECT_CACHE_PRELOAD,
+                                    QgsServerSettingsEnv::DEFAULT_VALUE,
+                                    "Activate/Deactivate loading the configured project at server startup",
+                                    "/qgis/project_cache_preload",
+                                    QVariant::Bool,
+                                    QVariant( false ),
+                                    QVariant()
+                                  };
+  mSettings[ sProjectPreload.envVar ] = sProjectPreload;
 }
 
 void QgsServerSettings::load()
@@ -319,3 +341,13 @@ QString QgsServerSettings::cacheDirectory() const
 {
   return value( QgsServerSettingsEnv::QGIS_SERVER_CACHE_DIRECTORY ).toString();
 }
+
+int QgsServerSettings::wmsMaxRenderTime() const
+{
+  return value( QgsServerSettingsEnv::QGIS_SERVER_WMS_MAX_RENDER_TIME ).toInt();
+}
+
+bool QgsServerSettings::projectCachePreload() const
+{
+  return value( QgsServerSettingsEnv::QGIS_SERVER_PROJECT_CACHE_PRELOAD ).toBool();
+}
@@ -60,7 +60,9 @@ class SERVER_EXPORT QgsServerSettingsEnv : public QObject
       QGIS_PROJECT_FILE,
       MAX_CACHE_LAYERS,
       QGIS_SERVER_CACHE_DIRECTORY,
-      QGIS_SERVER_CACHE_SIZE
+      QGIS_SERVER_CACHE_SIZE,
+      QGIS_SERVER_WMS_MAX_RENDER_TIME,
+      QGIS_SERVER_PROJECT_CACHE_PRELOAD
     };
     Q_ENUM( EnvVar )
 };
@@ -168,6 +170,22 @@ class SERVER_EXPORT QgsServerSettings
       */
     QString cacheDirectory() const;
 
+    /**
+     * Returns the maximum time allowed for a WMS GetMap rendering job.
+     * \returns the maximum rendering time in seconds, or 0 if unlimited.
+     * \since QGIS 3.8
+     */
+    int wmsMaxRenderTime() const;
+
+    /**
+     * Returns whether the configured project is loaded into the config cache
+     * during server initialization, so that the first request does not pay the
+     * project parsing cost.
+     * \returns TRUE if project preloading is activated, FALSE otherwise.
+     * \since QGIS 3.8
+     */
+    bool projectCachePreload() const;
+
   private:
     void initSettings();
     QVariant value( QgsServerSettingsEnv::EnvVar envVar ) const;
@@ -83,6 +83,10 @@ namespace QgsWfs
     QgsWfsParameters mWfsParameters;
     /* GeoJSON Exporter */
     QgsJsonExporter mJsonExporter;
+    /* Number of bytes buffered in the response since the last flush */
+    qint64 mPendingFlushSize = 0;
+    /* Flush the streamed response once this many bytes are buffered */
+    const qint64 WFS_FLUSH_SIZE = 64 * 1024;
   }
 
   void writeGetFeature( QgsServerInterface *serverIface, const QgsProject *project,
@@ -1037,6 +1041,7 @@ namespace QgsWfs
     void startGetFeature( const QgsServerRequest &request, QgsServerResponse &response, const QgsProject *project, QgsWfsParameters::Format format,
                           int prec, QgsCoordinateReferenceSystem &crs, QgsRectangle *rect, const QStringList &typeNames )
     {
+      mPendingFlushSize = 0;
       QString fcString;
 
       std::unique_ptr< QgsRectangle > transformedRect;
@@ -1170,6 +1175,7 @@ namespace QgsWfs
       if ( !feat->isValid() )
         return;
 
+      QByteArray payload;
       if ( format == QgsWfsParameters::Format::GeoJSON )
       {
         QString fcString;
@@ -1184,7 +1190,7 @@ namespace QgsWfs
         fcString += createFeatureGeoJSON( feat, params );
         fcString += QLatin1String( "\n" );
 
-        response.write( fcString.toUtf8() );
+        payload = fcString.toUtf8();
       }
       else
       {
@@ -1200,11 +1206,18 @@ namespace QgsWfs
           featureElement = createFeatureGML2( feat, gmlDoc, params, project );
           gmlDoc.appendChild( featureElement );
         }
-        response.write( gmlDoc.toByteArray() );
+        payload = gmlDoc.toByteArray();
       }
+      response.write( payload );
 
-      // Stream partial content
-      response.flush();
+      // Stream partial content in bounded chunks. Flushing after every feature
+      // costs one FCGI record write per feature, which dominates large extracts
+      mPendingFlushSize += payload.size();
+      if ( mPendingFlushSize >= WFS_FLUSH_SIZE )
+      {
+        response.flush();
+        mPendingFlushSize = 0;
+      }
     }
 
     void endGetFeature( QgsServerResponse &response, QgsWfsParameters::Format format )
@@ -22,6 +22,9 @@
 #include "qgsmaprenderercustompainterjob.h"
 #include "qgsapplication.h"
 
+#include <QEventLoop>
+#include <QTimer>
+
 namespace QgsWms
 {
 
@@ -29,10 +32,12 @@ namespace QgsWms
     bool parallelRendering
     , int maxThreads
     , QgsFeatureFilterProvider *featureFilterProvider
+    , int maxRenderTime
   )
     :
     mParallelRendering( parallelRendering )
     , mFeatureFilterProvider( featureFilterProvider )
+    , mMaxRenderTime( maxRenderTime )
   {
 #ifndef HAVE_SERVER_PYTHON_PLUGINS
     Q_UNUSED( mFeatureFilterProvider );
@@ -62,6 +67,22 @@ namespace QgsWms
       // threads (see discussion in https://issues.qgis.org/issues/18988).
       QEventLoop loop;
       QObject::connect( &renderJob, &QgsMapRendererParallelJob::finished, &loop, &QEventLoop::quit );
+
+      // per request deadline: abort the job when the maximum rendering time is
+      // exceeded, so that one expensive request cannot hold the process forever
+      bool timedOut = false;
+      QTimer deadlineTimer;
+      deadlineTimer.setSingleShot( true );
+      if ( mMaxRenderTime > 0 )
+      {
+        QObject::connect( &deadlineTimer, &QTimer::timeout, &loop, [&renderJob, &timedOut]
+        {
+          timedOut = true;
+          renderJob.cancelWithoutBlocking();
+        } );
+        deadlineTimer.start( mMaxRenderTime * 1000 );
+      }
+
       loop.exec();
 
       renderJob.waitForFinished();
@@ -69,6 +90,10 @@ namespace QgsWms
       mPainter.reset( new QPainter( image ) );
 
       mErrors = renderJob.errors();
+      if ( timedOut )
+      {
+        mErrors.append( QgsMapRendererJob::Error( QString(), QStringLiteral( "Rendering exceeded the maximum allowed time of %1 seconds" ).arg( mMaxRenderTime ) ) );
+      }
     }
     else
     {
@@ -77,8 +102,37 @@ namespace QgsWms
 #ifdef HAVE_SERVER_PYTHON_PLUGINS
       renderJob.setFeatureFilterProvider( mFeatureFilterProvider );
 #endif
-      renderJob.renderSynchronously();
-      mErrors = renderJob.errors();
+      if ( mMaxRenderTime > 0 )
+      {
+        renderJob.start();
+
+        QEventLoop loop;
+        QObject::connect( &renderJob, &QgsMapRendererCustomPainterJob::finished, &loop, &QEventLoop::quit );
+
+        bool timedOut = false;
+        QTimer deadlineTimer;
+        deadlineTimer.setSingleShot( true );
+        QObject::connect( &deadlineTimer, &QTimer::timeout, &loop, [&renderJob, &timedOut]
+        {
+          timedOut = true;
+          renderJob.cancelWithoutBlocking();
+        } );
+        deadlineTimer.start( mMaxRenderTime * 1000 );
+
+        loop.exec();
+
+        renderJob.waitForFinished();
+        mErrors = renderJob.errors();
+        if ( timedOut )
+        {
+          mErrors.append( QgsMapRendererJob::Error( QString(), QStringLiteral( "Rendering exceeded the maximum allowed time of %1 seconds" ).arg( mMaxRenderTime ) ) );
+        }
+      }
+      else
+      {
+        renderJob.renderSynchronously();
+        mErrors = renderJob.errors();
+      }
     }
   }
 
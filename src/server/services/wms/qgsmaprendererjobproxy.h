@@ -42,11 +42,13 @@ namespace QgsWms
        * \param parallelRendering TRUE to activate parallel rendering, FALSE otherwise
        * \param maxThreads The number of threads to use in case of parallel rendering
        * \param featureFilterProvider Features filtering
+       * \param maxRenderTime Maximum allowed time for the rendering in seconds, 0 for no limit (since QGIS 3.8)
        */
       QgsMapRendererJobProxy(
         bool parallelRendering
         , int maxThreads
         , QgsFeatureFilterProvider *featureFilterProvider
+        , int maxRenderTime = 0
       );
 
       /**
@@ -71,6 +73,7 @@ namespace QgsWms
     private:
       bool mParallelRendering;
       QgsFeatureFilterProvider *mFeatureFilterProvider = nullptr;
+      int mMaxRenderTime = 0;
       std::unique_ptr<QPainter> mPainter;
 
       void getRenderErrors( const QgsMapRendererJob *job );
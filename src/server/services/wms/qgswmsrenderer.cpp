@@ -40,6 +40,7 @@
 #include "qgsrasteridentifyresult.h"
 #include "qgsrasterlayer.h"
 #include "qgsrasterrenderer.h"
+#include "qgsrasterresamplefilter.h"
 #include "qgsscalecalculator.h"
 #include "qgscoordinatereferencesystem.h"
 #include "qgsvectordataprovider.h"
@@ -870,6 +871,19 @@ namespace QgsWms
     std::reverse( layers.begin(), layers.end() );
     mapSettings.setLayers( layers );
 
+    // single-layer untransformed raster requests map 1:1 onto a raster pipe
+    // read -- stream the pipe output straight into the image instead of going
+    // through the map renderer job and its compositor
+    if ( !hitTest && directRasterRendering( mapSettings, *image, layers ) )
+    {
+      // scale output image if necessary (required by WMS spec)
+      QImage *scaledImage = scaleImage( image.get() );
+      if ( scaledImage )
+        image.reset( scaledImage );
+
+      return image.release();
+    }
+
     // rendering step for layers
     painter.reset( layersRendering( mapSettings, *image, hitTest ) );
 
@@ -3067,7 +3081,7 @@ namespace QgsWms
       mAccessControl->resolveFilterFeatures( mapSettings.layers() );
       filters.addProvider( mAccessControl );
 #endif
-      QgsMapRendererJobProxy renderJob( mSettings.parallelRendering(), mSettings.maxThreads(), &filters );
+      QgsMapRendererJobProxy renderJob( mSettings.parallelRendering(), mSettings.maxThreads(), &filters, mSettings.wmsMaxRenderTime() );
       renderJob.render( mapSettings, &image );
       painter = renderJob.takePainter();
 
@@ -3091,6 +3105,59 @@ namespace QgsWms
     return painter;
   }
 
+  bool QgsRenderer::directRasterRendering( const QgsMapSettings &mapSettings, QImage &image, const QList<QgsMapLayer *> &layers ) const
+  {
+    // only single-layer requests without extra symbology qualify
+    if ( layers.count() != 1 || !mWmsParameters.sldBody().isEmpty() )
+      return false;
+
+    QgsRasterLayer *rasterLayer = qobject_cast<QgsRasterLayer *>( layers.at( 0 ) );
+    if ( !rasterLayer || !rasterLayer->renderer() )
+      return false;
+
+    // any reprojection still needs the full pipeline with its projector
+    if ( rasterLayer->crs() != mapSettings.destinationCrs() )
+      return false;
+
+    // annotations are composited over the layers by the standard path
+    if ( !mProject->annotationManager()->annotations().isEmpty() )
+      return false;
+
+    if ( !rasterLayer->isInScaleRange( mapSettings.scale() ) )
+    {
+      // nothing to draw -- the background filled image is already the answer
+      image.fill( mapSettings.backgroundColor().rgba() );
+      return true;
+    }
+
+    // read the pipe output (renderer, brightness, hue/saturation and resample
+    // stages) in one block covering the whole answer
+    QgsRasterInterface *input = rasterLayer->resampleFilter();
+    if ( !input )
+      input = rasterLayer->renderer();
+
+    // last pipe filter has only 1 band
+    std::unique_ptr<QgsRasterBlock> block( input->block( 1, mapSettings.visibleExtent(),
+                                           mapSettings.outputSize().width(),
+                                           mapSettings.outputSize().height() ) );
+    if ( !block )
+      return false;
+
+    const QImage blockImage = block->image();
+    if ( blockImage.isNull() )
+      return false;
+
+    image.fill( mapSettings.backgroundColor().rgba() );
+
+    // a single blit composites the block over the background -- no per-layer
+    // canvas round-trip is involved
+    QPainter painter( &image );
+    painter.drawImage( 0, 0, blockImage );
+    painter.end();
+
+    return true;
+  }
+
   void QgsRenderer::setLayerOpacity( QgsMapLayer *layer, int opacity ) const
   {
     if ( opacity >= 0 && opacity <= 255 )
@@ -144,6 +144,11 @@ namespace QgsWms
       // Rendering step for layers
       QPainter *layersRendering( const QgsMapSettings &mapSettings, QImage &image, HitTest *hitTest = nullptr ) const;
 
+      // Direct rendering step for single-layer untransformed raster requests,
+      // bypassing the map renderer job and its compositor. Returns false if the
+      // request does not map 1:1 onto a raster pipe read.
+      bool directRasterRendering( const QgsMapSettings &mapSettings, QImage &image, const QList<QgsMapLayer *> &layers ) const;
+
       // Rendering step for annotations
       void annotationsRendering( QPainter *painter ) const;
 
@@ -18,6 +18,7 @@
 #include "qgswmtsparameters.h"
 #include "qgswmtsgettile.h"
 
+#include <QCryptographicHash>
 #include <QImage>
 
 namespace QgsWmts
@@ -62,7 +63,15 @@ namespace QgsWmts
       QByteArray content = cacheManager->getCachedImage( project, request, accessControl );
       if ( !content.isEmpty() && image->loadFromData( content ) )
       {
+        const QString etag = QString::fromLatin1( QCryptographicHash::hash( content, QCryptographicHash::Md5 ).toHex() );
+        if ( request.header( QStringLiteral( "If-None-Match" ) ) == etag )
+        {
+          // the client already holds the current tile, no need to send it again
+          response.setStatusCode( 304 );
+          return;
+        }
         response.setHeader( QStringLiteral( "Content-Type" ), contentType );
+        response.setHeader( QStringLiteral( "ETag" ), etag );
         image->save( response.io(), qPrintable( saveFormat ) );
         return;
       }
@@ -77,7 +86,10 @@ namespace QgsWmts
     {
       QByteArray content = response.data();
       if ( !content.isEmpty() )
+      {
         cacheManager->setCachedImage( &content, project, request, accessControl );
+        response.setHeader( QStringLiteral( "ETag" ), QString::fromLatin1( QCryptographicHash::hash( content, QCryptographicHash::Md5 ).toHex() ) );
+      }
     }
   }
 
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""
+***************************************************************************
+    bench_compare.py
+    ----------------
+    Compares two qgis_bench_micro JSON reports and fails when a benchmark
+    regressed by more than a threshold.
+
+    Usage:
+        qgis_bench_micro --output baseline.json
+        ... build the revision under test ...
+        qgis_bench_micro --output current.json
+        bench_compare.py baseline.json current.json [--threshold 5]
+
+    Exits with status 1 when any benchmark's median slowed down by more than
+    the threshold percentage, which lets CI gate on performance regressions.
+    ----------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+***************************************************************************
+*                                                                         *
+*   This program is free software; you can redistribute it and/or modify  *
+*   it under the terms of the GNU General Public License as published by  *
+*   the Free Software Foundation; either version 2 of the License, or     *
+*   (at your option) any later version.                                   *
+*                                                                         *
+***************************************************************************
+"""
+
+import argparse
+import json
+import sys
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare qgis_bench_micro reports')
+    parser.add_argument('baseline', help='JSON report of the baseline run')
+    parser.add_argument('current', help='JSON report of the run under test')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='maximum tolerated slowdown of the median, in percent (default 5)')
+    parser.add_argument('--metric', default='median_ms',
+                        choices=['median_ms', 'min_ms', 'mean_ms'],
+                        help='which statistic to compare (default median_ms)')
+    args = parser.parse_args()
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)['benchmarks']
+    with open(args.current) as f:
+        current = json.load(f)['benchmarks']
+
+    regressions = []
+    for name in sorted(baseline):
+        if name not in current:
+            print('{}: missing from current run, skipped'.format(name))
+            continue
+        base = baseline[name][args.metric]
+        cur = current[name][args.metric]
+        if base <= 0:
+            continue
+        delta = (cur - base) / base * 100.0
+        status = 'ok'
+        if delta > args.threshold:
+            status = 'REGRESSION'
+            regressions.append(name)
+        print('{}: {:.3f} ms -> {:.3f} ms ({:+.1f}%) {}'.format(name, base, cur, delta, status))
+
+    for name in sorted(current):
+        if name not in baseline:
+            print('{}: new benchmark, no baseline'.format(name))
+
+    if regressions:
+        print('\n{} benchmark(s) regressed by more than {}%: {}'.format(
+            len(regressions), args.threshold, ', '.join(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
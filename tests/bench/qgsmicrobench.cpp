@@ -0,0 +1,302 @@
+/***************************************************************************
+                 qgsmicrobench.cpp  - Micro benchmarks
+                             -------------------
+    begin                : September 2026
+    copyright            : (C) 2026 by QGIS developers
+    email                : info at qgis dot org
+ ***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+// Reproducible micro benchmarks for the hot paths of the rendering and
+// provider stack: feature iteration, WKB decoding, coordinate transforms,
+// symbol rendering and raster block throughput. All datasets are generated
+// in memory with fixed seeds so runs are comparable across machines and
+// revisions. Results are written as JSON; use bench_compare.py to diff two
+// runs and flag regressions.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QImage>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPainter>
+
+#include "qgsapplication.h"
+#include "qgscoordinatereferencesystem.h"
+#include "qgscoordinatetransform.h"
+#include "qgsfeature.h"
+#include "qgsfeatureiterator.h"
+#include "qgsgeometry.h"
+#include "qgsrasterblock.h"
+#include "qgsrendercontext.h"
+#include "qgssymbol.h"
+#include "qgsvectorlayer.h"
+
+typedef std::function<void()> BenchFunction;
+
+struct BenchResult
+{
+  QString name;
+  QVector<double> millisecondsPerCycle;
+};
+
+//! Runs \a function \a cycles times and records the wall time of each cycle
+static BenchResult runBenchmark( const QString &name, int cycles, const BenchFunction &setup, const BenchFunction &function )
+{
+  BenchResult result;
+  result.name = name;
+
+  if ( setup )
+    setup();
+
+  // one untimed warmup cycle so allocators and caches reach steady state
+  function();
+
+  QElapsedTimer timer;
+  for ( int i = 0; i < cycles; i++ )
+  {
+    timer.start();
+    function();
+    result.millisecondsPerCycle.append( timer.nsecsElapsed() / 1e6 );
+  }
+  return result;
+}
+
+//! Deterministic pseudo random doubles in [0, 1), fixed seed for reproducibility
+struct BenchRandom
+{
+  quint64 state = 88172645463325252ULL;
+  double next()
+  {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return static_cast< double >( state % 1000000 ) / 1000000.0;
+  }
+};
+
+static std::unique_ptr< QgsVectorLayer > createPointLayer( int featureCount )
+{
+  std::unique_ptr< QgsVectorLayer > layer( new QgsVectorLayer(
+        QStringLiteral( "Point?crs=epsg:4326&field=id:integer&field=name:string&field=value:double" ),
+        QStringLiteral( "bench" ), QStringLiteral( "memory" ) ) );
+
+  BenchRandom random;
+  QgsFeatureList features;
+  features.reserve( featureCount );
+  for ( int i = 0; i < featureCount; i++ )
+  {
+    QgsFeature f( layer->fields() );
+    f.setGeometry( QgsGeometry::fromPointXY( QgsPointXY( random.next() * 360 - 180, random.next() * 180 - 90 ) ) );
+    f.setAttributes( QgsAttributes() << i << QStringLiteral( "feature %1" ).arg( i ) << random.next() );
+    features << f;
+  }
+  layer->dataProvider()->addFeatures( features );
+  return layer;
+}
+
+int main( int argc, char **argv )
+{
+  QgsApplication app( argc, argv, false );
+  QgsApplication::initQgis();
+
+  int cycles = 10;
+  QString outputFile;
+  QString filter;
+
+  const QStringList args = QCoreApplication::arguments();
+  for ( int i = 1; i < args.size(); i++ )
+  {
+    const QString arg = args.at( i );
+    if ( arg == QLatin1String( "--cycles" ) && i + 1 < args.size() )
+    {
+      cycles = args.at( ++i ).toInt();
+    }
+    else if ( arg == QLatin1String( "--output" ) && i + 1 < args.size() )
+    {
+      outputFile = args.at( ++i );
+    }
+    else if ( arg == QLatin1String( "--filter" ) && i + 1 < args.size() )
+    {
+      filter = args.at( ++i );
+    }
+    else
+    {
+      std::cout << "usage: qgis_bench_micro [--cycles N] [--output results.json] [--filter name]" << std::endl;
+      return 1;
+    }
+  }
+
+  QList< BenchResult > results;
+  const auto maybeRun = [&]( const QString & name, const BenchFunction & setup, const BenchFunction & function )
+  {
+    if ( filter.isEmpty() || name.contains( filter ) )
+      results << runBenchmark( name, cycles, setup, function );
+  };
+
+  // --- feature iteration over a memory layer ------------------------------
+  std::unique_ptr< QgsVectorLayer > pointLayer;
+  maybeRun( QStringLiteral( "feature_iteration" ),
+            [&] { pointLayer = createPointLayer( 50000 ); },
+            [&]
+  {
+    QgsFeature f;
+    long long count = 0;
+    QgsFeatureIterator it = pointLayer->getFeatures();
+    while ( it.nextFeature( f ) )
+      count += f.attributes().count();
+    if ( count <= 0 )
+      std::abort(); // defeat optimization of the loop
+  } );
+
+  // --- WKB decoding -------------------------------------------------------
+  QByteArray wkb;
+  maybeRun( QStringLiteral( "wkb_decode" ),
+            [&]
+  {
+    // a polygon with enough vertexes that decoding dominates the call overhead
+    BenchRandom random;
+    QVector< QgsPointXY > ring;
+    for ( int i = 0; i < 1000; i++ )
+      ring << QgsPointXY( std::cos( i * 2 * M_PI / 1000.0 ) + random.next() * 0.01,
+                          std::sin( i * 2 * M_PI / 1000.0 ) + random.next() * 0.01 );
+    ring << ring.first();
+    wkb = QgsGeometry::fromPolygonXY( QgsPolygonXY() << ring ).asWkb();
+  },
+  [&]
+  {
+    for ( int i = 0; i < 1000; i++ )
+    {
+      QgsGeometry g;
+      g.fromWkb( wkb );
+      if ( g.isNull() )
+        std::abort();
+    }
+  } );
+
+  // --- coordinate transforms ----------------------------------------------
+  QVector< double > xCoords, yCoords;
+  maybeRun( QStringLiteral( "coordinate_transform" ),
+            [&]
+  {
+    BenchRandom random;
+    for ( int i = 0; i < 200000; i++ )
+    {
+      xCoords << random.next() * 360 - 180;
+      yCoords << random.next() * 170 - 85;
+    }
+  },
+  [&]
+  {
+    const QgsCoordinateTransform transform( QgsCoordinateReferenceSystem( QStringLiteral( "EPSG:4326" ) ),
+                                            QgsCoordinateReferenceSystem( QStringLiteral( "EPSG:3857" ) ),
+                                            QgsCoordinateTransformContext() );
+    QVector< double > x = xCoords;
+    QVector< double > y = yCoords;
+    QVector< double > z( x.size(), 0.0 );
+    transform.transformCoords( x.size(), x.data(), y.data(), z.data() );
+  } );
+
+  // --- symbol rendering ---------------------------------------------------
+  std::unique_ptr< QgsMarkerSymbol > marker;
+  QImage symbolImage( 512, 512, QImage::Format_ARGB32_Premultiplied );
+  maybeRun( QStringLiteral( "symbol_rendering" ),
+            [&] { marker.reset( QgsMarkerSymbol::createSimple( QgsStringMap() ) ); },
+            [&]
+  {
+    symbolImage.fill( Qt::transparent );
+    QPainter painter( &symbolImage );
+    QgsRenderContext context = QgsRenderContext::fromQPainter( &painter );
+    marker->startRender( context );
+    BenchRandom random;
+    for ( int i = 0; i < 20000; i++ )
+      marker->renderPoint( QPointF( random.next() * 512, random.next() * 512 ), nullptr, context );
+    marker->stopRender( context );
+  } );
+
+  // --- raster block throughput --------------------------------------------
+  std::unique_ptr< QgsRasterBlock > block;
+  maybeRun( QStringLiteral( "raster_block" ),
+            [&]
+  {
+    block.reset( new QgsRasterBlock( Qgis::Float64, 2048, 2048 ) );
+    BenchRandom random;
+    for ( int row = 0; row < 2048; row++ )
+    {
+      for ( int col = 0; col < 2048; col++ )
+        block->setValue( row, col, random.next() );
+    }
+  },
+  [&]
+  {
+    double sum = 0;
+    bool isNoData = false;
+    for ( int row = 0; row < 2048; row++ )
+    {
+      for ( int col = 0; col < 2048; col++ )
+        sum += block->valueAndNoData( row, col, isNoData );
+    }
+    if ( sum <= 0 )
+      std::abort();
+  } );
+
+  // --- report -------------------------------------------------------------
+  QJsonObject report;
+  report.insert( QStringLiteral( "cycles" ), cycles );
+  QJsonObject benchmarks;
+  for ( const BenchResult &result : results )
+  {
+    QVector<double> times = result.millisecondsPerCycle;
+    std::sort( times.begin(), times.end() );
+    double total = 0;
+    for ( double t : times )
+      total += t;
+
+    QJsonObject entry;
+    entry.insert( QStringLiteral( "min_ms" ), times.first() );
+    entry.insert( QStringLiteral( "median_ms" ), times.at( times.size() / 2 ) );
+    entry.insert( QStringLiteral( "mean_ms" ), total / times.size() );
+    QJsonArray all;
+    for ( double t : times )
+      all.append( t );
+    entry.insert( QStringLiteral( "times_ms" ), all );
+    benchmarks.insert( result.name, entry );
+
+    std::cout << result.name.toStdString() << ": min " << times.first() << " ms, median "
+              << times.at( times.size() / 2 ) << " ms" << std::endl;
+  }
+  report.insert( QStringLiteral( "benchmarks" ), benchmarks );
+
+  const QByteArray json = QJsonDocument( report ).toJson();
+  if ( !outputFile.isEmpty() )
+  {
+    QFile file( outputFile );
+    if ( !file.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+    {
+      std::cerr << "cannot write " << outputFile.toStdString() << std::endl;
+      return 1;
+    }
+    file.write( json );
+  }
+  else
+  {
+    std::cout << json.constData() << std::endl;
+  }
+
+  QgsApplication::exitQgis();
+  return 0;
+}
@@ -3302,6 +3302,44 @@ class TestQgsExpression: public QObject
       QCOMPARE( v.toDateTime().toMSecsSinceEpoch(), v2.toDateTime().toMSecsSinceEpoch() );
     }
 
+    void test_functionMemoization()
+    {
+      // geom_from_wkt is memoizable -- repeated argument tuples are served from a
+      // per-node memo, and results must not leak across different argument tuples
+      QgsFields fields;
+      fields.append( QgsField( QStringLiteral( "wkt" ), QVariant::String ) );
+      QgsFeature f( fields );
+      f.setAttribute( QStringLiteral( "wkt" ), QStringLiteral( "Point (1 2)" ) );
+
+      QgsExpression e( QStringLiteral( "geom_to_wkt( geom_from_wkt( \"wkt\" ) )" ) );
+      QgsExpressionContext context = QgsExpressionContextUtils::createFeatureBasedContext( f, fields );
+      QVERIFY( e.prepare( &context ) );
+      QCOMPARE( e.evaluate( &context ).toString(), QStringLiteral( "Point (1 2)" ) );
+      QCOMPARE( e.evaluate( &context ).toString(), QStringLiteral( "Point (1 2)" ) );
+
+      f.setAttribute( QStringLiteral( "wkt" ), QStringLiteral( "Point (3 4)" ) );
+      context.setFeature( f );
+      QCOMPARE( e.evaluate( &context ).toString(), QStringLiteral( "Point (3 4)" ) );
+
+      f.setAttribute( QStringLiteral( "wkt" ), QStringLiteral( "Point (1 2)" ) );
+      context.setFeature( f );
+      QCOMPARE( e.evaluate( &context ).toString(), QStringLiteral( "Point (1 2)" ) );
+
+      // memo keys must be type strict: QVariant::operator== equates 0, "0" and 0.0,
+      // but a result cached for one type must not be served for another
+      QgsExpressionNodeFunction node( 0, nullptr );
+      node.setMemoizedResult( QVariantList() << QVariant( 0 ), QVariant( QStringLiteral( "int result" ) ) );
+      bool found = false;
+      QCOMPARE( node.memoizedResult( QVariantList() << QVariant( 0 ), found ).toString(), QStringLiteral( "int result" ) );
+      QVERIFY( found );
+      ( void )node.memoizedResult( QVariantList() << QVariant( QStringLiteral( "0" ) ), found );
+      QVERIFY( !found );
+      ( void )node.memoizedResult( QVariantList() << QVariant( 0.0 ), found );
+      QVERIFY( !found );
+      ( void )node.memoizedResult( QVariantList() << QVariant( 0 ) << QVariant( 1 ), found );
+      QVERIFY( !found );
+    }
+
     void test_IndexOperator()
     {
       QgsExpressionContext context;
@@ -38,6 +38,7 @@ class TestQgsFeature: public QObject
     void assignment();
     void gettersSetters(); //test getters and setters
     void attributes();
+    void moveAttributes();
     void geometry();
     void asVariant(); //test conversion to and from a QVariant
     void fields();
@@ -265,6 +266,42 @@ void TestQgsFeature::attributes()
   QCOMPARE( feature.attributes(), mAttrs );
 }
 
+void TestQgsFeature::moveAttributes()
+{
+  //test rvalue setAttributes overload
+  QgsFeature feature;
+  QVERIFY( !feature.isValid() );
+  QgsAttributes attrs( mAttrs );
+  feature.setAttributes( std::move( attrs ) );
+  QCOMPARE( feature.attributes(), mAttrs );
+  //feature was invalid, setting attributes should make it valid
+  QVERIFY( feature.isValid() );
+  //moved-from attributes must be left in a valid (unspecified) state
+  attrs = mAttrs;
+  QCOMPARE( attrs, mAttrs );
+
+  //moving equal attributes onto a feature must not change it
+  feature.setAttributes( std::move( attrs ) );
+  QCOMPARE( feature.attributes(), mAttrs );
+
+  //test implicit sharing detachment when moving
+  QgsFeature copy( feature );
+  QCOMPARE( copy.attributes(), feature.attributes() );
+  QgsAttributes newAttrs;
+  newAttrs << QVariant( 1 ) << QVariant( 3 );
+  copy.setAttributes( std::move( newAttrs ) );
+  QgsAttributes expected;
+  expected << QVariant( 1 ) << QVariant( 3 );
+  QCOMPARE( copy.attributes(), expected );
+  QCOMPARE( feature.attributes(), mAttrs );
+
+  //fields should be unaffected by moving attributes
+  QgsFeature fieldFeature( mFields );
+  fieldFeature.setAttributes( QgsAttributes() << QVariant( 5 ) << QVariant( 7 ) << QVariant( "val" ) );
+  QCOMPARE( fieldFeature.fields(), mFields );
+  QCOMPARE( fieldFeature.attribute( "field2" ).toInt(), 7 );
+}
+
 void TestQgsFeature::geometry()
 {
   QgsFeature feature;
@@ -52,6 +52,7 @@
 #include "qgscurvepolygon.h"
 #include "qgsproject.h"
 #include "qgslinesegment.h"
+#include "qgsfeedback.h"
 
 //qgs unit test utility class
 #include "qgsrenderchecker.h"
@@ -82,6 +83,7 @@ class TestQgsGeometry : public QObject
     void asVariant(); //test conversion to and from a QVariant
     void isEmpty();
     void equality();
+    void contentHash();
     void vertexIterator();
     void partIterator();
 
@@ -463,6 +465,32 @@ void TestQgsGeometry::equality()
   QVERIFY( !g1.equals( g2 ) );
 }
 
+void TestQgsGeometry::contentHash()
+{
+  // null geometry
+  QCOMPARE( QgsGeometry().contentHash(), 0U );
+
+  // equal content gives equal hashes, even for different internal data
+  QgsGeometry g1 = QgsGeometry::fromWkt( "LineString( 1.0 2.0, 3.0 4.0 )" );
+  QgsGeometry g2 = QgsGeometry::fromWkt( "LineString( 1.0 2.0, 3.0 4.0 )" );
+  QCOMPARE( g1.contentHash(), g2.contentHash() );
+  QCOMPARE( qHash( g1 ), qHash( g2 ) );
+
+  // differing content gives differing hashes
+  QgsGeometry g3 = QgsGeometry::fromWkt( "LineString( 3.0 4.0, 1.0 2.0 )" );
+  QVERIFY( g1.contentHash() != g3.contentHash() );
+
+  // cached hashes must not leak across mutations
+  QgsGeometry g4( g1 );
+  ( void )g4.contentHash();
+  g4.translate( 1, 1 );
+  QVERIFY( g4.contentHash() != g1.contentHash() );
+  QVERIFY( !g4.equals( g1 ) );
+
+  // hash fast path in equals() must still detect equal geometries
+  QVERIFY( g1.equals( g2 ) );
+}
+
 void TestQgsGeometry::vertexIterator()
 {
   QgsGeometry geom;
@@ -3671,6 +3699,59 @@ void TestQgsGeometry::lineString()
   QCOMPARE( l16.pointN( 2 ), l15.pointN( 2 ) );
   QCOMPARE( l16.pointN( 3 ), l15.pointN( 3 ) );
 
+  //WKB round trip, 2D
+  QgsLineString wkbLine2d;
+  wkbLine2d.setPoints( QgsPointSequence() << QgsPoint( 1, 2 )
+                       << QgsPoint( 11, 2 )
+                       << QgsPoint( 11, 22 ) );
+  QByteArray wkb2d = wkbLine2d.asWkb();
+  QgsLineString wkbLine2dRead;
+  QgsConstWkbPtr wkb2dPtr( wkb2d );
+  QVERIFY( wkbLine2dRead.fromWkb( wkb2dPtr ) );
+  QCOMPARE( wkbLine2dRead.wkbType(), QgsWkbTypes::LineString );
+  QVERIFY( !wkbLine2dRead.is3D() );
+  QVERIFY( !wkbLine2dRead.isMeasure() );
+  QVERIFY( wkbLine2dRead == wkbLine2d );
+
+  //WKB round trip, Z
+  QgsLineString wkbLineZ;
+  wkbLineZ.setPoints( QgsPointSequence() << QgsPoint( QgsWkbTypes::PointZ, 1, 2, 3 )
+                      << QgsPoint( QgsWkbTypes::PointZ, 11, 2, 13 )
+                      << QgsPoint( QgsWkbTypes::PointZ, 11, 22, 23 ) );
+  QByteArray wkbZ = wkbLineZ.asWkb();
+  QgsLineString wkbLineZRead;
+  QgsConstWkbPtr wkbZPtr( wkbZ );
+  QVERIFY( wkbLineZRead.fromWkb( wkbZPtr ) );
+  QCOMPARE( wkbLineZRead.wkbType(), QgsWkbTypes::LineStringZ );
+  QVERIFY( wkbLineZRead.is3D() );
+  QVERIFY( !wkbLineZRead.isMeasure() );
+  QVERIFY( wkbLineZRead == wkbLineZ );
+
+  //WKB round trip, M
+  QgsLineString wkbLineM;
+  wkbLineM.setPoints( QgsPointSequence() << QgsPoint( QgsWkbTypes::PointM, 1, 2, 0, 4 )
+                      << QgsPoint( QgsWkbTypes::PointM, 11, 2, 0, 14 )
+                      << QgsPoint( QgsWkbTypes::PointM, 11, 22, 0, 24 ) );
+  QByteArray wkbM = wkbLineM.asWkb();
+  QgsLineString wkbLineMRead;
+  QgsConstWkbPtr wkbMPtr( wkbM );
+  QVERIFY( wkbLineMRead.fromWkb( wkbMPtr ) );
+  QCOMPARE( wkbLineMRead.wkbType(), QgsWkbTypes::LineStringM );
+  QVERIFY( !wkbLineMRead.is3D() );
+  QVERIFY( wkbLineMRead.isMeasure() );
+  QVERIFY( wkbLineMRead == wkbLineM );
+
+  //WKB round trip, empty line
+  QgsLineString wkbLineEmpty;
+  QByteArray wkbEmpty = wkbLineEmpty.asWkb();
+  QVERIFY( !wkbEmpty.isEmpty() );
+  QgsLineString wkbLineEmptyRead;
+  QgsConstWkbPtr wkbEmptyPtr( wkbEmpty );
+  QVERIFY( wkbLineEmptyRead.fromWkb( wkbEmptyPtr ) );
+  QVERIFY( wkbLineEmptyRead.isEmpty() );
+  QCOMPARE( wkbLineEmptyRead.numPoints(), 0 );
+  QCOMPARE( wkbLineEmptyRead.wkbType(), QgsWkbTypes::LineString );
+
   //bad WKB - check for no crash
   l16.clear();
   QgsConstWkbPtr nullPtr( nullptr, 0 );
@@ -16744,6 +16825,22 @@ void TestQgsGeometry::unaryUnion()
 
   QgsGeometry result( QgsGeometry::unaryUnion( list ) );
   Q_UNUSED( result );
+
+  // chunked cancelable path -- large list with feedback must give the same result as
+  // the plain single-call union
+  QVector< QgsGeometry > bigList;
+  for ( int i = 0; i < 150; ++i )
+  {
+    bigList << QgsGeometry::fromRect( QgsRectangle( i, 0, i + 1, 1 ) );
+  }
+  QgsFeedback feedback;
+  QgsGeometry chunkedResult( QgsGeometry::unaryUnion( bigList, &feedback ) );
+  QGSCOMPARENEAR( chunkedResult.area(), QgsGeometry::unaryUnion( bigList ).area(), 0.0001 );
+
+  // canceled feedback returns an empty geometry instead of performing the union
+  feedback.cancel();
+  QgsGeometry canceledResult( QgsGeometry::unaryUnion( bigList, &feedback ) );
+  QVERIFY( canceledResult.isNull() );
 }
 
 void TestQgsGeometry::dataStream()
@@ -18,7 +18,12 @@
 #include <QStringList>
 #include <QSettings>
 
+#include "qgsexpression.h"
+#include "qgsexpressioncontext.h"
+#include "qgsfeature.h"
+#include "qgsfields.h"
 #include "qgsgraduatedsymbolrenderer.h"
+#include "qgssymbol.h"
 #include "qgssymbollayerutils.h"
 
 /**
@@ -38,6 +43,7 @@ class TestQgsGraduatedSymbolRenderer: public QObject
     void rangesOverlap();
     void rangesHaveGaps();
     void classifySymmetric();
+    void filterExpression();
 
 
   private:
@@ -210,5 +216,46 @@ void TestQgsGraduatedSymbolRenderer::classifySymmetric()
   }
 }
 
+void TestQgsGraduatedSymbolRenderer::filterExpression()
+{
+  QgsFields fields;
+  fields.append( QgsField( QStringLiteral( "value" ), QVariant::Double ) );
+
+  QgsGraduatedSymbolRenderer renderer( QStringLiteral( "value" ) );
+  renderer.addClass( QgsRendererRange( 1, 2, new QgsMarkerSymbol(), QStringLiteral( "low" ) ) );
+  renderer.addClass( QgsRendererRange( 2, 3, new QgsMarkerSymbol(), QStringLiteral( "mid" ) ) );
+  renderer.addClass( QgsRendererRange( 3, 4, new QgsMarkerSymbol(), QStringLiteral( "high" ) ) );
+
+  // all classes checked - no provider side filtering needed
+  QVERIFY( renderer.filter( fields ).isEmpty() );
+
+  // subset of classes checked - only the active ranges are fetched
+  QVERIFY( renderer.updateRangeRenderState( 1, false ) );
+  const QString filter = renderer.filter( fields );
+  QCOMPARE( filter, QStringLiteral( "(\"value\" >= 1 AND \"value\" <= 2) OR (\"value\" >= 3 AND \"value\" <= 4)" ) );
+
+  // boundary values of active ranges must pass the filter
+  QgsExpression exp( filter );
+  QgsExpressionContext context;
+  QgsFeature f( fields );
+  auto valuePasses = [&]( double value ) -> bool
+  {
+    f.setAttribute( 0, value );
+    context.setFeature( f );
+    return exp.evaluate( &context ).toBool();
+  };
+  QVERIFY( valuePasses( 1.0 ) );
+  QVERIFY( valuePasses( 2.0 ) );
+  QVERIFY( !valuePasses( 2.5 ) );
+  QVERIFY( valuePasses( 3.0 ) );
+  QVERIFY( valuePasses( 4.0 ) );
+  QVERIFY( !valuePasses( 4.5 ) );
+
+  // no classes checked - nothing should be fetched at all
+  QVERIFY( renderer.updateRangeRenderState( 0, false ) );
+  QVERIFY( renderer.updateRangeRenderState( 2, false ) );
+  QCOMPARE( renderer.filter( fields ), QStringLiteral( "FALSE" ) );
+}
+
 QGSTEST_MAIN( TestQgsGraduatedSymbolRenderer )
 #include "testqgsgraduatedsymbolrenderer.moc"
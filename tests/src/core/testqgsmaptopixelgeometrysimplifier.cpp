@@ -77,6 +77,7 @@ class TestQgsMapToPixelGeometrySimplifier : public QObject
     void testCircularString();
     void testVisvalingam();
     void testRingValidity();
+    void testMaximumVertices();
 
 };
 
@@ -217,5 +218,24 @@ void TestQgsMapToPixelGeometrySimplifier::testRingValidity()
 
 }
 
+void TestQgsMapToPixelGeometrySimplifier::testMaximumVertices()
+{
+  // a dense zig-zag line -- radial distance simplification alone leaves many vertices
+  QStringList points;
+  for ( int i = 0; i <= 100; i++ )
+    points << QStringLiteral( "%1 %2" ).arg( i ).arg( i % 2 );
+  const QgsGeometry g( QgsGeometry::fromWkt( QStringLiteral( "LINESTRING(%1)" ).arg( points.join( ',' ) ) ) );
+
+  QgsMapToPixelSimplifier simplifier( QgsMapToPixelSimplifier::SimplifyGeometry, 2.0 );
+  QCOMPARE( simplifier.maximumVertices(), -1 );
+  QVERIFY( simplifier.simplify( g ).constGet()->nCoordinates() > 10 );
+
+  simplifier.setMaximumVertices( 10 );
+  QCOMPARE( simplifier.maximumVertices(), 10 );
+  const QgsGeometry ret = simplifier.simplify( g );
+  QVERIFY( ret.constGet()->nCoordinates() <= 10 );
+  QVERIFY( ret.constGet()->nCoordinates() >= 2 );
+}
+
 QGSTEST_MAIN( TestQgsMapToPixelGeometrySimplifier )
 #include "testqgsmaptopixelgeometrysimplifier.moc"
@@ -130,6 +130,15 @@ void TestQgsOgrUtils::ogrGeometryToQgsGeometry2_data()
   QTest::newRow( "linestringm" ) << QStringLiteral( "LineStringM (1.1 2.2 3.3, 4.4 5.5 6.6)" ) <<  static_cast< int >( QgsWkbTypes::LineStringM );
   QTest::newRow( "linestringzm" ) << QStringLiteral( "LineStringZM (1.1 2.2 3.3 4.4, 5.5 6.6 7.7 8.8)" ) <<  static_cast< int >( QgsWkbTypes::LineStringZM );
   QTest::newRow( "linestring25d" ) << QStringLiteral( "LineString25D (1.1 2.2 3.3, 4.4 5.5 6.6)" ) <<  static_cast< int >( QgsWkbTypes::LineString25D );
+
+  QTest::newRow( "polygon" ) << QStringLiteral( "Polygon ((0 0, 10 0, 10 10, 0 10, 0 0),(1 1, 2 1, 2 2, 1 1))" ) << static_cast< int >( QgsWkbTypes::Polygon );
+  QTest::newRow( "polygonz" ) << QStringLiteral( "PolygonZ ((0 0 1, 10 0 2, 10 10 3, 0 0 1))" ) << static_cast< int >( QgsWkbTypes::Polygon25D ); // ogr uses 25d for z
+  QTest::newRow( "polygonm" ) << QStringLiteral( "PolygonM ((0 0 1, 10 0 2, 10 10 3, 0 0 1))" ) << static_cast< int >( QgsWkbTypes::PolygonM );
+  QTest::newRow( "polygonzm" ) << QStringLiteral( "PolygonZM ((0 0 1 2, 10 0 2 3, 10 10 3 4, 0 0 1 2))" ) << static_cast< int >( QgsWkbTypes::PolygonZM );
+
+  QTest::newRow( "multipoint" ) << QStringLiteral( "MultiPoint ((1.1 2.2),(3.3 4.4))" ) << static_cast< int >( QgsWkbTypes::MultiPoint );
+  QTest::newRow( "multilinestring" ) << QStringLiteral( "MultiLineString ((1.1 2.2, 3.3 4.4),(5.5 6.6, 7.7 8.8))" ) << static_cast< int >( QgsWkbTypes::MultiLineString );
+  QTest::newRow( "multipolygon" ) << QStringLiteral( "MultiPolygon (((0 0, 10 0, 10 10, 0 0)),((20 20, 30 20, 30 30, 20 20)))" ) << static_cast< int >( QgsWkbTypes::MultiPolygon );
 }
 
 void TestQgsOgrUtils::ogrGeometryToQgsGeometry2()
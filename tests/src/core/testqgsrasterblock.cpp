@@ -38,6 +38,7 @@ class TestQgsRasterBlock : public QObject
     void cleanup() {} // will be called after every testfunction.
 
     void testBasic();
+    void testClone();
     void testWrite();
 
   private:
@@ -153,6 +154,44 @@ void TestQgsRasterBlock::testBasic()
   delete block;
 }
 
+void TestQgsRasterBlock::testClone()
+{
+  QgsRasterDataProvider *provider = mpRasterLayer->dataProvider();
+
+  QgsRasterBlock *block = provider->block( 1, mpRasterLayer->extent(), mpRasterLayer->width(), mpRasterLayer->height() );
+  QgsRasterBlock *copy = block->clone();
+  QVERIFY( copy );
+
+  QCOMPARE( copy->width(), block->width() );
+  QCOMPARE( copy->height(), block->height() );
+  QCOMPARE( copy->dataType(), block->dataType() );
+  QVERIFY( copy->isValid() );
+  QVERIFY( copy->hasNoDataValue() );
+  QCOMPARE( copy->noDataValue(), block->noDataValue() );
+  QCOMPARE( copy->data(), block->data() );
+  QCOMPARE( copy->isNoData( 0, 2 ), true );
+
+  // the copy must not share data with the original
+  block->setData( QByteArray( "\xaa" ) );
+  QCOMPARE( copy->value( 0, 0 ), 2. );
+
+  delete copy;
+
+  // clone of a block using a no data bitmap rather than a no data value
+  QgsRasterBlock *bitmapBlock = new QgsRasterBlock( Qgis::Byte, 2, 2 );
+  bitmapBlock->setData( QByteArray( "\x01\x02\x03\x04" ) );
+  QVERIFY( bitmapBlock->setIsNoData( 1, 1 ) );
+  QgsRasterBlock *bitmapCopy = bitmapBlock->clone();
+  QVERIFY( bitmapCopy );
+  QCOMPARE( bitmapCopy->value( 0, 0 ), 1. );
+  QCOMPARE( bitmapCopy->isNoData( 1, 1 ), true );
+  QCOMPARE( bitmapCopy->isNoData( 0, 1 ), false );
+
+  delete bitmapCopy;
+  delete bitmapBlock;
+  delete block;
+}
+
 void TestQgsRasterBlock::testWrite()
 {
   QgsRectangle extent = mpRasterLayer->extent();
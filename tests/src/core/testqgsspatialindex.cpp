@@ -16,6 +16,7 @@
 #include "qgstest.h"
 #include <QObject>
 #include <QString>
+#include <QTemporaryFile>
 
 #include <qgsapplication.h>
 #include "qgsfeatureiterator.h"
@@ -103,6 +104,35 @@ class TestQgsSpatialIndex : public QObject
       QVERIFY( fids2.contains( 3 ) );
     }
 
+    void testWriteReadFile()
+    {
+      QgsSpatialIndex index;
+      index.addFeature( 1, QgsRectangle( 2, 3, 2, 3 ) );
+      index.addFeature( 2, QgsRectangle( 12, 13, 12, 13 ) );
+      index.addFeature( 3, QgsRectangle( 14, 13, 14, 13 ) );
+
+      QTemporaryFile tmpFile;
+      QVERIFY( tmpFile.open() );
+      tmpFile.close();
+      QVERIFY( index.writeToFile( tmpFile.fileName() ) );
+
+      QgsSpatialIndex restored;
+      QVERIFY( restored.readFromFile( tmpFile.fileName() ) );
+
+      QList<QgsFeatureId> fids = restored.intersects( QgsRectangle( 1, 2, 3, 4 ) );
+      QCOMPARE( fids.count(), 1 );
+      QCOMPARE( fids.at( 0 ), 1LL );
+
+      QList<QgsFeatureId> fids2 = restored.intersects( QgsRectangle( 10, 12, 15, 14 ) );
+      QCOMPARE( fids2.count(), 2 );
+      QVERIFY( fids2.contains( 2 ) );
+      QVERIFY( fids2.contains( 3 ) );
+
+      // reading a non-existent file must leave the index untouched
+      QVERIFY( !restored.readFromFile( QStringLiteral( "/this/path/does/not/exist.qix" ) ) );
+      QCOMPARE( restored.intersects( QgsRectangle( 1, 2, 3, 4 ) ).count(), 1 );
+    }
+
     void testInitFromEmptyIterator()
     {
       QgsFeatureIterator it;
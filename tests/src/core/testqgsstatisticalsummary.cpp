@@ -36,6 +36,8 @@ class TestQgsStatisticSummary: public QObject
     void maxMin();
     void countMissing();
     void noValues();
+    void sketch();
+    void combine();
     void shortName();
 
   private:
@@ -350,6 +352,121 @@ void TestQgsStatisticSummary::noValues()
   QVERIFY( std::isnan( s.statistic( QgsStatisticalSummary::InterQuartileRange ) ) );
 }
 
+void TestQgsStatisticSummary::sketch()
+{
+  // when few enough values are seen the sketch keeps them all, so quantiles stay exact
+  QgsStatisticalSummary s( QgsStatisticalSummary::All );
+  s.setSketchEnabled( true );
+  QVERIFY( s.sketchEnabled() );
+  s.addValue( 4 );
+  s.addValue( 2 );
+  s.addValue( 3 );
+  s.addValue( 2 );
+  s.addValue( 5 );
+  s.addValue( 8 );
+  s.finalize();
+  QCOMPARE( s.count(), 6 );
+  QCOMPARE( s.sum(), 24.0 );
+  QCOMPARE( s.min(), 2.0 );
+  QCOMPARE( s.max(), 8.0 );
+  QGSCOMPARENEAR( s.stDev(), 2.0816, 0.0001 );
+  QGSCOMPARENEAR( s.sampleStDev(), 2.2803, 0.0001 );
+  QCOMPARE( s.median(), 3.5 );
+
+  // estimated quantiles over a large stream should stay within the requested accuracy
+  s.setSketchEnabled( true, 0.01 );
+  for ( int i = 0; i < 10000; i++ )
+  {
+    // pseudo-shuffled permutation of 0...9999
+    s.addValue( ( i * 7919 ) % 10000 );
+  }
+  s.finalize();
+  QCOMPARE( s.count(), 10000 );
+  QCOMPARE( s.min(), 0.0 );
+  QCOMPARE( s.max(), 9999.0 );
+  QGSCOMPARENEAR( s.mean(), 4999.5, 0.0001 );
+  QGSCOMPARENEAR( s.stDev(), 2886.7513, 0.001 );
+  QGSCOMPARENEAR( s.sampleStDev(), 2886.8956, 0.001 );
+  // accuracy of 0.01 == within roughly one percentile, i.e. 100 ranks here
+  QGSCOMPARENEAR( s.median(), 4999.5, 100 );
+  QGSCOMPARENEAR( s.firstQuartile(), 2499.75, 100 );
+  QGSCOMPARENEAR( s.thirdQuartile(), 7499.25, 100 );
+
+  // disabling the sketch restores exact calculation
+  s.setSketchEnabled( false );
+  QVERIFY( !s.sketchEnabled() );
+  s.calculate( QList< double >() << 7 << 15 << 36 << 39 << 40 << 41 );
+  QCOMPARE( s.median(), 37.5 );
+  QCOMPARE( s.firstQuartile(), 15.0 );
+  QCOMPARE( s.thirdQuartile(), 40.0 );
+}
+
+void TestQgsStatisticSummary::combine()
+{
+  // combining partial summaries must give the same results as a single pass over all values
+  QList<double> values1;
+  values1 << 4 << 2 << 3 << 2 << 5 << 8;
+  QList<double> values2;
+  values2 << 9 << 4 << 5 << 12 << 12 << 12;
+
+  QgsStatisticalSummary total( QgsStatisticalSummary::All );
+  total.calculate( values1 + values2 );
+
+  QgsStatisticalSummary part1( QgsStatisticalSummary::All );
+  QgsStatisticalSummary part2( QgsStatisticalSummary::All );
+  for ( double value : values1 )
+    part1.addValue( value );
+  for ( double value : values2 )
+    part2.addValue( value );
+  part2.addVariant( QVariant() );
+  part1.combine( part2 );
+  part1.finalize();
+
+  QCOMPARE( part1.count(), total.count() );
+  QCOMPARE( part1.countMissing(), 1 );
+  QCOMPARE( part1.sum(), total.sum() );
+  QCOMPARE( part1.mean(), total.mean() );
+  QCOMPARE( part1.min(), total.min() );
+  QCOMPARE( part1.max(), total.max() );
+  QCOMPARE( part1.first(), 4.0 );
+  QCOMPARE( part1.last(), 12.0 );
+  QGSCOMPARENEAR( part1.stDev(), total.stDev(), 0.0000001 );
+  QGSCOMPARENEAR( part1.sampleStDev(), total.sampleStDev(), 0.0000001 );
+  QCOMPARE( part1.median(), total.median() );
+  QCOMPARE( part1.firstQuartile(), total.firstQuartile() );
+  QCOMPARE( part1.thirdQuartile(), total.thirdQuartile() );
+  QCOMPARE( part1.variety(), total.variety() );
+  QCOMPARE( part1.minority(), total.minority() );
+  QCOMPARE( part1.majority(), total.majority() );
+
+  // combining an empty partial summary is a no-op
+  QgsStatisticalSummary empty( QgsStatisticalSummary::All );
+  part1.combine( empty );
+  part1.finalize();
+  QCOMPARE( part1.count(), total.count() );
+  QCOMPARE( part1.last(), 12.0 );
+
+  // combining sketch based summaries retains the configured accuracy
+  QgsStatisticalSummary sketch1( QgsStatisticalSummary::All );
+  sketch1.setSketchEnabled( true, 0.01 );
+  QgsStatisticalSummary sketch2( QgsStatisticalSummary::All );
+  sketch2.setSketchEnabled( true, 0.01 );
+  for ( int i = 0; i < 5000; i++ )
+    sketch1.addValue( i );
+  for ( int i = 5000; i < 10000; i++ )
+    sketch2.addValue( i );
+  sketch1.combine( sketch2 );
+  sketch1.finalize();
+  QCOMPARE( sketch1.count(), 10000 );
+  QCOMPARE( sketch1.first(), 0.0 );
+  QCOMPARE( sketch1.last(), 9999.0 );
+  QGSCOMPARENEAR( sketch1.mean(), 4999.5, 0.0001 );
+  QGSCOMPARENEAR( sketch1.stDev(), 2886.7513, 0.001 );
+  QGSCOMPARENEAR( sketch1.median(), 4999.5, 100 );
+  QGSCOMPARENEAR( sketch1.firstQuartile(), 2499.75, 100 );
+  QGSCOMPARENEAR( sketch1.thirdQuartile(), 7499.25, 100 );
+}
+
 void TestQgsStatisticSummary::shortName()
 {
   QCOMPARE( QgsStatisticalSummary::shortName( QgsStatisticalSummary::Count ), QStringLiteral( "count" ) );
@@ -52,6 +52,7 @@ class TestQgsSvgCache : public QObject
     void threadSafeImage();
     void changeImage(); //check that cache is updated if svg source file changes
     void base64();
+    void prefetchImage();
 
 };
 
@@ -258,6 +259,27 @@ void TestQgsSvgCache::base64()
 
 }
 
+void TestQgsSvgCache::prefetchImage()
+{
+  QgsSvgCache cache;
+  QString svgPath = TEST_DATA_DIR + QStringLiteral( "/sample_svg.svg" );
+
+  cache.prefetchImage( svgPath, 100, QColor( 255, 0, 0 ), QColor( 0, 255, 0 ), 1, 1 );
+  // scheduling the same render again must not queue a second task
+  cache.prefetchImage( svgPath, 100, QColor( 255, 0, 0 ), QColor( 0, 255, 0 ), 1, 1 );
+  QCOMPARE( cache.mPrefetchFutures.size(), 1 );
+
+  for ( QFuture< void > &future : cache.mPrefetchFutures )
+    future.waitForFinished();
+  QVERIFY( cache.mPendingPrefetches.isEmpty() );
+
+  // the prefetched image must now be served straight from the cache
+  bool fitsInCache = false;
+  QImage image = cache.svgAsImage( svgPath, 100, QColor( 255, 0, 0 ), QColor( 0, 255, 0 ), 1, 1, fitsInCache );
+  QVERIFY( !image.isNull() );
+  QVERIFY( fitsInCache );
+}
+
 bool TestQgsSvgCache::imageCheck( const QString &testName, QImage &image, int mismatchCount )
 {
   //draw background
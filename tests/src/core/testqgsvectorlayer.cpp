@@ -14,6 +14,7 @@
  ***************************************************************************/
 #include "qgstest.h"
 #include <QObject>
+#include <QSignalSpy>
 #include <QString>
 #include <QStringList>
 #include <QApplication>
@@ -99,6 +100,7 @@ class TestQgsVectorLayer : public QObject
     void maximumValue();
     void isSpatial();
     void testAddTopologicalPoints();
+    void testBulkChangeAttributeValues();
 };
 
 void TestQgsVectorLayer::initTestCase()
@@ -378,5 +380,70 @@ void TestQgsVectorLayer::testAddTopologicalPoints()
   delete layerLine;
 }
 
+void TestQgsVectorLayer::testBulkChangeAttributeValues()
+{
+  QgsVectorLayer layer( QStringLiteral( "Point?field=col1:integer&field=col2:string" ), QStringLiteral( "layer" ), QStringLiteral( "memory" ) );
+  QVERIFY( layer.isValid() );
+
+  QgsFeature f1( layer.fields() );
+  f1.setAttributes( QgsAttributes() << 1 << QStringLiteral( "a" ) );
+  QgsFeature f2( layer.fields() );
+  f2.setAttributes( QgsAttributes() << 2 << QStringLiteral( "b" ) );
+  QgsFeatureList features;
+  features << f1 << f2;
+  QVERIFY( layer.dataProvider()->addFeatures( features ) );
+  const QgsFeatureId fid1 = features.at( 0 ).id();
+  const QgsFeatureId fid2 = features.at( 1 ).id();
+
+  QVERIFY( layer.startEditing() );
+
+  QgsChangedAttributesMap newValues;
+  newValues[fid1].insert( 0, 11 );
+  newValues[fid1].insert( 1, QStringLiteral( "aa" ) );
+  newValues[fid2].insert( 0, 22 );
+  QVERIFY( layer.changeAttributeValues( newValues ) );
+
+  // the whole bulk update must result in a single undo stack entry
+  QCOMPARE( layer.undoStack()->index(), 1 );
+  QCOMPARE( layer.getFeature( fid1 ).attributes(), QgsAttributes() << 11 << QStringLiteral( "aa" ) );
+  QCOMPARE( layer.getFeature( fid2 ).attributes(), QgsAttributes() << 22 << QStringLiteral( "b" ) );
+
+  // one undo step reverts every feature, with the old values fetched from the
+  // provider as none were supplied
+  layer.undoStack()->undo();
+  QCOMPARE( layer.undoStack()->index(), 0 );
+  QCOMPARE( layer.getFeature( fid1 ).attributes(), QgsAttributes() << 1 << QStringLiteral( "a" ) );
+  QCOMPARE( layer.getFeature( fid2 ).attributes(), QgsAttributes() << 2 << QStringLiteral( "b" ) );
+
+  // one redo step reapplies every change
+  layer.undoStack()->redo();
+  QCOMPARE( layer.getFeature( fid1 ).attributes(), QgsAttributes() << 11 << QStringLiteral( "aa" ) );
+  QCOMPARE( layer.getFeature( fid2 ).attributes(), QgsAttributes() << 22 << QStringLiteral( "b" ) );
+  layer.undoStack()->undo();
+
+  // supplied old values avoid the provider fetch on undo and are reported in
+  // the attributeValueChanged signal, matching the per-feature overload
+  newValues.clear();
+  newValues[fid1].insert( 0, 111 );
+  QgsChangedAttributesMap oldValues;
+  oldValues[fid1].insert( 0, 7 );
+  QVERIFY( layer.changeAttributeValues( newValues, oldValues ) );
+  QCOMPARE( layer.getFeature( fid1 ).attribute( 0 ).toInt(), 111 );
+  QSignalSpy spy( &layer, &QgsVectorLayer::attributeValueChanged );
+  layer.undoStack()->undo();
+  QCOMPARE( layer.getFeature( fid1 ).attribute( 0 ).toInt(), 1 );
+  QCOMPARE( spy.count(), 1 );
+  QCOMPARE( spy.at( 0 ).at( 2 ).toInt(), 7 );
+
+  // an invalid field index rejects the batch without touching the undo stack
+  const int undoIndex = layer.undoStack()->index();
+  newValues.clear();
+  newValues[fid1].insert( 10, 5 );
+  QVERIFY( !layer.changeAttributeValues( newValues ) );
+  QCOMPARE( layer.undoStack()->index(), undoIndex );
+
+  QVERIFY( layer.rollBack() );
+}
+
 QGSTEST_MAIN( TestQgsVectorLayer )
 #include "testqgsvectorlayer.moc"
@@ -56,6 +56,7 @@ class TestVectorLayerCache : public QObject
     void testCanUseCacheForRequest();
     void testCacheGeom();
     void testFullCacheWithRect(); // Test that if rect is set then no full cache can exist, see #19468
+    void testCacheSpatialIndex(); // Test rect requests against a full cache with spatial index
 
     void onCommittedFeaturesAdded( const QString &, const QgsFeatureList & );
 
@@ -420,6 +421,52 @@ void TestVectorLayerCache::testFullCacheWithRect()
 
 }
 
+void TestVectorLayerCache::testCacheSpatialIndex()
+{
+  QgsVectorLayerCache cache( mPointsLayer, mPointsLayer->featureCount() );
+  cache.setCacheGeometry( true );
+  QVERIFY( !cache.hasCacheSpatialIndex() );
+  cache.setCacheSpatialIndex( true );
+  QVERIFY( cache.hasCacheSpatialIndex() );
+  cache.setFullCache( true );
+  QVERIFY( cache.hasFullCache() );
+
+  // rect request served through the spatial index must return the same features
+  // as the layer itself
+  QgsRectangle rect = mPointsLayer->extent().buffered( -mPointsLayer->extent().width() / 4 );
+  QgsFeatureRequest req;
+  req.setFilterRect( rect );
+
+  QgsFeatureIds expected;
+  QgsFeature f;
+  QgsFeatureIterator it = mPointsLayer->getFeatures( req );
+  while ( it.nextFeature( f ) )
+    expected << f.id();
+  QVERIFY( !expected.isEmpty() );
+
+  QgsFeatureIds cached;
+  it = cache.getFeatures( req );
+  while ( it.nextFeature( f ) )
+  {
+    QVERIFY( f.hasGeometry() );
+    cached << f.id();
+  }
+  QCOMPARE( cached, expected );
+
+  // deleted features must disappear from the index too
+  QgsFeatureId removeId = *expected.constBegin();
+  mPointsLayer->startEditing();
+  QVERIFY( mPointsLayer->deleteFeature( removeId ) );
+
+  cached.clear();
+  it = cache.getFeatures( req );
+  while ( it.nextFeature( f ) )
+    cached << f.id();
+  QVERIFY( !cached.contains( removeId ) );
+
+  mPointsLayer->rollBack();
+}
+
 void TestVectorLayerCache::onCommittedFeaturesAdded( const QString &layerId, const QgsFeatureList &features )
 {
   Q_UNUSED( layerId )
@@ -35,6 +35,7 @@ class TestQgsVectorLayerUtils : public QObject
     void cleanup() {} // will be called after every testfunction.
 
     void testGetFeatureSource();
+    void testValidateAttributes();
 };
 
 void TestQgsVectorLayerUtils::initTestCase()
@@ -126,5 +127,39 @@ void TestQgsVectorLayerUtils::testGetFeatureSource()
   thread2->quit();
 }
 
+void TestQgsVectorLayerUtils::testValidateAttributes()
+{
+  QgsVectorLayer vl( QStringLiteral( "Point?field=col1:integer" ), QStringLiteral( "vl" ), QStringLiteral( "memory" ) );
+  vl.setFieldConstraint( 0, QgsFieldConstraints::ConstraintUnique );
+
+  QgsFeature existing( vl.fields(), 1 );
+  existing.setAttribute( QStringLiteral( "col1" ), 1 );
+  vl.dataProvider()->addFeature( existing );
+
+  QgsFeature f1( vl.fields(), 2 );
+  f1.setAttribute( QStringLiteral( "col1" ), 2 );
+  QgsFeature f2( vl.fields(), 3 );
+  f2.setAttribute( QStringLiteral( "col1" ), 3 );
+
+  QStringList errors;
+  QVERIFY( QgsVectorLayerUtils::validateAttributes( &vl, QgsFeatureList() << f1 << f2, errors ) );
+  QVERIFY( errors.isEmpty() );
+
+  // collision with an existing value
+  f2.setAttribute( QStringLiteral( "col1" ), 1 );
+  QVERIFY( !QgsVectorLayerUtils::validateAttributes( &vl, QgsFeatureList() << f1 << f2, errors ) );
+  QCOMPARE( errors.size(), 1 );
+
+  // duplicates within the batch itself must be detected too
+  f2.setAttribute( QStringLiteral( "col1" ), 2 );
+  QVERIFY( !QgsVectorLayerUtils::validateAttributes( &vl, QgsFeatureList() << f1 << f2, errors ) );
+  QCOMPARE( errors.size(), 1 );
+
+  // NULL values never trip uniqueness
+  f1.setAttribute( QStringLiteral( "col1" ), QVariant( QVariant::Int ) );
+  f2.setAttribute( QStringLiteral( "col1" ), QVariant( QVariant::Int ) );
+  QVERIFY( QgsVectorLayerUtils::validateAttributes( &vl, QgsFeatureList() << f1 << f2, errors ) );
+}
+
 QGSTEST_MAIN( TestQgsVectorLayerUtils )
 #include "testqgsvectorlayerutils.moc"